@@ -0,0 +1,64 @@
+/*
+  ==============================================================================
+
+    AuditionPlayer.h
+    Created: 17 Oct 2026 10:07:32pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef AUDITIONPLAYER_H_INCLUDED
+#define AUDITIONPLAYER_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <atomic>
+
+//! AuditionPlayer: plays a rendered snippet of a preset on top of the output, for the preset browser
+/*! The snippet is rendered elsewhere, see PresetPreview, so auditioning a preset neither loads
+    it nor touches the voices and the state of the instance. The message thread hands the
+    snippet over through an atomic pointer and keeps a reference until the audio thread has
+    moved on to another one, so the audio thread never releases a snippet. The snippet is
+    added after the master stage at its own rate, with a linear interpolation to the rate of
+    the host.
+*/
+class AuditionPlayer {
+public:
+    //! a rendered snippet, stereo
+    class Snippet : public ReferenceCountedObject {
+    public:
+        typedef ReferenceCountedObjectPtr<Snippet> Ptr;
+        AudioSampleBuffer audio;
+        double sampleRate = 44100.;
+    };
+
+    AuditionPlayer();
+
+    //! \brief message thread: plays the snippet from its start instead of the one playing, nullptr stops
+    void play(Snippet* snippet);
+
+    //! \brief any thread: a snippet is playing or about to start
+    bool isPlaying() const { return active.load() || requested.load() != nullptr; }
+
+    //! \brief audio thread: adds the playing snippet to the output at the rate of the host
+    void process(AudioSampleBuffer& buffer, double sampleRate);
+
+    constexpr static float gain = .5f;  //!< -6 dB, below the level of a preset played on the instance
+
+private:
+    ReferenceCountedArray<Snippet> held;    //!< message thread: the snippets the audio thread may still read
+    Snippet stopRequest;                    //!< requested to stop, never held
+    std::atomic<Snippet*> requested;        //!< message -> audio, nullptr if nothing new
+    std::atomic<Snippet*> inUse;            //!< audio -> message, the snippet the audio thread reads
+    std::atomic<bool> active;               //!< audio -> message, a snippet is playing
+
+    //! \name audio thread only
+    ///@{
+    Snippet* current;
+    double position;        //!< in samples of the snippet
+    ///@}
+
+    JUCE_DECLARE_NON_COPYABLE(AuditionPlayer)
+};
+
+#endif  // AUDITIONPLAYER_H_INCLUDED
@@ -0,0 +1,58 @@
+/*
+  ==============================================================================
+
+    BackgroundJobs.h
+    Created: 17 Oct 2026 2:14:53am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef BACKGROUNDJOBS_H_INCLUDED
+#define BACKGROUNDJOBS_H_INCLUDED
+
+#include "JuceHeader.h"
+
+//! BackgroundJobs: the threads of the non-realtime work of all instances of the process
+/*! The fx buffers, the patch loader, the captures and the visuals of the editor do their work
+    as TimeSliceClients, and before each of them spawned a thread of its own, some of them per
+    instance. Held through a SharedResourcePointer there is one thread per priority for the whole
+    process instead, however many instances and jobs there are. A job of a higher priority never
+    waits for one of a lower priority, e.g. an fx buffer the audio thread bypasses until it is
+    allocated does not wait for a scope to be rendered. Within a priority the jobs share the
+    thread like on a TimeSliceThread, a slice must return soon.
+    remove() cancels a job: it waits until a running slice returns and the job is not called
+    again, the usual first line of the destructor of a job. The audio thread never calls into
+    the jobs, it picks up their results through the lock-free handoff each job has, an atomic
+    pointer for an fx buffer or the triple buffer of a patch, and asks for work through atomics
+    the job polls, as waking a thread would take a lock.
+*/
+class BackgroundJobs {
+public:
+    enum class ePriority : int {
+        eHigh = 0,      //!< the audio thread waits for the result: fx buffers, patches, factory banks
+        eNormal = 1,    //!< files and monitors: session captures, the deadline monitor
+        eLow = 2,       //!< what only the editor shows: scopes, curves and their images
+        nSteps = 3
+    };
+
+    BackgroundJobs();
+    ~BackgroundJobs();
+
+    //! \brief starts calling the job on the thread of its priority, not on the audio thread
+    void add(TimeSliceClient* job, ePriority priority);
+    //! \brief cancels the job, waits until a running slice of it returned
+    void remove(TimeSliceClient* job);
+    //! \brief calls the job as soon as its thread is free, after new work was handed to it
+    void wake(TimeSliceClient* job);
+
+    //! \brief jobs of a priority, for diagnostics
+    int getNumJobs(ePriority priority) const;
+
+private:
+    OwnedArray<TimeSliceThread> threads;    //!< one per priority
+
+    JUCE_DECLARE_NON_COPYABLE(BackgroundJobs)
+};
+
+#endif  // BACKGROUNDJOBS_H_INCLUDED
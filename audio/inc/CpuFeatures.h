@@ -0,0 +1,41 @@
+/*
+  ==============================================================================
+
+    CpuFeatures.h
+    Created: 15 Oct 2026 11:32:18am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef CPUFEATURES_H_INCLUDED
+#define CPUFEATURES_H_INCLUDED
+
+//! CpuFeatures: the vector instruction sets of the machine, detected once
+/*! The same binary runs on anything from the oldest supported machine up, so the kernels that
+    gain most from wider registers are compiled for several instruction sets and picked at
+    runtime, see SimdKernels. On x86 the detection asks cpuid, and for the AVX registers also
+    whether the os saves them on a context switch. NEON is part of every 64 bit ARM. The
+    environment variable SYNISTER_SIMD (scalar, sse2, avx, avx2, avx512, neon) caps the level,
+    for comparing the kernels on one machine, a level the machine does not have is ignored.
+*/
+namespace CpuFeatures {
+    //! the x86 levels include the ones before them
+    enum class eLevel {
+        eScalar = 0,
+        eSse2,
+        eAvx,
+        eAvx2,
+        eAvx512,
+        eNeon
+    };
+
+    //! \brief the best level of the cpu and the os, detected on the first call
+    eLevel getSupported();
+    //! \brief the level the kernels are picked for: the supported one, capped by SYNISTER_SIMD
+    eLevel getSelected();
+    //! \brief lower case name, as SYNISTER_SIMD takes it
+    const char* getName(eLevel level);
+}
+
+#endif  // CPUFEATURES_H_INCLUDED
@@ -0,0 +1,117 @@
+/*
+  ==============================================================================
+
+    CpuMeter.h
+    Created: 15 Oct 2026 8:24:05am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef CPUMETER_H_INCLUDED
+#define CPUMETER_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "TripleBuffer.h"
+#include "Trace.h"
+#include <array>
+#include <atomic>
+
+//! stages of processBlock the CpuMeter times
+enum class eCpuStage : int {
+    eHost = 0,      //!< updateHostInfo()
+    eEvents,        //!< param events, patches, midi and the snapshot
+    eSequencer,     //!< stepSeq.runSeq()
+    eVoices,        //!< the synth with the mod matrix compile and the delay compensation
+    eFxLowFi,       //!< the effects in the order of eFxType
+    eFxClipping,
+    eFxDelay,
+    eFxChorus,
+    eFxReverb,
+    eFxWaveshaper,
+    eMaster,        //!< master volume and pan, the telemetry
+    eTotal,         //!< the whole block
+    nSteps
+};
+
+//! the statistics of the stages over the last window, in percent of the real-time budget of a block
+struct CpuStats {
+    static const int numStages = static_cast<int>(eCpuStage::nSteps);
+    std::array<float, numStages> mean {};
+    std::array<float, numStages> p99 {};
+    std::array<float, numStages> max {};
+    float meanActiveVoices = 0.f;
+    float voicePercent = 0.f;       //!< mean of eVoices per active voice
+    int numBlocks = 0;              //!< 0 while nothing was measured yet
+};
+
+//! CpuMeter: time of the stages of processBlock relative to the duration of the block
+/*! The audio thread takes a high resolution timestamp at the end of every stage, a stage gets
+    the time since the previous mark, in a trace build it is also recorded as a span. After
+    windowSize blocks the mean, the 99th percentile and the maximum of every stage are published
+    in a triple buffer, the percentiles come from a histogram in steps of one percent, so nothing
+    is sorted or allocated. Nothing is measured while no reader is registered and no trace is
+    recorded.
+*/
+class CpuMeter {
+public:
+    CpuMeter();
+
+    //! \brief the reader of the statistics, e.g. the info panel, registers while it shows them
+    void addReader() { readers.fetch_add(1, std::memory_order_relaxed); }
+    void removeReader() { readers.fetch_sub(1, std::memory_order_relaxed); }
+
+    //! \name audio thread
+    ///@{
+    //! \brief starts the timing of a block if there is a reader
+    void startBlock();
+    //! \brief the time since the last mark belongs to the stage
+    void mark(eCpuStage stage) {
+        if (measuring) {
+            const int64 now = Time::getHighResolutionTicks();
+            blockTicks[static_cast<size_t>(stage)] += now - lastTicks;
+#if SYNISTER_TRACE
+            Trace::record(getStageName(stage), lastTicks, now);
+#endif
+            lastTicks = now;
+        }
+    }
+    //! \brief true between startBlock() and endBlock() of a measured block
+    bool isMeasuring() const { return measuring; }
+    //! \brief adds the block to the window, publishes the window once it is full
+    void endBlock(int numSamples, double sampleRate, int activeVoices);
+    ///@}
+
+    //! \brief picks up the statistics of a new window, true if there is one, message thread
+    bool update() { return stats.update(); }
+    //! \brief the statistics picked up by the last update(), message thread
+    const CpuStats& getStats() const { return stats.get(); }
+
+    //! \brief name of a stage for the ui
+    static const char* getStageName(eCpuStage stage);
+
+    static const int windowSize = 256;      //!< blocks per published window
+    static const int histogramSize = 201;   //!< one percent steps, the last one collects everything above 200 %
+
+private:
+    std::atomic<int> readers;
+    bool measuring;
+    int64 blockStart;
+    int64 lastTicks;
+    std::array<int64, CpuStats::numStages> blockTicks;
+
+    //! \name the current window
+    ///@{
+    int windowBlocks;
+    double windowVoices;
+    std::array<double, CpuStats::numStages> sums;
+    std::array<float, CpuStats::numStages> maxima;
+    std::array<std::array<uint16, histogramSize>, CpuStats::numStages> histograms;
+    ///@}
+
+    TripleBuffer<CpuStats> stats;
+
+    JUCE_DECLARE_NON_COPYABLE(CpuMeter)
+};
+
+#endif  // CPUMETER_H_INCLUDED
@@ -0,0 +1,107 @@
+/*
+  ==============================================================================
+
+    DeadlineMonitor.h
+    Created: 15 Oct 2026 8:51:30am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef DEADLINEMONITOR_H_INCLUDED
+#define DEADLINEMONITOR_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "BackgroundJobs.h"
+#include <array>
+#include <atomic>
+
+//! a block that took longer than the threshold of its real-time budget
+struct DeadlineIncident {
+    static const int maxMidiEvents = 16;
+    static const int maxCounters = 8;
+
+    int64 block = 0;            //!< number of the block since the monitor was created
+    uint32 timeMs = 0;          //!< Time::getMillisecondCounter() at the end of the block
+    float load = 0.f;           //!< render time relative to the duration of the block
+    int numSamples = 0;
+    double sampleRate = 0.;
+    int activeVoices = 0;
+    uint32 activeFx = 0;        //!< bit per eFxType
+    int numMidiEvents = 0;      //!< of the block, up to maxMidiEvents are kept
+    std::array<uint8, 3 * maxMidiEvents> midi {};   //!< up to three bytes per event, longer ones are cut
+    std::array<int, maxMidiEvents> midiPositions {};
+    int numCounters = 0;        //!< instrumentation counters of the block, see Instrument.h
+    std::array<const char*, maxCounters> counterNames {};
+    std::array<int64, maxCounters> counterValues {};
+};
+
+//! DeadlineMonitor: histogram of the block render times and the context of the blocks that came close to a dropout
+/*! The audio thread adds the load of every block, the render time relative to the block duration,
+    to a histogram of atomic counters. A block above the threshold also hands its context to a fifo,
+    without waiting or allocating. The normal priority thread of BackgroundJobs takes the incidents out, appends
+    them to the log file and keeps the last ones for the editor.
+*/
+class DeadlineMonitor : private TimeSliceClient {
+public:
+    DeadlineMonitor();
+    ~DeadlineMonitor();
+
+    //! \name audio thread
+    ///@{
+    //! \brief adds a block, true if its load is above the threshold and addIncident() should follow
+    bool addBlock(float load);
+    //! \brief hands the context of the block to the log thread, dropped if the fifo is full
+    void addIncident(DeadlineIncident& incident);
+    ///@}
+
+    //! \brief fraction of the block duration above which a block is logged, any thread
+    void setThreshold(float fraction) { threshold.store(jmax(0.05f, fraction)); }
+    float getThreshold() const { return threshold.load(); }
+
+    static const int numBins = 41;      //!< steps of 5 % of the budget, the last one collects everything above 200 %
+    static const int binPercent = 5;
+    //! \brief blocks with a load in the bin, any thread
+    uint32 getBinCount(int bin) const { return histogram[static_cast<size_t>(bin)].load(std::memory_order_relaxed); }
+    //! \brief all blocks, those above the threshold and the highest load since the start, any thread
+    int64 getNumBlocks() const { return numBlocks.load(std::memory_order_relaxed); }
+    int64 getNumIncidents() const { return numIncidents.load(std::memory_order_relaxed); }
+    float getWorstLoad() const { return worstLoad.load(std::memory_order_relaxed); }
+
+    //! \brief the last incidents the log thread took out of the fifo, newest last, message thread
+    void getRecentIncidents(Array<DeadlineIncident>& dst) const;
+
+    //! \brief where the incidents are appended
+    static File getLogFile();
+
+    static const int maxRecentIncidents = 32;
+
+private:
+    //! writes the incidents of the fifo to the log file
+    int useTimeSlice() override;
+    static String describe(const DeadlineIncident& incident);
+
+    SharedResourcePointer<BackgroundJobs> jobs;
+
+    std::atomic<float> threshold;
+    std::array<std::atomic<uint32>, numBins> histogram;
+    std::atomic<int64> numBlocks;
+    std::atomic<int64> numIncidents;
+    std::atomic<float> worstLoad;
+    int64 block;                        //!< audio thread
+
+    //! \name audio -> log thread
+    ///@{
+    static const int fifoSize = 64;
+    AbstractFifo fifo;
+    std::array<DeadlineIncident, fifoSize> pending;
+    ///@}
+
+    CriticalSection recentLock;
+    Array<DeadlineIncident> recent;
+    ScopedPointer<FileOutputStream> log;    //!< log thread, opened with the first incident
+
+    JUCE_DECLARE_NON_COPYABLE(DeadlineMonitor)
+};
+
+#endif  // DEADLINEMONITOR_H_INCLUDED
@@ -0,0 +1,97 @@
+/*
+  ==============================================================================
+
+    Denormals.h
+    Created: 15 Oct 2026 12:14:08am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef DENORMALS_H_INCLUDED
+#define DENORMALS_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <cmath>
+
+#if JUCE_INTEL
+ #include <xmmintrin.h>
+#endif
+
+//! ScopedFlushToZero: flush-to-zero and denormals-are-zero on the current thread while the object lives
+/*! The decaying state of the filters and the delay feedback ends up in the denormal range during
+    tails, where every operation on it is many times slower on x86. With both modes on, denormal
+    results and operands count as zero. The previous mode of the thread is restored at the end,
+    the host may rely on it. Without SSE or ARMv8 this does nothing.
+*/
+class ScopedFlushToZero {
+public:
+    ScopedFlushToZero()
+        : previousMode(getMode())
+    {
+#if JUCE_INTEL
+        setMode(previousMode | 0x8040u); // FTZ | DAZ
+#elif JUCE_ARM && JUCE_64BIT && defined (__GNUC__)
+        setMode(previousMode | (1u << 24)); // FZ
+#endif
+    }
+
+    ~ScopedFlushToZero() {
+        setMode(previousMode);
+    }
+
+private:
+    static uint32 getMode() {
+#if JUCE_INTEL
+        return static_cast<uint32>(_mm_getcsr());
+#elif JUCE_ARM && JUCE_64BIT && defined (__GNUC__)
+        uint64 fpcr;
+        asm volatile("mrs %0, fpcr" : "=r"(fpcr));
+        return static_cast<uint32>(fpcr);
+#else
+        return 0;
+#endif
+    }
+
+    static void setMode(uint32 mode) {
+#if JUCE_INTEL
+        _mm_setcsr(mode);
+#elif JUCE_ARM && JUCE_64BIT && defined (__GNUC__)
+        const uint64 fpcr = mode;
+        asm volatile("msr fpcr, %0" : : "r"(fpcr));
+#else
+        ignoreUnused(mode);
+#endif
+    }
+
+    const uint32 previousMode;
+
+    JUCE_DECLARE_NON_COPYABLE(ScopedFlushToZero)
+};
+
+//! Denormals: helpers for the state of recursive filters and feedback loops
+struct Denormals {
+    //! magnitude below which a state variable counts as decayed, far below -96 dB and far above the denormal range
+    constexpr static float flushThreshold = 1e-15f;
+
+    //! \brief sets a decayed state variable to zero, for silence boundaries like the end of a note or a tail
+    static void flush(float& x) {
+        x = std::abs(x) < flushThreshold ? 0.f : x;
+    }
+
+    //! \brief true for a denormal float
+    static bool isDenormal(float x) {
+        return std::fpclassify(x) == FP_SUBNORMAL;
+    }
+
+    //! \brief number of denormal values in a block
+    static int count(const float *x, int n) {
+        int numDenormals = 0;
+        for (int i = 0; i < n; ++i) {
+            numDenormals += isDenormal(x[i]) ? 1 : 0;
+        }
+        return numDenormals;
+    }
+};
+
+#endif  // DENORMALS_H_INCLUDED
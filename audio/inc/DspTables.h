@@ -0,0 +1,92 @@
+/*
+  ==============================================================================
+
+    DspTables.h
+    Created: 15 Oct 2026 2:02:44pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef DSPTABLES_H_INCLUDED
+#define DSPTABLES_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "Oversampler.h"
+#include "Tuning.h"
+#include <array>
+#include <cstring>
+
+//! DspTables: the small read-only tables of the dsp code, one copy for the whole process
+/*! Built on the first call of get(), which is the construction of the first voice, and never
+    changed afterwards, so every thread reads them without synchronisation and an instance adds
+    nothing but a reference. None of them depends on the sample rate. The wavetables are large
+    enough to be freed with the last instance instead, see SharedWavetables.
+*/
+struct DspTables {
+    //! \brief the tables, thread safe
+    static const DspTables& get();
+
+    //! odd taps centre + 1, centre + 3, ... of the half-band filter of the oversampling, the centre tap is .5
+    std::array<float, HalfbandDecimator::numOddTaps> halfbandTaps;
+
+    //! 2^((n - 69) / 12), times the master tune the equal temperament of MidiMessage::getMidiNoteInHertz()
+    std::array<double, Tuning::numNotes> equalTemperament;
+
+    //! \name the curves of FxWaveshaper
+    /*! Sampled at shaperTableSize + 1 points over [-shaperRange..shaperRange] and read with linear
+        interpolation, which is more than 90 dB below the curve; inputs beyond the range read its end.
+    */
+    ///@{
+    static const int shaperTableSize = 4096;
+    static const int numShaperCurves = 3;   //!< eShaperCurve::nSteps
+    constexpr static float shaperRange = 16.f;
+    //! by eShaperCurve: tanh, asymmetric, foldback; a guard point after the end keeps the interpolation of the last one in the table
+    std::array<std::array<float, shaperTableSize + 2>, numShaperCurves> shaperCurves;
+    ///@}
+
+    //! \name the cutoff functions of the filter design
+    /*! Over the cutoff normalised to the sample rate, so one table serves every rate and
+        oversampling factor. The exponent of the float picks the octave and the mantissa the point
+        within it, filterPointsPerOctave of them spaced evenly, so a lookup needs no log. The
+        octaves reach from 2^-filterOctaves / 2 to 1/2, the relative error is below 1e-4 up to .45
+        and grows towards the pole of the tangent at .5, see Filter::cutoffFunctions().
+    */
+    ///@{
+    static const int filterOctaves = 18;
+    static const int filterPointsPerOctave = 256;
+    constexpr static float filterMinCutoff = 1.f / (1 << (filterOctaves + 1));  //!< normalised, lower cutoffs read this one
+    constexpr static float filterMaxCutoff = .49f;  //!< normalised, higher cutoffs read this one
+
+    //! the functions of one cutoff x
+    struct CutoffPoint {
+        float sin2Pi;   //!< sin(2 pi x)
+        float cos2Pi;   //!< cos(2 pi x)
+        float tanPi;    //!< tan(pi x)
+    };
+    //! a guard point after the end keeps the interpolation of the last one in the table
+    std::array<CutoffPoint, filterOctaves * filterPointsPerOctave + 1> cutoffPoints;
+
+    //! \brief the functions of the normalised cutoff x, interpolated linearly
+    CutoffPoint getCutoffPoint(float x) const {
+        x = jlimit(filterMinCutoff, filterMaxCutoff, x);
+        uint32 bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        const int octave = static_cast<int>(bits >> 23) - 127 + filterOctaves + 1;
+        const float pos = static_cast<float>(bits & 0x7fffff) * (filterPointsPerOctave / 8388608.f);
+        const int j = static_cast<int>(pos);
+        const float t = pos - static_cast<float>(j);
+        const CutoffPoint& a = cutoffPoints[static_cast<size_t>(octave * filterPointsPerOctave + j)];
+        const CutoffPoint& b = cutoffPoints[static_cast<size_t>(octave * filterPointsPerOctave + j + 1)];
+        const CutoffPoint p = { a.sin2Pi + t * (b.sin2Pi - a.sin2Pi), a.cos2Pi + t * (b.cos2Pi - a.cos2Pi), a.tanPi + t * (b.tanPi - a.tanPi) };
+        return p;
+    }
+    ///@}
+
+private:
+    DspTables();
+
+    JUCE_DECLARE_NON_COPYABLE(DspTables)
+};
+
+#endif  // DSPTABLES_H_INCLUDED
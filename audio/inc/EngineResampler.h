@@ -0,0 +1,79 @@
+/*
+  ==============================================================================
+
+    EngineResampler.h
+    Created: 15 Oct 2026 5:03:21pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef ENGINERESAMPLER_H_INCLUDED
+#define ENGINERESAMPLER_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "Oversampler.h"
+
+//! EngineResampler: runs voices and effects at a fraction of a high host rate
+/*! The engine renders at the host rate divided by a power of two, 44.1 or 48 kHz for the common
+    high rates, and the output is interpolated back with the half-band stages of Interpolator.
+    A host block rarely is a multiple of the factor, so the engine renders the samples of the
+    block rounded up and the rest of the last engine sample waits in a short fifo for the next
+    block. The midi events move to the engine sample that sounds at their host position.
+*/
+class EngineResampler {
+public:
+    EngineResampler();
+
+    //! \brief the factor for a host rate, the largest one of 1, 2 and 4 that keeps the engine at 44.1 kHz or above
+    static int getFactor(double hostRate);
+
+    //! \brief allocates the buffers for host blocks of up to maxHostBlock samples, not on the audio thread
+    void prepare(int numChannels, int factor, int maxHostBlock);
+
+    //! \brief host rate / engine rate, 1 switches the resampler off
+    int getFactor() const { return factor; }
+
+    //! \brief the engine block of a host block, moves the midi events to engine positions
+    /*! \return the buffer the engine renders into, numHostSamples / factor samples rounded up
+        without the ones the fifo still holds; its content is undefined
+    */
+    AudioSampleBuffer& beginBlock(int numHostSamples, MidiBuffer& midiMessages);
+
+    //! \brief interpolates the engine block of beginBlock() into the host block
+    void endBlock(AudioSampleBuffer& hostBuffer);
+
+    //! \brief bytes of the engine blocks, the fifo and the filter state
+    int64 getMemoryBytes() const {
+        const int64 samples = static_cast<int64>(engine.getNumChannels()) * engine.getNumSamples()
+            + static_cast<int64>(upsampled.getNumChannels()) * upsampled.getNumSamples() + scratchSize
+            + static_cast<int64>(fifo.getNumChannels()) * fifo.getNumSamples();
+        return samples * static_cast<int64>(sizeof(float)) + static_cast<int64>(interpolators.capacity() * sizeof(Interpolator));
+    }
+
+    //! \brief latency at the host rate of the interpolation
+    int getLatency() const { return Interpolator::getLatency(factor); }
+
+    //! engine rates below this keep the host rate
+    constexpr static double minEngineRate = 44100.;
+
+private:
+    //! \brief makes room for an engine block of numSamples, allocates only for a host block above the one prepare() got
+    void reserve(int numSamples);
+
+    int factor;
+    int fifoSamples;            //!< host samples of the last block still to be played
+    AudioSampleBuffer engine;   //!< storage of the engine blocks
+    AudioSampleBuffer block;    //!< the engine block of beginBlock(), refers to engine
+    AudioSampleBuffer upsampled;//!< one engine block at the host rate
+    HeapBlock<float> scratch;   //!< the output of the first stage of 4x
+    int scratchSize;
+    AudioSampleBuffer fifo;     //!< the host samples the last block rendered ahead
+    std::vector<Interpolator> interpolators;   //!< per channel
+    MidiBuffer engineMidi;      //!< scratch of the moved events
+    MidiBuffer heldMidi;        //!< events of a block the fifo played alone, they go to the next engine block
+
+    JUCE_DECLARE_NON_COPYABLE(EngineResampler)
+};
+
+#endif  // ENGINERESAMPLER_H_INCLUDED
@@ -20,16 +20,20 @@
     corresponding Panel.
     The Envelope is currently controling the amplitude (Env Panel) or can be
     can be use to modulate the cutoff frequency of the lowpass filter
+    The shapes are rendered in segments: interpolateLog() is evaluated at the
+    ends of a segment only and the samples in between follow the line through
+    them, the segments are as long as the curvature of the shape allows for an
+    error below segmentTolerance.
 */
 
 class Envelope{
 public:
-    Envelope(SynthParams::EnvBase &_env, Param &_sustain, double _sampleRate)
-        : releaseCounter(-1)
-        , attackDecayCounter(0)
+    Envelope(const ParamSnapshot::Env &_env, double _sampleRate)
+        : env(_env)
         , sampleRate(_sampleRate)
-        , env(_env)
-        , sustain(_sustain)
+        , attackDecayCounter(0)
+        , releaseCounter(-1)
+        , segmentStage(eNoStage)
     {
     }
 
@@ -39,48 +43,67 @@ public:
     //! resets the sample counters and sets the current velocity for each new note
     void startEnvelope();
 
+    //! sets the sample rate the envelope times are converted with
+    void setSampleRate(double _sampleRate) { sampleRate = _sampleRate; }
+
     //! get and reset the release counters for the volume envelope
     int getReleaseCounter() const { return releaseCounter; }
     int getReleaseSamples() const { return releaseSamples; }
+    bool isReleasing() const { return releaseCounter > -1; }
     void resetReleaseCounter();
 
 
-    //! calculation of the volume envelope coefficients (with shape control)
-    void calcEnvCoeff(float modValue1, float modValue2, bool isUnipolar1, bool isUnipolar2);
+    //! \brief the stage lengths of a new note, modulated by the values of the two speed mod sources
+    /*! The intensities of the sources come with the snapshot of the block, so a chord pays for
+        them once. A stage length needs a scale per source rather than per stage and source, and
+        none for a source that is not set.
+    */
+    void calcEnvCoeff(float modValue1, float modValue2);
 
     float getNextEnvCoeff();
 
-    static float interpolateLog(int c, int t, float k, bool slow); //!< interpolates logarithmically from 1.0 to 0.0f in t samples (with shape control)
+    //! \brief the next n coefficients, the sustain and the end of the release are filled in one go
+    void render(float* out, int n);
 
-private:
-    inline int calcModRange(float modValue, float modAmount, int sInput, bool isUnipolar) {
+    //! \brief advances by n samples without rendering them, for an envelope nothing reads
+    void skip(int n);
 
-        float intensity;
-        if (isUnipolar) {
-            // if the source is unipolar, transform the intensity to bipolar
-            intensity = toBipolar(env.speedModAmount1.getMin(), env.speedModAmount1.getMax(), modAmount);
-        }
-        else {
-            // else the source is bipolar, transform the intensity to unipolar
-            intensity = toUnipolar(env.speedModAmount1.getMin(), env.speedModAmount1.getMax(), modAmount);
-        }
-        float dModValue = modValue*intensity;
+    //! \brief samples of the shortest stage the next n samples run through, 0 if they hold a level
+    int getShortestStage(int n) const;
 
-        int samples = static_cast<int>(sInput * std::pow(2.f, env.speedModAmount1.getMax() * dModValue));
-        int maxSamples = static_cast<int>(env.speedModAmount1.getMax() * sampleRate);
+    static float interpolateLog(int c, int t, float k, bool slow); //!< interpolates logarithmically from 1.0 to 0.0f in t samples (with shape control)
+
+    constexpr static float segmentTolerance = 1e-4f;   //!< max. deviation of the segments from interpolateLog()
+    static const int maxSegmentSamples = 64;            //!< the shape param is picked up at least this often
 
-        samples = samples > maxSamples
-            ? maxSamples
-            : samples;
-        samples = samples <= 0
-            ? 0
-            : samples;
+private:
+    //! stage the current segment belongs to
+    enum eStage {
+        eNoStage = 0,
+        eAttackStage,
+        eDecayStage,
+        eReleaseStage
+    };
+
+    //! \brief interpolateLog(c, t, shape) from the segment of the stage, shapes below 1 are the inverted slow curves
+    float nextShapeValue(eStage stage, int c, int t, float shape);
+
+    //! \brief samples per segment for which the line between two points of the shape stays within segmentTolerance
+    static int calcSegmentSamples(int t, float k);
+
+    //! \brief the length scale of a source value at an intensity of the snapshot
+    inline float calcModScale(float modValue, float intensity) const {
+        const float dModValue = modValue * intensity;
+        return dModValue == 0.f ? 1.f : FastMath::exp2(env.speedModMax * dModValue);
+    }
 
-        return samples;
+    //! \brief a stage length scaled and limited to the longest one
+    static inline int calcModRange(int sInput, float scale, int maxSamples) {
+        const int samples = static_cast<int>(sInput * scale);
+        return samples > maxSamples ? maxSamples : (samples <= 0 ? 0 : samples);
     }
     
-    SynthParams::EnvBase& env;   //!< local params
-    Param& sustain;         
+    const ParamSnapshot::Env& env;   //!< params of the current block
     double sampleRate;       //!< sample rate
     float valueAtRelease;   //!< amplitude value once release phase starts
     int attackDecayCounter; //!< sample counter during the attack and decay phase
@@ -88,46 +111,78 @@ private:
     int decaySamples;
     int releaseSamples;     //!< total Amount of release samples
     int releaseCounter;     //!< sample counter during the release phase
+
+    //! \name current segment
+    ///@{
+    eStage segmentStage;
+    float segmentShape;     //!< shape param and length of the stage the segment was started with
+    int segmentLength;
+    int segmentSamples;     //!< see calcSegmentSamples(), cached for the stage
+    int segmentEnd;         //!< counter at which the next segment starts
+    float segmentValue;     //!< value at the current counter
+    float segmentDelta;     //!< per sample
+    ///@}
 };
 
 
-inline void Envelope::calcEnvCoeff(float modValue1, float modValue2, bool isUnipolar1, bool isUnipolar2)
+inline void Envelope::calcEnvCoeff(float modValue1, float modValue2)
 {
-    // speed mod calculation
-    attackSamples = calcModRange(modValue1, env.speedModAmount1.get(), static_cast<int>(sampleRate * env.attack.get()), isUnipolar1);
-    attackSamples = calcModRange(modValue2, env.speedModAmount2.get(), attackSamples, isUnipolar2);
-    
-    decaySamples = calcModRange(modValue1, env.speedModAmount1.get(), static_cast<int>(sampleRate * env.decay.get()), isUnipolar1);
-    decaySamples = calcModRange(modValue2, env.speedModAmount1.get(), decaySamples, isUnipolar2);
-    
-    releaseSamples = calcModRange(modValue1, env.speedModAmount1.get(), static_cast<int>(sampleRate * env.release.get()), isUnipolar1);
-    releaseSamples = calcModRange(modValue2, env.speedModAmount1.get(), releaseSamples, isUnipolar2);
-    
+    const int maxSamples = static_cast<int>(env.speedModMax * sampleRate);
+    const float scale1 = calcModScale(modValue1, env.speedModIntensity1);
+    const float scale2 = calcModScale(modValue2, env.speedModIntensity2);
+    // decay and release scale the second source with the first amount, as they always did
+    const float scale21 = calcModScale(modValue2, env.speedModIntensity21);
+
+    attackSamples = calcModRange(calcModRange(static_cast<int>(sampleRate * env.attack), scale1, maxSamples), scale2, maxSamples);
+    decaySamples = calcModRange(calcModRange(static_cast<int>(sampleRate * env.decay), scale1, maxSamples), scale21, maxSamples);
+    releaseSamples = calcModRange(calcModRange(static_cast<int>(sampleRate * env.release), scale1, maxSamples), scale21, maxSamples);
 }
 
 
+inline float Envelope::nextShapeValue(eStage stage, int c, int t, float shape) {
+    // a new segment at its end or when the stage or its params change, the start is exact
+    if (c >= segmentEnd || stage != segmentStage || shape != segmentShape || t != segmentLength) {
+        const bool slow = shape < 1.0f;
+        const float k = slow ? 1 / shape : shape;
+        if (stage != segmentStage || shape != segmentShape || t != segmentLength) {
+            segmentStage = stage;
+            segmentShape = shape;
+            segmentLength = t;
+            segmentSamples = calcSegmentSamples(t, k);
+        }
+        segmentValue = interpolateLog(c, t, k, slow);
+        segmentEnd = c + segmentSamples;
+        if (c >= t) {
+            // the end value of the stage
+            segmentEnd = c + 1;
+            segmentDelta = 0.f;
+        } else if (segmentEnd < t) {
+            segmentDelta = (interpolateLog(segmentEnd, t, k, slow) - segmentValue) / static_cast<float>(segmentSamples);
+        } else {
+            // the last segment ends on the exact end value of the stage
+            segmentEnd = t;
+            segmentDelta = (interpolateLog(t, t, k, slow) - segmentValue) / static_cast<float>(t - c);
+        }
+    }
+
+    const float value = segmentValue;
+    segmentValue += segmentDelta;
+    return value;
+}
+
 inline float Envelope::getNextEnvCoeff() {
-    // get growth/shrink rate from knobs
-    float attackGrowthRate = env.attackShape.get();
-    float decayShrinkRate = env.decayShape.get();
-    float releaseShrinkRate = env.releaseShape.get();
-    
     // release phase sets envCoeff from valueAtRelease to 0.0f
     float envCoeff;
     if (releaseCounter > -1)
     {
-        if (releaseShrinkRate < 1.0f)
+        if (releaseCounter >= releaseSamples)
         {
-            releaseShrinkRate = 1 / releaseShrinkRate;
-            envCoeff = releaseCounter >= releaseSamples
-            ? 0.f
-            : valueAtRelease * (1 - interpolateLog(releaseCounter, releaseSamples, releaseShrinkRate, true));
+            envCoeff = 0.f;
         }
         else
         {
-            envCoeff = releaseCounter >= releaseSamples
-            ? 0.f
-            : valueAtRelease * interpolateLog(releaseCounter, releaseSamples, releaseShrinkRate, false);
+            const float shape = nextShapeValue(eReleaseStage, releaseCounter, releaseSamples, env.releaseShape);
+            envCoeff = valueAtRelease * (env.releaseShape < 1.0f ? 1 - shape : shape);
         }
         releaseCounter++;
     }
@@ -136,32 +191,20 @@ inline float Envelope::getNextEnvCoeff() {
         // attack phase sets envCoeff from 0.0f to 1.0f
         if (attackDecayCounter <= attackSamples)
         {
-            if (attackGrowthRate < 1.0f)
-            {
-                attackGrowthRate = 1 / attackGrowthRate;
-                envCoeff = interpolateLog(attackDecayCounter, attackSamples, attackGrowthRate, true);
-            }
-            else
-            {
-                envCoeff = 1.0f - interpolateLog(attackDecayCounter, attackSamples, attackGrowthRate, false);
-            }
+            const float shape = nextShapeValue(eAttackStage, attackDecayCounter, attackSamples, env.attackShape);
+            envCoeff = env.attackShape < 1.0f ? shape : 1.0f - shape;
             valueAtRelease = envCoeff;
             attackDecayCounter++;
         }
         else{
             
-            float sustainLevel = sustain.get();
+            float sustainLevel = env.sustain;
             // decay phase sets envCoeff from 1.0f to sustain level
             if (attackDecayCounter <= attackSamples + decaySamples){
-                if (decayShrinkRate < 1.0f)
-                {
-                    decayShrinkRate = 1 / decayShrinkRate;
-                    envCoeff = 1 - interpolateLog(attackDecayCounter - attackSamples, decaySamples, decayShrinkRate, true) * (1.0f - sustainLevel);
-                }
-                else
-                {
-                    envCoeff = interpolateLog(attackDecayCounter - attackSamples, decaySamples, decayShrinkRate, false) * (1.0f - sustainLevel) + sustainLevel;
-                }
+                const float shape = nextShapeValue(eDecayStage, attackDecayCounter - attackSamples, decaySamples, env.decayShape);
+                envCoeff = env.decayShape < 1.0f
+                    ? 1 - shape * (1.0f - sustainLevel)
+                    : shape * (1.0f - sustainLevel) + sustainLevel;
                 valueAtRelease = envCoeff;
                 attackDecayCounter++;
             }
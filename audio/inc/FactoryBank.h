@@ -0,0 +1,55 @@
+/*
+  ==============================================================================
+
+    FactoryBank.h
+    Created: 15 Oct 2026 5:17:44am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef FACTORYBANK_H_INCLUDED
+#define FACTORYBANK_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "BackgroundJobs.h"
+#include "PatchLoader.h"
+#include <atomic>
+#include <vector>
+
+//! FactoryBank: the patches of inst-patchfiles, embedded as binary data, as the programs of the plugin
+/*! The patches are parsed once on the high priority thread of BackgroundJobs into complete PatchValues:
+    a param a patch does not contain gets its default, so a program sounds the same whatever
+    was loaded before. Applying a program afterwards is a loop over the params, without file
+    access or XML parsing, so it fits at the start of a block.
+*/
+class FactoryBank : private TimeSliceClient {
+public:
+    explicit FactoryBank(SynthParams& p);
+    ~FactoryBank();
+
+    static int getNumPrograms();
+    static String getProgramName(int index);
+
+    //! \brief the values of a program, nullptr while the bank is not parsed yet, any thread
+    const PatchValues* getProgram(int index) const;
+
+    //! \brief parses the bank on the calling thread if the worker has not done it yet, not on the audio thread
+    void waitUntilParsed();
+
+private:
+    //! parses the bank once, the client stays registered but idle afterwards
+    int useTimeSlice() override;
+    void parse();
+
+    SynthParams& params;
+    SharedResourcePointer<BackgroundJobs> jobs;
+
+    CriticalSection parseLock;          //!< the worker and waitUntilParsed() must not both parse
+    std::vector<PatchValues> programs;  //!< written once before parsed is set
+    std::atomic<bool> parsed;
+
+    JUCE_DECLARE_NON_COPYABLE(FactoryBank)
+};
+
+#endif  // FACTORYBANK_H_INCLUDED
@@ -0,0 +1,200 @@
+/*
+  ==============================================================================
+
+    FastMath.h
+    Created: 14 Oct 2026 11:02:37pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef FASTMATH_H_INCLUDED
+#define FASTMATH_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <cmath>
+#include <cstring>
+
+//! accuracy of the FastMath approximations
+enum class eMathAccuracy : int {
+    eFast = 0,      //!< realtime tier: errors up to 1e-4, see the single functions
+    eAccurate = 1   //!< offline and param conversions: errors in the range of float rounding
+};
+
+//! FastMath: branch-free approximations of the transcendental functions of the render code
+/*! The functions are inline and free of calls and data dependent branches, so the loops
+    over blocks which use them can be vectorized (see the block version at the end), gcc
+    needs -fno-trapping-math for that. The error bounds below are measured over the given
+    input range against the double precision libm functions, eAccurate is about as close
+    as the float libm functions.
+*/
+struct FastMath {
+    //! \brief 2^x for x in [-126..126]
+    /*! eAccurate: relative error < 1e-7, eFast: relative error < 1.1e-4 */
+    template<eMathAccuracy _acc = eMathAccuracy::eAccurate>
+    static float exp2(float x) {
+        x = jlimit(-126.f, 126.f, x);
+        // x + 127 is positive, so the truncation is the floor
+        const int32 xi = static_cast<int32>(x + 127.f) - 127;
+        const float f = x - static_cast<float>(xi); // [0..1), rounding of x + 127 may give -1e-5
+
+        float p;
+        if (_acc == eMathAccuracy::eAccurate) {
+            // degree 6 fit of 2^f on [0..1)
+            p = 2.1877505e-4f;
+            p = p * f + 1.2387821e-3f;
+            p = p * f + 9.6845805e-3f;
+            p = p * f + 5.5480426e-2f;
+            p = p * f + 2.4023050e-1f;
+            p = p * f + 6.9314693e-1f;
+            p = p * f + 1.f;
+        } else {
+            // degree 3 fit of 2^f on [0..1)
+            p = 7.9085701e-2f;
+            p = p * f + 2.2451634e-1f;
+            p = p * f + 6.9639055e-1f;
+            p = p * f + 9.9989669e-1f;
+        }
+        return p * exponentToFloat(xi);
+    }
+
+    //! \brief log2(x) for finite x > 0
+    /*! eAccurate: absolute error < 6e-7 plus the rounding of the result, eFast: absolute error < 1e-4 */
+    template<eMathAccuracy _acc = eMathAccuracy::eAccurate>
+    static float log2(float x) {
+        uint32 bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        // mantissa in [1..2), moved to [sqrt(.5)..sqrt(2)) around 1 for a symmetric fit,
+        // done on the bits because a conditional float operation keeps the loops from vectorizing
+        const uint32 high = ((bits & 0x007fffffu) > 0x003504f3u) ? 1u : 0u;
+        const float e = static_cast<float>(static_cast<int32>(((bits >> 23) & 0xff) + high) - 127);
+        bits = ((bits & 0x007fffffu) | 0x3f800000u) - (high << 23);
+        float m;
+        std::memcpy(&m, &bits, sizeof(m));
+
+        // log2(m) = 2 / ln2 * atanh(z) with z = (m - 1) / (m + 1), |z| < .172
+        const float z = (m - 1.f) / (m + 1.f);
+        const float z2 = z * z;
+        float p;
+        if (_acc == eMathAccuracy::eAccurate) {
+            p = 2.f / 9.f;
+            p = p * z2 + 2.f / 7.f;
+            p = p * z2 + 2.f / 5.f;
+            p = p * z2 + 2.f / 3.f;
+            p = p * z2 + 2.f;
+        } else {
+            p = 2.f / 3.f;
+            p = p * z2 + 2.f;
+        }
+        return e + p * z * 1.44269504f;
+    }
+
+    //! \brief e^x, same error bounds as exp2()
+    template<eMathAccuracy _acc = eMathAccuracy::eAccurate>
+    static float exp(float x) { return exp2<_acc>(x * 1.44269504f); }
+
+    //! \brief base^x for base > 0, same error bounds as exp2() relative to the exponent x * log2(base)
+    template<eMathAccuracy _acc = eMathAccuracy::eAccurate>
+    static float pow(float base, float x) { return exp2<_acc>(x * log2<_acc>(base)); }
+
+    //! \brief 10^(db / 20) without the -96 dB cut of Param::fromDb(), eAccurate: relative error < 5e-7 in [-96..24]
+    template<eMathAccuracy _acc = eMathAccuracy::eAccurate>
+    static float dbToGain(float db) { return exp2<_acc>(db * .166096405f); }
+
+    //! \brief sin(2 pi x) for any x, i.e. x in periods
+    /*! eAccurate: absolute error < 2.5e-7, eFast: relative error < 1.3e-4 */
+    template<eMathAccuracy _acc = eMathAccuracy::eAccurate>
+    static float sin2Pi(float x) {
+        // reduce to [-.5..+.5] by rounding with the 1.5 * 2^23 trick (|x| < 2^22),
+        // then fold onto [-.25..+.25] where sin is odd and monotonic
+        x -= (x + 12582912.f) - 12582912.f;
+        const float mirrored = std::copysign(.5f, x) - x;
+        x = std::abs(x) > .25f ? mirrored : x;
+
+        const float x2 = x * x;
+        float p;
+        if (_acc == eMathAccuracy::eAccurate) {
+            // odd fit up to x^11
+            p = -1.4393413e1f;
+            p = p * x2 + 4.2009824e1f;
+            p = p * x2 - 7.6704293e1f;
+            p = p * x2 + 8.1605227e1f;
+            p = p * x2 - 4.1341702e1f;
+            p = p * x2 + 6.2831853f;
+        } else {
+            // odd fit up to x^5, fitted for the relative error, so small arguments stay accurate
+            p = 7.4729569e1f;
+            p = p * x2 - 4.1187690e1f;
+            p = p * x2 + 6.2828182f;
+        }
+        return p * x;
+    }
+
+    //! \brief cos(2 pi x) for any x
+    /*! Computed as 1 - 2 sin^2(pi x), so 1 - cos keeps the relative error of sin2Pi() near 0,
+        the poles of the filters at low cutoffs depend on it.
+        eAccurate: absolute error < 1e-6, 1 - cos as close as with the float libm cos,
+        eFast: absolute error < 5e-4, relative error of 1 - cos < 5e-4 above its float rounding
+    */
+    template<eMathAccuracy _acc = eMathAccuracy::eAccurate>
+    static float cos2Pi(float x) {
+        const float s = sin2Pi<_acc>(.5f * x);
+        return 1.f - 2.f * s * s;
+    }
+
+    //! \brief tan(pi x) for x in (-.5..+.5), i.e. the prewarping of a cutoff normalised to the sample rate
+    /*! eAccurate: relative error < 2e-6, eFast: relative error < 1.1e-3, both for |x| < .45 */
+    template<eMathAccuracy _acc = eMathAccuracy::eAccurate>
+    static float tanPi(float x) {
+        return sin2Pi<_acc>(.5f * x) / cos2Pi<_acc>(.5f * x);
+    }
+
+    //! \brief hyperbolic tangent
+    /*! eAccurate: absolute error < 2e-7, eFast: absolute error < 6e-5 */
+    template<eMathAccuracy _acc = eMathAccuracy::eAccurate>
+    static float tanh(float x) {
+        // tanh(x) = 1 - 2 / (e^2x + 1), the clamp keeps e^2x finite, tanh is 1 in float beyond it
+        const float c = jlimit(-9.f, 9.f, x);
+        const float e = exp2<_acc>(c * 2.88539008f);
+        return 1.f - 2.f / (e + 1.f);
+    }
+
+    //! \brief hyperbolic tangent as a rational function, absolute error < 1e-4
+    /*! Lambert's [7/6] continued fraction, clamped where the error is smallest. It needs no
+        float to int conversion, so it is cheaper than the eFast tanh() in the saturators
+        which call it several times per sample.
+    */
+    static float tanhRational(float x) {
+        const float c = jlimit(-4.785f, 4.785f, x);
+        const float c2 = c * c;
+        const float num = ((c2 + 378.f) * c2 + 17325.f) * c2 + 135135.f;
+        const float den = ((28.f * c2 + 3150.f) * c2 + 62370.f) * c2 + 135135.f;
+        return c * num / den;
+    }
+
+    //! \brief hyperbolic sine, eAccurate: relative error < 6e-7 for |x| > .5, absolute error < 2e-7 below
+    template<eMathAccuracy _acc = eMathAccuracy::eAccurate>
+    static float sinh(float x) {
+        const float e = exp<_acc>(x);
+        return .5f * (e - 1.f / e);
+    }
+
+    //! \brief out[i] = 2^(in[i] * scale) for a block, out may point to in
+    template<eMathAccuracy _acc = eMathAccuracy::eAccurate>
+    static void exp2(float *out, const float *in, float scale, int n) {
+        for (int i = 0; i < n; ++i) {
+            out[i] = exp2<_acc>(in[i] * scale);
+        }
+    }
+
+private:
+    //! 2^e for e in [-126..127] built from the exponent bits
+    static float exponentToFloat(int32 e) {
+        const uint32 bits = static_cast<uint32>(e + 127) << 23;
+        float result;
+        std::memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+};
+
+#endif  // FASTMATH_H_INCLUDED
@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+
+    FastRandom.h
+    Created: 14 Oct 2026 6:21:40pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef FASTRANDOM_H_INCLUDED
+#define FASTRANDOM_H_INCLUDED
+
+#include "JuceHeader.h"
+
+//! FastRandom Class: small xorshift32 generator for noise and sample & hold values
+/*! Every voice and lfo owns its own generator, so there is no shared state between
+    threads and no lock like in some rand() implementations. The state is a single
+    32 bit word, the generator is seeded explicitly so offline renders are repeatable.
+*/
+class FastRandom {
+public:
+    explicit FastRandom(uint32 seed = 1) {
+        setSeed(seed);
+    }
+
+    //! \brief restart the sequence, different seeds give uncorrelated sequences
+    void setSeed(uint32 seed) {
+        // scramble the seed (murmur3 finaliser), consecutive seeds would otherwise start out similar
+        seed ^= seed >> 16;
+        seed *= 0x85ebca6bu;
+        seed ^= seed >> 13;
+        seed *= 0xc2b2ae35u;
+        seed ^= seed >> 16;
+        state = seed != 0 ? seed : 0x9e3779b9u; // xorshift must not start at 0
+    }
+
+    uint32 getState() const { return state; }
+    void setState(uint32 s) { state = s != 0 ? s : 0x9e3779b9u; }
+
+    uint32 nextInt() {
+        state = step(state);
+        return state;
+    }
+
+    //! \brief uniform value in [-1..1)
+    float nextFloat() {
+        return toFloat(nextInt());
+    }
+
+    //! \brief fills n samples with uniform white noise in [-1..1)
+    void fill(float *out, int n) {
+        uint32 s = state;
+        for (int i = 0; i < n; ++i) {
+            s = step(s);
+            out[i] = toFloat(s);
+        }
+        state = s;
+    }
+
+    //! \name stateless helpers, also used by the lanes of the voice bank
+    ///@{
+    static uint32 step(uint32 s) {
+        s ^= s << 13;
+        s ^= s >> 17;
+        s ^= s << 5;
+        return s;
+    }
+
+    //! uses the upper 24 bits, which are exact in a float
+    static float toFloat(uint32 s) {
+        return static_cast<float>(static_cast<int32>(s >> 8)) * (2.f / 16777216.f) - 1.f;
+    }
+    ///@}
+
+private:
+    uint32 state;
+};
+
+#endif  // FASTRANDOM_H_INCLUDED
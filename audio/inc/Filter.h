@@ -2,12 +2,22 @@
 
 #include "JuceHeader.h"
 #include "SynthParams.h"
+#include "Oversampler.h"
+#include "DspTables.h"
+#include "Denormals.h"
+#include "Instrument.h"
 
 //! \brief multi-mode audio filter code
 class Filter {
 public:
-    Filter(SynthParams::Filter &f)
+    Filter(const ParamSnapshot::Filter &f)
         : filter(f)
+        , designType(eBiquadFilters::eLowpass)
+        , designTopology(eFilterTopology::eBiquad)
+        , coefficientsValid(false)
+        , rampPending(false)
+        , designInterval(coefficientInterval)
+        , ladderOversampled(false)
     {
     }
 
@@ -36,6 +46,58 @@ public:
         lpOut1Delay = 0.f;
         lpOut2Delay = 0.f;
         lpOut3Delay = 0.f;
+        ladderUpsampleDelay = 0.f;
+        ladderDecimator.reset();
+
+        // for the state variable filter
+        svfState1 = 0.f;
+        svfState2 = 0.f;
+
+        coefficientsValid = false;
+        rampPending = false;
+    }
+
+    //! \brief sets the decayed state variables to zero, i.e. during the release of a note
+    void flushState()
+    {
+        Denormals::flush(inputDelay1);
+        Denormals::flush(inputDelay2);
+        Denormals::flush(outputDelay1);
+        Denormals::flush(outputDelay2);
+        Denormals::flush(bandpassDelay1);
+        Denormals::flush(bandpassDelay2);
+        Denormals::flush(svfState1);
+        Denormals::flush(svfState2);
+        Denormals::flush(ladderOut);
+        Denormals::flush(ladderInDelay);
+        Denormals::flush(lpOut1);
+        Denormals::flush(lpOut2);
+        Denormals::flush(lpOut3);
+        Denormals::flush(lpOut1Delay);
+        Denormals::flush(lpOut2Delay);
+        Denormals::flush(lpOut3Delay);
+        Denormals::flush(ladderUpsampleDelay);
+    }
+
+    //! \brief number of denormal state variables, for the debug monitor of the processor
+    int countDenormalState() const
+    {
+        const float state[] = { inputDelay1, inputDelay2, outputDelay1, outputDelay2, bandpassDelay1, bandpassDelay2, svfState1, svfState2,
+                                ladderOut, ladderInDelay, lpOut1, lpOut2, lpOut3, lpOut1Delay, lpOut2Delay, lpOut3Delay, ladderUpsampleDelay };
+        return Denormals::count(state, static_cast<int>(sizeof(state) / sizeof(state[0])));
+    }
+
+    //! \brief change the sample rate without clearing the state, i.e. when the oversampling changes
+    void setSampleRate(float sRate)
+    {
+        sampleRate = sRate;
+    }
+
+    //! \brief samples per coefficient update of the block loops, coefficientInterval unless a voice renders with less detail
+    /** The locally oversampled ladder keeps coefficientInterval. */
+    void setCoefficientInterval(int samples)
+    {
+        designInterval = jlimit(static_cast<int>(coefficientInterval), static_cast<int>(maxCoefficientInterval), samples);
     }
 
     //! \brief apply the filter to a single sample
@@ -44,186 +106,638 @@ public:
      *  \return filtered audio sample
      */
     float run(float inputSignal, float lcModValue, float hcModValue, float resModValue) {
-        if (filter.passtype.getStep() == eBiquadFilters::eLadder) {
-            return ladderFilter(inputSignal, lcModValue, resModValue);
-        } else {
-            return biquadFilter(inputSignal, lcModValue, hcModValue, resModValue);
+        if (filter.topology == eFilterTopology::eSvf) {
+            return runTopology<eFilterTopology::eSvf>(inputSignal, lcModValue, hcModValue, resModValue);
         }
+        return runTopology<eFilterTopology::eBiquad>(inputSignal, lcModValue, hcModValue, resModValue);
     }
 
-protected:
-    float biquadFilter(float inputSignal, float lcModValue, float hcModValue, float resModValue) {
+    //! \brief apply the filter to a block of samples at the rate of the modulation in place, see below
+    void process(float *inOut, const float *lcMod, const float *hcMod, const float *resMod, int numSamples) {
+        process(inOut, numSamples, lcMod, hcMod, resMod, 0);
+    }
 
-        // get mod frequency from active filter type
+    //! \brief apply the filter to a block of samples in place
+    /** The filter type, the topology and the math accuracy are looked up once per block in a table of
+     *  kernels which are specialised for all of them, so the per-sample loop has no branches on them.
+     *  A modulation block is nullptr if no source is routed to it. Without any modulation the
+     *  coefficients are designed once for the whole block.
+     *  \param shift sample s uses the modulation values at s >> shift, i.e. for oversampled blocks
+     *  \param accuracy of the exp2, sin, cos and tanh approximations, see ParamSnapshot::mathAccuracy
+     */
+    void process(float *samples, int numSamples, const float *lcMod, const float *hcMod, const float *resMod, int shift,
+                 eMathAccuracy accuracy = eMathAccuracy::eAccurate) {
+        typedef void (Filter::*Kernel)(float*, int, const float*, const float*, const float*, int);
+        static const Kernel kernels[2][static_cast<int>(eFilterTopology::nSteps)][static_cast<int>(eBiquadFilters::nSteps)] = {
+            {
+                {
+                    &Filter::processKernel<eBiquadFilters::eLowpass, eMathAccuracy::eFast, eFilterTopology::eBiquad>,
+                    &Filter::processKernel<eBiquadFilters::eHighpass, eMathAccuracy::eFast, eFilterTopology::eBiquad>,
+                    &Filter::processKernel<eBiquadFilters::eBandpass, eMathAccuracy::eFast, eFilterTopology::eBiquad>,
+                    &Filter::processKernel<eBiquadFilters::eLadder, eMathAccuracy::eFast, eFilterTopology::eBiquad>
+                },
+                {
+                    &Filter::processKernel<eBiquadFilters::eLowpass, eMathAccuracy::eFast, eFilterTopology::eSvf>,
+                    &Filter::processKernel<eBiquadFilters::eHighpass, eMathAccuracy::eFast, eFilterTopology::eSvf>,
+                    &Filter::processKernel<eBiquadFilters::eBandpass, eMathAccuracy::eFast, eFilterTopology::eSvf>,
+                    &Filter::processKernel<eBiquadFilters::eLadder, eMathAccuracy::eFast, eFilterTopology::eSvf>
+                }
+            },
+            {
+                {
+                    &Filter::processKernel<eBiquadFilters::eLowpass, eMathAccuracy::eAccurate, eFilterTopology::eBiquad>,
+                    &Filter::processKernel<eBiquadFilters::eHighpass, eMathAccuracy::eAccurate, eFilterTopology::eBiquad>,
+                    &Filter::processKernel<eBiquadFilters::eBandpass, eMathAccuracy::eAccurate, eFilterTopology::eBiquad>,
+                    &Filter::processKernel<eBiquadFilters::eLadder, eMathAccuracy::eAccurate, eFilterTopology::eBiquad>
+                },
+                {
+                    &Filter::processKernel<eBiquadFilters::eLowpass, eMathAccuracy::eAccurate, eFilterTopology::eSvf>,
+                    &Filter::processKernel<eBiquadFilters::eHighpass, eMathAccuracy::eAccurate, eFilterTopology::eSvf>,
+                    &Filter::processKernel<eBiquadFilters::eBandpass, eMathAccuracy::eAccurate, eFilterTopology::eSvf>,
+                    &Filter::processKernel<eBiquadFilters::eLadder, eMathAccuracy::eAccurate, eFilterTopology::eSvf>
+                }
+            }
+        };
+        (this->*kernels[static_cast<int>(accuracy)][static_cast<int>(filter.topology)][static_cast<int>(filter.passtype)])(samples, numSamples, lcMod, hcMod, resMod, shift);
+    }
+
+    //! coefficients of the direct form, normalised to a0 = 1
+    struct BiquadCoefficients {
+        float b0, b1, b2, a1, a2;
+    };
+
+    //! coefficients of the state variable filter
+    struct SvfCoefficients {
+        float g;    //!< tan(pi * cutoff / sampleRate), the prewarped integrator gain
+        float k;    //!< damping, 1 / Q
+    };
+
+    //! one pole gain and feedback of the ladder
+    struct LadderCoefficients {
+        float b;            //!< g / (1 + g), the pole coefficient is 1 - 2b
+        float resonance;    //!< feedback gain
+    };
+
+    //! state of the biquad or the ladder, moved in and out of the lanes of a FilterBank
+    struct LaneState {
+        bool valid;     //!< the coefficients belong to the passtype of the block and can be ramped from
+        BiquadCoefficients coefficients;
+        float designCutoff, designResonance, designBandRatio;
+        float inputDelay1, inputDelay2, outputDelay1, outputDelay2;
+        LadderCoefficients ladder;
+        float ladderOut, ladderInDelay, lpOut1, lpOut2, lpOut3, lpOut1Delay, lpOut2Delay, lpOut3Delay;
+    };
+
+    //! \brief state of the biquad topology or the ladder without local oversampling for the given passtype
+    void getLaneState(eBiquadFilters type, LaneState& st) const {
+        st.valid = coefficientsValid && designType == type
+            && (type == eBiquadFilters::eLadder ? !ladderOversampled : designTopology == eFilterTopology::eBiquad);
+        st.coefficients = coefficients;
+        st.designCutoff = designCutoff;
+        st.designResonance = designResonance;
+        st.designBandRatio = designBandRatio;
+        st.inputDelay1 = inputDelay1;
+        st.inputDelay2 = inputDelay2;
+        st.outputDelay1 = outputDelay1;
+        st.outputDelay2 = outputDelay2;
+        st.ladder = ladder;
+        st.ladderOut = ladderOut;
+        st.ladderInDelay = ladderInDelay;
+        st.lpOut1 = lpOut1;
+        st.lpOut2 = lpOut2;
+        st.lpOut3 = lpOut3;
+        st.lpOut1Delay = lpOut1Delay;
+        st.lpOut2Delay = lpOut2Delay;
+        st.lpOut3Delay = lpOut3Delay;
+    }
+
+    //! \brief take back the state after a block in a FilterBank, the coefficients count as designed for it
+    void setLaneState(eBiquadFilters type, const LaneState& st) {
+        coefficientsValid = st.valid;
+        rampPending = false;
+        designType = type;
+        designTopology = eFilterTopology::eBiquad;
+        coefficients = st.coefficients;
+        targetCoefficients = st.coefficients;
+        designCutoff = st.designCutoff;
+        designResonance = st.designResonance;
+        designBandRatio = st.designBandRatio;
+        inputDelay1 = st.inputDelay1;
+        inputDelay2 = st.inputDelay2;
+        outputDelay1 = st.outputDelay1;
+        outputDelay2 = st.outputDelay2;
+        lastSample = st.inputDelay1;
+        ladder = st.ladder;
+        ladderOut = st.ladderOut;
+        ladderInDelay = st.ladderInDelay;
+        lpOut1 = st.lpOut1;
+        lpOut2 = st.lpOut2;
+        lpOut3 = st.lpOut3;
+        lpOut1Delay = st.lpOut1Delay;
+        lpOut2Delay = st.lpOut2Delay;
+        lpOut3Delay = st.lpOut3Delay;
+    }
+
+    //! \brief modulated cutoff in Hz, limited to the range of the params
+    /*! \param bandRatio upper to lower cutoff of the bandpass, 1 for the other types */
+    template<eBiquadFilters _type, eMathAccuracy _acc>
+    static float modulatedCutoff(const ParamSnapshot::Filter& p, float lcModValue, float hcModValue, float& bandRatio) {
         float cutoffFreq = 0.f;
-        float lpFreq = 0.f;
-        float hpFreq = 0.f;
+        bandRatio = 1.f;
 
-        switch (filter.passtype.getStep()) {
+        switch (_type) {
         case eBiquadFilters::eLowpass:
-            cutoffFreq = filter.lpCutoff.get();
-            cutoffFreq = Param::bipolarToFreq(lcModValue, cutoffFreq, filter.lpModAmount1.getMax());
+            cutoffFreq = Param::bipolarToFreq<_acc>(lcModValue, p.lpCutoff, p.lpModRange);
             break;
         case eBiquadFilters::eHighpass:
-            cutoffFreq = filter.hpCutoff.get();
-            cutoffFreq = Param::bipolarToFreq(hcModValue, cutoffFreq, filter.hpModAmount1.getMax());
+            cutoffFreq = Param::bipolarToFreq<_acc>(hcModValue, p.hpCutoff, p.hpModRange);
             break;
         case eBiquadFilters::eBandpass:
-            lpFreq = Param::bipolarToFreq(lcModValue, filter.lpCutoff.get(), filter.lpModAmount1.getMax());
-            hpFreq = Param::bipolarToFreq(hcModValue, filter.hpCutoff.get(), filter.hpModAmount1.getMax());
+        {
+            float lpFreq = Param::bipolarToFreq<_acc>(lcModValue, p.lpCutoff, p.lpModRange);
+            const float hpFreq = Param::bipolarToFreq<_acc>(hcModValue, p.hpCutoff, p.hpModRange);
 
             cutoffFreq = sqrt(lpFreq * hpFreq);
             if (lpFreq < hpFreq)
                 lpFreq = hpFreq;
+            bandRatio = lpFreq / hpFreq;
+        }
+            break;
+        default:
             break;
-
-        default: // should never happen if everybody uses it correctly! but in case it does, don't crash but return no sound instead
-            return 0.f;
         }
 
-        // check range
-        if (cutoffFreq < filter.lpCutoff.getMin()) { // assuming that min/max are identical for low and high pass filters
-            cutoffFreq = filter.lpCutoff.getMin();
-        }
-        else if (cutoffFreq > filter.lpCutoff.getMax()) {
-            cutoffFreq = filter.lpCutoff.getMax();
+        // assuming that min/max are identical for low and high pass filters
+        return jlimit(p.cutoffMin, p.cutoffMax, cutoffFreq);
+    }
+
+    //! \brief sin(2 pi x), cos(2 pi x) and tan(pi x) of the normalised cutoff x
+    /*! The realtime tier reads them from the table of DspTables, the cutoff of a modulated
+        filter moves every few samples and the table is shared by all voices and instances.
+        The offline tier computes them.
+    */
+    template<eMathAccuracy _acc>
+    static DspTables::CutoffPoint cutoffFunctions(float x) {
+        if (_acc == eMathAccuracy::eFast) {
+            return DspTables::get().getCutoffPoint(x);
         }
+        const DspTables::CutoffPoint p = { FastMath::sin2Pi<_acc>(x), FastMath::cos2Pi<_acc>(x), FastMath::tanPi<_acc>(x) };
+        return p;
+    }
 
-        float currentResonance = pow(10.f, (-(filter.resonance.get() + resModValue * filter.resModAmount1.getMax()) * 2.5f) / 20.f); 
-        
-        cutoffFreq /= sampleRate;
+    //! \brief direct form coefficients for lowpass, highpass or bandpass
+    /*! \param cutoffFreq cutoff normalised to the sample rate
+     *  \param resonanceDb modulated resonance
+     *  \param bandRatio see modulatedCutoff()
+    */
+    template<eBiquadFilters _type, eMathAccuracy _acc>
+    static void designBiquad(float cutoffFreq, float resonanceDb, float bandRatio, BiquadCoefficients& c) {
+        const float currentResonance = FastMath::dbToGain<_acc>(-resonanceDb * 2.5f);
 
         // LP and HP: Filter Design: Biquad (2 delays) Source: http://www.musicdsp.org/showArchiveComment.php?ArchiveID=259
         // BP: based on http://www.musicdsp.org/files/Audio-EQ-Cookbook.txt, except for bw calculation
-        float k, coeff1, coeff2, coeff3, b0 = 0.0f, b1 = 0.0f, b2 = 0.0f, a0 = 0.0f, a1 = 0.0f, a2 = 0.0f, bw, w0;
+        float k, coeff1, coeff2, coeff3, bw, w0;
 
-
-        if (static_cast<eBiquadFilters>(filter.passtype.getStep()) == eBiquadFilters::eLowpass) {
+        if (_type == eBiquadFilters::eLowpass) {
 
             // coefficients for lowpass, depending on resonance and lowcut frequency
-            k = 0.5f * currentResonance * sin(2.f * float_Pi * cutoffFreq);
+            const DspTables::CutoffPoint f = cutoffFunctions<_acc>(cutoffFreq);
+            k = 0.5f * currentResonance * f.sin2Pi;
             coeff1 = 0.5f * (1.f - k) / (1.f + k);
-            coeff2 = (0.5f + coeff1) * cos(2.f * float_Pi * cutoffFreq);
+            coeff2 = (0.5f + coeff1) * f.cos2Pi;
             coeff3 = (0.5f + coeff1 - coeff2) * 0.25f;
 
-            b0 = 2.f * coeff3;
-            b1 = 2.f * 2.f * coeff3;
-            b2 = 2.f * coeff3;
-            a1 = 2.f * -coeff2;
-            a2 = 2.f * coeff1;
+            c.b0 = 2.f * coeff3;
+            c.b1 = 2.f * 2.f * coeff3;
+            c.b2 = 2.f * coeff3;
+            c.a1 = 2.f * -coeff2;
+            c.a2 = 2.f * coeff1;
 
         }
-        else if (filter.passtype.getStep() == eBiquadFilters::eHighpass) {
+        else if (_type == eBiquadFilters::eHighpass) {
 
             // coefficients for highpass, depending on resonance and highcut frequency
-            k = 0.5f * currentResonance * sin(2.f * float_Pi * cutoffFreq);
+            const DspTables::CutoffPoint f = cutoffFunctions<_acc>(cutoffFreq);
+            k = 0.5f * currentResonance * f.sin2Pi;
             coeff1 = 0.5f * (1.f - k) / (1.f + k);
-            coeff2 = (0.5f + coeff1) * cos(2.f * float_Pi * cutoffFreq);
+            coeff2 = (0.5f + coeff1) * f.cos2Pi;
             coeff3 = (0.5f + coeff1 + coeff2) * 0.25f;
 
-            b0 = 2.f * coeff3;
-            b1 = -4.f * coeff3;
-            b2 = 2.f * coeff3;
-            a1 = -2.f * coeff2;
-            a2 = 2.f * coeff1;
+            c.b0 = 2.f * coeff3;
+            c.b1 = -4.f * coeff3;
+            c.b2 = 2.f * coeff3;
+            c.a1 = -2.f * coeff2;
+            c.a2 = 2.f * coeff1;
 
         }
-        else if (filter.passtype.getStep() == eBiquadFilters::eBandpass) {
+        else if (_type == eBiquadFilters::eBandpass) {
 
             // coefficients for bandpass, depending on low- and highcut frequency
             w0 = 2.f * float_Pi * cutoffFreq;
-            bw = (log2(lpFreq / hpFreq)); // bandwidth in octaves
-            coeff1 = sin(w0) * sinh(log(2.f) / 2.f * bw * w0 / sin(w0)); // intermediate value for coefficient calc
-
-            b0 = coeff1;
-            b1 = 0.f;
-            b2 = -coeff1;
-            a0 = 1.f + coeff1;
-            a1 = -2.f * cos(w0);
-            a2 = 1.f - coeff1;
-        }
-
-        lastSample = inputSignal;
-
-        // different biquad form for bandpass filter, it has more coefficients as well
-        if (filter.passtype.getStep() == eBiquadFilters::eBandpass) {
-            inputSignal = (b0 / a0)* inputSignal + (b1 / a0)*inputDelay1 + (b2 / a0)*inputDelay2 - (a1 / a0)*outputDelay1 - (a2 / a0)*outputDelay2;
+            const DspTables::CutoffPoint f = cutoffFunctions<_acc>(cutoffFreq);
+            const float sinW0 = f.sin2Pi;
+            bw = FastMath::log2<_acc>(bandRatio); // bandwidth in octaves
+            coeff1 = sinW0 * FastMath::sinh<_acc>(log(2.f) / 2.f * bw * w0 / sinW0); // intermediate value for coefficient calc
+
+            // the bandpass has an a0, normalise once here instead of per sample
+            const float a0 = 1.f + coeff1;
+            c.b0 = coeff1 / a0;
+            c.b1 = 0.f;
+            c.b2 = -coeff1 / a0;
+            c.a1 = -2.f * f.cos2Pi / a0;
+            c.a2 = (1.f - coeff1) / a0;
         }
         else {
-            inputSignal = b0*inputSignal + b1*inputDelay1 + b2*inputDelay2 - a1*outputDelay1 - a2*outputDelay2;
+            c = BiquadCoefficients();
         }
+    }
 
-        //delaying samples
-        inputDelay2 = inputDelay1;
-        inputDelay1 = lastSample;
-        outputDelay2 = outputDelay1;
-        outputDelay1 = inputSignal;
-
-        if (inputSignal > 1.f) {
-            inputSignal = 1.f;
-        }
-        else if (inputSignal < -1.f) {
-            inputSignal = -1.f;
+    //! \brief state variable filter coefficients with the same Q as the biquad, arguments as for designBiquad()
+    template<eBiquadFilters _type, eMathAccuracy _acc>
+    static void designSvf(float cutoffFreq, float resonanceDb, float bandRatio, SvfCoefficients& c) {
+        // 1 / currentResonance for low and high pass, the octave bandwidth for the bandpass
+        c.g = cutoffFunctions<_acc>(cutoffFreq).tanPi;
+        float k;
+        if (_type == eBiquadFilters::eBandpass) {
+            // 2 sinh(ln(ratio) / 2) of the bandwidth is sqrt(ratio) - 1 / sqrt(ratio)
+            const float sqrtRatio = std::sqrt(bandRatio);
+            k = sqrtRatio - 1.f / sqrtRatio;
+        } else {
+            k = FastMath::dbToGain<_acc>(-resonanceDb * 2.5f);
         }
-        return inputSignal;
+        c.k = jmax(k, svfMinDamping);
     }
 
-    //apply ladder filter to the current Sample in renderNextBlock() - Zavalishin approach
-    //naive 1 pole filters wigh a hyperbolic tangent saturator
-    float ladderFilter(float ladderIn, float lcModValue, float resModValue)
+    //! \brief ladder coefficients for the modulation at the given rate of the ladder
+    template<eMathAccuracy _acc>
+    static void designLadder(const ParamSnapshot::Filter& p, float lcModValue, float resModValue, float rate, LadderCoefficients& c)
     {
-        float cutoffFreq = filter.lpCutoff.get(); 
-        float currentResonance = filter.resonance.get() + resModValue * filter.resModAmount1.getMax();
+        c.resonance = jlimit(p.resonanceMin, p.resonanceMax, p.resonance + resModValue * p.resModRange);
 
-        //Check for  Resonance Clipping
-        if (currentResonance < filter.resonance.getMin())
-        {
-            currentResonance = filter.resonance.getMin();
-        }
-        else if (currentResonance > filter.resonance.getMax())
-        {
-            currentResonance = filter.resonance.getMax();
-        }
-
-        cutoffFreq = Param::bipolarToFreq(lcModValue, cutoffFreq, 8.f);
+        const float cutoffFreq = jlimit(p.cutoffMin, p.cutoffMax, Param::bipolarToFreq<_acc>(lcModValue, p.lpCutoff, 8.f));
+        const float g = float_Pi * cutoffFreq / rate;
+        c.b = g / (1.f + g);
+    }
 
-        // TODO can't this be shortened?
-        if (cutoffFreq < filter.lpCutoff.getMin()) { // assuming that min/max are identical for low and high pass filters
-            cutoffFreq = filter.lpCutoff.getMin();
-        }
-        else if (cutoffFreq > filter.lpCutoff.getMax()) {
-            cutoffFreq = filter.lpCutoff.getMax();
-        }
+    //! \brief saturator of the ladder, the rational approximation is the cheapest for the realtime tier
+    template<eMathAccuracy _acc>
+    static float ladderSaturate(float x) {
+        return _acc == eMathAccuracy::eFast ? FastMath::tanhRational(x) : FastMath::tanh<_acc>(x);
+    }
 
-        //coeffecients and parameters
-        float omega_c = 2.f * float_Pi * cutoffFreq / sampleRate;
-        float g = omega_c / 2.f;
-        float a = (1.f - g) / (1.f + g);
-        float b = g / (1.f + g);
+    //! \brief one sample of the ladder - Zavalishin approach
+    //! naive 1 pole filters with a hyperbolic tangent saturator, the state is passed in so a FilterBank can keep it per lane
+    template<eMathAccuracy _acc>
+    static float ladderStep(float ladderIn, const LadderCoefficients& c, float& ladderOut, float& ladderInDelay,
+                            float& lpOut1, float& lpOut2, float& lpOut3, float& lpOut1Delay, float& lpOut2Delay, float& lpOut3Delay)
+    {
+        const float b = c.b;
+        const float a = 1.f - 2.f * b; // (1 - g) / (1 + g)
 
         // subtract the feedback
         // inverse hyperbolic Sinus
         // ladderIn = tanh(ladderIn) - asinh(currentResonance * ladderOut);
         // hyperbolic tangent
-        ladderIn = tanh(ladderIn) - tanh(currentResonance * ladderOut);
+        ladderIn = ladderSaturate<_acc>(ladderIn) - ladderSaturate<_acc>(c.resonance * ladderOut);
 
         // proecess through 1 pole Filters 4 times
-        lpOut1 = b*(ladderIn + ladderInDelay) + a*tanh(lpOut1);
+        lpOut1 = b*(ladderIn + ladderInDelay) + a*ladderSaturate<_acc>(lpOut1);
         ladderInDelay = ladderIn;
 
-        lpOut2 = b*(lpOut1 + lpOut1Delay) + a* tanh(lpOut2);
+        lpOut2 = b*(lpOut1 + lpOut1Delay) + a*ladderSaturate<_acc>(lpOut2);
         lpOut1Delay = lpOut1;
 
-        lpOut3 = b*(lpOut2 + lpOut2Delay) + a* tanh(lpOut3);
+        lpOut3 = b*(lpOut2 + lpOut2Delay) + a*ladderSaturate<_acc>(lpOut3);
         lpOut2Delay = lpOut2;
 
-        ladderOut = b*(lpOut3 + lpOut3Delay) + a* tanh(ladderOut);
+        ladderOut = b*(lpOut3 + lpOut3Delay) + a*ladderSaturate<_acc>(ladderOut);
         lpOut3Delay = lpOut3;
 
         return ladderOut;
     }
 
-    SynthParams::Filter &filter;
+    static const int coefficientInterval = 16;      //!< samples per coefficient update at the rate of the filter
+    static const int maxCoefficientInterval = 128;  //!< longest interval setCoefficientInterval() takes
+    constexpr static float svfMinDamping = 1e-3f;   //!< keeps the svf from ringing forever at zero bandwidth or high resonance
+
+protected:
+
+    //! \brief one counter for all the kernels, a local static of a template would count per instantiation
+    static void countDesign() {
+        SYNISTER_COUNT_FINE("filter designs", 1);
+    }
+
+    //! sample m of a modulation block, 0 without a routed source
+    static float modValue(const float *mod, int m) {
+        return mod != nullptr ? mod[m] : 0.f;
+    }
+
+    template<eBiquadFilters _type, eMathAccuracy _acc, eFilterTopology _topo>
+    void processKernel(float *samples, int numSamples, const float *lcMod, const float *hcMod, const float *resMod, int shift) {
+        if (_type == eBiquadFilters::eLadder) {
+            processLadder<_acc>(samples, numSamples, lcMod, resMod, shift);
+            return;
+        }
+        if (_topo == eFilterTopology::eSvf) {
+            processSvf<_type, _acc>(samples, numSamples, lcMod, hcMod, resMod, shift);
+            return;
+        }
+
+        // the coefficients follow the modulation at control rate and are ramped linearly in between
+        const bool modulated = lcMod != nullptr || hcMod != nullptr || resMod != nullptr;
+        for (int s = 0; s < numSamples; s += designInterval) {
+            // without modulation the first segment has reached the design, the rest of the block keeps it
+            if (!modulated && s > 0) {
+                for (int i = s; i < numSamples; ++i) {
+                    samples[i] = biquadSample(samples[i]);
+                }
+                break;
+            }
+            const int n = jmin(designInterval, numSamples - s);
+            const int m = (s + n - 1) >> shift; // modulation at the end of the segment
+            updateCoefficients<_type, _acc, eFilterTopology::eBiquad>(modValue(lcMod, m), modValue(hcMod, m), modValue(resMod, m));
+
+            // no ramp from the state of the last note
+            if (!coefficientsValid) {
+                coefficients = targetCoefficients;
+                coefficientsValid = true;
+                rampPending = false;
+            }
+
+            if (rampPending) {
+                const float inv = 1.f / static_cast<float>(n);
+                const BiquadCoefficients delta = {
+                    (targetCoefficients.b0 - coefficients.b0) * inv,
+                    (targetCoefficients.b1 - coefficients.b1) * inv,
+                    (targetCoefficients.b2 - coefficients.b2) * inv,
+                    (targetCoefficients.a1 - coefficients.a1) * inv,
+                    (targetCoefficients.a2 - coefficients.a2) * inv
+                };
+                for (int i = s; i < s + n; ++i) {
+                    coefficients.b0 += delta.b0;
+                    coefficients.b1 += delta.b1;
+                    coefficients.b2 += delta.b2;
+                    coefficients.a1 += delta.a1;
+                    coefficients.a2 += delta.a2;
+                    samples[i] = biquadSample(samples[i]);
+                }
+                coefficients = targetCoefficients;
+                rampPending = false;
+            } else {
+                for (int i = s; i < s + n; ++i) {
+                    samples[i] = biquadSample(samples[i]);
+                }
+            }
+        }
+    }
+
+    //! \brief SVF version of the block loop, the integrator gain and the damping are ramped
+    template<eBiquadFilters _type, eMathAccuracy _acc>
+    void processSvf(float *samples, int numSamples, const float *lcMod, const float *hcMod, const float *resMod, int shift) {
+        const bool modulated = lcMod != nullptr || hcMod != nullptr || resMod != nullptr;
+        for (int s = 0; s < numSamples; s += designInterval) {
+            if (!modulated && s > 0) {
+                for (int i = s; i < numSamples; ++i) {
+                    samples[i] = svfSample<_type>(samples[i]);
+                }
+                break;
+            }
+            const int n = jmin(designInterval, numSamples - s);
+            const int m = (s + n - 1) >> shift;
+            updateCoefficients<_type, _acc, eFilterTopology::eSvf>(modValue(lcMod, m), modValue(hcMod, m), modValue(resMod, m));
+
+            if (!coefficientsValid) {
+                svfCoefficients = targetSvfCoefficients;
+                coefficientsValid = true;
+                rampPending = false;
+            }
+
+            if (rampPending) {
+                const float inv = 1.f / static_cast<float>(n);
+                const float dg = (targetSvfCoefficients.g - svfCoefficients.g) * inv;
+                const float dk = (targetSvfCoefficients.k - svfCoefficients.k) * inv;
+                for (int i = s; i < s + n; ++i) {
+                    svfCoefficients.g += dg;
+                    svfCoefficients.k += dk;
+                    samples[i] = svfSample<_type>(samples[i]);
+                }
+                svfCoefficients = targetSvfCoefficients;
+                rampPending = false;
+            } else {
+                for (int i = s; i < s + n; ++i) {
+                    samples[i] = svfSample<_type>(samples[i]);
+                }
+            }
+        }
+    }
+
+    //! \brief ladder version of the block loop, the one pole gain and the resonance are ramped
+    /*! With the local oversampling every sample is split into the linear interpolation to the
+        last one and itself, the ladder runs at twice the rate and the half-band decimator of
+        the oversampler brings the result back. That removes the aliasing of the saturators but
+        delays the filter by HalfbandDecimator::getLatency() samples, which is not compensated.
+    */
+    template<eMathAccuracy _acc>
+    void processLadder(float *samples, int numSamples, const float *lcMod, const float *resMod, int shift) {
+        const bool oversampled = filter.ladderOversampling;
+        const float rate = oversampled ? 2.f * sampleRate : sampleRate;
+
+        // without modulation the design of the first segment holds for the block
+        const bool modulated = lcMod != nullptr || resMod != nullptr;
+        // the local oversampling renders a segment on the stack
+        const int interval = oversampled ? static_cast<int>(coefficientInterval) : designInterval;
+        LadderCoefficients target;
+        for (int s = 0; s < numSamples; s += interval) {
+            const int n = jmin(interval, numSamples - s);
+            const int m = (s + n - 1) >> shift;
+            if (modulated || s == 0) {
+                countDesign();
+                designLadder<_acc>(filter, modValue(lcMod, m), modValue(resMod, m), rate, target);
+            }
+
+            // no ramp from another type or from the other rate
+            if (!coefficientsValid || designType != eBiquadFilters::eLadder || ladderOversampled != oversampled) {
+                if (ladderOversampled != oversampled) {
+                    ladderDecimator.reset();
+                    ladderOversampled = oversampled;
+                }
+                ladder = target;
+                designType = eBiquadFilters::eLadder;
+                coefficientsValid = true;
+            }
+
+            const float inv = 1.f / static_cast<float>(n);
+            const float db = (target.b - ladder.b) * inv;
+            const float dr = (target.resonance - ladder.resonance) * inv;
+            if (oversampled) {
+                float upsampled[2 * coefficientInterval];
+                for (int i = 0; i < n; ++i) {
+                    ladder.b += db;
+                    ladder.resonance += dr;
+                    const float x = samples[s + i];
+                    upsampled[2 * i] = ladderSample<_acc>(.5f * (ladderUpsampleDelay + x));
+                    upsampled[2 * i + 1] = ladderSample<_acc>(x);
+                    ladderUpsampleDelay = x;
+                }
+                ladderDecimator.process(upsampled, samples + s, n);
+            } else {
+                for (int i = s; i < s + n; ++i) {
+                    ladder.b += db;
+                    ladder.resonance += dr;
+                    samples[i] = ladderSample<_acc>(samples[i]);
+                }
+            }
+            ladder = target;
+        }
+    }
+
+    template<eFilterTopology _topo>
+    float runTopology(float inputSignal, float lcModValue, float hcModValue, float resModValue) {
+        const eMathAccuracy acc = eMathAccuracy::eAccurate;
+        switch (filter.passtype) {
+            case eBiquadFilters::eLowpass: return runType<eBiquadFilters::eLowpass, acc, _topo>(inputSignal, lcModValue, hcModValue, resModValue);
+            case eBiquadFilters::eHighpass: return runType<eBiquadFilters::eHighpass, acc, _topo>(inputSignal, lcModValue, hcModValue, resModValue);
+            case eBiquadFilters::eBandpass: return runType<eBiquadFilters::eBandpass, acc, _topo>(inputSignal, lcModValue, hcModValue, resModValue);
+            case eBiquadFilters::eLadder: return runType<eBiquadFilters::eLadder, acc, _topo>(inputSignal, lcModValue, hcModValue, resModValue);
+            default: return 0.f;
+        }
+    }
+
+    template<eBiquadFilters _type, eMathAccuracy _acc, eFilterTopology _topo>
+    float runType(float inputSignal, float lcModValue, float hcModValue, float resModValue) {
+        if (_type == eBiquadFilters::eLadder) {
+            return ladderFilter<_acc>(inputSignal, lcModValue, resModValue);
+        } else {
+            return biquadFilter<_type, _acc, _topo>(inputSignal, lcModValue, hcModValue, resModValue);
+        }
+    }
+
+    //! \brief single sample without the ramp, the coefficients jump to the modulation of this sample
+    template<eBiquadFilters _type, eMathAccuracy _acc, eFilterTopology _topo>
+    float biquadFilter(float inputSignal, float lcModValue, float hcModValue, float resModValue) {
+        updateCoefficients<_type, _acc, _topo>(lcModValue, hcModValue, resModValue);
+        coefficientsValid = true;
+        rampPending = false;
+        if (_topo == eFilterTopology::eSvf) {
+            svfCoefficients = targetSvfCoefficients;
+            return svfSample<_type>(inputSignal);
+        }
+        coefficients = targetCoefficients;
+        return biquadSample(inputSignal);
+    }
+
+    //! \brief computes the target coefficients for the modulation if cutoff, resonance or bandwidth moved noticeably
+    /*! Cutoff, resonance and bandwidth are compared to the values the target was designed for, the
+        trigonometric and hyperbolic functions only run if one of them moved past its threshold.
+        All checks of the filter type and topology are on the template arguments and get resolved at compile time.
+    */
+    template<eBiquadFilters _type, eMathAccuracy _acc, eFilterTopology _topo>
+    void updateCoefficients(float lcModValue, float hcModValue, float resModValue) {
+
+        // should never happen if everybody uses it correctly! but in case it does, don't crash but return no sound instead
+        if (_type == eBiquadFilters::eLadder) {
+            targetCoefficients = BiquadCoefficients();
+            targetSvfCoefficients = SvfCoefficients();
+            return;
+        }
+
+        // the bandpass is defined by both frequencies, the ratio is checked as well
+        float bandRatio;
+        const float cutoffFreq = modulatedCutoff<_type, _acc>(filter, lcModValue, hcModValue, bandRatio) / sampleRate;
+        const float resonanceDb = filter.resonance + resModValue * filter.resModRange;
+
+        // another type or topology has nothing to ramp from
+        if (designType != _type || designTopology != _topo) {
+            coefficientsValid = false;
+        }
+        if (coefficientsValid
+            && std::abs(cutoffFreq - designCutoff) <= cutoffThreshold * designCutoff
+            && std::abs(resonanceDb - designResonance) <= resonanceThreshold
+            && std::abs(bandRatio - designBandRatio) <= cutoffThreshold * designBandRatio) {
+            return;
+        }
+        designType = _type;
+        designTopology = _topo;
+        designCutoff = cutoffFreq;
+        designResonance = resonanceDb;
+        designBandRatio = bandRatio;
+        rampPending = true;
+        countDesign();
+
+        if (_topo == eFilterTopology::eSvf) {
+            designSvf<_type, _acc>(cutoffFreq, resonanceDb, bandRatio, targetSvfCoefficients);
+        } else {
+            designBiquad<_type, _acc>(cutoffFreq, resonanceDb, bandRatio, targetCoefficients);
+        }
+    }
+
+    //! \brief one sample of the direct form with the current coefficients
+    float biquadSample(float inputSignal) {
+        const BiquadCoefficients& c = coefficients;
+
+        lastSample = inputSignal;
+
+        inputSignal = c.b0*inputSignal + c.b1*inputDelay1 + c.b2*inputDelay2 - c.a1*outputDelay1 - c.a2*outputDelay2;
+
+        //delaying samples
+        inputDelay2 = inputDelay1;
+        inputDelay1 = lastSample;
+        outputDelay2 = outputDelay1;
+        outputDelay1 = inputSignal;
+
+        if (inputSignal > 1.f) {
+            inputSignal = 1.f;
+        }
+        else if (inputSignal < -1.f) {
+            inputSignal = -1.f;
+        }
+        return inputSignal;
+    }
+
+    //! \brief one sample of the topology preserving (trapezoidal) state variable filter, Zavalishin / Simper
+    /*! The structure stays stable for any positive g and k, so it needs no output clamp and
+        takes fast modulation of the cutoff without blowing up.
+    */
+    template<eBiquadFilters _type>
+    float svfSample(float v0) {
+        const float g = svfCoefficients.g;
+        const float k = svfCoefficients.k;
+        const float a1 = 1.f / (1.f + g * (g + k));
+        const float a2 = g * a1;
+        const float a3 = g * a2;
+
+        const float v3 = v0 - svfState2;
+        const float v1 = a1 * svfState1 + a2 * v3;   // bandpass
+        const float v2 = svfState2 + a2 * svfState1 + a3 * v3; // lowpass
+        svfState1 = 2.f * v1 - svfState1;
+        svfState2 = 2.f * v2 - svfState2;
+
+        switch (_type) {
+            case eBiquadFilters::eLowpass: return v2;
+            case eBiquadFilters::eHighpass: return v0 - k * v1 - v2;
+            case eBiquadFilters::eBandpass: return k * v1; // 0 dB at the centre like the biquad bandpass
+            default: return 0.f;
+        }
+    }
+
+    //! \brief one sample of the ladder with the current coefficients
+    template<eMathAccuracy _acc>
+    float ladderSample(float ladderIn)
+    {
+        return ladderStep<_acc>(ladderIn, ladder, ladderOut, ladderInDelay, lpOut1, lpOut2, lpOut3, lpOut1Delay, lpOut2Delay, lpOut3Delay);
+    }
+
+    //! \brief single ladder sample without the ramp and the local oversampling, the coefficients jump to the modulation of this sample
+    template<eMathAccuracy _acc>
+    float ladderFilter(float ladderIn, float lcModValue, float resModValue)
+    {
+        designLadder<_acc>(filter, lcModValue, resModValue, sampleRate, ladder);
+        designType = eBiquadFilters::eLadder;
+        coefficientsValid = true;
+        return ladderSample<_acc>(ladderIn);
+    }
+
+    const ParamSnapshot::Filter &filter; //!< params of the current block
 
     float sampleRate;
 
@@ -232,6 +746,28 @@ protected:
     float lastSample, inputDelay1, inputDelay2, outputDelay1, outputDelay2, bandpassDelay1, bandpassDelay2;
     ///@}
 
+    //! \name state variable filter internal state
+    ///@{
+    float svfState1, svfState2;
+    ///@}
+
+    //! \name coefficient cache of the biquad and the state variable filter
+    ///@{
+    constexpr static float cutoffThreshold = 1e-4f; //!< relative change of cutoff or band ratio that triggers a new design, about .2 ct
+    constexpr static float resonanceThreshold = 1e-3f; //!< change of the resonance in dB that triggers a new design
+
+    BiquadCoefficients coefficients;        //!< used by the current sample
+    BiquadCoefficients targetCoefficients;  //!< end of the current ramp
+    SvfCoefficients svfCoefficients;
+    SvfCoefficients targetSvfCoefficients;
+    eBiquadFilters designType;              //!< type, topology, normalised cutoff, resonance and band ratio the targets were designed for
+    eFilterTopology designTopology;
+    float designCutoff, designResonance, designBandRatio;
+    bool coefficientsValid;                 //!< false after reset(), the first design is used without a ramp
+    bool rampPending;                       //!< the targets differ from the current coefficients
+    int designInterval;                     //!< samples per coefficient update, see setCoefficientInterval()
+    ///@}
+
     //! \name ladder internal state
     ///@{
     float ladderOut;
@@ -242,5 +778,9 @@ protected:
     float lpOut1Delay;
     float lpOut2Delay;
     float lpOut3Delay;
+    float ladderUpsampleDelay;          //!< last input sample of the local oversampling
+    HalfbandDecimator ladderDecimator;  //!< decimator of the local oversampling
+    LadderCoefficients ladder;          //!< used by the current sample
+    bool ladderOversampled;             //!< rate the ladder coefficients were designed for
     ///@}
 };
@@ -0,0 +1,301 @@
+/*
+  ==============================================================================
+
+    FilterBank.h
+    Created: 14 Oct 2026 11:56:40pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef FILTERBANK_H_INCLUDED
+#define FILTERBANK_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "SynthParams.h"
+#include "Filter.h"
+#include "VoiceBank.h"
+
+//! Filter Bank: runs one filter of several voices in lock-step
+/*! A recursive filter cannot be vectorised along time, but the same filter of several voices
+    can: the biquad or ladder state, the coefficients and their ramps of up to numLanes voices
+    are gathered into struct-of-arrays form, and the samples into interleaved blocks. Every
+    lane has its own cutoff and resonance modulation, the coefficients of all lanes are
+    designed together every Filter::coefficientInterval samples and ramped in between, like
+    in the block kernels of Filter. The biquad samples run in the kernel of SimdKernels picked
+    for the cpu, the ladder keeps its lane loop here, vectorised for the baseline of the build.
+    The state variable filter and the locally oversampled ladder have no lane version,
+    see supports().
+*/
+class FilterBank {
+public:
+    static const int numLanes = VoiceBank::numLanes;
+
+    FilterBank()
+        : kernels(SimdKernels::get())
+        , blockSize(0)
+        , numSamples(0)
+        , activeLanes(numLanes)
+        , sampleRate(44100.f)
+        , filter(nullptr)
+    {
+        clearLanes();
+    }
+
+    //! \brief true if the filter settings of the block can be rendered in lanes
+    static bool supports(const ParamSnapshot::Filter& f) {
+        return f.passtype == eBiquadFilters::eLadder ? !f.ladderOversampling : f.topology == eFilterTopology::eBiquad;
+    }
+
+    //! allocates the interleaved scratch blocks and faults them in through memory, must not be called from the audio thread
+    void prepare(int maxBlockSize, RealtimeMemory& memory) {
+        blockSize = maxBlockSize;
+        const size_t numSegments = static_cast<size_t>(getNumSegments(blockSize));
+        samples.allocate(static_cast<size_t>(blockSize * numLanes), true);
+        lcMod.allocate(numSegments * numLanes, true);
+        hcMod.allocate(numSegments * numLanes, true);
+        resMod.allocate(numSegments * numLanes, true);
+        memory.add(samples.getData(), static_cast<size_t>(blockSize * numLanes) * sizeof(float));
+        memory.add(lcMod.getData(), numSegments * numLanes * sizeof(float));
+        memory.add(hcMod.getData(), numSegments * numLanes * sizeof(float));
+        memory.add(resMod.getData(), numSegments * numLanes * sizeof(float));
+    }
+
+    //! \brief bytes of the scratch blocks
+    int64 getMemoryBytes() const {
+        return (static_cast<int64>(blockSize) + 3 * getNumSegments(blockSize)) * numLanes * static_cast<int64>(sizeof(float));
+    }
+
+    //! starts a new group of numVoices lanes for a block of n samples of the given filter, unused lanes stay silent
+    void begin(const ParamSnapshot::Filter& f, float sRate, int n, int numVoices) {
+        jassert(n <= blockSize && numVoices <= numLanes && supports(f));
+        filter = &f;
+        sampleRate = sRate;
+        numSamples = n;
+        activeLanes = SimdKernels::roundUpLanes(numVoices);
+        clearLanes();
+        FloatVectorOperations::clear(samples, numSamples * numLanes);
+        const int numValues = getNumSegments(numSamples) * numLanes;
+        FloatVectorOperations::clear(lcMod, numValues);
+        FloatVectorOperations::clear(hcMod, numValues);
+        FloatVectorOperations::clear(resMod, numValues);
+    }
+
+    //! loads the filter state, the input block and the modulation blocks of one voice into a lane, unrouted modulation is nullptr
+    void setLane(int lane, const Filter::LaneState& st, const float *input, const float *lc, const float *hc, const float *res) {
+        jassert(lane >= 0 && lane < numLanes);
+        valid[lane] = st.valid;
+        biquad.b0[lane] = st.coefficients.b0;
+        biquad.b1[lane] = st.coefficients.b1;
+        biquad.b2[lane] = st.coefficients.b2;
+        biquad.a1[lane] = st.coefficients.a1;
+        biquad.a2[lane] = st.coefficients.a2;
+        biquad.x1[lane] = st.inputDelay1;
+        biquad.x2[lane] = st.inputDelay2;
+        biquad.y1[lane] = st.outputDelay1;
+        biquad.y2[lane] = st.outputDelay2;
+        ladderB[lane] = st.ladder.b;
+        ladderRes[lane] = st.ladder.resonance;
+        ladderOut[lane] = st.ladderOut;
+        ladderInDelay[lane] = st.ladderInDelay;
+        lpOut1[lane] = st.lpOut1;
+        lpOut2[lane] = st.lpOut2;
+        lpOut3[lane] = st.lpOut3;
+        lpOut1Delay[lane] = st.lpOut1Delay;
+        lpOut2Delay[lane] = st.lpOut2Delay;
+        lpOut3Delay[lane] = st.lpOut3Delay;
+
+        for (int s = 0; s < numSamples; ++s) {
+            samples[s * numLanes + lane] = input[s];
+        }
+        // only the modulation at the end of every segment is used
+        for (int seg = 0; seg < getNumSegments(numSamples); ++seg) {
+            const int m = jmin((seg + 1) * Filter::coefficientInterval, numSamples) - 1;
+            lcMod[seg * numLanes + lane] = lc != nullptr ? lc[m] : 0.f;
+            hcMod[seg * numLanes + lane] = hc != nullptr ? hc[m] : 0.f;
+            resMod[seg * numLanes + lane] = res != nullptr ? res[m] : 0.f;
+        }
+    }
+
+    //! takes the filter state of a lane back out and de-interleaves its block
+    void getLane(int lane, Filter::LaneState& st, float *output) const {
+        st.valid = true;
+        st.coefficients.b0 = biquad.b0[lane];
+        st.coefficients.b1 = biquad.b1[lane];
+        st.coefficients.b2 = biquad.b2[lane];
+        st.coefficients.a1 = biquad.a1[lane];
+        st.coefficients.a2 = biquad.a2[lane];
+        st.designCutoff = designCutoff[lane];
+        st.designResonance = designResonance[lane];
+        st.designBandRatio = designBandRatio[lane];
+        st.inputDelay1 = biquad.x1[lane];
+        st.inputDelay2 = biquad.x2[lane];
+        st.outputDelay1 = biquad.y1[lane];
+        st.outputDelay2 = biquad.y2[lane];
+        st.ladder.b = ladderB[lane];
+        st.ladder.resonance = ladderRes[lane];
+        st.ladderOut = ladderOut[lane];
+        st.ladderInDelay = ladderInDelay[lane];
+        st.lpOut1 = lpOut1[lane];
+        st.lpOut2 = lpOut2[lane];
+        st.lpOut3 = lpOut3[lane];
+        st.lpOut1Delay = lpOut1Delay[lane];
+        st.lpOut2Delay = lpOut2Delay[lane];
+        st.lpOut3Delay = lpOut3Delay[lane];
+
+        for (int s = 0; s < numSamples; ++s) {
+            output[s] = samples[s * numLanes + lane];
+        }
+    }
+
+    //! filters all lanes in place
+    void render(eMathAccuracy accuracy) {
+        if (accuracy == eMathAccuracy::eFast) {
+            renderType<eMathAccuracy::eFast>();
+        } else {
+            renderType<eMathAccuracy::eAccurate>();
+        }
+    }
+
+private:
+    static int getNumSegments(int n) {
+        return (n + Filter::coefficientInterval - 1) / Filter::coefficientInterval;
+    }
+
+    template<eMathAccuracy _acc>
+    void renderType() {
+        switch (filter->passtype) {
+            case eBiquadFilters::eLowpass: renderBiquad<eBiquadFilters::eLowpass, _acc>(); break;
+            case eBiquadFilters::eHighpass: renderBiquad<eBiquadFilters::eHighpass, _acc>(); break;
+            case eBiquadFilters::eBandpass: renderBiquad<eBiquadFilters::eBandpass, _acc>(); break;
+            case eBiquadFilters::eLadder: renderLadder<_acc>(); break;
+            default: break;
+        }
+    }
+
+    template<eBiquadFilters _type, eMathAccuracy _acc>
+    void renderBiquad() {
+        const ParamSnapshot::Filter& p = *filter;
+        for (int seg = 0, s = 0; s < numSamples; ++seg, s += Filter::coefficientInterval) {
+            const int n = jmin(Filter::coefficientInterval, numSamples - s);
+            const float inv = 1.f / static_cast<float>(n);
+
+            // design the targets of the lanes at the end of the segment, a lane without valid coefficients jumps
+            Filter::BiquadCoefficients target[numLanes];
+            for (int l = 0; l < activeLanes; ++l) {
+                float bandRatio;
+                const float cutoff = Filter::modulatedCutoff<_type, _acc>(p, lcMod[seg * numLanes + l], hcMod[seg * numLanes + l], bandRatio) / sampleRate;
+                const float resonanceDb = p.resonance + resMod[seg * numLanes + l] * p.resModRange;
+                Filter::designBiquad<_type, _acc>(cutoff, resonanceDb, bandRatio, target[l]);
+                designCutoff[l] = cutoff;
+                designResonance[l] = resonanceDb;
+                designBandRatio[l] = bandRatio;
+
+                biquad.b0[l] = valid[l] ? biquad.b0[l] : target[l].b0;
+                biquad.b1[l] = valid[l] ? biquad.b1[l] : target[l].b1;
+                biquad.b2[l] = valid[l] ? biquad.b2[l] : target[l].b2;
+                biquad.a1[l] = valid[l] ? biquad.a1[l] : target[l].a1;
+                biquad.a2[l] = valid[l] ? biquad.a2[l] : target[l].a2;
+                valid[l] = true;
+
+                biquad.db0[l] = (target[l].b0 - biquad.b0[l]) * inv;
+                biquad.db1[l] = (target[l].b1 - biquad.b1[l]) * inv;
+                biquad.db2[l] = (target[l].b2 - biquad.b2[l]) * inv;
+                biquad.da1[l] = (target[l].a1 - biquad.a1[l]) * inv;
+                biquad.da2[l] = (target[l].a2 - biquad.a2[l]) * inv;
+            }
+
+            // same as Filter::biquadSample(), the feedback takes the output before the clamp
+            kernels.biquadLanes(biquad, samples + s * numLanes, activeLanes, n);
+
+            for (int l = 0; l < activeLanes; ++l) {
+                biquad.b0[l] = target[l].b0;
+                biquad.b1[l] = target[l].b1;
+                biquad.b2[l] = target[l].b2;
+                biquad.a1[l] = target[l].a1;
+                biquad.a2[l] = target[l].a2;
+            }
+        }
+    }
+
+    template<eMathAccuracy _acc>
+    void renderLadder() {
+        const ParamSnapshot::Filter& p = *filter;
+        for (int seg = 0, s = 0; s < numSamples; ++seg, s += Filter::coefficientInterval) {
+            const int n = jmin(Filter::coefficientInterval, numSamples - s);
+            const float inv = 1.f / static_cast<float>(n);
+
+            Filter::LadderCoefficients target[numLanes];
+            for (int l = 0; l < activeLanes; ++l) {
+                Filter::designLadder<_acc>(p, lcMod[seg * numLanes + l], resMod[seg * numLanes + l], sampleRate, target[l]);
+                ladderB[l] = valid[l] ? ladderB[l] : target[l].b;
+                ladderRes[l] = valid[l] ? ladderRes[l] : target[l].resonance;
+                valid[l] = true;
+
+                dLadderB[l] = (target[l].b - ladderB[l]) * inv;
+                dLadderRes[l] = (target[l].resonance - ladderRes[l]) * inv;
+            }
+
+            for (int i = s; i < s + n; ++i) {
+                float *io = samples + i * numLanes;
+                for (int l = 0; l < activeLanes; ++l) {
+                    ladderB[l] += dLadderB[l];
+                    ladderRes[l] += dLadderRes[l];
+                    const Filter::LadderCoefficients c = { ladderB[l], ladderRes[l] };
+                    io[l] = Filter::ladderStep<_acc>(io[l], c, ladderOut[l], ladderInDelay[l], lpOut1[l], lpOut2[l], lpOut3[l],
+                                                     lpOut1Delay[l], lpOut2Delay[l], lpOut3Delay[l]);
+                }
+            }
+
+            for (int l = 0; l < activeLanes; ++l) {
+                ladderB[l] = target[l].b;
+                ladderRes[l] = target[l].resonance;
+            }
+        }
+    }
+
+    //! all lanes, a kernel may render more than activeLanes
+    void clearLanes() {
+        biquad = SimdKernels::BiquadLanes();
+        for (int l = 0; l < numLanes; ++l) {
+            valid[l] = false;
+            dLadderB[l] = dLadderRes[l] = 0.f;
+            designCutoff[l] = designResonance[l] = designBandRatio[l] = 0.f;
+            ladderB[l] = ladderRes[l] = 0.f;
+            ladderOut[l] = ladderInDelay[l] = 0.f;
+            lpOut1[l] = lpOut2[l] = lpOut3[l] = 0.f;
+            lpOut1Delay[l] = lpOut2Delay[l] = lpOut3Delay[l] = 0.f;
+        }
+    }
+
+    const SimdKernels& kernels;
+    int blockSize;
+    int numSamples;
+    int activeLanes;    //!< lanes of the group rounded up to SimdKernels::laneGroup
+    float sampleRate;
+    const ParamSnapshot::Filter *filter;    //!< params of the filter of the current group
+
+    //! \name struct-of-arrays filter state
+    ///@{
+    bool valid[numLanes];
+    SimdKernels::BiquadLanes biquad;    //!< with the ramp steps of the current segment
+    float dLadderB[numLanes], dLadderRes[numLanes];
+    float designCutoff[numLanes], designResonance[numLanes], designBandRatio[numLanes];
+    float ladderB[numLanes], ladderRes[numLanes];
+    float ladderOut[numLanes], ladderInDelay[numLanes];
+    float lpOut1[numLanes], lpOut2[numLanes], lpOut3[numLanes];
+    float lpOut1Delay[numLanes], lpOut2Delay[numLanes], lpOut3Delay[numLanes];
+    ///@}
+
+    //! \name interleaved blocks, sample s of lane l is stored at [s * numLanes + l]
+    ///@{
+    HeapBlock<float> samples;
+    HeapBlock<float> lcMod;     //!< modulation at the end of segment k at [k * numLanes + l]
+    HeapBlock<float> hcMod;
+    HeapBlock<float> resMod;
+    ///@}
+
+    JUCE_DECLARE_NON_COPYABLE(FilterBank)
+};
+
+#endif  // FILTERBANK_H_INCLUDED
@@ -0,0 +1,72 @@
+/*
+  ==============================================================================
+
+    FxBuffer.h
+    Created: 15 Oct 2026 3:47:26am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef FXBUFFER_H_INCLUDED
+#define FXBUFFER_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "BackgroundJobs.h"
+#include "RealtimeMemory.h"
+#include <atomic>
+
+//! FxBuffer: audio buffer of an effect, allocated when the effect is first rendered
+/*! Until an effect is switched on, none of its memory is allocated. The first acquire() of
+    the audio thread asks a background thread shared by all instances for the buffer, which
+    allocates and clears it and hands it over with an atomic pointer. Until then acquire()
+    returns nullptr and the effect is bypassed, which is at most a few blocks. Once the effect
+    was in use a new size is allocated by setSize() itself, so a prepare does not bypass it again.
+    Every page of the buffer is written before it is handed over, and locked into RAM on request,
+    so the audio thread does not fault on it, see RealtimeMemory.
+*/
+class FxBuffer : private TimeSliceClient {
+public:
+    FxBuffer();
+    ~FxBuffer();
+
+    //! \brief size of the buffer, from prepareToPlay() while the audio thread does not render
+    /*! A buffer of another size is freed, the next acquire() asks for one of the new size, or it
+        is allocated at once if one was acquired before. A buffer of the same size is cleared.
+        @param lock keep the buffer in RAM, see SynthParams::lockMemory
+    */
+    void setSize(int numChannels, int numSamples, bool lock);
+
+    //! \brief the buffer, or nullptr until it is allocated, audio thread only
+    AudioSampleBuffer* acquire();
+
+    //! \brief silences an allocated buffer without asking for one, while the audio thread does not render
+    void clear();
+
+    //! \brief bytes of the buffer once it is allocated, 0 before, any thread
+    int64 getAllocatedBytes() const {
+        return ready.load(std::memory_order_acquire) != nullptr ? static_cast<int64>(channels) * samples * static_cast<int64>(sizeof(float)) : 0;
+    }
+
+    int getNumChannels() const { return channels; }
+    int getNumSamples() const { return samples; }
+
+private:
+
+    //! allocates a requested buffer on the background thread
+    int useTimeSlice() override;
+    //! \brief allocates, clears and faults in the buffer and publishes it
+    void allocate();
+
+    SharedResourcePointer<BackgroundJobs> jobs;
+    ScopedPointer<AudioSampleBuffer> buffer;    //!< written by the worker before it is published
+    std::atomic<AudioSampleBuffer*> ready;      //!< the buffer, once it is allocated
+    std::atomic<bool> requested;                //!< set by the first acquire()
+    int channels;
+    int samples;
+    RealtimeMemory memory;                      //!< of the buffer, unlocked before it is freed
+
+    JUCE_DECLARE_NON_COPYABLE(FxBuffer)
+};
+
+#endif  // FXBUFFER_H_INCLUDED
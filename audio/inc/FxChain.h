@@ -0,0 +1,82 @@
+/*
+  ==============================================================================
+
+    FxChain.h
+    Created: 15 Oct 2026 4:38:10am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef FXCHAIN_H_INCLUDED
+#define FXCHAIN_H_INCLUDED
+
+#include "SynthParams.h"
+#include "FxSlot.h"
+#include <array>
+
+//! FxChain: the effects of the output in the order of the fxSlot params
+/*! Every effect processes the output buffer in place, one after the other, nothing is copied.
+    Only active slots are traversed, and a slot whose input has been silent for longer than its
+    tail, and whose output is silent too, is reset once and then sleeps until its input is no
+    longer silent. Processing silence with a cleared state gives silence, so a sleeping slot
+    leaves the buffer as it is. The order is taken from the snapshot once per block: every
+    position names an effect, an effect named twice only runs at its first position and the
+    effects no position names are appended in the default order, so every order of the params
+    runs each effect exactly once.
+    An effect can send what it adds to the buffer, its output minus its input, into channels of
+    its own, the return of an output bus. The delay and the chorus add their wet signal to the
+    dry one, so that is their wet signal at their place in the chain.
+*/
+class FxChain {
+public:
+    static const int numSlots = static_cast<int>(eFxType::nSteps);
+    typedef std::array<eFxType, numSlots> tOrder;
+    //! channels of the return of every effect by eFxType, as many as the processed buffer has, nullptr for none
+    typedef std::array<float* const*, numSlots> tReturns;
+
+    //! \brief the effects by eFxType, owned by the processor
+    FxChain(SynthParams& p, FxSlot& lowFi, FxSlot& clipping, FxSlot& delay, FxSlot& chorus, FxSlot& reverb, FxSlot& waveshaper);
+
+    //! \brief prepares all effects, also the inactive ones
+    void prepare(int numChannels, double sampleRate);
+
+    /** \brief runs the active effects on the samples in the order of the snapshot
+        @param returns channels the effects write what they add into, the returns of inactive
+                       and sleeping effects are left as they are
+    */
+    void process(AudioSampleBuffer& buffer, int startSample, int numSamples, const tReturns* returns = nullptr);
+
+    //! \brief resets all effects
+    void reset();
+
+    //! \brief tail of the active effects, they are in series so the tails add up
+    int getTailSamples() const;
+
+    //! \brief every active effect sleeps, the chain leaves silence as it is; audio thread only
+    bool isAsleep() const;
+
+    //! \brief the order the positions run the effects in, without duplicates
+    static void resolveOrder(const tOrder& positions, tOrder& order);
+
+    //! peak below which a block counts as silent, -100 dB
+    constexpr static float silenceThreshold = 1e-5f;
+
+private:
+    //! silence tracking of a slot, only accessed on the audio thread
+    struct SleepState {
+        SleepState() : silentSamples(0), asleep(false) {}
+        int64 silentSamples;    //!< samples of silent input since the last block with signal
+        bool asleep;            //!< reset after the tail, skipped while the input stays silent
+    };
+
+    static bool isSilent(const AudioSampleBuffer& buffer, int startSample, int numSamples);
+
+    SynthParams& params;
+    std::array<FxSlot*, numSlots> slots;    //!< by eFxType
+    std::array<SleepState, numSlots> sleep; //!< by eFxType
+
+    JUCE_DECLARE_NON_COPYABLE(FxChain)
+};
+
+#endif  // FXCHAIN_H_INCLUDED
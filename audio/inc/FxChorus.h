@@ -4,14 +4,34 @@
 
 #include "SynthParams.h"
 #include "Oscillator.h"
+#include "FxBuffer.h"
+#include "FxSlot.h"
+#include <array>
+#include <vector>
 
 
-class FxChorus
+//! FxChorus Class: five modulated taps behind the input
+/*! The input is written to a ring buffer of a power of two length, the taps read it at the
+    width minus their sine modulation with masked indices. The chorus works on segments of
+    the block: the modulators are rendered first, the tap positions are the same for all
+    channels, then every channel writes its input and reads the taps in separate loops, which
+    leaves only the gathers of the buffer samples scalar.
+    A tap is read in two passes over the segment: the samples around its read positions are
+    gathered into arrays, then an interpolation kernel of eChorusInterpolation turns them into
+    the tap. The linear and hermite kernels are straight loops over the arrays the compiler
+    vectorises, the allpass one computes its coefficients the same way and leaves only its
+    recursion per sample, with a state per tap and channel.
+*/
+class FxChorus : public FxSlot
 {
 public:
     FxChorus(SynthParams &p)
         : params(p)
-        , loopPosition(0)
+        , chorusBuffer(nullptr)
+        , sampleRate(44100.f)
+        , writePosition(0)
+        , ringMask(0)
+        , lastInterpolation(eChorusInterpolation::eLinear)
         //, chorDelayLength(.02f)
         //, modulationDepth(.01f)
         //, modulationRate(.5f)
@@ -21,21 +41,70 @@ public:
     }
     ~FxChorus();
 
-    void init(int channelsIn, double sampleRateIn);
-    void render(AudioSampleBuffer& outputBuffer, int startSample);
+    void prepare(int channelsIn, double sampleRateIn) override;
+    void process(AudioSampleBuffer& outputBuffer, int startSample, int numSamples) override;
+
+    //! clears the buffer and restarts the modulators
+    void reset() override;
+    //! the longest tap
+    int getTailSamples() const override;
+    int64 getMemoryBytes() const override;
+    bool isActive() const override { return params.chorActivation.getStep() == eOnOffToggle::eOn; }
+
+    static const int numTaps = 5;
 
 private:
+    //! longest segment, the tap positions and samples of a segment are kept on the stack
+    static const int maxSegmentLength = 256;
+
+    //! \brief integer part and fraction of the read positions of a tap for a segment
+    /*!
+    @param mod modulation of the tap in samples per sample of the segment
+    @param base ring index of the first sample of the segment minus the width, offset by the ring length
+    @param index integer read positions, not masked yet
+    @param frac fractions between index and index + 1
+    @param n segment length
+    */
+    static void calcTapPositions(const float* mod, int base, int* index, float* frac, int n);
+
+    //! \brief reads a tap between its samples and adds it to the wet signal
+    /*!
+    @param ring the chorus buffer of the channel
+    @param index integer read positions, see calcTapPositions()
+    @param frac fractions between index and index + 1
+    @param weight gain of the tap in the channel
+    @param wet the wet signal the tap is added to
+    @param n segment length
+    @param interpolation the kernel
+    @param state last output of the allpass of the tap in the channel
+    */
+    void addTap(const float* ring, const int* index, const float* frac, float weight, float* wet, int n,
+                eChorusInterpolation interpolation, float& state) const;
+
+    //! \brief the samples at index + offset of a segment, masked into the ring
+    void gather(const float* ring, const int* index, int offset, float* y, int n) const;
+
+    //! \name interpolation kernels
+    /*! y0..y3 are the samples at index - 1 .. index + 2, the tap is added to wet with the weight */
+    ///@{
+    static void interpolateLinear(const float* y1, const float* y2, const float* frac, float weight, float* wet, int n);
+    static void interpolateHermite(const float* y0, const float* y1, const float* y2, const float* y3,
+                                   const float* frac, float weight, float* wet, int n);
+    //! \brief a fractional delay of .5 to 1.5 samples behind the newer sample keeps the pole away from the unit circle
+    static void interpolateAllpass(const float* y1, const float* y2, const float* y3,
+                                   const float* frac, float weight, float* wet, int n, float& state);
+    ///@}
+
     SynthParams &params;
-    AudioSampleBuffer chorusBuffer;
-    Oscillator<&Waveforms::sinus> modSine1;
-    Oscillator<&Waveforms::sinus> modSine2;
-    Oscillator<&Waveforms::sinus> modSine3;
-    Oscillator<&Waveforms::sinus> modSine4;
-    Oscillator<&Waveforms::sinus> modSine5;
+    FxBuffer buffer;                    //!< of the longest delay length, allocated when the chorus is first switched on
+    AudioSampleBuffer* chorusBuffer;    //!< the buffer while a block is rendered
+    std::array<SineOscillator, numTaps> modSine;
     float sampleRate;
     int channels;
-    int currentDelayLength;
-    int loopPosition;
+    int writePosition;                  //!< ring index of the next input sample
+    int ringMask;                       //!< ring length - 1
+    std::vector<std::array<float, numTaps>> allpassState;   //!< per channel and tap, see interpolateAllpass()
+    eChorusInterpolation lastInterpolation; //!< of the last block, a change to the allpass clears its state
 
 };
 
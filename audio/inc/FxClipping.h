@@ -12,14 +12,20 @@
 #define FXCLIPPING_H_INCLUDED
 
 #include "SynthParams.h"
+#include "FxSlot.h"
+#include <vector>
 
 //! FxDelay Class: Clipping Effect
 
 /*! The clipping effect trims the samples that surpass the threshold of 1 or -1.
     It does that by multiplying the sample with an overload factor and if the value,
     are bigger than 1 or lower than -1, then will be 1 or -1 respectively.
+    The soft clip modes replace the hard limit by a curve and output the mean of the curve between
+    two samples, the difference of its antiderivative divided by the difference of the inputs.
+    This suppresses most of the aliasing of the saturation without oversampling, at the cost of
+    half a sample of delay.
 */
-class FxClipping
+class FxClipping : public FxSlot
 {
 public:
     //! FxDelay constructor.
@@ -30,6 +36,9 @@ public:
     //! FxDelay destructor.
     ~FxClipping();
 
+    //! sets up the previous input of the anti-aliased modes for the amount of channels
+    void prepare(int numChannels, double sampleRate) override;
+
     //! Signal clipping
     /*!
      It holds the actual "clipping" of the signal.
@@ -38,10 +47,15 @@ public:
      @params int - needed for sudden (midi) parameter changes
      @params int - the current block size
      */
-    void clipSignal(AudioSampleBuffer&, int, int);
+    void process(AudioSampleBuffer&, int, int) override;
+
+    void reset() override;
+    int getTailSamples() const override { return 0; }
+    bool isActive() const override { return params.clippingActivation.getStep() == eOnOffToggle::eOn; }
 
 protected:
      SynthParams &params; //!< local params reference
+     std::vector<double> lastInput; //!< previous input of each channel after the overload factor
 
 };
 
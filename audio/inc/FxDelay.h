@@ -12,61 +12,115 @@
 #define FXDELAY_H_INCLUDED
 
 #include "SynthParams.h"
+#include "Denormals.h"
+#include "FxBuffer.h"
+#include "FxSlot.h"
+#include "SimdKernels.h"
 
 //! FxDelay Class: Delay Effect
 /*! The delay effect adds a delayed signal to the current audiobuffer.
     The time can be set manually or synced in note values to the host.
     A simple filter can get applied to the feedback loop.
     The delay buffer can be read in both direction to add a reverse mode.
+    The input is written to a ring buffer of the maximum length and read behind the write
+    position, so a new delay time only moves the read position: the delayed signal fades
+    from the old to the new position in crossfadeTime, nothing has to be cleared. The ring
+    buffer is processed in segments up to its end, so reading and writing is done on whole
+    blocks, only the feedback filter and the reverse reads run per sample.
+    The ring buffer holds interleaved stereo frames, a segment of the output is interleaved
+    once: the reads, gains and writes of both channels are one vector operation over the
+    frames and the feedback filter renders a frame per step, see SimdKernels::stereoBiquadFrames.
+    In ping-pong mode the input is written to the left channel only and the feedback crosses
+    the channels, so the repeats alternate between left and right. A mono output uses the left
+    channel of the frames and no ping-pong.
+    The ring buffer is the largest allocation of an instance, 20 s of frames. With delayStorage
+    it holds 16 bit fixed point or half floats instead of floats and takes half the memory,
+    the frames are converted by the vector kernels when a segment is read and written. The
+    feedback, the filter and the crossfades stay in float, only the stored signal is rounded.
 */
 
-class FxDelay {
+class FxDelay : public FxSlot {
 public:
     //! FxDelay constructor.
     FxDelay(SynthParams &p)
         : params(p)
+        , ring(nullptr)
+        , storage(eDelayStorage::eFloat)
+        , ringFrames(1)
+        , sampleRate(44100.)
+        , writePosition(0)
         , loopPosition(0)
+        , delayLength(1)
+        , fadeFromLength(1)
+        , fadeFromPosition(0)
+        , fadeSamples(1)
+        , fadeCounter(0)
+        , maxDelayLength(20000)
         , bpm(120)
         , divisor(0)
         , dividend(0)
-        , fLastSample(0.f)
-        , fInputDelay1(0.f)
-        , fInputDelay2(0.f)
-        , fOutputDelay1(0.f)
-        , fOutputDelay2(0.f)
-        , delayBuffer()
-        , maxDelayLength(20000)
+        , coefficientCutoff(-1.f)
+        , feedbackFilter()
     {}
     //! FxDelay destructor.
     ~FxDelay(){}
 
     //! delay rendering.
     /*!
-    The public function render can be called to add a delay to a processed audio block.
+    The public function process can be called to add a delay to a processed audio block.
     This functions calls calcTime(), to determine the delay length, adds the (filtered)
     signal to the delay and output buffer and takes care of the current position and
     direction inside the ring buffer (feedback loop).
     @param outputBuffer a reference to the current block. the delay gets added to it
     @param startSample needed for sudden (midi) parameter changes
-    @param numSamplesIn the current block size
+    @param numSamples the current block size
     */
-    void render(AudioSampleBuffer& outputBuffer, int startSample, int numSamplesIn);
+    void process(AudioSampleBuffer& outputBuffer, int startSample, int numSamples) override;
 
     //! delay initialization.
     /*!
-    The init function sets up the audio buffer size, sample rate, maximum length and channels.
+    The prepare function sets up the audio buffer size, sample rate, maximum length and channels.
     @param channelsIn the amount of audio channels
     @param sampleRateIn the current sample rate
     */
-    void init(int channelsIn, double sampleRateIn);
+    void prepare(int channelsIn, double sampleRateIn) override;
+
+    //! clears the delay buffer and the filter state
+    void reset() override;
+
+    //! the delay length times the repeats until the feedback decayed by 60 dB
+    int getTailSamples() const override;
+    int64 getMemoryBytes() const override;
+
+    bool isActive() const override { return params.delayActivation.getStep() == eOnOffToggle::eOn; }
+
+    //! number of denormal values in the filter state, for the debug monitor of the processor
+    int countDenormalState() const;
+
+    static const int frameWidth = 2;    //!< samples of a frame of the ring buffer, left and right
+
+    //! 16 bit fixed point of the ring buffer per unit, 12 dB of headroom above full scale for the feedback
+    constexpr static float fixedScale = 8192.f;
 
 private:
     //! delay time calculation.
     /*!
     Calcutates the delay time in case of changes
     of the host tempo or user input.
+    @param snap params of the current block
+    returns the delay time of the current block in ms
+    */
+    float calcTime(const ParamSnapshot& snap);
+
+    //! \brief ms of the delay of the last block, the time param before the first one, any thread
+    float getCurrentTime() const;
+
+    //! delay filter coefficients.
+    /*!
+    Designs the lowpass of the feedback loop, called only when the cutoff changes.
+    @param cutoff the cutoff frequency in Hz
     */
-    void calcTime();
+    void calcCoefficients(float cutoff);
 
     //! delay filter.
     /*!
@@ -74,26 +128,77 @@ private:
     to the delayed signal. The cutoff frequency can be set by the user.
     The filter changes can be applied to the feedback while reading: realtime,
     or while writing to the buffer. This "records" changes into the delay.
-    @param inputSignal the current input sample
-    returns the filtered inputSignal
+    @param frames the delayed frames, filtered in place
+    @param n the number of frames
     */
-    float filter(float inputSignal);
+    void filter(float* frames, int n);
+
+    //! clears the state of the feedback filter, keeps its coefficients
+    void clearFilter();
+
+    //! delays the frames of a segment that crosses neither the end of the ring buffer nor the end of a loop.
+    /*!
+    @param io the interleaved frames of the output block, the delayed signal gets added to them
+    @param n the segment length in frames
+    @param snap params of the current block
+    @param feedback smoothed feedback of the segment
+    @param dryWet smoothed wetness of the segment
+    @param pingPong the input goes to the left channel, the feedback to the other channel
+    */
+    void renderSegment(float* io, int n, const ParamSnapshot& snap, Param::Ramp feedback, Param::Ramp dryWet, bool pingPong);
+
+    //! adds the frames of src with a linear gain ramp to dst, the channels of src swapped if requested
+    static void addWithRamp(float* dst, const float* src, Param::Ramp gain, int n, bool swapChannels);
+
+    //! reads the delayed frames of a segment.
+    /*!
+    Forward the frames are read length frames behind the write position. In reverse mode
+    the loop of the length is played backwards, the read position moves back by one per frame.
+    @param out the delayed frames
+    @param n the segment length in frames
+    @param length the delay length in frames
+    @param position the position inside the loop of the length, only used in reverse mode
+    @param reverse the reverse mode
+    */
+    void readDelayed(float* out, int n, int length, int position, bool reverse) const;
+
+    //! \brief n frames of the ring buffer from frame on as floats, the frames must not wrap around
+    void readFrames(float* out, int frame, int n) const;
+    //! \brief stores n frames at frame on in the format of the ring buffer, the frames must not wrap around
+    void writeFrames(const float* in, int frame, int n);
+
+    //! samples from the position to the end of the loop, or in reverse mode to the jump of the read position
+    static int getLoopSegmentLength(int length, int position, bool reverse);
+
+    //! longest segment in frames, the delayed frames of a segment are kept on the stack
+    static const int maxSegmentLength = 256;
+
+    //! time in s the delayed signal takes to move to a new delay length
+    constexpr static float crossfadeTime = .05f;
+
+    //! most repeats counted for the tail, a feedback of 1 never decays
+    static const int maxTailRepeats = 64;
 
     SynthParams &params;            //!< local params reference
-    AudioSampleBuffer delayBuffer;  //!< delay audio buffer
+    FxBuffer delayBuffer;           //!< delay audio buffer, one channel of interleaved frames of maxDelayLength
+    AudioSampleBuffer* ring;        //!< the delay buffer while a block is rendered
+    eDelayStorage storage;          //!< format of the ring buffer, the 16 bit ones use each float of the buffer for two samples
+    int ringFrames;                 //!< frames of the ring buffer
     double sampleRate;              //!< current sammple rate
     int channels;                   //!< channel amount, 2 stereo
+    int writePosition;              //!< the next frame of the ring buffer to be written
     int loopPosition;               //!< the current loop position
-    int currentDelayLength;         //!< delay length, or delay time in samples
-    int maxDelayLength;             //!< maximum delay length in samples
+    int delayLength;                //!< delay length, or delay time in samples
+    int fadeFromLength;             //!< delay length the current crossfade started from
+    int fadeFromPosition;           //!< loop position of the fade from length
+    int fadeSamples;                //!< length of a crossfade in samples
+    int fadeCounter;                //!< remaining samples of the current crossfade, 0 if none
+    int maxDelayLength;             //!< maximum delay length in ms
     double bpm;                     //!< current beats per minute, temp storage
     float divisor;                  //!< user set delay time divisor, temp storage
     float dividend;                 //!< user set delay time dividend, temp storage
-    float fLastSample;              //!< filter sample storage
-    float fInputDelay1;             //!< filter sample storage
-    float fInputDelay2;             //!< filter sample storage
-    float fOutputDelay1;            //!< filter sample storage
-    float fOutputDelay2;            //!< filter sample storage
+    float coefficientCutoff;        //!< cutoff the coefficients were designed for
+    SimdKernels::StereoBiquad feedbackFilter;   //!< coefficients and state of both channels
     eOnOffToggle triplet;           //!< user set triplet mode, on==1 or off==0
 };
 #endif  // FXDELAY_H_INCLUDED
@@ -0,0 +1,97 @@
+/*
+  ==============================================================================
+
+    FxPipeline.h
+    Created: 17 Oct 2026 5:41:09pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef FXPIPELINE_H_INCLUDED
+#define FXPIPELINE_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "RealtimeThreadPool.h"
+
+//! FxPipeline: the voices of a block and the effects of the block before on two cores
+/*! One block of latency buys the overlap: while the calling audio thread renders the voices of
+    block n into the output, a worker of the shared RealtimeThreadPool runs the effects on the
+    voices of block n-1, which wait in a buffer of their own. The processed samples go into a
+    fifo primed with maxBlockSize samples of silence and every block takes as many out as it
+    rendered, so the output is the processed voices delayed by exactly getLatency() samples
+    whatever the block sizes are. The two stages run as the two jobs of one batch, without an
+    idle worker the caller runs both one after the other and only the latency is left.
+    The effects of a block read the snapshot of the block after it.
+*/
+class FxPipeline {
+public:
+    //! the two stages, both may run on any thread of the pool
+    class Stages {
+    public:
+        virtual ~Stages() {}
+        //! \brief the voices of the block, added to the first numSamples of the buffer
+        virtual void renderVoices(AudioSampleBuffer& buffer, int numSamples) = 0;
+        //! \brief the effects, in place on the first numSamples of the buffer
+        virtual void processEffects(AudioSampleBuffer& buffer, int numSamples) = 0;
+    };
+
+    FxPipeline();
+    ~FxPipeline();
+
+    //! takes a reference to the shared workers and allocates the buffers, not on the audio thread
+    /*!
+    @param numChannels number of output channels
+    @param maxBlockSize most samples of a block, the latency
+    @param blockSeconds duration of a block of the host, the period of the real-time scheduling of the workers
+    */
+    void prepare(int numChannels, int maxBlockSize, double blockSeconds);
+
+    //! lets go of the shared workers and the buffers, the pipeline is inactive afterwards
+    void release();
+
+    //! \brief prepared, processBlock renders through process()
+    bool isActive() const { return latency > 0; }
+
+    //! \brief samples the output falls behind the voices, 0 if inactive
+    int getLatency() const { return latency; }
+
+    //! \brief drops the voices and the processed samples in flight, the fifo holds its silence again
+    void reset();
+
+    //! \brief renders the voices of the block into the buffer and leaves the processed output of getLatency() samples before there
+    /*! The first numSamples of the buffer must be silent. A block longer than getLatency() is
+        rendered straight through, without the overlap, and the output steps.
+    */
+    void process(AudioSampleBuffer& buffer, int numSamples, Stages& stages);
+
+    //! \brief voices or processed samples in flight are not silent
+    bool hasPendingSignal(float threshold) const;
+
+    //! \brief bytes of the buffers
+    int64 getMemoryBytes() const {
+        return static_cast<int64>(dry.getNumChannels()) * (dry.getNumSamples() + wet.getNumSamples()) * static_cast<int64>(sizeof(float));
+    }
+
+private:
+    //! job of the batch: 0 renders the voices, 1 the effects of the block before
+    static void runStage(void* context, int job);
+
+    ScopedPointer<SharedResourcePointer<RealtimeThreadPool>> threadPool;
+    AudioSampleBuffer dry;  //!< the voices of the last block, waiting for the effects
+    int numDry;
+    AudioSampleBuffer wet;  //!< fifo of the processed samples, the oldest first
+    int numWet;
+    int latency;
+
+    //! \name state of the current process call
+    ///@{
+    Stages* currentStages;
+    AudioSampleBuffer* currentBuffer;
+    int currentNumSamples;
+    ///@}
+
+    JUCE_DECLARE_NON_COPYABLE(FxPipeline)
+};
+
+#endif  // FXPIPELINE_H_INCLUDED
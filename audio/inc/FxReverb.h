@@ -0,0 +1,68 @@
+/*
+  ==============================================================================
+
+    FxReverb.h
+    Created: 15 Oct 2026 5:02:44am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef FXREVERB_H_INCLUDED
+#define FXREVERB_H_INCLUDED
+
+#include "SynthParams.h"
+#include "FxBuffer.h"
+#include "FxSlot.h"
+#include <array>
+
+//! FxReverb Class: feedback delay network reverb
+/*! Eight delay lines of mutually prime lengths feed back into each other through a Householder
+    matrix, which mixes all lines with one sum per sample. Every line loses decay dB over its
+    length and is damped by a one pole lowpass. The lines share a power of two ring length and
+    a write position, the reads are masked. The lines are at least a segment long, so every
+    segment first reads all lines and then writes the feedback in whole blocks.
+*/
+class FxReverb : public FxSlot
+{
+public:
+    FxReverb(SynthParams &p)
+        : params(p)
+        , lines(nullptr)
+        , sampleRate(44100.f)
+        , channels(0)
+        , writePosition(0)
+        , ringMask(0)
+    {}
+    ~FxReverb();
+
+    void prepare(int channelsIn, double sampleRateIn) override;
+    void process(AudioSampleBuffer& outputBuffer, int startSample, int numSamples) override;
+
+    //! clears the delay lines and the damping
+    void reset() override;
+    //! the decay time and the longest line
+    int getTailSamples() const override;
+    int64 getMemoryBytes() const override;
+    bool isActive() const override { return params.reverbActivation.getStep() == eOnOffToggle::eOn; }
+
+    static const int numLines = 8;
+
+private:
+    //! longest segment, the line outputs of a segment are kept on the stack
+    static const int maxSegmentLength = 256;
+
+    //! \brief line lengths in samples for the size, limited to the ring
+    int getLineLength(int line, float size) const;
+
+    SynthParams &params;
+    FxBuffer buffer;                    //!< one channel per line, allocated when the reverb is first switched on
+    AudioSampleBuffer* lines;           //!< the buffer while a block is rendered
+    std::array<float, numLines> dampState;  //!< lowpass state of every line
+    float sampleRate;
+    int channels;
+    int writePosition;                  //!< ring index of the next feedback sample, the same for all lines
+    int ringMask;                       //!< ring length - 1
+};
+
+#endif  // FXREVERB_H_INCLUDED
@@ -0,0 +1,44 @@
+/*
+  ==============================================================================
+
+    FxSlot.h
+    Created: 15 Oct 2026 4:31:52am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef FXSLOT_H_INCLUDED
+#define FXSLOT_H_INCLUDED
+
+#include "JuceHeader.h"
+
+//! FxSlot: interface of an effect in the FxChain
+/*! An effect processes the block in place, the chain hands every slot the same buffer.
+    prepare() and reset() are called while the audio thread does not render, process() only
+    for an active slot. getTailSamples() may be called from any thread, it reads the params.
+*/
+class FxSlot {
+public:
+    virtual ~FxSlot() {}
+
+    //! \brief sets up the state for the amount of channels and the sample rate
+    virtual void prepare(int numChannels, double sampleRate) = 0;
+
+    //! \brief processes numSamples of the buffer from startSample in place
+    virtual void process(AudioSampleBuffer& buffer, int startSample, int numSamples) = 0;
+
+    //! \brief clears the state, the next block starts from silence
+    virtual void reset() = 0;
+
+    //! \brief samples the effect still sounds after its input went silent
+    virtual int getTailSamples() const = 0;
+
+    //! \brief whether the effect is switched on, the chain skips inactive slots
+    virtual bool isActive() const = 0;
+
+    //! \brief bytes of the state and the buffers the effect allocated, see MemoryFootprint
+    virtual int64 getMemoryBytes() const { return 0; }
+};
+
+#endif  // FXSLOT_H_INCLUDED
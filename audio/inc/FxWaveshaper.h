@@ -0,0 +1,74 @@
+/*
+  ==============================================================================
+
+    FxWaveshaper.h
+    Created: 16 Oct 2026 9:12:40am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef FXWAVESHAPER_H_INCLUDED
+#define FXWAVESHAPER_H_INCLUDED
+
+#include "SynthParams.h"
+#include "FxSlot.h"
+#include "Oversampler.h"
+#include <vector>
+
+//! FxWaveshaper Class: saturation through a curve of eShaperCurve
+/*! The drive scales the input into a curve of DspTables, which was sampled once for the whole
+    process, so a sample costs a table read and a linear interpolation instead of a tanh or a
+    sine. A segment is shaped in two passes: the table positions and fractions are computed for
+    the whole segment, then the table is read and interpolated, only the read is scalar.
+    With oversampling the curve runs at twice the rate between the half-band filters of
+    Oversampler, which moves most of the aliasing of the curve above the band and delays the
+    output by getLatency() samples. The asymmetric curve adds a dc offset, a one pole highpass
+    at 10 Hz behind it takes it out again.
+*/
+class FxWaveshaper : public FxSlot
+{
+public:
+    FxWaveshaper(SynthParams &p);
+    ~FxWaveshaper();
+
+    void prepare(int channelsIn, double sampleRateIn) override;
+    void process(AudioSampleBuffer& outputBuffer, int startSample, int numSamples) override;
+
+    //! clears the oversampling filters and the dc blocker
+    void reset() override;
+    //! the half-band filters of the oversampling
+    int getTailSamples() const override;
+    int64 getMemoryBytes() const override;
+    bool isActive() const override { return params.shaperActivation.getStep() == eOnOffToggle::eOn; }
+
+    //! \brief delay of the output in samples with oversampling, 0 without
+    static int getLatency(bool oversampling) {
+        return oversampling ? roundToInt(HalfbandInterpolator::getLatency() / 2.f + HalfbandDecimator::getLatency()) : 0;
+    }
+
+private:
+    //! longest segment at the sample rate, the oversampled segment is kept on the stack
+    static const int maxSegmentLength = 256;
+
+    //! state of one channel
+    struct Channel {
+        Channel() : dcX1(0.f), dcY1(0.f) {}
+        HalfbandInterpolator up;
+        HalfbandDecimator down;
+        float dcX1, dcY1;   //!< last input and output of the dc blocker
+    };
+
+    //! \brief drives the samples into the curve, in place
+    static void shape(const float* table, float* samples, float drive, int n);
+
+    //! \brief removes the dc offset of the asymmetric curve, in place
+    void blockDc(Channel& ch, float* samples, int n) const;
+
+    SynthParams &params;
+    std::vector<Channel> state;     //!< per channel
+    float dcCoeff;                  //!< pole of the dc blocker
+    bool wasOversampling;           //!< of the last block, a change clears the filters
+};
+
+#endif  // FXWAVESHAPER_H_INCLUDED
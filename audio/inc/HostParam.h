@@ -5,10 +5,62 @@
 #include "JuceHeader.h"
 #include "Param.h"
 
+//! HostNotifier: hands the changes of the ui to the host once per frame, for all instances of the process
+/*! A drag moves a knob many times between two frames, the host only learns of the last value.
+    The timer runs while a change is pending. Message thread only.
+*/
+class HostNotifier : private Timer {
+public:
+    class Client {
+    public:
+        virtual ~Client() {}
+        //! \brief tells the host the current value
+        virtual void notifyHost() = 0;
+    };
+
+    ~HostNotifier() { stopTimer(); }
+
+    //! \brief the client notifies the host at the next frame, once however often it changed until then
+    void add(Client* c) {
+        pending.addIfNotAlreadyThere(c);
+        if (!isTimerRunning()) {
+            startTimerHz(frameRate);
+        }
+    }
+    void remove(Client* c) { pending.removeFirstMatchingValue(c); }
+    //! \brief notifies the host now if the client is pending, e.g. at the end of a gesture
+    void flush(Client* c) {
+        if (pending.contains(c)) {
+            pending.removeFirstMatchingValue(c);
+            c->notifyHost();
+        }
+    }
+
+    static const int frameRate = 60;
+
+private:
+    void timerCallback() override {
+        Array<Client*> due;
+        due.swapWith(pending);
+        for (Client* c : due) {
+            c->notifyHost();
+        }
+        if (pending.size() == 0) {
+            stopTimer();
+        }
+    }
+
+    Array<Client*> pending;
+};
+
+//! the param as the host sees it
+/*! The changes of the ui reach the host through the HostNotifier, a drag of the ui is one change
+    gesture of the host from its start to its end, a single change like a click is a gesture of its own.
+*/
 template<typename _par>
-class HostParam : public AudioProcessorParameter, public Param::Listener {
+class HostParam : public AudioProcessorParameter, public Param::Listener, private HostNotifier::Client {
 public:
-    HostParam(_par &p) : param(p) {
+    HostParam(_par &p) : param(p), notifyingHost(false), inGesture(false), gestureOpen(false) {
         param.addListener(this);
     }
 
@@ -26,6 +78,7 @@ public:
          * managedParameters is private.
          */
         //param.removeListener(this);
+        notifier->remove(this);
     }
 
     float getValue() const override {
@@ -34,6 +87,10 @@ public:
 
     void setValue(float newValue) override {
         jassert(newValue >= 0.f && newValue <= 1.f);
+        // a change of the ui is already set and queued, see paramUIChanged()
+        if (notifyingHost) {
+            return;
+        }
         param.setHost(hostToEngine(newValue));
     }
 
@@ -63,8 +120,19 @@ public:
     }
 
     virtual void paramUIChanged() override {
-        // this will (unnecessarily) call setValue
-        setValueNotifyingHost(engineToHost(param.getUI()));
+        notifier->add(this);
+    }
+
+    virtual void paramGestureChanged(bool starting) override {
+        inGesture = starting;
+        if (!starting) {
+            // the last value of the drag belongs into the gesture
+            notifier->flush(this);
+            if (gestureOpen) {
+                endChangeGesture();
+                gestureOpen = false;
+            }
+        }
     }
 
 protected:
@@ -82,6 +150,27 @@ protected:
     }
 
     _par &param;
+    bool notifyingHost;     //!< only accessed on the message thread while the ui notifies the host
+
+private:
+    void notifyHost() override {
+        if (!gestureOpen) {
+            beginChangeGesture();
+            gestureOpen = true;
+        }
+        // this calls setValue, which must not queue the change a second time as one of the host
+        notifyingHost = true;
+        setValueNotifyingHost(engineToHost(param.getUI()));
+        notifyingHost = false;
+        if (!inGesture) {
+            endChangeGesture();
+            gestureOpen = false;
+        }
+    }
+
+    SharedResourcePointer<HostNotifier> notifier;
+    bool inGesture;         //!< the ui drags the param
+    bool gestureOpen;       //!< the host was told of the start of a gesture, not of its end yet
 };
 
 template<typename _par>
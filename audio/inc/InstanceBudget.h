@@ -0,0 +1,85 @@
+/*
+  ==============================================================================
+
+    InstanceBudget.h
+    Created: 16 Oct 2026 10:31:44pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef INSTANCEBUDGET_H_INCLUDED
+#define INSTANCEBUDGET_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <array>
+#include <atomic>
+
+//! InstanceBudget: the voices and the render load of every instance in the process, for a common budget
+/*! The cpu voice limit of an instance only sees its own blocks, forty instances at a third of
+    their deadline each look fine to themselves while the host misses its own. Held with a
+    SharedResourcePointer, every instance owns a slot from its constructor on and publishes its
+    peak-hold load, its active and releasing voices and the rms of its output at the end of a
+    realtime block. The process is over budget when the active voices of all instances exceed
+    maxVoices or their loads add up to more than highLoad of the cores. Then the instance with
+    the quietest output among those with a releasing voice gives one up per block, see
+    shouldYield(), so the voices go where they are heard least. Every instance decides for itself
+    on its own audio thread from the same slots, nothing locks and no thread runs for the budget.
+    A slot that has not been updated for staleMs, of a suspended or offline instance, does not count.
+*/
+class InstanceBudget {
+public:
+    InstanceBudget();
+
+    //! \brief a free slot for an instance, message thread, -1 if all maxInstances are taken
+    int acquire();
+    //! \brief gives the slot back, message thread
+    void release(int slot);
+
+    //! \brief audio thread: what the instance played in its last block
+    void report(int slot, float load, int activeVoices, int releasingVoices, float rms);
+    //! \brief audio thread: the instance leaves the budget, e.g. while offline or without cpu voice limit
+    void withdraw(int slot);
+
+    //! \brief audio thread: true if the process is over budget and this instance should steal a releasing voice
+    bool shouldYield(int slot) const;
+
+    //! \name process totals, any thread
+    ///@{
+    int getNumInstances() const;
+    int getTotalVoices() const;
+    //! \brief sum of the loads of the instances divided by the cores
+    float getTotalLoad() const;
+    //! \brief voices given up to the budget since the start of the process
+    int64 getNumYielded() const { return numYielded.load(std::memory_order_relaxed); }
+    void countYield() { numYielded.fetch_add(1, std::memory_order_relaxed); }
+    ///@}
+
+    static const int maxInstances = 256;
+    static const int maxVoices = 512;       //!< active voices of all instances together
+    constexpr static float highLoad = .75f; //!< of all cores, the host and the other plugins need the rest
+    static const uint32 staleMs = 500;
+
+private:
+    struct Slot {
+        std::atomic<bool> used;
+        std::atomic<bool> reporting;
+        std::atomic<float> load;
+        std::atomic<int> activeVoices;
+        std::atomic<int> releasingVoices;
+        std::atomic<float> rms;
+        std::atomic<uint32> updated;    //!< Time::getMillisecondCounter() of the last report
+    };
+
+    //! \brief a reporting slot that is not stale
+    bool isCounted(const Slot& s, uint32 now) const;
+
+    std::array<Slot, maxInstances> slots;
+    std::atomic<int> numSlots;          //!< slots up to the highest one ever acquired
+    std::atomic<int64> numYielded;
+    const float cores;
+
+    JUCE_DECLARE_NON_COPYABLE(InstanceBudget)
+};
+
+#endif  // INSTANCEBUDGET_H_INCLUDED
@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    Instrument.h
+    Created: 15 Oct 2026 9:40:05am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef INSTRUMENT_H_INCLUDED
+#define INSTRUMENT_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "Trace.h"
+#include <atomic>
+
+//! build with SYNISTER_INSTRUMENT=1 or 2 for scoped timers and event counters in the dsp code
+/*! Level 1 keeps the coarse points, spans once per block and counters of rare events like note
+    starts, level 2 adds the fine ones inside the voices and effects. A timer is a span of the
+    trace (see Trace.h), so without SYNISTER_TRACE it is empty as well. A counter sums its events
+    of a block: endBlock() records the sums as counters of the trace, and keeps them for the
+    deadline log (see DeadlineMonitor). The counters are static per call site, instances of the
+    plugin in one process share them. Level 0, the default without trace, compiles every macro
+    to nothing, a trace build defaults to level 2.
+*/
+#ifndef SYNISTER_INSTRUMENT
+ #if SYNISTER_TRACE
+  #define SYNISTER_INSTRUMENT 2
+ #else
+  #define SYNISTER_INSTRUMENT 0
+ #endif
+#endif
+
+namespace Instrument {
+    static const int maxCounters = 32;
+
+#if SYNISTER_INSTRUMENT
+    //! number of events of one call site, registered when the call site is first reached
+    class Counter {
+    public:
+        //! \brief the name must be a literal
+        explicit Counter(const char* n);
+
+        void add(int64 n) { value.fetch_add(n, std::memory_order_relaxed); }
+
+        const char* const name;
+        std::atomic<int64> value;   //!< of the running block
+        int64 lastBlock;            //!< sum of the previous block, audio thread
+    };
+
+    //! \brief audio thread, at the end of a block: takes the sums of the block and adds them to the trace
+    void endBlock();
+    //! \brief the counters that counted anything in the last block, returns how many were written
+    int getBlockCounters(const char** names, int64* values, int maxValues);
+#else
+    inline void endBlock() {}
+    inline int getBlockCounters(const char**, int64*, int) { return 0; }
+#endif
+}
+
+#if SYNISTER_INSTRUMENT
+ #define SYNISTER_INSTRUMENT_COUNT(name, n) \
+    do { static Instrument::Counter instrumentCounter(name); instrumentCounter.add(n); } while (false)
+#endif
+
+//! \name the rest of the scope as a span, coarse and fine
+///@{
+#if SYNISTER_INSTRUMENT >= 1
+ #define SYNISTER_SCOPE(name) SYNISTER_TRACE_SPAN(name)
+#else
+ #define SYNISTER_SCOPE(name)
+#endif
+#if SYNISTER_INSTRUMENT >= 2
+ #define SYNISTER_SCOPE_FINE(name) SYNISTER_TRACE_SPAN(name)
+#else
+ #define SYNISTER_SCOPE_FINE(name)
+#endif
+///@}
+
+//! \name adds n events of the name to the block, coarse and fine
+///@{
+#if SYNISTER_INSTRUMENT >= 1
+ #define SYNISTER_COUNT(name, n) SYNISTER_INSTRUMENT_COUNT(name, n)
+#else
+ #define SYNISTER_COUNT(name, n)
+#endif
+#if SYNISTER_INSTRUMENT >= 2
+ #define SYNISTER_COUNT_FINE(name, n) SYNISTER_INSTRUMENT_COUNT(name, n)
+#else
+ #define SYNISTER_COUNT_FINE(name, n)
+#endif
+///@}
+
+#endif  // INSTRUMENT_H_INCLUDED
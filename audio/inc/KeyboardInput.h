@@ -0,0 +1,73 @@
+/*
+  ==============================================================================
+
+    KeyboardInput.h
+    Created: 15 Oct 2026 6:48:05am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef KEYBOARDINPUT_H_INCLUDED
+#define KEYBOARDINPUT_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "MidiEventList.h"
+#include <array>
+#include <atomic>
+
+//! KeyboardInput: notes between the on-screen keyboard and the audio thread without the lock of MidiKeyboardState
+/*! The MidiKeyboardState of the editor is only used on the message thread. The notes played on
+    it are queued lock free for the audio thread, which adds them to the midi of the next block.
+    The audio thread in turn marks the notes of the incoming midi in an atomic bitmap, which the
+    message thread shows on the keyboard. Neither thread ever waits for the other.
+*/
+class KeyboardInput : private MidiKeyboardStateListener {
+public:
+    explicit KeyboardInput(MidiKeyboardState& state);
+    ~KeyboardInput();
+
+    //! \brief audio thread: marks the notes of midi and generated and adds the queued notes of the keyboard to generated at startSample
+    void processNextMidiBuffer(const MidiBuffer& midi, MidiEventList& generated, int startSample, int numSamples);
+
+    //! \brief audio thread: notes of the keyboard wait for processNextMidiBuffer()
+    bool hasQueuedNotes() const { return fifo.getNumReady() > 0; }
+
+    //! \brief message thread: shows the notes the audio thread received on the keyboard
+    void updateKeyboard();
+
+    //! \brief any thread: true while the midi the audio thread received holds the note
+    bool isNoteOn(int note) const;
+
+private:
+    //! \brief audio thread: marks a note on, note off or all notes off
+    void markNote(const MidiMessage& m);
+    void handleNoteOn(MidiKeyboardState*, int midiChannel, int midiNoteNumber, float velocity) override;
+    void handleNoteOff(MidiKeyboardState*, int midiChannel, int midiNoteNumber, float velocity) override;
+
+    //! a note of the keyboard, message thread -> audio thread
+    struct KeyEvent {
+        uint8 channel;
+        uint8 note;
+        uint8 velocity;     //!< 0 for a note off
+    };
+
+    MidiKeyboardState& state;
+
+    static const int queueSize = 256;
+    AbstractFifo fifo;
+    std::array<KeyEvent, queueSize> queue;
+
+    //! \name incoming notes, written by the audio thread
+    ///@{
+    std::array<std::atomic<uint32>, 4> notesOn;
+    void setNote(int note, bool on);
+    ///@}
+
+    std::array<uint32, 4> shownNotes;   //!< message thread: the notes of notesOn shown on the keyboard
+    bool showingNotes;                  //!< message thread: in updateKeyboard(), the listener does not queue them
+
+    JUCE_DECLARE_NON_COPYABLE(KeyboardInput)
+};
+
+#endif  // KEYBOARDINPUT_H_INCLUDED
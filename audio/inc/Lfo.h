@@ -0,0 +1,118 @@
+/*
+  ==============================================================================
+
+    Lfo.h
+    Created: 15 Oct 2026 1:58:20am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef LFO_H_INCLUDED
+#define LFO_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "SynthParams.h"
+#include "Oscillator.h"
+
+//! Lfo: the waveforms of one lfo and its block, owned by a voice or, in global mode, by the synth
+struct Lfo {
+    Lfo()
+    {
+        reset();
+    }
+    SineOscillator sine;
+    Oscillator<&Waveforms::square> square;
+    RandomOscillator<&Waveforms::square> random;
+    AudioSampleBuffer audioBuffer;
+    
+    void reset() {
+        sine.reset();
+        square.reset();
+        random.reset();
+    }
+
+    //! \brief phase increment of the waveforms for the rate or the synced note length of the params
+    void setPhaseDelta(const ParamSnapshot::Lfo& p) {
+        sine.phaseDelta = p.phaseDelta;
+        square.phaseDelta = p.phaseDelta;
+        random.phaseDelta = p.phaseDelta;
+    }
+
+    //! \brief a block of the selected waveform into out
+    void render(eLfoWaves wave, float *out, float freqMod, int numSamples) {
+        switch (wave) {
+            case eLfoWaves::eLfoSine:
+                sine.render(out, freqMod, numSamples);
+                break;
+            case eLfoWaves::eLfoSampleHold:
+                random.render(out, freqMod, numSamples);
+                break;
+            case eLfoWaves::eLfoSquare:
+                square.render(out, freqMod, numSamples);
+                break;
+            default:
+                FloatVectorOperations::clear(out, numSamples);
+                break;
+        }
+    }
+
+    //! \brief a block of a voice: the waveform of the params, then its gain and the fade-in of the note
+    /*! \param elapsed samples of the note before the block
+        \param fadeInSamples length of the fade-in, 0 for none
+    */
+    void render(const ParamSnapshot::Lfo& p, float *out, float freqMod, float gain, int elapsed, int fadeInSamples, int numSamples) {
+        render(p.wave, out, freqMod, numSamples);
+        applyGain(out, gain, elapsed, fadeInSamples, numSamples);
+    }
+
+    //! \brief scales a block by the gain, the samples inside the fade-in by a linear ramp up to the gain
+    static void applyGain(float *out, float gain, int elapsed, int fadeInSamples, int numSamples) {
+        const int numFade = jlimit(0, numSamples, fadeInSamples - elapsed);
+        if (numFade > 0) {
+            // the ramp continues where the last block stopped, no division per sample
+            const float step = gain / static_cast<float>(fadeInSamples);
+            const float start = step * static_cast<float>(elapsed);
+            for (int s = 0; s < numFade; ++s) {
+                out[s] *= start + step * static_cast<float>(s);
+            }
+        }
+        if (gain != 1.f) {
+            FloatVectorOperations::multiply(out + numFade, gain, numSamples - numFade);
+        }
+    }
+
+    //! \brief moves the phase of the selected waveform on by a block without rendering it, for an lfo nothing reads
+    /*! The lfo stays where render() would have left it, up to rounding, so it continues in time
+        once a route reads it again. The sine picks up the new phase with a sync.
+    */
+    void advance(eLfoWaves wave, float freqMod, int numSamples) {
+        switch (wave) {
+            case eLfoWaves::eLfoSine:
+                sine.phase = wrap(sine.phase + sine.phaseDelta * freqMod * static_cast<float>(numSamples));
+                break;
+            case eLfoWaves::eLfoSampleHold: {
+                const float p = random.phase + random.phaseDelta * freqMod * static_cast<float>(numSamples);
+                // a new value per period, as often as next() would have picked one
+                for (int c = static_cast<int>(p); c > 0; --c) {
+                    random.newHeldValue();
+                }
+                random.phase = wrap(p);
+                break;
+            }
+            case eLfoWaves::eLfoSquare:
+                square.phase = wrap(square.phase + square.phaseDelta * freqMod * static_cast<float>(numSamples));
+                break;
+            default:
+                break;
+        }
+    }
+
+private:
+    //! non-negative phase back to [0..1)
+    static float wrap(float p) {
+        return p - static_cast<float>(static_cast<int>(p));
+    }
+};
+
+#endif  // LFO_H_INCLUDED
@@ -12,33 +12,62 @@
 #define LOWFIDELITY_H_INCLUDED
 
 #include "SynthParams.h"
+#include "FxSlot.h"
+#include <vector>
 
 //! LowFidelity Class: Low fidelity effects
 
 /*! The low fidelity effects deteriorate the quality of the signal.
+    The sample rate reduction holds every value for lowFiDownsample samples, the bit
+    reduction quantises the result. Both work on whole channels.
 */
-class LowFidelity
+class LowFidelity : public FxSlot
 {
 public:
     //! LowFidelity constructor.
     LowFidelity(SynthParams& p)
         : params(p)
+        , holdPhase(0.f)
     {}
 
     //! LowFidelity destructor.
     ~LowFidelity();
 
+    //! sets up the held values of the sample rate reduction for the amount of channels
+    void prepare(int numChannels, double sampleRate) override;
+
+    //! applies the sample rate reduction and then the bit reduction to the block
+    void process(AudioSampleBuffer& buffer, int startSample, int numSamples) override;
+
+    void reset() override;
+    int getTailSamples() const override { return 0; }
+    bool isActive() const override { return params.lowFiActivation.getStep() == eOnOffToggle::eOn; }
+
     //! Bit reduction
     /*!
     A sample is usually coded with 16 bits.
     The bit degradation enables reducing this value (1 bit per sample minimum)
-    1 parameters:
+    3 parameters:
     @params AudioSampleBuffer - instance of the AudioSampleBuffer is an output buffer, which must be the buffer where the voices had been processed and added.
+    @params int - the first sample
+    @params int - the amount of samples
+    */
+    void bitReduction(AudioSampleBuffer&, int, int);
+
+    //! Sample rate reduction
+    /*!
+    Sample and hold: a new input value is taken every lowFiDownsample samples, fractional
+    factors alternate between the neighbouring hold lengths. A factor of 1 does nothing.
+    @param outputBuffer the buffer where the voices had been processed and added
+    @param startSample the first sample
+    @param numSamples the amount of samples
     */
-    void bitReduction(AudioSampleBuffer&);
+    void sampleRateReduction(AudioSampleBuffer& outputBuffer, int startSample, int numSamples);
 
 protected:
     SynthParams &params; //!< local params reference
+    std::vector<float> heldValues; //!< value held by each channel
+    float holdPhase; //!< samples left until the next value is taken, the same for all channels
 
 };
 
@@ -0,0 +1,83 @@
+/*
+  ==============================================================================
+
+    MasterLimiter.h
+    Created: 16 Oct 2026 9:52:18pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef MASTERLIMITER_H_INCLUDED
+#define MASTERLIMITER_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <vector>
+
+//! MasterLimiter: brickwall limiter with lookahead behind the master output
+/*! The gain a sample needs to stay below the ceiling is held over the lookahead by a sliding
+    window minimum, a monotonic deque that costs amortised O(1) per sample whatever the length
+    of the window. The held gain releases exponentially and is averaged over the lookahead
+    again, so the gain ramps down linearly in the lookahead ahead of a peak and reaches the gain
+    of the peak no later than the peak itself. The channels are delayed by the lookahead, which
+    the processor reports as latency while the limiter is on, and share one gain, so the stereo
+    image does not move.
+*/
+class MasterLimiter {
+public:
+    MasterLimiter()
+        : lookahead(1)
+        , releaseCoeff(0.f)
+        , pos(0)
+        , sampleCount(0)
+        , heldGain(1.f)
+        , historyPos(0)
+        , gainSum(0.)
+        , head(0)
+        , size(0)
+    {}
+
+    //! \brief allocates the delay and the windows, must not be called from the audio thread
+    void prepare(int numChannels, double sampleRate);
+    //! \brief silence in the delay, no gain reduction
+    void reset();
+
+    //! \brief limits the buffer to the linear ceiling, delayed by getLatency()
+    void process(AudioSampleBuffer& buffer, float ceiling);
+
+    //! \brief samples of the lookahead at the rate of prepare()
+    int getLatency() const { return lookahead; }
+    //! \brief bytes of the delay and the windows
+    int64 getMemoryBytes() const;
+
+    constexpr static double lookaheadTime = .0015; //!< s
+    constexpr static double releaseTime = .1;      //!< s to get 63% of the way back to no reduction
+
+private:
+    //! an entry of the sliding window minimum
+    struct Held {
+        float gain;
+        int64 expires;  //!< first sample the entry is out of the window
+    };
+
+    int lookahead;
+    float releaseCoeff;
+    AudioSampleBuffer delay;        //!< lookahead samples of every channel
+    int pos;                        //!< of the delay and the gain window
+    int64 sampleCount;
+
+    //! \name gain
+    ///@{
+    std::vector<Held> window;       //!< ring of the monotonic deque, increasing gains from head
+    float heldGain;                 //!< the window minimum after the release
+    std::vector<float> gainHistory; //!< the last lookahead + 1 held gains, for their average
+    int historyPos;
+    double gainSum;
+    int head;
+    int size;
+    ///@}
+
+    JUCE_DECLARE_NON_COPYABLE(MasterLimiter)
+};
+
+#endif  // MASTERLIMITER_H_INCLUDED
@@ -0,0 +1,83 @@
+/*
+  ==============================================================================
+
+    MasterOutput.h
+    Created: 15 Oct 2026 5:40:18am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef MASTEROUTPUT_H_INCLUDED
+#define MASTEROUTPUT_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <array>
+#include <atomic>
+#include <vector>
+
+//! MasterOutput: master volume and constant power pan of the output, with optional metering
+/*! Gain and pan are combined into one gain per channel, which ramps linearly to a new value
+    over smoothingTime, so automation does not step at the block boundaries. Every channel is
+    scaled and, if metering is enabled, metered in a single pass.
+*/
+class MasterOutput {
+public:
+    MasterOutput()
+        : rampSamples(1)
+        , meteringEnabled(false)
+    {
+        for (int c = 0; c < numMeters; ++c) {
+            peak[c].store(0.f);
+            rms[c].store(0.f);
+        }
+    }
+
+    //! \brief sets up a state for every channel, the gains start at the first target without a ramp
+    void prepare(int numChannels, double sampleRate);
+
+    //! \brief applies the gain and the pan to the buffer
+    /*!
+    @param buffer the output block
+    @param gain linear master volume
+    @param pan master pan in [-1..1], only applied to a stereo buffer
+    */
+    void process(AudioSampleBuffer& buffer, float gain, float pan);
+
+    //! \brief metering costs a comparison and a multiply add per sample, off until a meter asks for it
+    void setMeteringEnabled(bool enabled) { meteringEnabled.store(enabled); }
+
+    //! \brief peak of the last block of channel 0 or 1, any thread
+    float getPeak(int channel) const { return peak[channel].load(std::memory_order_relaxed); }
+    //! \brief rms of the last block of channel 0 or 1, any thread
+    float getRms(int channel) const { return rms[channel].load(std::memory_order_relaxed); }
+
+    //! time in s a gain takes to reach a new value
+    constexpr static float smoothingTime = .02f;
+    //! metered channels
+    static const int numMeters = 2;
+
+private:
+    //! gain ramp of one channel
+    struct ChannelState {
+        ChannelState() : gain(0.f), target(0.f), step(0.f), remaining(-1) {}
+        float gain;     //!< gain of the next sample
+        float target;   //!< gain at the end of the ramp
+        float step;     //!< gain change per sample of the ramp
+        int remaining;  //!< samples left of the ramp, -1 before the first block
+    };
+
+    //! \brief one pass over a channel: scale and optionally measure
+    template<bool _meter>
+    static void applyGain(float* io, int numSamples, ChannelState& state, float& peakOut, float& sumSquares);
+
+    std::vector<ChannelState> channelState;
+    int rampSamples;
+    std::atomic<bool> meteringEnabled;
+    std::array<std::atomic<float>, numMeters> peak;
+    std::array<std::atomic<float>, numMeters> rms;
+
+    JUCE_DECLARE_NON_COPYABLE(MasterOutput)
+};
+
+#endif  // MASTEROUTPUT_H_INCLUDED
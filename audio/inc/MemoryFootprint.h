@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    MemoryFootprint.h
+    Created: 15 Oct 2026 6:48:30pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef MEMORYFOOTPRINT_H_INCLUDED
+#define MEMORYFOOTPRINT_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <array>
+
+//! MemoryFootprint: the bytes one instance allocates and the ones all instances of the process share
+/*! Counts the buffers and objects of the engine, not the heap overhead or the code. The buffers
+    of the effects only count once they are allocated, so a closed effect shows as 0. The mapped
+    samples are file pages, the system only keeps the ones that are read resident.
+*/
+struct MemoryFootprint {
+    enum eInstance {
+        eVoicePool = 0,     //!< the voice objects
+        eVoiceBuffers,      //!< the scratch arena of the voices and the global lfo blocks
+        eDelay,
+        eChorus,
+        eReverb,
+        eOtherFx,           //!< lofi, clipping, waveshaper and the fx chain
+        eParams,            //!< params, snapshot and host params
+        eNoteCache,         //!< the takes of the NoteCache and the recording of the SeqFreeze
+        eEngine,            //!< voice bank, filter bank, worker scratch and the engine resampler
+        nInstance
+    };
+
+    enum eShared {
+        eWavetables = 0,
+        eDspTables,
+        eSamples,           //!< mapped sample files
+        eEditorCaches,      //!< knob and text images of all editors, filled in by the editor
+        nShared
+    };
+
+    std::array<int64, nInstance> instance {};
+    std::array<int64, nShared> shared {};
+
+    int64 getInstanceTotal() const {
+        int64 total = 0;
+        for (int64 bytes : instance) {
+            total += bytes;
+        }
+        return total;
+    }
+
+    static const char* getName(eInstance i) {
+        static const char* const names[] = {
+            "voice pool", "voice buffers", "delay", "chorus", "reverb", "other fx", "params", "note cache", "engine"
+        };
+        return names[i];
+    }
+
+    static const char* getName(eShared s) {
+        static const char* const names[] = { "wavetables", "dsp tables", "samples", "editor caches" };
+        return names[s];
+    }
+
+    //! the instance that reports its footprint, see Telemetry::getMemoryFootprint()
+    class Source {
+    public:
+        virtual ~Source() {}
+        //! \brief fills everything but the editor caches, message thread
+        virtual void fillMemoryFootprint(MemoryFootprint& m) const = 0;
+    };
+};
+
+#endif  // MEMORYFOOTPRINT_H_INCLUDED
@@ -0,0 +1,73 @@
+/*
+  ==============================================================================
+
+    MidiClock.h
+    Created: 17 Oct 2026 7:26:44pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef MIDICLOCK_H_INCLUDED
+#define MIDICLOCK_H_INCLUDED
+
+#include "JuceHeader.h"
+
+//! MidiClock: the transport of external gear that sends midi clock, start, stop and song position
+/*! The clock ticks arrive 24 per quarter note at the sample positions of their midi events,
+    late by whatever the cable, the driver and the block quantisation add. A second order
+    phase locked loop follows them: it predicts the sample of the next tick, and the error of
+    every tick moves the prediction by a part and the tick period by a smaller part, so the
+    tempo and the position it reports move smoothly and jitter of single ticks averages out.
+    The loop locks after a quarter note of ticks and lets go when the ticks have stopped for a
+    while. Start plays from the position 0, continue from the last song position, the first
+    tick after either is the position itself. Audio thread only.
+*/
+class MidiClock {
+public:
+    MidiClock();
+
+    //! \brief forgets the clock, for the sample rate of the host blocks
+    void prepare(double sampleRate);
+
+    //! \brief follows the clock messages of a block of numSamples at the host rate
+    void process(const MidiBuffer& midiMessages, int numSamples);
+
+    //! \brief the ticks keep arriving, fillPosition() gives a transport
+    bool isLocked() const { return locked; }
+
+    //! \brief tempo, position at the start of the last processed block and play state of the clock
+    void fillPosition(AudioPlayHead::CurrentPositionInfo& info) const;
+
+    static const int ticksPerBeat = 24;
+    static const int ticksPerSongPosition = 6;  //!< a song position counts sixteenth notes
+    static const int lockTicks = ticksPerBeat;  //!< ticks in a row before the loop is trusted
+    static const int timeoutTicks = 8;          //!< periods without a tick before the clock is lost
+
+private:
+    //! \brief a tick at the sample, in samples since prepare()
+    void tick(int64 time);
+    void lose();
+
+    //! \name loop gains per tick, a natural frequency of 1% of the tick rate, critically damped
+    ///@{
+    static const double phaseGain;
+    static const double periodGain;
+    ///@}
+
+    double sampleRate;
+    int64 blockStart;       //!< samples since prepare() at the start of the current block
+    int64 lastBlockStart;   //!< of the block fillPosition() reports
+
+    double period;          //!< filtered samples per tick, 0 before two ticks arrived
+    double nextTick;        //!< predicted sample of the next tick
+    int64 lastArrival;      //!< -1 before the first tick
+    int ticksInRow;
+    bool locked;
+
+    bool running;           //!< between start or continue and stop
+    int64 songPosition;     //!< tick of the first tick after start or continue
+    int64 ticksPlayed;      //!< ticks since start or continue
+};
+
+#endif  // MIDICLOCK_H_INCLUDED
@@ -0,0 +1,109 @@
+/*
+  ==============================================================================
+
+    MidiEventList.h
+    Created: 17 Oct 2026 8:52:13pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef MIDIEVENTLIST_H_INCLUDED
+#define MIDIEVENTLIST_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <array>
+
+//! MidiEventList: the midi the engine generates in a block, in storage of a fixed size
+/*! The step sequencer and the on-screen keyboard add their short messages here instead of to
+    the MidiBuffer of the host, which grows its storage on the audio thread. The events are kept
+    in time order, an event goes behind the ones of the same sample. mergeInto() puts them
+    together with the midi of the host into a buffer whose storage was reserved in
+    prepareToPlay. An event beyond the capacity is dropped and counted.
+*/
+class MidiEventList {
+public:
+    static const int capacity = 256;
+    //! bytes an event takes in a MidiBuffer: position, size and 3 bytes of data
+    static const int bytesPerEvent = 9;
+
+    MidiEventList() : numEvents(0), numDropped(0) {}
+
+    //! \brief adds a message of up to 3 bytes at the sample, false if it was dropped
+    bool addEvent(const MidiMessage& m, int sample) {
+        const int size = m.getRawDataSize();
+        if (numEvents == capacity || size > 3) {
+            ++numDropped;
+            return false;
+        }
+        int i = numEvents++;
+        for (; i > 0 && events[static_cast<size_t>(i - 1)].sample > sample; --i) {
+            events[static_cast<size_t>(i)] = events[static_cast<size_t>(i - 1)];
+        }
+        Event& e = events[static_cast<size_t>(i)];
+        e.sample = sample;
+        e.size = static_cast<uint8>(size);
+        for (int b = 0; b < size; ++b) {
+            e.data[b] = m.getRawData()[b];
+        }
+        return true;
+    }
+
+    void clear() { numEvents = 0; }
+    bool isEmpty() const { return numEvents == 0; }
+    int size() const { return numEvents; }
+
+    //! \brief the raw bytes of the i-th event and its sample
+    const uint8* getEvent(int i, int& eventSize, int& sample) const {
+        const Event& e = events[static_cast<size_t>(i)];
+        eventSize = e.size;
+        sample = e.sample;
+        return e.data;
+    }
+
+    //! \brief events dropped since the start, the capacity was too small for them
+    int getNumDropped() const { return numDropped; }
+
+    //! \brief the midi of the block: the host midi as it is if the list is empty, otherwise both merged into merged
+    /*! The events of the host go before the ones of the list at the same sample. No allocation
+        as long as merged has room for both.
+    */
+    MidiBuffer& mergeInto(MidiBuffer& host, MidiBuffer& merged) const {
+        if (numEvents == 0) {
+            return host;
+        }
+        merged.clear();
+        MidiBuffer::Iterator it(host);
+        const uint8* data;
+        int size;
+        int pos;
+        int i = 0;
+        while (it.getNextEvent(data, size, pos)) {
+            for (; i < numEvents && events[static_cast<size_t>(i)].sample < pos; ++i) {
+                const Event& e = events[static_cast<size_t>(i)];
+                merged.addEvent(e.data, e.size, e.sample);
+            }
+            merged.addEvent(data, size, pos);
+        }
+        for (; i < numEvents; ++i) {
+            const Event& e = events[static_cast<size_t>(i)];
+            merged.addEvent(e.data, e.size, e.sample);
+        }
+        return merged;
+    }
+
+private:
+    struct Event {
+        int sample;
+        uint8 size;
+        uint8 data[3];
+    };
+
+    std::array<Event, capacity> events;
+    int numEvents;
+    int numDropped;
+
+    JUCE_DECLARE_NON_COPYABLE(MidiEventList)
+};
+
+#endif  // MIDIEVENTLIST_H_INCLUDED
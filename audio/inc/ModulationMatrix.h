@@ -13,7 +13,9 @@ Author:  nj
 
 #include "JuceHeader.h"
 #include "Param.h"
+#include "Instrument.h"
 #include <map>
+#include <array>
 
 //! Enumeration of all mod sources
 enum eModSource : int {
@@ -39,6 +41,11 @@ enum eModSource : int {
     eEnv2,
     eEnv3,
 
+    // per note expression, see SynthParams::mpeMode
+    eNotePitch,
+    eNotePressure,
+    eNoteTimbre,
+
     nSteps
 };
 
@@ -127,11 +134,32 @@ The transformation function that returns a bipolar value, transformed from the r
 */
 static float toBipolar(float min, float max, float value) { return (2.0f*(value - min) / max - min) - 1.0f; }
 
+//! mapping for mod sources that change within a block.
+/*!
+The lfos and envelopes are rendered into blocks, all other sources (midi) are a single value per block.
+@param source the source to be mapped
+@returns true if the source provides one value per sample
+*/
+static inline bool isBlockSource(eModSource source) {
+    switch (source) {
+    case eModSource::eLFO1:
+    case eModSource::eLFO2:
+    case eModSource::eLFO3:
+    case eModSource::eVolEnv:
+    case eModSource::eEnv2:
+    case eModSource::eEnv3:
+        return true;
+    default:
+        return false;
+    }
+}
+
 //! Modulation Matrix Class
 /*! This fixed size mod matrix is based on the book "Designing Software Synthesizer Plug-Ins in C++".
-It contains a row for each possible modulation source setting in the GUI, together with its amount and the name of its corresponding Combobox.
-Within the synister synthesizer, it is maintained and instanced in the SynthParams as a global modulation matrix. Its doModulationsMatrix method
-that applies the modulation is called from the Voice for each sample.
+It contains a row for each possible modulation source setting in the GUI, together with its amount, a row is identified by the id
+addModMatrixRow() returned. Within the synister synthesizer, it is maintained and instanced in the SynthParams as a global modulation
+matrix. The list of active routes is only rebuilt when the source of a row differs from the one it was compiled with, once per block
+the intensities of the active routes are refreshed and the Voice then applies them to whole blocks or at its control points.
 */
 class ModulationMatrix {
 public:
@@ -146,14 +174,14 @@ public:
         ParamStepped<eModSource>* modSrc; //!< mod source enum/index
         destinations destinationIndex; //!< mod destination enum/index
         Param* modIntensity; //!< pointer to mod intensity param
-        String modSrcBox; //!< mod source box name
+        eModSource compiledSource; //!< source of the last routing, only accessed by compile()
 
         //! ModMatrixRow constructor.
-        ModMatrixRow(ParamStepped<eModSource> *s, destinations d, Param *intensity, String boxname)
+        ModMatrixRow(ParamStepped<eModSource> *s, destinations d, Param *intensity)
             : modSrc(s)
             , destinationIndex(d)
             , modIntensity(intensity)
-            , modSrcBox(boxname)
+            , compiledSource(eModSource::eNone)
         {}
     };
 
@@ -165,14 +193,36 @@ public:
     */
     inline bool modMatrixRowExists(eModSource sourceIndex, destinations destinationIndex) const;
 
-    //! Changes the source of a destination that belongs to a specific combobox.
+    //! Finds the row of a source param.
+    /*!
+    Called once when a combobox is bound to its param, every row has its own source param.
+    @param sourceParam the source param of the row
+    @returns the id of the row, -1 if the param has none
+    */
+    inline int findRow(const ParamStepped<eModSource> *sourceParam) const;
+
+    //! Changes the source of a row.
     /*!
-    Method that is called when the user selects a new source in a combobox. This combobox belongs to a
-    row in the matrix, which is then updated.
-    @param comboBoxName name of the combobox the information comes from
+    Method that is called when the user selects a new source in a combobox, before the step of the
+    source param is changed. The routing is rebuilt by the next compile().
+    @param rowId the id of the row, see findRow()
     @param source the source to be changed to
     */
-    inline void changeSource(const String &comboBoxName, eModSource source);
+    inline void changeSource(int rowId, eModSource source);
+
+    //! \brief rows with a source, the ones the compiled routes evaluate
+    int countActiveRows() const {
+        int n = 0;
+        for (const ModMatrixRow& row : matrixCore) {
+            n += row.modSrc->getStep() != eModSource::eNone ? 1 : 0;
+        }
+        return n;
+    }
+
+    //! \brief the mod amount of a row, changeSource() converts it, nullptr for an invalid id
+    Param* getIntensity(int rowId) const {
+        return rowId >= 0 && rowId < static_cast<int>(matrixCore.size()) ? matrixCore[static_cast<size_t>(rowId)].modIntensity : nullptr;
+    }
 
     //! Adds a row to the modulation matrix.
     /*!
@@ -180,9 +230,9 @@ public:
     @param s the initial source
     @oaram d the destination
     @param intensity the initial intensity value
-    @param comboboxName the name of the combobox the row belongs to
+    @returns the id of the row
     */
-    inline void addModMatrixRow(ParamStepped<eModSource> *s, destinations d, Param *intensity, String comboboxName);
+    inline int addModMatrixRow(ParamStepped<eModSource> *s, destinations d, Param *intensity);
 
     //! Applies the modulation for a sample.
     /*!
@@ -192,9 +242,62 @@ public:
     */
     inline void doModulationsMatrix(const float** src, float** dst) const;
 
+    //! Compiles the rows into the list of active routes.
+    /*!
+    Called once per block on the audio thread before the voices are rendered. Rows without a source
+    are dropped, the list is only rebuilt if a source differs from the compiled one, whether it was
+    changed by the ui, the host or a patch. The intensities of the active routes are transformed for
+    the polarity of their source every time, so applying the matrix only has to multiply and add.
+    */
+    inline void compile();
+
+    //! Applies the compiled routes for a sample, same interface as doModulationsMatrix().
+    inline void doCompiledModulations(const float** src, float** dst) const;
+
+    //! Applies the compiled routes to whole blocks.
+    /*!
+    @param src the pointers to the source blocks, or to the single value of sources that are constant for the block (see isBlockSource())
+    @param dst the pointers to the destination blocks the results are added to
+    @param numSamples the number of samples in the blocks
+    */
+    inline void doCompiledModulationsBlock(const float** src, float** dst, int numSamples) const;
+
+    //! number of active routes after the last compile()
+    int getNumCompiledRoutes() const { return numCompiledRoutes; }
+
+    //! true if one of the routes of the last compile() modulates the destination
+    bool hasCompiledRoute(destinations destination) const {
+        return destination > DEST_NONE && (targetedDestinations & (1u << destination)) != 0;
+    }
+
+    //! true if one of the routes of the last compile() reads the source
+    bool isSourceUsed(eModSource source) const {
+        return (usedSources & (1u << static_cast<int>(source))) != 0;
+    }
+
 
 private:
+    //! one active source -> destination connection with its transformed intensity
+    struct CompiledRoute
+    {
+        eModSource source;
+        destinations destination;
+        float intensity;
+        bool blockSource;
+        const Param* intensityParam;
+    };
+
+    //! rebuilds the list of active routes from the sources the rows were compiled with
+    inline void compileRouting();
+
+    //! upper bound for the rows added in the PluginAudioProcessor constructor
+    static const int maxRoutes = 64;
+
     std::vector<ModMatrixRow> matrixCore; //!< matrix core that keeps all the rows of the matrix in a vector
+    std::array<CompiledRoute, maxRoutes> compiledRoutes; //!< active routes, written by compile()
+    int numCompiledRoutes;
+    uint32 usedSources;             //!< bit per eModSource read by the compiled routes
+    uint32 targetedDestinations;    //!< bit per destination written by the compiled routes
 };
 
 inline void ModulationMatrix::doModulationsMatrix(const float** src, float** dst) const
@@ -228,6 +331,81 @@ inline void ModulationMatrix::doModulationsMatrix(const float** src, float** dst
     }
 }
 
+inline void ModulationMatrix::compile()
+{
+    bool routingChanged = false;
+    for (ModMatrixRow &row : matrixCore)
+    {
+        const eModSource source = row.modSrc->getStep();
+        if (source != row.compiledSource) {
+            row.compiledSource = source;
+            routingChanged = true;
+        }
+    }
+    if (routingChanged) {
+        compileRouting();
+    }
+
+    for (int r = 0; r < numCompiledRoutes; ++r)
+    {
+        CompiledRoute &route = compiledRoutes[r];
+        const float min = route.intensityParam->getMin();
+        const float max = route.intensityParam->getMax();
+        route.intensity = isUnipolar(route.source)
+            ? toBipolar(min, max, route.intensityParam->get())
+            : toUnipolar(min, max, route.intensityParam->get());
+    }
+    SYNISTER_COUNT("mod routes", numCompiledRoutes);
+}
+
+inline void ModulationMatrix::compileRouting()
+{
+    numCompiledRoutes = 0;
+    usedSources = 0;
+    targetedDestinations = 0;
+    for (const ModMatrixRow &row : matrixCore)
+    {
+        const eModSource source = row.compiledSource;
+        if (source > eModSource::eNone && source < eModSource::nSteps
+            && row.destinationIndex > DEST_NONE && row.destinationIndex < MAX_DESTINATIONS
+            && numCompiledRoutes < maxRoutes) {
+
+            CompiledRoute &route = compiledRoutes[numCompiledRoutes++];
+            route.source = source;
+            route.destination = row.destinationIndex;
+            route.intensity = 0.f;
+            route.blockSource = isBlockSource(source);
+            route.intensityParam = row.modIntensity;
+            usedSources |= 1u << static_cast<int>(source);
+            targetedDestinations |= 1u << row.destinationIndex;
+        }
+    }
+}
+
+inline void ModulationMatrix::doCompiledModulations(const float** src, float** dst) const
+{
+    for (int r = 0; r < numCompiledRoutes; ++r)
+    {
+        const CompiledRoute &route = compiledRoutes[r];
+        *(dst[route.destination]) += *(src[route.source]) * route.intensity;
+    }
+}
+
+inline void ModulationMatrix::doCompiledModulationsBlock(const float** src, float** dst, int numSamples) const
+{
+    SYNISTER_SCOPE_FINE("mod matrix");
+    for (int r = 0; r < numCompiledRoutes; ++r)
+    {
+        const CompiledRoute &route = compiledRoutes[r];
+        if (route.blockSource) {
+            FloatVectorOperations::addWithMultiply(dst[route.destination], src[route.source], route.intensity, numSamples);
+        }
+        else {
+            FloatVectorOperations::add(dst[route.destination], *(src[route.source]) * route.intensity, numSamples);
+        }
+    }
+}
+
 // config changes
 inline bool ModulationMatrix::modMatrixRowExists(eModSource sourceIndex, destinations destinationIndex) const
 {
@@ -242,54 +420,64 @@ inline bool ModulationMatrix::modMatrixRowExists(eModSource sourceIndex, destina
     return false;
 }
 
-inline void ModulationMatrix::changeSource(const String &comboBoxName, eModSource source) {
-    for (ModMatrixRow &row : matrixCore)
+inline int ModulationMatrix::findRow(const ParamStepped<eModSource> *sourceParam) const
+{
+    for (size_t r = 0; r < matrixCore.size(); ++r)
     {
-        // find matching source/destination pairs
-        if (row.modSrcBox == comboBoxName)
+        if (matrixCore[r].modSrc == sourceParam)
         {
-            // before we change the old source, we gotta check whether it is a switch between unipolar<->bipolar (for conversion reasons)
-            eModSource oldSource = row.modSrc->getStep();
-            Param* modAmountParam = row.modIntensity;
-            float newModAmountValue;
+            return static_cast<int>(r);
+        }
+    }
+    return -1;
+}
 
-            // derived from the initial values, eNone should be considered as "unipolar" here since the  initial modAmount is set to a value fit for unipolar sources
-            bool newSourcePolarity = (source == eNone) ? true : isUnipolar(source);
-            bool oldSourcePolarity = (oldSource == eNone) ? true : isUnipolar(oldSource);
+inline void ModulationMatrix::changeSource(int rowId, eModSource source) {
+    if (rowId >= 0 && rowId < static_cast<int>(matrixCore.size()))
+    {
+        ModMatrixRow &row = matrixCore[static_cast<size_t>(rowId)];
+        // before we change the old source, we gotta check whether it is a switch between unipolar<->bipolar (for conversion reasons)
+        eModSource oldSource = row.modSrc->getStep();
+        Param* modAmountParam = row.modIntensity;
+        float newModAmountValue;
 
-            if (newSourcePolarity < oldSourcePolarity) {
-                // uni- to bipolar source -> mod amount [-x, x] to [0, x]
-                newModAmountValue = modAmountParam->getUI();
+        // derived from the initial values, eNone should be considered as "unipolar" here since the  initial modAmount is set to a value fit for unipolar sources
+        bool newSourcePolarity = (source == eNone) ? true : isUnipolar(source);
+        bool oldSourcePolarity = (oldSource == eNone) ? true : isUnipolar(oldSource);
 
-                // find the middle
-                float middle = (modAmountParam->getMax() + modAmountParam->getMin()) / 2.f;
+        if (newSourcePolarity < oldSourcePolarity) {
+            // uni- to bipolar source -> mod amount [-x, x] to [0, x]
+            newModAmountValue = modAmountParam->getUI();
 
-                // get the absolute value if it's negative
-                if (modAmountParam->getUI() < middle) newModAmountValue = modAmountParam->getUI() + 2.f * (middle - modAmountParam->getUI());
+            // find the middle
+            float middle = (modAmountParam->getMax() + modAmountParam->getMin()) / 2.f;
 
-                // transform
-                newModAmountValue = (newModAmountValue - middle) * 2.f;
-                modAmountParam->setHost(newModAmountValue);
-            }
-            else if (newSourcePolarity > oldSourcePolarity) {
-                // bi- to unipolar source -> mod amount [0, x] to [-x, x]
+            // get the absolute value if it's negative
+            if (modAmountParam->getUI() < middle) newModAmountValue = modAmountParam->getUI() + 2.f * (middle - modAmountParam->getUI());
 
-                // find the middle
-                float middle = (modAmountParam->getMax() + modAmountParam->getMin()) / 2.f;
+            // transform
+            newModAmountValue = (newModAmountValue - middle) * 2.f;
+            modAmountParam->setHost(newModAmountValue);
+        }
+        else if (newSourcePolarity > oldSourcePolarity) {
+            // bi- to unipolar source -> mod amount [0, x] to [-x, x]
 
-                // transform
-                newModAmountValue = middle + (modAmountParam->getUI() / 2.f);
-                modAmountParam->setHost(newModAmountValue);
-            }
-            
-            // the new source is already set, since it's a Param*
+            // find the middle
+            float middle = (modAmountParam->getMax() + modAmountParam->getMin()) / 2.f;
+
+            // transform
+            newModAmountValue = middle + (modAmountParam->getUI() / 2.f);
+            modAmountParam->setHost(newModAmountValue);
         }
+        
+        // the new source is set by the caller, the routing follows in the next compile()
     }
 }
 
-inline void ModulationMatrix::addModMatrixRow(ParamStepped<eModSource> *s, destinations d, Param *intensity, String boxname)
+inline int ModulationMatrix::addModMatrixRow(ParamStepped<eModSource> *s, destinations d, Param *intensity)
 {
-    matrixCore.push_back(ModMatrixRow(s, d, intensity, boxname));
+    matrixCore.push_back(ModMatrixRow(s, d, intensity));
+    return static_cast<int>(matrixCore.size()) - 1;
 }
 
 #endif  // MODULATIONMATRIX_H_INCLUDED
@@ -0,0 +1,125 @@
+/*
+  ==============================================================================
+
+    NoteCache.h
+    Created: 15 Oct 2026 4:12:37pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef NOTECACHE_H_INCLUDED
+#define NOTECACHE_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "SynthParams.h"
+#include <atomic>
+
+//! PatchState: what the voices play besides their notes, compared block by block
+/*! The caches of rendered audio, NoteCache and SeqFreeze, drop it when anything changed. */
+class PatchState {
+public:
+    PatchState() { lastSamples.fill(nullptr); }
+
+    //! \brief allocates the state, the first hasChanged() matches no block, not on the audio thread
+    void prepare(const SynthParams& params);
+    //! \brief true if the values of the params, of the snapshot or the samples differ from the last call
+    bool hasChanged(const SynthParams& params);
+
+    //! \brief true if a source that changes from one block to the next reaches the voices: a midi controller, per note expression or a global lfo
+    static bool hasLiveModulation(const SynthParams& params);
+
+private:
+    HeapBlock<char> lastSnapshot;       //!< bytes of the ParamSnapshot
+    std::vector<float> lastValues;      //!< of SynthParams::serializeParams
+    std::array<const MappedSample*, 3> lastSamples;
+};
+
+//! NoteCache: rendered notes of a patch without live modulation, played again instead of rendered
+/*! A patch qualifies if nothing but the note and the velocity reaches its voices: no midi
+    controller or per note expression is read and no global lfo, whose phase runs freely. The
+    voices seed their noise by the note, so every hit of the same note and velocity sounds the
+    same up to its note off. A hit is recorded into a take of the pool, with the sample of its note
+    off. A later hit plays the take held longest and moves on to another take where the hold of
+    its take ends or its own note off comes; if none matches, the voice renders the note from its
+    start without output and goes on from there. A changed param, snapshot or sample drops all takes.
+*/
+class NoteCache {
+public:
+    //! one recorded note
+    struct Take {
+        int note;
+        int velocity;       //!< midi velocity, -1 if the patch does not read it
+        int length;         //!< samples recorded so far
+        int release;        //!< sample of the note off, -1 while the recorded note is held
+        bool complete;      //!< the note has ended, the take can be played
+        std::atomic<int> users; //!< voices recording or playing the take, released on the voice workers as well
+        uint32 lastUse;     //!< for the replacement of the least recently used take
+        AudioSampleBuffer audio;
+    };
+
+    NoteCache();
+
+    //! \brief allocates the takes, not on the audio thread
+    void prepare(const SynthParams& params, int numChannels, double sampleRate);
+    //! \brief frees the takes, the cache stays inactive until the next prepare()
+    void release();
+
+    //! \brief checks whether the patch qualifies and drops the takes if anything changed, audio thread, before the voices of a block
+    void update(const SynthParams& params);
+
+    //! \brief the patch qualifies and the takes are allocated, the notes play from takes
+    bool isActive() const { return active; }
+
+    //! \brief the take of a note
+    /*! \param play set to true for a complete take that can be played, the one with the latest note
+               off, false for a take to record into
+        \return nullptr if all takes are in use, the note is rendered without cache
+    */
+    Take* acquire(int note, float velocity, bool& play);
+    //! \brief a take to record a note into that left its take, see acquireNext(), nullptr if all are in use
+    Take* acquireRecording(int note, float velocity);
+    //! \brief the complete take a played note moves on to at position, it sounds like the played one up to there
+    /*! \param released the note off of the note is at position, otherwise the note is held past it
+        \return nullptr if no take goes on like the note
+    */
+    Take* acquireNext(const Take* played, int position, bool released);
+    //! \brief a voice is done with the take, a recording is kept if it is complete and nothing changed while it ran
+    /*! Safe on the voice workers, a take has only one recording voice and is played once it is complete. */
+    void releaseTake(Take* take, bool complete);
+
+    //! \brief maximum length of a take in samples
+    int getCapacity() const { return capacity; }
+
+    //! \brief bytes of the takes, 0 while the cache is released
+    int64 getMemoryBytes() const {
+        int64 bytes = 0;
+        for (const Take* take : takes) {
+            bytes += static_cast<int64>(sizeof(Take)) + take->audio.getNumChannels() * static_cast<int64>(capacity) * static_cast<int64>(sizeof(float));
+        }
+        return bytes;
+    }
+
+    //! number of takes in the pool
+    static const int numTakes = 16;
+    //! s of a take, longer notes are not cached
+    constexpr static double maxSeconds = 1.;
+
+private:
+    //! \brief the least recently used take for a recording, nullptr if all are in use
+    Take* record(int note, int key);
+    //! \brief no take matches a note any more, the ones in use are dropped when they are released
+    void invalidate();
+
+    OwnedArray<Take> takes;
+    int capacity;
+    uint32 useCounter;
+    bool active;
+    bool readsVelocity;     //!< the velocity is a key of the takes
+
+    PatchState lastState;   //!< of the last update()
+
+    JUCE_DECLARE_NON_COPYABLE(NoteCache)
+};
+
+#endif  // NOTECACHE_H_INCLUDED
@@ -0,0 +1,121 @@
+/*
+  ==============================================================================
+
+    NoteLatency.h
+    Created: 16 Oct 2026 7:35:12pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef NOTELATENCY_H_INCLUDED
+#define NOTELATENCY_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <array>
+#include <atomic>
+
+class Voice;
+
+//! build with SYNISTER_NOTE_LATENCY=1 to measure the time from every note-on to its first sound
+/*! For a note-on the block records the offset of the midi event, the audio thread time since
+    the start of the callback at which a voice started it and the end of the first voice chunk
+    after which the volume envelope of the voice is above audibleLevel, plus the latency of the
+    output behind the voices. The latency of a note is the distance from its event to that end,
+    so it is measured at the resolution of the voice chunks. The notes are aggregated into the
+    mean, the extremes and the standard deviation, the jitter, and read by the ui or a tool.
+    Together with the timestamps of the live midi input of the standalone this is the way from
+    a key to the output. Without the flag the synth does not call it.
+*/
+#ifndef SYNISTER_NOTE_LATENCY
+ #define SYNISTER_NOTE_LATENCY 0
+#endif
+
+class NoteLatency {
+public:
+    NoteLatency();
+
+    constexpr static float audibleLevel = .001f;    //!< of the volume envelope, -60 dB
+    static const int maxPendingNotes = 64;          //!< note-ons of a block that are matched to their voices
+    static const int maxTrackedNotes = 64;          //!< started notes that are not audible yet
+
+    //! aggregated notes since the last resetReport()
+    struct Report {
+        int64 numNotes;             //!< that became audible
+        int64 numSilent;            //!< stopped or stolen before that, or beyond maxTrackedNotes
+        double meanMs;              //!< from the midi event to the first audible chunk at the output
+        double minMs;
+        double maxMs;
+        double jitterMs;            //!< standard deviation of the latency
+        double meanStartMs;         //!< audio thread time from the start of the callback to the start of the voice
+        double maxStartMs;
+        double meanEventOffset;     //!< samples of the events into their blocks
+    };
+
+    //! \name audio thread
+    ///@{
+    //! \brief the rate of the positions, drops the notes in flight
+    void prepare(double newSampleRate);
+    //! \brief the note-ons of the block and their offsets, once the midi of the block is complete
+    void beginBlock(const MidiBuffer& midi, int numSamples, int64 callbackStartTicks, int outputLatencySamples);
+    //! \brief a voice started a note at the position in the block the voices are rendered to
+    void noteStarted(Voice* voice, int midiChannel, int midiNoteNumber);
+    //! \brief the voices are rendered up to endSample of the block, checks the notes in flight
+    void voicesRendered(int endSample);
+    //! \brief the voices are done with the block
+    void endBlock();
+    ///@}
+
+    //! \brief any thread
+    Report getReport() const;
+    //! \brief any thread, the counts start at zero with the next block
+    void resetReport() { resetRequested = true; }
+    //! \brief the report as lines of text
+    static String formatReport(const Report& r);
+
+private:
+    struct PendingNote {
+        int channel;
+        int note;
+        int offset;
+    };
+    struct TrackedNote {
+        Voice* voice;
+        int note;
+        int64 eventPosition;    //!< samples since prepare()
+    };
+
+    //! \brief a note is audible
+    void addNote(double latencyMs);
+
+    double sampleRate;
+    int64 blockPosition;        //!< samples since prepare() at the start of the block
+    int64 blockStartTicks;
+    int blockSize;
+    int renderPosition;         //!< of the block, the voices are rendered up to here
+    int outputLatency;
+
+    std::array<PendingNote, maxPendingNotes> pending;
+    int numPending;
+    std::array<TrackedNote, maxTrackedNotes> tracked;
+    int numTracked;
+
+    //! \name report, written by the audio thread
+    ///@{
+    std::atomic<int64> numNotes;
+    std::atomic<int64> numSilent;
+    std::atomic<double> sumMs;
+    std::atomic<double> sumSquaresMs;
+    std::atomic<double> minMs;
+    std::atomic<double> maxMs;
+    std::atomic<int64> numStarts;
+    std::atomic<double> sumStartMs;
+    std::atomic<double> maxStartMs;
+    std::atomic<double> sumEventOffset;
+    std::atomic<bool> resetRequested;
+    ///@}
+
+    JUCE_DECLARE_NON_COPYABLE(NoteLatency)
+};
+
+#endif  // NOTELATENCY_H_INCLUDED
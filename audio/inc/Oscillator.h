@@ -13,8 +13,14 @@
 
 #include "Synthparams.h"
 #include "Param.h"
+#include "FastRandom.h"
 
 
+//! Oscillator Class: phase accumulator driving a waveform function
+/*! The phase is normalised to one period [0..1) and phaseDelta is given in periods per
+    sample, so the wrap is a single subtraction instead of a fmod on radians and the
+    precision does not depend on how long the note has been playing.
+*/
 template<float(*_waveform)(float, float, float)>
 class Oscillator {
 public:
@@ -40,33 +46,79 @@ public:
 
     float next() {
         const float result = _waveform(phase, trngAmount, width);
-        phase = std::fmod(phase + phaseDelta, float_Pi * 2.0f);
+        phase = advance(phase, phaseDelta);
         return result;
     }
 
     float next(float pitchMod) {
         const float result = _waveform(phase, trngAmount, width);
-        phase = std::fmod(phase + phaseDelta*pitchMod, float_Pi * 2.0f);
+        phase = advance(phase, phaseDelta*pitchMod);
         return result;
     }
 
     float next(float pitchMod, float widthOrTrDelta) {
         const float result = _waveform(phase, trngAmount + widthOrTrDelta, width + widthOrTrDelta);
-        phase = std::fmod(phase + phaseDelta*pitchMod, float_Pi * 2.0f);
+        phase = advance(phase, phaseDelta*pitchMod);
+        return result;
+    }
+
+    //! same as next(pitchMod, widthOrTrDelta) with a waveform that also gets the phase increment, i.e. a band-limited one
+    template<float(*_bandLimitedWaveform)(float, float, float, float)>
+    float nextBandLimited(float pitchMod, float widthOrTrDelta) {
+        const float increment = phaseDelta*pitchMod;
+        const float result = _bandLimitedWaveform(phase, trngAmount + widthOrTrDelta, width + widthOrTrDelta, increment);
+        phase = advance(phase, increment);
         return result;
     }
+
+    //! \brief renders n samples with a pitch modulation factor per sample
+    /*! The loop carries only the phase from one sample to the next, which keeps it free of
+        calls and lets the compiler vectorize the waveform evaluation.
+    */
+    void render(float *out, const float *pitchMod, int n) {
+        float phs = phase;
+        for (int s = 0; s < n; ++s) {
+            out[s] = _waveform(phs, trngAmount, width);
+            phs = advance(phs, phaseDelta*pitchMod[s]);
+        }
+        phase = phs;
+    }
+
+    //! \brief renders n samples with the same pitch modulation factor
+    void render(float *out, float pitchMod, int n) {
+        const float increment = phaseDelta*pitchMod;
+        float phs = phase;
+        for (int s = 0; s < n; ++s) {
+            out[s] = _waveform(phs, trngAmount, width);
+            phs = advance(phs, increment);
+        }
+        phase = phs;
+    }
+
+    //! \brief advances the phase like render() over samples whose pitch modulation factors sum to pitchSum, without output
+    void skip(float pitchSum) {
+        phase = advance(phase, phaseDelta*pitchSum);
+    }
+
+protected:
+    //! adds a non-negative increment to a phase in [0..1) and wraps the result back to [0..1)
+    static float advance(float phs, float increment) {
+        const float p = phs + increment;
+        return p - static_cast<float>(static_cast<int>(p));
+    }
 };
 
 
+//! Waveforms: the waveform functions, phs is the phase normalised to one period [0..1)
 struct Waveforms {
     static float sinus(float phs, float trngAmount, float width) {
         ignoreUnused(trngAmount, width);
-        return std::sin(phs);
+        return FastMath::sin2Pi(phs);
     }
     static float square(float phs, float trngAmount, float width) {
         ignoreUnused(trngAmount, width);
         //square wave with duty cycle
-        if (phs < 2.f * float_Pi * width) {
+        if (phs < width) {
             return 1.f;
         }
         else {
@@ -77,12 +129,297 @@ struct Waveforms {
     static float saw(float phs, float trngAmount, float width) {
         ignoreUnused(width);
         //return (1 - trngAmount) * phs / (float_Pi*2.f) - .5f + trngAmount * (-abs(float_Pi - phs))*(1 / float_Pi) + .5f;
-        if (phs < trngAmount*float_Pi) { return (1.f - 2.f / (trngAmount*float_Pi) * phs); }
-        else { return (-1.f + 2.f / (2.f*float_Pi - trngAmount*float_Pi) * (phs - trngAmount*float_Pi)); }
+        const float corner = .5f * trngAmount; // end of the falling segment
+        if (phs < corner) { return (1.f - 2.f / corner * phs); }
+        else { return (-1.f + 2.f / (1.f - corner) * (phs - corner)); }
+    }
+
+    //! \name band-limited waveforms
+    /*! PolyBLEP / PolyBLAMP versions of square and saw. The naive waveform is corrected with a
+        two sample polynomial residual around every jump (BLEP) and every corner (BLAMP), which
+        removes most of the aliasing for a few operations per sample.
+        @param phaseIncrement phase increment of the current sample in periods
+    */
+    ///@{
+    static float squareBandLimited(float phs, float trngAmount, float width, float phaseIncrement) {
+        const float dt = phaseIncrement;
+        if (dt <= 0.f) {
+            return square(phs, trngAmount, width);
+        }
+        const float t = phs;
+
+        // rising edge at 0, falling edge at width, both of height 2
+        return square(phs, trngAmount, width) + 2.f * polyBlep(t, dt) - 2.f * polyBlep(wrap(t - width), dt);
+    }
+    static float sawBandLimited(float phs, float trngAmount, float width, float phaseIncrement) {
+        const float dt = phaseIncrement;
+        if (dt <= 0.f) {
+            return saw(phs, trngAmount, width);
+        }
+        const float t = phs;
+        const float corner = .5f * trngAmount; // end of the falling segment
+
+        if (corner <= dt) {
+            // the falling segment is shorter than a sample, treat it as the jump of a plain saw
+            return saw(phs, 0.f, width) - 2.f * polyBlep(t, dt);
+        }
+
+        // slope changes at 0 (rising -> falling) and at the corner (falling -> rising)
+        const float fallingSlope = -2.f / corner;
+        const float risingSlope = 2.f / (1.f - corner);
+        return saw(phs, trngAmount, width) + (fallingSlope - risingSlope) * polyBlamp(t, dt)
+                                           + (risingSlope - fallingSlope) * polyBlamp(wrap(t - corner), dt);
+    }
+    ///@}
+
+    //! residual of a unit step at t = 0, t and dt are normalised to one period
+    static float polyBlep(float t, float dt) {
+        if (t < dt) {
+            const float x = 1.f - t / dt;
+            return -.5f * x * x;
+        }
+        else if (t > 1.f - dt) {
+            const float x = (t - 1.f) / dt + 1.f;
+            return .5f * x * x;
+        }
+        return 0.f;
+    }
+
+    //! residual of a unit slope change at t = 0, the integral of polyBlep()
+    static float polyBlamp(float t, float dt) {
+        if (t < dt) {
+            const float x = 1.f - t / dt;
+            return dt * x * x * x / 6.f;
+        }
+        else if (t > 1.f - dt) {
+            const float x = (t - 1.f) / dt + 1.f;
+            return dt * x * x * x / 6.f;
+        }
+        return 0.f;
+    }
+
+    //! wraps a normalised phase to [0..1)
+    static float wrap(float t) {
+        return t - std::floor(t);
+    }
+};
+
+
+//! UnisonOscillator Class: detuned copies of a square or saw rendered together
+/*! The copies are the lanes of one loop over the samples. They share the pitch and shape
+    modulation of the oscillator and only differ in their phase and their detune ratio, so the
+    compiler vectorises the lane loop like the one of the VoiceBank, and the band limiting runs
+    with the increment of every copy. The copies are spread evenly over the detune range, the
+    outer ones are mixed at the spread level and the sum keeps the power of a single copy.
+*/
+class UnisonOscillator {
+public:
+    static const int maxCopies = 8;
+
+    UnisonOscillator()
+        : numCopies(0)
+        , activeLanes(0)
+        , detune(0.f)
+        , spread(0.f)
+    {
+        for (int l = 0; l < maxCopies; ++l) {
+            phase[l] = 0.f;
+            ratio[l] = 0.f;
+            gain[l] = 0.f;
+        }
+    }
+
+    //! rief the next setup() starts all copies again, i.e. at the start of a note
+    void reset() {
+        numCopies = 0;
+    }
+
+    //! rief sets the number of copies, the detune range in ct and the level of the outer copies in [0..1]
+    /*! Copies that were not playing start at phases spread over the period, so they never start in phase. */
+    void setup(int copies, float detuneCents, float spreadLevel) {
+        copies = jlimit(1, maxCopies, copies);
+        if (copies == numCopies && detuneCents == detune && spreadLevel == spread) {
+            return;
+        }
+        for (int l = numCopies; l < copies; ++l) {
+            phase[l] = startPhase(l);
+        }
+        numCopies = copies;
+        detune = detuneCents;
+        spread = spreadLevel;
+        activeLanes = (copies + 3) & ~3;
+
+        // the copy at the centre or the two next to it keep the full level
+        float power = 0.f;
+        for (int l = 0; l < maxCopies; ++l) {
+            if (l < copies) {
+                const float position = copies > 1 ? 2.f * static_cast<float>(l) / static_cast<float>(copies - 1) - 1.f : 0.f;
+                ratio[l] = std::pow(2.f, position * .5f * detuneCents / 1200.f);
+                gain[l] = std::abs(position) * static_cast<float>(copies - 1) <= 1.f ? 1.f : spreadLevel;
+            } else {
+                ratio[l] = 0.f;
+                gain[l] = 0.f;
+            }
+            power += gain[l] * gain[l];
+        }
+        const float normalise = 1.f / std::sqrt(power);
+        for (int l = 0; l < copies; ++l) {
+            gain[l] *= normalise;
+        }
+    }
+
+    int getNumCopies() const { return numCopies; }
+
+    //! rief renders n samples, sample s uses the modulation of sample s >> shift
+    /*! \param phaseDelta phase increment of the oscillator, each copy runs at its ratio of it
+        \param shape pulse width or triangle amount, the shape modulation is limited to [shapeMin..shapeMax]
+    */
+    template<float(*_lane)(float, float, float)>
+    void render(float *out, float phaseDelta, float shape, const float *pitchMod, const float *shapeMod,
+                float shapeMin, float shapeMax, int n, int shift) {
+        for (int s = 0; s < n; ++s) {
+            const float increment = phaseDelta * pitchMod[s >> shift];
+            const float currentShape = std::min(std::max(shape + shapeMod[s >> shift], shapeMin), shapeMax);
+
+            // no branches depending on the lane, the lanes past the copies have no gain and stand still
+            float sum = 0.f;
+            for (int l = 0; l < activeLanes; ++l) {
+                const float laneIncrement = increment * ratio[l];
+                sum += gain[l] * _lane(phase[l], currentShape, laneIncrement);
+                const float p = phase[l] + laneIncrement;
+                phase[l] = p - static_cast<float>(static_cast<int>(p));
+            }
+            out[s] = sum;
+        }
+    }
+
+    //! \brief advances the copies like render() over samples whose pitch modulation factors sum to pitchSum, without output
+    void skip(float phaseDelta, float pitchSum) {
+        for (int l = 0; l < numCopies; ++l) {
+            const float p = phase[l] + phaseDelta * pitchSum * ratio[l];
+            phase[l] = p - static_cast<float>(static_cast<int>(p));
+        }
     }
-    static float whiteNoise(float phs, float trngAmount, float width) {
-        ignoreUnused(phs, trngAmount, width);
-        return static_cast <float> (rand()) / (static_cast <float> (RAND_MAX / 2.f)) - 1.f;
+
+    //! \name lane waveforms: phase, shape and phase increment of the sample
+    ///@{
+    static float squareLane(float phs, float shp, float inc) { ignoreUnused(inc); return Waveforms::square(phs, 0.f, shp); }
+    static float sawLane(float phs, float shp, float inc) { ignoreUnused(inc); return Waveforms::saw(phs, shp, 0.f); }
+    static float squareBandLimitedLane(float phs, float shp, float inc) { return Waveforms::squareBandLimited(phs, 0.f, shp, inc); }
+    static float sawBandLimitedLane(float phs, float shp, float inc) { return Waveforms::sawBandLimited(phs, shp, 0.f, inc); }
+    ///@}
+
+private:
+    //! the first copy starts at 0 like a single oscillator, the others by the golden ratio apart
+    static float startPhase(int copy) {
+        const float p = static_cast<float>(copy) * .618034f;
+        return p - static_cast<float>(static_cast<int>(p));
+    }
+
+    float phase[maxCopies];
+    float ratio[maxCopies];     //!< of the phase increment of the oscillator
+    float gain[maxCopies];
+    int numCopies;              //!< 0 after reset()
+    int activeLanes;            //!< copies rounded up to four lanes
+    float detune;               //!< ct between the lowest and the highest copy
+    float spread;               //!< level of the outer copies before the normalisation
+};
+
+
+//! SineOscillator Class: sine from a recursive quadrature oscillator
+/*! Instead of a std::sin per sample, the (cos, sin) pair of the phase is rotated by the
+    phase increment, which costs four multiplications. The pair is taken from the phase
+    again whenever the phase wraps, the increment changes or the phase is set from the
+    outside, so the amplitude cannot drift and phase / phaseDelta behave like in Oscillator.
+*/
+class SineOscillator {
+public:
+    float phase;
+    float phaseDelta;
+
+    SineOscillator() : phase(0.f)
+        , phaseDelta(0.f)
+        , expectedPhase(-1.f)
+        , rotationIncrement(0.f)
+        , re(1.), im(0.), rotRe(1.), rotIm(0.)
+    {}
+
+    void reset() {
+        phase = 0.f;
+        phaseDelta = 0.f;
+        expectedPhase = -1.f;
+    }
+
+    bool isActive() const {
+        return phaseDelta > 0.f;
+    }
+
+    float next() {
+        return next(1.f);
+    }
+
+    float next(float pitchMod) {
+        const float increment = phaseDelta*pitchMod;
+        if (phase != expectedPhase || increment != rotationIncrement) {
+            sync(increment);
+        }
+        const float result = static_cast<float>(im);
+
+        const double nextRe = re * rotRe - im * rotIm;
+        im = re * rotIm + im * rotRe;
+        re = nextRe;
+
+        const float p = phase + increment;
+        phase = p - static_cast<float>(static_cast<int>(p));
+        // renormalise once per period
+        expectedPhase = p < 1.f ? phase : -1.f;
+        return result;
+    }
+
+    //! \brief renders n samples with the same pitch modulation factor
+    void render(float *out, float pitchMod, int n) {
+        for (int s = 0; s < n; ++s) {
+            out[s] = next(pitchMod);
+        }
+    }
+
+private:
+    //! starts the rotation at the current phase with the given increment
+    void sync(float increment) {
+        const double angle = 2. * double_Pi * phase;
+        re = std::cos(angle);
+        im = std::sin(angle);
+        if (increment != rotationIncrement) {
+            rotRe = std::cos(2. * double_Pi * increment);
+            rotIm = std::sin(2. * double_Pi * increment);
+            rotationIncrement = increment;
+        }
+        expectedPhase = phase;
+    }
+
+    float expectedPhase;        //!< phase after the last step, -1 forces a sync
+    float rotationIncrement;    //!< increment the rotation was computed for
+    double re, im;              //!< cos and sin of the current phase
+    double rotRe, rotIm;        //!< cos and sin of the increment
+};
+
+
+//! NoiseOscillator Class: white noise from the voice's own generator
+class NoiseOscillator {
+public:
+    FastRandom random;
+
+    void reset() {}
+
+    float next(float pitchMod) {
+        ignoreUnused(pitchMod);
+        return random.nextFloat();
+    }
+
+    //! \brief renders n samples of noise, the pitch modulation has no effect on white noise
+    void render(float *out, const float *pitchMod, int n) {
+        ignoreUnused(pitchMod);
+        random.fill(out, n);
     }
 };
 
@@ -92,10 +429,13 @@ class RandomOscillator : public Oscillator<&Waveforms::square>
 {
 public:
     float heldValue;
+    FastRandom random;
 
     RandomOscillator() : Oscillator()
-        , heldValue(static_cast <float> (rand()) / (static_cast <float> (RAND_MAX / 2.f)) - 1.f)
-    {}
+        , heldValue(0.f)
+    {
+        newHeldValue();
+    }
 
     void reset()
     {
@@ -104,24 +444,32 @@ public:
         heldValue = 0.f;
     }
 
+    //! \brief picks a new value to hold, i.e. at the start of a note
+    void newHeldValue() {
+        heldValue = random.nextFloat();
+    }
+
     float next()
     {
-        if (phase + phaseDelta > 2.0f * float_Pi) {
-            heldValue = static_cast <float> (rand()) / (static_cast <float> (RAND_MAX / 2.f)) - 1.f;
-        }
-
-        phase = std::fmod(phase + phaseDelta, float_Pi * 2.0f);
-        return heldValue;
+        return next(1.f);
     }
 
     float next(float pitchMod) {
-        if (phase + phaseDelta > 2.0f * float_Pi) {
-            heldValue = static_cast <float> (rand()) / (static_cast <float> (RAND_MAX / 2.f)) - 1.f;
+        const float p = phase + phaseDelta*pitchMod;
+        if (p >= 1.f) {
+            newHeldValue();
         }
 
-        phase = std::fmod(phase + phaseDelta*pitchMod, float_Pi * 2.0f);
+        phase = p - static_cast<float>(static_cast<int>(p));
         return heldValue;
     }
+
+    //! \brief renders n samples with the same pitch modulation factor, a new value is held after every period
+    void render(float *out, float pitchMod, int n) {
+        for (int s = 0; s < n; ++s) {
+            out[s] = next(pitchMod);
+        }
+    }
 };
 
 
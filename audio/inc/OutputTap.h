@@ -0,0 +1,59 @@
+/*
+  ==============================================================================
+
+    OutputTap.h
+    Created: 15 Oct 2026 6:48:02am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef OUTPUTTAP_H_INCLUDED
+#define OUTPUTTAP_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <atomic>
+
+//! OutputTap: the output of the synth for a scope, handed from the audio thread to one reader
+/*! The audio thread mixes the block to mono, averages groups of samples down to about minRate
+    and writes the result into a lock-free ring. While the tap is disabled a push returns at
+    once. Samples the reader does not pick up in time are dropped, the audio thread never waits.
+*/
+class OutputTap {
+public:
+    OutputTap();
+
+    //! \brief sets the decimation for the sample rate, not concurrent with push()
+    void prepare(double sampleRate);
+
+    //! \brief writes the decimated mono mix of the first two channels, audio thread
+    void push(const AudioSampleBuffer& buffer);
+
+    //! \brief the reader switches the tap on while it shows the samples
+    void setEnabled(bool shouldBeEnabled) { enabled.store(shouldBeEnabled, std::memory_order_relaxed); }
+    bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+    //! \brief sample rate of the tapped samples, any thread
+    float getRate() const { return rate.load(std::memory_order_relaxed); }
+
+    //! \brief moves up to maxSamples of the oldest samples to dst, returns their number, reader thread
+    int read(float* dst, int maxSamples);
+
+    //! samples the ring holds
+    static const int capacity = 16384;
+    //! the rate is decimated by whole factors as long as it stays at or above this one
+    constexpr static float minRate = 40000.f;
+
+private:
+    AbstractFifo fifo;
+    HeapBlock<float> ring;
+    std::atomic<bool> enabled;
+    std::atomic<float> rate;
+    int decimation;     //!< samples averaged into one
+    float sum;          //!< of the samples of the group that is not complete yet
+    int summed;
+
+    JUCE_DECLARE_NON_COPYABLE(OutputTap)
+};
+
+#endif  // OUTPUTTAP_H_INCLUDED
@@ -0,0 +1,228 @@
+/*
+  ==============================================================================
+
+    Oversampler.h
+    Created: 14 Oct 2026 8:40:12pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef OVERSAMPLER_H_INCLUDED
+#define OVERSAMPLER_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <array>
+
+//! HalfbandDecimator Class: linear phase half-band lowpass with decimation by two
+/*! Every second tap of a half-band FIR is zero, so in polyphase form one branch is a
+    pure delay (the centre tap) and the other one uses the numOddTaps symmetric odd taps.
+    An output sample costs numOddTaps multiplications. The taps are a Kaiser windowed sinc
+    (beta 7), the passband is flat to 0.05 dB up to 0.418 of the output sample rate and
+    everything that folds into it is attenuated by more than 70 dB.
+*/
+class HalfbandDecimator {
+public:
+    static const int numTaps = 47;
+    static const int centre = (numTaps - 1) / 2;
+    static const int numOddTaps = (centre + 1) / 2;
+
+    HalfbandDecimator() { reset(); }
+
+    void reset();
+
+    //! \brief numOut samples from 2 * numOut input samples, out may point to in
+    void process(const float *in, float *out, int numOut);
+
+    //! delay of the filter in output samples, the centre tap lags the newer input of a pair by centre samples
+    static float getLatency() { return (centre - 1) / 2.f; }
+
+private:
+    void push(float x) {
+        history[pos] = x;
+        history[pos + numTaps] = x;
+        pos = (pos + 1 == numTaps) ? 0 : pos + 1;
+    }
+
+    //! the last numTaps inputs twice, history[pos..pos + numTaps) is always contiguous
+    float history[2 * numTaps];
+    int pos;
+};
+
+//! Decimator Class: brings an oversampled block back to the sample rate of the host
+/*! 4x runs two half-band stages, the stage at the higher rate has the same taps,
+    which is more than needed there but keeps the latency simple.
+*/
+class Decimator {
+public:
+    static const int maxFactor = 4;
+
+    void reset() {
+        for (HalfbandDecimator& stage : stages) {
+            stage.reset();
+        }
+    }
+
+    //! \brief decimates numOut * factor samples of in into out, in is used as scratch memory
+    void process(float *in, float *out, int numOut, int factor) {
+        jassert(factor == 2 || factor == 4);
+        if (factor == 4) {
+            stages[1].process(in, in, numOut * 2);
+        }
+        stages[0].process(in, out, numOut);
+    }
+
+    //! \brief latency in samples at the host rate for the given factor, 0 without oversampling
+    static int getLatency(int factor) {
+        switch (factor) {
+            case 2: return roundToInt(HalfbandDecimator::getLatency());
+            case 4: return roundToInt(HalfbandDecimator::getLatency() * 1.5f);
+            default: return 0;
+        }
+    }
+
+private:
+    std::array<HalfbandDecimator, 2> stages; //!< [0] decimates to the host rate, [1] from 4x to 2x
+};
+
+//! LatencyPad Class: delays a block in place by the latency the decimators of a higher factor have
+/*! Voices with adaptive oversampling decimate with other factors than the ones they are mixed
+    with, each path is delayed to the latency of the largest factor.
+*/
+class LatencyPad {
+public:
+    static const int size = 32;     //!< more than Decimator::getLatency(Decimator::maxFactor)
+
+    LatencyPad() { reset(); }
+
+    void reset() {
+        std::fill(history.begin(), history.end(), 0.f);
+        pos = 0;
+    }
+
+    //! \brief delays the samples by delay < size, which stays the same between resets
+    void process(float *samples, int numSamples, int delay) {
+        jassert(delay < size);
+        if (delay <= 0) {
+            return;
+        }
+        for (int s = 0; s < numSamples; ++s) {
+            history[static_cast<size_t>(pos)] = samples[s];
+            samples[s] = history[static_cast<size_t>((pos - delay) & (size - 1))];
+            pos = (pos + 1) & (size - 1);
+        }
+    }
+
+private:
+    std::array<float, size> history;
+    int pos;
+};
+
+//! HalfbandInterpolator Class: doubles the rate with the half-band lowpass of HalfbandDecimator
+/*! The zero stuffed input is filtered with twice the taps, so of every output pair one is a
+    copy of an input sample (the centre tap) and the other one uses the numOddTaps symmetric
+    odd taps. An input sample costs numOddTaps multiplications, the images above the input
+    band are attenuated by more than 70 dB.
+*/
+class HalfbandInterpolator {
+public:
+    //! inputs the odd taps reach
+    static const int numInputs = 2 * HalfbandDecimator::numOddTaps;
+
+    HalfbandInterpolator() { reset(); }
+
+    void reset();
+
+    //! \brief 2 * numIn samples from numIn input samples, out must not overlap in
+    void process(const float *in, float *out, int numIn);
+
+    //! delay of the filter in output samples
+    static int getLatency() { return HalfbandDecimator::centre; }
+
+private:
+    void push(float x) {
+        history[pos] = x;
+        history[pos + numInputs] = x;
+        pos = (pos + 1 == numInputs) ? 0 : pos + 1;
+    }
+
+    //! the last numInputs inputs twice, history[pos..pos + numInputs) is always contiguous
+    float history[2 * numInputs];
+    int pos;
+};
+
+//! Interpolator Class: brings a block of the engine rate up to the sample rate of the host
+/*! The counterpart of Decimator, 4x runs two half-band stages. */
+class Interpolator {
+public:
+    static const int maxFactor = 4;
+
+    void reset() {
+        for (HalfbandInterpolator& stage : stages) {
+            stage.reset();
+        }
+    }
+
+    //! \brief interpolates numIn samples of in into numIn * factor samples of out, scratch holds numIn * 2 samples for 4x
+    void process(const float *in, float *out, float *scratch, int numIn, int factor) {
+        jassert(factor == 2 || factor == 4);
+        if (factor == 4) {
+            stages[0].process(in, scratch, numIn);
+            stages[1].process(scratch, out, numIn * 2);
+        } else {
+            stages[0].process(in, out, numIn);
+        }
+    }
+
+    //! \brief latency in samples at the host rate for the given factor, 0 for 1
+    static int getLatency(int factor) {
+        switch (factor) {
+            case 2: return HalfbandInterpolator::getLatency();
+            case 4: return HalfbandInterpolator::getLatency() * 3;
+            default: return 0;
+        }
+    }
+
+private:
+    std::array<HalfbandInterpolator, 2> stages; //!< [0] from the engine rate, [1] from 2x to 4x
+};
+
+//! DelayCompensation Class: delays the synth output by a few samples
+/*! The reported latency has to stay the same when the quality tier changes, otherwise the
+    offline bounce would be shifted against the realtime playback. The cheaper tier is padded
+    with this delay up to the latency of the expensive one.
+*/
+class DelayCompensation {
+public:
+    static const int maxDelay = 32; //!< power of two
+
+    //! \brief allocates the history, must not be called from the audio thread
+    void prepare(int numChannels) {
+        history.setSize(numChannels, maxDelay);
+        history.clear();
+        pos = 0;
+    }
+
+    //! \brief delays numSamples samples from startSample of every channel by delay samples
+    void process(AudioSampleBuffer& buffer, int startSample, int numSamples, int delay) {
+        jassert(delay >= 0 && delay < maxDelay);
+        const int numChannels = jmin(buffer.getNumChannels(), history.getNumChannels());
+        for (int c = 0; c < numChannels; ++c) {
+            float *x = buffer.getWritePointer(c, startSample);
+            float *h = history.getWritePointer(c);
+            int p = pos;
+            for (int s = 0; s < numSamples; ++s) {
+                h[p] = x[s];
+                x[s] = h[(p - delay) & (maxDelay - 1)];
+                p = (p + 1) & (maxDelay - 1);
+            }
+        }
+        pos = (pos + numSamples) & (maxDelay - 1);
+    }
+
+private:
+    AudioSampleBuffer history;
+    int pos = 0;
+};
+
+#endif  // OVERSAMPLER_H_INCLUDED
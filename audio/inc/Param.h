@@ -2,21 +2,76 @@
 
 #include <atomic>
 #include <array>
+#include <map>
 #include "JuceHeader.h"
+#include "FastMath.h"
+#include "ParamEventQueue.h"
+#include "ParamUpdateHub.h"
+#include "RealtimeCheck.h"
+#include "RtLog.h"
 
 
+//! ParamInfo: the names of a param, interned, the equal params of all instances share one
+/*! A param holds a pointer to its info, so the names cost a pointer per param and instance
+    and no String is copied when an instance is built. Infos are never removed, there is one
+    per distinct param and prefix of the plugin.
+*/
+struct ParamInfo {
+    String name;
+    String serializationTag;
+    String hostTag;             //!< with the prefix
+    String unit;
+    String prefix;
+
+    //! \brief the info with these names, created on first use, thread safe
+    static const ParamInfo* intern(StringRef name, StringRef serializationTag, StringRef hostTag, StringRef unit, StringRef prefix) {
+        const String key = String(name.text) + "\n" + serializationTag + "\n" + hostTag + "\n" + unit + "\n" + prefix;
+        static CriticalSection lock;
+        static std::map<String, ParamInfo> infos;
+        const ScopedLock sl(lock);
+        auto it = infos.find(key);
+        if (it == infos.end()) {
+            ParamInfo info;
+            info.name = String(name.text);
+            info.serializationTag = String(serializationTag.text);
+            info.hostTag = prefix.isEmpty() ? String(hostTag.text) : String(prefix.text) + " " + hostTag;
+            info.unit = String(unit.text);
+            info.prefix = String(prefix.text);
+            it = infos.insert(std::make_pair(key, info)).first;
+        }
+        return &it->second;
+    }
+
+private:
+    //! \brief the hostTag without the prefix
+    String baseHostTag() const { return prefix.isEmpty() ? hostTag : hostTag.substring(prefix.length() + 1); }
+    friend class Param;
+};
+
 class Param {
 public:
-    Param(const String &name, const String &serializationTag, const String &hostTag, const String &unit, float minval, float maxval, float defaultval, int numSteps=0)
+    //! the names are interned, see ParamInfo
+    Param(StringRef name, StringRef serializationTag, StringRef hostTag, StringRef unit, float minval, float maxval, float defaultval, int numSteps=0)
     : val_(defaultval)
     , min_(minval)
     , max_(maxval)
     , default_(defaultval)
-    , name_(name)
-    , serializationTag_(serializationTag)
-    , hostTag_(hostTag)
-    , unit_(unit)
+    , info_(ParamInfo::intern(name, serializationTag, hostTag, unit, StringRef()))
     , numSteps_(numSteps)
+    , smoothingTime_(0.f)
+    , smoothingSamples_(0)
+    , smoothed_(defaultval)
+    , smoothingTarget_(defaultval)
+    , smoothingStep_(0.f)
+    , smoothingRemaining_(0)
+    , hostQueue_(nullptr)
+    , uiQueue_(nullptr)
+    , blockValue_(defaultval)
+    , hasBlockValue_(false)
+    , updateHub_(nullptr)
+    , updateQueued_(false)
+    , updateNext_(nullptr)
+    , stateGeneration_(nullptr)
     {
         jassert(minval < maxval);
         // this is broken for ParamDb because minval and maxval are in the dB range, but defaultval is already transformed
@@ -25,30 +80,54 @@ public:
     }
     virtual ~Param() {}
 
-    void setPrefix(const String &s) { prefix_ = s; }
-    const String& prefix() { return prefix_; }
+    void setPrefix(const String &s) {
+        info_ = ParamInfo::intern(info_->name, info_->serializationTag, info_->baseHostTag(), info_->unit, s);
+    }
+    const String& prefix() const { return info_->prefix; }
 
-    const String& name() const { return name_; }
-    const String& serializationTag() const { return serializationTag_; }
-    String hostTag() const { return prefix_.isEmpty() ? (hostTag_) : (prefix_ + " " + hostTag_); }
-    const String& unit() const { return unit_; }
+    const String& name() const { return info_->name; }
+    const String& serializationTag() const { return info_->serializationTag; }
+    const String& hostTag() const { return info_->hostTag; }
+    const String& unit() const { return info_->unit; }
     int getNumSteps() const { return numSteps_; }
 
-    void set(float f) { val_.store(f); }
-    void set(float f, bool) {
+    void set(float f) {
         val_.store(f);
-        uiDirty.exchange(true);
+        bumpStateGeneration();
+    }
+    void set(float f, bool) {
+        set(f);
+        setUIDirty();
     }
     float get() const { return val_.load(); }
 
+    //! \name value of the current sub-block
+    /*! The audio thread ramps host automation across the sub-blocks of a block, see
+        PluginAudioProcessor::processBlock(). Outside of such a ramp the block value is get().
+    */
+    ///@{
+    float getBlockValue() const {
+        return hasBlockValue_.load(std::memory_order_relaxed) ? blockValue_.load(std::memory_order_relaxed) : get();
+    }
+    //! \brief audio thread only
+    void setBlockValue(float f) {
+        blockValue_.store(f, std::memory_order_relaxed);
+        hasBlockValue_.store(true, std::memory_order_relaxed);
+    }
+    //! \brief audio thread only
+    void clearBlockValue() { hasBlockValue_.store(false, std::memory_order_relaxed); }
+    ///@}
+
     virtual void setUI(float f, bool notifyHost = true) {
         if (f >= min_ && f <= max_) {
             set(f);
         } else {
+            // a patch or the host with a value of another version or range, kept as it was
+            RtLog::writeText(RtLog::eLevel::eWarning, "{} rejects {} outside of [{}, {}]", info_->name.toRawUTF8(), f, min_, max_);
             jassertfalse;
             //set(default_);
         }
-        if(notifyHost) listener.call(&Listener::paramUIChanged);
+        if(notifyHost) notifyUIChanged();
     }
     virtual float getUI() const { return get(); }
     virtual float getDefaultUI() const { return getDefault(); }
@@ -59,33 +138,114 @@ public:
     float getMin() const { return min_; }
     float getMax() const { return max_; }
     float getDefault() const { return default_; }
-    String getUnit() const { return unit_; }
+    const String& getUnit() const { return info_->unit; }
 
     void setHost(float f) {
+        const float previous = get();
         setUI(f, false);
-        uiDirty.exchange(true);
+        setUIDirty();
+        if (hostQueue_ != nullptr) {
+            hostQueue_->push({ this, get(), previous, 0 });
+        }
+    }
+    //! \brief like setHost() with the engine value of a recorded change, see SessionCapture
+    void replayHost(float f) {
+        const float previous = get();
+        set(f);
+        setUIDirty();
+        if (hostQueue_ != nullptr) {
+            hostQueue_->push({ this, get(), previous, 0 });
+        }
+    }
+    //! \brief makes the ui pick the value up, e.g. after the audio thread changed it
+    void markUIDirty() {
+        setUIDirty();
+    }
+    //! \brief queues the changes of the host and of the ui for the audio thread, see SynthParams::drainParamEvents()
+    /*! Each queue has a single producer: the thread the host automates on and the message thread.
+    */
+    void setEventQueues(ParamEventQueue* host, ParamEventQueue* ui) {
+        hostQueue_ = host;
+        uiQueue_ = ui;
+    }
+    //! \brief the counter every set() moves, of the params in the state of the host, see SynthParams::writeCachedPatchHost()
+    void setStateGeneration(std::atomic<uint32>* generation) {
+        stateGeneration_ = generation;
+    }
+    //! \brief the hub the dirty param notifies, set when the first ui listener registers
+    void setUpdateHub(ParamUpdateHub* hub) {
+        updateHub_.store(hub);
     }
     //! get and reset semantics -> this will break if one value is represented twice on the ui
     bool isUIDirty() {
         return uiDirty.exchange(false);
     }
 
+    //! \name smoothing of the value on the audio thread
+    /*! A new value is ramped in linearly over the smoothing time, starting from wherever the
+        current ramp is. ParamDb ramps the linear gain. Without a smoothing time, or before
+        prepareSmoothing(), the value jumps.
+    */
+    ///@{
+    //! linear ramp over a block: the first sample is at start + (end - start) / n, the last at end
+    struct Ramp {
+        float start;
+        float end;
+        bool isConstant() const { return start == end; }
+    };
+
+    //! \brief time in s a new value is ramped in, 0 jumps
+    void setSmoothingTime(float seconds) { smoothingTime_ = seconds; }
+    float getSmoothingTime() const { return smoothingTime_; }
+
+    //! \brief ramp length for the sample rate, jumps to the current value, audio thread only
+    void prepareSmoothing(double sampleRate) {
+        smoothingSamples_ = static_cast<int>(smoothingTime_ * sampleRate);
+        smoothed_ = smoothingTarget_ = get();
+        smoothingRemaining_ = 0;
+    }
+
+    //! \brief start and end of the next numSamples, audio thread only
+    Ramp getSmoothedRamp(int numSamples) {
+        updateSmoothingTarget();
+        Ramp r;
+        r.start = smoothed_;
+        advanceSmoothing(numSamples);
+        r.end = smoothed_;
+        return r;
+    }
+
+    //! \brief the value of every one of the next numSamples, audio thread only
+    void getSmoothedBlock(float* dst, int numSamples) {
+        updateSmoothingTarget();
+        const int ramp = jmin(numSamples, smoothingRemaining_);
+        float v = smoothed_;
+        for (int s = 0; s < ramp; ++s) {
+            v += smoothingStep_;
+            dst[s] = v;
+        }
+        advanceSmoothing(numSamples);
+        FloatVectorOperations::fill(dst + ramp, smoothed_, numSamples - ramp);
+    }
+    ///@}
+
     constexpr static float MIN_DB = -96.f;
 
     static inline float toDb(float linear) {return linear > 0.f ? 20.f * std::log10(linear) : MIN_DB; }
-    static inline float fromDb(float db) { return db <= MIN_DB ? 0.f : std::pow(10.f, db / 20.f); }
+    static inline float fromDb(float db) { return db <= MIN_DB ? 0.f : FastMath::dbToGain(db); }
 
     static inline float toCent(float factor) { return std::log(factor) / log(2.f)*1200.f; }
-    static inline float fromCent(float ct) { return std::pow(2.f, ct / 1200.f); }
+    static inline float fromCent(float ct) { return FastMath::exp2(ct / 1200.f); }
 
     static inline float toSemi(float factor) { return std::log(factor)/log(2.f)*12.f; }
-    static inline float fromSemi(float st) { return std::pow(2.f, st / 12.f); }
+    static inline float fromSemi(float st) { return FastMath::exp2(st / 12.f); }
 
     /**
     * @param modRange max modulation in octaves
     */
+    template<eMathAccuracy _acc = eMathAccuracy::eAccurate>
     static inline float bipolarToFreq(float modValue, float fInput, float modRange) {
-        return fInput * std::pow(2.f, modValue * modRange);
+        return fInput * FastMath::exp2<_acc>(modValue * modRange);
     }
 
     class Listener {
@@ -93,32 +253,103 @@ public:
         virtual ~Listener(){}
         /// @brief only to be called it the param has been changed in the UI
         virtual void paramUIChanged() {}
+        /// @brief a drag of the ui started or ended, the changes in between belong together
+        virtual void paramGestureChanged(bool starting) { ignoreUnused(starting); }
     };
 
     void addListener(Listener *newListener) { listener.add(newListener); }
     void removeListener(Listener *aListener) { listener.remove(aListener); }
 
+    //! \brief message thread: the ui starts or ends a drag of the param, e.g. of a knob
+    void beginGesture() { listener.call(&Listener::paramGestureChanged, true); }
+    void endGesture() { listener.call(&Listener::paramGestureChanged, false); }
+
 protected:
-    ScopedPointer<float> value;
+    //! a change of the ui: queued for the audio thread, the listeners forward it to the host
+    void notifyUIChanged() {
+        if (uiQueue_ != nullptr) {
+            uiQueue_->push({ this, get(), get(), 0 });
+        }
+        // the listeners lock and may allocate, this must stay on the message thread
+        RealtimeCheck::violation("Param listener call");
+        listener.call(&Listener::paramUIChanged);
+    }
+
+    //! starts a ramp if the value changed since the last smoothed block
+    void updateSmoothingTarget() {
+        const float target = get();
+        if (target == smoothingTarget_) {
+            return;
+        }
+        smoothingTarget_ = target;
+        if (smoothingSamples_ > 0) {
+            smoothingStep_ = (target - smoothed_) / static_cast<float>(smoothingSamples_);
+            smoothingRemaining_ = smoothingSamples_;
+        } else {
+            smoothed_ = target;
+            smoothingRemaining_ = 0;
+        }
+    }
+
+    void advanceSmoothing(int numSamples) {
+        const int ramp = jmin(numSamples, smoothingRemaining_);
+        smoothingRemaining_ -= ramp;
+        // the end of a ramp is exact
+        smoothed_ = smoothingRemaining_ == 0 ? smoothingTarget_ : smoothed_ + smoothingStep_ * static_cast<float>(ramp);
+    }
+
     std::atomic<float> val_;
     float min_;
     float max_;
     float default_;
-    String name_;
-    String serializationTag_;
-    String hostTag_;
-    String unit_;
+    const ParamInfo* info_;
     int numSteps_;
 
-    String prefix_;
-
     ListenerList<Listener> listener;
     std::atomic<bool> uiDirty;
+
+    //! \name smoothing state, audio thread only
+    ///@{
+    float smoothingTime_;       //!< in s
+    int smoothingSamples_;      //!< ramp length at the prepared sample rate
+    float smoothed_;            //!< value at the end of the last smoothed block
+    float smoothingTarget_;     //!< value the ramp goes to
+    float smoothingStep_;       //!< change per sample of the ramp
+    int smoothingRemaining_;    //!< samples left of the ramp
+    ///@}
+
+    ParamEventQueue* hostQueue_;    //!< changes of the host, nullptr if not queued
+    ParamEventQueue* uiQueue_;      //!< changes of the ui, nullptr if not queued
+
+    std::atomic<float> blockValue_;     //!< see getBlockValue(), written by the audio thread
+    std::atomic<bool> hasBlockValue_;
+
+    //! \name list of the ParamUpdateHub
+    ///@{
+    friend class ParamUpdateHub;
+    void setUIDirty() {
+        uiDirty.store(true);
+        ParamUpdateHub* const hub = updateHub_.load();
+        if (hub != nullptr && !updateQueued_.exchange(true)) {
+            hub->push(this);
+        }
+    }
+    std::atomic<ParamUpdateHub*> updateHub_;
+    std::atomic<bool> updateQueued_;    //!< linked into the list of the hub
+    Param* updateNext_;                 //!< next param in the list, written before the param is linked
+    ///@}
+
+    void bumpStateGeneration() {
+        if (stateGeneration_ != nullptr) {
+            stateGeneration_->fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    std::atomic<uint32>* stateGeneration_;  //!< nullptr for params outside the state
 };
 
 class ParamDb : public Param {
 public:
-    ParamDb(const String &name, const String &serializationTag, const String &hostTag, const String &unit, float minval, float maxval, float defaultval)
+    ParamDb(StringRef name, StringRef serializationTag, StringRef hostTag, StringRef unit, float minval, float maxval, float defaultval)
         : Param(name, serializationTag, hostTag, unit, minval, maxval, fromDb(defaultval))
     {}
 
@@ -126,9 +357,11 @@ public:
         if (f >= min_ && f <= max_) {
             set(fromDb(f));
         } else {
-            jassert(false);
+            // like Param::setUI(), the range is in dB
+            RtLog::writeText(RtLog::eLevel::eWarning, "{} rejects {} dB outside of [{}, {}]", info_->name.toRawUTF8(), f, min_, max_);
+            jassertfalse;
         }
-        if (notifyHost) listener.call(&Listener::paramUIChanged);
+        if (notifyHost) notifyUIChanged();
     }
     virtual float getUI() const override { return toDb(get()); }
     virtual float getDefaultUI() const { return toDb(getDefault()); }
@@ -137,17 +370,17 @@ public:
 template<typename _enum>
 class ParamStepped : public Param {
 public:
-    ParamStepped(const String &name, const String &serializationTag, const String &hostTag, _enum defaultval, const char **labels = nullptr)
+    //! the labels are static arrays, they are referenced and not copied
+    ParamStepped(StringRef name, StringRef serializationTag, StringRef hostTag, _enum defaultval, const char **labels = nullptr)
     : Param(name, serializationTag, hostTag, "", 0.f, static_cast<float>(_enum::nSteps)-1.f,
             static_cast<float>(defaultval),
             static_cast<int>(_enum::nSteps))
     , step_(defaultval)
-    , labelsSet(false)
+    , labels_(labels)
+    , numLabels_(0)
     {
-        const char **lbl = labels;
-        for(size_t u = 0; u<labels_.size() && lbl != nullptr && *lbl != nullptr; ++u, ++lbl) {
-            labels_[u] = *lbl;
-            labelsSet = true;
+        while (labels_ != nullptr && numLabels_ < static_cast<size_t>(_enum::nSteps) && labels_[numLabels_] != nullptr) {
+            ++numLabels_;
         }
     }
 
@@ -166,22 +399,22 @@ public:
         int ival = static_cast<int>(std::trunc(f + .5f));
         jassert(ival >= 0 && ival < static_cast<int>(_enum::nSteps));
         step_.store(static_cast<_enum>(ival));
-        if (notifyHost) listener.call(&Listener::paramUIChanged);
+        if (notifyHost) notifyUIChanged();
     }
-    virtual String getUIString() const override { return labels_[static_cast<size_t>(getStep())]; }
+    virtual String getUIString() const override { return getUIString(static_cast<float>(getStep())); }
     virtual String getUIString(float v) const override {
         size_t u = static_cast<size_t>(std::trunc(v+.5f));
-        if(u<labels_.size()) {
-            return labels_[u];
+        if(u<static_cast<size_t>(_enum::nSteps)) {
+            return u < numLabels_ ? String(labels_[u]) : String();
         } else {
             jassert(false);
             return String::formatted("val%u",u);
         }
     }
-    virtual bool hasLabels() const override { return labelsSet; }
+    virtual bool hasLabels() const override { return numLabels_ > 0; }
 
 protected:
     std::atomic<_enum> step_;
-    std::array<String, static_cast<size_t>(_enum::nSteps)> labels_;
-    bool labelsSet;
+    const char **labels_;   //!< static, numLabels_ of them are set
+    size_t numLabels_;
 };
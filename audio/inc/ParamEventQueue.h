@@ -0,0 +1,72 @@
+/*
+  ==============================================================================
+
+    ParamEventQueue.h
+    Created: 15 Oct 2026 6:14:33am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef PARAMEVENTQUEUE_H_INCLUDED
+#define PARAMEVENTQUEUE_H_INCLUDED
+
+#include "JuceHeader.h"
+
+class Param;
+
+//! a changed value of a param
+struct ParamEvent {
+    Param* param;
+    float value;        //!< engine value, as returned by Param::get()
+    float previousValue;//!< engine value before the change, the same as value if the sender does not know
+    int sampleOffset;   //!< position in the block the value applies from, 0 if the sender does not know
+};
+
+//! ParamEventQueue: lock free queue of param changes from one producer thread to one consumer thread
+/*! Neither side blocks. A full queue drops the event, which only loses the notification:
+    the value itself is already stored in the param.
+*/
+class ParamEventQueue {
+public:
+    explicit ParamEventQueue(int capacity = 1024)
+        : fifo(capacity)
+        , events(static_cast<size_t>(capacity))
+    {}
+
+    //! \brief producer thread only, false if the queue is full
+    bool push(const ParamEvent& e) {
+        int start1, size1, start2, size2;
+        fifo.prepareToWrite(1, start1, size1, start2, size2);
+        if (size1 == 0) {
+            return false;
+        }
+        events[start1] = e;
+        fifo.finishedWrite(1);
+        return true;
+    }
+
+    //! \brief consumer thread only, moves up to maxEvents into dst in the order they were pushed
+    int pop(ParamEvent* dst, int maxEvents) {
+        int start1, size1, start2, size2;
+        fifo.prepareToRead(maxEvents, start1, size1, start2, size2);
+        for (int i = 0; i < size1; ++i) {
+            dst[i] = events[start1 + i];
+        }
+        for (int i = 0; i < size2; ++i) {
+            dst[size1 + i] = events[start2 + i];
+        }
+        fifo.finishedRead(size1 + size2);
+        return size1 + size2;
+    }
+
+    bool isEmpty() const { return fifo.getNumReady() == 0; }
+
+private:
+    AbstractFifo fifo;
+    HeapBlock<ParamEvent> events;
+
+    JUCE_DECLARE_NON_COPYABLE(ParamEventQueue)
+};
+
+#endif  // PARAMEVENTQUEUE_H_INCLUDED
@@ -0,0 +1,114 @@
+/*
+  ==============================================================================
+
+    ParamUpdateHub.h
+    Created: 15 Oct 2026 7:02:37am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef PARAMUPDATEHUB_H_INCLUDED
+#define PARAMUPDATEHUB_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <atomic>
+#include <map>
+#include <vector>
+
+class Param;
+
+//! ParamUpdateHub: hands the params changed outside of the ui to the components showing them
+/*! A param the host, the audio thread or a patch changed links itself into a lock free list,
+    once until the hub took it. On the message thread the hub drains the list at a single rate
+    and calls only the listeners of the changed params, so an idle editor costs one atomic
+    exchange per tick. A param is linked only once a listener registered for it.
+    While the editor is hidden or its window minimised the hub stops its
+    timer, and so do the components with a timer of their own that listen to the showing
+    state. The changes collect in the list meanwhile and are dispatched at once when the editor
+    is shown again.
+    Under audio load the hub throttles the editor: while the render time of the audio thread is
+    above the share SynthParams::guiThrottle of the block duration it ticks at throttledRate, and the
+    components with a timer of their own pause their visualisations or slow down. The editor
+    returns to normal once the load stayed below the share for a second.
+*/
+class ParamUpdateHub : private Timer {
+public:
+    class Listener {
+    public:
+        virtual ~Listener() {}
+        //! \brief message thread: the ui value of the param changed
+        virtual void paramChanged(Param* p) = 0;
+        //! \brief message thread: the tick that called paramChanged() is done, e.g. to repaint once
+        virtual void paramsDispatched() {}
+    };
+
+    //! a component that animates something on a timer of its own
+    class ShowingListener {
+    public:
+        virtual ~ShowingListener() {}
+        //! \brief message thread: the editor was hidden or is shown again, the timers stop or start with it
+        virtual void editorShowingChanged(bool showing) = 0;
+        //! \brief message thread: the audio thread is under load or recovered, see isThrottled()
+        virtual void editorThrottledChanged(bool throttled) { ignoreUnused(throttled); }
+    };
+
+    ParamUpdateHub();
+    ~ParamUpdateHub();
+
+    //! \brief message thread, the timer runs while there are listeners
+    void addListener(Param* p, Listener* l);
+    //! \brief message thread: removes the listener from all its params
+    void removeListener(Listener* l);
+
+    //! \brief any thread, called by the param when it becomes dirty
+    void push(Param* p);
+
+    //! \name showing state of the editor, message thread
+    ///@{
+    void addShowingListener(ShowingListener* l) { showingListeners.add(l); }
+    void removeShowingListener(ShowingListener* l) { showingListeners.remove(l); }
+    //! \brief hidden the timer stops, shown again it dispatches what changed meanwhile and tells the listeners
+    void setEditorShowing(bool showing);
+    bool isEditorShowing() const { return editorShowing; }
+    ///@}
+
+    //! \name throttling under audio load, message thread
+    ///@{
+    /** \brief the load the hub watches and the param of its threshold, set once by SynthParams
+        @param load render time of the audio thread relative to the block duration
+        @param threshold in percent of the block duration, 100 never throttles
+    */
+    void setLoadMonitor(const std::atomic<float>* load, const Param* threshold) { audioLoad = load; throttleThreshold = threshold; }
+    //! \brief true while the audio thread is under load, the editor ticks at throttledRate and skips its animations
+    bool isThrottled() const { return throttled; }
+    ///@}
+
+    //! \brief message thread: one tick at once, e.g. for a benchmark that runs without message loop
+    void dispatchNow() { timerCallback(); }
+
+    static const int updateRate = 60;   //!< Hz
+    static const int throttledRate = 15;    //!< Hz, while isThrottled()
+    static const int recoveryTicks = throttledRate;     //!< below the threshold this long before throttling ends
+
+private:
+    //! dispatches the params changed since the last tick
+    void timerCallback() override;
+    //! \brief enters or leaves the throttled state from the current audio load
+    void updateThrottling();
+
+    std::atomic<Param*> changed;                //!< head of the list, linked through the params
+    std::multimap<Param*, Listener*> listeners;
+    std::vector<Listener*> dispatched;          //!< of the current tick, kept to not allocate per tick
+    ListenerList<ShowingListener> showingListeners;
+    std::atomic<bool> editorShowing;   //!< also read by the paint of the editor, which may run on the OpenGL thread
+
+    const std::atomic<float>* audioLoad;    //!< see setLoadMonitor()
+    const Param* throttleThreshold;
+    bool throttled;
+    int ticksBelowThreshold;                //!< while throttled
+
+    JUCE_DECLARE_NON_COPYABLE(ParamUpdateHub)
+};
+
+#endif  // PARAMUPDATEHUB_H_INCLUDED
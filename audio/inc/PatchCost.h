@@ -0,0 +1,71 @@
+/*
+  ==============================================================================
+
+    PatchCost.h
+    Created: 15 Oct 2026 10:31:07pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef PATCHCOST_H_INCLUDED
+#define PATCHCOST_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "SynthParams.h"
+#include <array>
+
+//! KernelCosts: ns per sample of the parts of a voice and of the effects on this machine
+/*! Measured at a block size of 64 by "--calibrate-costs" of the standalone, which renders the
+    parts one at a time like the voice and fx benchmarks, and read from getFile(). Without that
+    file the defaults are rough values of a current desktop cpu.
+*/
+struct KernelCosts {
+    double voice = 15.;         //!< a voice without oscillators, filters and mod rows: envelopes, lfos, modulation
+    std::array<double, static_cast<size_t>(eOscWaves::nSteps)> wave {{ 6., 6., 3., 10., 8. }};
+    double unisonCopy = 5.;     //!< each detuned copy of square and saw after the first one
+    std::array<double, static_cast<size_t>(eBiquadFilters::nSteps)> biquad {{ 5., 5., 6., 20. }};  //!< the ladder at eLadder
+    double svf = 7.;            //!< lowpass, highpass or bandpass as state variable filter
+    double modRow = 1.5;        //!< a row of the mod matrix with a source
+    std::array<double, static_cast<size_t>(eFxType::nSteps)> fx {{ 2., 3., 6., 8., 25., 4. }};   //!< per channel
+    bool measured = false;      //!< read from the file of the calibration
+    String measuredOn;          //!< date of the calibration
+
+    //! \brief the file "--calibrate-costs" writes
+    static File getFile();
+    //! \brief the calibration of this machine, the defaults if there is none
+    static KernelCosts load();
+    bool save() const;
+
+    var toJson() const;
+    //! \brief false if the json is no calibration, the values it has not are left as they are
+    bool fromJson(const var& json);
+};
+
+//! PatchCostEstimate: the predicted rendering cost of a patch, without playing it
+/*! Counts the parts of a voice the patch switches on and adds up their calibrated costs: the
+    active oscillators by waveform and unison copies, the active filters by type and routing,
+    the rows of the mod matrix with a source, all of it times the oversampling factor. The
+    instance plays up to the polyphony of voices plus the effects of the fx chain. The live
+    guide is a block of 64 samples, which the calibration was measured at.
+*/
+struct PatchCostEstimate {
+    double voiceNs = 0.;        //!< per sample of a voice
+    double fxNs = 0.;           //!< per sample of the stereo fx chain
+    int numVoices = 0;          //!< the polyphony, 1 in legato mode
+    int numOscillators = 0;
+    int numFilters = 0;         //!< filters a voice renders, per oscillator routing counts them per oscillator
+    int numModRows = 0;
+    int numFx = 0;
+
+    static PatchCostEstimate estimate(const SynthParams& params, const KernelCosts& costs);
+
+    //! \brief ns per sample of the whole instance with all voices playing
+    double getInstanceNs() const { return voiceNs * numVoices + fxNs; }
+    //! \brief fraction of the duration of a block at the rate, 1 is the deadline
+    static double getLoad(double ns, double sampleRate) { return ns * 1.e-9 * sampleRate; }
+
+    static const int liveBlockSize = 64;
+};
+
+#endif  // PATCHCOST_H_INCLUDED
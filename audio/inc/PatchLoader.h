@@ -0,0 +1,100 @@
+/*
+  ==============================================================================
+
+    PatchLoader.h
+    Created: 15 Oct 2026 4:52:18am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef PATCHLOADER_H_INCLUDED
+#define PATCHLOADER_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "BackgroundJobs.h"
+#include "Param.h"
+#include "SeqPattern.h"
+#include "PresetBank.h"
+#include <array>
+#include <atomic>
+#include <utility>
+#include <vector>
+
+class SynthParams;
+class MappedSample;
+enum class eSerializationParams : int;
+
+//! the values of a parsed patch, all of them are applied in one go
+struct PatchValues {
+    std::vector<std::pair<Param*, float>> values;   //!< UI values, allocated for all serialized params
+    int numValues = 0;
+    bool resetVoices = false;                       //!< release the playing notes when the patch is applied
+    SeqPattern::Data pattern;                       //!< steps of the sequencer, if hasPattern
+    bool hasPattern = false;
+    std::array<const MappedSample*, 3> samples;     //!< samples of the oscillators, nullptr for none, if hasSamples
+    bool hasSamples = false;
+    bool fromDefaults = false;                      //!< a sparse patch, the values apply on top of SynthParams::getDefaultPatch()
+};
+
+//! PatchLoader: reads patch files on a background thread, the audio thread applies them at a block boundary
+/*! The file is parsed and matched to the params on a thread shared by all instances. The
+    values are handed over in a triple buffer like TransportState, so the audio thread applies
+    a complete patch between two blocks without waiting, and never sees half of one. The params
+    are set without listener calls and marked dirty for the ui. The patch name and a version
+    warning reach the message thread asynchronously. A preset of a PresetBank is read from its
+    record in the mapped file instead of parsed.
+*/
+class PatchLoader : private TimeSliceClient, private AsyncUpdater {
+public:
+    PatchLoader(SynthParams& p, int numParams);
+    ~PatchLoader();
+
+    //! \brief message thread: starts reading the file, replaces a load that is not done yet
+    void load(const File& file, eSerializationParams which, bool resetVoices);
+    //! \brief message thread: like load() for a patch that is parsed already, takes ownership of it
+    void load(XmlElement* parsedPatch, eSerializationParams which, bool resetVoices);
+    //! \brief message thread: like load() for a preset of a bank, the worker reads its record
+    void load(PresetBank* bank, int preset, bool resetVoices);
+
+    //! \brief audio thread, at the start of a block: applies a parsed patch, true if its voices should be released
+    bool applyPending();
+    //! \brief audio thread: a parsed patch waits for applyPending()
+    bool hasParsedPatch() const { return (middleSlot.load(std::memory_order_relaxed) & newFlag) != 0; }
+
+
+private:
+    //! parses the pending file into the write slot and publishes it
+    int useTimeSlice() override;
+    //! patch name and version warning of the last parsed patch
+    void handleAsyncUpdate() override;
+
+    SynthParams& params;
+    SharedResourcePointer<BackgroundJobs> jobs;
+
+    SpinLock lock;          //!< guards the members up to parsedIsPatch
+    File pendingFile;
+    ScopedPointer<XmlElement> pendingPatch;     //!< parsed already, instead of pendingFile
+    PresetBank::Ptr pendingBank;                //!< instead of pendingFile
+    int pendingPreset;
+    eSerializationParams pendingWhich;
+    bool pendingReset;
+    bool hasPending;
+    String parsedName;
+    float parsedVersion;
+    bool parsedIsPatch;
+
+    //! \name triple buffer, see TripleBuffer
+    ///@{
+    static const int slotMask = 3;
+    static const int newFlag = 4;
+    std::array<PatchValues, 3> slots;
+    int writeSlot;                  //!< owned by the worker
+    int readSlot;                   //!< owned by the audio thread
+    std::atomic<int> middleSlot;
+    ///@}
+
+    JUCE_DECLARE_NON_COPYABLE(PatchLoader)
+};
+
+#endif  // PATCHLOADER_H_INCLUDED
@@ -0,0 +1,96 @@
+/*
+  ==============================================================================
+
+    PatchMorph.h
+    Created: 15 Oct 2026 9:26:44pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef PATCHMORPH_H_INCLUDED
+#define PATCHMORPH_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "TripleBuffer.h"
+#include <array>
+#include <vector>
+
+class Param;
+class SynthParams;
+
+//! PatchMorph: blends the params between stored corners, moved by the morphX and morphY params
+/*! A corner holds the values of all morphable params, A and B span the x axis, C and D the y
+    axis for an XY morph: A at (0, 0), B at (1, 0), C at (0, 1) and D at (1, 1). With A and B
+    stored the morph follows morphX, with all four it is bilinear. The message thread turns the
+    corners into the start values and the delta vectors of the continuous params that differ,
+    so the audio thread blends with a few vector multiply-adds whenever a position or the
+    corners changed, before the snapshot of the block. Stepped params switch to the nearest
+    corner at the midpoint. A param is written only when the morph moves, an edit sticks until
+    then. The part settings, the sections of the editor and the morph position do not morph.
+*/
+class PatchMorph {
+public:
+    static const int numCorners = 4;
+
+    explicit PatchMorph(SynthParams& p);
+
+    //! \brief message thread: the current values become the corner, A = 0 .. D = 3
+    void storeCorner(int corner);
+    //! \brief message thread: the corner no longer takes part, the morph stops without A and B
+    void clearCorner(int corner);
+    //! \brief message thread
+    bool hasCorner(int corner) const { return stored[static_cast<size_t>(corner)]; }
+
+    //! \brief audio thread: blends the params if the position or the corners changed since the last block
+    void process();
+
+    //! \name corners in the state of the host, message thread
+    ///@{
+    void writeCorners(OutputStream& out) const;
+    void readCorners(InputStream& in);
+    ///@}
+
+    //! \brief any thread, changes with every change of the corners
+    uint32 getVersion() const { return version.load(std::memory_order_acquire); }
+
+    static String getCornerName(int corner) { return String::charToString(static_cast<juce_wchar>('A' + corner)); }
+
+private:
+    //! the blend of the current corners, built by the message thread
+    struct Table {
+        int numCorners = 0;             //!< 2 for A/B, 4 for XY, 0 without a morph
+        std::vector<Param*> continuous; //!< the ones that differ between the corners
+        std::vector<float> start;       //!< value at A
+        std::vector<float> deltaX;      //!< B - A
+        std::vector<float> deltaY;      //!< C - A
+        std::vector<float> deltaXY;     //!< A - B - C + D
+        std::vector<Param*> stepped;    //!< the ones that differ between the corners
+        std::array<std::vector<float>, PatchMorph::numCorners> steps;
+    };
+
+    //! \brief rebuilds the table from the stored corners and hands it to the audio thread
+    void publish();
+
+    SynthParams& params;
+    std::vector<Param*> morphed;    //!< the params a corner holds, in its order
+
+    //! \name message thread
+    ///@{
+    std::array<std::vector<float>, numCorners> corners;     //!< values of morphed
+    std::array<bool, numCorners> stored;
+    std::atomic<uint32> version;    //!< see getVersion(), counts publish()
+    ///@}
+
+    //! \name audio thread
+    ///@{
+    TripleBuffer<Table> tables;
+    std::vector<float> blended;     //!< scratch of process(), sized for all morphed params
+    float lastX;
+    float lastY;
+    ///@}
+
+    JUCE_DECLARE_NON_COPYABLE(PatchMorph)
+};
+
+#endif  // PATCHMORPH_H_INCLUDED
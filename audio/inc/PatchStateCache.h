@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    PatchStateCache.h
+    Created: 15 Oct 2026 11:02:18pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef PATCHSTATECACHE_H_INCLUDED
+#define PATCHSTATECACHE_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "SeqPattern.h"
+#include <vector>
+
+//! PatchStateCache: the host states the instances of the process restored, parsed once for all of them
+/*! A session that layers one patch on many instances restores the same chunk into each of them.
+    The first instance parses the chunk, binary or XML, into a State that names the params by
+    their ids of the binary chunk and so fits every instance; the others find it by the content
+    of the chunk and only set the values. Held with a SharedResourcePointer. The chunk is kept
+    with its state and compared byte by byte, a hash collision never applies a wrong state.
+    The least recently used state goes when maxStates are kept. Any thread, a lock guards the list.
+*/
+class PatchStateCache {
+public:
+    //! a parsed host state, not changed once it is in the cache
+    struct State : public ReferenceCountedObject {
+        typedef ReferenceCountedObjectPtr<State> Ptr;
+
+        float patchVersion = 0.f;
+        bool tooNew = false;                            //!< a binary format this version cannot read, nothing else is set
+        bool isPatch = true;                            //!< false for XML of another root, warns like a newer version
+        String patchName;
+        bool fromDefaults = false;                      //!< a sparse chunk, the values apply on top of the defaults
+        std::vector<std::pair<uint32, float>> values;   //!< ids of SynthParams::getParamId() and UI values, in the order of the chunk
+        bool hasPattern = false;
+        int numSteps = 0;                               //!< steps of the pattern in the chunk, the others keep their value
+        SeqPattern::Data pattern;
+        StringArray samples;                            //!< file of every oscillator, empty for none
+        bool hasMorph = false;
+        MemoryBlock morphCorners;                       //!< as in the chunk, see PatchMorph::readCorners()
+    };
+
+    PatchStateCache();
+
+    //! \brief the state of a chunk restored before, nullptr if none is kept
+    State::Ptr find(const void* data, int sizeInBytes);
+    //! \brief keeps the parsed state of a chunk
+    void add(const void* data, int sizeInBytes, const State::Ptr& state);
+
+    //! \brief restores that found their state since the start of the process
+    int64 getNumHits() const;
+
+    static const int maxStates = 16;
+    static const int maxChunkBytes = 1 << 20;   //!< larger chunks are parsed every time
+
+private:
+    struct Entry {
+        uint64 hash;
+        MemoryBlock chunk;
+        State::Ptr state;
+    };
+
+    //! \brief FNV-1a over the bytes of the chunk
+    static uint64 hashChunk(const void* data, int sizeInBytes);
+
+    CriticalSection lock;
+    std::vector<Entry> entries;     //!< the most recently used first
+    int64 numHits;
+
+    JUCE_DECLARE_NON_COPYABLE(PatchStateCache)
+};
+
+#endif  // PATCHSTATECACHE_H_INCLUDED
@@ -20,13 +20,34 @@
 #include "StepSequencer.h"
 #include "FxChorus.h"
 #include "LowFidelity.h"
+#include "FxReverb.h"
+#include "FxWaveshaper.h"
+#include "FxChain.h"
+#include "MasterOutput.h"
+#include "MasterLimiter.h"
+#include "InstanceBudget.h"
+#include "VoiceBank.h"
+#include "FilterBank.h"
+#include "Lfo.h"
+#include "VoiceWorkerPool.h"
+#include "Oversampler.h"
+#include "FactoryBank.h"
+#include "NoteCache.h"
+#include "EngineResampler.h"
+#include "RtLog.h"
+#include "SessionCapture.h"
+#include "RealtimeMemory.h"
+#include "FxPipeline.h"
+#include "SeqFreeze.h"
+#include "MidiClock.h"
 #include <math.h>
 
 //==============================================================================
 /**
 */
 class Sequencer;
-class PluginAudioProcessor  : public AudioProcessor, public SynthParams
+class Voice;
+class PluginAudioProcessor  : public AudioProcessor, public SynthParams, private MemoryFootprint::Source
 {
 public:
     //==============================================================================
@@ -36,8 +57,23 @@ public:
     //==============================================================================
     void prepareToPlay (double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
+    void reset() override;
 
     void processBlock (AudioSampleBuffer&, MidiBuffer&) override;
+    //! \brief renders a block of every processor in lock-step, the voices of all of them share the SIMD lanes
+    /*! For offline batches: the processors are prepared with the same rate and block size, run
+        non-realtime and have the same patch loaded, only their notes and velocities differ. The
+        voices of processors whose midi events are at the same positions are rendered together,
+        groups of VoiceBank::numLanes voices from any of them, the effects run per processor. A
+        processor with automation ramps, the fx pipeline or other event positions renders its
+        block alone. The result is that of processBlock() with SynthParams::voiceBankMode on.
+        @param numProcessors at most maxBatchSize
+    */
+    static void processBlockBatch(PluginAudioProcessor* const* processors, AudioSampleBuffer* const* buffers,
+                                  MidiBuffer* const* midi, int numProcessors);
+    static const int maxBatchSize = 32;
+    //! \brief fades the sounding notes out over bypassFadeSeconds, after that only clears the outputs
+    void processBlockBypassed (AudioSampleBuffer&, MidiBuffer&) override;
 
     //==============================================================================
     AudioProcessorEditor* createEditor() override;
@@ -67,39 +103,154 @@ public:
     void getStateInformation (MemoryBlock& destData) override;
     void setStateInformation (const void* data, int sizeInBytes) override;
 
+    //! denormals found in the output and the filter state after the last block, debug builds only, 0 otherwise
+    int getDenormalCount() const { return denormalCount; }
+
+    //! master gain and pan stage, its meters can be read from any thread once metering is enabled
+    MasterOutput& getMasterOutput() { return masterOutput; }
 
 private:
     //==============================================================================
     class Synth : public Synthesiser {
     public:
-        Synth(MidiState& mS) : midiState(mS) {}
-        void handleController(int midiChannel, int controllerNumber, int newValue) override {
-            switch (controllerNumber)
-            {
-                
-            case 1: //Modwheel
-                midiState.values[MidiState::eModwheel] = newValue;
-                break;
-            case 4: //Foot Controller
-                midiState.values[MidiState::eFoot] = newValue;
-                break;
-            case 11: //Expression Control
-                midiState.values[MidiState::eExpPedal] = newValue;
-                break;
-            default:
-                break;
-            }
-            Synthesiser::handleController(midiChannel, controllerNumber, newValue);
+        Synth(SynthParams& p) : params(p), midiState(p.midiState), voiceArenaSize(0), cpuLoad(0.f), budgetVoices(static_cast<int>(p.polyphony.getMax())), numHeldNotes(0), legatoVoice(nullptr) {}
+
+        //! makes the voices on the first call, prepares them on the voice arena, allocates the voice bank, starts the voice workers for blocks of blockSeconds and allocates the note cache if requested
+        //! the scratch memory is faulted in, and locked into RAM with SynthParams::lockMemory
+        void prepare(int numChannels, double blockSeconds);
+        //! \brief global lfos and random seeds as after prepare(), for output that does not depend on what played before
+        void resetSources();
+
+        //! samples the voices render at most per call, renderVoices() splits longer ranges
+        /*! The scratch buffers of the voices, the voice bank and the workers have this size whatever
+            block size the host announced or sends, so a bigger block cannot overflow them and the
+            modulation buffers of a voice stay in the L1 cache.
+        */
+        static const int internalBlockSize = 64;
+
+        //! only the first free voices up to the polyphony are used, the pool itself keeps its size
+        SynthesiserVoice* findFreeVoice(SynthesiserSound* soundToPlay, int midiChannel,
+                                        int midiNoteNumber, bool stealIfNoneAvailable) const override;
+        //! allocation-free stealing: same note, then the oldest released, not held or playing voice
+        SynthesiserVoice* findVoiceToSteal(SynthesiserSound* soundToPlay, int midiChannel,
+                                           int midiNoteNumber) const override;
+
+        //! \brief like Synthesiser::renderNextBlock() for synths whose midi events are at the same positions, see processBlockBatch()
+        static void renderNextBlockBatch(Synth* const* synths, AudioSampleBuffer* const* outputs, const MidiBuffer* const* midi,
+                                         int numSynths, int numSamples);
+
+        //! \brief cpu budget voice limiting
+        /*!
+        Compares the render time of the last block with its real-time budget. When the deadline
+        is at risk, the quietest releasing voice is stolen with a short fade and the effective
+        polyphony is lowered; it recovers by one voice per block once the load is low again.
+        @param renderSeconds time spent in processBlock
+        @param budgetSeconds duration of the block
+        */
+        void updateCpuLoad(double renderSeconds, double budgetSeconds);
+        float getCpuLoad() const { return cpuLoad; }
+        //! number of denormal filter state variables of all voices
+        int countDenormalState() const;
+        //! number of voices playing a note or releasing one
+        int countActiveVoices() const;
+        //! number of releasing voices that are not fading out yet
+        int countReleasingVoices() const;
+        //! \brief fades out the quietest releasing voice, false without one, see InstanceBudget
+        bool stealQuietestReleasing();
+        //! \brief fades out all active voices, see SeqFreeze
+        void fadeOutVoices();
+        //! the modulation of the most recently started active voice, the note is -1 without one
+        void fillModulationFrame(ModulationFrame& frame) const;
+        //! lifts the cpu budget limit again
+        void resetCpuLoad() { cpuLoad = 0.f; budgetVoices = static_cast<int>(params.polyphony.getMax()); }
+        //! \brief picks up the params of the block for the note cache, before the notes of the block start
+        void updateNoteCache() { noteCache.update(params); }
+        //! \brief voices, their buffers, the note cache and the banks, message thread
+        void fillMemoryFootprint(MemoryFootprint& m) const;
+
+        //! \name midi controllers
+        /*! The channel wide values go to the MidiState the voices start with. In mpe mode only
+            the master channel 1 changes them and applies to all notes, the pitch wheel, pressure
+            and cc 74 of the other channels reach the note sources of the voices on that channel.
+        */
+        ///@{
+        void handleController(int midiChannel, int controllerNumber, int newValue) override;
+        void handleChannelPressure(int midiChannel, int channelPressureValue) override;
+        void handlePitchWheel(int midiChannel, int wheelValue) override;
+        ///@}
+
+        //! \name mono legato
+        /*! In SynthParams::eVoiceMode::eLegato a note played while the note of the legato voice is
+            held moves that voice to the key, see Voice::legatoTo(), instead of starting another
+            one. Releasing the sounding key goes back to the last key still held, the voice stops
+            with the last key like a note in poly mode. The other modes are those of the Synthesiser.
+        */
+        ///@{
+        void noteOn(int midiChannel, int midiNoteNumber, float velocity) override;
+        void noteOff(int midiChannel, int midiNoteNumber, float velocity, bool allowTailOff) override;
+        void allNotesOff(int midiChannel, bool allowTailOff) override;
+        ///@}
+    protected:
+        //! \brief hands the voice that started the note to NoteLatency, with SYNISTER_NOTE_LATENCY only
+        void traceNoteStart(int midiChannel, int midiNoteNumber);
+        //! renders the voices in pieces of internalBlockSize
+        void renderVoices(AudioSampleBuffer& outputAudio, int startSample, int numSamples) override;
+        //! \brief one piece of up to internalBlockSize samples
+        void renderVoicesChunk(AudioSampleBuffer& outputAudio, int startSample, int numSamples);
+        //! renders the voices in groups of VoiceBank::numLanes, the oscillators and filters of a group run in lock-step
+        void renderVoiceBank(AudioSampleBuffer& outputAudio, int startSample, int numSamples);
+        //! \brief like renderVoiceBank() for the voices of several synths with the same patch, each into its own output
+        static void renderVoiceLanes(Synth* const* synths, AudioSampleBuffer* const* outputs, int numSynths, int startSample, int numSamples);
+        //! renders the lfos in global mode once for all voices, before the voices of the block
+        void renderGlobalLfos(int numSamples);
+    private:
+        //! \brief true if a message of the channel applies to all notes
+        bool isChannelWide(int midiChannel) const {
+            return midiChannel == 1 || params.mpeMode.getStep() == eOnOffToggle::eOff;
         }
-        void handleChannelPressure(int midiChannel, int channelPressureValue) override {
-            midiState.values[MidiState::eAftertouch] = channelPressureValue;
-            Synthesiser::handleChannelPressure(midiChannel, channelPressureValue);
+        bool isMpeMasterChannel(int midiChannel) const {
+            return midiChannel == 1 && params.mpeMode.getStep() == eOnOffToggle::eOn;
         }
-    private:
+
+        SynthParams& params;
         MidiState& midiState;
+        VoiceBank voiceBank;
+        FilterBank filterBank;
+        VoiceWorkerPool workerPool;
+        NoteCache noteCache;            //!< allocated by prepare() if SynthParams::noteCache is on
+        std::array<::Lfo, 3> globalLfo; //!< free running, the voices read their blocks
+
+        HeapBlock<float> voiceArena;    //!< scratch buffers of all voices, see Voice::prepare()
+        size_t voiceArenaSize;          //!< allocated floats in the voice arena
+        RealtimeMemory engineMemory;    //!< the arena, the lfo blocks and the banks, faulted in by prepare(), after them to unlock first
+
+        //! \name cpu budget state, only accessed on the audio thread
+        ///@{
+        float cpuLoad;      //!< peak-hold render time relative to the block duration
+        int budgetVoices;   //!< polyphony allowed by the cpu budget
+        ///@}
+
+        //! \name legato state, only accessed under the lock of the Synthesiser
+        ///@{
+        std::array<int, 128> heldNotes; //!< keys held in legato mode, the last one on top
+        int numHeldNotes;
+        Voice* legatoVoice;             //!< the voice the held keys play, nullptr before the first one
+        ///@}
     };
 
     Synth synth;
+    DelayCompensation delayCompensation; //!< pads the voice latency of the realtime tier, see getReportedLatency()
+    EngineResampler engineResampler;     //!< brings the engine rate up to the host rate, see SynthParams::fixedEngineRate
+    double engineSampleRate;             //!< rate of the voices and the effects
+    int engineBlockSize;                 //!< of the blocks of the last prepareToPlay() at the engine rate, 0 before
+
+    //! \brief see Telemetry::getMemoryFootprint()
+    void fillMemoryFootprint(MemoryFootprint& m) const override;
+
+    //! latency reported to the host, the same for both quality tiers
+    int getReportedLatency() const;
+    //! latency of the voices at the engine rate, the same for both quality tiers
+    int getEngineLatency() const;
 
     // FX
     FxDelay delay;
@@ -109,8 +260,168 @@ private:
 
     StepSequencer stepSeq;
     FxChorus chorus;
+    FxReverb reverb;
+    FxWaveshaper shaper;
+    FxChain fxChain;    //!< runs the effects above on the output
+    FxPipeline fxPipeline;  //!< runs fxChain one block behind the voices, see SynthParams::pipelinedFx
+    SeqFreeze freeze;       //!< plays a static sequence from a recording, see SynthParams::seqFreeze
+    MasterOutput masterOutput;
+    MasterLimiter masterLimiter;    //!< behind the master output, see SynthParams::limiterActivation
+
+    //! \name sample accurate automation
+    /*! A continuous param the host changed since the last block is ramped from its old to its new
+        value across sub-blocks of the block, the snapshot is updated for every sub-block.
+    */
+    ///@{
+    struct AutomationRamp {
+        Param* param;
+        float start;
+        float end;
+    };
+    static const int minSubBlockSize = 64;  //!< shorter sub-blocks cost more than the steps they avoid
+    static const int maxSubBlocks = 16;
+    std::array<AutomationRamp, SynthParams::maxBlockEvents> automationRamps;
+    int numAutomationRamps;
+
+    //! \brief the ramps of the host changes of the block, returns their number
+    int collectAutomationRamps();
+    //! \brief voices and fx of a range of the block, with the snapshot of that range, into a buffer with the channels of all buses
+    void renderRange(AudioSampleBuffer& buffer, MidiBuffer& midiMessages, int startSample, int numSamples, int latency);
+    ///@}
+
+    //! \brief voices and fx of the whole block through the fx pipeline, the fx of the block before run with them
+    void renderPipelined(AudioSampleBuffer& buffer, MidiBuffer& midiMessages, int latency);
+
+    //! \name stages of a block
+    /*! processBlock() is the three of them in a row, processBlockBatch() renders the voices of
+        several processors between their first and their last stage.
+    */
+    ///@{
+    struct BlockState {
+        int64 startTicks;
+        int latency;                    //!< of the voices at the engine rate
+        bool resample;                  //!< the engine resampler runs
+        AudioSampleBuffer* engineBuffer;    //!< the channels of all buses
+        MidiBuffer* midi;               //!< the midi of the host, the sequencer and the keyboard
+        int numSubBlocks;               //!< of the automation ramps
+    };
+    //! \brief host info, events, patches and snapshot of the block, false if the idle instance skips it
+    bool beginBlock(AudioSampleBuffer& buffer, MidiBuffer& midiMessages, BlockState& block);
+    //! \brief voices and fx into the engine buffer
+    void renderBlock(BlockState& block);
+    //! \brief resampler, master stage, telemetry and cpu budget
+    void endBlock(AudioSampleBuffer& buffer, const BlockState& block);
+    //! \brief the block renders in lock-step with the one of another processor
+    bool canRenderInBatch(const BlockState& block, const BlockState& lead) const;
+    ///@}
+
+    //! \name warm-up
+    /*! The first note after a prepare or a restored state was the most expensive block: its
+        kernels, filter designs and effects ran from cold caches and the tables of its waveforms
+        were touched for the first time. warmUp() plays a few notes across the keyboard through
+        the voices and the effects of the patch into a scratch buffer, throws the output away and
+        stops the notes, resets the effects and the sources. The audio thread must not render
+        meanwhile: prepareToPlay() runs before the device starts, setStateInformation() suspends
+        the processing for it.
+    */
+    ///@{
+    void warmUp();
+    static const int warmUpBlocks = 8;          //!< with the notes held, two more render their release
+    ///@}
+
+    //! \name output buses
+    /*! A host that opens eight outputs gets the stems of the patch next to the main mix on the
+        first pair: the voices before the effects and what the delay and the chorus add at their
+        place in the fx chain, so a part is mixed separately without an instance per effect.
+        Every bus is a stereo pair, at twice its eOutputBus. The voices, the effects and the
+        master stage only see the channels of the main bus, the stems are written straight into
+        the channels of their bus in the engine buffer, which is the buffer of the host unless
+        the resampler or the fx pipeline carry it there. The stems are taken before the master
+        volume, the limiter and the audition.
+    */
+    ///@{
+    enum eOutputBus {
+        eMainBus = 0,
+        eDryBus,            //!< the voices
+        eDelayReturnBus,
+        eChorusReturnBus,
+        nOutputBuses
+    };
+    //! \brief channels the voices and the effects render into, one or two
+    int getNumMainChannels() const { return jmin(getNumOutputChannels(), 2); }
+    //! \brief the effects of a range of a buffer with the channels of all buses, the stems into their buses
+    void processEffects(AudioSampleBuffer& buffer, int startSample, int numSamples);
+    ///@}
+
+    //! \brief hands voices, effects and midi events of a block above the deadline threshold to the monitor
+    void reportDeadlineIncident(const MidiBuffer& midiMessages, int numSamples, float load);
+
+    //! \name part channel
+    /*! With a midi channel set, the synth is one part of a multitimbral setup: several instances
+        on one midi track, each with its own patch, play the channel they are set to.
+    */
+    ///@{
+    MidiBuffer partMidi;    //!< scratch of filterMidiChannel(), sized in prepareToPlay()
+    //! \brief drops the channel messages of the other channels, the system messages stay
+    void filterMidiChannel(MidiBuffer& midiMessages);
+    ///@}
+
+    //! \name engine midi
+    /*! The sequencer and the on-screen keyboard add their notes to a list of a fixed size. A block
+        with such notes renders from a merge of them and the midi of the host, in a buffer whose
+        storage is reserved in prepareToPlay(), so the buffer of the host never grows.
+    */
+    ///@{
+    MidiEventList generatedMidi;
+    MidiBuffer engineMidi;
+    ///@}
+
+    //! \name programs
+    ///@{
+    FactoryBank factoryBank;
+    std::atomic<int> currentProgram;
+    std::atomic<int> pendingProgram;    //!< set by setCurrentProgram(), applied by the next block, -1 if none
+    //! \brief applies a parsed program, false while the bank is not parsed yet
+    bool applyProgram(int index);
+    ///@}
+
+    int denormalCount;  //!< see getDenormalCount()
+
+    //! \name suspension and bypass
+    /*! A block that ends without voices, with the sequencer stopped, every effect asleep and a
+        silent output leaves nothing to render. The following blocks only clear the output until
+        midi, a param change, a patch, a program or a playing host transport for the synced
+        sequencer arrives. The host and the editor see the transport of the last rendered block.
+    */
+    ///@{
+    bool idle;                  //!< the last rendered block left nothing to play
+    //! \brief nothing wakes the instance for this block, cheaper than the first stage of a block
+    bool canSkipBlock(const MidiBuffer& midiMessages);
+    //! \brief the state of idle at the end of a rendered block
+    bool isIdle(const AudioSampleBuffer& buffer);
+
+    constexpr static double bypassFadeSeconds = .005;
+    bool bypassed;              //!< the fade-out is done, the notes are stopped and the effects reset
+    bool renderingFade;         //!< processBlock() is called by processBlockBypassed()
+    int bypassFadeRemaining;    //!< samples of the fade-out still to render
+    MidiBuffer bypassMidi;      //!< empty, the fade-out plays no new notes
+    ///@}
+
+    //! \brief the position of the host, or of the midi clock in the block without one
+    void updateHostInfo(const MidiBuffer& midiMessages, int numSamples);
+    bool hostPositionFailing = false;   //!< the play head gave no position in the last block
+    MidiClock midiClock;                //!< clock of external gear, the transport of the standalone
+
+    SessionCapture capture;     //!< what reaches processBlock, only with SYNISTER_CAPTURE_DIR
+
+    //! \name budget of all instances, see SynthParams::cpuVoiceLimit
+    ///@{
+    SharedResourcePointer<InstanceBudget> instanceBudget;
+    int budgetSlot;             //!< -1 if the process has maxInstances already
+    ///@}
 
-    void updateHostInfo();
+    //! formats what the audio thread logs with RtLog
+    SharedResourcePointer<RtLog::Writer> logWriter;
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PluginAudioProcessor)
 };
@@ -0,0 +1,98 @@
+/*
+  ==============================================================================
+
+    PresetBank.h
+    Created: 16 Oct 2026 4:05:31pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef PRESETBANK_H_INCLUDED
+#define PRESETBANK_H_INCLUDED
+
+#include "JuceHeader.h"
+
+class SynthParams;
+struct PatchValues;
+
+//! PresetBank: many patches in one file that is mapped into memory instead of parsed
+/*! The file starts with a header, the ids of the params of its columns and an index with the
+    name, the tags and the sample files of every preset in a table of UTF-8 strings. The values
+    follow as records of one size: flags, a float per column and the steps of the sequencer.
+    Listing and searching the presets only reads the index, loading one reads its record and
+    matches the columns by the param ids of the binary chunk, so a bank of a newer version with
+    more params still loads. Params a patch did not contain are stored as NaN and keep their value
+    like with the XML patch. Little endian like the binary chunk.
+    The file is mapped read-only and shared by everyone who holds the bank.
+*/
+class PresetBank : public ReferenceCountedObject {
+public:
+    typedef ReferenceCountedObjectPtr<PresetBank> Ptr;
+
+    //! \brief maps the file, nullptr if it is no bank or damaged
+    static Ptr open(const File& file);
+
+    //! \brief writes the patch files to a bank, in their order, returns an error message or an empty string
+    static String write(const Array<File>& patches, const File& dst, const SynthParams& params);
+
+    static const char* const fileExtension;     //!< ".synbank"
+
+    const File& getFile() const { return file; }
+    int getNumPresets() const { return numPresets; }
+    //! \brief version of the synth that wrote the bank
+    float getSynthVersion() const { return synthVersion; }
+
+    //! \name the index, any thread
+    ///@{
+    String getName(int preset) const;
+    StringArray getTags(int preset) const;
+    //! \brief the presets whose name or one of whose tags contain the text, ignoring case
+    void search(const String& text, Array<int>& dst) const;
+    ///@}
+
+    //! \brief the values of a preset like SynthParams::parsePatch(), maps its samples, not on the audio thread
+    bool readPreset(int preset, const SynthParams& params, PatchValues& dst) const;
+
+    static const int numSampleSlots = 3;
+
+private:
+    PresetBank(const File& f, MemoryMappedFile* m);
+
+    //! \brief the offset and the length of a string of the index
+    struct StringRef {
+        uint32 offset;
+        uint32 length;
+    };
+    //! \brief the strings of a preset in the index
+    enum eIndexString { eName = 0, eTags, eFirstSample, nIndexStrings = eFirstSample + numSampleSlots };
+
+    uint32 readInt(size_t offset) const;
+    String getString(int preset, int which) const;
+    //! \brief checks that all offsets of the header are inside the file
+    bool validate();
+
+    const File file;
+    ScopedPointer<MemoryMappedFile> mapped;
+    const char* data;
+    size_t size;
+
+    int numPresets;
+    int numColumns;
+    float synthVersion;
+    size_t recordSize;
+    size_t columnsOffset;
+    size_t indexOffset;
+    size_t stringsOffset;
+    size_t stringsSize;
+    size_t recordsOffset;
+
+    static const uint32 magic = 0x4b425953;     //!< "SYBK"
+    static const uint32 formatVersion = 1;
+    static const int headerInts = 12;
+    static const uint32 hasPatternFlag = 1;
+
+    JUCE_DECLARE_NON_COPYABLE(PresetBank)
+};
+
+#endif  // PRESETBANK_H_INCLUDED
@@ -0,0 +1,68 @@
+/*
+  ==============================================================================
+
+    RealtimeCheck.h
+    Created: 15 Oct 2026 4:21:36am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef REALTIMECHECK_H_INCLUDED
+#define REALTIMECHECK_H_INCLUDED
+
+#include "JuceHeader.h"
+
+//! build with SYNISTER_REALTIME_CHECKS=1 to report what the audio thread must not do
+/*! Allocations, frees and mutex locks are hooked while a thread renders audio:
+    malloc and pthread_mutex_lock on Linux, the debug heap on Windows, operator new and delete
+    elsewhere. Calls the hooks cannot see, like listener calls, are marked in the code with
+    RealtimeCheck::violation(). Every violation is counted, the backtrace of each distinct
+    one is written to the log once. Reporting allocates, so the timing of a checked build
+    means nothing. The hooks also count the allocations of every thread.
+*/
+#ifndef SYNISTER_REALTIME_CHECKS
+ #define SYNISTER_REALTIME_CHECKS 0
+#endif
+
+namespace RealtimeCheck {
+#if SYNISTER_REALTIME_CHECKS
+    //! marks the calling thread as rendering audio for the lifetime of the object, nests
+    struct ScopedAudioThread {
+        ScopedAudioThread();
+        ~ScopedAudioThread();
+    };
+
+    //! exempts the calling thread for the lifetime of the object, for known and accepted cases
+    struct ScopedAllow {
+        ScopedAllow();
+        ~ScopedAllow();
+    };
+
+    //! \brief reports what if the calling thread renders audio
+    void violation(const char* what);
+
+    //! \brief violations of all threads since the start
+    int getViolationCount();
+
+    //! \brief allocations of all threads since the start, on any thread, e.g. for the cost of a setup
+    int64 getAllocationCount();
+#else
+    struct ScopedAudioThread {
+        ScopedAudioThread() {}
+    };
+
+    struct ScopedAllow {
+        ScopedAllow() {}
+    };
+
+    inline void violation(const char*) {}
+
+    inline int getViolationCount() { return 0; }
+
+    //! without the hooks nothing is counted
+    inline int64 getAllocationCount() { return -1; }
+#endif
+}
+
+#endif  // REALTIMECHECK_H_INCLUDED
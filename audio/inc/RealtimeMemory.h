@@ -0,0 +1,59 @@
+/*
+  ==============================================================================
+
+    RealtimeMemory.h
+    Created: 17 Oct 2026 3:41:09pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef REALTIMEMEMORY_H_INCLUDED
+#define REALTIMEMEMORY_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <vector>
+
+//! RealtimeMemory: faults in the memory the audio thread renders into, and locks it into RAM on request
+/*! A calloc of the engine gets pages the system maps on the first write, which the audio
+    thread would then take during the first note after a load. add() writes every page of a
+    region back with what it holds, while the audio thread does not render, so nothing of it
+    faults later. With locking the pages are also kept from being paged out while the machine
+    is idle; the regions are unlocked by clear(), before their memory is freed or reallocated.
+    A lock the system refuses, e.g. above the limit of the user, leaves the region faulted in
+    and writes a warning to the log.
+*/
+class RealtimeMemory {
+public:
+    RealtimeMemory() : locking(false) {}
+    ~RealtimeMemory() { clear(); }
+
+    //! \brief whether the regions added from now on are locked into RAM
+    void setLocking(bool shouldLock) { locking = shouldLock; }
+    bool isLocking() const { return locking; }
+
+    //! \brief faults in every page of the region, and locks it if locking is set, not on the audio thread
+    void add(void* data, size_t bytes);
+    //! \brief unlocks every region, not on the audio thread
+    void clear();
+
+    //! \brief bytes of the regions that are locked, any thread but the audio thread
+    int64 getLockedBytes() const;
+
+    //! \brief writes every page of the region with what it holds
+    static void touchPages(void* data, size_t bytes);
+
+private:
+    struct Region {
+        void* data;
+        size_t bytes;
+    };
+
+    bool locking;
+    CriticalSection regionLock;     //!< FxBuffer adds on a background thread
+    std::vector<Region> locked;
+
+    JUCE_DECLARE_NON_COPYABLE(RealtimeMemory)
+};
+
+#endif  // REALTIMEMEMORY_H_INCLUDED
@@ -0,0 +1,45 @@
+/*
+  ==============================================================================
+
+    RealtimeScheduling.h
+    Created: 16 Oct 2026 11:08:19pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef REALTIMESCHEDULING_H_INCLUDED
+#define REALTIMESCHEDULING_H_INCLUDED
+
+#include "JuceHeader.h"
+
+//! RealtimeScheduling: the scheduling class of audio threads for the threads of the engine
+/*! The host schedules its audio thread like that of a driver, a worker that renders voices for
+    it at normal priority is preempted under load and the block waits for its last voice. This
+    asks the system for the class of audio threads: MMCSS "Pro Audio" on Windows, the time
+    constraint policy with the duration of a block as period on macOS, round robin at the
+    highest priority elsewhere. Where that is refused, e.g. without the rights for real-time
+    priorities on Linux, the thread stays a normal thread at the highest priority it can get
+    and the refusal is counted and logged with RtLog.
+    The audio workgroup of the host on macOS is not reachable through the plugin wrappers of
+    this JUCE version, the time constraint policy is what the workers get there.
+*/
+namespace RealtimeScheduling {
+    //! \brief promotes the calling thread, periodSeconds is the duration of a block or 0 if not known, false on a fallback
+    bool promoteCurrentThread(double periodSeconds);
+
+    //! \name diagnostics of all requests of the process, any thread
+    ///@{
+    int getNumPromoted();
+    int getNumFailed();
+    //! \brief the code of the system of the last refusal, 0 if none
+    int getLastError();
+    //! \brief e.g. "real-time scheduling: 7 granted, 1 refused (error 1)", message thread
+    String getReport();
+    ///@}
+
+    //! period assumed before a block size is known, 128 samples at 48 kHz
+    constexpr static double defaultPeriod = 128. / 48000.;
+}
+
+#endif  // REALTIMESCHEDULING_H_INCLUDED
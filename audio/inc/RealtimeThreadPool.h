@@ -0,0 +1,136 @@
+/*
+  ==============================================================================
+
+    RealtimeThreadPool.h
+    Created: 15 Oct 2026 1:14:26pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef REALTIMETHREADPOOL_H_INCLUDED
+#define REALTIMETHREADPOOL_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <atomic>
+
+//! RealtimeThreadPool: one pool of high priority workers for every instance in the process
+/*! Held with a SharedResourcePointer, so the workers start with the first user and stop with
+    the last one, one per core but the first however many instances there are. A render call
+    hands its jobs to the pool as a Batch and runs them itself as well, the idle workers join in.
+    The jobs of a batch are split into one range per participant: a participant takes jobs from
+    the front of its own range and, once that is empty, steals from the back of the others, so
+    a slow voice on one core does not keep the other cores waiting. The batches of several
+    instances run at the same time, the host may call them from its own threads.
+    Waiting is bounded spinning first: a worker without jobs spins workerSpins rounds and then
+    sleeps until the next batch, the caller spins callerSpins rounds for the jobs still running
+    and then yields, so instances that process in parallel do not keep each other's cores busy.
+    The standalone may limit the workers that take part and place them, see configureWorkers().
+    The workers ask for the scheduling class of audio threads when they start and whenever a
+    shorter block period is announced, see RealtimeScheduling and setBlockPeriod().
+*/
+class RealtimeThreadPool {
+public:
+    //! jobs of one render call, lives on the stack of the caller for the duration of run()
+    class Batch {
+    public:
+        typedef void (*JobFunction)(void* context, int job);
+
+        //! \brief function(context, j) for every j in [0..numJobs), from any thread of the pool
+        Batch(JobFunction function, void* context, int numJobs);
+
+    private:
+        friend class RealtimeThreadPool;
+
+        //! \brief splits the jobs into ranges for numParticipants threads
+        void split(int numParticipants);
+        //! \brief runs jobs of the given range and steals from the others until none is left, true if any job ran
+        bool work(int range);
+        bool pop(int range, int& job);
+        bool steal(int range, int& job);
+
+        static const int maxRanges = 16;
+
+        const JobFunction jobFunction;
+        void* const jobContext;
+        const int numJobs;
+        int numRanges;
+        std::atomic<uint64> ranges[maxRanges];  //!< first job | end << 32, the owner moves the first, thieves the end
+        std::atomic<int> remaining;             //!< jobs not finished yet
+
+        JUCE_DECLARE_NON_COPYABLE(Batch)
+    };
+
+    RealtimeThreadPool();
+    ~RealtimeThreadPool();
+
+    int getNumWorkers() const { return workers.size(); }
+
+    //! called by a worker on its own thread, e.g. to pin it to a core, worker is 1 based
+    typedef void (*WorkerSetup)(void* context, int worker);
+
+    //! \brief only the first numWorkers workers take part in the batches from now on, the others sleep
+    /*! Every worker calls setup once on its own thread before it works on the next batch, a
+        setup of nullptr leaves the threads as they are. No worker calls the previous setup
+        after this returns.
+    */
+    void configureWorkers(int numWorkers, WorkerSetup setup, void* context);
+
+    //! \brief the shortest block duration of the instances so far, the period of the real-time scheduling of the workers, message thread
+    void setBlockPeriod(double seconds);
+
+    //! \brief audio thread: runs all jobs of the batch on the calling thread and the idle workers, returns when they are done
+    void run(Batch& batch);
+
+    static const int workerSpins = 2000;    //!< rounds a worker looks for jobs before it sleeps
+    static const int callerSpins = 4000;    //!< rounds the caller waits for running jobs before it yields
+    static const int maxBatches = 64;       //!< batches in flight, the render calls beyond them run on their own thread
+
+private:
+    class Worker : public Thread {
+    public:
+        Worker(RealtimeThreadPool& p, int i);
+        void run() override;
+
+        WaitableEvent wakeEvent;
+        std::atomic<bool> sleeping;
+    private:
+        RealtimeThreadPool& pool;
+        const int index;    //!< 1 based, the caller of a batch is participant 0
+        int setupGeneration;
+        int periodGeneration;
+    };
+
+    //! \brief works on every published batch, true if any job ran
+    bool workOnBatches(int participant);
+    //! \brief calls the setup for the worker if it changed since the worker saw it
+    void setUpWorker(int worker, int& generation);
+    //! \brief asks for real-time scheduling with the block period if it changed since the worker saw it
+    void scheduleWorker(int& generation);
+
+    OwnedArray<Worker> workers;
+    std::atomic<int> numActiveWorkers;
+
+    //! \name the setup of configureWorkers()
+    ///@{
+    SpinLock setupLock;
+    WorkerSetup workerSetup;
+    void* setupContext;
+    std::atomic<int> setupGeneration;
+    ///@}
+
+    std::atomic<double> blockPeriod;    //!< s, 0 before the first instance announced one
+    std::atomic<int> periodGeneration;
+
+    //! \name published batches: a worker counts itself in users[i] before it reads batches[i], the caller
+    //! clears the slot and waits for its users to leave before the batch goes out of scope
+    ///@{
+    std::atomic<Batch*> batches[maxBatches];
+    std::atomic<int> users[maxBatches];
+    std::atomic<int> numPublished;
+    ///@}
+
+    JUCE_DECLARE_NON_COPYABLE(RealtimeThreadPool)
+};
+
+#endif  // REALTIMETHREADPOOL_H_INCLUDED
@@ -0,0 +1,68 @@
+/*
+  ==============================================================================
+
+    RtLog.h
+    Created: 16 Oct 2026 6:48:35pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef RTLOG_H_INCLUDED
+#define RTLOG_H_INCLUDED
+
+#include "JuceHeader.h"
+
+//! RtLog: diagnostics from the audio thread without locks or allocations
+/*! A message is a fixed size record in a ring of the process: the level, a literal format with
+    "{}" for its values, up to four numbers and a short text that is copied. The threads claim
+    the records with an atomic counter like the spans of Trace, so the audio thread and the voice
+    workers log in constant time. The Writer formats them on its own thread, into the file the
+    environment variable SYNISTER_LOG_FILE names and, in debug builds, to the debug console.
+    Without a Writer the records are overwritten, messages the Writer could not keep up with are
+    counted as dropped.
+*/
+namespace RtLog {
+    enum class eLevel : uint8 {
+        eInfo = 0,
+        eWarning,
+        eError
+    };
+
+    static const int maxTextBytes = 48;     //!< of the text of a record, with the terminating 0
+
+    //! \brief logs the numbers into the "{}" of the format, any thread, the format must be a literal
+    void write(eLevel level, const char* format, double a = 0., double b = 0., double c = 0., double d = 0.);
+    //! \brief like write(), the first "{}" is the text, which is copied and cut at maxTextBytes
+    void writeText(eLevel level, const char* format, const char* text, double a = 0., double b = 0., double c = 0.);
+
+    //! \brief messages overwritten before the Writer formatted them
+    int64 getNumDropped();
+
+    //! formats the records on a background thread, shared by all instances of the process
+    class Writer : private TimeSliceClient {
+    public:
+        Writer();
+        ~Writer();
+
+        //! \brief appends the messages to the file, File::nonexistent for none
+        void setFile(const File& file);
+        void setConsoleOutput(bool shouldWrite);
+
+    private:
+        int useTimeSlice() override;
+        //! writes the complete records, with outputLock
+        void drain();
+
+        TimeSliceThread thread;
+        uint64 tail;                    //!< next record to write, writer thread
+
+        CriticalSection outputLock;
+        ScopedPointer<FileOutputStream> output;
+        bool console;
+
+        JUCE_DECLARE_NON_COPYABLE(Writer)
+    };
+}
+
+#endif  // RTLOG_H_INCLUDED
@@ -0,0 +1,149 @@
+/*
+  ==============================================================================
+
+    SampleLibrary.h
+    Created: 15 Oct 2026 2:41:18pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef SAMPLELIBRARY_H_INCLUDED
+#define SAMPLELIBRARY_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <atomic>
+
+//! MappedSample: a wav or aiff file mapped into memory, read as mono
+/*! The file is mapped once for the whole process, the pages are touched when it is loaded so
+    the first notes do not wait for the disk. Reading is const and thread safe.
+*/
+class MappedSample {
+public:
+    MappedSample(const File& f, MemoryMappedAudioFormatReader* r);
+
+    const File& getFile() const { return file; }
+    double getSampleRate() const { return reader->sampleRate; }
+    int64 getLength() const { return reader->lengthInSamples; }
+
+    //! \brief mono frame i, the mean of the channels of a stereo file
+    float getFrame(int64 i) const {
+        float frame[2];
+        reader->getSample(i, frame);
+        return reader->numChannels == 2 ? .5f * (frame[0] + frame[1]) : frame[0];
+    }
+
+    //! \brief touches the pages of the first numSamples frames, pages that are resident cost one read each
+    void prefetch(int64 numSamples) const;
+
+private:
+    File file;
+    ScopedPointer<MemoryMappedAudioFormatReader> reader;
+
+    JUCE_DECLARE_NON_COPYABLE(MappedSample)
+};
+
+//! SampleLibrary: the mapped samples of all instances, see SampleSlot
+/*! A file is mapped on its first request and then shared, so the memory of a sample does not
+    grow with the instances that play it. The samples stay mapped until the last instance is
+    gone, so the audio thread can read a sample it got once without holding a reference.
+*/
+class SampleLibrary {
+public:
+    SampleLibrary();
+
+    //! \brief the mapped sample of a mono or stereo wav or aiff file, blocks while the file is mapped
+    Result load(const File& file, const MappedSample*& sample);
+
+    //! \brief bytes of the mapped files
+    int64 getMappedBytes() const;
+
+private:
+    CriticalSection lock;   //!< of the mapped samples
+    AudioFormatManager formats;
+    OwnedArray<MappedSample> samples;
+
+    JUCE_DECLARE_NON_COPYABLE(SampleLibrary)
+};
+
+//! SampleSlot: the sample an oscillator plays
+/*! Loaded on the message or the patch loader thread, a voice takes the sample at the start of a
+    note. Keeps the library alive for the instance.
+*/
+class SampleSlot {
+public:
+    SampleSlot() : sample(nullptr) {}
+
+    //! \brief maps the file and plays it from the next note, the old sample stays on failure
+    Result load(const File& file);
+
+    //! \brief sets a sample of the library, nullptr for none; called by the audio thread for a patch
+    void set(const MappedSample* s) { sample.store(s, std::memory_order_release); }
+
+    const MappedSample* get() const { return sample.load(std::memory_order_acquire); }
+
+    //! \brief file of the sample, File::nonexistent without one
+    File getFile() const;
+
+    //! \brief the library all slots load from
+    SampleLibrary& getLibrary() const { return *library; }
+
+private:
+    SharedResourcePointer<SampleLibrary> library;
+    std::atomic<const MappedSample*> sample;
+
+    JUCE_DECLARE_NON_COPYABLE(SampleSlot)
+};
+
+//! SampleOscillator: plays a sample once from its start, with linear interpolation for the pitch
+/*! At the root note, middle C without coarse and fine tune, the sample plays at its own rate. */
+class SampleOscillator {
+public:
+    SampleOscillator() : sample(nullptr), position(0.), increment(0.) {}
+
+    //! \brief starts the sample of the slot at its beginning and prefetches the first prefetchTime
+    void start(const MappedSample* s, float noteFreq, float oscRate) {
+        sample = s;
+        position = 0.;
+        setFrequency(noteFreq, oscRate);
+        if (sample != nullptr) {
+            sample->prefetch(static_cast<int64>(prefetchTime * sample->getSampleRate()));
+        }
+    }
+
+    //! \brief frequency of the note incl. coarse and fine tune, at the rate of the oscillator
+    void setFrequency(float noteFreq, float oscRate) {
+        increment = sample != nullptr ? noteFreq / rootFrequency * sample->getSampleRate() / oscRate : 0.;
+    }
+
+    //! \brief renders n samples, sample s uses the pitch modulation factor of sample s >> shift, silence after the end
+    void render(float *out, const float *pitchMod, int n, int shift) {
+        const int64 last = sample != nullptr ? sample->getLength() - 1 : 0;
+        int s = 0;
+        for (; s < n && position < static_cast<double>(last); ++s) {
+            const int64 i = static_cast<int64>(position);
+            const float frac = static_cast<float>(position - static_cast<double>(i));
+            const float a = sample->getFrame(i);
+            out[s] = a + frac * (sample->getFrame(i + 1) - a);
+            position += increment * pitchMod[s >> shift];
+        }
+        FloatVectorOperations::clear(out + s, n - s);
+    }
+
+    //! \brief advances the position like render() over samples whose pitch modulation factors sum to pitchSum
+    void skip(float pitchSum) {
+        position += increment * static_cast<double>(pitchSum);
+    }
+
+    //! frequency of middle C in equal temperament at 440 Hz
+    constexpr static float rootFrequency = 261.625565f;
+    //! s of the sample touched at the start of a note
+    constexpr static double prefetchTime = .25;
+
+private:
+    const MappedSample* sample;
+    double position;    //!< in frames of the sample
+    double increment;   //!< frames per sample of the oscillator without pitch modulation
+};
+
+#endif  // SAMPLELIBRARY_H_INCLUDED
@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+
+    SeqFreeze.h
+    Created: 15 Oct 2026 9:41:52pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef SEQFREEZE_H_INCLUDED
+#define SEQFREEZE_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "NoteCache.h"
+#include "StepSequencer.h"
+
+//! SeqFreeze: one period of a static sequence rendered once and played again instead of its notes
+/*! While the sequencer loops a pattern with a patch nothing but the notes reach, every period
+    of the voices sounds the same once the tails of the previous period are in it. After one
+    clean period the voices of the next one are recorded, from its start to a fade past its end.
+    From the next block on the sequencer notes no longer reach the synth: the voices fade out, the
+    recording fades in and plays at the position of the sequence, its end crossfaded into its start.
+    Notes of the host and the keyboard play on the voices meanwhile, a note held through the
+    recording is in it and loops with it.
+    Any change of a param, the snapshot, a sample, the pattern, the tempo or a restart of the
+    sequence thaws it, the recording fades out and the sequencer plays the voices from its next
+    step on. A host note while it records starts over with a clean period. The patch must not
+    read midi controllers, per note expression or global lfos and the sequencer must not play
+    random notes. The noise and the random lfos of the voices repeat with the recording.
+*/
+class SeqFreeze {
+public:
+    SeqFreeze();
+
+    //! \brief allocates the recording, not on the audio thread
+    void prepare(const SynthParams& params, int numChannels, double sampleRate);
+    //! \brief frees the recording, the freeze stays off until the next prepare()
+    void release();
+
+    //! \name audio thread
+    ///@{
+    /** \brief decides the state of the block, after the sequencer ran
+        @param hostMidi the midi of the host, a note in it restarts a recording
+    */
+    void beginBlock(const SynthParams& params, const StepSequencer& seq, const MidiBuffer& hostMidi, int numSamples);
+    //! \brief a note of the keyboard in the block, like a host note it restarts a recording
+    void notePlayed();
+    //! \brief true if the notes of the sequencer of this block are replaced by the recording
+    bool isFrozen() const { return state == eFrozen; }
+    //! \brief true in the first frozen block, the voices of the sequencer fade out
+    bool isFreezing() const { return state == eFrozen && fadeIn == 0; }
+    //! \brief records the rendered voices of a range of the block or adds the recording to them
+    void processVoices(AudioSampleBuffer& buffer, int startSample, int numSamples);
+    ///@}
+
+    //! \brief true between prepare() and release()
+    bool isPrepared() const { return recording.getNumSamples() > 0; }
+
+    //! \brief bytes of the recording, 0 while it is released
+    int64 getMemoryBytes() const {
+        return static_cast<int64>(recording.getNumChannels()) * recording.getNumSamples() * static_cast<int64>(sizeof(float));
+    }
+
+    //! s of the longest period that is frozen
+    constexpr static double maxSeconds = 16.;
+    //! s of the crossfade of the end of the recording into its start
+    constexpr static double loopFadeSeconds = .01;
+    //! s of the fades between the voices and the recording, the one of a stolen voice
+    constexpr static double switchFadeSeconds = .005;
+
+private:
+    enum eState {
+        eOff,           //!< not prepared, the sequence does not qualify or is not playing
+        eClean,         //!< waiting for a period without changes and host notes
+        eRecording,     //!< from the start of a period to the end of the loop fade
+        eFrozen
+    };
+
+    //! \brief back to eClean, a playing recording fades out
+    void thaw();
+
+    AudioSampleBuffer recording;    //!< a period and the loop fade
+    PatchState lastState;
+    eState state;
+    double sampleRate;
+
+    //! \name the period, fixed while it records and plays
+    ///@{
+    double loopLength;          //!< quarter notes
+    double samplesPerBeat;
+    uint32 patternVersion;      //!< of the events the sequencer plays
+    uint32 numRestarts;
+    int loopSamples;
+    int loopFadeSamples;
+    int switchFadeSamples;
+    ///@}
+
+    //! \name the current block
+    ///@{
+    bool cleanPeriod;           //!< a period without changes and host notes started
+    int recordStart;            //!< sample of the block the recording starts at
+    int recorded;               //!< samples recorded
+    int blockPhase;             //!< position of the block start in the period, in samples
+    int playPhase;              //!< position in the period after the last processed sample
+    int fadeIn;                 //!< samples of the recording faded in since the switch
+    int fadeOut;                //!< remaining samples of the fade out of a thawed recording
+    int fadeOutPhase;           //!< position of the fading out recording
+    int fadeOutLoop;            //!< period of the fading out recording, the new one may differ
+    ///@}
+
+    JUCE_DECLARE_NON_COPYABLE(SeqFreeze)
+};
+
+#endif  // SEQFREEZE_H_INCLUDED
@@ -0,0 +1,149 @@
+/*
+  ==============================================================================
+
+    SeqPattern.h
+    Created: 15 Oct 2026 6:12:37am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef SEQPATTERN_H_INCLUDED
+#define SEQPATTERN_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <array>
+#include <atomic>
+
+//! SeqPattern: note, velocity, gate and mute of every step of the step sequencer
+/*! Each step is packed into one atomic word, so the ui writes a step and the audio thread
+    reads it without a lock and never sees half of one. The version changes with every
+    step that changes, the sequencer rebuilds its events only then. The notes and mutes of
+    the first eight steps are mirrored from the seqStep and seqStepActive params, which
+    the host automates.
+    An edit of several steps or params goes into an edit scope. While it is open the sequencer
+    neither mirrors the params nor reads the steps, readData() only succeeds on a pattern no
+    edit wrote meanwhile, so a half edited pattern never plays.
+*/
+class SeqPattern {
+public:
+    static const int maxSteps = 64;
+
+    struct Step {
+        uint8 note;         //!< midi note in [0..127]
+        uint8 velocity;     //!< midi velocity in [1..127]
+        uint8 gate;         //!< percent of the step length in [1..100]
+        bool active;        //!< false->mute
+    };
+
+    //! all steps packed, the form patches and host chunks store
+    typedef std::array<uint32, maxSteps> Data;
+
+    SeqPattern();
+
+    //! \brief any thread
+    Step getStep(int step) const;
+    //! \brief any thread, changes the version if the step changed
+    void setStep(int step, const Step& s);
+
+    void getData(Data& dst) const;
+    void setData(const Data& src);
+    static void getDefaultData(Data& dst);
+
+    //! \name edit scope, one writing thread, nests
+    ///@{
+    void beginEdit();
+    void endEdit();
+    //! \brief odd while an edit is open, changes with every edit
+    uint32 getSequence() const { return sequence.load(std::memory_order_acquire); }
+    /** \brief audio thread: copies the steps if no edit was open since getSequence() returned since
+        @param since an even value of getSequence() from before the params of the steps were read
+        @param dataVersion the version of the copied steps
+        @return false if an edit interfered, dst is undefined then
+    */
+    bool readData(Data& dst, uint32& dataVersion, uint32 since) const;
+
+    class ScopedEdit {
+    public:
+        explicit ScopedEdit(SeqPattern& p) : pattern(p) { pattern.beginEdit(); }
+        ~ScopedEdit() { pattern.endEdit(); }
+    private:
+        SeqPattern& pattern;
+        JUCE_DECLARE_NON_COPYABLE(ScopedEdit)
+    };
+    ///@}
+
+    //! \brief changes whenever a step changes
+    uint32 getVersion() const { return version.load(std::memory_order_acquire); }
+
+    //! \name patch attribute: eight hex digits per step
+    ///@{
+    static String toString(const Data& src);
+    //! \brief false if the string is no pattern, dst is unchanged then
+    static bool fromString(const String& s, Data& dst);
+    ///@}
+
+    static uint32 pack(const Step& s);
+    static Step unpack(uint32 packed);
+
+private:
+    std::array<std::atomic<uint32>, maxSteps> steps;
+    std::atomic<uint32> version;
+    std::atomic<uint32> sequence;   //!< odd while an edit is open
+    int editDepth;                  //!< of the writing thread
+
+    JUCE_DECLARE_NON_COPYABLE(SeqPattern)
+};
+
+//! SeqNoteQueue: lock free queue of the notes the random play mode draws, audio thread -> message thread
+/*! The steps keep their notes, the queue only tells the ui which note a step played.
+    A full queue drops the note, the next one of the step shows instead.
+*/
+class SeqNoteQueue {
+public:
+    //! a drawn note of a step
+    struct Note {
+        int step;   //!< index into the pattern
+        int note;   //!< midi note in [0..127]
+    };
+
+    explicit SeqNoteQueue(int capacity = 256)
+        : fifo(capacity)
+        , notes(static_cast<size_t>(capacity))
+    {}
+
+    //! \brief audio thread, false if the queue is full
+    bool push(int step, int note) {
+        int start1, size1, start2, size2;
+        fifo.prepareToWrite(1, start1, size1, start2, size2);
+        if (size1 == 0) {
+            return false;
+        }
+        notes[start1].step = step;
+        notes[start1].note = note;
+        fifo.finishedWrite(1);
+        return true;
+    }
+
+    //! \brief message thread, moves up to maxNotes into dst in the order they were pushed
+    int pop(Note* dst, int maxNotes) {
+        int start1, size1, start2, size2;
+        fifo.prepareToRead(maxNotes, start1, size1, start2, size2);
+        for (int i = 0; i < size1; ++i) {
+            dst[i] = notes[start1 + i];
+        }
+        for (int i = 0; i < size2; ++i) {
+            dst[size1 + i] = notes[start2 + i];
+        }
+        fifo.finishedRead(size1 + size2);
+        return size1 + size2;
+    }
+
+private:
+    AbstractFifo fifo;
+    HeapBlock<Note> notes;
+
+    JUCE_DECLARE_NON_COPYABLE(SeqNoteQueue)
+};
+
+#endif  // SEQPATTERN_H_INCLUDED
@@ -0,0 +1,111 @@
+/*
+  ==============================================================================
+
+    SessionCapture.h
+    Created: 16 Oct 2026 11:47:02pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef SESSIONCAPTURE_H_INCLUDED
+#define SESSIONCAPTURE_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "ParamEventQueue.h"
+#include "BackgroundJobs.h"
+#include <atomic>
+#include <vector>
+
+//! SessionCapture: everything that reaches processBlock in a session, in a compact file for a replay
+/*! A synthetic benchmark plays what we thought of, a capture what a user played when the load
+    spiked. The file starts with the rate, the block size and the channels of prepareToPlay and
+    the state of the plugin at that moment. Every block adds a record of its size, the transport
+    of the play head, the changes the host made through HostParam::setValue() since the last
+    block, as they were drained for the block, and its midi before the channel filter. Changes
+    of the editor are not recorded, a capture is meant to be made without one.
+    The audio thread packs a record into a scratch buffer and copies it into a ring, a job of
+    BackgroundJobs writes the ring to the file, so a slow disk drops blocks rather than the audio
+    thread waiting; the dropped blocks are counted in the end record of the file. start() and
+    stop() belong to prepareToPlay() and releaseResources(), a host does not call them while
+    a block is processed.
+    With the environment variable SYNISTER_CAPTURE_DIR set every prepareToPlay() of every
+    instance starts a capture into a new file in that folder. The standalone replays a file with
+    "--replay", see SessionReplay.
+*/
+class SessionCapture : private TimeSliceClient {
+public:
+    //! a change of the host, as SynthParams::drainParamEvents() saw it
+    struct ParamChange {
+        int index;      //!< in SynthParams::serializeParams
+        float value;    //!< engine value
+    };
+
+    //! a recorded block
+    struct Block {
+        int numSamples;
+        bool nonRealtime;
+        bool hasPosition;       //!< false if the play head gave no position or the block was skipped as idle
+        AudioPlayHead::CurrentPositionInfo position;
+        std::vector<ParamChange> params;
+        MidiBuffer midi;
+    };
+
+    //! a whole capture in memory
+    struct Session {
+        double sampleRate = 0.;
+        int maxBlockSize = 0;
+        int numChannels = 0;
+        MemoryBlock state;      //!< of getStateInformation() when the capture started
+        std::vector<Block> blocks;
+        int64 droppedBlocks = 0; //!< -1 if the file ended without its end record
+    };
+
+    SessionCapture();
+    ~SessionCapture();
+
+    //! \brief opens the file and writes the header, stops a running capture first
+    Result start(const File& file, const MemoryBlock& state, double sampleRate, int maxBlockSize, int numChannels);
+    //! \brief writes what is left and the end record, closes the file
+    void stop();
+
+    bool isCapturing() const { return capturing.load(std::memory_order_relaxed); }
+    //! \brief blocks the ring had no room for since start()
+    int64 getDroppedBlocks() const { return droppedBlocks.load(); }
+
+    //! \brief audio thread: records a block, position nullptr if there was none
+    /*! @param events the host changes of the block
+        @param paramIndex maps the param of an event to its index, -1 to leave it out
+    */
+    void writeBlock(int numSamples, bool nonRealtime, const AudioPlayHead::CurrentPositionInfo* position,
+                    const ParamEvent* events, int numEvents, const std::vector<Param*>& params, const MidiBuffer& midi);
+
+    //! \brief a new file with the time of day in the folder of SYNISTER_CAPTURE_DIR, File::nonexistent if it is not set
+    static File createCaptureFile();
+
+    //! \brief parses a file written by a capture
+    static Result read(const File& file, Session& session);
+
+    static const int ringBytes = 4 << 20;       //!< of the ring, seconds of dense midi and automation
+    static const int maxRecordBytes = 64 << 10; //!< of a block, a longer one is dropped
+
+private:
+    int useTimeSlice() override;
+    //! \brief writes the ring to the file, with outputLock
+    void drain();
+
+    SharedResourcePointer<BackgroundJobs> jobs;
+    AbstractFifo fifo;
+    HeapBlock<uint8> ring;
+    HeapBlock<uint8> scratch;   //!< the record of a block, audio thread
+
+    CriticalSection outputLock;
+    ScopedPointer<FileOutputStream> output;
+
+    std::atomic<bool> capturing;
+    std::atomic<int64> droppedBlocks;
+
+    JUCE_DECLARE_NON_COPYABLE(SessionCapture)
+};
+
+#endif  // SESSIONCAPTURE_H_INCLUDED
@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+
+    SimdKernels.h
+    Created: 15 Oct 2026 11:48:52am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef SIMDKERNELS_H_INCLUDED
+#define SIMDKERNELS_H_INCLUDED
+
+// deliberately without JuceHeader.h: the AVX kernels are compiled with AVX code generation, an
+// inline function of a shared header compiled there could be the copy the linker keeps
+#include <cstdint>
+
+//! SimdKernels: inner loops of the lane banks and the effects, compiled for several instruction sets
+/*! get() fills the table on the first call with the best kernels for
+    CpuFeatures::getSelected(), every kernel has a scalar version that the others fall back
+    to. The lanes are those of VoiceBank and FilterBank: the state of lane l is at [l], sample s
+    of lane l of an interleaved block at [s * laneStride + l]. A kernel renders at least the
+    first numLanes lanes, a multiple of laneGroup, so a group of four voices costs half of eight
+    with 4 wide registers. The AVX kernels always render all eight, they are one register, so
+    the unused lanes must hold valid state and samples. The vector versions use no fused multiply-add and the order of operations of
+    the scalar ones, all of them render the same samples, bit for bit.
+*/
+struct SimdKernels {
+    static const int laneStride = 8;    //!< one AVX register, two SSE or NEON registers
+    static const int laneGroup = 4;
+
+    //! \brief lanes a kernel renders for n voices
+    static int roundUpLanes(int n) { return (n + laneGroup - 1) / laneGroup * laneGroup; }
+
+    //! state of the oscillator lanes
+    struct OscillatorLanes {
+        float phase[laneStride];
+        float phaseDelta[laneStride];
+        float shape[laneStride];
+    };
+
+    //! coefficients, their ramp steps and the delays of the biquad lanes
+    struct BiquadLanes {
+        float b0[laneStride], b1[laneStride], b2[laneStride], a1[laneStride], a2[laneStride];
+        float db0[laneStride], db1[laneStride], db2[laneStride], da1[laneStride], da2[laneStride];
+        float x1[laneStride], x2[laneStride], y1[laneStride], y2[laneStride];
+    };
+
+    //! one biquad on interleaved stereo frames, both channels share the coefficients
+    struct StereoBiquad {
+        float b0, b1, b2, a1, a2;
+        float x1[2], x2[2], y1[2], y2[2];   //!< left, right
+    };
+
+    typedef void (*OscillatorKernel)(OscillatorLanes& osc, const float* pitchMod, const float* shapeMod, float* out,
+                                     int numLanes, int numSamples, float shapeMin, float shapeMax);
+
+    //! \name the kernels
+    ///@{
+    //! naive square of Waveforms, the shape is the pulse width, advances the phases
+    OscillatorKernel squareLanes;
+    //! naive saw of Waveforms, the shape is the triangle amount, advances the phases
+    OscillatorKernel sawLanes;
+    //! one FastRandom step per lane and sample
+    void (*noiseLanes)(uint32_t* state, float* out, int numLanes, int numSamples);
+    //! per sample: one ramp step of the coefficients and one biquad sample, the output is clamped to [-1..1] in place
+    void (*biquadLanes)(BiquadLanes& bq, float* samples, int numLanes, int numSamples);
+    //! one biquad sample of both channels per frame, in place and unclamped, the feedback filter of FxDelay
+    void (*stereoBiquadFrames)(StereoBiquad& bq, float* frames, int numFrames);
+    //! scales by coeff, rounds half away from zero and scales back by invCoeff, the bit reduction of LowFidelity
+    void (*quantize)(float* samples, float coeff, float invCoeff, int numSamples);
+    //! scales by scale, rounds to nearest even and saturates to 16 bit, the fixed point ring of FxDelay
+    void (*packInt16)(const float* src, int16_t* dst, float scale, int numSamples);
+    //! the samples of packInt16 times invScale
+    void (*unpackInt16)(const int16_t* src, float* dst, float invScale, int numSamples);
+    //! IEEE half floats rounded to nearest even, with their subnormals, the half float ring of FxDelay; the payload of a nan can differ
+    void (*packHalf)(const float* src, uint16_t* dst, int numSamples);
+    //! the floats of IEEE half floats, exact
+    void (*unpackHalf)(const uint16_t* src, float* dst, int numSamples);
+    ///@}
+
+    const char* name;   //!< instruction set of the table, see CpuFeatures::getName()
+
+    //! \brief the table for the machine, thread safe, the first call detects the cpu
+    static const SimdKernels& get();
+
+private:
+    SimdKernels();
+
+    //! \name per instruction set, each replaces the kernels it has and returns false if the build has none
+    ///@{
+    static bool useSse2(SimdKernels& k);
+    static bool useAvx(SimdKernels& k);
+    static bool useAvx2(SimdKernels& k);
+    static bool useNeon(SimdKernels& k);
+    ///@}
+};
+
+#endif  // SIMDKERNELS_H_INCLUDED
@@ -14,7 +14,17 @@
 #include "../JuceLibraryCode/JuceHeader.h"
 
 #include "SynthParams.h"
-
+#include "SeqPattern.h"
+#include "FastRandom.h"
+#include "MidiEventList.h"
+
+/**
+* StepSequencer plays the steps of the SeqPattern as midi notes. The pattern is precomputed into a list
+  of one event per step of a period, with the note, velocity and length of the step; the list is only
+  rebuilt when a step or a play setting changes, so a block just walks from event to event.
+  The list is double buffered: a rebuilt list waits in the back buffer and takes over at the next step
+  or the next bar, as seqPatternSwap says, so an edit of several steps starts to play as a whole.
+*/
 class StepSequencer
 {
 public:
@@ -28,8 +38,9 @@ public:
       Stop: Do nothing; idle state.
       PlayNoHost: Play without needing a host.
       PlaySyncHost: Play with host; will only play if host is playing or recording.
+      The notes go into the event list of the engine midi, not into the buffer of the host.
     */
-    void runSeq(MidiBuffer& midiMessages, int bufferSize, double sampleRate);
+    void runSeq(MidiEventList& midiMessages, int bufferSize);
 
     /**
     * Save current stepSequencer parameters by serializing it in a XML patch tree.
@@ -69,20 +80,41 @@ public:
 
     /**
     * Set a specific step note as random. The lowest and highest random note can be set with provided functions.
-    @param step the (step+1)th sequence note in range of [0..7]
+    @param step the (step+1)th sequence note in range of [0..63]
     */
     void setStepRandom(int step);
 
+    /**
+    * Set the midi note of a specific step.
+    @param step the (step+1)th sequence note in range of [0..63]
+    @param note in range of [0..127]
+    */
+    void setStepNote(int step, int note);
+
     /**
     * Function to set a specific step as activated or mute.
-    @param step the (step+1)th sequence note in range of [0..7]
+    @param step the (step+1)th sequence note in range of [0..63]
     @param active false->mute
     */
     void setStepActive(int step, bool active);
 
+    /**
+    * Set the midi velocity of a specific step.
+    @param step the (step+1)th sequence note in range of [0..63]
+    @param velocity in range of [1..127]
+    */
+    void setStepVelocity(int step, int velocity);
+
+    /**
+    * Set the gate of a specific step, the part of the step length the note is held.
+    @param step the (step+1)th sequence note in range of [0..63]
+    @param gate in percent in range of [1..100]
+    */
+    void setStepGate(int step, int gate);
+
     /**
     * Set the number of steps for the sequencer.
-    @param numSteps in range of [1..8]
+    @param numSteps in range of [1..64]
     */
     void setNumSteps(int numSteps);
 
@@ -130,23 +162,42 @@ public:
     @param max in range of [0..127]
     */
     void setRandMax(int max);
+
+    /**
+    * Set the seed of the random play mode. With a seed the same random notes are played every time
+      the sequence starts, loops or jumps, so renders are repeatable.
+    @param seed in range of [1..65535], 0 plays a new random sequence every time
+    */
+    void setRandomSeed(int seed);
     //==============================================================================
     /**
-    * Get the last played sequence step in range [0..7]. Can be used to dispay playing position in GUI.
+    * Get the last played sequence step in range [0..63]. Can be used to dispay playing position in GUI.
     */
     int getLastSeqNote();
 
     /**
-    * Get the current number of steps in use for the stepSequencee in range [1..8]
+    * Get the current number of steps in use for the stepSequencee in range [1..64]
     */
     int getNumStep();
 
     /**
     * Get the midi note value of a specific step.
-    @param step in range [0..7]
+    @param step in range [0..63]
     */
     int getStepNoteAsInt(int step);
 
+    /**
+    * Get the midi velocity of a specific step in range [1..127].
+    @param step in range [0..63]
+    */
+    int getStepVelocity(int step);
+
+    /**
+    * Get the gate of a specific step in percent of the step length in range [1..100].
+    @param step in range [0..63]
+    */
+    int getStepGate(int step);
+
     /**
     * Get the midi note value of the current minimum random note.
     */
@@ -159,7 +210,7 @@ public:
 
     /**
     * Get the note name as a string of a specific step by using MidiMessage::getMidiNoteName().
-    @param step in range [0..7]
+    @param step in range [0..63]
     @param sharps if true use sharps and flats
     @octaveNumber if true display octave number
     @middleC number to use for middle c
@@ -195,7 +246,7 @@ public:
     String getRandMaxNoteName(bool sharps, bool octaveNumber, int middleC);
 
     /**
-    * Is true if stepSequencer is playing with or without host.
+    * Is true if stepSequencer is playing with or without host, called by the audio thread.
     */
     bool isPlaying();
 
@@ -221,40 +272,97 @@ public:
 
     /**
     * Is true if specific step is activated and should play.
-    @param step in range [0..7]
+    @param step in range [0..63]
     */
     bool isStepActive(int step);
 
+    /**
+    * Length of one period of the events in quarter notes, the steps of an upDown period count twice.
+      The periods start at multiples of it from ppq position 0, called by the audio thread after runSeq().
+    */
+    double getLoopLength() const { return static_cast<double>(numEvents) * static_cast<double>(seqStepSpeed); }
+
+    /**
+    * Changes whenever other events start to play, see SeqFreeze.
+    */
+    uint32 getEventsVersion() const { return eventsGeneration; }
+
+    /**
+    * Ppq position at the start of the last block runSeq() played, -1 if it stopped.
+    */
+    double getBlockPosition() const { return blockPosition; }
+
+    /**
+    * Counts the starts, loops and jumps of the host that restarted the sequence, see SeqFreeze.
+    */
+    uint32 getNumRestarts() const { return numRestarts; }
+
 private:
+    //! a step of the precomputed period
+    struct SeqEvent {
+        double length;      //!< note length in quarter notes, step length times gate
+        int step;           //!< index into the pattern
+        uint8 note;
+        uint8 velocity;
+        bool active;
+    };
+
     //==============================================================================
-    void seqNoHostSync(MidiBuffer& midiMessages, int bufferSize, double sampleRate);
-    void seqHostSync(MidiBuffer& midiMessages);
-    void sendMidiNoteOffMessage(MidiBuffer& midiMessages, int sample);
-    void sendMidiNoteOnMessage(MidiBuffer& midiMessages, int sample);
-    void midiNoteChanged(MidiBuffer& midiMessages);
-    void stopSeq(MidiBuffer& midiMessages);
+    void seqNoHostSync(MidiEventList& midiMessages, int bufferSize);
+    void seqHostSync(MidiEventList& midiMessages, int bufferSize);
+    void playRange(MidiEventList& midiMessages, double blockStart, int bufferSize, bool restart);
+    void playStep(MidiEventList& midiMessages, double stepPos, int sample);
+    int nextRandomNote();
+    int getSampleOffset(double pos, double blockStart, int bufferSize) const;
+    void sendMidiNoteOffMessage(MidiEventList& midiMessages, int sample);
+    void sendMidiNoteOnMessage(MidiEventList& midiMessages, const SeqEvent& e, int note, int sample);
+    void updateEvents();
+    void addEvent(const SeqPattern::Data& data, int step);
+    double getSwapPosition() const;
+    void swapEvents();
+    void stopSeq(MidiEventList& midiMessages);
     //==============================================================================
     SynthParams &params;
+    SeqPattern &seqPattern;
 
-    // StepSequencer gui params
-    std::array<int, 8> prevMidiStepSeq;
-    std::array<Param*, 8> currMidiStepSeq;
-    std::array<eOnOffToggle, 8> prevStepOnOff;
-    std::array<ParamStepped<eOnOffToggle>*, 8> currStepOnOff;
+    // StepSequencer gui params, the first steps of the pattern
+    static const int numParamSteps = 8;
+    std::array<Param*, numParamSteps> currMidiStepSeq;
+    std::array<ParamStepped<eOnOffToggle>*, numParamSteps> currStepOnOff;
     float seqStepSpeed;
     double seqStepLength;
     int seqNumSteps;
 
+    // events of one period, upDown plays every step twice
+    typedef std::array<SeqEvent, 2 * SeqPattern::maxSteps> SeqEvents;
+    std::array<SeqEvents, 2> eventBuffers;
+    SeqEvents* events;              //!< the buffer that plays
+    SeqEvents* pendingEvents;       //!< the buffer that is rebuilt
+    int numEvents;
+    int numPendingEvents;
+    bool hasPendingEvents;          //!< the pending events wait for swapPosition
+    double swapPosition;            //!< ppq position of the first step the pending events play
+    uint32 eventsGeneration;        //!< see getEventsVersion()
+    uint32 eventsVersion;           //!< of the pattern the last events were built from
+    int eventsNumSteps;
+    eSeqPlayModes eventsPlayMode;
+    double eventsStepLength;
+
+    //! random play mode, owned by the audio thread
+    FastRandom random;
+
     // internal StepSequencer variables
-    int currSeqNote;
+    int lastPlayedStep;
     int lastPlayedNote;
-    int seqNoteAdd;
-    int nextPlaySample;
-    int noteOffSample;
-    double seqNextStep;
-    double stopNoteTime;
+    double seqNextStep;             //!< ppq position of the next step
+    double lastStepPosition;        //!< ppq position of the last played step
+    double stopNoteTime;            //!< ppq position of the end of the playing note
     double lastPlayHeadPosition;
+    double noHostPosition;          //!< ppq position of the next block while playing without host
     bool seqNoteIsPlaying;
+    bool lastNoteSent;              //!< the playing step is not muted, its note off is due
+    double blockPosition;           //!< see getBlockPosition()
+    uint32 numRestarts;
     bool seqStopped;
 };
 #endif  // STEPSEQUENCER_H_INCLUDED
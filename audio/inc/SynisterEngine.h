@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+    SynisterEngine.h
+    Created: 16 Oct 2026 6:02:14pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef SYNISTERENGINE_H_INCLUDED
+#define SYNISTERENGINE_H_INCLUDED
+
+#include <memory>
+
+//! SynisterEngine: the synth for other programs, without plugin wrapper, editor or audio device
+/*! The API of the engine library, engine/engine.jucer, and free of JUCE types, so a render tool
+    or an installation host only needs this header and the library. The engine renders into the
+    buffers of the caller on the calling thread: create it, load a patch, push the midi of the
+    next frames and render them. Patches are XML files of the editor or XML text.
+    An engine is used by one thread at a time. Several engines may run on different threads.
+*/
+class SynisterEngine {
+public:
+    struct Settings {
+        double sampleRate = 48000.;
+        int maxBlockSize = 512;     //!< render() splits longer calls into blocks of this size
+        bool realtime = false;      //!< rendering for a live output instead of a file
+    };
+
+    //! \brief a new engine, nullptr if the settings are out of range
+    static std::unique_ptr<SynisterEngine> create(const Settings& settings);
+    ~SynisterEngine();
+
+    //! \name patches, every param the patch leaves out gets its default
+    ///@{
+    //! \brief false if the file is no patch, see getLastError()
+    bool loadPatch(const char* path);
+    bool loadPatchXml(const char* xml);
+    ///@}
+
+    //! \brief a midi message that plays at a frame offset from the start of the next render() call
+    void pushMidi(const unsigned char* data, int numBytes, int frameOffset);
+    void noteOn(int channel, int note, float velocity, int frameOffset);
+    void noteOff(int channel, int note, int frameOffset);
+    //! \brief releases all voices and clears the echoes and the pushed midi
+    void reset();
+
+    //! \brief renders the next frames into the two channels, replacing their content
+    void render(float* left, float* right, int numFrames);
+
+    double getSampleRate() const;
+    //! \brief the error of the last call that failed, UTF-8
+    const char* getLastError() const;
+
+private:
+    struct Impl;
+    explicit SynisterEngine(Impl* i);
+    std::unique_ptr<Impl> impl;
+
+    SynisterEngine(const SynisterEngine&) = delete;
+    SynisterEngine& operator=(const SynisterEngine&) = delete;
+};
+
+#endif  // SYNISTERENGINE_H_INCLUDED
@@ -4,7 +4,26 @@
 #include "Param.h"
 #include <vector>
 #include <array>
+#include <atomic>
 #include "ModulationMatrix.h"
+#include "Tuning.h"
+#include "TempoContext.h"
+#include "TransportState.h"
+#include "Telemetry.h"
+#include "ParamEventQueue.h"
+#include "PatchLoader.h"
+#include "PatchStateCache.h"
+#include "PatchMorph.h"
+#include "UndoHistory.h"
+#include "SeqPattern.h"
+#include "KeyboardInput.h"
+#include "SampleLibrary.h"
+#include "AuditionPlayer.h"
+
+//! 1 in the engine library: the processor has no editor and shows no message boxes, see SynisterEngine
+#ifndef SYNISTER_ENGINE_ONLY
+ #define SYNISTER_ENGINE_ONLY 0
+#endif
 
 enum class eSectionState : int {
     eExpanded = 0,
@@ -28,7 +47,9 @@ enum class eOscWaves : int {
     eOscSquare = 0,
     eOscSaw = 1,
     eOscNoise = 2,
-    nSteps = 3
+    eOscWavetable = 3,
+    eOscSample = 4,
+    nSteps = 5
 };
 
 enum class eBiquadFilters : int {
@@ -39,12 +60,98 @@ enum class eBiquadFilters : int {
     nSteps = 4
 };
 
+//! implementation of the lowpass, highpass and bandpass filter modes
+enum class eFilterTopology : int {
+    eBiquad = 0,    //!< direct form biquad
+    eSvf = 1,       //!< topology preserving state variable filter, stable under fast cutoff modulation
+    nSteps = 2
+};
+
+//! transfer curve of the clipping effect
+enum class eClippingMode : int {
+    eHard = 0,      //!< hard clip at 1, aliases at high drive
+    eTanh = 1,      //!< tanh saturation with antiderivative anti-aliasing
+    eCubic = 2,     //!< cubic soft clip with antiderivative anti-aliasing, cheaper than tanh
+    nSteps = 3
+};
+
+//! effects of the FxChain, in the order of the default chain
+enum class eFxType : int {
+    eLowFi = 0,
+    eClipping = 1,
+    eDelay = 2,
+    eChorus = 3,
+    eReverb = 4,
+    eWaveshaper = 5,
+    nSteps = 6
+};
+
+//! curves of FxWaveshaper, all of them map [-inf..inf] into [-1..1]
+enum class eShaperCurve : int {
+    eTanh = 0,          //!< symmetric saturation, odd harmonics
+    eAsymmetric = 1,    //!< tanh with a bias, even harmonics as well
+    eFoldback = 2,      //!< a sine folder, loud inputs fold back instead of saturating
+    nSteps = 3
+};
+
 enum class eOnOffToggle : int {
     eOff = 0,
     eOn = 1,
     nSteps = 2
 };
 
+enum class eModulationRate : int {
+    eSampleRate = 0,
+    eControlRate16 = 1,
+    eControlRate32 = 2,
+    eAdaptive = 3,      //!< by the speed of the sources, see Voice::getControlInterval()
+    nSteps = 4
+};
+
+enum class eOversampling : int {
+    eOff = 0,
+    e2x = 1,
+    e4x = 2,
+    eAdaptive = 3,  //!< per voice by the pitch and the waveform of the note, see Voice::chooseOversampling()
+    nSteps = 4
+};
+
+//! where the two filters of a voice sit
+enum class eFilterRouting : int {
+    ePerOscillator = 0, //!< every oscillator runs through its own pair of filters
+    ePostMix = 1,       //!< the oscillators are mixed first and share one pair of filters
+    nSteps = 2
+};
+
+//! how the chorus reads its modulated taps between two samples
+enum class eChorusInterpolation : int {
+    eLinear = 0,    //!< two samples, the cheapest, dulls the taps a little
+    eHermite = 1,   //!< four samples, 3rd order hermite
+    eAllpass = 2,   //!< first order allpass, flat magnitude, a recursion per tap and channel
+    nSteps = 3
+};
+
+//! sample format of the ring buffer of the delay, see FxDelay
+enum class eDelayStorage : int {
+    eFloat = 0,     //!< 32 bit float
+    eFixed16 = 1,   //!< 16 bit fixed point with 12 dB of headroom, -78 dB of quantisation below full scale
+    eHalf = 2,      //!< 16 bit IEEE half float, 11 bit of precision at any level
+    nSteps = 3
+};
+
+//! how the notes of a channel use the voices
+enum class eVoiceMode : int {
+    ePoly = 0,      //!< every note gets its own voice
+    eLegato = 1,    //!< one voice, a note played while another is held moves its pitch without restarting the envelopes
+    nSteps = 2
+};
+
+//! quality tier of a block, see SynthParams::updateSnapshot()
+enum class eQualityTier : int {
+    eRealtime = 0,  //!< the settings chosen by the user
+    eOffline = 1    //!< expensive settings for offline renders
+};
+
 enum class eSeqPlayModes : int {
     eSequential = 0,
     eUpDown = 1,
@@ -52,11 +159,25 @@ enum class eSeqPlayModes : int {
     nSteps = 3
 };
 
+//! where an edited pattern of the step sequencer starts to play
+enum class eSeqPatternSwap : int {
+    eStep = 0,
+    eBar = 1,
+    nSteps = 2
+};
+
 
+//! last channel wide controller values, written by the midi path, read by voices when they start
 struct MidiState {
     MidiState()
     {
-        std::fill(values.begin(), values.end(), 0);
+        for (std::atomic<int>& v : values) {
+            v.store(0, std::memory_order_relaxed);
+        }
+        values[ePitchbend].store(8192, std::memory_order_relaxed);
+        for (std::atomic<int>& t : timbre) {
+            t.store(64, std::memory_order_relaxed);
+        }
     }
 
     enum eMsg : int {
@@ -64,15 +185,236 @@ struct MidiState {
         eFoot,
         eExpPedal,
         eModwheel,
+        ePitchbend,     //!< 14 bit, only of the master channel in mpe mode
         nSteps
     };
 
+    static const int numChannels = 16;
+
     float get(eMsg e) const {
         jassert(e >= eAftertouch && e < nSteps);
-        return static_cast<float>(values[e]);
+        return static_cast<float>(values[e].load(std::memory_order_relaxed));
+    }
+
+    void set(eMsg e, int value) {
+        jassert(e >= eAftertouch && e < nSteps);
+        values[e].store(value, std::memory_order_relaxed);
+    }
+
+    //! \brief last cc 74 of a midi channel in [1..16], the timbre a note on that channel starts with
+    float getTimbre(int midiChannel) const {
+        return midiChannel >= 1 && midiChannel <= numChannels
+            ? static_cast<float>(timbre[static_cast<size_t>(midiChannel - 1)].load(std::memory_order_relaxed)) : 64.f;
+    }
+
+    void setTimbre(int midiChannel, int value) {
+        if (midiChannel >= 1 && midiChannel <= numChannels) {
+            timbre[static_cast<size_t>(midiChannel - 1)].store(value, std::memory_order_relaxed);
+        }
     }
 
-    std::array<int, eMsg::nSteps> values;
+    std::array<std::atomic<int>, eMsg::nSteps> values;
+    std::array<std::atomic<int>, numChannels> timbre;
+};
+
+//! plain copy of the params that are read while rendering
+/*! SynthParams::updateSnapshot() fills it once at the start of every block. The render
+    code then reads plain values from a few consecutive cache lines instead of atomics
+    spread over the whole SynthParams, and every voice and effect sees the same values
+    for the whole block. The ranges of the params never change and are copied as well.
+*/
+struct alignas(64) ParamSnapshot {
+    struct Osc {
+        bool active;
+        bool bandLimited;
+        eOscWaves waveForm;
+        int unisonVoices;       //!< copies of square and saw, 1 without unison
+        float unisonDetune;     //!< ct between the lowest and the highest copy
+        float unisonSpread;     //!< level of the outer copies in [0..1]
+        float fine;             //!< fine tune in ct
+        float coarse;           //!< coarse tune in st
+        float trngAmount;
+        float trngMin;
+        float trngMax;
+        float pulseWidth;
+        float pulseWidthMin;
+        float pulseWidthMax;
+        float vol;              //!< linear gain
+        float panDir;           //!< pan in [-100..100]
+        float pitchModRange;    //!< max pitch modulation in st
+        float gainModRange;     //!< max gain modulation in dB
+        std::array<float, Tuning::numNotes> noteFreq;  //!< tuned frequency of every midi note in Hz incl. coarse and fine
+    };
+
+    struct Filter {
+        bool active;
+        eBiquadFilters passtype;
+        eFilterTopology topology;
+        bool ladderOversampling;    //!< run the ladder at twice the rate of the filters
+        float lpCutoff;
+        float hpCutoff;
+        float cutoffMin;        //!< identical for low and high pass
+        float cutoffMax;
+        float resonance;
+        float resonanceMin;
+        float resonanceMax;
+        float lpModRange;       //!< max cutoff modulation in octaves
+        float hpModRange;
+        float resModRange;
+    };
+
+    struct Env {
+        float attack;
+        float decay;
+        float release;
+        float attackShape;
+        float decayShape;
+        float releaseShape;
+        float sustain;          //!< linear sustain level
+        float speedModAmount1;
+        float speedModAmount2;
+        float speedModMin;
+        float speedModMax;
+
+        //! \name speed modulation, the same for every note the block starts, see Envelope::calcEnvCoeff()
+        ///@{
+        eModSource speedModSrc1;
+        eModSource speedModSrc2;
+        float speedModIntensity1;   //!< of the first source, all stages
+        float speedModIntensity2;   //!< of the second source, attack
+        float speedModIntensity21;  //!< of the second source with the first amount, decay and release
+        ///@}
+    };
+
+    struct Lfo {
+        bool tempSync;
+        bool triplets;
+        bool dottedLength;
+        eLfoWaves wave;
+        float freq;
+        float noteLength;
+        float phaseDelta;       //!< per sample, of the rate or of the synced note length
+        float fadeIn;
+        bool global;            //!< one waveform for all voices, rendered once per block by the synth
+    };
+
+    float freq;
+    eQualityTier quality;               //!< tier the settings of this block were resolved for
+    eMathAccuracy mathAccuracy;         //!< accuracy of the FastMath approximations in the per-sample code, follows the tier
+    eModulationRate modulationRate;
+    int oversampling;   //!< oversampling factor of the oscillators and filters, 1, 2 or 4, the largest one a voice takes if adaptive
+    bool adaptiveOversampling;  //!< every voice picks its factor between minOversampling and oversampling
+    int minOversampling;        //!< of the quality tier, offlineOversampling offline
+    float tailLevel;            //!< of the volume envelope, below it a releasing voice renders with less detail, 0 offline, see Voice::beginBlock()
+    eFilterRouting filterRouting;
+
+    std::array<Osc, 3> osc;
+    std::array<Filter, 2> filter;
+    std::array<Env, 1> envVol;
+    std::array<Env, 2> env;
+    std::array<Lfo, 3> lfo;
+
+    //! \name fx
+    ///@{
+    float clippingFactor;
+    eClippingMode clippingMode;
+    float nBitsLowFi;
+    float lowFiDownsample;
+
+    float chorDelayLength;
+    float chorDryWet;
+    float chorModRate;
+    float chorModDepth;
+    eChorusInterpolation chorInterpolation; //!< hermite in the offline tier
+
+    float delayFeedback;
+    float delayDryWet;
+    float delayTime;
+    float delayDividend;
+    float delayDivisor;
+    float delayCutoff;
+    bool delaySync;
+    bool delayTriplet;
+    bool delayDottedLength;
+    bool delayRecordFilter;
+    bool delayReverse;
+    bool delayPingPong;
+
+    float reverbSize;
+    float reverbDecay;
+    float reverbDamping;
+    float reverbDryWet;
+
+    float shaperDrive;      //!< gain in front of the curve
+    eShaperCurve shaperCurve;
+    bool shaperOversampling;
+
+    //! effect of every position of the chain, may contain duplicates, see FxChain
+    std::array<eFxType, static_cast<size_t>(eFxType::nSteps)> fxOrder;
+    ///@}
+};
+
+//! RenderPlan: the parts of the engine the current patch uses, see SynthParams::compileRenderPlan()
+/*! Compiled from the structural params only: the activation and waveform of the oscillators, the
+    activation and type of the filters, the mod sources something reads and the active effects in
+    their order. The voices and the fx chain walk its lists instead of testing every oscillator,
+    filter, source and effect, and every oscillator calls the kernel bound to it, so the cost of a
+    block follows the part of the engine the patch uses. Only the audio thread reads it.
+*/
+struct RenderPlan {
+    //! oscillator kernels, one per waveform and the settings that select a different loop
+    enum eOscKernel : int {
+        eSquare = 0,
+        eSquareBandLimited,
+        eSquareUnison,
+        eSquareUnisonBandLimited,
+        eSaw,
+        eSawBandLimited,
+        eSawUnison,
+        eSawUnisonBandLimited,
+        eNoise,
+        eWavetable,
+        eSample,
+        nKernels
+    };
+
+    static const int numOscillators = 3;
+    static const int numFilters = 2;
+    static const int numFx = static_cast<int>(eFxType::nSteps);
+
+    //! \name active oscillators and their kernels
+    ///@{
+    std::array<int, numOscillators> oscillators;    //!< the first numActiveOscillators are active, in order
+    int numActiveOscillators;
+    std::array<eOscKernel, numOscillators> kernel;  //!< by oscillator
+    uint32 activeOscillators;   //!< bit per oscillator
+    uint32 bankOscillators;     //!< bit per active oscillator the voice bank renders in lanes
+    ///@}
+
+    //! \name active filters
+    ///@{
+    std::array<int, numFilters> filters;
+    int numActiveFilters;
+    uint32 activeFilters;       //!< bit per filter
+    uint32 bankFilters;         //!< bit per active filter the filter bank has a lane version of
+    ///@}
+
+    uint32 consumedSources;     //!< bit per eModSource read by a route or a mod source param, the volume envelope always
+
+    //! active effects in the order of the chain
+    std::array<eFxType, numFx> fx;
+    int numActiveFx;
+
+    uint32 generation;          //!< counts the compiles that changed the plan
+
+    bool isOscillatorActive(size_t o) const { return (activeOscillators & (1u << o)) != 0; }
+    bool isBankOscillator(size_t o) const { return (bankOscillators & (1u << o)) != 0; }
+    bool isFilterActive(size_t f) const { return (activeFilters & (1u << f)) != 0; }
+    bool isBankFilter(size_t f) const { return (bankFilters & (1u << f)) != 0; }
+    bool isSourceConsumed(eModSource source) const { return (consumedSources & (1u << static_cast<int>(source))) != 0; }
+
+    //! the structural params of a plan, see SynthParams::compileRenderPlan()
+    typedef std::array<int, 4 * numOscillators + 2 + 4 * numFilters + 2 * numFx + 1> tKey;
 };
 
 class SynthParams {
@@ -86,6 +428,7 @@ public:
     static const Colour filterColour;
     static const Colour fxColour;
     static const Colour stepSeqColour;
+    static const Colour scopeColour;
     static const Colour onOffSwitchEnabled;
     static const Colour onOffSwitchDisabled;
     static const Colour envelopeCurveLine;
@@ -98,8 +441,15 @@ public:
 
     ParamDb masterAmp; //!< master volume
     Param masterPan; //!< master pan
+    ParamStepped<eOnOffToggle> limiterActivation; //!< lookahead limiter behind the master output, adds its latency
+    ParamDb limiterCeiling; //!< most the output peaks at while the limiter is on
 
     Param freq;  //!< master tune in Hz
+    Param polyphony; //!< number of simultaneously playing voices in [1..64]
+    Param midiChannel; //!< the only midi channel the synth plays in [1..16], 0 for all of them
+    Param morphX; //!< position between the corners A and B of the PatchMorph, in [0..1]
+    Param morphY; //!< position between the corners A and C of an XY morph, in [0..1]
+    Param glideTime; //!< duration of the pitch glide between legato notes in s, 0 jumps
 
                        //Param lfoChorfreq; // delay-lfo frequency in Hz
                        //Param chorAmount; // wetness of signal [0 ... 1]
@@ -178,6 +528,7 @@ public:
         ParamStepped<eModSource> freqModSrc1; //!< lfo frequency mod source
         ParamStepped<eModSource> freqModSrc2; //!< lfo frequency mod source
         ParamStepped<eModSource> gainModSrc; //!< lfo gain mod source
+        ParamStepped<eOnOffToggle> global; //!< free running lfo shared by all voices instead of one per note
 
         void setName(const String& s) {
             BaseParamStruct::setName(s);
@@ -193,6 +544,7 @@ public:
             freqModSrc1.setPrefix(s);
             freqModSrc2.setPrefix(s);
             gainModSrc.setPrefix(s);
+            global.setPrefix(s);
         }
     };
 
@@ -200,6 +552,8 @@ public:
         Filter();
 
         ParamStepped<eBiquadFilters> passtype; //!< passtype that decides whether lowpass, highpass or bandpass filter is used
+        ParamStepped<eFilterTopology> topology; //!< biquad or state variable filter for lowpass, highpass and bandpass
+        ParamStepped<eOnOffToggle> ladderOversampling; //!< local 2x oversampling of the ladder against the aliasing of its saturators
         Param lpCutoff; //!< filter cutoff frequency in Hz
         Param hpCutoff; //!< filter cutoff frequency in Hz
         Param resonance; //! filter resonance in dB
@@ -222,6 +576,8 @@ public:
             BaseParamStruct::setName(s);
             filterActivation.setPrefix(s);
             passtype.setPrefix(s);
+            topology.setPrefix(s);
+            ladderOversampling.setPrefix(s);
             lpCutoff.setPrefix(s);
             hpCutoff.setPrefix(s);
             resonance.setPrefix(s);
@@ -238,6 +594,9 @@ public:
             resonanceModSrc1.setPrefix(s);
             resonanceModSrc2.setPrefix(s);
         }
+
+        //! \brief the values of the block, also used by the response curve of the editor
+        void fillSnapshot(ParamSnapshot::Filter& dst) const;
     };
 
     struct Osc : public BaseParamStruct {
@@ -268,6 +627,11 @@ public:
         ParamStepped<eModSource> gainModSrc2; //!< gain mod source
         
         ParamStepped<eOnOffToggle> oscActivation; //!< toggle osc activation
+        ParamStepped<eOnOffToggle> bandLimited; //!< render square and saw with PolyBLEP/PolyBLAMP
+        Param unisonVoices; //!< detuned copies of square and saw in [1..8]
+        Param unisonDetune; //!< detune between the lowest and the highest copy in [0..100] ct
+        Param unisonSpread; //!< level of the outer copies in [0..100] %
+        SampleSlot sample; //!< file of the sample waveform, saved with the patch
 
         void setName(const String& s) {
             BaseParamStruct::setName(s);
@@ -295,6 +659,10 @@ public:
             gainModSrc1.setPrefix(s);
             gainModSrc2.setPrefix(s);
             oscActivation.setPrefix(s);
+            bandLimited.setPrefix(s);
+            unisonVoices.setPrefix(s);
+            unisonDetune.setPrefix(s);
+            unisonSpread.setPrefix(s);
         }
     };
 
@@ -310,28 +678,59 @@ public:
     ParamStepped<eSectionState> filterSection;
     ParamStepped<eSectionState> fxSection;
     ParamStepped<eSectionState> seqSection;
+    ParamStepped<eSectionState> scopeSection;
     
     ParamDb clippingFactor;     //!< overdrive factor of the amplitude of the signal in [0..30] dB
     ParamStepped<eOnOffToggle> clippingActivation; //!< Activation of the clipping effect
+    ParamStepped<eClippingMode> clippingMode; //!< hard clip or one of the anti-aliased soft clip curves
 
     Param chorDelayLength;
     Param chorDryWet;
     Param chorModRate;
     Param chorModDepth;
     ParamStepped<eOnOffToggle> chorActivation; //!< Activation of the chorus effect
+    ParamStepped<eChorusInterpolation> chorInterpolation; //!< interpolation of the taps in the realtime tier
+
+    //! \name order of the fx chain
+    ///@{
+    ParamStepped<eFxType> fxSlot0;  //!< effect of the first position of the chain
+    ParamStepped<eFxType> fxSlot1;
+    ParamStepped<eFxType> fxSlot2;
+    ParamStepped<eFxType> fxSlot3;
+    ParamStepped<eFxType> fxSlot4;
+    ParamStepped<eFxType> fxSlot5;
+    ///@}
+
+    //! \name reverb
+    ///@{
+    Param reverbSize;       //!< factor of the delay line lengths in [0.5..2]
+    Param reverbDecay;      //!< time to decay by 60 dB in [0.2..10] s
+    Param reverbDamping;    //!< cutoff of the lowpass in the feedback in [500..20000] Hz
+    Param reverbDryWet;     //!< wetness of the signal in [0..1]
+    ParamStepped<eOnOffToggle> reverbActivation; //!< Activation of the reverb effect
+    ///@}
+
+    //! \name waveshaper
+    ///@{
+    Param shaperDrive;                      //!< gain in front of the curve in [0..24] dB, a full scale input stays inside the tables
+    ParamStepped<eShaperCurve> shaperCurve;
+    ParamStepped<eOnOffToggle> shaperOversampling; //!< run the curve at twice the rate
+    ParamStepped<eOnOffToggle> shaperActivation;   //!< Activation of the waveshaper
+    ///@}
 
     Param seqPlaceHolder;                       //!< placeholder for register slider with exactly two thumb slider, value as int in [0..127]
     ParamStepped<eOnOffToggle> seqPlayNoHost;   //!< play without host? 0 = no, 1 = yes
     ParamStepped<eOnOffToggle> seqPlaySyncHost; //!< play synced with host? 0 = no, 1 = yes
     ParamStepped<eSeqPlayModes> seqPlayMode;    //!< 0 = sequential, 1 = upDown, 2 = random
-    Param seqLastPlayedStep;                    //!< index of last played sequencer step in [0..7]
-    Param seqNumSteps;                          //!< number of steps in [1..8] steps
+    Param seqNumSteps;                          //!< number of steps in [1..64] steps
     Param seqStepSpeed;                         //!< step speed in 1/[1 .. 64]
     Param seqStepLength;                        //!< step length in 1/[1 .. 64]
     ParamStepped<eOnOffToggle> seqTriplets;     //!< activate triplet tempo? 0 = no, 1 = active
     ParamStepped<eOnOffToggle> seqDottedLength;       //!< activate dotted tempo? 0 = no, 1 = active
     Param seqRandomMin;                         //!< randomMin value as int in [0..127]
     Param seqRandomMax;                         //!< randomMax value as int in [0..127]
+    Param seqRandomSeed;                        //!< seed of the random play mode as int in [1..65535], 0 = a new sequence every time
+    ParamStepped<eSeqPatternSwap> seqPatternSwap; //!< an edited pattern plays from the next step or the next bar on
     Param seqStep0;                             //!< midi note as int in [0..127]
     Param seqStep1;
     Param seqStep2;
@@ -348,13 +747,20 @@ public:
     ParamStepped<eOnOffToggle> seqStepActive5;
     ParamStepped<eOnOffToggle> seqStepActive6;
     ParamStepped<eOnOffToggle> seqStepActive7;
+    SeqPattern seqPattern;                      //!< all steps with velocity and gate, the first eight mirror seqStep and seqStepActive
+    SeqNoteQueue seqRandomNotes{ 256 };         //!< notes the random play mode draws for the first eight steps, audio -> message thread, display only
 
     ParamStepped<eOnOffToggle> lowFiActivation; //!< Activation of the low fidelity effect
     Param nBitsLowFi; //!< Bit degradation
+    Param lowFiDownsample; //!< Sample rate reduction, every value is held for this many samples, 1 is off
 
     ModulationMatrix globalModMatrix;
-    MidiKeyboardState keyboardState;
+    MidiKeyboardState keyboardState;            //!< of the on-screen keyboard, message thread only
+    KeyboardInput keyboardInput{ keyboardState };   //!< notes of keyboardState for the audio thread and back
+    AuditionPlayer audition;                    //!< snippets of the preset browser, on top of the output
     MidiState midiState;
+    ParamUpdateHub uiUpdates;                   //!< params changed outside of the ui, for the panels showing them
+    UndoHistory undoHistory;                    //!< edits of the ui, message thread
 
     Param delayFeedback;    //!< delay feedback amount
     Param delayDryWet;      //!< delay wet signal
@@ -368,8 +774,30 @@ public:
     ParamStepped<eOnOffToggle> delayDottedLength;   //!< delay dotted note length toggle
     ParamStepped<eOnOffToggle> delayRecordFilter;   //!< delay filter record toggle
     ParamStepped<eOnOffToggle> delayReverse;        //!< delay reverse modo toggle
+    ParamStepped<eOnOffToggle> delayPingPong;       //!< the repeats alternate between left and right
     ParamStepped<eOnOffToggle> delayActivation;     //!< delay activation
     ParamStepped<eOnOffToggle> syncToggle;          //!< delay sync toggle
+    ParamStepped<eDelayStorage> delayStorage;       //!< sample format of the delay ring buffer, applied on prepareToPlay, stored with the project
+
+    // engine
+    ParamStepped<eOnOffToggle> voiceBankMode;       //!< render the oscillators of several voices in lock-step (not serialized)
+    ParamStepped<eOnOffToggle> parallelVoices;      //!< render the voices on a worker pool, applied on prepareToPlay (not serialized)
+    ParamStepped<eModulationRate> modulationRate;   //!< evaluation rate of the modulation matrix (not serialized)
+    ParamDb releaseTailLevel;                       //!< volume envelope level below which a releasing voice renders with less detail, -96 never (not serialized)
+    ParamStepped<eOnOffToggle> cpuVoiceLimit;       //!< reduce the polyphony when the render time gets close to the block deadline, also for the budget of all instances (not serialized)
+    ParamStepped<eOversampling> oversampling;       //!< oversampling of the oscillators and filters, stored with the project
+    ParamStepped<eFilterRouting> filterRouting;     //!< filters per oscillator or after the oscillator mix, stored with the project
+    ParamStepped<eOnOffToggle> mpeMode;             //!< channel 1 is the mpe master channel, 2..16 carry the expression of single notes, stored with the project
+    ParamStepped<eVoiceMode> voiceMode;             //!< polyphonic or mono legato, stored with the project
+    ParamStepped<eOnOffToggle> openGLRendering;     //!< the editor is composited by the gpu where juce_opengl is built in, stored with the project
+    ParamStepped<eOnOffToggle> offlineQuality;      //!< switch to the offline quality tier while the host renders offline (not serialized)
+    Param renderSubdivision;                        //!< midi events closer than this many samples are handled without splitting the block, in [1..512] (not serialized)
+    ParamStepped<eOnOffToggle> noteCache;           //!< play the notes of patches without live modulation from rendered takes, see NoteCache, applied on prepareToPlay (not serialized)
+    ParamStepped<eOnOffToggle> fixedEngineRate;     //!< run voices and effects at 44.1 or 48 kHz on high rate hosts, see EngineResampler, applied on prepareToPlay (not serialized)
+    ParamStepped<eOnOffToggle> lockMemory;          //!< keep the buffers of the voices and the effects in RAM, see RealtimeMemory, applied on prepareToPlay (not serialized)
+    ParamStepped<eOnOffToggle> pipelinedFx;         //!< the effects run on a worker one block behind the voices, see FxPipeline, applied on prepareToPlay (not serialized)
+    ParamStepped<eOnOffToggle> seqFreeze;           //!< a static sequencer loop plays from a recording, see SeqFreeze, applied on prepareToPlay (not serialized)
+    Param guiThrottle;                              //!< share of the block duration the audio thread may use before the editor slows down, see ParamUpdateHub, 100 never (not serialized)
 
     // list of current params, just add your new param here if you want it to be serialized
     std::vector<Param*> serializeParams; //!< vector of params to be serialized
@@ -379,12 +807,15 @@ public:
 
     String patchName = "";
     bool patchNameDirty = false;
-    const float version = 1.1f; // version of the program, to be written into the xml
+    const float version = 1.2f; // version of the program, to be written into the xml, 1.2 writes sparse patches
 
     static Colour getModSourceColour(eModSource source);
 
     static String getShortModSrcName(int index);
 
+    //! \brief true if a route of the mod matrix or a mod source param of the lfos and envelopes reads the source, audio thread only
+    bool isModSourceRead(eModSource source) const;
+
     /**
     * Store host state by creating XML file to serialize specified parameters by using writeXMLPatchTree().
     @param destData host data
@@ -399,15 +830,14 @@ public:
     void writeXMLPatchStandalone(eSerializationParams paramsToSerialize);
 
     /**
-    * Set the parameters if they exist in the XML patch.
-    @param patch XML patch to work on
-    @param paramName name to check whether parameter exist in XML patch
+    * Set a parameter to its value from a patch.
     @param param parameter to set
+    @param value value as stored in the patch, see Param::getUI()
     */
-    void fillValueIfExists(XmlElement * patch, String paramName, Param& param);
+    void fillValue(Param& param, float value);
 
     /**
-    * Iterate over specified parameters and set the values in the xml by using fillValueIfExists().
+    * Iterate over the XML patch once and set the specified parameters found in it by using fillValue().
     @param patch XML patch to work on
     @param paramsToSerialize specify which parameters should be used (all or only sequencer parameters)
     */
@@ -422,24 +852,200 @@ public:
     void readXMLPatchHost(const void * data, int sizeInBytes, eSerializationParams paramsToSerialize);
 
     /**
-    * Read XML file to set serialized parameters by using fillValues().
+    * Store host state in the binary chunk format, all serialized parameters.
+    * The chunk is a header with magic, format version, patch version and patch name,
+    * followed by the number of parameters and a packed table of (parameter id, value),
+    * and the packed steps of the sequencer pattern, which older versions do not read.
+    @param destData host data
+    */
+    void writeBinaryPatchHost(MemoryBlock& destData);
+
+    /**
+    * The chunk of writeBinaryPatchHost() from a cache, which is rebuilt only if a param of the
+    * chunk, the patch name, the pattern, a sample or a morph corner changed since the last call.
+    * Hosts poll the state for every autosave and undo point, an unchanged state costs a copy.
+    @param destData host data
+    */
+    void writeCachedPatchHost(MemoryBlock& destData);
+
+    /**
+    * Restore host state from the binary chunk format, or from XML for states saved before it.
+    * A chunk another instance of the process restored before is not parsed again, see PatchStateCache.
+    @param data binary data written by writeBinaryPatchHost() or writeXMLPatchHost()
+    @param sizeInBytes data size
+    */
+    void readPatchHost(const void * data, int sizeInBytes);
+
+    /**
+    * Read XML file in the background and set the serialized parameters at the next block, see PatchLoader.
     @param paramsToSerialize specify which parameters should be used (all or only sequencer parameters)
     */
     void readXMLPatchStandalone(eSerializationParams paramsToSerialize);
 
-    std::array<AudioPlayHead::CurrentPositionInfo, 2> positionInfo;
+    //! \name patch loading of the standalone, see PatchLoader
+    ///@{
+    //! \brief matches the elements of a patch to the params, safe on any thread
+    void parsePatch(const XmlElement& patch, eSerializationParams paramsToSerialize, PatchValues& dst) const;
+    //! \brief sets all values of a parsed patch without listener calls, audio thread only
+    void applyPatch(const PatchValues& patch);
+    //! \brief every serialized param at its default and the default pattern, what a sparse patch changes
+    const PatchValues& getDefaultPatch() const { return defaultPatch; }
+    //! \brief loads a complete patch file in the background, without a file chooser
+    void loadPatchFile(const File& file) { patchLoader.load(file, eSerializationParams::eAll, true); }
+    //! \brief loads a complete patch that is parsed already, e.g. from the preset browser, takes ownership of it
+    void loadParsedPatch(XmlElement* patch) { patchLoader.load(patch, eSerializationParams::eAll, true); }
+    //! \brief loads a preset of a bank in the background, see PresetBank
+    void loadBankPreset(PresetBank* bank, int preset) { patchLoader.load(bank, preset, true); }
+    //! \brief applies a patch the loader has parsed since the last block, true if the voices should be released
+    bool applyPendingPatch() { return patchLoader.applyPending(); }
+    //! \brief a patch is parsed and waits for applyPendingPatch(), audio thread only
+    bool hasPendingPatch() const { return patchLoader.hasParsedPatch(); }
+    //! \brief tells the user the patch is newer than this version, message thread only
+    void checkPatchVersion(float patchVersion, bool isPatch);
+    ///@}
+
+    Tuning tuning;  //!< master tune and scale, the note frequencies reach the voices through the snapshot
+
+    TransportState transport;   //!< position of the host, published once per block
+    TempoContext tempo;         //!< of the current block, see PluginAudioProcessor::updateHostInfo()
+    Telemetry telemetry;        //!< live modulation values for the ui, published once per block
+
+    //! copies the current param values into the snapshot, called by the audio thread at the start of every block
+    /*! The quality tier is resolved here, so the render code only reads the snapshot: in the offline tier
+        the oscillators and filters run 4x oversampled, the modulation is evaluated at sample rate, all
+        oscillators are band-limited and the chorus interpolates its taps with a hermite polynomial.
+        @param tier eOffline while the host renders offline, only used if offlineQuality is on
+    */
+    void updateSnapshot(eQualityTier tier = eQualityTier::eRealtime);
+
+    //! oversampling factor of the offline quality tier
+    static const int offlineOversampling = 4;
+    //! \brief 1, 2 or 4, the largest factor of a voice for eAdaptive
+    static int getOversamplingFactor(eOversampling os) { return os == eOversampling::eAdaptive ? 4 : 1 << static_cast<int>(os); }
+
+    //! param values of the current block, only to be used by the audio thread
+    const ParamSnapshot& getSnapshot() const { return *snapshot; }
+
+    //! \brief rebuilds the render plan if a structural param of the snapshot or the routing changed
+    /*! Called by the audio thread after updateSnapshot() and the compile of the mod matrix, before
+        the voices and the effects of a range of the block.
+    */
+    void compileRenderPlan();
+
+    //! the parts of the engine the patch uses, only to be used by the audio thread
+    const RenderPlan& getRenderPlan() const { return renderPlan; }
 
-    std::atomic<int> positionIndex;
+    //! \name param change events
+    /*! Changes of the host and of the ui are queued for the audio thread, which drains both queues
+        at the start of every block. Changes of the audio thread go the other way to the ui. The
+        values are always stored in the params as well, the events only carry the notification.
+    */
+    ///@{
+    //! \brief moves the queued changes into the events of the block, audio thread only
+    void drainParamEvents();
+    //! \brief the host or the ui changed a param since the last drainParamEvents(), audio thread only
+    bool hasPendingParamEvents() const { return !hostEvents.isEmpty() || !uiEvents.isEmpty(); }
+    //! \brief changes of the host and the ui since the last block, sorted by sample offset, audio thread only
+    const ParamEvent* getBlockEvents(int& numEvents) const {
+        numEvents = numBlockEvents;
+        return blockEvents.data();
+    }
+    //! \brief tells the ui about a value the audio thread changed, audio thread only
+    void notifyUI(Param& p) { audioEvents.push({ &p, p.get(), p.get(), 0 }); }
+    //! \brief marks the params the audio thread changed for the ui, message thread only
+    void dispatchAudioEvents();
 
-    int getGUIIndex();
-    int getAudioIndex();
+    //! events of a block, further events of the block only update the values
+    static const int maxBlockEvents = 256;
+    ///@}
 
 protected:
 private:
+    HeapBlock<char> snapshotStorage;    //!< over-allocated, so the snapshot can start on a cache line
+    ParamSnapshot* snapshot;
+    RenderPlan renderPlan;
+    RenderPlan::tKey renderPlanKey;     //!< the plan was compiled from these values
+
+    ParamEventQueue hostEvents;     //!< host -> audio
+    ParamEventQueue uiEvents;       //!< message thread -> audio
+    ParamEventQueue audioEvents;    //!< audio -> message thread
+    std::array<ParamEvent, maxBlockEvents> blockEvents;
+    int numBlockEvents;
+
     void addElement(XmlElement* patch, String name, float value); // adds an element to the XML tree
 
+    //! \name param registry
+    /*! The tags of the patch elements, serialization tag with the prefix and without spaces,
+        mapped to the params. Built once in the ctor, so reading a patch is one walk over the XML.
+    */
+    ///@{
+    HashMap<String, Param*> serializeRegistry{ 1024 };
+    HashMap<String, Param*> stepSeqRegistry{ 64 };
+    //! \brief tag of the patch element of a param
+    static String getElementTag(const Param& param);
+    static void buildRegistry(HashMap<String, Param*>& registry, const std::vector<Param*>& parameters);
+
+    HashMap<uint32, Param*> idRegistry{ 1024 };     //!< the serialized params by getParamId()
+    //! \brief id of a param in the binary chunk, a hash of the element tag that must not change
+    static uint32 getParamId(const String& elementTag);
+
+    PatchValues defaultPatch;   //!< see getDefaultPatch()
+    //! \brief sets every serialized param to its default and the default pattern with listener calls, like fillValues()
+    void fillDefaults();
+    ///@}
+
+    //! \name cache of writeCachedPatchHost()
+    ///@{
+    //! what the chunk depends on besides the params
+    struct StateKey {
+        uint32 generation = 0;
+        uint32 patternVersion = 0;
+        uint32 morphVersion = 0;
+        String patchName;
+        std::array<const MappedSample*, RenderPlan::numOscillators> samples;
+        bool operator== (const StateKey& other) const {
+            return generation == other.generation && patternVersion == other.patternVersion && morphVersion == other.morphVersion
+                && samples == other.samples && patchName == other.patchName;
+        }
+    };
+    StateKey getStateKey() const;
+
+    std::atomic<uint32> stateGeneration{ 0 };   //!< moves with every set() of a param in idRegistry
+    CriticalSection cachedStateLock;
+    StateKey cachedStateKey;
+    MemoryBlock cachedState;
+    bool cachedStateValid = false;
+    ///@}
+
+    //! \name restoring host states, see PatchStateCache
+    ///@{
+    SharedResourcePointer<PatchStateCache> stateCache;
+    //! \brief parses a binary or XML chunk, false if there is nothing to restore
+    bool parseHostState(const void* data, int sizeInBytes, PatchStateCache::State& dst) const;
+    //! \brief sets the params, the pattern, the samples and the morph like fillValues()
+    void applyHostState(const PatchStateCache::State& state);
+    ///@}
+
+    PatchLoader patchLoader;
+    friend class PatchMorph;
+    friend class PresetBank;
+
+public:
+    PatchMorph morph;   //!< blends the params between stored corners, before the snapshot of a block
+
+private:
+
+    static const uint32 binaryMagic = 0x424e5953;  //!< "SYNB" at the start of a binary chunk
+    static const uint32 binaryFormatVersion = 2;
+    static const uint32 sparseFormatVersion = 2;   //!< from this version the chunk has only the params off their default
+    static const char* const seqPatternTag;         //!< patch element of seqPattern
+    static const char* const oscSampleTag;          //!< patch element of the sample of an oscillator
+    static const char* const sparseAttribute;       //!< of a patch that has only the params off their default
+
     /**
     * Write the XML patch tree for parameters to be serialized.
+    * A complete patch is written sparse: only the params off their default, marked with the
+    * attribute sparse="1", so readers start from getDefaultPatch().
     @param patch XML patch to work on
     @param paramsToSerialize specify which parameters should be used (all or only sequencer parameters)
     */
@@ -0,0 +1,85 @@
+/*
+  ==============================================================================
+
+    Telemetry.h
+    Created: 15 Oct 2026 6:21:37am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef TELEMETRY_H_INCLUDED
+#define TELEMETRY_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "CpuMeter.h"
+#include "DeadlineMonitor.h"
+#include "ModulationMatrix.h"
+#include "OutputTap.h"
+#include "TripleBuffer.h"
+#include "MemoryFootprint.h"
+#include "NoteLatency.h"
+#include <array>
+#include <atomic>
+
+//! the modulation of the most recently started voice at the end of a block
+struct ModulationFrame {
+    int note = -1;                                          //!< midi note of the voice, -1 if no voice plays
+    std::array<float, eModSource::nSteps> sources {};       //!< value of every mod source, see eModSource
+    std::array<float, MAX_DESTINATIONS> destinations {};    //!< of the matrix, the pitch destinations as factors
+};
+
+//! state of the engine the ui shows, the audio thread stores it every block whether there is a reader or not
+/*! These are no params: the host never sees them, and a value of the engine does not end up in
+    a patch or as automation. Each is a relaxed atomic only the audio thread writes.
+*/
+struct EngineDisplay {
+    EngineDisplay() : delayTime(0.f), seqStep(-1), audioLoad(0.f) {}
+
+    std::atomic<float> delayTime;   //!< ms of the delay in the last block, tempo synced or not, 0 before the first one
+    std::atomic<int> seqStep;       //!< last played step of the sequencer, -1 while it is stopped
+    std::atomic<float> audioLoad;   //!< peak hold of the render time relative to the block duration, 0 while rendering offline
+};
+
+//! Telemetry: live values from the audio thread for the ui
+/*! The audio thread publishes a modulation frame per block, but only while a reader is
+    registered, so a closed editor costs nothing. The channels are triple buffers: the audio thread neither
+    waits nor allocates, the ui reads the newest frame at its own rate and skips the others. The
+    few values of EngineDisplay are cheap enough to always be stored.
+*/
+class Telemetry {
+public:
+    Telemetry() : readers(0), memorySource(nullptr) {}
+
+    //! \brief the reader of the channels, e.g. an editor, registers while it exists
+    void addReader() { readers.fetch_add(1, std::memory_order_relaxed); }
+    void removeReader() { readers.fetch_sub(1, std::memory_order_relaxed); }
+    //! \brief true if the audio thread should publish, audio thread
+    bool hasReaders() const { return readers.load(std::memory_order_relaxed) > 0; }
+
+    TripleBuffer<ModulationFrame> modulation;   //!< written by the audio thread, read by the message thread
+    OutputTap output;   //!< the master output for the scope, enabled by the scope itself while it is showing
+    CpuMeter cpu;       //!< time of the stages of processBlock, measured while the info panel shows it
+    DeadlineMonitor deadlines;  //!< load of every block, the context of the ones close to a dropout
+    NoteLatency notes;  //!< from the note-ons to their sound, with SYNISTER_NOTE_LATENCY only
+    EngineDisplay display;  //!< engine state of the panels, instead of params the audio thread would write
+
+    //! \brief the processor that owns the telemetry, set once by its constructor
+    void setMemorySource(const MemoryFootprint::Source* s) { memorySource = s; }
+    //! \brief the memory of the instance and the shared tables, message thread
+    MemoryFootprint getMemoryFootprint() const {
+        MemoryFootprint m;
+        if (memorySource != nullptr) {
+            memorySource->fillMemoryFootprint(m);
+        }
+        return m;
+    }
+
+private:
+    std::atomic<int> readers;
+    const MemoryFootprint::Source* memorySource;
+
+    JUCE_DECLARE_NON_COPYABLE(Telemetry)
+};
+
+#endif  // TELEMETRY_H_INCLUDED
@@ -0,0 +1,67 @@
+/*
+  ==============================================================================
+
+    TempoContext.h
+    Created: 15 Oct 2026 2:41:37am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef TEMPOCONTEXT_H_INCLUDED
+#define TEMPOCONTEXT_H_INCLUDED
+
+#include "JuceHeader.h"
+
+//! TempoContext: tempo and position of the current block
+/*! Computed once per block by PluginAudioProcessor::updateHostInfo() from the position of the
+    host, or from the defaults of CurrentPositionInfo without one. The lfos, the delay and the
+    step sequencer take their timing from it instead of converting the bpm themselves.
+    Only to be used by the audio thread.
+*/
+struct TempoContext {
+    TempoContext()
+    {
+        update(AudioPlayHead::CurrentPositionInfo(), 44100.);
+    }
+
+    double bpm;
+    double sampleRate;
+    double samplesPerBeat;      //!< samples per quarter note
+    double msPerBeat;           //!< milliseconds per quarter note
+    double beatsPerSample;      //!< quarter notes per sample, the phase increment of a one beat period
+    double ppqPosition;         //!< position at the start of the block in quarter notes
+    double barLength;           //!< quarter notes per bar of the time signature, 4 without one
+    bool isPlaying;
+
+    //! \brief recomputes the context for the block of the position info
+    void update(const AudioPlayHead::CurrentPositionInfo& info, double _sampleRate) {
+        // some hosts report no tempo while stopped
+        bpm = info.bpm > 0. ? info.bpm : 120.;
+        sampleRate = _sampleRate;
+        samplesPerBeat = 60. * sampleRate / bpm;
+        msPerBeat = 60000. / bpm;
+        beatsPerSample = 1. / samplesPerBeat;
+        ppqPosition = info.ppqPosition;
+        barLength = info.timeSigNumerator > 0 && info.timeSigDenominator > 0
+            ? 4. * info.timeSigNumerator / info.timeSigDenominator : 4.;
+        isPlaying = info.isPlaying;
+    }
+
+    //! \brief factor of the length of a note with the dotted and triplet modifiers
+    static double noteLengthFactor(bool dotted, bool triplet) {
+        return (dotted ? 1.5 : 1.) * (triplet ? 2. / 3. : 1.);
+    }
+
+    //! \brief phase increment per sample of a period of 1/denominator notes, with the modifiers applied
+    float getPhaseDelta(float denominator, bool dotted, bool triplet) const {
+        return static_cast<float>(beatsPerSample * denominator / 4. / noteLengthFactor(dotted, triplet));
+    }
+
+    //! \brief length of dividend/divisor whole notes in milliseconds, with the modifiers applied
+    double getNoteMs(double dividend, double divisor, bool dotted, bool triplet) const {
+        return 4. * msPerBeat * dividend / divisor * noteLengthFactor(dotted, triplet);
+    }
+};
+
+#endif  // TEMPOCONTEXT_H_INCLUDED
@@ -0,0 +1,73 @@
+/*
+  ==============================================================================
+
+    Trace.h
+    Created: 15 Oct 2026 9:12:48am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef TRACE_H_INCLUDED
+#define TRACE_H_INCLUDED
+
+#include "JuceHeader.h"
+
+//! build with SYNISTER_TRACE=1 to record spans of the audio code into a Chrome trace file
+/*! A span is a name and the start and end ticks of a piece of code on a thread. The threads
+    claim the slots of a preallocated ring with an atomic counter, so every thread, the voice
+    workers included, records without waiting or allocating. A background thread serialises the
+    spans to the Chrome trace JSON format, which chrome://tracing and ui.perfetto.dev open.
+    Spans the writer could not keep up with are overwritten and counted. Recording starts with
+    start(), or at the first span if the environment variable SYNISTER_TRACE_FILE names a file.
+    Without the flag the spans compile to nothing.
+*/
+#ifndef SYNISTER_TRACE
+ #define SYNISTER_TRACE 0
+#endif
+
+namespace Trace {
+#if SYNISTER_TRACE
+    //! \brief whether spans are recorded, any thread
+    bool isRecording();
+    //! \brief starts writing the spans to the file, replaces a recording that runs
+    void start(const File& file);
+    //! \brief writes the remaining spans and closes the file
+    void stop();
+    //! \brief spans lost because the ring was full
+    int64 getNumDropped();
+
+    //! \brief records a span of the calling thread, the name must be a literal
+    void record(const char* name, int64 startTicks, int64 endTicks);
+    //! \brief records the value of a counter at the ticks, the name must be a literal
+    void recordCounter(const char* name, int64 ticks, int64 value);
+
+    //! the lifetime of the object as a span
+    struct ScopedSpan {
+        explicit ScopedSpan(const char* n) : name(n), startTicks(isRecording() ? Time::getHighResolutionTicks() : 0) {}
+        ~ScopedSpan() {
+            if (startTicks != 0) {
+                record(name, startTicks, Time::getHighResolutionTicks());
+            }
+        }
+        const char* name;
+        int64 startTicks;
+    };
+#else
+    inline bool isRecording() { return false; }
+    inline void start(const File&) {}
+    inline void stop() {}
+    inline int64 getNumDropped() { return 0; }
+    inline void record(const char*, int64, int64) {}
+    inline void recordCounter(const char*, int64, int64) {}
+#endif
+}
+
+#if SYNISTER_TRACE
+ //! the rest of the scope as a span of the trace
+ #define SYNISTER_TRACE_SPAN(name) const Trace::ScopedSpan JUCE_JOIN_MACRO(traceSpan, __LINE__)(name)
+#else
+ #define SYNISTER_TRACE_SPAN(name)
+#endif
+
+#endif  // TRACE_H_INCLUDED
@@ -0,0 +1,50 @@
+/*
+  ==============================================================================
+
+    TransportState.h
+    Created: 15 Oct 2026 3:12:05am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef TRANSPORTSTATE_H_INCLUDED
+#define TRANSPORTSTATE_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "TripleBuffer.h"
+
+//! TransportState: position of the host, published by the audio thread once per block
+/*! The position goes through a TripleBuffer, so neither side waits and the reader never sees
+    a struct that is being written. There is one reader thread, the message thread. The audio
+    thread reads its own copy, getAudio().
+*/
+class TransportState {
+public:
+    TransportState()
+    {
+        audio.resetToDefault();
+        slots.fill(audio);
+    }
+
+    //! \brief position of the current block, audio thread only
+    AudioPlayHead::CurrentPositionInfo& getAudio() { return audio; }
+    const AudioPlayHead::CurrentPositionInfo& getAudio() const { return audio; }
+
+    //! \brief makes getAudio() visible to the reader, audio thread only
+    void publish() {
+        slots.getWriteSlot() = audio;
+        slots.publish();
+    }
+
+    //! \brief the position last published, message thread only
+    const AudioPlayHead::CurrentPositionInfo& read() { return slots.read(); }
+
+private:
+    AudioPlayHead::CurrentPositionInfo audio;
+    TripleBuffer<AudioPlayHead::CurrentPositionInfo> slots;
+
+    JUCE_DECLARE_NON_COPYABLE(TransportState)
+};
+
+#endif  // TRANSPORTSTATE_H_INCLUDED
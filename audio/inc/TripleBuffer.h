@@ -0,0 +1,78 @@
+/*
+  ==============================================================================
+
+    TripleBuffer.h
+    Created: 15 Oct 2026 6:21:37am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef TRIPLEBUFFER_H_INCLUDED
+#define TRIPLEBUFFER_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <array>
+#include <atomic>
+
+//! TripleBuffer: hands the latest value of one writer thread to one reader thread
+/*! The writer fills a slot of its own and swaps it with the middle slot, the reader swaps
+    the middle slot with its own slot whenever a newer one was published. Neither side waits
+    or allocates, and the reader never sees a value that is being written. Values the reader
+    did not pick up in time are overwritten, only the newest one counts.
+*/
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer()
+        : writeSlot(0)
+        , readSlot(1)
+        , middleSlot(2)
+    {}
+
+    //! \brief sets all slots, only while neither thread uses the buffer
+    void fill(const T& value) {
+        for (T& slot : slots) {
+            slot = value;
+        }
+    }
+
+    //! \brief the slot to fill before publish(), writer thread only
+    T& getWriteSlot() { return slots[writeSlot]; }
+
+    //! \brief makes the write slot the newest value, the writer continues in another slot
+    void publish() {
+        writeSlot = middleSlot.exchange(writeSlot | newFlag, std::memory_order_acq_rel) & slotMask;
+    }
+
+    //! \brief picks up the newest value if there is one, true if get() changed, reader thread only
+    bool update() {
+        if ((middleSlot.load(std::memory_order_relaxed) & newFlag) == 0) {
+            return false;
+        }
+        readSlot = middleSlot.exchange(readSlot, std::memory_order_acq_rel) & slotMask;
+        return true;
+    }
+
+    //! \brief the value picked up by the last update(), reader thread only
+    const T& get() const { return slots[readSlot]; }
+
+    //! \brief the newest value published, reader thread only
+    const T& read() {
+        update();
+        return get();
+    }
+
+private:
+    static const int slotMask = 3;
+    static const int newFlag = 4;   //!< set in middleSlot by publish(), cleared by update()
+
+    std::array<T, 3> slots;
+    int writeSlot;                  //!< owned by the writer
+    int readSlot;                   //!< owned by the reader
+    std::atomic<int> middleSlot;    //!< the slot between the two, with newFlag
+
+    JUCE_DECLARE_NON_COPYABLE(TripleBuffer)
+};
+
+#endif  // TRIPLEBUFFER_H_INCLUDED
@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+    Tuning.h
+    Created: 14 Oct 2026 11:48:15pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef TUNING_H_INCLUDED
+#define TUNING_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <array>
+
+//! Tuning Class: frequency of every midi note for the master tune and the loaded scale
+/*! Without a scale the notes are equally tempered with note 69 at the master tune. A Scala
+    scale (.scl) maps its first degree (1/1) to midi note 60, which keeps the frequency of
+    note 60 of the equal temperament, and repeats at the period of its last degree.
+    The scale is loaded on the message thread, the table is rebuilt by the audio thread in
+    update(), so the render code only ever reads the table.
+*/
+class Tuning {
+public:
+    static const int numNotes = 128;
+    static const int referenceNote = 60; //!< gets degree 0 of a Scala scale
+
+    Tuning();
+
+    //! \brief parses the contents of a Scala file and uses it from the next block on
+    Result loadScala(const String& scl);
+
+    //! \brief reads and loads a Scala file, see loadScala()
+    Result loadScalaFile(const File& file);
+
+    //! \brief back to 12 tone equal temperament
+    void setEqualTemperament();
+
+    //! \brief description line of the loaded scale, empty without one
+    String getDescription() const;
+
+    //! \brief rebuilds the table if the master tune or the scale changed, audio thread only
+    /*! \return true if the table has changed */
+    bool update(float masterTune);
+
+    //! \brief frequency of the note in Hz for the master tune of the last update()
+    float getNoteFrequency(int note) const {
+        jassert(note >= 0 && note < numNotes);
+        return noteFrequency[note];
+    }
+
+private:
+    //! ratios of degree 1..n of the scale to degree 0, the last one is the period, empty for equal temperament
+    Array<double> ratios;
+    String description;
+    int version;
+    mutable SpinLock lock;  //!< guards ratios, description and version
+
+    float builtMasterTune;
+    int builtVersion;
+    std::array<float, numNotes> noteFrequency;
+};
+
+#endif  // TUNING_H_INCLUDED
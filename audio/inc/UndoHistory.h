@@ -0,0 +1,67 @@
+/*
+  ==============================================================================
+
+    UndoHistory.h
+    Created: 15 Oct 2026 9:58:12pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef UNDOHISTORY_H_INCLUDED
+#define UNDOHISTORY_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <vector>
+
+class Param;
+
+//! UndoHistory: the edits of the ui as param deltas, for undo and redo
+/*! An entry is the param with its UI value before and after the edit, nothing of the patch is
+    copied. The entries of one gesture, from a mouse down to the next one, form one step: a
+    drag of a knob is one entry however many values it went through, a range slider or a mod
+    source with its amount are two. The entries are kept in a ring, the oldest steps are dropped
+    when it is full. A step is restored with Param::setUI() like an edit of the ui, so it reaches
+    the audio thread through the event queue of the ui and the host through the listeners.
+    Message thread only.
+*/
+class UndoHistory {
+public:
+    static const int capacity = 4096;   //!< entries, 16 byte each
+
+    UndoHistory();
+
+    //! \brief an edit of the ui changed the param from before to its current value
+    void record(Param& param, float before);
+
+    //! \brief restores the values before the last step, false if there is none
+    bool undo();
+    //! \brief applies the last undone step again, false if there is none
+    bool redo();
+
+    bool canUndo() const { return numUndo > 0; }
+    bool canRedo() const { return numRedo > 0; }
+
+    //! \brief forgets all steps, e.g. when another patch is loaded
+    void clear();
+
+private:
+    struct Delta {
+        Param* param;
+        float before;   //!< UI value
+        float after;    //!< UI value
+        int64 gesture;  //!< ms of the mouse down the edit belongs to
+    };
+
+    Delta& entry(int i) { return ring[static_cast<size_t>((first + i) % capacity)]; }
+    static void apply(Param& param, float value);
+
+    std::vector<Delta> ring;
+    int first;      //!< oldest entry
+    int numUndo;    //!< entries from first that can be undone
+    int numRedo;    //!< entries after them that can be redone
+
+    JUCE_DECLARE_NON_COPYABLE(UndoHistory)
+};
+
+#endif  // UNDOHISTORY_H_INCLUDED
@@ -6,7 +6,14 @@
 #include "ModulationMatrix.h"
 #include "Envelope.h"
 #include "Oscillator.h"
+#include "Lfo.h"
 #include "Filter.h"
+#include "VoiceBank.h"
+#include "FilterBank.h"
+#include "Wavetable.h"
+#include "Oversampler.h"
+#include "Instrument.h"
+#include "NoteCache.h"
 
 class Sound : public SynthesiserSound {
 public:
@@ -14,43 +21,44 @@ public:
     bool appliesToChannel(int /*midiChannel*/) override { return true; }
 };
 
-struct Lfo {
-    Lfo(int blockSize)
-        : audioBuffer(1, blockSize)
-    {
-        reset();
-    }
-    Oscillator<&Waveforms::sinus> sine;
-    Oscillator<&Waveforms::square> square;
-    RandomOscillator<&Waveforms::square> random;
-    AudioSampleBuffer audioBuffer;
-    
-    void reset() {
-        sine.reset();
-        square.reset();
-        random.reset();
-    }
-};
-
 class Voice : public SynthesiserVoice {
 public:
-    Voice(SynthParams &p, int blockSize)
+    Voice(SynthParams &p)
     : params(p)
-    , filter({ { {p.filter[0],p.filter[1] },{ p.filter[0],p.filter[1] },{ p.filter[0],p.filter[1] } } })
-    , envToVolume(p.envVol[0], p.envVol[0].sustain, getSampleRate())
-    , env2(p.env[0], p.env[0].sustain, getSampleRate())
-    , env3(p.env[1], p.env[1].sustain, getSampleRate())
+    , snap(p.getSnapshot())
+    , plan(p.getRenderPlan())
+    , totalVoiceSamples(0)
+    , fadeOutCounter(-1)
+    , lastLevel(0.f)
+    , envelopePeak(0.f)
+    , tail(false)
+    , lastModulationSamples(0)
+    , oversampling(1)
+    , noteOversampling(0)
+    , filterRouting(eFilterRouting::ePerOscillator)
+    , postMixStereo(false)
+    , noteCache(nullptr)
+    , take(nullptr)
+    , playingTake(false)
+    , takePosition(0)
+    , voiceSeed(0)
+    , noteSeeded(false)
+    , legatoNote(-1)
+    , glideFromNote(-1)
+    , glidePosition(1.f)
+    , glideStep(0.f)
+    , filter({ { { snap.filter[0], snap.filter[1] },{ snap.filter[0], snap.filter[1] },{ snap.filter[0], snap.filter[1] } } })
+    , modValuesValid(false)
     , modMatrix(p.globalModMatrix)
-    , envToVolBuffer(1, blockSize)
-    , env2Buffer(1, blockSize)
-    , env3Buffer(1, blockSize)
     , zeroMod(0.f)
-    , totalVoiceSamples(0)
-    , modDestBuffer(destinations::MAX_DESTINATIONS, blockSize)
-    , lfo({ { { blockSize},{ blockSize },{ blockSize } } })
+    , envToVolume(snap.envVol[0], getSampleRate())
+    , env2(snap.env[0], getSampleRate())
+    , env3(snap.env[1], getSampleRate())
     {
         std::fill(modSources.begin(), modSources.end(), &zeroMod);
         std::fill(modDestinations.begin(), modDestinations.end(), nullptr);
+        std::fill(globalLfo.begin(), globalLfo.end(), nullptr);
+        std::fill(modDestClean.begin(), modDestClean.end(), false);
 
         //set connection bewtween source and matrix here
         // midi
@@ -62,18 +70,98 @@ public:
         modSources[eModSource::eExpPedal] = &expPedalValue;
         modSources[eModSource::eModwheel] = &modWheelValue;
         modSources[eModSource::ePitchbend] = &pitchBend;
-        // internal
-        modSources[eModSource::eLFO1] = lfo[0].audioBuffer.getWritePointer(0);
-        modSources[eModSource::eLFO2] = lfo[1].audioBuffer.getWritePointer(0);
-        modSources[eModSource::eLFO3] = lfo[2].audioBuffer.getWritePointer(0);
-        modSources[eModSource::eVolEnv] = envToVolBuffer.getWritePointer(0);
-        modSources[eModSource::eEnv2] = env2Buffer.getWritePointer(0);
-        modSources[eModSource::eEnv3] = env3Buffer.getWritePointer(0);
+        modSources[eModSource::eNotePitch] = &notePitch;
+        modSources[eModSource::eNotePressure] = &notePressure;
+        modSources[eModSource::eNoteTimbre] = &noteTimbre;
+        controllerRamps[eRampAftertouch].value = &channelAfterTouch;
+        controllerRamps[eRampFoot].value = &footControlValue;
+        controllerRamps[eRampExpPedal].value = &expPedalValue;
+        controllerRamps[eRampModwheel].value = &modWheelValue;
+        controllerRamps[eRampPitchbend].value = &pitchBend;
+        controllerRamps[eRampNotePitch].value = &notePitch;
+        controllerRamps[eRampNotePressure].value = &notePressure;
+        controllerRamps[eRampNoteTimbre].value = &noteTimbre;
+        for (ControllerRamp& r : controllerRamps) {
+            *r.value = r.start = r.target = 0.f;
+        }
+        mpe = false;
+        // internal sources and the destinations are connected in prepare(), once the buffers exist
+    }
 
-        //set connection between destination and matrix here
-        for (size_t u = 0; u < MAX_DESTINATIONS; ++u) {
-            modDestinations[u] = modDestBuffer.getWritePointer(u);
+    //! floats per cache line, every buffer channel in the arena starts on a cache line
+    static const int arenaAlignment = 16;
+
+    //! \brief number of floats a voice takes from the voice arena for the given block size
+    static size_t getArenaSize(int blockSize) {
+        return static_cast<size_t>(numArenaChannels * getArenaStride(blockSize));
+    }
+
+    //! \brief block of the global lfo l of the synth, used instead of the own one if SynthParams::Lfo::global is on
+    void setGlobalLfo(size_t l, const float *samples) {
+        globalLfo[l] = samples;
+    }
+
+    //! \brief the takes of the synth, nullptr without a note cache
+    void setNoteCache(NoteCache* cache) {
+        noteCache = cache;
+    }
+
+    //! \brief the note records or plays a take of the note cache, it is rendered by renderNextBlock() alone
+    bool hasTake() const { return take != nullptr; }
+
+    //! \brief restart the noise and sample & hold generators of the voice
+    /** Called from prepare of the synth with the index of the voice, so every voice plays its own
+     *  sequence and an offline render sounds the same each time it is started. While the note
+     *  cache plays, the note seeds them instead, see startNote().
+    */
+    void setRandomSeed(uint32 seed) {
+        voiceSeed = seed;
+        noteSeeded = false;
+        seedRandom(seed);
+    }
+
+    //! \brief re-initialise the voice for a new sample rate and block size
+    /** All scratch buffers of the voice refer to its part of the synth's voice arena, so the
+     *  modulation, envelope, lfo and oscillator blocks of a voice are contiguous in memory.
+     *  \param arena getArenaSize(blockSize) floats, aligned to a cache line
+    */
+    void prepare(double sampleRate, int blockSize, float *arena) {
+        setCurrentPlaybackSampleRate(sampleRate);
+        envToVolume.setSampleRate(sampleRate);
+        env2.setSampleRate(sampleRate);
+        env3.setSampleRate(sampleRate);
+        lastModulationSamples = 0;
+
+        std::array<float*, numArenaChannels> channels;
+        for (int c = 0; c < numArenaChannels; ++c) {
+            channels[c] = arena + c * getArenaStride(blockSize);
+        }
+
+        float **next = channels.data();
+        modDestBuffer.setDataToReferTo(next, MAX_DESTINATIONS, blockSize);
+        next += MAX_DESTINATIONS;
+        envToVolBuffer.setDataToReferTo(next++, 1, blockSize);
+        env2Buffer.setDataToReferTo(next++, 1, blockSize);
+        env3Buffer.setDataToReferTo(next++, 1, blockSize);
+        for (Lfo& l : lfo) {
+            l.audioBuffer.setDataToReferTo(next++, 1, blockSize);
         }
+        oscBuffer.setDataToReferTo(next++, 1, blockSize);
+        ampBuffer.setDataToReferTo(next, 2, blockSize);
+        next += 2;
+        // consecutive arena channels are contiguous, so one channel can span maxFactor of them
+        oversampledBuffer.setDataToReferTo(next, 1, Decimator::maxFactor * blockSize);
+        next += Decimator::maxFactor;
+        float *mixChannels[2] = { next[0], next[Decimator::maxFactor] };
+        mixBuffer.setDataToReferTo(mixChannels, 2, Decimator::maxFactor * blockSize);
+        next += 2 * Decimator::maxFactor;
+        catchUpBuffer.setDataToReferTo(next, 2, blockSize);
+        next += 2;
+        jassert(next == channels.data() + numArenaChannels);
+
+        // the blocks of the new arena hold nothing yet
+        std::fill(modDestClean.begin(), modDestClean.end(), false);
+        connectBuffers();
     }
 
     bool canPlaySound(SynthesiserSound* sound) override
@@ -84,98 +172,85 @@ public:
 
     void startNote(int midiNoteNumber, float velocity,
         SynthesiserSound*, int currentPitchWheelPosition) override {
+        SYNISTER_COUNT("note starts", 1);
 
         totalVoiceSamples = 0;
-
-        // Initialization of midi values
-        channelAfterTouch = params.midiState.get(MidiState::eAftertouch)/128.f;
-        keyBipolar = (static_cast<float>(midiNoteNumber) - 64.f) / 64.f;
-        currentInvertedVelocity = 1.f - velocity;
-        currentVelocity = velocity;
-        footControlValue = params.midiState.get(MidiState::eFoot) / 128.f;
-        expPedalValue = params.midiState.get(MidiState::eExpPedal) / 128.f;
-        modWheelValue = params.midiState.get(MidiState::eModwheel) / 128.f;
-        pitchBend = (currentPitchWheelPosition - 8192.0f) / 8192.0f;
-
-        const float sRate = static_cast<float>(getSampleRate());
-        const float bpm = static_cast<float>(params.positionInfo[params.getGUIIndex()].bpm);
-        const float midiNoteFreq = static_cast<float>(MidiMessage::getMidiNoteInHertz(midiNoteNumber, params.freq.get()));
-
-        // change the phases of both lfo waveforms, in case the user switches them during a note
-        for (size_t l = 0; l < lfo.size(); ++l) {
-            if (params.lfo[l].tempSync.getStep() == eOnOffToggle::eOn) {
-
-                float coeff = 1.0f;
-                if (params.lfo[l].lfoDottedLength.getStep() == eOnOffToggle::eOn) {
-                    coeff /= 1.5f;
-                }
-                if (params.lfo[l].lfoTriplets.getStep() == eOnOffToggle::eOn) {
-                    coeff /= (2.0f / 3.0f);
-                }
-
-                lfo[l].sine.phase = .5f*float_Pi;
-                lfo[l].square.phase = 0.f;
-                lfo[l].random.phase = 0.f;
-
-                lfo[l].sine.phaseDelta = static_cast<float>(params.positionInfo[params.getGUIIndex()].bpm) /
-                    (60.f*sRate)*(params.lfo[l].noteLength.get() / 4.f)*2.f*float_Pi * coeff;
-                lfo[l].square.phaseDelta = static_cast<float>(params.positionInfo[params.getGUIIndex()].bpm) /
-                    (60.f*sRate)*(params.lfo[l].noteLength.get() / 4.f)*2.f*float_Pi * coeff;
-                lfo[l].random.phaseDelta = static_cast<float>(params.positionInfo[params.getGUIIndex()].bpm) /
-                    (60.f*sRate)*(params.lfo[l].noteLength.get() / 4.f)*2.f*float_Pi * coeff;
-                lfo[l].random.heldValue = static_cast <float> (rand()) / (static_cast <float> (RAND_MAX / 2.f)) - 1.f;
-            } else {
-                lfo[l].sine.phase = .5f*float_Pi;
-                lfo[l].sine.phaseDelta = params.lfo[l].freq.get() / sRate * 2.f * float_Pi;
-                lfo[l].square.phase = .5f*float_Pi;
-                lfo[l].square.phaseDelta = params.lfo[l].freq.get() / sRate * 2.f * float_Pi;
-
-                lfo[l].random.phase = 0.f;
-                lfo[l].random.phaseDelta = params.lfo[l].freq.get() / sRate * 2.f * float_Pi;
-                lfo[l].random.heldValue = static_cast <float> (rand()) / (static_cast <float> (RAND_MAX / 2.f)) - 1.f;
+        fadeOutCounter = -1;
+        noteOversampling = 0;
+        legatoNote = -1;
+        glidePosition = 1.f;
+        lastLevel = 0.f;
+        modValuesValid = false;
+        postMixStereo = false;
+
+        // a patch without live modulation plays the take of an earlier hit or records one, see NoteCache
+        releaseTake(false);
+        if (noteCache != nullptr && noteCache->isActive()) {
+            // every hit of the note draws the same noise, so it sounds like the takes of the note
+            seedRandom(noteSeedBase + static_cast<uint32>(midiNoteNumber));
+            noteSeeded = true;
+            take = noteCache->acquire(midiNoteNumber, velocity, playingTake);
+            takePosition = 0;
+            if (playingTake) {
+                // nothing of the voice but the take runs, catchUp() starts the rest where the note leaves it
+                currentVelocity = velocity;
+                envToVolume.startEnvelope();
+                lastModulationSamples = 0;
+                return;
             }
+        } else if (noteSeeded) {
+            // back to the sequence of the voice
+            seedRandom(voiceSeed);
+            noteSeeded = false;
         }
+        startLive(midiNoteNumber, velocity, currentPitchWheelPosition);
+    }
 
-        // reset attackDecayCounter
-        envToVolume.startEnvelope();
-        envToVolume.calcEnvCoeff(*(modSources[static_cast<int>(params.envVol[0].speedModSrc1.get())]),
-                                 *(modSources[static_cast<int>(params.envVol[0].speedModSrc2.get())]), isUnipolar(params.envVol[0].speedModSrc1.getStep()), isUnipolar(params.envVol[0].speedModSrc2.getStep()));
-        env2.startEnvelope();
-        env2.calcEnvCoeff(*(modSources[static_cast<int>(params.env[0].speedModSrc1.get())]),
-                          *(modSources[static_cast<int>(params.env[0].speedModSrc2.get())]), isUnipolar(params.env[0].speedModSrc1.getStep()), isUnipolar(params.env[0].speedModSrc2.getStep()));
-        env3.startEnvelope();
-        env3.calcEnvCoeff(*(modSources[static_cast<int>(params.env[1].speedModSrc1.get())]),
-                          *(modSources[static_cast<int>(params.env[1].speedModSrc2.get())]), isUnipolar(params.env[1].speedModSrc1.getStep()), isUnipolar(params.env[1].speedModSrc2.getStep()));
-
-        for (size_t o = 0; o < osc.size(); ++o) {
-            switch (params.osc[o].waveForm.getStep()) {
-                case eOscWaves::eOscSquare:
-                    osc[o].square.phase = 0.f;
-                    osc[o].square.phaseDelta = midiNoteFreq * Param::fromCent(params.osc[o].fine.get()) * 
-                                                Param::fromSemi(params.osc[o].coarse.get()) / sRate * 2.f * float_Pi;
-                    osc[o].square.width = params.osc[o].pulseWidth.get();
-                    break;
-                case eOscWaves::eOscSaw:
-                    osc[o].saw.phase = 0.f;
-                    osc[o].saw.phaseDelta = midiNoteFreq * Param::fromCent(params.osc[o].fine.get()) * 
-                                                Param::fromSemi(params.osc[o].coarse.get()) / sRate * 2.f * float_Pi;
-                    osc[o].saw.trngAmount = params.osc[o].trngAmount.get();
-                    break;
-                case eOscWaves::eOscNoise:
-                    break;
+    //! \brief mono legato: the running note moves to another key, the envelopes go on
+    /** The oscillators glide from the pitch they sound at to the new key in glideSeconds, in
+     *  steps of a block and linear in pitch, at once without glide. The voice keeps the note
+     *  the Synthesiser started it with, see getSoundingNote().
+    */
+    void legatoTo(int midiNoteNumber, float glideSeconds) {
+        if (take != nullptr) {
+            // the glide is not in the takes of the note, it goes on without
+            if (playingTake) {
+                catchUp(false);
             }
+            releaseTake(false);
         }
-
-        for (auto& filters : filter) 
-        {
-            for (Filter& f : filters) 
-            {
-                f.reset(sRate);
-            }
+        glideFromNote = getSoundingNote();
+        legatoNote = midiNoteNumber;
+        keyBipolar = (static_cast<float>(midiNoteNumber) - 64.f) / 64.f;
+        if (glideSeconds > 0.f && glideFromNote != midiNoteNumber) {
+            glidePosition = 0.f;
+            glideStep = 1.f / (glideSeconds * static_cast<float>(getSampleRate()));
+        } else {
+            glidePosition = 1.f;
         }
     }
 
+    //! \brief the key the voice plays, after legatoTo() another one than getCurrentlyPlayingNote()
+    int getSoundingNote() const { return legatoNote >= 0 ? legatoNote : getCurrentlyPlayingNote(); }
+
     void stopNote(float /*velocity*/, bool allowTailOff) override{
+        if (allowTailOff && take != nullptr && playingTake) {
+            if (envToVolume.getReleaseCounter() != -1) {
+                return;
+            }
+            // the take goes on if its note off is at the same sample, the envelope only marks the release
+            envToVolume.resetReleaseCounter();
+            if (takePosition != take->release) {
+                leaveTake(true);
+            }
+            if (playingTake) {
+                return;
+            }
+        }
+        if (allowTailOff && take != nullptr && take->release < 0) {
+            // the note off of the recorded take
+            take->release = takePosition;
+        }
         if (allowTailOff){
 
             // start a tail-off by setting this flag. The render callback will pick up on
@@ -194,6 +269,7 @@ public:
         {
             // we're being told to stop playing immediately, so reset everything..
             clearCurrentNote();
+            releaseTake(false);
 
             for (Lfo& l : lfo) {
                 l.reset();
@@ -204,16 +280,35 @@ public:
                 o.square.reset();
                 o.saw.reset();
                 o.noise.reset();
+                o.wavetable.reset();
             }
         }
     }
 
     void channelPressureChanged(int newValue) override {
-        channelAfterTouch = static_cast<float>(newValue) / 128.f;
+        const float pressure = static_cast<float>(newValue) / 128.f;
+        controllerRamps[eRampNotePressure].target = pressure;
+        if (!mpe) {
+            controllerRamps[eRampAftertouch].target = pressure;
+        }
     }
 
     void pitchWheelMoved(int newValue) override{
-        pitchBend = (newValue - 8192.f) / 8192.0f;
+        const float bend = (newValue - 8192.f) / 8192.0f;
+        controllerRamps[eRampNotePitch].target = bend;
+        if (!mpe) {
+            controllerRamps[eRampPitchbend].target = bend;
+        }
+    }
+
+    //! \brief pressure of the mpe master channel, the channel wide aftertouch of all notes
+    void masterChannelPressureChanged(int newValue) {
+        controllerRamps[eRampAftertouch].target = static_cast<float>(newValue) / 128.f;
+    }
+
+    //! \brief pitch wheel of the mpe master channel, the channel wide pitch bend of all notes
+    void masterPitchWheelMoved(int newValue) {
+        controllerRamps[eRampPitchbend].target = (newValue - 8192.f) / 8192.0f;
     }
 
     //Midi Control
@@ -222,140 +317,846 @@ public:
         switch(controllerNumber){
         //Modwheel
         case 1:
-            modWheelValue = static_cast<float>(newValue) / 128.f;
+            controllerRamps[eRampModwheel].target = static_cast<float>(newValue) / 128.f;
             break;
         //Foot Controller
         case 4:
-            footControlValue = (static_cast<float>(newValue) / 128.f); //TODO: test
+            controllerRamps[eRampFoot].target = (static_cast<float>(newValue) / 128.f); //TODO: test
             break;
         //Expression Control
         case 11:
-            expPedalValue = static_cast<float>(newValue) / 128.f; //TODO: test
+            controllerRamps[eRampExpPedal].target = static_cast<float>(newValue) / 128.f; //TODO: test
+            break;
+        //Timbre, the third mpe dimension
+        case 74:
+            controllerRamps[eRampNoteTimbre].target = static_cast<float>(newValue) / 128.f;
             break;
         }
     }
 
     void renderNextBlock(AudioSampleBuffer& outputBuffer, int startSample, int numSamples) override{
-        
-        const float sRate = static_cast<float>(getSampleRate());
-        const float midiNoteFreq = static_cast<float>(MidiMessage::getMidiNoteInHertz(getCurrentlyPlayingNote(), params.freq.get()));
-
-        // if voice active
-        if (lfo[0].sine.isActive() || lfo[0].square.isActive() ||
-            lfo[1].sine.isActive() || lfo[1].square.isActive() ||
-            lfo[2].sine.isActive() || lfo[2].square.isActive() ){
-
-            // Modulation
-            renderModulation(numSamples);
-
-            const float *envToVolMod = envToVolBuffer.getReadPointer(0);
-
-            // oscillators
-            for (size_t o = 0; o < params.osc.size(); ++o) {
-                if (params.osc[o].oscActivation.getStep() == eOnOffToggle::eOn) {
-                     // oscillators phaseDelta and squareWidth / tiangleAmount update
-                    switch (params.osc[o].waveForm.getStep()) {
-                        case eOscWaves::eOscSquare:
-                        {
-                            osc[o].square.phaseDelta = midiNoteFreq * Param::fromCent(params.osc[o].fine.get()) *
-                                Param::fromSemi(params.osc[o].coarse.get()) / sRate * 2.f * float_Pi;
-                            osc[o].square.width = params.osc[o].pulseWidth.get();
-                        }
-                        break;
-                        case eOscWaves::eOscSaw:
-                        {
-                            osc[o].saw.phaseDelta = midiNoteFreq * Param::fromCent(params.osc[o].fine.get()) *
-                                Param::fromSemi(params.osc[o].coarse.get()) / sRate * 2.f * float_Pi;
-                            osc[o].saw.trngAmount = params.osc[o].trngAmount.get();
-                        }
-                        break;
-                    }
 
-                    const float *pitchMod = modDestBuffer.getReadPointer(DEST_OSC1_PI + o);
-                    const float *shapeMod = modDestBuffer.getReadPointer(DEST_OSC1_PW + o);
-                    const float *panMod = modDestBuffer.getReadPointer(DEST_OSC1_PAN + o);
-                    const float *gainMod = modDestBuffer.getReadPointer(DEST_OSC1_GAIN + o);
-                    
-                    for (int s = 0; s < numSamples; ++s) {
-                        
-                        float currentSample = 0.0f;
-                        
-                        switch (params.osc[o].waveForm.getStep()) {
-                            case eOscWaves::eOscSquare: 
-                            {
-                                // In case of pulse width modulation
-                                float delta = shapeMod[s];
-                                delta = std::min(osc[o].square.width + delta, params.osc[o].pulseWidth.getMax()) - osc[o].square.width;
-                                delta = std::max(osc[o].square.width + delta, params.osc[o].pulseWidth.getMin()) - osc[o].square.width;
-                                currentSample = (osc[o].square.next(pitchMod[s], delta));
-                            }
-                                break;
-                            case eOscWaves::eOscSaw:
-                            {
-                                // In case of triangle modulation
-                                float delta = shapeMod[s];
-                                delta = std::min(osc[o].saw.trngAmount + delta, params.osc[o].trngAmount.getMax()) - osc[o].saw.trngAmount;
-                                delta = std::max(osc[o].saw.trngAmount + delta, params.osc[o].trngAmount.getMin()) - osc[o].saw.trngAmount;
-                                // Next sample will be fetch with the new width
-                                currentSample = (osc[o].saw.next(pitchMod[s], delta));
-                            }
-                                break;
-                            case eOscWaves::eOscNoise:
-                                currentSample = (osc[o].noise.next(pitchMod[s]));
-                                break;
-                        }
-                        
-                        // filter
-                        for (size_t f = 0; f < params.filter.size(); ++f)
-                        {
-                            if(params.filter[f].filterActivation.getStep() == eOnOffToggle::eOn) {
-                                const float *filterLCMod = modDestBuffer.getReadPointer(DEST_FILTER1_LC + f);
-                                const float *filterHCMod = modDestBuffer.getReadPointer(DEST_FILTER1_HC + f);
-                                const float *resMod = modDestBuffer.getReadPointer(DEST_FILTER1_RES + f);
-                                currentSample = filter[o][f].run(currentSample, filterLCMod[s], filterHCMod[s], resMod[s]);
-                            }
-                        }
-                        
-                        // gain + pan
-                        const float currentAmp =    params.osc[o].vol.get() * Param::fromDb(gainMod[s] *
-                                                                                            params.osc[o].gainModAmount1.getMax()) * envToVolMod[s];
-                        
-                        // check if the output is a stereo output
-                        if (outputBuffer.getNumChannels() == 2){
-                            // Pan Influence
-                            const float currentPan = params.osc[o].panDir.get() + panMod[s] * 100.f;
-                            //const float currentPan = panMod[s] * 100.f;
-                            const float currentAmpRight = currentAmp + (currentAmp / 100.f * currentPan);
-                            const float currentAmpLeft = currentAmp - (currentAmp / 100.f * currentPan);
-                            outputBuffer.addSample(0, startSample + s, currentSample*currentAmpLeft);
-                            outputBuffer.addSample(1, startSample + s, currentSample*currentAmpRight);
-                        }
-                        else {
-                            for (int c = 0; c < outputBuffer.getNumChannels(); ++c) {
-                                outputBuffer.addSample(c, startSample + s, currentSample * currentAmp);
-                            }
-                        }
-                        if (envToVolume.getReleaseSamples() <= envToVolume.getReleaseCounter()) {
-                            // next osc 
-                            break;
-                        }
+        if (!isVoiceActive()) {
+            return;
+        }
+        SYNISTER_SCOPE_FINE("voice");
+        while (numSamples > 0 && take != nullptr && playingTake) {
+            const int n = playTake(outputBuffer, startSample, numSamples);
+            startSample += n;
+            numSamples -= n;
+        }
+        if (numSamples == 0 || !isVoiceActive()) {
+            return;
+        }
+        if (take != nullptr) {
+            recordTake(outputBuffer, startSample, numSamples);
+        } else {
+            renderLive(outputBuffer, startSample, numSamples);
+        }
+    }
+
+    //! \brief render the block of the voice from its oscillators, filters and modulation
+    void renderLive(AudioSampleBuffer& outputBuffer, int startSample, int numSamples) {
+        if (beginBlock(numSamples)) {
+            if (filterRouting == eFilterRouting::ePostMix) {
+                renderPostMix(outputBuffer, startSample, numSamples);
+            } else {
+                // the active oscillators of the render plan
+                for (int i = 0; i < plan.numActiveOscillators; ++i) {
+                    const size_t o = static_cast<size_t>(plan.oscillators[i]);
+                    if (isOscillatorAudible(o, numSamples)) {
+                        renderOscillator(o, numSamples);
+                        mixOscillator(o, outputBuffer, startSample, numSamples);
+                    } else {
+                        skipOscillator(o, numSamples);
                     }
                 }
             }
+            endBlock(numSamples);
+        }
+    }
+
+    //! \brief render the modulation and update the oscillator increments for the next block
+    /** \return false if the voice is idle and nothing has to be rendered
+    */
+    bool beginBlock(int numSamples) {
+
+        if (!isVoiceActive()) {
+            return false;
+        }
+        SYNISTER_SCOPE_FINE("modulation");
+
+        const float sRate = static_cast<float>(getSampleRate());
+        const int note = getSoundingNote();
+        // the frequency of a glide, as a ratio of the one of the key
+        float glideRatio = 1.f;
+        if (glidePosition < 1.f) {
+            const float from = snap.osc[0].noteFreq[glideFromNote];
+            const float to = snap.osc[0].noteFreq[note];
+            glideRatio = to > 0.f ? std::pow(from / to, 1.f - glidePosition) : 1.f;
+            glidePosition = jmin(1.f, glidePosition + glideStep * static_cast<float>(numSamples));
+        }
+
+        // a quiet release tail takes the coarsest control rate, no oversampling and fewer filter designs
+        tail = envToVolume.isReleasing() && lastLevel < snap.tailLevel;
+
+        // Modulation
+        renderModulation(numSamples);
+        if (fadeOutCounter >= 0) {
+            applyFadeOut(numSamples);
+        }
+        envelopePeak = FloatVectorOperations::findMaximum(envToVolBuffer.getReadPointer(0), numSamples);
+
+        // oscillators and filters run at the oversampled rate
+        // the filters and decimators carry another signal after a change of the routing
+        const bool routingChanged = snap.filterRouting != filterRouting;
+        // an adaptive note keeps the factor of its first block, a switch would restart the decimators
+        int factor = snap.oversampling;
+        if (snap.adaptiveOversampling) {
+            if (noteOversampling == 0) {
+                noteOversampling = chooseOversampling(note);
+            }
+            factor = jlimit(snap.minOversampling, snap.oversampling, noteOversampling);
+        }
+        // the switch restarts the decimators and the pad, the jump is at the level of the tail
+        if (tail) {
+            factor = 1;
+        }
+        if (factor != oversampling || routingChanged) {
+            oversampling = factor;
+            filterRouting = snap.filterRouting;
+            postMixStereo = false;
+            for (Osc& o : osc) {
+                o.decimator.reset();
+                o.pad.reset();
+            }
+        }
+        const float oscRate = sRate * static_cast<float>(oversampling);
+        for (auto& filters : filter) {
+            for (Filter& f : filters) {
+                if (routingChanged) {
+                    f.reset(oscRate);
+                } else {
+                    f.setSampleRate(oscRate);
+                }
+                f.setCoefficientInterval(tail ? tailCoefficientInterval : Filter::coefficientInterval);
+            }
+        }
+
+        // oscillators phaseDelta and squareWidth / tiangleAmount update
+        for (int i = 0; i < plan.numActiveOscillators; ++i) {
+            const size_t o = static_cast<size_t>(plan.oscillators[i]);
+            switch (snap.osc[o].waveForm) {
+                case eOscWaves::eOscSquare:
+                {
+                    osc[o].square.phaseDelta = glideRatio * snap.osc[o].noteFreq[note] / oscRate;
+                    osc[o].square.width = snap.osc[o].pulseWidth;
+                    osc[o].unison.setup(snap.osc[o].unisonVoices, snap.osc[o].unisonDetune, snap.osc[o].unisonSpread);
+                }
+                break;
+                case eOscWaves::eOscSaw:
+                {
+                    osc[o].saw.phaseDelta = glideRatio * snap.osc[o].noteFreq[note] / oscRate;
+                    osc[o].saw.trngAmount = snap.osc[o].trngAmount;
+                    osc[o].unison.setup(snap.osc[o].unisonVoices, snap.osc[o].unisonDetune, snap.osc[o].unisonSpread);
+                }
+                break;
+                case eOscWaves::eOscWavetable:
+                {
+                    osc[o].wavetable.phaseDelta = glideRatio * snap.osc[o].noteFreq[note] / oscRate;
+                    osc[o].wavetable.trngAmount = snap.osc[o].trngAmount;
+                }
+                break;
+                case eOscWaves::eOscSample:
+                    osc[o].sampler.setFrequency(glideRatio * snap.osc[o].noteFreq[note], oscRate);
+                break;
+                default:
+                break;
+            }
+        }
+        return true;
+    }
+
+    //! \brief false if the gain of oscillator o stays below cullThreshold for the whole block
+    /** An upper bound of the gain: its volume times the loudest gain modulation of the block times
+     *  the peak of the volume envelope. Patches that fade oscillators in and out by modulation
+     *  render only the ones that can be heard, see skipOscillator().
+    */
+    bool isOscillatorAudible(size_t o, int numSamples) const {
+        float gain = snap.osc[o].vol * envelopePeak;
+        if (modMatrix.hasCompiledRoute(static_cast<destinations>(DEST_OSC1_GAIN + o))) {
+            const Range<float> mod = FloatVectorOperations::findMinAndMax(modDestBuffer.getReadPointer(DEST_OSC1_GAIN + o), numSamples);
+            const float db = jmax(mod.getStart() * snap.osc[o].gainModRange, mod.getEnd() * snap.osc[o].gainModRange);
+            gain = db <= Param::MIN_DB ? 0.f : gain * FastMath::dbToGain(db);
+        }
+        return gain >= cullThreshold;
+    }
+
+    //! \brief advance oscillator o over a block it cannot be heard in, instead of rendering it and its filters
+    /** The phase moves by the pitch modulation of the block, so the oscillator rejoins where it
+     *  would be if it had been rendered. The filters, the decimator and the pad keep their state;
+     *  the jump of their input when it rejoins is scaled by a gain below cullThreshold.
+    */
+    void skipOscillator(size_t o, int numSamples) {
+        SYNISTER_COUNT_FINE("culled oscillators", 1);
+        const float *pitchMod = modDestBuffer.getReadPointer(DEST_OSC1_PI + o);
+        float pitchSum = 0.f;
+        for (int s = 0; s < numSamples; ++s) {
+            pitchSum += pitchMod[s];
+        }
+        // the sub-samples of a sample share its modulation
+        pitchSum *= static_cast<float>(1 << getOversamplingShift());
+
+        switch (plan.kernel[o]) {
+            case RenderPlan::eSquare:
+            case RenderPlan::eSquareBandLimited:
+                osc[o].square.skip(pitchSum);
+                break;
+            case RenderPlan::eSquareUnison:
+            case RenderPlan::eSquareUnisonBandLimited:
+                osc[o].unison.skip(osc[o].square.phaseDelta, pitchSum);
+                break;
+            case RenderPlan::eSaw:
+            case RenderPlan::eSawBandLimited:
+                osc[o].saw.skip(pitchSum);
+                break;
+            case RenderPlan::eSawUnison:
+            case RenderPlan::eSawUnisonBandLimited:
+                osc[o].unison.skip(osc[o].saw.phaseDelta, pitchSum);
+                break;
+            case RenderPlan::eWavetable:
+                osc[o].wavetable.skip(pitchSum);
+                break;
+            case RenderPlan::eSample:
+                osc[o].sampler.skip(pitchSum);
+                break;
+            default:
+                // white noise has no phase
+                break;
+        }
+    }
+
+    //! \brief render and filter one block of oscillator o into the scratch buffer
+    /** With oversampling the oscillator and its filters run at oversampling times the rate into
+     *  the oversampled scratch, the modulation is held for the sub-samples of a sample, and the
+     *  result is decimated into the scratch buffer.
+    */
+    void renderOscillator(size_t o, int numSamples) {
+        SYNISTER_SCOPE_FINE("oscillator");
+
+        const int shift = getOversamplingShift();
+        float *oscSamples = generateOscillator(o, numSamples, shift);
+
+        filterOscillator(o, oscSamples, numSamples << shift, shift);
+        if (shift > 0) {
+            osc[o].decimator.process(oscSamples, oscBuffer.getWritePointer(0), numSamples, oversampling);
+        }
+        osc[o].pad.process(oscBuffer.getWritePointer(0), numSamples, getLatencyPad());
+    }
+
+    //! \brief samples the output of the voice is delayed by to line up with the largest factor of the block
+    int getLatencyPad() const {
+        return Decimator::getLatency(snap.oversampling) - Decimator::getLatency(oversampling);
+    }
+
+    //! \brief the oversampling factor of a note with adaptive oversampling
+    /** Aliasing is audible where the partials a waveform folds back are still loud: the naive
+     *  square and saw fall by 6 dB per octave, PolyBLEP removes most of the fold until the
+     *  fundamental gets near the rate, the wavetables are band limited and the sample is
+     *  resampled, so they need none. The fundamental is taken at the top of the pitch modulation
+     *  of routed oscillators. A resonant ladder adds partials of its own, with 2x at least.
+     *  \param note the sounding key, the factor is kept for the whole note
+     */
+    int chooseOversampling(int note) const {
+        const float sRate = static_cast<float>(getSampleRate());
+        int factor = 1;
+        float topRatio = 0.f;
+        for (int i = 0; i < plan.numActiveOscillators; ++i) {
+            const size_t o = static_cast<size_t>(plan.oscillators[i]);
+            const ParamSnapshot::Osc& s = snap.osc[o];
+            float top = s.noteFreq[note];
+            if (modMatrix.hasCompiledRoute(static_cast<destinations>(DEST_OSC1_PI + o))) {
+                top *= Param::fromSemi(s.pitchModRange);
+            }
+            const float ratio = top / sRate;
+            topRatio = jmax(topRatio, ratio);
+            if (s.waveForm == eOscWaves::eOscSquare || s.waveForm == eOscWaves::eOscSaw) {
+                factor = jmax(factor, ratio > getAliasRatio(s.bandLimited, 4) ? 4 : (ratio > getAliasRatio(s.bandLimited, 2) ? 2 : 1));
+            }
+        }
+        for (int i = 0; i < plan.numActiveFilters; ++i) {
+            const ParamSnapshot::Filter& f = snap.filter[static_cast<size_t>(plan.filters[i])];
+            const float resonance = (f.resonance - f.resonanceMin) / (f.resonanceMax - f.resonanceMin);
+            if (f.passtype == eBiquadFilters::eLadder && !f.ladderOversampling && resonance > ladderResonance) {
+                factor = jmax(factor, topRatio > getAliasRatio(true, 2) ? 4 : 2);
+            }
+        }
+        return factor;
+    }
+
+    //! \name adaptive oversampling, see chooseOversampling()
+    ///@{
+    //! \brief fundamental over the rate above which a square or saw takes the factor 2 or 4
+    /** About 190 Hz and 750 Hz at 48 kHz for the naive waveforms, 1.5 kHz and 4 kHz for PolyBLEP. */
+    static float getAliasRatio(bool bandLimited, int factor) {
+        return bandLimited ? (factor == 4 ? 1.f / 12.f : 1.f / 32.f) : (factor == 4 ? 1.f / 64.f : 1.f / 256.f);
+    }
+    constexpr static float ladderResonance = .5f;     //!< of the range of the resonance, above the ladder takes 2x
+    ///@}
+
+    //! \brief render one block of oscillator o at the oscillator rate, without filters
+    /** \param shift sub-sample s uses the modulation of sample s >> shift, see getOversamplingShift()
+     *  \return numSamples << shift samples in the scratch buffer, or in the oversampled scratch with oversampling
+    */
+    float* generateOscillator(size_t o, int numSamples, int shift) {
+
+        const float *pitchMod = modDestBuffer.getReadPointer(DEST_OSC1_PI + o);
+        const float *shapeMod = modDestBuffer.getReadPointer(DEST_OSC1_PW + o);
+
+        const int numOscSamples = numSamples << shift;
+        float *oscSamples = shift == 0 ? oscBuffer.getWritePointer(0) : oversampledBuffer.getWritePointer(0);
+
+        // the kernel the render plan bound to the waveform and the settings of the oscillator
+        (this->*getOscKernel(plan.kernel[o]))(o, oscSamples, pitchMod, shapeMod, numOscSamples, shift);
+        return oscSamples;
+    }
+
+    //! \brief mix the active oscillators with gain and pan, then filter the mix and add it to the output
+    /** The oscillators share one pair of filters instead of a pair each. Gain and pan are applied
+     *  before the filters at the oscillator rate, held for the sub-samples. The mix stays mono as
+     *  long as all oscillators sit at the same pan position without pan modulation, otherwise the
+     *  left and the right mix run through the filters of oscillator 1 and 2 respectively.
+    */
+    void renderPostMix(AudioSampleBuffer& outputBuffer, int startSample, int numSamples) {
+
+        const int shift = getOversamplingShift();
+        const int numOscSamples = numSamples << shift;
+        const bool stereoOutput = outputBuffer.getNumChannels() == 2;
+
+        // a common pan position is applied after the filters
+        bool stereoMix = false;
+        bool hasPanDir = false;
+        float commonPanDir = 0.f;
+        for (int i = 0; i < plan.numActiveOscillators; ++i) {
+            const size_t o = static_cast<size_t>(plan.oscillators[i]);
+            const float panDir = snap.osc[o].panDir / 100.f;
+            stereoMix = stereoMix || modMatrix.hasCompiledRoute(static_cast<destinations>(DEST_OSC1_PAN + o))
+                || (hasPanDir && panDir != commonPanDir);
+            commonPanDir = panDir;
+            hasPanDir = true;
+        }
+        stereoMix = stereoOutput && stereoMix;
+        if (stereoMix && !postMixStereo) {
+            // the right filters did not run while the mix was mono
+            for (Filter& f : filter[1]) {
+                f.reset(static_cast<float>(getSampleRate()) * static_cast<float>(oversampling));
+            }
+            osc[1].decimator.reset();
+        }
+        postMixStereo = stereoMix;
+
+        float *mixLeft = mixBuffer.getWritePointer(0);
+        float *mixRight = mixBuffer.getWritePointer(1);
+        FloatVectorOperations::clear(mixLeft, numOscSamples);
+        if (stereoMix) {
+            FloatVectorOperations::clear(mixRight, numOscSamples);
+        }
+
+        float *amp = ampBuffer.getWritePointer(0);
+        float *pan = ampBuffer.getWritePointer(1);
+        for (int i = 0; i < plan.numActiveOscillators; ++i) {
+            const size_t o = static_cast<size_t>(plan.oscillators[i]);
+            if (!isOscillatorAudible(o, numSamples)) {
+                skipOscillator(o, numSamples);
+                continue;
+            }
+            const float *oscSamples = generateOscillator(o, numSamples, shift);
+
+            // gain
+            renderGain(o, amp, numSamples);
+
+            if (stereoMix) {
+                // same pan law as mixOscillator()
+                const float *panMod = modDestBuffer.getReadPointer(DEST_OSC1_PAN + o);
+                const float panDir = snap.osc[o].panDir / 100.f;
+
+                FloatVectorOperations::fill(pan, 1.f - panDir, numSamples);
+                FloatVectorOperations::subtract(pan, panMod, numSamples);
+                FloatVectorOperations::multiply(pan, amp, numSamples);
+                for (int s = 0; s < numOscSamples; ++s) {
+                    mixLeft[s] += oscSamples[s] * pan[s >> shift];
+                }
+
+                FloatVectorOperations::fill(pan, 1.f + panDir, numSamples);
+                FloatVectorOperations::add(pan, panMod, numSamples);
+                FloatVectorOperations::multiply(pan, amp, numSamples);
+                for (int s = 0; s < numOscSamples; ++s) {
+                    mixRight[s] += oscSamples[s] * pan[s >> shift];
+                }
+            } else {
+                for (int s = 0; s < numOscSamples; ++s) {
+                    mixLeft[s] += oscSamples[s] * amp[s >> shift];
+                }
+            }
+        }
+
+        // filters and decimation, the decimator may work in place
+        const int numMixes = stereoMix ? 2 : 1;
+        for (int c = 0; c < numMixes; ++c) {
+            float *mix = mixBuffer.getWritePointer(c);
+            filterOscillator(static_cast<size_t>(c), mix, numOscSamples, shift);
+            if (shift > 0) {
+                osc[c].decimator.process(mix, mix, numSamples, oversampling);
+            }
+            osc[c].pad.process(mix, numSamples, getLatencyPad());
+            FloatVectorOperations::multiply(mix, envToVolBuffer.getReadPointer(0), numSamples);
+        }
 
-            if (envToVolume.getReleaseSamples() <= envToVolume.getReleaseCounter()){
-                clearCurrentNote();
-                for (size_t l = 0; l < lfo.size(); ++l) {
-                    lfo[l].sine.reset();
-                    lfo[l].square.reset();
+        if (stereoMix) {
+            FloatVectorOperations::add(outputBuffer.getWritePointer(0, startSample), mixLeft, numSamples);
+            FloatVectorOperations::add(outputBuffer.getWritePointer(1, startSample), mixRight, numSamples);
+        } else if (stereoOutput) {
+            FloatVectorOperations::addWithMultiply(outputBuffer.getWritePointer(0, startSample), mixLeft, 1.f - commonPanDir, numSamples);
+            FloatVectorOperations::addWithMultiply(outputBuffer.getWritePointer(1, startSample), mixLeft, 1.f + commonPanDir, numSamples);
+        } else {
+            for (int c = 0; c < outputBuffer.getNumChannels(); ++c) {
+                FloatVectorOperations::add(outputBuffer.getWritePointer(c, startSample), mixLeft, numSamples);
+            }
+        }
+    }
+
+    //! \brief add the filtered scratch buffer of oscillator o with gain and pan to the output
+    void mixOscillator(size_t o, AudioSampleBuffer& outputBuffer, int startSample, int numSamples) {
+
+        const float *envToVolMod = envToVolBuffer.getReadPointer(0);
+        const float *panMod = modDestBuffer.getReadPointer(DEST_OSC1_PAN + o);
+
+        const float *oscSamples = oscBuffer.getReadPointer(0);
+
+        // gain
+        float *amp = ampBuffer.getWritePointer(0);
+        renderGain(o, amp, numSamples);
+        FloatVectorOperations::multiply(amp, envToVolMod, numSamples);
+        FloatVectorOperations::multiply(amp, oscSamples, numSamples);
+
+        // check if the output is a stereo output
+        if (outputBuffer.getNumChannels() == 2) {
+            // Pan Influence: right = amp * (1 + pan/100), left = amp * (1 - pan/100)
+            float *pan = ampBuffer.getWritePointer(1);
+            const float panDir = snap.osc[o].panDir / 100.f;
+
+            FloatVectorOperations::fill(pan, 1.f - panDir, numSamples);
+            FloatVectorOperations::subtract(pan, panMod, numSamples);
+            FloatVectorOperations::addWithMultiply(outputBuffer.getWritePointer(0, startSample), amp, pan, numSamples);
+
+            FloatVectorOperations::fill(pan, 1.f + panDir, numSamples);
+            FloatVectorOperations::add(pan, panMod, numSamples);
+            FloatVectorOperations::addWithMultiply(outputBuffer.getWritePointer(1, startSample), amp, pan, numSamples);
+        }
+        else {
+            for (int c = 0; c < outputBuffer.getNumChannels(); ++c) {
+                FloatVectorOperations::add(outputBuffer.getWritePointer(c, startSample), amp, numSamples);
+            }
+        }
+    }
+
+    //! \brief run the active filters of oscillator o in place, sample s uses the modulation of sample s >> shift
+    /** With the post mix routing o is the channel of the mix. */
+    void filterOscillator(size_t o, float *samples, int numFilterSamples, int shift) {
+        SYNISTER_SCOPE_FINE("filter");
+        for (int i = 0; i < plan.numActiveFilters; ++i) {
+            const size_t f = static_cast<size_t>(plan.filters[i]);
+            filter[o][f].process(samples, numFilterSamples, getFilterMod(DEST_FILTER1_LC + f), getFilterMod(DEST_FILTER1_HC + f),
+                                 getFilterMod(DEST_FILTER1_RES + f), shift, snap.mathAccuracy);
+        }
+    }
+
+    //! \brief modulation block of a filter destination, nullptr if no source is routed to it
+    const float* getFilterMod(size_t destination) const {
+        return modMatrix.hasCompiledRoute(static_cast<destinations>(destination)) ? modDestBuffer.getReadPointer(static_cast<int>(destination)) : nullptr;
+    }
+
+    //! \brief true if filter f is switched on for the current block
+    bool isFilterActive(size_t f) const { return plan.isFilterActive(f); }
+
+    //! \brief run filter f of oscillator o over the scratch buffer, for oscillators taken from a voice bank
+    void filterScratch(size_t o, size_t f, int numSamples) {
+        filter[o][f].process(oscBuffer.getWritePointer(0), numSamples, getFilterMod(DEST_FILTER1_LC + f), getFilterMod(DEST_FILTER1_HC + f),
+                             getFilterMod(DEST_FILTER1_RES + f), 0, snap.mathAccuracy);
+    }
+
+    //! \brief copy the state of filter f of oscillator o and the scratch buffer into a lane of the filter bank
+    void loadFilterLane(size_t o, size_t f, FilterBank& bank, int lane) const {
+        Filter::LaneState st;
+        filter[o][f].getLaneState(snap.filter[f].passtype, st);
+        bank.setLane(lane, st, oscBuffer.getReadPointer(0), getFilterMod(DEST_FILTER1_LC + f),
+                     getFilterMod(DEST_FILTER1_HC + f), getFilterMod(DEST_FILTER1_RES + f));
+    }
+
+    //! \brief take back the filter state and the filtered block from a lane of the filter bank
+    void storeFilterLane(size_t o, size_t f, const FilterBank& bank, int lane) {
+        Filter::LaneState st;
+        bank.getLane(lane, st, oscBuffer.getWritePointer(0));
+        filter[o][f].setLaneState(snap.filter[f].passtype, st);
+    }
+
+    //! \brief routing of the filters for the current block
+    eFilterRouting getFilterRouting() const { return filterRouting; }
+
+    //! \brief finish the block, frees the voice once the release is over or inaudible
+    void endBlock(int numSamples) {
+        lastLevel = envToVolBuffer.getSample(0, numSamples - 1);
+        // the tail is the silence boundary where the filter state decays into the denormal range
+        if (envToVolume.isReleasing()) {
+            for (auto& filters : filter) {
+                for (Filter& f : filters) {
+                    f.flushState();
                 }
             }
-            totalVoiceSamples += numSamples;
+        }
+        if (envToVolume.getReleaseSamples() <= envToVolume.getReleaseCounter()
+            || fadeOutCounter == 0
+            || (envToVolume.isReleasing() && envelopePeak < silenceThreshold)) {
+            retire();
+        }
+        totalVoiceSamples += numSamples;
+    }
+
+    //! \brief steal the voice with a short fade instead of a hard cut
+    void fadeOut() {
+        if (fadeOutCounter < 0) {
+            SYNISTER_COUNT("voice steals", 1);
+            fadeOutCounter = jmax(1, static_cast<int>(fadeOutTime * getSampleRate()));
+            // the fade must not end up in the take, the rest of the note is rendered without it
+            if (take != nullptr && !playingTake) {
+                releaseTake(false);
+            }
+        }
+    }
+
+    bool isFadingOut() const { return fadeOutCounter >= 0; }
+    bool isReleasing() const { return envToVolume.isReleasing(); }
+
+    //! \brief number of denormal filter state variables of the voice
+    int countDenormalState() const {
+        int numDenormals = 0;
+        for (const auto& filters : filter) {
+            for (const Filter& f : filters) {
+                numDenormals += f.countDenormalState();
+            }
+        }
+        return numDenormals;
+    }
+
+    //! \brief volume envelope level at the end of the last block
+    float getLevel() const { return lastLevel; }
+
+    //! \brief the mod sources and destinations at the end of the last block, for the ui
+    /** Sources nothing reads keep the samples of the last block that read them. */
+    void fillModulationFrame(ModulationFrame& frame) const {
+        frame.note = getSoundingNote();
+        if (lastModulationSamples == 0) {
+            frame.sources.fill(0.f);
+            frame.destinations.fill(0.f);
+            return;
+        }
+        const int last = lastModulationSamples - 1;
+        frame.sources[eModSource::eNone] = 0.f;
+        for (int s = eModSource::eNone + 1; s < eModSource::nSteps; ++s) {
+            const float *source = modSources[s];
+            frame.sources[s] = isBlockSource(static_cast<eModSource>(s)) ? source[last] : *source;
+        }
+        for (int u = 0; u < MAX_DESTINATIONS; ++u) {
+            frame.destinations[u] = modDestBuffer.getSample(u, last);
         }
     }
 
+    //! \brief true if oscillator o is switched on for the current block
+    bool isOscillatorActive(size_t o) const { return plan.isOscillatorActive(o); }
+
+    //! \brief copy the oscillator state of oscillator o into a lane of the voice bank
+    void loadBankLane(size_t o, VoiceBank& bank, int lane) const {
+        const float *pitchMod = modDestBuffer.getReadPointer(DEST_OSC1_PI + o);
+        const float *shapeMod = modDestBuffer.getReadPointer(DEST_OSC1_PW + o);
+
+        switch (snap.osc[o].waveForm) {
+            case eOscWaves::eOscSquare:
+                bank.setLane(lane, osc[o].square.phase, osc[o].square.phaseDelta, osc[o].square.width, pitchMod, shapeMod);
+                break;
+            case eOscWaves::eOscSaw:
+                bank.setLane(lane, osc[o].saw.phase, osc[o].saw.phaseDelta, osc[o].saw.trngAmount, pitchMod, shapeMod);
+                break;
+            default:
+                bank.setLane(lane, 0.f, 0.f, 0.f, pitchMod, shapeMod);
+                bank.setNoiseState(lane, osc[o].noise.random.getState());
+                break;
+        }
+    }
+
+    //! \brief take back the oscillator state and the rendered block from a lane of the voice bank
+    void storeBankLane(size_t o, const VoiceBank& bank, int lane) {
+        switch (snap.osc[o].waveForm) {
+            case eOscWaves::eOscSquare:
+                osc[o].square.phase = bank.getPhase(lane);
+                break;
+            case eOscWaves::eOscSaw:
+                osc[o].saw.phase = bank.getPhase(lane);
+                break;
+            default:
+                osc[o].noise.random.setState(bank.getNoiseState(lane));
+                break;
+        }
+        bank.copyLaneOutput(lane, oscBuffer.getWritePointer(0));
+    }
+
 protected:
 
+    //! volume envelope level below which a releasing voice is retired (-96 dB)
+    static constexpr float silenceThreshold = 1.5849e-5f;
+
+    //! gain below which an oscillator is not rendered for a block (-90 dB), see isOscillatorAudible()
+    static constexpr float cullThreshold = 3.1623e-5f;
+
+    //! samples per filter design in the release tail, see beginBlock()
+    static const int tailCoefficientInterval = 64;
+
+    //! length of the fade when the voice is stolen in s
+    static constexpr float fadeOutTime = .005f;
+
+    //! \brief ramp the volume envelope down to zero while the voice is being stolen
+    void applyFadeOut(int numSamples) {
+        float *envToVol = envToVolBuffer.getWritePointer(0);
+        const float step = 1.f / static_cast<float>(jmax(1, static_cast<int>(fadeOutTime * getSampleRate())));
+        for (int s = 0; s < numSamples; ++s) {
+            envToVol[s] *= static_cast<float>(fadeOutCounter) * step;
+            if (fadeOutCounter > 0) {
+                --fadeOutCounter;
+            }
+        }
+    }
+
+    //! \brief start the oscillators, envelopes and modulation of a note, see startNote()
+    void startLive(int midiNoteNumber, float velocity, int currentPitchWheelPosition) {
+        // Initialization of midi values
+        channelAfterTouch = params.midiState.get(MidiState::eAftertouch)/128.f;
+        keyBipolar = (static_cast<float>(midiNoteNumber) - 64.f) / 64.f;
+        currentInvertedVelocity = 1.f - velocity;
+        currentVelocity = velocity;
+        footControlValue = params.midiState.get(MidiState::eFoot) / 128.f;
+        expPedalValue = params.midiState.get(MidiState::eExpPedal) / 128.f;
+        modWheelValue = params.midiState.get(MidiState::eModwheel) / 128.f;
+        // in mpe mode the wheel of the note channel is the note pitch, the master channel bends all notes
+        mpe = params.mpeMode.getStep() == eOnOffToggle::eOn;
+        notePitch = (currentPitchWheelPosition - 8192.0f) / 8192.0f;
+        pitchBend = mpe ? (params.midiState.get(MidiState::ePitchbend) - 8192.0f) / 8192.0f : notePitch;
+        notePressure = mpe ? 0.f : channelAfterTouch;
+        int channel = 1;
+        while (channel < MidiState::numChannels && !isPlayingChannel(channel)) {
+            ++channel;
+        }
+        noteTimbre = params.midiState.getTimbre(channel) / 128.f;
+        // a new note starts at the current controller values, without a ramp
+        for (ControllerRamp& r : controllerRamps) {
+            r.start = r.target = *r.value;
+        }
+
+        const float sRate = static_cast<float>(getSampleRate());
+
+        // change the phases of all lfo waveforms, in case the user switches them during a note
+        for (size_t l = 0; l < lfo.size(); ++l) {
+            lfo[l].sine.phase = .25f;
+            lfo[l].square.phase = snap.lfo[l].tempSync ? 0.f : .25f;
+            lfo[l].random.phase = 0.f;
+            lfo[l].setPhaseDelta(snap.lfo[l]);
+            lfo[l].random.newHeldValue();
+        }
+
+        // reset attackDecayCounter
+        envToVolume.startEnvelope();
+        // the speed mod sources and intensities are resolved once per block in the snapshot
+        envToVolume.calcEnvCoeff(*modSources[snap.envVol[0].speedModSrc1], *modSources[snap.envVol[0].speedModSrc2]);
+        env2.startEnvelope();
+        env2.calcEnvCoeff(*modSources[snap.env[0].speedModSrc1], *modSources[snap.env[0].speedModSrc2]);
+        env3.startEnvelope();
+        env3.calcEnvCoeff(*modSources[snap.env[1].speedModSrc1], *modSources[snap.env[1].speedModSrc2]);
+
+        const float oscRate = sRate * static_cast<float>(oversampling);
+        const float invOscRate = 1.f / oscRate;
+        for (size_t o = 0; o < osc.size(); ++o) {
+            osc[o].decimator.reset();
+            osc[o].unison.reset();
+            switch (snap.osc[o].waveForm) {
+                case eOscWaves::eOscSquare:
+                    osc[o].square.phase = 0.f;
+                    osc[o].square.phaseDelta = snap.osc[o].noteFreq[midiNoteNumber] * invOscRate;
+                    osc[o].square.width = snap.osc[o].pulseWidth;
+                    break;
+                case eOscWaves::eOscSaw:
+                    osc[o].saw.phase = 0.f;
+                    osc[o].saw.phaseDelta = snap.osc[o].noteFreq[midiNoteNumber] * invOscRate;
+                    osc[o].saw.trngAmount = snap.osc[o].trngAmount;
+                    break;
+                case eOscWaves::eOscWavetable:
+                    osc[o].wavetable.phase = 0.f;
+                    osc[o].wavetable.phaseDelta = snap.osc[o].noteFreq[midiNoteNumber] * invOscRate;
+                    osc[o].wavetable.trngAmount = snap.osc[o].trngAmount;
+                    break;
+                case eOscWaves::eOscSample:
+                    osc[o].sampler.start(params.osc[o].sample.get(), snap.osc[o].noteFreq[midiNoteNumber], oscRate);
+                    break;
+                case eOscWaves::eOscNoise:
+                default:
+                    break;
+            }
+        }
+
+        for (auto& filters : filter) 
+        {
+            for (Filter& f : filters) 
+            {
+                f.reset(oscRate);
+            }
+        }
+    }
+
+    //! \brief copy the next block of the take to the output, with the steal fade, frees the voice at its end
+    /*! A held note stops at the note off of the take and leaves it, see leaveTake().
+        \return the samples copied, the rest of the block is rendered from the next take or live
+    */
+    int playTake(AudioSampleBuffer& outputBuffer, int startSample, int numSamples) {
+        const bool released = envToVolume.getReleaseCounter() != -1;
+        const int n = jmin(numSamples, (released ? take->length : take->release) - takePosition);
+        const int numChannels = jmin(outputBuffer.getNumChannels(), take->audio.getNumChannels());
+        if (fadeOutCounter < 0) {
+            for (int c = 0; c < numChannels; ++c) {
+                outputBuffer.addFrom(c, startSample, take->audio, c, takePosition, n);
+            }
+        } else {
+            const float step = 1.f / static_cast<float>(jmax(1, static_cast<int>(fadeOutTime * getSampleRate())));
+            for (int c = 0; c < numChannels; ++c) {
+                const float *in = take->audio.getReadPointer(c, takePosition);
+                float *out = outputBuffer.getWritePointer(c, startSample);
+                for (int s = 0; s < n; ++s) {
+                    out[s] += in[s] * static_cast<float>(jmax(0, fadeOutCounter - s)) * step;
+                }
+            }
+            fadeOutCounter = jmax(0, fadeOutCounter - n);
+        }
+        takePosition += n;
+        if (fadeOutCounter == 0 || (released && takePosition >= take->length)) {
+            releaseTake(false);
+            clearCurrentNote();
+        } else if (n < numSamples) {
+            leaveTake(false);
+        }
+        return n;
+    }
+
+    //! \brief the note no longer sounds like its take at takePosition, it moves on to another or catches up
+    /*! \param released the note off is at takePosition, otherwise the note is held past the one of the take */
+    void leaveTake(bool released) {
+        NoteCache::Take* next = noteCache->acquireNext(take, takePosition, released);
+        if (next != nullptr) {
+            releaseTake(false);
+            take = next;
+        } else {
+            catchUp(true);
+        }
+    }
+
+    //! \brief render the note of a played take from its start up to takePosition without output, it goes on live
+    /*! The note draws the same noise as its take, see startNote(), so it arrives where the take was.
+        \param record the render goes into a new take if one is free
+    */
+    void catchUp(bool record) {
+        SYNISTER_COUNT("note cache catch ups", 1);
+        const int position = takePosition;
+        const int fade = fadeOutCounter;
+        const int note = getCurrentlyPlayingNote();
+        releaseTake(false);
+        // the steal fade starts at position, it must not end up in the take either
+        fadeOutCounter = -1;
+        // the pitch wheel reaches no voice of a cached patch
+        startLive(note, currentVelocity, 8192);
+        playingTake = false;
+        take = record && fade < 0 ? noteCache->acquireRecording(note, currentVelocity) : nullptr;
+        takePosition = 0;
+        for (int rendered = 0; rendered < position && isVoiceActive();) {
+            const int n = jmin(catchUpBuffer.getNumSamples(), position - rendered);
+            catchUpBuffer.clear(0, n);
+            if (take != nullptr) {
+                recordTake(catchUpBuffer, 0, n);
+            } else {
+                renderLive(catchUpBuffer, 0, n);
+            }
+            rendered += n;
+        }
+        takePosition = position;
+        fadeOutCounter = fade;
+    }
+
+    //! \brief render the block into the take and add it to the output, a note longer than the take is not cached
+    void recordTake(AudioSampleBuffer& outputBuffer, int startSample, int numSamples) {
+        if (takePosition + numSamples > noteCache->getCapacity()) {
+            releaseTake(false);
+            renderLive(outputBuffer, startSample, numSamples);
+            return;
+        }
+        const int numChannels = jmin(outputBuffer.getNumChannels(), take->audio.getNumChannels());
+        takeBuffer.setDataToReferTo(take->audio.getArrayOfWritePointers(), numChannels, takePosition + numSamples);
+        takeBuffer.clear(takePosition, numSamples);
+        renderLive(takeBuffer, takePosition, numSamples);
+        for (int c = 0; c < numChannels; ++c) {
+            outputBuffer.addFrom(c, startSample, takeBuffer, c, takePosition, numSamples);
+        }
+        takePosition += numSamples;
+        take->length = takePosition;
+        if (!isVoiceActive()) {
+            releaseTake(true);
+        }
+    }
+
+    //! \brief the generators of the voice start at a seed, see setRandomSeed()
+    void seedRandom(uint32 seed) {
+        for (size_t o = 0; o < osc.size(); ++o) {
+            osc[o].noise.random.setSeed(seed * 8u + static_cast<uint32>(o));
+        }
+        for (size_t l = 0; l < lfo.size(); ++l) {
+            lfo[l].random.random.setSeed(seed * 8u + static_cast<uint32>(osc.size() + l));
+        }
+    }
+
+    //! \brief hand the take back to the cache, a recording is kept if complete
+    void releaseTake(bool complete) {
+        if (take != nullptr) {
+            noteCache->releaseTake(take, complete);
+            take = nullptr;
+        }
+    }
+
+    //! \brief free the voice, the rest of the release is inaudible
+    void retire() {
+        clearCurrentNote();
+        for (size_t l = 0; l < lfo.size(); ++l) {
+            lfo[l].sine.reset();
+            lfo[l].square.reset();
+        }
+    }
+
+    //! \brief point the internal mod sources and the destinations to the start of their blocks
+    void connectBuffers() {
+        modSources[eModSource::eLFO1] = lfo[0].audioBuffer.getWritePointer(0);
+        modSources[eModSource::eLFO2] = lfo[1].audioBuffer.getWritePointer(0);
+        modSources[eModSource::eLFO3] = lfo[2].audioBuffer.getWritePointer(0);
+        modSources[eModSource::eVolEnv] = envToVolBuffer.getWritePointer(0);
+        modSources[eModSource::eEnv2] = env2Buffer.getWritePointer(0);
+        modSources[eModSource::eEnv3] = env3Buffer.getWritePointer(0);
+
+        for (size_t u = 0; u < MAX_DESTINATIONS; ++u) {
+            modDestinations[u] = modDestBuffer.getWritePointer(u);
+        }
+    }
+
     float calcModVal(ParamStepped<eModSource>& _source, Param& _intensity) {
 
         float source = *(modSources[static_cast<int>(_source.get())]);
@@ -378,6 +1179,7 @@ protected:
 
     void renderModulation(int numSamples) {
 
+        lastModulationSamples = numSamples;
         const float sRate = static_cast<float>(getSampleRate());
         int samplesFadeIn[3] = { 0,0,0 };
         float lfoGain[3] = { 0.f, 0.f, 0.f };
@@ -385,35 +1187,11 @@ protected:
 
         // Init
         for (size_t l = 0; l < lfo.size(); ++l) {
-            lfo[l].audioBuffer.clear();
-            
             //Set the deltaPhase for realtime LFO Changes
-            if (params.lfo[l].tempSync.getStep() == eOnOffToggle::eOn) {
-
-                float coeff = 1.0f;
-                if (params.lfo[l].lfoDottedLength.getStep() == eOnOffToggle::eOn) {
-                    coeff /= 1.5f;
-                }
-                if (params.lfo[l].lfoTriplets.getStep() == eOnOffToggle::eOn) {
-                    coeff /= (2.0f / 3.0f);
-                }
-
-                lfo[l].sine.phaseDelta = static_cast<float>(params.positionInfo[params.getGUIIndex()].bpm) /
-                    (60.f*sRate)*(params.lfo[l].noteLength.get() / 4.f)*2.f*float_Pi * coeff;
-                lfo[l].square.phaseDelta = static_cast<float>(params.positionInfo[params.getGUIIndex()].bpm) /
-                    (60.f*sRate)*(params.lfo[l].noteLength.get() / 4.f)*2.f*float_Pi * coeff;
-                lfo[l].random.phaseDelta = static_cast<float>(params.positionInfo[params.getGUIIndex()].bpm) /
-                    (60.f*sRate)*(params.lfo[l].noteLength.get() / 4.f)*2.f*float_Pi * coeff;
-            }
-            else 
-            {
-                lfo[l].sine.phaseDelta = params.lfo[l].freq.get() / sRate * 2.f * float_Pi;
-                lfo[l].square.phaseDelta = params.lfo[l].freq.get() / sRate * 2.f * float_Pi;
-                lfo[l].random.phaseDelta = params.lfo[l].freq.get() / sRate * 2.f * float_Pi;
-            }
+            lfo[l].setPhaseDelta(snap.lfo[l]);
 
             // Length in samples of the LFO fade in
-            samplesFadeIn[l] = static_cast<int>(params.lfo[l].fadeIn.get() * sRate);
+            samplesFadeIn[l] = static_cast<int>(snap.lfo[l].fadeIn * sRate);
             
             // Lfo Gain
             lfoGain[l] = params.lfo[l].gainModSrc.get() == eModSource::eNone
@@ -424,94 +1202,475 @@ protected:
             float freqModVal1 = calcModVal(params.lfo[l].freqModSrc1, params.lfo[l].freqModAmount1);
             float freqModVal2 = calcModVal(params.lfo[l].freqModSrc2, params.lfo[l].freqModAmount2);
 
-            lfoFreqMod[l] = std::pow(2.f, (freqModVal1 + freqModVal2) * params.lfo[l].freqModAmount1.getMax());
+            lfoFreqMod[l] = FastMath::exp2((freqModVal1 + freqModVal2) * params.lfo[l].freqModAmount1.getMax());
         }
 
-        //clear the buffers
-        modDestBuffer.clear();
-        envToVolBuffer.clear();
-        env2Buffer.clear();
-        env3Buffer.clear();
+        //set the write point in the buffers, the sources below fill all of their samples
+        connectBuffers();
 
-        //set the write point in the buffers
-        for (size_t u = 0; u < MAX_DESTINATIONS; ++u) {
-            modDestinations[u] = modDestBuffer.getWritePointer(u);
+        //calc lfo stuff, the lfo values are rendered as whole blocks
+        for (size_t l = 0; l < lfo.size(); ++l) {
+            float *lfoSamples = lfo[l].audioBuffer.getWritePointer(0);
+
+            // nothing reads the lfo in this block, it only keeps its phase going
+            if (!isSourceConsumed(static_cast<eModSource>(eModSource::eLFO1 + l))) {
+                if (!snap.lfo[l].global) {
+                    lfo[l].advance(snap.lfo[l].wave, lfoFreqMod[l], numSamples);
+                }
+                continue;
+            }
+
+            if (snap.lfo[l].global && globalLfo[l] != nullptr) {
+                // the waveform of the synth, the frequency modulation of the voice does not apply to it
+                if (lfoGain[l] == 1.f && totalVoiceSamples >= samplesFadeIn[l]) {
+                    modSources[eModSource::eLFO1 + l] = globalLfo[l];
+                    continue;
+                }
+                FloatVectorOperations::copy(lfoSamples, globalLfo[l], numSamples);
+                Lfo::applyGain(lfoSamples, lfoGain[l], totalVoiceSamples, samplesFadeIn[l], numSamples);
+            } else {
+                // the waveform is chosen once for the block, gain and fade-in follow in one pass
+                lfo[l].render(snap.lfo[l], lfoSamples, lfoFreqMod[l], lfoGain[l], totalVoiceSamples, samplesFadeIn[l], numSamples);
+            }
         }
 
-        modSources[eModSource::eLFO1] = lfo[0].audioBuffer.getWritePointer(0);
-        modSources[eModSource::eLFO2] = lfo[1].audioBuffer.getWritePointer(0);
-        modSources[eModSource::eLFO3] = lfo[2].audioBuffer.getWritePointer(0);
-        modSources[eModSource::eVolEnv] = envToVolBuffer.getWritePointer(0);
-        modSources[eModSource::eEnv2] = env2Buffer.getWritePointer(0);
-        modSources[eModSource::eEnv3] = env3Buffer.getWritePointer(0);
+        // the stages of the envelopes before they are rendered
+        const int controlInterval = getControlInterval(numSamples, lfoFreqMod);
+
+        // Calculate the Envelope coefficients and fill the buffers
+        // alternative: second matrix with external controls only
+        // the volume envelope is always needed, the other two only when something reads them
+        envToVolume.render(envToVolBuffer.getWritePointer(0), numSamples);
+        if (isSourceConsumed(eModSource::eEnv2)) {
+            env2.render(env2Buffer.getWritePointer(0), numSamples);
+        } else {
+            env2.skip(numSamples);
+        }
+        if (isSourceConsumed(eModSource::eEnv3)) {
+            env3.render(env3Buffer.getWritePointer(0), numSamples);
+        } else {
+            env3.skip(numSamples);
+        }
+
+        if (controlInterval > 1) {
+            renderModulationControlRate(numSamples, controlInterval);
+            endControllerRamps();
+            return;
+        }
+
+        // the matrix reads the controllers once per block at sample rate, they jump to their targets
+        endControllerRamps();
 
-        //for each sample
+        for (int u = 0; u < MAX_DESTINATIONS; ++u) {
+            if (modMatrix.hasCompiledRoute(static_cast<destinations>(u))) {
+                FloatVectorOperations::clear(modDestBuffer.getWritePointer(u), numSamples);
+                modDestClean[u] = false;
+            } else if (!modDestClean[u]) {
+                setModDestinationNeutral(u);
+            }
+        }
+
+        //run the compiled matrix over the whole block
+        modMatrix.doCompiledModulationsBlock(&*modSources.begin(), &*modDestinations.begin(), numSamples);
+
+        // the semitones of the routed pitch destinations become factors here and not where they are read, the oscillator,
+        // the voice bank and the wavetables all read them, only the oscillators of the block need them
+        for (size_t o = 0; o < osc.size(); ++o) {
+            if (plan.isOscillatorActive(o) && modMatrix.hasCompiledRoute(static_cast<destinations>(DEST_OSC1_PI + o))) {
+                float *pitch = modDestBuffer.getWritePointer(DEST_OSC1_PI + o);
+                // Param::fromSemi() per sample, with the accuracy of the quality tier
+                if (snap.mathAccuracy == eMathAccuracy::eFast) {
+                    FastMath::exp2<eMathAccuracy::eFast>(pitch, pitch, snap.osc[o].pitchModRange / 12.f, numSamples);
+                } else {
+                    FastMath::exp2(pitch, pitch, snap.osc[o].pitchModRange / 12.f, numSamples);
+                }
+            }
+        }
+        modValuesValid = false;
+    }
+
+    //! \brief true if a route of the matrix or a mod source param of the lfos and envelopes reads the source in this block, see RenderPlan
+    bool isSourceConsumed(eModSource source) const {
+        return plan.isSourceConsumed(source);
+    }
+
+    //! \brief linear gain of oscillator o for the block, its volume times Param::fromDb() of the gain modulation
+    /** Without a gain route the modulation is 0 dB and the block is a fill. Otherwise the dB
+     *  conversion runs as one pass free of calls and branches, the -96 dB cut of Param::fromDb()
+     *  is a select, so the compiler vectorises it.
+    */
+    void renderGain(size_t o, float *amp, int numSamples) const {
+        const float vol = snap.osc[o].vol;
+        if (!modMatrix.hasCompiledRoute(static_cast<destinations>(DEST_OSC1_GAIN + o))) {
+            FloatVectorOperations::fill(amp, vol, numSamples);
+            return;
+        }
+        const float *gainMod = modDestBuffer.getReadPointer(DEST_OSC1_GAIN + o);
+        const float gainModRange = snap.osc[o].gainModRange;
         for (int s = 0; s < numSamples; ++s) {
+            const float db = gainMod[s] * gainModRange;
+            const float gain = FastMath::dbToGain(db) * vol;
+            amp[s] = db <= Param::MIN_DB ? 0.f : gain;
+        }
+    }
 
-            //calc lfo stuff
-            for (size_t l = 0; l < lfo.size(); ++l) {
-                
-                float factorFadeIn = 1.f;
+    //! \brief fills the whole block of a destination without routes with its neutral value, 1 for the pitch factors
+    /** The block is marked clean and left alone until a route targets the destination again. */
+    void setModDestinationNeutral(int destination) {
+        const bool pitch = destination >= DEST_OSC1_PI && destination < DEST_OSC1_PI + static_cast<int>(osc.size());
+        FloatVectorOperations::fill(modDestBuffer.getWritePointer(destination), pitch ? 1.f : 0.f, modDestBuffer.getNumSamples());
+        modDestClean[destination] = true;
+    }
 
-                if (samplesFadeIn[l] != 0 && (totalVoiceSamples + s < samplesFadeIn[l])){
-                // If the fade in is reached or no fade in is set, the factor is 1 (100%)
-                    factorFadeIn = static_cast<float>(totalVoiceSamples + s) / static_cast<float>(samplesFadeIn[l]);
+    //! \brief number of samples between two evaluations of the modulation matrix
+    /** The adaptive rate follows the fastest source the block consumes: an lfo gets
+     *  lfoPointsPerCycle evaluations per cycle with its frequency modulation, an envelope
+     *  envPointsPerStage per stage it runs through in the block, as a power of two between
+     *  minControlInterval and maxControlInterval. An envelope that holds its level and the midi
+     *  sources, which are constant or ramp linearly over a block, need one evaluation per block.
+     *  A voice in its release tail takes maxControlInterval at any rate, see beginBlock().
+     *  \param lfoFreqMod the frequency factors of the lfos in this block
+     */
+    int getControlInterval(int numSamples, const float *lfoFreqMod) const {
+        if (tail) {
+            return jmin(numSamples, static_cast<int>(maxControlInterval));
+        }
+        switch (snap.modulationRate) {
+            case eModulationRate::eControlRate16:
+                return 16;
+            case eModulationRate::eControlRate32:
+                return 32;
+            case eModulationRate::eAdaptive:
+                break;
+            default:
+                return 1;
+        }
+
+        int interval = numSamples;
+        const auto limit = [&interval](float samplesPerPoint) {
+            int i = maxControlInterval;
+            while (i > minControlInterval && static_cast<float>(i) > samplesPerPoint) {
+                i >>= 1;
+            }
+            interval = jmin(interval, i);
+        };
+        for (size_t l = 0; l < lfo.size(); ++l) {
+            if (isSourceConsumed(static_cast<eModSource>(eModSource::eLFO1 + l))) {
+                // the frequency modulation of the voice does not apply to a global lfo
+                const float delta = snap.lfo[l].phaseDelta * (snap.lfo[l].global ? 1.f : lfoFreqMod[l]);
+                if (delta > 0.f) {
+                    limit(1.f / (delta * lfoPointsPerCycle));
+                }
+            }
+        }
+        const std::pair<eModSource, const Envelope*> envelopes[] = {
+            { eModSource::eVolEnv, &envToVolume }, { eModSource::eEnv2, &env2 }, { eModSource::eEnv3, &env3 }
+        };
+        for (const auto& e : envelopes) {
+            if (isSourceConsumed(e.first)) {
+                const int stage = e.second->getShortestStage(numSamples);
+                if (stage > 0) {
+                    limit(static_cast<float>(stage) / envPointsPerStage);
                 }
+            }
+        }
+        return jmax(1, interval);
+    }
+
+    //! \name adaptive control rate, see getControlInterval()
+    ///@{
+    static const int minControlInterval = 8;
+    static const int maxControlInterval = 128;
+    constexpr static float lfoPointsPerCycle = 256.f;
+    constexpr static float envPointsPerStage = 32.f;
+    ///@}
+
+    //! \brief evaluate the matrix every controlInterval samples and interpolate linearly in between
+    /** The sources (lfos, envelopes) are still rendered per sample, only the matrix and the
+     *  pitch conversion run at control rate. All our sources are sub-audio (lfos <= 50 Hz),
+     *  so every destination is interpolated; the sample rate path stays available for
+     *  comparison via SynthParams::modulationRate. The interval may change from block to
+     *  block, the ramps start at the values of the last evaluation.
+     */
+    void renderModulationControlRate(int numSamples, int controlInterval) {
+        std::array<float*, MAX_DESTINATIONS> controlDestinations;
+        for (size_t u = 0; u < MAX_DESTINATIONS; ++u) {
+            controlDestinations[u] = &controlModValues[u];
+        }
 
-                // calculate lfo values and fill the buffers
-                switch (params.lfo[l].wave.getStep()) {
-                    case eLfoWaves::eLfoSine:
-                        lfo[l].audioBuffer.setSample(0, s, lfo[l].sine.next(lfoFreqMod[l]) * factorFadeIn * lfoGain[l]);
-                        break;
-                    case eLfoWaves::eLfoSampleHold:
-                        lfo[l].audioBuffer.setSample(0, s, lfo[l].random.next(lfoFreqMod[l]) * factorFadeIn * lfoGain[l]);
-                        break;
-                    case eLfoWaves::eLfoSquare:
-                        lfo[l].audioBuffer.setSample(0, s, lfo[l].square.next(lfoFreqMod[l]) * factorFadeIn * lfoGain[l]);
-                        break;
+        // the own blocks or the ones of the global lfos, see renderModulation()
+        const float *lfo1 = modSources[eModSource::eLFO1];
+        const float *lfo2 = modSources[eModSource::eLFO2];
+        const float *lfo3 = modSources[eModSource::eLFO3];
+        const float *envVol = envToVolBuffer.getReadPointer(0);
+        const float *envTwo = env2Buffer.getReadPointer(0);
+        const float *envThree = env3Buffer.getReadPointer(0);
+        const bool controllersRamp = beginControllerRamps();
+
+        for (int start = 0; start < numSamples; start += controlInterval) {
+            const int segmentLength = jmin(controlInterval, numSamples - start);
+            const int end = start + segmentLength - 1;
+
+            if (controllersRamp) {
+                setControllerRampPosition(static_cast<float>(end + 1) / static_cast<float>(numSamples));
+            }
+
+            // evaluate the matrix with the sources at the end of the segment
+            modSources[eModSource::eLFO1] = lfo1 + end;
+            modSources[eModSource::eLFO2] = lfo2 + end;
+            modSources[eModSource::eLFO3] = lfo3 + end;
+            modSources[eModSource::eVolEnv] = envVol + end;
+            modSources[eModSource::eEnv2] = envTwo + end;
+            modSources[eModSource::eEnv3] = envThree + end;
+
+            std::fill(controlModValues.begin(), controlModValues.end(), 0.f);
+            modMatrix.doCompiledModulations(&*modSources.begin(), &*controlDestinations.begin());
+
+            for (size_t o = 0; o < osc.size(); ++o) {
+                if (modMatrix.hasCompiledRoute(static_cast<destinations>(DEST_OSC1_PI + o))) {
+                    controlModValues[DEST_OSC1_PI + o] = Param::fromSemi(controlModValues[DEST_OSC1_PI + o] *
+                                                                         snap.osc[o].pitchModRange);
+                } else {
+                    controlModValues[DEST_OSC1_PI + o] = 1.f;
                 }
             }
 
-            // Calculate the Envelope coefficients and fill the buffers
-            // alternative: second matrix with external controls only
-            envToVolBuffer.setSample(0, s, envToVolume.getNextEnvCoeff());
-            env2Buffer.setSample(0, s, env2.getNextEnvCoeff());
-            env3Buffer.setSample(0, s, env3.getNextEnvCoeff());
+            // first segment of a note: nothing to interpolate from
+            if (!modValuesValid) {
+                lastModValues = controlModValues;
+                modValuesValid = true;
+            }
 
-            //run the matrix
-            modMatrix.doModulationsMatrix(&*modSources.begin(), &*modDestinations.begin());
+            if (start == 0) {
+                for (int u = 0; u < MAX_DESTINATIONS; ++u) {
+                    if (modMatrix.hasCompiledRoute(static_cast<destinations>(u))) {
+                        modDestClean[u] = false;
+                    } else if (!modDestClean[u] && lastModValues[u] == controlModValues[u]) {
+                        // without routes and at rest, the ramp of the last route has ended
+                        setModDestinationNeutral(u);
+                    }
+                }
+            }
 
+            const float step = 1.f / static_cast<float>(segmentLength);
             for (size_t u = 0; u < MAX_DESTINATIONS; ++u) {
-                ++modDestinations[u];
+                if (modDestClean[u]) {
+                    continue;
+                }
+                float *dest = modDestBuffer.getWritePointer(static_cast<int>(u), start);
+                const float from = lastModValues[u];
+                const float delta = (controlModValues[u] - from) * step;
+                for (int s = 0; s < segmentLength; ++s) {
+                    dest[s] = from + delta * static_cast<float>(s + 1);
+                }
             }
+            lastModValues = controlModValues;
+        }
 
-            // internal modSources
-            ++modSources[eModSource::eLFO1];
-            ++modSources[eModSource::eLFO2];
-            ++modSources[eModSource::eLFO3];
-            ++modSources[eModSource::eVolEnv];
-            ++modSources[eModSource::eEnv2];
-            ++modSources[eModSource::eEnv3];
+        // point the internal sources back to the start of their blocks
+        modSources[eModSource::eLFO1] = lfo1;
+        modSources[eModSource::eLFO2] = lfo2;
+        modSources[eModSource::eLFO3] = lfo3;
+        modSources[eModSource::eVolEnv] = envVol;
+        modSources[eModSource::eEnv2] = envTwo;
+        modSources[eModSource::eEnv3] = envThree;
+    }
+    //! renders n samples of oscillator o at the oscillator rate, sample s uses the modulation of sample s >> shift
+    typedef void (Voice::*OscKernel)(size_t o, float *out, const float *pitchMod, const float *shapeMod, int n, int shift);
+
+    //! \name oscillator kernels, by RenderPlan::eOscKernel
+    ///@{
+    template<bool _bandLimited>
+    void renderSquare(size_t o, float *out, const float *pitchMod, const float *shapeMod, int n, int shift) {
+        const float width = osc[o].square.width;
+        const float widthMin = snap.osc[o].pulseWidthMin;
+        const float widthMax = snap.osc[o].pulseWidthMax;
+        for (int s = 0; s < n; ++s) {
+            // In case of pulse width modulation
+            const float delta = jlimit(widthMin, widthMax, width + shapeMod[s >> shift]) - width;
+            out[s] = _bandLimited ? osc[o].square.nextBandLimited<&Waveforms::squareBandLimited>(pitchMod[s >> shift], delta)
+                                  : osc[o].square.next(pitchMod[s >> shift], delta);
+        }
+    }
 
-            //! \todo check whether this should be at the place where the values are actually used
-            modDestBuffer.setSample(DEST_OSC1_PI, s, Param::fromSemi(modDestBuffer.getSample(DEST_OSC1_PI, s) * 
-                                    params.osc[0].pitchModAmount1.getMax()));
-            modDestBuffer.setSample(DEST_OSC2_PI, s, Param::fromSemi(modDestBuffer.getSample(DEST_OSC2_PI, s) * 
-                                    params.osc[1].pitchModAmount1.getMax()));
-            modDestBuffer.setSample(DEST_OSC3_PI, s, Param::fromSemi(modDestBuffer.getSample(DEST_OSC3_PI, s) * 
-                                    params.osc[2].pitchModAmount1.getMax()));
+    template<bool _bandLimited>
+    void renderSaw(size_t o, float *out, const float *pitchMod, const float *shapeMod, int n, int shift) {
+        const float trngAmount = osc[o].saw.trngAmount;
+        const float trngMin = snap.osc[o].trngMin;
+        const float trngMax = snap.osc[o].trngMax;
+        for (int s = 0; s < n; ++s) {
+            // In case of triangle modulation
+            const float delta = jlimit(trngMin, trngMax, trngAmount + shapeMod[s >> shift]) - trngAmount;
+            out[s] = _bandLimited ? osc[o].saw.nextBandLimited<&Waveforms::sawBandLimited>(pitchMod[s >> shift], delta)
+                                  : osc[o].saw.next(pitchMod[s >> shift], delta);
         }
     }
+
+    template<float(*_lane)(float, float, float)>
+    void renderSquareUnison(size_t o, float *out, const float *pitchMod, const float *shapeMod, int n, int shift) {
+        osc[o].unison.render<_lane>(out, osc[o].square.phaseDelta, osc[o].square.width, pitchMod, shapeMod,
+                                    snap.osc[o].pulseWidthMin, snap.osc[o].pulseWidthMax, n, shift);
+    }
+
+    template<float(*_lane)(float, float, float)>
+    void renderSawUnison(size_t o, float *out, const float *pitchMod, const float *shapeMod, int n, int shift) {
+        osc[o].unison.render<_lane>(out, osc[o].saw.phaseDelta, osc[o].saw.trngAmount, pitchMod, shapeMod,
+                                    snap.osc[o].trngMin, snap.osc[o].trngMax, n, shift);
+    }
+
+    void renderNoise(size_t o, float *out, const float *pitchMod, const float *shapeMod, int n, int shift) {
+        ignoreUnused(pitchMod, shapeMod, shift);
+        // white noise does not depend on the pitch
+        osc[o].noise.random.fill(out, n);
+    }
+
+    void renderWavetable(size_t o, float *out, const float *pitchMod, const float *shapeMod, int n, int shift) {
+        // the morph position shares the range and the shape modulation of the triangle amount
+        const float position = osc[o].wavetable.trngAmount;
+        const float positionMin = snap.osc[o].trngMin;
+        const float positionMax = snap.osc[o].trngMax;
+        for (int s = 0; s < n; ++s) {
+            const float delta = jlimit(positionMin, positionMax, position + shapeMod[s >> shift]) - position;
+            out[s] = osc[o].wavetable.next(*wavetables, pitchMod[s >> shift], delta);
+        }
+    }
+
+    void renderSample(size_t o, float *out, const float *pitchMod, const float *shapeMod, int n, int shift) {
+        ignoreUnused(shapeMod);
+        osc[o].sampler.render(out, pitchMod, n, shift);
+    }
+
+    //! \brief the kernel of a RenderPlan::eOscKernel
+    static OscKernel getOscKernel(RenderPlan::eOscKernel kernel) {
+        static const OscKernel kernels[RenderPlan::nKernels] = {
+            &Voice::renderSquare<false>,
+            &Voice::renderSquare<true>,
+            &Voice::renderSquareUnison<&UnisonOscillator::squareLane>,
+            &Voice::renderSquareUnison<&UnisonOscillator::squareBandLimitedLane>,
+            &Voice::renderSaw<false>,
+            &Voice::renderSaw<true>,
+            &Voice::renderSawUnison<&UnisonOscillator::sawLane>,
+            &Voice::renderSawUnison<&UnisonOscillator::sawBandLimitedLane>,
+            &Voice::renderNoise,
+            &Voice::renderWavetable,
+            &Voice::renderSample
+        };
+        return kernels[kernel];
+    }
+    ///@}
 private:
 
+    //! \name ramps of the midi controller sources
+    /*! A controller change only sets the target. The control rate matrix ramps the source from
+        its value at the start of the block to the target at the end, so a dense controller stream
+        changes the modulation smoothly and the synth does not need to split the block at every
+        event, see SynthParams::renderSubdivision. The sample rate matrix jumps to the target.
+    */
+    ///@{
+    enum eControllerRamp {
+        eRampAftertouch,
+        eRampFoot,
+        eRampExpPedal,
+        eRampModwheel,
+        eRampPitchbend,
+        eRampNotePitch,
+        eRampNotePressure,
+        eRampNoteTimbre,
+        nControllerRamps
+    };
+
+    struct ControllerRamp {
+        float* value;   //!< the source the matrix reads
+        float start;    //!< value at the start of the block
+        float target;   //!< last value received
+    };
+
+    //! \brief takes the start values of the block, false if no controller changed
+    bool beginControllerRamps() {
+        bool ramp = false;
+        for (ControllerRamp& r : controllerRamps) {
+            r.start = *r.value;
+            ramp = ramp || r.start != r.target;
+        }
+        return ramp;
+    }
+
+    //! \brief sets the sources to the ramps at position t in [0..1] of the block
+    void setControllerRampPosition(float t) {
+        for (ControllerRamp& r : controllerRamps) {
+            *r.value = r.start + (r.target - r.start) * t;
+        }
+    }
+
+    void endControllerRamps() {
+        for (ControllerRamp& r : controllerRamps) {
+            *r.value = r.target;
+        }
+    }
+
+    std::array<ControllerRamp, nControllerRamps> controllerRamps;
+    ///@}
+
+    //! mod destinations, 3 envelopes, 3 lfos, oscillator and gain/pan scratch, oversampled oscillator scratch, oversampled stereo mix, catch up output
+    static const int numArenaChannels = MAX_DESTINATIONS + 11 + 3 * Decimator::maxFactor;
+
+    //! sub-sample s of an oversampled block uses the modulation of sample s >> shift
+    int getOversamplingShift() const {
+        return oversampling == 4 ? 2 : (oversampling == 2 ? 1 : 0);
+    }
+
+    //! distance between two buffer channels in the arena, in floats
+    static int getArenaStride(int blockSize) {
+        return (blockSize + arenaAlignment - 1) / arenaAlignment * arenaAlignment;
+    }
+
     SynthParams &params;
+    const ParamSnapshot &snap;  //!< params of the current block
+    const RenderPlan &plan;     //!< parts of the engine the patch uses in the current block
     int totalVoiceSamples;
+    int fadeOutCounter;     //!< remaining samples of the steal fade, -1 if not fading
+    float lastLevel;        //!< volume envelope at the end of the last block
+    float envelopePeak;     //!< volume envelope peak of the current block
+    bool tail;              //!< the block renders with less detail, see beginBlock()
+    int lastModulationSamples;  //!< length of the last block renderModulation() filled
+    int oversampling;       //!< oversampling factor of the current block
+    int noteOversampling;   //!< factor the note picked with adaptive oversampling, 0 until its first block
+    eFilterRouting filterRouting;   //!< filter routing of the current block
+    bool postMixStereo;     //!< the post mix ran through the filters of both channels in the last block
+
+    //! \name note cache
+    ///@{
+    NoteCache* noteCache;
+    NoteCache::Take* take;      //!< recorded or played by the current note, nullptr if it renders without
+    bool playingTake;           //!< the take is played, otherwise it is recorded
+    int takePosition;           //!< next sample of the take
+    AudioSampleBuffer takeBuffer;   //!< refers to the recorded take
+    AudioSampleBuffer catchUpBuffer;    //!< stereo scratch block of catchUp(), its output is dropped
+    uint32 voiceSeed;           //!< of setRandomSeed()
+    bool noteSeeded;            //!< the generators were seeded by the note, see startNote()
+    //! seed of the generators of note 0 while the note cache is active, above the ones of the voices
+    static const uint32 noteSeedBase = 0x10000u;
+    ///@}
+
+    //! \name mono legato, see legatoTo()
+    ///@{
+    int legatoNote;             //!< key the note moved to, -1 for the one it started with
+    int glideFromNote;
+    float glidePosition;        //!< of the glide from glideFromNote, 1 at the key
+    float glideStep;            //!< per sample
+    ///@}
     std::array<Lfo, 3> lfo;
+    std::array<const float*, 3> globalLfo;  //!< blocks of the global lfos of the synth, see setGlobalLfo()
 
     struct Osc {
         Oscillator<&Waveforms::square> square;
         Oscillator<&Waveforms::saw> saw;
-        Oscillator<&Waveforms::whiteNoise> noise;
+        UnisonOscillator unison;    //!< copies of square or saw, see ParamSnapshot::Osc::unisonVoices
+        NoiseOscillator noise;
+        WavetableOscillator wavetable;
+        SampleOscillator sampler;   //!< the sample the slot of the oscillator held at the start of the note
+        Decimator decimator;
+        LatencyPad pad;             //!< of a voice below the largest factor of adaptive oversampling
         float level;
     };
     std::array<Osc, 3> osc;
@@ -520,6 +1679,16 @@ private:
     std::array<const float*, eModSource::nSteps> modSources;
     std::array<float*, MAX_DESTINATIONS> modDestinations;
 
+    //! \name control rate modulation state
+    ///@{
+    std::array<float, MAX_DESTINATIONS> controlModValues;  //!< matrix output at the current control point
+    std::array<float, MAX_DESTINATIONS> lastModValues;     //!< matrix output at the previous control point
+    bool modValuesValid;                                   //!< false until the first control point of a note
+    ///@}
+
+    //! destinations without routes whose block holds the neutral value, see setModDestinationNeutral()
+    std::array<bool, MAX_DESTINATIONS> modDestClean;
+
     // Midi
     float channelAfterTouch;
     float keyBipolar;
@@ -530,15 +1699,29 @@ private:
     float modWheelValue;
     float pitchBend;
 
+    //! \name per note expression, the wheel, pressure and cc 74 of the note's own channel
+    ///@{
+    float notePitch;
+    float notePressure;
+    float noteTimbre;
+    bool mpe;           //!< the note started in mpe mode, its channel messages only reach the note sources
+    ///@}
+
+    SharedWavetables wavetables;    //!< shared by all voices and instances
+
     //Mod matrix
     ModulationMatrix& modMatrix;
     float zeroMod;
 
-    // Buffers
+    // Buffers, all of them refer to the voice arena
     AudioSampleBuffer modDestBuffer;
     AudioSampleBuffer envToVolBuffer;
     AudioSampleBuffer env2Buffer;
     AudioSampleBuffer env3Buffer;
+    AudioSampleBuffer oscBuffer; //!< scratch block of the currently rendered oscillator
+    AudioSampleBuffer ampBuffer; //!< scratch blocks for gain and pan of the current oscillator
+    AudioSampleBuffer oversampledBuffer; //!< scratch block of the current oscillator at the oversampled rate
+    AudioSampleBuffer mixBuffer; //!< left and right (or mono) oscillator mix of the post mix routing at the oversampled rate
     // Envelopes
     Envelope envToVolume;
     Envelope env2;
@@ -0,0 +1,180 @@
+/*
+  ==============================================================================
+
+    VoiceBank.h
+    Created: 14 Oct 2026 9:12:05am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef VOICEBANK_H_INCLUDED
+#define VOICEBANK_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "SynthParams.h"
+#include "Oscillator.h"
+#include "SimdKernels.h"
+#include "RealtimeMemory.h"
+
+//! Voice Bank: renders one oscillator of several voices in lock-step
+/*! The oscillator state of up to numLanes voices is gathered into
+    struct-of-arrays form (phases, phase increments, shapes and interleaved
+    modulation blocks). The inner loop then runs over the lanes with identical
+    control flow, the naive waveforms and the noise in the kernels of SimdKernels,
+    picked for the cpu at runtime: one AVX register or two SSE/NEON registers for
+    eight lanes. The band-limited waveforms keep the lane loop here, which the
+    compiler vectorises for the baseline of the build.
+*/
+class VoiceBank {
+public:
+    static const int numLanes = SimdKernels::laneStride;
+
+    VoiceBank()
+        : kernels(SimdKernels::get())
+        , blockSize(0)
+        , numSamples(0)
+        , activeLanes(numLanes)
+    {
+        clearLanes();
+    }
+
+    //! allocates the interleaved scratch blocks and faults them in through memory, must not be called from the audio thread
+    void prepare(int maxBlockSize, RealtimeMemory& memory) {
+        blockSize = maxBlockSize;
+        const size_t n = static_cast<size_t>(blockSize * numLanes);
+        pitchMod.allocate(n, true);
+        shapeMod.allocate(n, true);
+        output.allocate(n, true);
+        memory.add(pitchMod.getData(), n * sizeof(float));
+        memory.add(shapeMod.getData(), n * sizeof(float));
+        memory.add(output.getData(), n * sizeof(float));
+    }
+
+    //! \brief bytes of the scratch blocks
+    int64 getMemoryBytes() const { return 3 * static_cast<int64>(blockSize) * numLanes * static_cast<int64>(sizeof(float)); }
+
+    //! starts a new group of numVoices lanes for a block of n samples, unused lanes stay silent
+    void begin(int n, int numVoices) {
+        jassert(n <= blockSize && numVoices <= numLanes);
+        numSamples = n;
+        activeLanes = SimdKernels::roundUpLanes(numVoices);
+        clearLanes();
+        for (int s = 0; s < numSamples; ++s) {
+            for (int l = 0; l < numLanes; ++l) {
+                pitchMod[s * numLanes + l] = 1.f;
+                shapeMod[s * numLanes + l] = 0.f;
+            }
+        }
+    }
+
+    //! loads the oscillator state and the modulation blocks of one voice into a lane
+    void setLane(int lane, float phs, float delta, float shp, const float *pitch, const float *shapeDelta) {
+        jassert(lane >= 0 && lane < numLanes);
+        osc.phase[lane] = phs;
+        osc.phaseDelta[lane] = delta;
+        osc.shape[lane] = shp;
+        for (int s = 0; s < numSamples; ++s) {
+            pitchMod[s * numLanes + lane] = pitch[s];
+            shapeMod[s * numLanes + lane] = shapeDelta[s];
+        }
+    }
+
+    float getPhase(int lane) const { return osc.phase[lane]; }
+
+    //! noise generator state of a lane, every voice keeps its own sequence
+    void setNoiseState(int lane, uint32 s) { noiseState[lane] = s; }
+    uint32 getNoiseState(int lane) const { return noiseState[lane]; }
+
+    //! de-interleaves the rendered block of one lane
+    void copyLaneOutput(int lane, float *dest) const {
+        for (int s = 0; s < numSamples; ++s) {
+            dest[s] = output[s * numLanes + lane];
+        }
+    }
+
+    //! renders all lanes with the given waveform, the shape modulation is limited to [shapeMin..shapeMax]
+    void render(eOscWaves wave, bool bandLimited, float shapeMin, float shapeMax) {
+        switch (wave) {
+            case eOscWaves::eOscSquare:
+                if (bandLimited) {
+                    renderLanes<&squareBandLimitedLane>(shapeMin, shapeMax);
+                } else {
+                    kernels.squareLanes(osc, pitchMod, shapeMod, output, activeLanes, numSamples, shapeMin, shapeMax);
+                }
+                break;
+            case eOscWaves::eOscSaw:
+                if (bandLimited) {
+                    renderLanes<&sawBandLimitedLane>(shapeMin, shapeMax);
+                } else {
+                    kernels.sawLanes(osc, pitchMod, shapeMod, output, activeLanes, numSamples, shapeMin, shapeMax);
+                }
+                break;
+            case eOscWaves::eOscNoise:
+                // noise does not depend on the phase, the lanes only advance their generators
+                kernels.noiseLanes(noiseState, output, activeLanes, numSamples);
+                break;
+            default:
+                FloatVectorOperations::clear(output, numSamples * numLanes);
+                break;
+        }
+    }
+
+private:
+    //! \name band-limited lane waveforms: phase, shape and phase increment of the sample
+    ///@{
+    static float squareBandLimitedLane(float phs, float shp, float inc) { return Waveforms::squareBandLimited(phs, 0.f, shp, inc); }
+    static float sawBandLimitedLane(float phs, float shp, float inc) { return Waveforms::sawBandLimited(phs, shp, 0.f, inc); }
+    ///@}
+
+    template<float(*_waveform)(float, float, float)>
+    void renderLanes(float shapeMin, float shapeMax) {
+        for (int s = 0; s < numSamples; ++s) {
+            const float *pit = pitchMod + s * numLanes;
+            const float *shp = shapeMod + s * numLanes;
+            float *out = output + s * numLanes;
+
+            // no branches depending on the lane
+            for (int l = 0; l < activeLanes; ++l) {
+                const float currentShape = std::min(std::max(osc.shape[l] + shp[l], shapeMin), shapeMax);
+                const float increment = osc.phaseDelta[l] * pit[l];
+                out[l] = _waveform(osc.phase[l], currentShape, increment);
+
+                const float p = osc.phase[l] + increment;
+                osc.phase[l] = p - static_cast<float>(static_cast<int>(p));
+            }
+        }
+    }
+
+    //! all lanes, a kernel may render more than activeLanes
+    void clearLanes() {
+        for (int l = 0; l < numLanes; ++l) {
+            osc.phase[l] = 0.f;
+            osc.phaseDelta[l] = 0.f;
+            osc.shape[l] = 0.f;
+            noiseState[l] = 1;
+        }
+    }
+
+    const SimdKernels& kernels;
+    int blockSize;
+    int numSamples;
+    int activeLanes;    //!< lanes of the group rounded up to SimdKernels::laneGroup
+
+    //! \name struct-of-arrays oscillator state
+    ///@{
+    SimdKernels::OscillatorLanes osc;
+    uint32 noiseState[numLanes];
+    ///@}
+
+    //! \name interleaved blocks, sample s of lane l is stored at [s * numLanes + l]
+    ///@{
+    HeapBlock<float> pitchMod;
+    HeapBlock<float> shapeMod;
+    HeapBlock<float> output;
+    ///@}
+
+    JUCE_DECLARE_NON_COPYABLE(VoiceBank)
+};
+
+#endif  // VOICEBANK_H_INCLUDED
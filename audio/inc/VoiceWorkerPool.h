@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+
+    VoiceWorkerPool.h
+    Created: 14 Oct 2026 10:03:41am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef VOICEWORKERPOOL_H_INCLUDED
+#define VOICEWORKERPOOL_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "RealtimeThreadPool.h"
+
+//! VoiceWorkerPool Class: parallel voice rendering
+/*! Every active voice is one job of the RealtimeThreadPool the instances of the process share,
+    the calling audio thread renders voices as well. Every voice renders into its own scratch
+    buffer; the scratch buffers are summed in voice order afterwards, so the result does not
+    depend on which thread rendered which voice. The shared pool is held while the pool is
+    prepared, an instance without parallel voices starts no threads.
+*/
+class VoiceWorkerPool {
+public:
+    VoiceWorkerPool();
+    ~VoiceWorkerPool();
+
+    //! takes a reference to the shared workers and allocates the scratch buffers.
+    /*!
+    Must not be called from the audio thread.
+    @param maxVoices number of voices of the synthesiser
+    @param numChannels number of output channels
+    @param blockSize maximum number of samples per render call
+    @param blockSeconds duration of a block of the host, the period of the real-time scheduling of the workers
+    */
+    void prepare(int maxVoices, int numChannels, int blockSize, double blockSeconds);
+
+    //! lets go of the shared workers, the last instance to do so stops them
+    void release();
+
+    //! \brief workers of the shared pool, 0 if not prepared
+    int getNumWorkers() const { return threadPool != nullptr ? (*threadPool)->getNumWorkers() : 0; }
+
+    //! \brief bytes of the scratch buffers of the voices
+    int64 getMemoryBytes() const {
+        int64 bytes = 0;
+        for (const AudioSampleBuffer* b : scratch) {
+            bytes += static_cast<int64>(b->getNumChannels()) * b->getNumSamples() * static_cast<int64>(sizeof(float));
+        }
+        return bytes;
+    }
+
+    //! renders all voices and adds them to the output buffer.
+    /*!
+    @param voices voices of the synthesiser
+    @param outputBuffer buffer the voices are added to
+    @param startSample first sample in the output buffer
+    @param numSamples number of samples to render
+    */
+    void render(const OwnedArray<SynthesiserVoice>& voices, AudioSampleBuffer& outputBuffer, int startSample, int numSamples);
+
+private:
+    //! job of the batch: renders the job-th active voice into its scratch buffer
+    static void renderVoice(void* context, int job);
+
+    ScopedPointer<SharedResourcePointer<RealtimeThreadPool>> threadPool;
+    OwnedArray<AudioSampleBuffer> scratch; //!< one buffer per voice
+
+    //! \name state of the current render call
+    ///@{
+    const OwnedArray<SynthesiserVoice>* currentVoices;
+    Array<int> activeVoices;    //!< voice of every job
+    int currentNumSamples;
+    ///@}
+
+    JUCE_DECLARE_NON_COPYABLE(VoiceWorkerPool)
+};
+
+#endif  // VOICEWORKERPOOL_H_INCLUDED
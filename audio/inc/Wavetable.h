@@ -0,0 +1,118 @@
+/*
+  ==============================================================================
+
+    Wavetable.h
+    Created: 14 Oct 2026 4:02:17pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef WAVETABLE_H_INCLUDED
+#define WAVETABLE_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <vector>
+
+//! Wavetables Class: mip-mapped band-limited single cycle tables
+/*! Every frame (sine, triangle, saw, square) is stored once per octave, table t only
+    contains the harmonics up to tableSize/2 >> t. The table is selected from the phase
+    increment, so the played harmonics always stay below the nyquist frequency.
+    The tables do not depend on the sample rate; they are generated once and shared by all
+    voices and plugin instances of the process via SharedWavetables.
+*/
+class Wavetables {
+public:
+    static const int tableSize = 2048;  //!< samples per cycle, power of two
+    static const int numTables = 11;    //!< octaves, the last table only holds the fundamental
+    static const int numFrames = 4;     //!< sine, triangle, saw, square
+
+    Wavetables();
+
+    //! interpolated lookup
+    /*!
+    @param phs phase normalised to one period [0..1)
+    @param position morph position between the frames in [0..1]
+    @param phaseIncrement phase increment of the current sample in periods, selects the table
+    */
+    float lookup(float phs, float position, float phaseIncrement) const {
+        const float cycles = phaseIncrement * static_cast<float>(tableSize);
+
+        // smallest table whose highest harmonic stays below nyquist
+        int table = 0;
+        if (cycles > 0.f) {
+            std::frexp(cycles, &table);
+        }
+        table = jlimit(0, numTables - 1, table);
+
+        const float framePos = jlimit(0.f, 1.f, position) * static_cast<float>(numFrames - 1);
+        const int frame = jmin(static_cast<int>(framePos), numFrames - 2);
+        const float frameFrac = framePos - static_cast<float>(frame);
+
+        const float pos = phs * static_cast<float>(tableSize);
+        const int index = static_cast<int>(pos) & (tableSize - 1);
+        const float frac = pos - std::floor(pos);
+
+        const float *a = getTable(table, frame) + index;
+        const float *b = getTable(table, frame + 1) + index;
+        const float sampleA = a[0] + frac * (a[1] - a[0]);
+        const float sampleB = b[0] + frac * (b[1] - b[0]);
+        return sampleA + frameFrac * (sampleB - sampleA);
+    }
+
+    //! \brief bytes of all tables
+    int64 getMemoryBytes() const { return static_cast<int64>(data.size() * sizeof(float)); }
+
+private:
+    //! tableSize + 1 samples, the last one repeats the first for the interpolation
+    const float* getTable(int table, int frame) const {
+        return &data[static_cast<size_t>((table * numFrames + frame) * (tableSize + 1))];
+    }
+
+    std::vector<float> data;
+
+    JUCE_DECLARE_NON_COPYABLE(Wavetables)
+};
+
+//! process-wide, reference counted instance of the wavetables
+typedef SharedResourcePointer<Wavetables> SharedWavetables;
+
+//! WavetableOscillator Class: phase state of a wavetable voice oscillator
+/*! Same members as Oscillator, trngAmount is used as the morph position.
+*/
+class WavetableOscillator {
+public:
+    float phase;
+    float phaseDelta;
+    float trngAmount;
+    float width;
+
+    WavetableOscillator() : phase(0.f)
+        , phaseDelta(0.f)
+        , trngAmount(0.f)
+        , width(.5f)
+    {}
+
+    void reset() {
+        phase = 0.f;
+        phaseDelta = 0.f;
+        width = .5f;
+        trngAmount = .0f;
+    }
+
+    float next(const Wavetables& tables, float pitchMod, float positionDelta) {
+        const float increment = phaseDelta*pitchMod;
+        const float result = tables.lookup(phase, trngAmount + positionDelta, increment);
+        const float p = phase + increment;
+        phase = p - static_cast<float>(static_cast<int>(p));
+        return result;
+    }
+
+    //! \brief advances the phase like next() over samples whose pitch modulation factors sum to pitchSum
+    void skip(float pitchSum) {
+        const float p = phase + phaseDelta*pitchSum;
+        phase = p - static_cast<float>(static_cast<int>(p));
+    }
+};
+
+#endif  // WAVETABLE_H_INCLUDED
@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    AuditionPlayer.cpp
+    Created: 17 Oct 2026 10:07:32pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "AuditionPlayer.h"
+
+AuditionPlayer::AuditionPlayer()
+    : requested(nullptr)
+    , inUse(nullptr)
+    , active(false)
+    , current(nullptr)
+    , position(0.)
+{
+}
+
+void AuditionPlayer::play(Snippet* snippet)
+{
+    if (snippet != nullptr) {
+        held.addIfNotAlreadyThere(snippet);
+    }
+    const Snippet* const previous = requested.exchange(snippet != nullptr ? snippet : &stopRequest);
+
+    // the audio thread reads at most the snippet it marked in use, or the one it is about to take
+    const Snippet* const reading = inUse.load();
+    for (int i = held.size(); --i >= 0;) {
+        if (held[i].get() != snippet && held[i].get() != previous && held[i].get() != reading) {
+            held.remove(i);
+        }
+    }
+}
+
+void AuditionPlayer::process(AudioSampleBuffer& buffer, double sampleRate)
+{
+    // marked in use before it is taken, a request replaced in between is dropped unread for the newer one
+    for (Snippet* r = requested.load(); r != nullptr; r = requested.load()) {
+        inUse.store(r);
+        if (requested.compare_exchange_strong(r, nullptr)) {
+            current = r != &stopRequest ? r : nullptr;
+            position = 0.;
+            inUse.store(current);
+            active.store(current != nullptr);
+            break;
+        }
+    }
+    if (current == nullptr) {
+        return;
+    }
+
+    const AudioSampleBuffer& audio = current->audio;
+    const int length = audio.getNumSamples();
+    const double step = current->sampleRate / sampleRate;
+    const int numChannels = jmin(buffer.getNumChannels(), audio.getNumChannels());
+    int i = 0;
+    for (; i < buffer.getNumSamples() && position + 1. < length; ++i) {
+        const int p = static_cast<int>(position);
+        const float frac = static_cast<float>(position - p);
+        for (int c = 0; c < numChannels; ++c) {
+            const float* s = audio.getReadPointer(c);
+            buffer.addSample(c, i, gain * (s[p] + frac * (s[p + 1] - s[p])));
+        }
+        position += step;
+    }
+
+    if (position + 1. >= length) {
+        // the message thread releases the snippet with its next play()
+        current = nullptr;
+        inUse.store(nullptr);
+        active.store(false);
+    }
+}
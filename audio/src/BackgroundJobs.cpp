@@ -0,0 +1,59 @@
+/*
+  ==============================================================================
+
+    BackgroundJobs.cpp
+    Created: 17 Oct 2026 2:14:53am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "BackgroundJobs.h"
+
+namespace {
+    const char* const threadNames[] = { "Jobs High", "Jobs Normal", "Jobs Low" };
+    //! below the realtime workers at 9, the high jobs above a busy message thread
+    const int threadPriorities[] = { 4, 3, 2 };
+}
+
+BackgroundJobs::BackgroundJobs()
+{
+    for (int p = 0; p < static_cast<int>(ePriority::nSteps); ++p) {
+        threads.add(new TimeSliceThread(threadNames[p]))->startThread(threadPriorities[p]);
+    }
+}
+
+BackgroundJobs::~BackgroundJobs()
+{
+    // every job removed itself before the last pointer went away
+    for (TimeSliceThread* t : threads) {
+        jassert(t->getNumClients() == 0);
+        t->stopThread(1000);
+    }
+}
+
+void BackgroundJobs::add(TimeSliceClient* job, ePriority priority)
+{
+    remove(job);
+    threads[static_cast<int>(priority)]->addTimeSliceClient(job);
+}
+
+void BackgroundJobs::remove(TimeSliceClient* job)
+{
+    // a job that is on none of the threads is left alone by all of them
+    for (TimeSliceThread* t : threads) {
+        t->removeTimeSliceClient(job);
+    }
+}
+
+void BackgroundJobs::wake(TimeSliceClient* job)
+{
+    for (TimeSliceThread* t : threads) {
+        t->moveToFrontOfQueue(job);
+    }
+}
+
+int BackgroundJobs::getNumJobs(ePriority priority) const
+{
+    return threads[static_cast<int>(priority)]->getNumClients();
+}
@@ -0,0 +1,129 @@
+/*
+  ==============================================================================
+
+    CpuFeatures.cpp
+    Created: 15 Oct 2026 11:32:18am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "CpuFeatures.h"
+#include "JuceHeader.h"
+
+#if JUCE_INTEL
+ #if JUCE_MSVC
+  #include <intrin.h>
+ #else
+  #include <cpuid.h>
+ #endif
+#endif
+
+namespace {
+    const char* const levelNames[] = { "scalar", "sse2", "avx", "avx2", "avx512", "neon" };
+
+#if JUCE_INTEL
+    void cpuid(uint32 leaf, uint32 subLeaf, uint32 regs[4])
+    {
+ #if JUCE_MSVC
+        int r[4];
+        __cpuidex(r, static_cast<int>(leaf), static_cast<int>(subLeaf));
+        for (int i = 0; i < 4; ++i) {
+            regs[i] = static_cast<uint32>(r[i]);
+        }
+ #else
+        __cpuid_count(leaf, subLeaf, regs[0], regs[1], regs[2], regs[3]);
+ #endif
+    }
+
+    //! \brief the register state the os saves, XCR0
+    uint64 getEnabledState()
+    {
+ #if JUCE_MSVC
+        return _xgetbv(0);
+ #else
+        uint32 lo, hi;
+        asm volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+        return (static_cast<uint64>(hi) << 32) | lo;
+ #endif
+    }
+
+    CpuFeatures::eLevel detect()
+    {
+        uint32 regs[4];
+        cpuid(0, 0, regs);
+        const uint32 maxLeaf = regs[0];
+        if (maxLeaf < 1) {
+            return CpuFeatures::eLevel::eScalar;
+        }
+
+        cpuid(1, 0, regs);
+        const bool sse2 = (regs[3] & (1u << 26)) != 0;
+        const bool osxsave = (regs[2] & (1u << 27)) != 0;
+        const bool avx = (regs[2] & (1u << 28)) != 0;
+        if (!sse2) {
+            return CpuFeatures::eLevel::eScalar;
+        }
+        // without the os saving the upper halves, the AVX registers are unusable
+        const uint64 state = osxsave ? getEnabledState() : 0;
+        if (!avx || (state & 0x6) != 0x6) { // XMM | YMM
+            return CpuFeatures::eLevel::eSse2;
+        }
+        if (maxLeaf < 7) {
+            return CpuFeatures::eLevel::eAvx;
+        }
+
+        cpuid(7, 0, regs);
+        const bool avx2 = (regs[1] & (1u << 5)) != 0;
+        const bool avx512 = (regs[1] & (1u << 16)) != 0;
+        if (!avx2) {
+            return CpuFeatures::eLevel::eAvx;
+        }
+        return avx512 && (state & 0xe0) == 0xe0 ? CpuFeatures::eLevel::eAvx512 : CpuFeatures::eLevel::eAvx2; // opmask | ZMM
+    }
+#else
+    CpuFeatures::eLevel detect()
+    {
+ #if defined (__aarch64__) || defined (_M_ARM64)
+        return CpuFeatures::eLevel::eNeon;
+ #else
+        return CpuFeatures::eLevel::eScalar;
+ #endif
+    }
+#endif
+
+    CpuFeatures::eLevel select()
+    {
+        const CpuFeatures::eLevel supported = CpuFeatures::getSupported();
+        const String requested = SystemStats::getEnvironmentVariable("SYNISTER_SIMD", String()).trim().toLowerCase();
+        for (int l = 0; l < numElementsInArray(levelNames); ++l) {
+            const CpuFeatures::eLevel level = static_cast<CpuFeatures::eLevel>(l);
+            if (requested != levelNames[l]) {
+                continue;
+            }
+            // a lower x86 level runs on a higher one, neon only on neon
+            const bool x86 = supported != CpuFeatures::eLevel::eNeon && level != CpuFeatures::eLevel::eNeon;
+            if (level == CpuFeatures::eLevel::eScalar || level == supported || (x86 && level < supported)) {
+                return level;
+            }
+        }
+        return supported;
+    }
+}
+
+CpuFeatures::eLevel CpuFeatures::getSupported()
+{
+    static const eLevel supported = detect();
+    return supported;
+}
+
+CpuFeatures::eLevel CpuFeatures::getSelected()
+{
+    static const eLevel selected = select();
+    return selected;
+}
+
+const char* CpuFeatures::getName(eLevel level)
+{
+    return levelNames[static_cast<int>(level)];
+}
@@ -0,0 +1,114 @@
+/*
+  ==============================================================================
+
+    CpuMeter.cpp
+    Created: 15 Oct 2026 8:24:05am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "CpuMeter.h"
+
+CpuMeter::CpuMeter()
+    : readers(0)
+    , measuring(false)
+    , blockStart(0)
+    , lastTicks(0)
+    , windowBlocks(0)
+    , windowVoices(0.)
+{
+    blockTicks.fill(0);
+    sums.fill(0.);
+    maxima.fill(0.f);
+    for (auto& h : histograms) {
+        h.fill(0);
+    }
+    stats.fill(CpuStats());
+}
+
+const char* CpuMeter::getStageName(eCpuStage stage)
+{
+    switch (stage) {
+    case eCpuStage::eHost: return "host";
+    case eCpuStage::eEvents: return "events";
+    case eCpuStage::eSequencer: return "sequencer";
+    case eCpuStage::eVoices: return "voices";
+    case eCpuStage::eFxLowFi: return "lofi";
+    case eCpuStage::eFxClipping: return "clipping";
+    case eCpuStage::eFxDelay: return "delay";
+    case eCpuStage::eFxChorus: return "chorus";
+    case eCpuStage::eFxReverb: return "reverb";
+    case eCpuStage::eFxWaveshaper: return "waveshaper";
+    case eCpuStage::eMaster: return "master";
+    case eCpuStage::eTotal: return "total";
+    default: return "";
+    }
+}
+
+void CpuMeter::startBlock()
+{
+    measuring = readers.load(std::memory_order_relaxed) > 0 || Trace::isRecording();
+    if (!measuring) {
+        // the next reader starts with a fresh window
+        windowBlocks = 0;
+        return;
+    }
+    if (windowBlocks == 0) {
+        windowVoices = 0.;
+        sums.fill(0.);
+        maxima.fill(0.f);
+        for (auto& h : histograms) {
+            h.fill(0);
+        }
+    }
+    blockTicks.fill(0);
+    blockStart = lastTicks = Time::getHighResolutionTicks();
+}
+
+void CpuMeter::endBlock(int numSamples, double sampleRate, int activeVoices)
+{
+    if (!measuring || numSamples <= 0 || sampleRate <= 0.) {
+        return;
+    }
+    const int64 now = Time::getHighResolutionTicks();
+    blockTicks[static_cast<size_t>(eCpuStage::eTotal)] = now - blockStart;
+#if SYNISTER_TRACE
+    Trace::record("block", blockStart, now);
+#endif
+
+    // percent of the duration of the block
+    const double budgetTicks = numSamples / sampleRate * static_cast<double>(Time::getHighResolutionTicksPerSecond());
+    const double toPercent = 100. / budgetTicks;
+    for (size_t s = 0; s < blockTicks.size(); ++s) {
+        const float percent = static_cast<float>(static_cast<double>(blockTicks[s]) * toPercent);
+        sums[s] += percent;
+        maxima[s] = jmax(maxima[s], percent);
+        ++histograms[s][static_cast<size_t>(jlimit(0, histogramSize - 1, static_cast<int>(percent)))];
+    }
+    windowVoices += activeVoices;
+
+    if (++windowBlocks < windowSize) {
+        return;
+    }
+
+    CpuStats& dst = stats.getWriteSlot();
+    const int p99Count = windowBlocks - windowBlocks / 100;
+    for (size_t s = 0; s < blockTicks.size(); ++s) {
+        dst.mean[s] = static_cast<float>(sums[s] / windowBlocks);
+        dst.max[s] = maxima[s];
+        int count = 0;
+        int bin = 0;
+        while (bin < histogramSize - 1 && (count += histograms[s][static_cast<size_t>(bin)]) < p99Count) {
+            ++bin;
+        }
+        // the upper edge of the bin, never above the maximum
+        dst.p99[s] = jmin(static_cast<float>(bin + 1), maxima[s]);
+    }
+    dst.meanActiveVoices = static_cast<float>(windowVoices / windowBlocks);
+    const float voices = dst.mean[static_cast<size_t>(eCpuStage::eVoices)];
+    dst.voicePercent = dst.meanActiveVoices > 0.f ? voices / dst.meanActiveVoices : 0.f;
+    dst.numBlocks = windowBlocks;
+    stats.publish();
+    windowBlocks = 0;
+}
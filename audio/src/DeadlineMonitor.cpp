@@ -0,0 +1,135 @@
+/*
+  ==============================================================================
+
+    DeadlineMonitor.cpp
+    Created: 15 Oct 2026 8:51:30am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "DeadlineMonitor.h"
+#include "SynthParams.h"
+
+namespace {
+    const char* const fxNames[] = { "lofi", "clipping", "delay", "chorus", "reverb", "waveshaper" };
+}
+
+DeadlineMonitor::DeadlineMonitor()
+    : threshold(0.8f)
+    , numBlocks(0)
+    , numIncidents(0)
+    , worstLoad(0.f)
+    , block(0)
+    , fifo(fifoSize)
+{
+    for (std::atomic<uint32>& bin : histogram) {
+        bin.store(0);
+    }
+    jobs->add(this, BackgroundJobs::ePriority::eNormal);
+}
+
+DeadlineMonitor::~DeadlineMonitor()
+{
+    jobs->remove(this);
+}
+
+File DeadlineMonitor::getLogFile()
+{
+    // next to the presets, see PresetLibrary::getDirectory()
+    return File::getSpecialLocation(File::commonDocumentsDirectory).getChildFile("Synister").getChildFile("deadline-misses.log");
+}
+
+bool DeadlineMonitor::addBlock(float load)
+{
+    ++block;
+    numBlocks.store(block, std::memory_order_relaxed);
+    // single writer, so a load and a store are enough
+    std::atomic<uint32>& bin = histogram[static_cast<size_t>(jlimit(0, numBins - 1, static_cast<int>(load * 100.f) / binPercent))];
+    bin.store(bin.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if (load > worstLoad.load(std::memory_order_relaxed)) {
+        worstLoad.store(load, std::memory_order_relaxed);
+    }
+    return load > threshold.load(std::memory_order_relaxed);
+}
+
+void DeadlineMonitor::addIncident(DeadlineIncident& incident)
+{
+    incident.block = block;
+    numIncidents.store(numIncidents.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite(1, start1, size1, start2, size2);
+    if (size1 > 0) {
+        pending[static_cast<size_t>(start1)] = incident;
+        fifo.finishedWrite(1);
+    }
+}
+
+void DeadlineMonitor::getRecentIncidents(Array<DeadlineIncident>& dst) const
+{
+    const ScopedLock sl(recentLock);
+    dst = recent;
+}
+
+int DeadlineMonitor::useTimeSlice()
+{
+    while (fifo.getNumReady() > 0) {
+        int start1, size1, start2, size2;
+        fifo.prepareToRead(1, start1, size1, start2, size2);
+        const DeadlineIncident incident = pending[static_cast<size_t>(start1)];
+        fifo.finishedRead(1);
+
+        {
+            const ScopedLock sl(recentLock);
+            recent.add(incident);
+            if (recent.size() > maxRecentIncidents) {
+                recent.remove(0);
+            }
+        }
+
+        if (log == nullptr) {
+            const File file = getLogFile();
+            file.getParentDirectory().createDirectory();
+            log = file.createOutputStream();
+            if (log != nullptr) {
+                log->writeText("\n" + Time::getCurrentTime().toString(true, true) + " synister " + ProjectInfo::versionString
+                               + ", threshold " + String(getThreshold() * 100.f, 0) + " %\n", false, false);
+            }
+        }
+        if (log != nullptr) {
+            log->writeText(describe(incident) + "\n", false, false);
+            log->flush();
+        }
+    }
+    return 250;
+}
+
+String DeadlineMonitor::describe(const DeadlineIncident& incident)
+{
+    String s;
+    s << "block " << incident.block << " at " << String(incident.timeMs) << " ms: "
+      << String(incident.load * 100.f, 1) << " % of " << incident.numSamples << " samples at "
+      << String(incident.sampleRate, 0) << " Hz, " << incident.activeVoices << " voices, fx";
+    bool anyFx = false;
+    for (int f = 0; f < static_cast<int>(eFxType::nSteps); ++f) {
+        if ((incident.activeFx & (1u << f)) != 0) {
+            s << " " << fxNames[f];
+            anyFx = true;
+        }
+    }
+    if (!anyFx) {
+        s << " none";
+    }
+    s << ", " << incident.numMidiEvents << " midi events";
+    const int numKept = jmin(incident.numMidiEvents, static_cast<int>(DeadlineIncident::maxMidiEvents));
+    for (int e = 0; e < numKept; ++e) {
+        s << (e == 0 ? ": " : ", ") << incident.midiPositions[static_cast<size_t>(e)] << " "
+          << String::toHexString(incident.midi.data() + 3 * e, 3, 0);
+    }
+    for (int c = 0; c < incident.numCounters; ++c) {
+        s << (c == 0 ? ", counters: " : ", ") << incident.counterNames[static_cast<size_t>(c)] << " "
+          << incident.counterValues[static_cast<size_t>(c)];
+    }
+    return s;
+}
@@ -0,0 +1,88 @@
+/*
+  ==============================================================================
+
+    DspTables.cpp
+    Created: 15 Oct 2026 2:02:44pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "DspTables.h"
+#include <limits>
+
+namespace {
+    //! modified bessel function of the first kind, order 0
+    double besselI0(double x)
+    {
+        double sum = 1.;
+        double term = 1.;
+        for (int k = 1; k < 50; ++k) {
+            term *= (x / (2. * k)) * (x / (2. * k));
+            sum += term;
+        }
+        return sum;
+    }
+}
+
+DspTables::DspTables()
+{
+    // kaiser windowed half-band, every even tap but the centre is zero
+    const int n = HalfbandDecimator::numTaps;
+    const int centre = HalfbandDecimator::centre;
+    const double beta = 7.;
+
+    std::array<double, HalfbandDecimator::numOddTaps> taps;
+    double sum = 0.;
+    for (int i = 0; i < HalfbandDecimator::numOddTaps; ++i) {
+        const int d = 2 * i + 1;
+        const double r = 2. * (centre + d) / (n - 1) - 1.;
+        const double window = besselI0(beta * std::sqrt(1. - r * r)) / besselI0(beta);
+        taps[i] = std::sin(double_Pi * d / 2.) / (double_Pi * d) * window;
+        sum += 2. * taps[i];
+    }
+    // unity gain at dc: the odd taps add up to the other half
+    for (int i = 0; i < HalfbandDecimator::numOddTaps; ++i) {
+        halfbandTaps[i] = static_cast<float>(taps[i] * (.5 / sum));
+    }
+
+    for (int note = 0; note < Tuning::numNotes; ++note) {
+        equalTemperament[note] = std::pow(2.0, (note - 69) / 12.0);
+    }
+
+    for (size_t c = 0; c < shaperCurves.size(); ++c) {
+        std::array<float, shaperTableSize + 2>& table = shaperCurves[c];
+        for (int i = 0; i <= shaperTableSize; ++i) {
+            const double x = shaperRange * (2. * i / shaperTableSize - 1.);
+            double y = 0.;
+            if (c == 1) {
+                // asymmetric: the negative half saturates at -.5, both halves have a slope of 1 at 0
+                y = x >= 0. ? std::tanh(x) : .5 * std::tanh(2. * x);
+            } else if (c == 2) {
+                // foldback
+                y = std::sin(.5 * double_Pi * x);
+            } else {
+                y = std::tanh(x);
+            }
+            table[static_cast<size_t>(i)] = static_cast<float>(y);
+        }
+        table[shaperTableSize + 1] = table[shaperTableSize];
+    }
+
+    for (size_t i = 0; i < cutoffPoints.size(); ++i) {
+        const int octave = static_cast<int>(i) / filterPointsPerOctave;
+        const int j = static_cast<int>(i) % filterPointsPerOctave;
+        const double x = std::ldexp(1. + static_cast<double>(j) / filterPointsPerOctave, octave - filterOctaves - 1);
+        CutoffPoint& p = cutoffPoints[i];
+        p.sin2Pi = static_cast<float>(std::sin(2. * double_Pi * x));
+        p.cos2Pi = static_cast<float>(std::cos(2. * double_Pi * x));
+        // the guard point at 1/2 is the pole, it is never read below filterMaxCutoff
+        p.tanPi = x < .5 ? static_cast<float>(std::tan(double_Pi * x)) : std::numeric_limits<float>::max();
+    }
+}
+
+const DspTables& DspTables::get()
+{
+    static const DspTables tables;
+    return tables;
+}
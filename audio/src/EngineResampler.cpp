@@ -0,0 +1,127 @@
+/*
+  ==============================================================================
+
+    EngineResampler.cpp
+    Created: 15 Oct 2026 5:03:21pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "EngineResampler.h"
+
+EngineResampler::EngineResampler()
+    : factor(1)
+    , fifoSamples(0)
+    , scratchSize(0)
+{
+}
+
+int EngineResampler::getFactor(double hostRate)
+{
+    int f = 1;
+    // 88.2 and 96 kHz halve, 176.4 and 192 kHz quarter; a little slack for rates the driver rounds
+    while (f < Interpolator::maxFactor && hostRate / (2 * f) > minEngineRate - 1.) {
+        f *= 2;
+    }
+    return f;
+}
+
+void EngineResampler::prepare(int numChannels, int f, int maxHostBlock)
+{
+    jassert(f == 1 || f == 2 || f == 4);
+    factor = f;
+    fifoSamples = 0;
+    if (factor == 1) {
+        return;
+    }
+
+    engine.setSize(numChannels, 0);
+    upsampled.setSize(numChannels, 0);
+    reserve(maxHostBlock / factor + 1);
+    fifo.setSize(numChannels, factor);
+    fifo.clear();
+    interpolators.assign(static_cast<size_t>(numChannels), Interpolator());
+    for (Interpolator& i : interpolators) {
+        i.reset();
+    }
+    engineMidi.ensureSize(4096);
+    heldMidi.ensureSize(1024);
+    heldMidi.clear();
+}
+
+void EngineResampler::reserve(int numSamples)
+{
+    if (numSamples <= engine.getNumSamples()) {
+        return;
+    }
+    // a host that sends more than it announced to prepareToPlay costs an allocation here
+    engine.setSize(engine.getNumChannels(), numSamples, false, true, true);
+    upsampled.setSize(upsampled.getNumChannels(), numSamples * factor, false, true, true);
+    if (numSamples * 2 > scratchSize) {
+        scratchSize = numSamples * 2;
+        scratch.allocate(static_cast<size_t>(scratchSize), false);
+    }
+}
+
+AudioSampleBuffer& EngineResampler::beginBlock(int numHostSamples, MidiBuffer& midiMessages)
+{
+    const int needed = numHostSamples - fifoSamples;
+    const int numSamples = needed > 0 ? (needed + factor - 1) / factor : 0;
+    reserve(numSamples);
+
+    MidiBuffer::Iterator it(midiMessages);
+    const uint8* data;
+    int size;
+    int pos;
+    if (numSamples == 0) {
+        // the fifo plays the whole block, its events start the next engine block
+        while (it.getNextEvent(data, size, pos)) {
+            heldMidi.addEvent(data, size, 0);
+        }
+        midiMessages.clear();
+    } else {
+        engineMidi.clear();
+        engineMidi.addEvents(heldMidi, 0, -1, 0);
+        heldMidi.clear();
+        // engine sample k sounds from host sample fifoSamples + k * factor on
+        while (it.getNextEvent(data, size, pos)) {
+            const int k = (jmax(0, pos - fifoSamples) + factor / 2) / factor;
+            engineMidi.addEvent(data, size, jmin(k, numSamples - 1));
+        }
+        // fewer or as many events as before, the buffer of the host keeps its storage
+        midiMessages.clear();
+        midiMessages.addEvents(engineMidi, 0, -1, 0);
+    }
+
+    block.setDataToReferTo(engine.getArrayOfWritePointers(), engine.getNumChannels(), numSamples);
+    return block;
+}
+
+void EngineResampler::endBlock(AudioSampleBuffer& hostBuffer)
+{
+    const int numHostSamples = hostBuffer.getNumSamples();
+    const int numSamples = block.getNumSamples();
+    const int numChannels = jmin(hostBuffer.getNumChannels(), engine.getNumChannels());
+    const int fromFifo = jmin(fifoSamples, numHostSamples);
+    const int fromBlock = numHostSamples - fromFifo;
+    const int left = numSamples > 0 ? numSamples * factor - fromBlock : fifoSamples - fromFifo;
+
+    for (int c = 0; c < numChannels; ++c) {
+        float *out = hostBuffer.getWritePointer(c);
+        float *ahead = fifo.getWritePointer(c);
+        FloatVectorOperations::copy(out, ahead, fromFifo);
+        if (numSamples > 0) {
+            float *up = upsampled.getWritePointer(c);
+            interpolators[static_cast<size_t>(c)].process(engine.getReadPointer(c), up, scratch, numSamples, factor);
+            FloatVectorOperations::copy(out + fromFifo, up, fromBlock);
+            FloatVectorOperations::copy(ahead, up + fromBlock, left);
+        } else {
+            std::memmove(ahead, ahead + fromFifo, sizeof(float) * static_cast<size_t>(left));
+        }
+    }
+    for (int c = numChannels; c < hostBuffer.getNumChannels(); ++c) {
+        hostBuffer.clear(c, 0, numHostSamples);
+    }
+    fifoSamples = left;
+}
@@ -9,6 +9,7 @@ Author:  Nhat Duc Tran and Anton Schmied
 */
 
 #include "Envelope.h"
+#include "Instrument.h"
 
 void Envelope::resetReleaseCounter()
 {
@@ -19,6 +20,99 @@ void Envelope::startEnvelope()
 {
     releaseCounter = -1;
     attackDecayCounter = 0;
+    segmentStage = eNoStage;
+}
+
+void Envelope::render(float* out, int n)
+{
+    SYNISTER_SCOPE_FINE("envelope");
+    while (n > 0) {
+        int stageSamples;
+        if (releaseCounter > -1) {
+            if (releaseCounter >= releaseSamples) {
+                // the release is over
+                FloatVectorOperations::clear(out, n);
+                releaseCounter += n;
+                return;
+            }
+            stageSamples = releaseSamples - releaseCounter;
+        } else if (attackDecayCounter <= attackSamples) {
+            stageSamples = attackSamples + 1 - attackDecayCounter;
+        } else if (attackDecayCounter <= attackSamples + decaySamples) {
+            stageSamples = attackSamples + decaySamples + 1 - attackDecayCounter;
+        } else {
+            // sustain until the note is released
+            valueAtRelease = env.sustain;
+            FloatVectorOperations::fill(out, env.sustain, n);
+            return;
+        }
+
+        // up to the end of the stage, the loop picks the next one
+        const int numSamples = jmin(n, stageSamples);
+        for (int s = 0; s < numSamples; ++s) {
+            out[s] = getNextEnvCoeff();
+        }
+        out += numSamples;
+        n -= numSamples;
+    }
+}
+
+void Envelope::skip(int n)
+{
+    if (n <= 0) {
+        return;
+    }
+
+    // the counters move as they would per sample, the sustain holds the counter
+    const int skipped = n - 1;
+    if (releaseCounter > -1) {
+        releaseCounter += skipped;
+    } else {
+        attackDecayCounter = jmin(attackDecayCounter + skipped, jmax(attackDecayCounter, attackSamples + decaySamples + 1));
+    }
+
+    // the last sample is computed, so valueAtRelease is exact when the release starts
+    segmentStage = eNoStage;
+    getNextEnvCoeff();
+}
+
+int Envelope::getShortestStage(int n) const
+{
+    int shortest = 0;
+    const auto add = [&shortest](int length) {
+        if (length > 0) {
+            shortest = shortest == 0 ? length : jmin(shortest, length);
+        }
+    };
+    if (releaseCounter > -1) {
+        if (releaseCounter < releaseSamples) {
+            add(releaseSamples);
+        }
+        return shortest;
+    }
+    const int end = attackDecayCounter + n;
+    if (attackDecayCounter <= attackSamples) {
+        add(attackSamples);
+    }
+    if (attackDecayCounter <= attackSamples + decaySamples && end > attackSamples) {
+        add(decaySamples);
+    }
+    return shortest;
+}
+
+int Envelope::calcSegmentSamples(int t, float k)
+{
+    // the line through the ends of a segment of width h deviates from x^k by at most
+    // h^2 / 8 * k (k - 1) for k >= 2, the curvature is unbounded at 0 below, there h^k / 4 bounds it
+    float h;
+    if (k <= 1.f) {
+        return maxSegmentSamples;
+    } else if (k < 2.f) {
+        h = FastMath::pow(4.f * segmentTolerance, 1.f / k);
+    } else {
+        h = std::sqrt(8.f * segmentTolerance / (k * (k - 1.f)));
+    }
+    return jlimit(1, maxSegmentSamples, static_cast<int>(h * static_cast<float>(t)));
 }
 
 
@@ -34,5 +128,8 @@ float Envelope::interpolateLog(int c, int t, float k, bool slow)
 {
     float coefficent = static_cast<float>(c) / static_cast<float>(t);
     
-    return std::exp(std::log((slow) ? coefficent : 1.0f - coefficent) * k);
+    const float base = (slow) ? coefficent : 1.0f - coefficent;
+
+    // x^k as 2^(k * log2(x)), the phase has to end at exactly 0 for any k
+    return base > 0.f ? FastMath::exp2(FastMath::log2(base) * k) : 0.f;
 }
\ No newline at end of file
@@ -0,0 +1,128 @@
+/*
+  ==============================================================================
+
+    FactoryBank.cpp
+    Created: 15 Oct 2026 5:17:44am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "FactoryBank.h"
+#include "SynthParams.h"
+#include <unordered_map>
+
+namespace {
+    //! the embedded patches in program order, init first
+    struct FactoryPatch {
+        const char* name;
+        const char* data;
+        int size;
+    };
+
+    const FactoryPatch factoryPatches[] = {
+        { "init", BinaryData::init_xml, BinaryData::init_xmlSize },
+        { "cheap hihat", BinaryData::cheap_hihat_xml, BinaryData::cheap_hihat_xmlSize },
+        { "cheap kick", BinaryData::cheap_kick_xml, BinaryData::cheap_kick_xmlSize },
+        { "cheap kick2", BinaryData::cheap_kick2_xml, BinaryData::cheap_kick2_xmlSize },
+        { "cheap snare", BinaryData::cheap_snare_xml, BinaryData::cheap_snare_xmlSize },
+        { "death by organs", BinaryData::death_by_organs_xml, BinaryData::death_by_organs_xmlSize },
+        { "double wobbler", BinaryData::double_wobbler_xml, BinaryData::double_wobbler_xmlSize },
+        { "Filter Distortion", BinaryData::Filter_Distortion_xml, BinaryData::Filter_Distortion_xmlSize },
+        { "flashizm", BinaryData::flashizm_xml, BinaryData::flashizm_xmlSize },
+        { "le wob", BinaryData::le_wob_xml, BinaryData::le_wob_xmlSize },
+        { "organ failure", BinaryData::organ_failure_xml, BinaryData::organ_failure_xmlSize },
+        { "organ", BinaryData::organ_xml, BinaryData::organ_xmlSize },
+        { "piano sth.", BinaryData::piano_sth__xml, BinaryData::piano_sth__xmlSize },
+        { "quinto", BinaryData::quinto_xml, BinaryData::quinto_xmlSize },
+        { "syn piano", BinaryData::syn_piano_xml, BinaryData::syn_piano_xmlSize },
+        { "violin1", BinaryData::violin1_xml, BinaryData::violin1_xmlSize },
+        { "violin2", BinaryData::violin2_xml, BinaryData::violin2_xmlSize },
+    };
+
+    const int numFactoryPatches = static_cast<int>(sizeof(factoryPatches) / sizeof(factoryPatches[0]));
+}
+
+FactoryBank::FactoryBank(SynthParams& p)
+    : params(p)
+    , parsed(false)
+{
+    jobs->add(this, BackgroundJobs::ePriority::eHigh);
+}
+
+FactoryBank::~FactoryBank()
+{
+    // waits until a running parse is done
+    jobs->remove(this);
+}
+
+int FactoryBank::getNumPrograms()
+{
+    return numFactoryPatches;
+}
+
+String FactoryBank::getProgramName(int index)
+{
+    return isPositiveAndBelow(index, numFactoryPatches) ? String(factoryPatches[index].name) : String();
+}
+
+const PatchValues* FactoryBank::getProgram(int index) const
+{
+    if (!parsed.load(std::memory_order_acquire) || !isPositiveAndBelow(index, numFactoryPatches)) {
+        return nullptr;
+    }
+    return &programs[static_cast<size_t>(index)];
+}
+
+void FactoryBank::waitUntilParsed()
+{
+    if (!parsed.load(std::memory_order_acquire)) {
+        parse();
+    }
+}
+
+int FactoryBank::useTimeSlice()
+{
+    parse();
+    return 60000;
+}
+
+void FactoryBank::parse()
+{
+    const ScopedLock sl(parseLock);
+    if (parsed.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    const std::vector<Param*>& serialized = params.serializeParams;
+    std::unordered_map<Param*, size_t> index;
+    for (size_t i = 0; i < serialized.size(); ++i) {
+        index[serialized[i]] = i;
+    }
+
+    std::vector<PatchValues> bank(static_cast<size_t>(numFactoryPatches));
+    PatchValues parsedPatch;
+    parsedPatch.values.resize(serialized.size());
+    for (int p = 0; p < numFactoryPatches; ++p) {
+        // every param, the ones the patch leaves out at their default
+        PatchValues& program = bank[static_cast<size_t>(p)];
+        program = params.getDefaultPatch();
+        program.resetVoices = true;
+
+        ScopedPointer<XmlElement> patch = XmlDocument::parse(String::fromUTF8(factoryPatches[p].data, factoryPatches[p].size));
+        if (patch == nullptr) {
+            jassertfalse;
+            continue;
+        }
+        params.parsePatch(*patch, eSerializationParams::eAll, parsedPatch);
+        for (int v = 0; v < parsedPatch.numValues; ++v) {
+            program.values[index[parsedPatch.values[v].first]].second = parsedPatch.values[v].second;
+        }
+        if (parsedPatch.hasPattern) {
+            program.pattern = parsedPatch.pattern;
+        }
+    }
+
+    programs.swap(bank);
+    parsed.store(true, std::memory_order_release);
+}
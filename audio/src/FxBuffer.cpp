@@ -0,0 +1,97 @@
+/*
+  ==============================================================================
+
+    FxBuffer.cpp
+    Created: 15 Oct 2026 3:47:26am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "FxBuffer.h"
+
+//==============================================================================
+FxBuffer::FxBuffer()
+    : ready(nullptr)
+    , requested(false)
+    , channels(0)
+    , samples(0)
+{
+    jobs->add(this, BackgroundJobs::ePriority::eHigh);
+}
+
+FxBuffer::~FxBuffer()
+{
+    // waits until a running allocation is done
+    jobs->remove(this);
+    memory.clear();
+}
+
+void FxBuffer::setSize(int numChannels, int numSamples, bool lock)
+{
+    jobs->remove(this);
+    memory.clear();
+    memory.setLocking(lock);
+
+    if (numChannels != channels || numSamples != samples) {
+        // an effect in use would be bypassed until the worker allocated the new size
+        const bool inUse = requested.load() && numChannels > 0 && numSamples > 0;
+        ready.store(nullptr);
+        requested.store(false);
+        buffer = nullptr;
+        channels = numChannels;
+        samples = numSamples;
+        if (inUse) {
+            requested.store(true);
+            allocate();
+        }
+    } else if (buffer != nullptr) {
+        buffer->clear();
+        for (int c = 0; c < channels; ++c) {
+            memory.add(buffer->getWritePointer(c), static_cast<size_t>(samples) * sizeof(float));
+        }
+    }
+
+    jobs->add(this, BackgroundJobs::ePriority::eHigh);
+}
+
+AudioSampleBuffer* FxBuffer::acquire()
+{
+    AudioSampleBuffer* b = ready.load(std::memory_order_acquire);
+    if (b == nullptr) {
+        requested.store(true, std::memory_order_relaxed);
+    }
+    return b;
+}
+
+void FxBuffer::clear()
+{
+    AudioSampleBuffer* b = ready.load(std::memory_order_acquire);
+    if (b != nullptr) {
+        b->clear();
+    }
+}
+
+void FxBuffer::allocate()
+{
+    buffer = new AudioSampleBuffer(channels, samples);
+    buffer->clear();
+    for (int c = 0; c < channels; ++c) {
+        memory.add(buffer->getWritePointer(c), static_cast<size_t>(samples) * sizeof(float));
+    }
+    ready.store(buffer.get(), std::memory_order_release);
+}
+
+int FxBuffer::useTimeSlice()
+{
+    if (ready.load(std::memory_order_relaxed) != nullptr) {
+        // only setSize() changes the buffer again, it restarts the polling
+        return 1000;
+    }
+    if (requested.load(std::memory_order_relaxed) && channels > 0 && samples > 0) {
+        allocate();
+        return 1000;
+    }
+    // polled, waking the thread from the audio thread would take a lock
+    return 20;
+}
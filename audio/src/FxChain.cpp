@@ -0,0 +1,127 @@
+/*
+  ==============================================================================
+
+    FxChain.cpp
+    Created: 15 Oct 2026 4:38:10am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "FxChain.h"
+
+FxChain::FxChain(SynthParams& p, FxSlot& lowFi, FxSlot& clipping, FxSlot& delay, FxSlot& chorus, FxSlot& reverb, FxSlot& waveshaper)
+    : params(p)
+{
+    slots[static_cast<size_t>(eFxType::eLowFi)] = &lowFi;
+    slots[static_cast<size_t>(eFxType::eClipping)] = &clipping;
+    slots[static_cast<size_t>(eFxType::eDelay)] = &delay;
+    slots[static_cast<size_t>(eFxType::eChorus)] = &chorus;
+    slots[static_cast<size_t>(eFxType::eReverb)] = &reverb;
+    slots[static_cast<size_t>(eFxType::eWaveshaper)] = &waveshaper;
+}
+
+void FxChain::prepare(int numChannels, double sampleRate)
+{
+    for (FxSlot* slot : slots) {
+        slot->prepare(numChannels, sampleRate);
+    }
+    sleep.fill(SleepState());
+}
+
+void FxChain::process(AudioSampleBuffer& buffer, int startSample, int numSamples, const tReturns* returns)
+{
+    // the active slots in the order of the patch, resolved when the plan was compiled
+    const RenderPlan& plan = params.getRenderPlan();
+    for (int i = 0; i < plan.numActiveFx; ++i) {
+        const eFxType type = plan.fx[static_cast<size_t>(i)];
+        FxSlot* slot = slots[static_cast<size_t>(type)];
+
+        // the input of a slot is the output of the slots before it
+        SleepState& state = sleep[static_cast<size_t>(type)];
+        const bool silentInput = isSilent(buffer, startSample, numSamples);
+        if (!silentInput) {
+            state.silentSamples = 0;
+            state.asleep = false;
+        } else if (state.asleep) {
+            continue;
+        }
+
+        // the return takes the input and then the difference to the output
+        float* const* ret = returns != nullptr ? (*returns)[static_cast<size_t>(type)] : nullptr;
+        if (ret != nullptr) {
+            for (int c = 0; c < buffer.getNumChannels(); ++c) {
+                FloatVectorOperations::copy(ret[c] + startSample, buffer.getReadPointer(c, startSample), numSamples);
+            }
+        }
+        slot->process(buffer, startSample, numSamples);
+        if (ret != nullptr) {
+            for (int c = 0; c < buffer.getNumChannels(); ++c) {
+                FloatVectorOperations::subtract(ret[c] + startSample, buffer.getReadPointer(c, startSample), ret[c] + startSample, numSamples);
+            }
+        }
+        params.telemetry.cpu.mark(static_cast<eCpuStage>(static_cast<int>(eCpuStage::eFxLowFi) + static_cast<int>(type)));
+
+        if (silentInput) {
+            state.silentSamples += numSamples;
+            // a feedback that does not decay keeps the output above the threshold
+            if (state.silentSamples > slot->getTailSamples() && isSilent(buffer, startSample, numSamples)) {
+                slot->reset();
+                state.asleep = true;
+            }
+        }
+    }
+}
+
+void FxChain::reset()
+{
+    for (FxSlot* slot : slots) {
+        slot->reset();
+    }
+    sleep.fill(SleepState());
+}
+
+bool FxChain::isSilent(const AudioSampleBuffer& buffer, int startSample, int numSamples)
+{
+    return buffer.getMagnitude(startSample, numSamples) < silenceThreshold;
+}
+
+int FxChain::getTailSamples() const
+{
+    int tail = 0;
+    for (const FxSlot* slot : slots) {
+        if (slot->isActive()) {
+            tail += slot->getTailSamples();
+        }
+    }
+    return tail;
+}
+
+bool FxChain::isAsleep() const
+{
+    const RenderPlan& plan = params.getRenderPlan();
+    for (int i = 0; i < plan.numActiveFx; ++i) {
+        if (!sleep[static_cast<size_t>(plan.fx[static_cast<size_t>(i)])].asleep) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FxChain::resolveOrder(const tOrder& positions, tOrder& order)
+{
+    uint32 used = 0;
+    int n = 0;
+    for (eFxType type : positions) {
+        const uint32 bit = 1u << static_cast<int>(type);
+        if ((used & bit) == 0) {
+            used |= bit;
+            order[static_cast<size_t>(n++)] = type;
+        }
+    }
+    for (int t = 0; t < numSlots; ++t) {
+        if ((used & (1u << t)) == 0) {
+            order[static_cast<size_t>(n++)] = static_cast<eFxType>(t);
+        }
+    }
+}
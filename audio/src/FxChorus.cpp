@@ -1,128 +1,228 @@
 #include "FxChorus.h"
+#include "Instrument.h"
+#include "Denormals.h"
+
+namespace {
+    //! rate of the modulators relative to the rate param
+    const float modRateRatio[FxChorus::numTaps] = { 1.f, 1.2f, .8f, .9f, 1.1f };
+    //! start phases of the modulators
+    const float modStartPhase[FxChorus::numTaps] = { 0.f, 0.f, .5f, 0.f, .5f };
+    //! gains of the taps in the first, the second and further channels
+    const float tapWeights[3][FxChorus::numTaps] = {
+        { .2f, .2f, .2f, .2f, .2f },
+        { .2f, .05f, .35f, .1f, .3f },
+        { .2f, .35f, .05f, .3f, .1f }
+    };
+}
 
 FxChorus::~FxChorus() {};
 
-void FxChorus::init(int channelsIn, double sampleRateIn)
+void FxChorus::prepare(int channelsIn, double sampleRateIn)
 {
     channels = channelsIn;
     sampleRate = static_cast<float>(sampleRateIn);
-    chorusBuffer = AudioSampleBuffer(channels, static_cast<int>(sampleRate * 2.0));
-    //currentDelayLength = static_cast<int>(params.chorDelayLength.get()*(sampleRate / 1000.0));
-    currentDelayLength = static_cast<int>(params.chorDelayLength.get()*(sampleRate));
-    modSine1.phase = 0.f;
-    modSine1.phaseDelta = params.chorModRate.get() / sampleRate;
-
-    modSine2.phase = 0.f;
-    modSine2.phaseDelta = params.chorModRate.get()* 1.2f / sampleRate;
-
-    modSine3.phase = float_Pi;
-    modSine3.phaseDelta = params.chorModRate.get()* 0.8f / sampleRate;
 
-    modSine4.phase = 0.f;
-    modSine4.phaseDelta = params.chorModRate.get()* 0.9f / sampleRate;
+    // the longest tap and a segment that is written before the taps are read, the interpolation reads one sample on both sides
+    const int maxTap = static_cast<int>(params.chorDelayLength.getMax() * sampleRate) + static_cast<int>(params.chorModDepth.getMax()) + 2;
+    const int ringLength = nextPowerOfTwo(maxTap + maxSegmentLength + 1);
+    buffer.setSize(channels, ringLength, params.lockMemory.getStep() == eOnOffToggle::eOn);
+    ringMask = ringLength - 1;
+    writePosition = 0;
+    allpassState.assign(static_cast<size_t>(channels), std::array<float, numTaps>());
+    for (std::array<float, numTaps>& state : allpassState) {
+        state.fill(0.f);
+    }
 
-    modSine5.phase = float_Pi;
-    modSine5.phaseDelta = params.chorModRate.get()* 1.1f / sampleRate;
+    // the phases are normalised to one period, the rate has always been applied in radians per second
+    const float rate = params.chorModRate.get() / (2.f * float_Pi * sampleRate);
+    for (int k = 0; k < numTaps; ++k) {
+        modSine[k].phase = modStartPhase[k];
+        modSine[k].phaseDelta = rate * modRateRatio[k];
+    }
+}
 
-    for (int c = 0; c < channels; ++c) {
-        chorusBuffer.clear(c, 0, chorusBuffer.getNumSamples());
+void FxChorus::reset()
+{
+    buffer.clear();
+    for (int k = 0; k < numTaps; ++k) {
+        modSine[k].phase = modStartPhase[k];
+    }
+    for (std::array<float, numTaps>& state : allpassState) {
+        state.fill(0.f);
     }
 }
 
-void FxChorus::render(AudioSampleBuffer& outputBuffer, int startSample) {
-    int newLoopLength;
+int FxChorus::getTailSamples() const
+{
+    return static_cast<int>(params.chorDelayLength.get() * sampleRate + params.chorModDepth.get()) + 2;
+}
 
-    for (int i = 0; i < outputBuffer.getNumSamples(); ++i)
-    {
-        //newLoopLength = static_cast<int>(params.chorDelayLength.get() * (sampleRate / 1000.0));
-        newLoopLength = static_cast<int>(params.chorDelayLength.get() * sampleRate);
+int64 FxChorus::getMemoryBytes() const
+{
+    return static_cast<int64>(sizeof(FxChorus) + allpassState.capacity() * sizeof(allpassState[0])) + buffer.getAllocatedBytes();
+}
 
-        modSine1.phaseDelta = params.chorModRate.get() / sampleRate;
-        modSine2.phaseDelta = params.chorModRate.get()* 1.2f / sampleRate;
-        modSine3.phaseDelta = params.chorModRate.get()* .8f / sampleRate;
-        modSine4.phaseDelta = params.chorModRate.get()* .9f / sampleRate;
-        modSine5.phaseDelta = params.chorModRate.get()* 1.1f / sampleRate;
+void FxChorus::process(AudioSampleBuffer& outputBuffer, int startSample, int numSamples) {
+    chorusBuffer = buffer.acquire();
+    if (chorusBuffer == nullptr) {
+        return;
+    }
 
-        loopPosition %= newLoopLength;
+    const ParamSnapshot& snap = params.getSnapshot();
+    // the offline quality tier reads the taps with hermite interpolation
+    const eChorusInterpolation interpolation = snap.chorInterpolation;
+    if (interpolation == eChorusInterpolation::eAllpass && lastInterpolation != eChorusInterpolation::eAllpass) {
+        for (std::array<float, numTaps>& state : allpassState) {
+            state.fill(0.f);
+        }
+    }
+    lastInterpolation = interpolation;
 
-        // clear old material from buffer
-        if (newLoopLength < currentDelayLength) { // TODO: this is still a bit messy
-            chorusBuffer.clear(newLoopLength, chorusBuffer.getNumSamples() - currentDelayLength);
+    // the modulators and the width are fixed for the block
+    const float rate = snap.chorModRate / (2.f * float_Pi * sampleRate);
+    for (int k = 0; k < numTaps; ++k) {
+        modSine[k].phaseDelta = rate * modRateRatio[k];
+    }
+    const int width = static_cast<int>(snap.chorDelayLength * sampleRate);
+    const float wetness = snap.chorDryWet;
+
+    const int numChannels = jmin(outputBuffer.getNumChannels(), channels);
+    const int ringLength = ringMask + 1;
+
+    float mod[maxSegmentLength];
+    int index[numTaps][maxSegmentLength];
+    float frac[numTaps][maxSegmentLength];
+    float wet[maxSegmentLength];
+
+    for (int done = 0; done < numSamples; done += maxSegmentLength) {
+        const int n = jmin(maxSegmentLength, numSamples - done);
+        SYNISTER_SCOPE_FINE("chorus segment");
+
+        // the read positions of the taps, the same for all channels
+        for (int k = 0; k < numTaps; ++k) {
+            modSine[k].render(mod, 1.f, n);
+            FloatVectorOperations::multiply(mod, snap.chorModDepth, n);
+            calcTapPositions(mod, writePosition - width + ringLength, index[k], frac[k], n);
         }
 
+        for (int c = 0; c < numChannels; ++c) {
+            float* io = outputBuffer.getWritePointer(c, startSample + done);
+            float* ring = chorusBuffer->getWritePointer(c);
 
-        // Interpolation
-        // get delayed sample index for both oscillators
-        float currentDelayMod1 = modSine1.next() * params.chorModDepth.get();
-        float currentDelayMod2 = modSine2.next() * params.chorModDepth.get();
-        float currentDelayMod3 = modSine3.next() * params.chorModDepth.get();
-        float currentDelayMod4 = modSine4.next() * params.chorModDepth.get();
-        float currentDelayMod5 = modSine5.next() * params.chorModDepth.get();
-
-
-        // get "time" in samples between two samples
-        float deltaTime1 = currentDelayMod1 - floor(currentDelayMod1);
-        float deltaTime2 = currentDelayMod2 - floor(currentDelayMod2);
-        float deltaTime3 = currentDelayMod3 - floor(currentDelayMod3);
-        float deltaTime4 = currentDelayMod4 - floor(currentDelayMod4);
-        float deltaTime5 = currentDelayMod5 - floor(currentDelayMod5);
-
-        for (int c = 0; c < outputBuffer.getNumChannels(); ++c) {
-
-            float currentSample = outputBuffer.getSample(c, startSample + i);
-            // get values for interpolation
-            // Osc 1
-            float value1_1 = chorusBuffer.getSample(c, static_cast<int>(loopPosition + params.chorDelayLength.get()*sampleRate + floor(currentDelayMod1)) % newLoopLength);
-            float value1_2 = chorusBuffer.getSample(c, static_cast<int>(loopPosition + params.chorDelayLength.get()*sampleRate + ceil(currentDelayMod1)) % newLoopLength);
-            // Osc 2
-            float value2_1 = chorusBuffer.getSample(c, static_cast<int>(loopPosition + params.chorDelayLength.get()*sampleRate + floor(currentDelayMod2)) % newLoopLength);
-            float value2_2 = chorusBuffer.getSample(c, static_cast<int>(loopPosition + params.chorDelayLength.get()*sampleRate + ceil(currentDelayMod2)) % newLoopLength);
-            // Osc3
-            float value3_1 = chorusBuffer.getSample(c, static_cast<int>(loopPosition + params.chorDelayLength.get()*sampleRate + floor(currentDelayMod3)) % newLoopLength);
-            float value3_2 = chorusBuffer.getSample(c, static_cast<int>(loopPosition + params.chorDelayLength.get()*sampleRate + ceil(currentDelayMod3)) % newLoopLength);
-            // Osc 4
-            float value4_1 = chorusBuffer.getSample(c, static_cast<int>(loopPosition + params.chorDelayLength.get()*sampleRate + floor(currentDelayMod4)) % newLoopLength);
-            float value4_2 = chorusBuffer.getSample(c, static_cast<int>(loopPosition + params.chorDelayLength.get()*sampleRate + ceil(currentDelayMod4)) % newLoopLength);
-            // Osc 5
-            float value5_1 = chorusBuffer.getSample(c, static_cast<int>(loopPosition + params.chorDelayLength.get()*sampleRate + floor(currentDelayMod5)) % newLoopLength);
-            float value5_2 = chorusBuffer.getSample(c, static_cast<int>(loopPosition + params.chorDelayLength.get()*sampleRate + ceil(currentDelayMod5)) % newLoopLength);
-            // Calculate value difference
-            float deltaValue1 = value1_2 - value1_1;
-            float deltaValue2 = value2_2 - value2_1;
-            float deltaValue3 = value3_2 - value3_1;
-            float deltaValue4 = value4_2 - value4_1;
-            float deltaValue5 = value5_2 - value5_1;
-
-            // Make linear interpolation: add deltaValue*deltaTime to previous sample value
-            float interpValue1 = value1_1 + deltaValue1*deltaTime1;
-            float interpValue2 = value2_1 + deltaValue2*deltaTime2;
-            float interpValue3 = value3_1 + deltaValue3*deltaTime3;
-            float interpValue4 = value4_1 + deltaValue4*deltaTime4;
-            float interpValue5 = value5_1 + deltaValue5*deltaTime5;
-
-            // Amplituden anpassen und Werte in Buffer schreiben
-
-            float currentWetness = params.chorDryWet.get();
-
-            outputBuffer.setSample(c, startSample + i, currentSample * (1.f - currentWetness));
-
-            if (c == 1) {
-                outputBuffer.addSample(1, startSample + i, interpValue1 * currentWetness*.2f + interpValue2 * currentWetness*.05f + interpValue3 *currentWetness * .35f + interpValue4 * currentWetness * .1f + interpValue5 * currentWetness * .3f);
-            }
-            else if (c == 2) {
-                outputBuffer.addSample(2, startSample + i, interpValue1 * currentWetness*.2f + interpValue2 * currentWetness*.35f + interpValue3 *currentWetness * .05f + interpValue4 * currentWetness * .3f + interpValue5 * currentWetness * .1f);
-            }
-            else {
-                outputBuffer.addSample(c, startSample + i, interpValue1 * currentWetness*.2f + interpValue2 * currentWetness*.2f + interpValue3 * currentWetness * .2f + interpValue4 * currentWetness * .2f + interpValue5 * currentWetness * .2f);
+            // the dry segment goes into the buffer first, every tap is longer than a segment
+            const int first = jmin(n, ringLength - writePosition);
+            FloatVectorOperations::copy(ring + writePosition, io, first);
+            FloatVectorOperations::copy(ring, io + first, n - first);
+
+            const float* weights = tapWeights[c == 1 ? 1 : (c == 2 ? 2 : 0)];
+            FloatVectorOperations::clear(wet, n);
+            std::array<float, numTaps>& state = allpassState[static_cast<size_t>(c)];
+            for (int k = 0; k < numTaps; ++k) {
+                addTap(ring, index[k], frac[k], weights[k], wet, n, interpolation, state[static_cast<size_t>(k)]);
             }
 
-            chorusBuffer.setSample(c, loopPosition, currentSample);
+            FloatVectorOperations::multiply(io, 1.f - wetness, n);
+            FloatVectorOperations::addWithMultiply(io, wet, wetness, n);
+        }
+
+        writePosition = (writePosition + n) & ringMask;
+    }
 
+    // the allpass decays with the input
+    for (std::array<float, numTaps>& state : allpassState) {
+        for (float& s : state) {
+            Denormals::flush(s);
         }
+    }
+}
 
-        // iterate
-        currentDelayLength = newLoopLength;
-        ++loopPosition;
+void FxChorus::calcTapPositions(const float* mod, int base, int* index, float* frac, int n)
+{
+    for (int s = 0; s < n; ++s) {
+        // floor of the modulation, it stays far above -64 samples
+        const int offset = static_cast<int>(mod[s] + 64.f) - 64;
+        index[s] = base + s + offset;
+        frac[s] = mod[s] - static_cast<float>(offset);
+    }
+}
+
+void FxChorus::gather(const float* ring, const int* index, int offset, float* y, int n) const
+{
+    for (int s = 0; s < n; ++s) {
+        y[s] = ring[(index[s] + offset) & ringMask];
+    }
+}
+
+void FxChorus::addTap(const float* ring, const int* index, const float* frac, float weight, float* wet, int n,
+                      eChorusInterpolation interpolation, float& state) const
+{
+    float y1[maxSegmentLength];
+    float y2[maxSegmentLength];
+    gather(ring, index, 0, y1, n);
+    gather(ring, index, 1, y2, n);
+
+    switch (interpolation) {
+    case eChorusInterpolation::eHermite: {
+        float y0[maxSegmentLength];
+        float y3[maxSegmentLength];
+        gather(ring, index, -1, y0, n);
+        gather(ring, index, 2, y3, n);
+        interpolateHermite(y0, y1, y2, y3, frac, weight, wet, n);
+        break;
+    }
+    case eChorusInterpolation::eAllpass: {
+        float y3[maxSegmentLength];
+        gather(ring, index, 2, y3, n);
+        interpolateAllpass(y1, y2, y3, frac, weight, wet, n, state);
+        break;
+    }
+    default:
+        interpolateLinear(y1, y2, frac, weight, wet, n);
+        break;
+    }
+}
+
+void FxChorus::interpolateLinear(const float* y1, const float* y2, const float* frac, float weight, float* wet, int n)
+{
+    // add deltaValue*deltaTime to previous sample value
+    for (int s = 0; s < n; ++s) {
+        wet[s] += weight * (y1[s] + (y2[s] - y1[s]) * frac[s]);
+    }
+}
+
+void FxChorus::interpolateHermite(const float* y0, const float* y1, const float* y2, const float* y3,
+                                  const float* frac, float weight, float* wet, int n)
+{
+    // 4 point, 3rd order hermite
+    for (int s = 0; s < n; ++s) {
+        const float t = frac[s];
+        const float c1 = .5f * (y2[s] - y0[s]);
+        const float c2 = y0[s] - 2.5f * y1[s] + 2.f * y2[s] - .5f * y3[s];
+        const float c3 = .5f * (y3[s] - y0[s]) + 1.5f * (y1[s] - y2[s]);
+        wet[s] += weight * (((c3 * t + c2) * t + c1) * t + y1[s]);
+    }
+}
+
+void FxChorus::interpolateAllpass(const float* y1, const float* y2, const float* y3,
+                                  const float* frac, float weight, float* wet, int n, float& state)
+{
+    // the pair of samples and the coefficient per sample, branch free: up to a fraction of .5 the
+    // tap is 1 - frac behind y2, above it 2 - frac behind y3
+    float newer[maxSegmentLength];
+    float older[maxSegmentLength];
+    float coeff[maxSegmentLength];
+    for (int s = 0; s < n; ++s) {
+        const bool upper = frac[s] > .5f;
+        const float delay = (upper ? 2.f : 1.f) - frac[s];
+        newer[s] = upper ? y3[s] : y2[s];
+        older[s] = upper ? y2[s] : y1[s];
+        coeff[s] = (1.f - delay) / (1.f + delay);
     }
 
+    float y = state;
+    for (int s = 0; s < n; ++s) {
+        y = coeff[s] * (newer[s] - y) + older[s];
+        wet[s] += weight * y;
+    }
+    state = y;
 }
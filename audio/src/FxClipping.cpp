@@ -9,14 +9,88 @@
 */
 
 #include "FxClipping.h"
+#include "Instrument.h"
+
+namespace {
+    //! tanh and its antiderivative log(cosh(x)), written so that it does not overflow
+    struct TanhCurve {
+        static double f(double x) { return std::tanh(x); }
+        static double antiderivative(double x) {
+            const double a = std::abs(x);
+            return a + std::log1p(std::exp(-2. * a)) - 0.69314718055994530942;
+        }
+    };
+
+    //! 1.5x - 0.5x^3, which reaches 1 with a flat slope at |x| = 1, and its antiderivative
+    struct CubicCurve {
+        static double f(double x) {
+            if (x >= 1.) return 1.;
+            if (x <= -1.) return -1.;
+            return x * (1.5 - .5 * x * x);
+        }
+        static double antiderivative(double x) {
+            const double a = std::abs(x);
+            if (a >= 1.) return a - .375;
+            const double x2 = x * x;
+            return x2 * (.75 - .125 * x2);
+        }
+    };
+
+    //! first order antiderivative anti-aliasing of a block, in place
+    template<typename _curve>
+    void clipAntiderivative(float* samples, double& last, int numSamples)
+    {
+        // below this step the quotient cancels out, the curve at the midpoint is the same value
+        const double minStep = 1e-5;
+
+        double x1 = last;
+        double f1 = _curve::antiderivative(x1);
+        for (int s = 0; s < numSamples; ++s) {
+            const double x = samples[s];
+            const double f = _curve::antiderivative(x);
+            const double dx = x - x1;
+            samples[s] = static_cast<float>(std::abs(dx) > minStep ? (f - f1) / dx : _curve::f(.5 * (x + x1)));
+            x1 = x;
+            f1 = f;
+        }
+        last = x1;
+    }
+}
 
 FxClipping::~FxClipping(){};
 
-void FxClipping::clipSignal(AudioSampleBuffer& outputBuffer, int startSample, int numSamples)
+void FxClipping::prepare(int numChannels, double sampleRate)
+{
+    ignoreUnused(sampleRate);
+    lastInput.assign(static_cast<size_t>(numChannels), 0.);
+}
+
+void FxClipping::reset()
+{
+    std::fill(lastInput.begin(), lastInput.end(), 0.);
+}
+
+void FxClipping::process(AudioSampleBuffer& outputBuffer, int startSample, int numSamples)
 {
-    float clipFactor = params.clippingFactor.get();
-    for (int c = 0; c < outputBuffer.getNumChannels(); ++c) {
+    float clipFactor = params.getSnapshot().clippingFactor;
+    const eClippingMode mode = params.getSnapshot().clippingMode;
+    const int numChannels = mode == eClippingMode::eHard ? outputBuffer.getNumChannels()
+                                                         : jmin(outputBuffer.getNumChannels(), static_cast<int>(lastInput.size()));
+    for (int c = 0; c < numChannels; ++c) {
+        SYNISTER_SCOPE_FINE("clipping channel");
         FloatVectorOperations::multiply(outputBuffer.getWritePointer(c, startSample), clipFactor, numSamples);
-        FloatVectorOperations::clip(outputBuffer.getWritePointer(c, startSample), outputBuffer.getReadPointer(c, startSample), -1.f, 1.f, numSamples);
+        switch (mode) {
+            case eClippingMode::eHard:
+                FloatVectorOperations::clip(outputBuffer.getWritePointer(c, startSample), outputBuffer.getReadPointer(c, startSample), -1.f, 1.f, numSamples);
+                break;
+            case eClippingMode::eTanh:
+                clipAntiderivative<TanhCurve>(outputBuffer.getWritePointer(c, startSample), lastInput[c], numSamples);
+                break;
+            case eClippingMode::eCubic:
+                clipAntiderivative<CubicCurve>(outputBuffer.getWritePointer(c, startSample), lastInput[c], numSamples);
+                break;
+            default:
+                break;
+        }
     }
-}
\ No newline at end of file
+}
@@ -9,130 +9,349 @@ Author:  nj
 */
 
 #include "FxDelay.h"
+#include "Instrument.h"
 
-float FxDelay::filter(float currentSample) {
+void FxDelay::calcCoefficients(float cutoff) {
 
     //New Filter Design: Biquad (2 delays) Source: http://www.musicdsp.org/showArchiveComment.php?ArchiveID=259
-    float k, coeff1, coeff2, coeff3, b0, b1, b2, a1, a2;
-
-    const float currentLowcutFreq = params.delayCutoff.get() / static_cast<float>(sampleRate);
+    const float currentLowcutFreq = cutoff / static_cast<float>(sampleRate);
     //const float currentResonance = pow(10.f, -params.delayResonance.get() / 20.f);
 
     // coefficients for lowpass, depending on resonance and lowcut frequency
-    k = 0.5f * sin(2.f * float_Pi * currentLowcutFreq);
-    coeff1 = 0.5f * (1.f - k) / (1.f + k);
-    coeff2 = (0.5f + coeff1) * cos(2.f * float_Pi * currentLowcutFreq);
-    coeff3 = (0.5f + coeff1 - coeff2) * 0.25f;
-
-    b0 = 2.f * coeff3;
-    b1 = 2.f * 2.f * coeff3;
-    b2 = 2.f * coeff3;
-    a1 = 2.f * -coeff2;
-    a2 = 2.f * coeff1;
-
-    fLastSample = currentSample;
-
-    currentSample = b0*currentSample + b1*fInputDelay1 + b2*fInputDelay2 - a1*fOutputDelay1 - a2*fOutputDelay2;
+    const float k = 0.5f * sin(2.f * float_Pi * currentLowcutFreq);
+    const float coeff1 = 0.5f * (1.f - k) / (1.f + k);
+    const float coeff2 = (0.5f + coeff1) * cos(2.f * float_Pi * currentLowcutFreq);
+    const float coeff3 = (0.5f + coeff1 - coeff2) * 0.25f;
+
+    feedbackFilter.b0 = 2.f * coeff3;
+    feedbackFilter.b1 = 2.f * 2.f * coeff3;
+    feedbackFilter.b2 = 2.f * coeff3;
+    feedbackFilter.a1 = 2.f * -coeff2;
+    feedbackFilter.a2 = 2.f * coeff1;
+
+    coefficientCutoff = cutoff;
+}
 
-    //delaying samples
-    fInputDelay2 = fInputDelay1;
-    fInputDelay1 = fLastSample;
-    fOutputDelay2 = fOutputDelay1;
-    fOutputDelay1 = currentSample;
+void FxDelay::filter(float* frames, int n) {
+    SimdKernels::get().stereoBiquadFrames(feedbackFilter, frames, n);
+}
 
-    return currentSample;
+void FxDelay::clearFilter()
+{
+    for (int c = 0; c < frameWidth; ++c) {
+        feedbackFilter.x1[c] = feedbackFilter.x2[c] = 0.f;
+        feedbackFilter.y1[c] = feedbackFilter.y2[c] = 0.f;
+    }
 }
 
-void FxDelay::init(int channelsIn, double sampleRateIn)
+void FxDelay::prepare(int channelsIn, double sampleRateIn)
 {
     channels = channelsIn;
     sampleRate = sampleRateIn;
-    delayBuffer.setSize(channels, static_cast<int>(sampleRate * 20.0));
-    currentDelayLength = static_cast<int>(params.delayTime.get()*(sampleRate / 1000.0));
+    storage = params.delayStorage.getStep();
+    // allocated when the delay is first switched on
+    const int numFrames = static_cast<int>(maxDelayLength * sampleRate / 1000.0) + 1;
+    ringFrames = numFrames;
+    delayBuffer.setSize(1, storage == eDelayStorage::eFloat ? numFrames * frameWidth : (numFrames * frameWidth + 1) / 2, params.lockMemory.getStep() == eOnOffToggle::eOn);
+    writePosition = 0;
+    loopPosition = 0;
+    delayLength = jlimit(1, numFrames, static_cast<int>(getCurrentTime() * (sampleRate / 1000.0)));
+    fadeSamples = jmax(1, static_cast<int>(crossfadeTime * sampleRate));
+    fadeCounter = 0;
+    clearFilter();
+    calcCoefficients(params.delayCutoff.get());
+    params.delayFeedback.prepareSmoothing(sampleRate);
+    params.delayDryWet.prepareSmoothing(sampleRate);
+}
+
+void FxDelay::reset()
+{
     delayBuffer.clear();
+    fadeCounter = 0;
+    loopPosition = 0;
+    clearFilter();
 }
 
-void FxDelay::calcTime()
+int FxDelay::getTailSamples() const
 {
-    if (params.delaySync.getStep() == eOnOffToggle::eOn){
-        double bpmIn = params.positionInfo[params.getGUIIndex()].bpm;
+    const double length = getCurrentTime() * (sampleRate / 1000.0);
+    const float feedback = params.delayFeedback.get();
+
+    int repeats = 1;
+    if (feedback >= 1.f) {
+        repeats = maxTailRepeats;
+    } else if (feedback > 0.f) {
+        repeats = jmin(maxTailRepeats, 1 + static_cast<int>(std::ceil(std::log(.001) / std::log(feedback))));
+    }
+    return static_cast<int>(length * repeats);
+}
 
-        float newTime = static_cast<float>(4000.0 * (1. / (bpmIn / 60.)) *
-                                           static_cast<double>(params.delayDividend.get() / params.delayDivisor.get()));
+int64 FxDelay::getMemoryBytes() const
+{
+    return static_cast<int64>(sizeof(FxDelay)) + delayBuffer.getAllocatedBytes();
+}
 
-        if (params.delayDottedLength.getStep() == eOnOffToggle::eOn) {
-            newTime *= 1.5f;
-        }
-        if (params.delayTriplet.getStep() == eOnOffToggle::eOn) {
-            newTime *= 2.f/3.f;
-        }
+float FxDelay::calcTime(const ParamSnapshot& snap)
+{
+    if (snap.delaySync){
+        const TempoContext& tempo = params.tempo;
+        float newTime = static_cast<float>(tempo.getNoteMs(snap.delayDividend, snap.delayDivisor,
+                                                           snap.delayDottedLength, snap.delayTriplet));
 
-        bpm = bpmIn;
-        divisor = params.delayDivisor.get();
-        dividend = params.delayDividend.get();
-        triplet = params.delayTriplet.getStep();
+        bpm = tempo.bpm;
+        divisor = snap.delayDivisor;
+        dividend = snap.delayDividend;
+        triplet = snap.delayTriplet ? eOnOffToggle::eOn : eOnOffToggle::eOff;
 
         if (newTime > static_cast<float>(maxDelayLength)) {
             newTime = static_cast<float>(maxDelayLength);
         }
-
-        float oldTime = params.delayTime.get();
-        // only notify ui (and host) if change is greater than .1 ms
-        params.delayTime.set(newTime, std::abs(oldTime-newTime) > .1f);
+        return newTime;
     }
+    return snap.delayTime;
 }
 
-void FxDelay::render(AudioSampleBuffer& outputBuffer, int startSample, int numSamplesIn)
+float FxDelay::getCurrentTime() const
 {
-    ignoreUnused(numSamplesIn); // to get rid of the compiler warning, since it is not used yet
+    // the synced time is only known once a block ran
+    const float time = params.telemetry.display.delayTime.load(std::memory_order_relaxed);
+    return time > 0.f ? time : params.delayTime.get();
+}
 
-    int newLoopLength;
-    calcTime();
+void FxDelay::process(AudioSampleBuffer& outputBuffer, int startSample, int numSamples)
+{
+    ring = delayBuffer.acquire();
+    if (ring == nullptr) {
+        return;
+    }
 
-    for (int s = 0; s < outputBuffer.getNumSamples(); ++s)
-    {
-        // get new length from UI
-        newLoopLength = static_cast<int>(params.delayTime.get() * (sampleRate / 1000.0));
+    const ParamSnapshot& snap = params.getSnapshot();
+    const float delayTime = calcTime(snap);
+    // the panel shows the synced time, the param keeps the manual one
+    params.telemetry.display.delayTime.store(delayTime, std::memory_order_relaxed);
+    const int ringLength = ringFrames;
 
-        // reset the loop position according to the current delay length
-        loopPosition %= newLoopLength;
+    // the length is fixed for the block
+    const int newLength = jlimit(1, ringLength, static_cast<int>(delayTime * (sampleRate / 1000.0)));
+
+    if (snap.delayCutoff != coefficientCutoff) {
+        calcCoefficients(snap.delayCutoff);
+    }
 
-        // clear old material from buffer
-        if (newLoopLength < currentDelayLength) { // TODO: this is still a bit messy
-            delayBuffer.clear(newLoopLength, delayBuffer.getNumSamples() - currentDelayLength);
+    // a new length fades in from the current one, a change during a fade waits for its end
+    if (newLength != delayLength && fadeCounter == 0) {
+        fadeFromLength = delayLength;
+        fadeFromPosition = loopPosition;
+        fadeCounter = fadeSamples;
+        delayLength = newLength;
+        loopPosition %= delayLength;
+    }
+
+    const int numChannels = jmin(outputBuffer.getNumChannels(), channels, static_cast<int>(frameWidth));
+    if (numChannels == 0) {
+        return;
+    }
+    const bool pingPong = snap.delayPingPong && numChannels == frameWidth;
+    int done = 0;
+    while (done < numSamples) {
+        // segments end at the end of the ring buffer and of the loop, and do not read what they write
+        int n = jmin(numSamples - done, ringLength - writePosition, static_cast<int>(maxSegmentLength));
+        n = jmin(n, delayLength, getLoopSegmentLength(delayLength, loopPosition, snap.delayReverse));
+        if (fadeCounter > 0) {
+            n = jmin(n, fadeCounter, jmin(fadeFromLength, getLoopSegmentLength(fadeFromLength, fadeFromPosition, snap.delayReverse)));
         }
 
-        for (int c = 0; c < outputBuffer.getNumChannels(); ++c) {
+        // the gains ramp to a new value, the same for all channels
+        const Param::Ramp feedback = params.delayFeedback.getSmoothedRamp(n);
+        const Param::Ramp dryWet = params.delayDryWet.getSmoothedRamp(n);
+
+        // a mono output feeds both channels of the frames and gets the left one back
+        float* const left = outputBuffer.getWritePointer(0, startSample + done);
+        float* const right = numChannels > 1 ? outputBuffer.getWritePointer(1, startSample + done) : left;
+        float frames[frameWidth * maxSegmentLength];
+        for (int s = 0; s < n; ++s) {
+            frames[frameWidth * s] = left[s];
+            frames[frameWidth * s + 1] = right[s];
+        }
+        renderSegment(frames, n, snap, feedback, dryWet, pingPong);
+        for (int s = 0; s < n; ++s) {
+            left[s] = frames[frameWidth * s];
+        }
+        if (numChannels > 1) {
+            for (int s = 0; s < n; ++s) {
+                right[s] = frames[frameWidth * s + 1];
+            }
+        }
 
-            // get current samples
-            float currentSample = outputBuffer.getSample(c, startSample + s);
-            float delayedSample = delayBuffer.getSample(c, loopPosition);
+        // iterate
+        writePosition = (writePosition + n) % ringLength;
+        loopPosition = (loopPosition + n) % delayLength;
+        if (fadeCounter > 0) {
+            fadeFromPosition = (fadeFromPosition + n) % fadeFromLength;
+            fadeCounter -= n;
+        }
+        done += n;
+    }
 
-            // calc index for loop direction (reverse mode)
-            int orderPosition;
+    // the filter state decays with the feedback once the input is silent
+    for (int c = 0; c < frameWidth; ++c) {
+        Denormals::flush(feedbackFilter.x1[c]);
+        Denormals::flush(feedbackFilter.x2[c]);
+        Denormals::flush(feedbackFilter.y1[c]);
+        Denormals::flush(feedbackFilter.y2[c]);
+    }
+}
 
-            if (params.delayReverse.getStep() == eOnOffToggle::eOff) {
-                orderPosition = loopPosition;
-            } else { orderPosition = newLoopLength - loopPosition; }
+int FxDelay::getLoopSegmentLength(int length, int position, bool reverse)
+{
+    // in reverse mode the delay drops by the length halfway through the loop
+    const int half = (length + 2) / 2;
+    return reverse && position < half ? half - position : length - position;
+}
 
-            // add new material to buffer, filterd or not
-            delayBuffer.setSample(c, orderPosition, currentSample);
+void FxDelay::readFrames(float* out, int frame, int n) const
+{
+    const SimdKernels& k = SimdKernels::get();
+    switch (storage) {
+        case eDelayStorage::eFixed16:
+            k.unpackInt16(reinterpret_cast<const int16_t*>(ring->getReadPointer(0)) + frameWidth * frame, out, 1.f / fixedScale, frameWidth * n);
+            break;
+        case eDelayStorage::eHalf:
+            k.unpackHalf(reinterpret_cast<const uint16_t*>(ring->getReadPointer(0)) + frameWidth * frame, out, frameWidth * n);
+            break;
+        default:
+            FloatVectorOperations::copy(out, ring->getReadPointer(0, frameWidth * frame), frameWidth * n);
+            break;
+    }
+}
 
-            if (params.delayRecordFilter.getStep() == eOnOffToggle::eOn) {
-                delayedSample = filter(delayedSample);
-            }
+void FxDelay::writeFrames(const float* in, int frame, int n)
+{
+    const SimdKernels& k = SimdKernels::get();
+    switch (storage) {
+        case eDelayStorage::eFixed16:
+            k.packInt16(in, reinterpret_cast<int16_t*>(ring->getWritePointer(0)) + frameWidth * frame, fixedScale, frameWidth * n);
+            break;
+        case eDelayStorage::eHalf:
+            k.packHalf(in, reinterpret_cast<uint16_t*>(ring->getWritePointer(0)) + frameWidth * frame, frameWidth * n);
+            break;
+        default:
+            FloatVectorOperations::copy(ring->getWritePointer(0, frameWidth * frame), in, frameWidth * n);
+            break;
+    }
+}
+
+void FxDelay::readDelayed(float* out, int n, int length, int position, bool reverse) const
+{
+    const int ringLength = ringFrames;
+
+    if (!reverse) {
+        // one read, or two where the read wraps around the end of the ring buffer
+        int read = writePosition - length;
+        if (read < 0) {
+            read += ringLength;
+        }
+        const int first = jmin(n, ringLength - read);
+        readFrames(out, read, first);
+        if (n > first) {
+            readFrames(out + frameWidth * first, 0, n - first);
+        }
+        return;
+    }
+
+    const float* frames = ring->getReadPointer(0);
+    const bool isFloat = storage == eDelayStorage::eFloat;
+
+    for (int s = 0; s < n; ++s) {
+        // the loop position p was written 2p samples ago, modulo the length
+        const int p = position + s;
+        const int delay = p == 0 ? length : (2 * p - 1 < length ? 2 * p : 2 * p - length);
+        int read = writePosition + s - delay;
+        if (read < 0) {
+            read += ringLength;
+        }
+        if (isFloat) {
+            out[frameWidth * s] = frames[frameWidth * read];
+            out[frameWidth * s + 1] = frames[frameWidth * read + 1];
+        } else {
+            readFrames(out + frameWidth * s, read, 1);
+        }
+    }
+}
 
-            delayBuffer.addSample(c, orderPosition, delayedSample * params.delayFeedback.get());
+void FxDelay::addWithRamp(float* dst, const float* src, Param::Ramp gain, int n, bool swapChannels)
+{
+    if (gain.isConstant() && !swapChannels) {
+        FloatVectorOperations::addWithMultiply(dst, src, gain.end, frameWidth * n);
+        return;
+    }
+    const float step = gain.isConstant() ? 0.f : (gain.end - gain.start) / static_cast<float>(n);
+    const float start = gain.isConstant() ? gain.end : gain.start;
+    const int other = swapChannels ? 1 : 0;
+    for (int s = 0; s < n; ++s) {
+        // one gain per frame
+        const float g = start + static_cast<float>(s + 1) * step;
+        dst[frameWidth * s] += src[frameWidth * s + other] * g;
+        dst[frameWidth * s + 1] += src[frameWidth * s + 1 - other] * g;
+    }
+}
 
-            if (params.delayRecordFilter.getStep() == eOnOffToggle::eOff) {
-                delayedSample = filter(delayedSample);
+void FxDelay::renderSegment(float* io, int n, const ParamSnapshot& snap, Param::Ramp feedback, Param::Ramp dryWet, bool pingPong)
+{
+    SYNISTER_SCOPE_FINE("delay segment");
+
+    // get current frames, every frame of the segment was written before it
+    float delayedFrames[frameWidth * maxSegmentLength];
+    readDelayed(delayedFrames, n, delayLength, loopPosition, snap.delayReverse);
+
+    if (fadeCounter > 0) {
+        float fadeFromFrames[frameWidth * maxSegmentLength];
+        readDelayed(fadeFromFrames, n, fadeFromLength, fadeFromPosition, snap.delayReverse);
+        const float step = 1.f / static_cast<float>(fadeSamples);
+        const float start = static_cast<float>(fadeSamples - fadeCounter) * step;
+        for (int s = 0; s < n; ++s) {
+            const float gain = start + static_cast<float>(s + 1) * step;
+            for (int c = 0; c < frameWidth; ++c) {
+                const int i = frameWidth * s + c;
+                delayedFrames[i] = fadeFromFrames[i] + (delayedFrames[i] - fadeFromFrames[i]) * gain;
             }
+        }
+    }
 
-            outputBuffer.addSample(c, startSample + s, delayedSample * params.delayDryWet.get());
+    if (snap.delayRecordFilter) {
+        filter(delayedFrames, n);
+    }
 
+    // add new material to buffer, filterd or not; a 16 bit ring gets the frames once they are complete
+    float writtenFrames[frameWidth * maxSegmentLength];
+    float* write = storage == eDelayStorage::eFloat ? ring->getWritePointer(0, frameWidth * writePosition) : writtenFrames;
+    if (pingPong) {
+        // the first repeat is on the left, the feedback moves every repeat to the other side
+        for (int s = 0; s < n; ++s) {
+            write[frameWidth * s] = .5f * (io[frameWidth * s] + io[frameWidth * s + 1]);
+            write[frameWidth * s + 1] = 0.f;
         }
-        // iterate
-        currentDelayLength = newLoopLength;
-        ++loopPosition;
+    } else {
+        FloatVectorOperations::copy(write, io, frameWidth * n);
+    }
+    addWithRamp(write, delayedFrames, feedback, n, pingPong);
+    if (write == writtenFrames) {
+        writeFrames(writtenFrames, writePosition, n);
+    }
+
+    if (!snap.delayRecordFilter) {
+        filter(delayedFrames, n);
     }
+
+    addWithRamp(io, delayedFrames, dryWet, n, false);
+}
+
+int FxDelay::countDenormalState() const
+{
+    int numDenormals = 0;
+    numDenormals += Denormals::count(feedbackFilter.x1, frameWidth);
+    numDenormals += Denormals::count(feedbackFilter.x2, frameWidth);
+    numDenormals += Denormals::count(feedbackFilter.y1, frameWidth);
+    numDenormals += Denormals::count(feedbackFilter.y2, frameWidth);
+    return numDenormals;
 }
@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+
+    FxPipeline.cpp
+    Created: 17 Oct 2026 5:41:09pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "FxPipeline.h"
+#include <cstring>
+
+FxPipeline::FxPipeline()
+    : numDry(0)
+    , numWet(0)
+    , latency(0)
+    , currentStages(nullptr)
+    , currentBuffer(nullptr)
+    , currentNumSamples(0)
+{
+}
+
+FxPipeline::~FxPipeline()
+{
+    release();
+}
+
+void FxPipeline::prepare(int numChannels, int maxBlockSize, double blockSeconds)
+{
+    // the workers of the process are started by the first instance to get here
+    threadPool = new SharedResourcePointer<RealtimeThreadPool>();
+    (*threadPool)->setBlockPeriod(blockSeconds);
+    dry.setSize(numChannels, maxBlockSize);
+    wet.setSize(numChannels, maxBlockSize);
+    latency = maxBlockSize;
+    reset();
+}
+
+void FxPipeline::release()
+{
+    threadPool = nullptr;
+    dry.setSize(0, 0);
+    wet.setSize(0, 0);
+    latency = 0;
+    numDry = 0;
+    numWet = 0;
+}
+
+void FxPipeline::reset()
+{
+    dry.clear();
+    wet.clear();
+    numDry = 0;
+    numWet = latency;
+}
+
+void FxPipeline::process(AudioSampleBuffer& buffer, int numSamples, Stages& stages)
+{
+    jassert(isActive() && numWet + numDry == latency);
+    const int numChannels = jmin(buffer.getNumChannels(), dry.getNumChannels());
+
+    if (numSamples > latency) {
+        // more than the host announced, nothing in flight can make up for it
+        jassertfalse;
+        reset();
+        stages.renderVoices(buffer, numSamples);
+        stages.processEffects(buffer, numSamples);
+        return;
+    }
+
+    currentStages = &stages;
+    currentBuffer = &buffer;
+    currentNumSamples = numSamples;
+    RealtimeThreadPool::Batch batch(&runStage, this, 2);
+    (*threadPool)->run(batch);
+
+    // the processed block goes behind what is left in the fifo, this block takes its samples from the front
+    for (int c = 0; c < numChannels; ++c) {
+        wet.copyFrom(c, numWet, dry, c, 0, numDry);
+        dry.copyFrom(c, 0, buffer, c, 0, numSamples);
+        buffer.copyFrom(c, 0, wet, c, 0, numSamples);
+        float* const w = wet.getWritePointer(c);
+        std::memmove(w, w + numSamples, static_cast<size_t>(numWet + numDry - numSamples) * sizeof(float));
+    }
+    numWet += numDry - numSamples;
+    numDry = numSamples;
+}
+
+void FxPipeline::runStage(void* context, int job)
+{
+    FxPipeline& pipeline = *static_cast<FxPipeline*>(context);
+    if (job == 0) {
+        pipeline.currentStages->renderVoices(*pipeline.currentBuffer, pipeline.currentNumSamples);
+    } else if (pipeline.numDry > 0) {
+        pipeline.currentStages->processEffects(pipeline.dry, pipeline.numDry);
+    }
+}
+
+bool FxPipeline::hasPendingSignal(float threshold) const
+{
+    return (numDry > 0 && dry.getMagnitude(0, numDry) >= threshold)
+        || (numWet > 0 && wet.getMagnitude(0, numWet) >= threshold);
+}
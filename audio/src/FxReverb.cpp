@@ -0,0 +1,158 @@
+/*
+  ==============================================================================
+
+    FxReverb.cpp
+    Created: 15 Oct 2026 5:02:44am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "FxReverb.h"
+#include "Denormals.h"
+#include "Instrument.h"
+
+namespace {
+    //! line lengths at 44.1 kHz and a size of 1, mutually prime
+    const int baseLineLength[FxReverb::numLines] = { 1123, 1291, 1471, 1627, 1777, 1949, 2111, 2293 };
+    //! signs of the input into the lines, the sum of all lines is the one direction the matrix inverts
+    const float inputSign[FxReverb::numLines] = { 1.f, -1.f, 1.f, 1.f, -1.f, 1.f, -1.f, -1.f };
+    //! signs of the lines in the first and the second channel, orthogonal for a wide stereo image
+    const float outputSign[2][FxReverb::numLines] = {
+        { 1.f, 1.f, -1.f, -1.f, 1.f, 1.f, -1.f, -1.f },
+        { 1.f, -1.f, 1.f, -1.f, 1.f, -1.f, 1.f, -1.f }
+    };
+    //! gain of the line sum in the output, about the power of one line
+    const float outputGain = .35f;
+}
+
+FxReverb::~FxReverb() {};
+
+void FxReverb::prepare(int channelsIn, double sampleRateIn)
+{
+    channels = channelsIn;
+    sampleRate = static_cast<float>(sampleRateIn);
+
+    // the longest line at the largest size and a segment, written after the reads of the segment
+    const int maxLine = static_cast<int>(baseLineLength[numLines - 1] * params.reverbSize.getMax() * sampleRate / 44100.f) + 1;
+    const int ringLength = nextPowerOfTwo(maxLine + maxSegmentLength);
+    buffer.setSize(numLines, ringLength, params.lockMemory.getStep() == eOnOffToggle::eOn);
+    ringMask = ringLength - 1;
+    writePosition = 0;
+    dampState.fill(0.f);
+}
+
+void FxReverb::reset()
+{
+    buffer.clear();
+    dampState.fill(0.f);
+}
+
+int FxReverb::getLineLength(int line, float size) const
+{
+    const int length = static_cast<int>(baseLineLength[line] * size * sampleRate / 44100.f);
+    return jlimit(maxSegmentLength, ringMask + 1 - maxSegmentLength, length);
+}
+
+int FxReverb::getTailSamples() const
+{
+    return static_cast<int>(params.reverbDecay.get() * sampleRate) + getLineLength(numLines - 1, params.reverbSize.get());
+}
+
+int64 FxReverb::getMemoryBytes() const
+{
+    return static_cast<int64>(sizeof(FxReverb)) + buffer.getAllocatedBytes();
+}
+
+void FxReverb::process(AudioSampleBuffer& outputBuffer, int startSample, int numSamples)
+{
+    lines = buffer.acquire();
+    if (lines == nullptr) {
+        return;
+    }
+
+    const ParamSnapshot& snap = params.getSnapshot();
+
+    // the lengths and the losses are fixed for the block, every line decays by 60 dB in the decay time
+    int length[numLines];
+    float lineGain[numLines];
+    for (int i = 0; i < numLines; ++i) {
+        length[i] = getLineLength(i, snap.reverbSize);
+        lineGain[i] = std::pow(10.f, -3.f * static_cast<float>(length[i]) / (snap.reverbDecay * sampleRate));
+    }
+    const float damp = std::exp(-2.f * float_Pi * snap.reverbDamping / sampleRate);
+    const float wetness = snap.reverbDryWet;
+
+    const int numChannels = jmin(outputBuffer.getNumChannels(), channels);
+    if (numChannels == 0) {
+        return;
+    }
+    const float inputGain = 1.f / static_cast<float>(numChannels);
+    const float mixGain = -2.f / static_cast<float>(numLines);
+    const int ringLength = ringMask + 1;
+
+    float in[maxSegmentLength];
+    float sum[maxSegmentLength];
+    float wet[maxSegmentLength];
+    float feedback[maxSegmentLength];
+    float delayed[numLines][maxSegmentLength];
+
+    for (int done = 0; done < numSamples; done += maxSegmentLength) {
+        const int n = jmin(maxSegmentLength, numSamples - done);
+        const int first = jmin(n, ringLength - writePosition);
+        SYNISTER_SCOPE_FINE("reverb segment");
+
+        // mono input
+        FloatVectorOperations::copy(in, outputBuffer.getReadPointer(0, startSample + done), n);
+        for (int c = 1; c < numChannels; ++c) {
+            FloatVectorOperations::add(in, outputBuffer.getReadPointer(c, startSample + done), n);
+        }
+        FloatVectorOperations::multiply(in, inputGain, n);
+
+        // read, damp and attenuate every line, every sample of the segment was written before
+        FloatVectorOperations::clear(sum, n);
+        for (int i = 0; i < numLines; ++i) {
+            const float* ring = lines->getReadPointer(i);
+            const int read = (writePosition - length[i]) & ringMask;
+            const int firstRead = jmin(n, ringLength - read);
+            FloatVectorOperations::copy(delayed[i], ring + read, firstRead);
+            FloatVectorOperations::copy(delayed[i] + firstRead, ring, n - firstRead);
+
+            float y = dampState[i];
+            for (int s = 0; s < n; ++s) {
+                y = delayed[i][s] + damp * (y - delayed[i][s]);
+                delayed[i][s] = y;
+            }
+            Denormals::flush(y);
+            dampState[i] = y;
+
+            FloatVectorOperations::multiply(delayed[i], lineGain[i], n);
+            FloatVectorOperations::add(sum, delayed[i], n);
+        }
+
+        // Householder feedback: every line minus 2/N of the sum of all lines, plus the input
+        for (int i = 0; i < numLines; ++i) {
+            FloatVectorOperations::copy(feedback, delayed[i], n);
+            FloatVectorOperations::addWithMultiply(feedback, sum, mixGain, n);
+            FloatVectorOperations::addWithMultiply(feedback, in, inputSign[i], n);
+
+            float* ring = lines->getWritePointer(i);
+            FloatVectorOperations::copy(ring + writePosition, feedback, first);
+            FloatVectorOperations::copy(ring, feedback + first, n - first);
+        }
+
+        for (int c = 0; c < numChannels; ++c) {
+            const float* sign = outputSign[c & 1];
+            FloatVectorOperations::clear(wet, n);
+            for (int i = 0; i < numLines; ++i) {
+                FloatVectorOperations::addWithMultiply(wet, delayed[i], sign[i] * outputGain, n);
+            }
+
+            float* io = outputBuffer.getWritePointer(c, startSample + done);
+            FloatVectorOperations::multiply(io, 1.f - wetness, n);
+            FloatVectorOperations::addWithMultiply(io, wet, wetness, n);
+        }
+
+        writePosition = (writePosition + n) & ringMask;
+    }
+}
@@ -0,0 +1,123 @@
+/*
+  ==============================================================================
+
+    FxWaveshaper.cpp
+    Created: 16 Oct 2026 9:12:40am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "FxWaveshaper.h"
+#include "DspTables.h"
+#include "Denormals.h"
+#include "Instrument.h"
+
+static_assert(DspTables::numShaperCurves == static_cast<int>(eShaperCurve::nSteps), "a table per curve");
+
+FxWaveshaper::FxWaveshaper(SynthParams &p)
+    : params(p)
+    , dcCoeff(.999f)
+    , wasOversampling(false)
+{
+    // the tables are built here and not on the audio thread
+    DspTables::get();
+}
+
+FxWaveshaper::~FxWaveshaper() {}
+
+void FxWaveshaper::prepare(int channelsIn, double sampleRateIn)
+{
+    state.assign(static_cast<size_t>(channelsIn), Channel());
+    dcCoeff = static_cast<float>(std::exp(-2. * double_Pi * 10. / sampleRateIn));
+}
+
+void FxWaveshaper::reset()
+{
+    for (Channel& ch : state) {
+        ch = Channel();
+    }
+}
+
+int FxWaveshaper::getTailSamples() const
+{
+    return params.shaperOversampling.getStep() == eOnOffToggle::eOn ? HalfbandInterpolator::numInputs + HalfbandDecimator::numTaps : 0;
+}
+
+int64 FxWaveshaper::getMemoryBytes() const
+{
+    return static_cast<int64>(sizeof(FxWaveshaper) + state.capacity() * sizeof(Channel));
+}
+
+void FxWaveshaper::process(AudioSampleBuffer& outputBuffer, int startSample, int numSamples)
+{
+    const ParamSnapshot& snap = params.getSnapshot();
+    const float* table = DspTables::get().shaperCurves[static_cast<size_t>(snap.shaperCurve)].data();
+    const bool asymmetric = snap.shaperCurve == eShaperCurve::eAsymmetric;
+    const bool oversampling = snap.shaperOversampling;
+    if (oversampling != wasOversampling) {
+        reset();
+        wasOversampling = oversampling;
+    }
+
+    const int numChannels = jmin(outputBuffer.getNumChannels(), static_cast<int>(state.size()));
+    for (int c = 0; c < numChannels; ++c) {
+        SYNISTER_SCOPE_FINE("waveshaper channel");
+        Channel& ch = state[static_cast<size_t>(c)];
+        for (int done = 0; done < numSamples; done += maxSegmentLength) {
+            const int n = jmin(static_cast<int>(maxSegmentLength), numSamples - done);
+            float* io = outputBuffer.getWritePointer(c, startSample + done);
+            if (oversampling) {
+                float up[2 * maxSegmentLength];
+                ch.up.process(io, up, n);
+                shape(table, up, snap.shaperDrive, 2 * n);
+                ch.down.process(up, io, n);
+            } else {
+                shape(table, io, snap.shaperDrive, n);
+            }
+            if (asymmetric) {
+                blockDc(ch, io, n);
+            }
+        }
+        Denormals::flush(ch.dcY1);
+    }
+}
+
+void FxWaveshaper::shape(const float* table, float* samples, float drive, int n)
+{
+    // table position of x is (x + range) * scale
+    const float scale = DspTables::shaperTableSize / (2.f * DspTables::shaperRange);
+    const float maxPosition = static_cast<float>(DspTables::shaperTableSize);
+
+    int index[maxSegmentLength * 2];
+    float frac[maxSegmentLength * 2];
+    for (int s = 0; s < n; ++s) {
+        const float position = jlimit(0.f, maxPosition, (samples[s] * drive + DspTables::shaperRange) * scale);
+        index[s] = static_cast<int>(position);
+        frac[s] = position - static_cast<float>(index[s]);
+    }
+
+    float y1[maxSegmentLength * 2];
+    float y2[maxSegmentLength * 2];
+    for (int s = 0; s < n; ++s) {
+        y1[s] = table[index[s]];
+        y2[s] = table[index[s] + 1];
+    }
+    for (int s = 0; s < n; ++s) {
+        samples[s] = y1[s] + (y2[s] - y1[s]) * frac[s];
+    }
+}
+
+void FxWaveshaper::blockDc(Channel& ch, float* samples, int n) const
+{
+    float x1 = ch.dcX1;
+    float y1 = ch.dcY1;
+    for (int s = 0; s < n; ++s) {
+        const float x = samples[s];
+        y1 = x - x1 + dcCoeff * y1;
+        x1 = x;
+        samples[s] = y1;
+    }
+    ch.dcX1 = x1;
+    ch.dcY1 = y1;
+}
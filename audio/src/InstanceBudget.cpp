@@ -0,0 +1,138 @@
+/*
+  ==============================================================================
+
+    InstanceBudget.cpp
+    Created: 16 Oct 2026 10:31:44pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "InstanceBudget.h"
+
+InstanceBudget::InstanceBudget()
+    : numSlots(0)
+    , numYielded(0)
+    , cores(static_cast<float>(jmax(1, SystemStats::getNumCpus())))
+{
+    for (Slot& s : slots) {
+        s.used.store(false);
+        s.reporting.store(false);
+        s.load.store(0.f);
+        s.activeVoices.store(0);
+        s.releasingVoices.store(0);
+        s.rms.store(0.f);
+        s.updated.store(0);
+    }
+}
+
+int InstanceBudget::acquire()
+{
+    for (int i = 0; i < maxInstances; ++i) {
+        bool expected = false;
+        if (slots[i].used.compare_exchange_strong(expected, true)) {
+            slots[i].reporting.store(false);
+            int n = numSlots.load();
+            while (n < i + 1 && !numSlots.compare_exchange_weak(n, i + 1)) {}
+            return i;
+        }
+    }
+    return -1;
+}
+
+void InstanceBudget::release(int slot)
+{
+    if (slot >= 0) {
+        slots[slot].reporting.store(false);
+        slots[slot].used.store(false);
+    }
+}
+
+void InstanceBudget::report(int slot, float load, int activeVoices, int releasingVoices, float rms)
+{
+    if (slot < 0) {
+        return;
+    }
+    Slot& s = slots[slot];
+    s.load.store(load, std::memory_order_relaxed);
+    s.activeVoices.store(activeVoices, std::memory_order_relaxed);
+    s.releasingVoices.store(releasingVoices, std::memory_order_relaxed);
+    s.rms.store(rms, std::memory_order_relaxed);
+    s.updated.store(Time::getMillisecondCounter(), std::memory_order_relaxed);
+    s.reporting.store(true, std::memory_order_release);
+}
+
+void InstanceBudget::withdraw(int slot)
+{
+    if (slot >= 0) {
+        slots[slot].reporting.store(false, std::memory_order_relaxed);
+    }
+}
+
+bool InstanceBudget::isCounted(const Slot& s, uint32 now) const
+{
+    return s.used.load(std::memory_order_relaxed) && s.reporting.load(std::memory_order_acquire)
+        && now - s.updated.load(std::memory_order_relaxed) < staleMs;
+}
+
+bool InstanceBudget::shouldYield(int slot) const
+{
+    if (slot < 0 || slots[slot].releasingVoices.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+
+    const uint32 now = Time::getMillisecondCounter();
+    const int n = numSlots.load(std::memory_order_relaxed);
+    int voices = 0;
+    float load = 0.f;
+    int quietest = -1;
+    float quietestRms = 0.f;
+    for (int i = 0; i < n; ++i) {
+        const Slot& s = slots[i];
+        if (!isCounted(s, now)) {
+            continue;
+        }
+        voices += s.activeVoices.load(std::memory_order_relaxed);
+        load += s.load.load(std::memory_order_relaxed);
+        const float rms = s.rms.load(std::memory_order_relaxed);
+        // the lower slot wins a tie, so two instances never both yield for it
+        if (s.releasingVoices.load(std::memory_order_relaxed) > 0 && (quietest < 0 || rms < quietestRms)) {
+            quietest = i;
+            quietestRms = rms;
+        }
+    }
+    return quietest == slot && (voices > maxVoices || load > highLoad * cores);
+}
+
+int InstanceBudget::getNumInstances() const
+{
+    const uint32 now = Time::getMillisecondCounter();
+    const int n = numSlots.load(std::memory_order_relaxed);
+    int instances = 0;
+    for (int i = 0; i < n; ++i) {
+        instances += isCounted(slots[i], now) ? 1 : 0;
+    }
+    return instances;
+}
+
+int InstanceBudget::getTotalVoices() const
+{
+    const uint32 now = Time::getMillisecondCounter();
+    const int n = numSlots.load(std::memory_order_relaxed);
+    int voices = 0;
+    for (int i = 0; i < n; ++i) {
+        voices += isCounted(slots[i], now) ? slots[i].activeVoices.load(std::memory_order_relaxed) : 0;
+    }
+    return voices;
+}
+
+float InstanceBudget::getTotalLoad() const
+{
+    const uint32 now = Time::getMillisecondCounter();
+    const int n = numSlots.load(std::memory_order_relaxed);
+    float load = 0.f;
+    for (int i = 0; i < n; ++i) {
+        load += isCounted(slots[i], now) ? slots[i].load.load(std::memory_order_relaxed) : 0.f;
+    }
+    return load / cores;
+}
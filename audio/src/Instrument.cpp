@@ -0,0 +1,67 @@
+/*
+  ==============================================================================
+
+    Instrument.cpp
+    Created: 15 Oct 2026 9:40:05am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "Instrument.h"
+
+#if SYNISTER_INSTRUMENT
+#include <array>
+
+namespace {
+    std::array<std::atomic<Instrument::Counter*>, Instrument::maxCounters> counters {};
+    std::atomic<int> numCounters(0);
+}
+
+Instrument::Counter::Counter(const char* n)
+    : name(n)
+    , value(0)
+    , lastBlock(0)
+{
+    const int index = numCounters.fetch_add(1);
+    if (index < maxCounters) {
+        counters[static_cast<size_t>(index)].store(this, std::memory_order_release);
+    } else {
+        // counts, but appears neither in the trace nor in the log
+        jassertfalse;
+    }
+}
+
+void Instrument::endBlock()
+{
+    const int n = jmin(numCounters.load(std::memory_order_relaxed), static_cast<int>(maxCounters));
+    const bool tracing = Trace::isRecording();
+    const int64 now = tracing ? Time::getHighResolutionTicks() : 0;
+    for (int i = 0; i < n; ++i) {
+        Counter* c = counters[static_cast<size_t>(i)].load(std::memory_order_acquire);
+        if (c == nullptr) {
+            // claimed the slot but not stored yet
+            continue;
+        }
+        c->lastBlock = c->value.exchange(0, std::memory_order_relaxed);
+        if (tracing) {
+            Trace::recordCounter(c->name, now, c->lastBlock);
+        }
+    }
+}
+
+int Instrument::getBlockCounters(const char** names, int64* values, int maxValues)
+{
+    const int n = jmin(numCounters.load(std::memory_order_relaxed), static_cast<int>(maxCounters));
+    int written = 0;
+    for (int i = 0; i < n && written < maxValues; ++i) {
+        const Counter* c = counters[static_cast<size_t>(i)].load(std::memory_order_acquire);
+        if (c != nullptr && c->lastBlock != 0) {
+            names[written] = c->name;
+            values[written] = c->lastBlock;
+            ++written;
+        }
+    }
+    return written;
+}
+#endif
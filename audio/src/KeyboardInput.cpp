@@ -0,0 +1,151 @@
+/*
+  ==============================================================================
+
+    KeyboardInput.cpp
+    Created: 15 Oct 2026 6:48:05am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "KeyboardInput.h"
+
+KeyboardInput::KeyboardInput(MidiKeyboardState& s)
+    : state(s)
+    , fifo(queueSize)
+    , showingNotes(false)
+{
+    for (std::atomic<uint32>& word : notesOn) {
+        word.store(0, std::memory_order_relaxed);
+    }
+    std::fill(shownNotes.begin(), shownNotes.end(), 0u);
+    state.addListener(this);
+}
+
+KeyboardInput::~KeyboardInput()
+{
+    state.removeListener(this);
+}
+
+void KeyboardInput::markNote(const MidiMessage& m)
+{
+    if (m.isNoteOn()) {
+        setNote(m.getNoteNumber(), true);
+    } else if (m.isNoteOff()) {
+        setNote(m.getNoteNumber(), false);
+    } else if (m.isAllNotesOff() || m.isAllSoundOff()) {
+        for (std::atomic<uint32>& word : notesOn) {
+            word.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+void KeyboardInput::processNextMidiBuffer(const MidiBuffer& midi, MidiEventList& generated, int startSample, int numSamples)
+{
+    // the notes of the host and the sequencer are shown, the ones of the keyboard are shown already
+    MidiBuffer::Iterator it(midi);
+    MidiMessage m;
+    int position;
+    while (it.getNextEvent(m, position)) {
+        if (position >= startSample + numSamples) {
+            break;
+        }
+        markNote(m);
+    }
+    for (int i = 0; i < generated.size(); ++i) {
+        int size;
+        const uint8* data = generated.getEvent(i, size, position);
+        if (position < startSample + numSamples) {
+            markNote(MidiMessage(data, size));
+        }
+    }
+
+    int start1, size1, start2, size2;
+    fifo.prepareToRead(fifo.getNumReady(), start1, size1, start2, size2);
+    for (int i = 0; i < size1 + size2; ++i) {
+        const KeyEvent& e = queue[static_cast<size_t>(i < size1 ? start1 + i : start2 + i - size1)];
+        if (e.velocity > 0) {
+            generated.addEvent(MidiMessage::noteOn(e.channel, e.note, e.velocity), startSample);
+        } else {
+            generated.addEvent(MidiMessage::noteOff(e.channel, e.note), startSample);
+        }
+    }
+    fifo.finishedRead(size1 + size2);
+}
+
+void KeyboardInput::updateKeyboard()
+{
+    showingNotes = true;
+    for (size_t w = 0; w < notesOn.size(); ++w) {
+        const uint32 now = notesOn[w].load(std::memory_order_relaxed);
+        const uint32 changed = now ^ shownNotes[w];
+        if (changed == 0) {
+            continue;
+        }
+        for (int b = 0; b < 32; ++b) {
+            if ((changed & (1u << b)) != 0) {
+                const int note = static_cast<int>(w) * 32 + b;
+                if ((now & (1u << b)) != 0) {
+                    state.noteOn(1, note, 1.f);
+                } else {
+                    state.noteOff(1, note, 0.f);
+                }
+            }
+        }
+        shownNotes[w] = now;
+    }
+    showingNotes = false;
+}
+
+bool KeyboardInput::isNoteOn(int note) const
+{
+    return isPositiveAndBelow(note, 128)
+        && (notesOn[static_cast<size_t>(note >> 5)].load(std::memory_order_relaxed) & (1u << (note & 31))) != 0;
+}
+
+void KeyboardInput::handleNoteOn(MidiKeyboardState*, int midiChannel, int midiNoteNumber, float velocity)
+{
+    if (showingNotes) {
+        return;
+    }
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite(1, start1, size1, start2, size2);
+    // a full queue drops the note, the audio thread is not running then
+    if (size1 > 0) {
+        KeyEvent& e = queue[static_cast<size_t>(start1)];
+        e.channel = static_cast<uint8>(midiChannel);
+        e.note = static_cast<uint8>(midiNoteNumber);
+        e.velocity = static_cast<uint8>(jlimit(1, 127, roundToInt(velocity * 127.f)));
+        fifo.finishedWrite(1);
+    }
+}
+
+void KeyboardInput::handleNoteOff(MidiKeyboardState*, int midiChannel, int midiNoteNumber, float)
+{
+    if (showingNotes) {
+        return;
+    }
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite(1, start1, size1, start2, size2);
+    if (size1 > 0) {
+        KeyEvent& e = queue[static_cast<size_t>(start1)];
+        e.channel = static_cast<uint8>(midiChannel);
+        e.note = static_cast<uint8>(midiNoteNumber);
+        e.velocity = 0;
+        fifo.finishedWrite(1);
+    }
+}
+
+void KeyboardInput::setNote(int note, bool on)
+{
+    if (!isPositiveAndBelow(note, 128)) {
+        return;
+    }
+    std::atomic<uint32>& word = notesOn[static_cast<size_t>(note >> 5)];
+    const uint32 bit = 1u << (note & 31);
+    if (on) {
+        word.fetch_or(bit, std::memory_order_relaxed);
+    } else {
+        word.fetch_and(~bit, std::memory_order_relaxed);
+    }
+}
@@ -9,23 +9,78 @@
 */
 
 #include "LowFidelity.h"
+#include "Instrument.h"
+#include "SimdKernels.h"
 
 LowFidelity::~LowFidelity() {};
 
-void LowFidelity::bitReduction(AudioSampleBuffer& outputBuffer)
+void LowFidelity::prepare(int numChannels, double sampleRate)
 {
+    ignoreUnused(sampleRate);
+    heldValues.assign(static_cast<size_t>(numChannels), 0.f);
+    holdPhase = 0.f;
+}
+
+void LowFidelity::reset()
+{
+    std::fill(heldValues.begin(), heldValues.end(), 0.f);
+    holdPhase = 0.f;
+}
+
+void LowFidelity::process(AudioSampleBuffer& buffer, int startSample, int numSamples)
+{
+    if (params.getSnapshot().lowFiDownsample > 1.f) {
+        sampleRateReduction(buffer, startSample, numSamples);
+    }
+    bitReduction(buffer, startSample, numSamples);
+}
+
+void LowFidelity::bitReduction(AudioSampleBuffer& outputBuffer, int startSample, int numSamples)
+{
+    SYNISTER_SCOPE_FINE("bit reduction");
     // coeff = 2^(nBitsLowFi-1)
-    float coeff = pow(2.f, params.nBitsLowFi.get() - 1.f);
+    const float coeff = pow(2.f, params.getSnapshot().nBitsLowFi - 1.f);
+    const float invCoeff = 1.f / coeff;
+    const SimdKernels& kernels = SimdKernels::get();
 
     //For all the outputs
     for (int c = 0; c < outputBuffer.getNumChannels(); ++c)
     {
-        // Bit degradation
-        for (int s = 0; s < outputBuffer.getNumSamples(); ++s)
+        // Bit degradation: scale, round to the nearest step, scale back
+        kernels.quantize(outputBuffer.getWritePointer(c, startSample), coeff, invCoeff, numSamples);
+    }
+}
+
+void LowFidelity::sampleRateReduction(AudioSampleBuffer& outputBuffer, int startSample, int numSamples)
+{
+    SYNISTER_SCOPE_FINE("sample rate reduction");
+    const float factor = params.getSnapshot().lowFiDownsample;
+    const int numChannels = jmin(outputBuffer.getNumChannels(), static_cast<int>(heldValues.size()));
+
+    float endPhase = holdPhase;
+    for (int c = 0; c < numChannels; ++c)
+    {
+        float* samples = outputBuffer.getWritePointer(c, startSample);
+        float held = heldValues[static_cast<size_t>(c)];
+        float phase = holdPhase;
+
+        int s = 0;
+        while (s < numSamples)
         {
-            float newSampleVal = floor(coeff * (outputBuffer.getSample(c, s)) + 0.5f) / coeff;
-            outputBuffer.setSample(c, s, newSampleVal);
+            if (phase <= 0.f) {
+                // take a new value
+                held = samples[s];
+                phase += factor;
+            }
+            // the value is held up to the next one, filled in one go
+            const int hold = jmin(numSamples - s, static_cast<int>(std::ceil(phase)));
+            FloatVectorOperations::fill(samples + s, held, hold);
+            phase -= static_cast<float>(hold);
+            s += hold;
         }
 
+        heldValues[static_cast<size_t>(c)] = held;
+        endPhase = phase;
     }
+    holdPhase = endPhase;
 }
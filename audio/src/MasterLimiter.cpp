@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    MasterLimiter.cpp
+    Created: 16 Oct 2026 9:52:18pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "MasterLimiter.h"
+#include <cmath>
+
+void MasterLimiter::prepare(int numChannels, double sampleRate)
+{
+    lookahead = jmax(1, static_cast<int>(lookaheadTime * sampleRate + .5));
+    releaseCoeff = static_cast<float>(1. - std::exp(-1. / (releaseTime * sampleRate)));
+    delay.setSize(numChannels, lookahead);
+    window.assign(static_cast<size_t>(lookahead + 1), Held());
+    gainHistory.assign(static_cast<size_t>(lookahead + 1), 1.f);
+    reset();
+}
+
+void MasterLimiter::reset()
+{
+    delay.clear();
+    std::fill(gainHistory.begin(), gainHistory.end(), 1.f);
+    pos = 0;
+    historyPos = 0;
+    sampleCount = 0;
+    heldGain = 1.f;
+    gainSum = static_cast<double>(gainHistory.size());
+    head = 0;
+    size = 0;
+}
+
+void MasterLimiter::process(AudioSampleBuffer& buffer, float ceiling)
+{
+    const int numChannels = jmin(buffer.getNumChannels(), delay.getNumChannels());
+    const int numSamples = buffer.getNumSamples();
+    const int capacity = static_cast<int>(window.size());
+    const double historyLength = static_cast<double>(gainHistory.size());
+    float* const* io = buffer.getArrayOfWritePointers();
+    float* const* d = delay.getArrayOfWritePointers();
+
+    for (int s = 0; s < numSamples; ++s) {
+        float peak = 0.f;
+        for (int c = 0; c < numChannels; ++c) {
+            peak = jmax(peak, std::abs(io[c][s]));
+        }
+        const float required = peak > ceiling ? ceiling / peak : 1.f;
+
+        // the sliding window minimum of the gains of the lookahead, the newest sample at the back
+        while (size > 0 && window[static_cast<size_t>((head + size - 1) % capacity)].gain >= required) {
+            --size;
+        }
+        window[static_cast<size_t>((head + size) % capacity)] = { required, sampleCount + lookahead + 1 };
+        ++size;
+        while (window[static_cast<size_t>(head)].expires <= sampleCount) {
+            head = (head + 1) % capacity;
+            --size;
+        }
+        const float minimum = window[static_cast<size_t>(head)].gain;
+        heldGain = minimum < heldGain ? minimum : heldGain + (minimum - heldGain) * releaseCoeff;
+
+        // the average over the lookahead ramps into every reduction before its peak leaves the delay
+        gainSum += heldGain - gainHistory[static_cast<size_t>(historyPos)];
+        gainHistory[static_cast<size_t>(historyPos)] = heldGain;
+        if (++historyPos == static_cast<int>(gainHistory.size())) {
+            historyPos = 0;
+            // once per window, the running sum does not drift
+            gainSum = 0.;
+            for (float g : gainHistory) {
+                gainSum += g;
+            }
+        }
+        const float gain = static_cast<float>(gainSum / historyLength);
+
+        for (int c = 0; c < numChannels; ++c) {
+            const float x = io[c][s];
+            io[c][s] = d[c][pos] * gain;
+            d[c][pos] = x;
+        }
+        pos = pos + 1 == lookahead ? 0 : pos + 1;
+        ++sampleCount;
+    }
+}
+
+int64 MasterLimiter::getMemoryBytes() const
+{
+    return static_cast<int64>(delay.getNumChannels()) * delay.getNumSamples() * static_cast<int64>(sizeof(float))
+        + static_cast<int64>(window.size() * sizeof(Held) + gainHistory.size() * sizeof(float));
+}
@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+
+    MasterOutput.cpp
+    Created: 15 Oct 2026 5:40:18am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "MasterOutput.h"
+
+void MasterOutput::prepare(int numChannels, double sampleRate)
+{
+    channelState.assign(static_cast<size_t>(numChannels), ChannelState());
+    rampSamples = jmax(1, static_cast<int>(smoothingTime * sampleRate));
+}
+
+void MasterOutput::process(AudioSampleBuffer& buffer, float gain, float pan)
+{
+    const int numChannels = jmin(buffer.getNumChannels(), static_cast<int>(channelState.size()));
+    const int numSamples = buffer.getNumSamples();
+    const bool meter = meteringEnabled.load(std::memory_order_relaxed);
+
+    // Constant power pan, scaled so the centre keeps the .5 per channel of the former linear pan
+    float panGain[2] = { 1.f, 1.f };
+    if (numChannels == 2) {
+        const float halfSqrt2 = .70710678f;
+        const float p = float_Pi * (pan + 1.f) / 4.f;
+        panGain[0] = halfSqrt2 * std::cos(p);
+        panGain[1] = halfSqrt2 * std::sin(p);
+    }
+
+    for (int c = 0; c < numChannels; ++c) {
+        ChannelState& state = channelState[static_cast<size_t>(c)];
+        const float target = gain * (c < 2 ? panGain[c] : 1.f);
+        if (state.remaining < 0) {
+            state.gain = target;
+            state.target = target;
+            state.remaining = 0;
+        } else if (target != state.target) {
+            // a new ramp from the current gain, also during a ramp
+            state.target = target;
+            state.step = (target - state.gain) / static_cast<float>(rampSamples);
+            state.remaining = rampSamples;
+        }
+
+        float blockPeak = 0.f;
+        float sumSquares = 0.f;
+        float* io = buffer.getWritePointer(c, 0);
+        if (meter) {
+            applyGain<true>(io, numSamples, state, blockPeak, sumSquares);
+        } else {
+            applyGain<false>(io, numSamples, state, blockPeak, sumSquares);
+        }
+
+        if (meter && c < numMeters && numSamples > 0) {
+            peak[c].store(blockPeak, std::memory_order_relaxed);
+            rms[c].store(std::sqrt(sumSquares / static_cast<float>(numSamples)), std::memory_order_relaxed);
+        }
+    }
+}
+
+template<bool _meter>
+void MasterOutput::applyGain(float* io, int numSamples, ChannelState& state, float& peakOut, float& sumSquares)
+{
+    float blockPeak = 0.f;
+    float sum = 0.f;
+
+    // ramp
+    const int ramp = jmin(numSamples, state.remaining);
+    float g = state.gain;
+    for (int s = 0; s < ramp; ++s) {
+        g += state.step;
+        const float y = io[s] * g;
+        io[s] = y;
+        if (_meter) {
+            blockPeak = jmax(blockPeak, std::abs(y));
+            sum += y * y;
+        }
+    }
+    state.remaining -= ramp;
+    // the end of the ramp is exact
+    state.gain = state.remaining == 0 ? state.target : g;
+
+    // constant gain for the rest of the block
+    const float constantGain = state.gain;
+    for (int s = ramp; s < numSamples; ++s) {
+        const float y = io[s] * constantGain;
+        io[s] = y;
+        if (_meter) {
+            blockPeak = jmax(blockPeak, std::abs(y));
+            sum += y * y;
+        }
+    }
+
+    peakOut = blockPeak;
+    sumSquares = sum;
+}
@@ -0,0 +1,147 @@
+/*
+  ==============================================================================
+
+    MidiClock.cpp
+    Created: 17 Oct 2026 7:26:44pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "MidiClock.h"
+#include <cmath>
+
+const double MidiClock::phaseGain = 1.41421356 * 2. * double_Pi * .01;
+const double MidiClock::periodGain = (2. * double_Pi * .01) * (2. * double_Pi * .01);
+
+MidiClock::MidiClock()
+    : sampleRate(44100.)
+    , blockStart(0)
+    , lastBlockStart(0)
+    , period(0.)
+    , nextTick(0.)
+    , lastArrival(-1)
+    , ticksInRow(0)
+    , locked(false)
+    , running(false)
+    , songPosition(0)
+    , ticksPlayed(0)
+{
+}
+
+void MidiClock::prepare(double _sampleRate)
+{
+    sampleRate = _sampleRate;
+    blockStart = 0;
+    lastBlockStart = 0;
+    running = false;
+    songPosition = 0;
+    ticksPlayed = 0;
+    lose();
+}
+
+void MidiClock::lose()
+{
+    period = 0.;
+    nextTick = 0.;
+    lastArrival = -1;
+    ticksInRow = 0;
+    locked = false;
+}
+
+void MidiClock::process(const MidiBuffer& midiMessages, int numSamples)
+{
+    MidiBuffer::Iterator it(midiMessages);
+    const uint8* data;
+    int size;
+    int pos;
+    while (it.getNextEvent(data, size, pos)) {
+        switch (data[0]) {
+        case 0xf8:
+            tick(blockStart + pos);
+            break;
+        case 0xfa:
+            running = true;
+            songPosition = 0;
+            ticksPlayed = 0;
+            break;
+        case 0xfb:
+            running = true;
+            ticksPlayed = 0;
+            break;
+        case 0xfc:
+            // the position stays where the clock stopped, a continue goes on from there
+            running = false;
+            songPosition += ticksPlayed;
+            ticksPlayed = 0;
+            break;
+        case 0xf2:
+            if (size >= 3 && !running) {
+                songPosition = static_cast<int64>((data[1] & 0x7f) | ((data[2] & 0x7f) << 7)) * ticksPerSongPosition;
+                ticksPlayed = 0;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    lastBlockStart = blockStart;
+    blockStart += numSamples;
+
+    // gear that stops its clock, or a cable pulled
+    if (lastArrival >= 0) {
+        const double timeout = period > 0. ? timeoutTicks * period : .5 * sampleRate;
+        if (static_cast<double>(blockStart - lastArrival) > timeout) {
+            lose();
+        }
+    }
+}
+
+void MidiClock::tick(int64 time)
+{
+    if (running) {
+        ++ticksPlayed;
+    }
+
+    if (lastArrival < 0) {
+        lastArrival = time;
+        return;
+    }
+    const double interval = static_cast<double>(time - lastArrival);
+    lastArrival = time;
+
+    const double error = static_cast<double>(time) - nextTick;
+    if (period <= 0. || std::abs(error) > 2. * period) {
+        // the first interval, lost ticks or a tempo jump the loop would take long to follow
+        period = interval;
+        nextTick = static_cast<double>(time) + period;
+        ticksInRow = 1;
+        locked = false;
+        return;
+    }
+
+    nextTick += period + phaseGain * error;
+    period += periodGain * error;
+    if (++ticksInRow >= lockTicks) {
+        locked = true;
+    }
+}
+
+void MidiClock::fillPosition(AudioPlayHead::CurrentPositionInfo& info) const
+{
+    if (!locked) {
+        return;
+    }
+    info.bpm = 60. * sampleRate / (ticksPerBeat * period);
+
+    // ticks of the position the filtered phase gives for the block start, from the last tick
+    // the loop predicted, never ahead of the next tick if the clock stalls
+    const double lastTick = nextTick - period;
+    const double fraction = jmin(1., (static_cast<double>(lastBlockStart) - lastTick) / period);
+    const double ticks = static_cast<double>(songPosition + ticksPlayed - 1) + fraction;
+    info.ppqPosition = ticks / ticksPerBeat;
+    info.timeInSeconds = info.ppqPosition * 60. / info.bpm;
+    info.timeInSamples = static_cast<int64>(std::floor(info.timeInSeconds * sampleRate));
+    info.isPlaying = running;
+}
@@ -11,7 +11,11 @@
 #include "ModulationMatrix.h"
 
 ModulationMatrix::ModulationMatrix()
+    : numCompiledRoutes(0)
+    , usedSources(0)
+    , targetedDestinations(0)
 {
+    static_assert(static_cast<int>(eModSource::nSteps) <= 32 && MAX_DESTINATIONS <= 32, "the route masks have a bit per source and destination");
     // assertions for how the Voices and filters work
     jassert(DEST_OSC1_GAIN + 1 == DEST_OSC2_GAIN);
     jassert(DEST_OSC1_GAIN + 2 == DEST_OSC3_GAIN);
@@ -0,0 +1,214 @@
+/*
+  ==============================================================================
+
+    NoteCache.cpp
+    Created: 15 Oct 2026 4:12:37pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "NoteCache.h"
+#include "Instrument.h"
+
+namespace {
+    //! the sources that change while a note plays, or from one note to the next without the note and the velocity
+    const eModSource liveSources[] = {
+        eModSource::eAftertouch, eModSource::eFoot, eModSource::eExpPedal, eModSource::eModwheel,
+        eModSource::ePitchbend, eModSource::eNotePitch, eModSource::eNotePressure, eModSource::eNoteTimbre
+    };
+}
+
+void PatchState::prepare(const SynthParams& params)
+{
+    lastSnapshot.calloc(sizeof(ParamSnapshot));
+    lastValues.assign(params.serializeParams.size(), 0.f);
+    lastSamples.fill(nullptr);
+}
+
+bool PatchState::hasChanged(const SynthParams& params)
+{
+    bool changed = false;
+    const char* snap = reinterpret_cast<const char*>(&params.getSnapshot());
+    if (std::memcmp(lastSnapshot.getData(), snap, sizeof(ParamSnapshot)) != 0) {
+        std::memcpy(lastSnapshot.getData(), snap, sizeof(ParamSnapshot));
+        changed = true;
+    }
+    for (size_t p = 0; p < lastValues.size(); ++p) {
+        const float value = params.serializeParams[p]->get();
+        if (value != lastValues[p]) {
+            lastValues[p] = value;
+            changed = true;
+        }
+    }
+    for (size_t o = 0; o < lastSamples.size(); ++o) {
+        const MappedSample* sample = params.osc[o].sample.get();
+        if (sample != lastSamples[o]) {
+            lastSamples[o] = sample;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+bool PatchState::hasLiveModulation(const SynthParams& params)
+{
+    bool live = false;
+    for (eModSource source : liveSources) {
+        live = live || params.isModSourceRead(source);
+    }
+    const ParamSnapshot& snap = params.getSnapshot();
+    for (size_t l = 0; l < snap.lfo.size(); ++l) {
+        live = live || (snap.lfo[l].global && params.isModSourceRead(static_cast<eModSource>(eModSource::eLFO1 + l)));
+    }
+    return live;
+}
+
+//==============================================================================
+NoteCache::NoteCache()
+    : capacity(0)
+    , useCounter(0)
+    , active(false)
+    , readsVelocity(true)
+{
+}
+
+void NoteCache::prepare(const SynthParams& params, int numChannels, double sampleRate)
+{
+    capacity = static_cast<int>(maxSeconds * sampleRate);
+    takes.clear();
+    for (int t = 0; t < numTakes; ++t) {
+        Take* take = takes.add(new Take());
+        take->note = -1;
+        take->velocity = -1;
+        take->length = 0;
+        take->release = -1;
+        take->complete = false;
+        take->users = 0;
+        take->lastUse = 0;
+        take->audio.setSize(numChannels, capacity);
+    }
+
+    // the first update() compares with this state, it matches no block
+    lastState.prepare(params);
+    active = false;
+}
+
+void NoteCache::release()
+{
+    takes.clear();
+    active = false;
+}
+
+void NoteCache::update(const SynthParams& params)
+{
+    if (takes.size() == 0) {
+        active = false;
+        return;
+    }
+    if (lastState.hasChanged(params)) {
+        invalidate();
+    }
+
+    const ParamSnapshot::Env& envVol = params.getSnapshot().envVol[0];
+    const bool qualifies = !PatchState::hasLiveModulation(params) && envVol.attack + envVol.decay + envVol.release < maxSeconds;
+
+    readsVelocity = params.isModSourceRead(eModSource::eVelocity) || params.isModSourceRead(eModSource::eInvertedVelocity);
+    active = qualifies;
+}
+
+NoteCache::Take* NoteCache::acquire(int note, float velocity, bool& play)
+{
+    const int key = readsVelocity ? roundToInt(velocity * 127.f) : -1;
+    ++useCounter;
+
+    // the longest hold covers the most hits before they move on
+    Take* played = nullptr;
+    for (Take* take : takes) {
+        if (take->complete && take->note == note && take->velocity == key
+            && (played == nullptr || take->release > played->release)) {
+            played = take;
+        }
+    }
+    play = played != nullptr;
+    if (!play) {
+        return record(note, key);
+    }
+    SYNISTER_COUNT("note cache hits", 1);
+    ++played->users;
+    played->lastUse = useCounter;
+    return played;
+}
+
+NoteCache::Take* NoteCache::acquireRecording(int note, float velocity)
+{
+    ++useCounter;
+    return record(note, readsVelocity ? roundToInt(velocity * 127.f) : -1);
+}
+
+NoteCache::Take* NoteCache::acquireNext(const Take* played, int position, bool released)
+{
+    Take* next = nullptr;
+    for (Take* take : takes) {
+        if (take == played || !take->complete || take->note != played->note || take->velocity != played->velocity) {
+            continue;
+        }
+        if (released ? take->release == position
+                     : take->release > position && (next == nullptr || take->release > next->release)) {
+            next = take;
+        }
+    }
+    if (next != nullptr) {
+        SYNISTER_COUNT("note cache hits", 1);
+        ++next->users;
+        next->lastUse = ++useCounter;
+    }
+    return next;
+}
+
+NoteCache::Take* NoteCache::record(int note, int key)
+{
+    Take* oldest = nullptr;
+    for (Take* take : takes) {
+        // an unused take, the empty ones first
+        if (take->users == 0 && (oldest == nullptr || take->lastUse < oldest->lastUse)) {
+            oldest = take;
+        }
+    }
+    if (oldest == nullptr) {
+        return nullptr;
+    }
+    oldest->note = note;
+    oldest->velocity = key;
+    oldest->length = 0;
+    oldest->release = -1;
+    oldest->complete = false;
+    oldest->users = 1;
+    oldest->lastUse = useCounter;
+    return oldest;
+}
+
+void NoteCache::releaseTake(Take* take, bool complete)
+{
+    jassert(take->users.load() > 0);
+    --take->users;
+    if (take->note < 0) {
+        // dropped by invalidate() while in use
+        take->complete = false;
+    } else if (!take->complete) {
+        // the recording voice, a note is complete once it was released
+        take->complete = complete && take->release >= 0;
+        if (!take->complete) {
+            take->note = -1;
+        }
+    }
+}
+
+void NoteCache::invalidate()
+{
+    for (Take* take : takes) {
+        take->note = -1;
+        take->complete = false;
+        take->lastUse = 0;
+    }
+}
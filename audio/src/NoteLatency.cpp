@@ -0,0 +1,184 @@
+/*
+  ==============================================================================
+
+    NoteLatency.cpp
+    Created: 16 Oct 2026 7:35:12pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "NoteLatency.h"
+#include "Voice.h"
+#include <cmath>
+#include <limits>
+
+NoteLatency::NoteLatency()
+    : sampleRate(44100.)
+    , blockPosition(0)
+    , blockStartTicks(0)
+    , blockSize(0)
+    , renderPosition(0)
+    , outputLatency(0)
+    , numPending(0)
+    , numTracked(0)
+    , numNotes(0)
+    , numSilent(0)
+    , sumMs(0.)
+    , sumSquaresMs(0.)
+    , minMs(std::numeric_limits<double>::max())
+    , maxMs(0.)
+    , numStarts(0)
+    , sumStartMs(0.)
+    , maxStartMs(0.)
+    , sumEventOffset(0.)
+    , resetRequested(false)
+{
+}
+
+void NoteLatency::prepare(double newSampleRate)
+{
+    jassert(newSampleRate > 0.);
+    sampleRate = newSampleRate;
+    blockPosition = 0;
+    numPending = 0;
+    numTracked = 0;
+}
+
+void NoteLatency::beginBlock(const MidiBuffer& midi, int numSamples, int64 callbackStartTicks, int outputLatencySamples)
+{
+    if (resetRequested.exchange(false)) {
+        numNotes = 0;
+        numSilent = 0;
+        sumMs = 0.;
+        sumSquaresMs = 0.;
+        minMs = std::numeric_limits<double>::max();
+        maxMs = 0.;
+        numStarts = 0;
+        sumStartMs = 0.;
+        maxStartMs = 0.;
+        sumEventOffset = 0.;
+    }
+
+    blockStartTicks = callbackStartTicks;
+    outputLatency = outputLatencySamples;
+    blockSize = numSamples;
+    renderPosition = 0;
+    numPending = 0;
+
+    MidiBuffer::Iterator it(midi);
+    MidiMessage m;
+    int pos;
+    while (numPending < maxPendingNotes && it.getNextEvent(m, pos)) {
+        if (m.isNoteOn()) {
+            pending[static_cast<size_t>(numPending++)] = { m.getChannel(), m.getNoteNumber(), pos };
+        }
+    }
+}
+
+void NoteLatency::noteStarted(Voice* voice, int midiChannel, int midiNoteNumber)
+{
+    const double startMs = 1000. * Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - blockStartTicks);
+    ++numStarts;
+    sumStartMs = sumStartMs + startMs;
+    if (startMs > maxStartMs) {
+        maxStartMs = startMs;
+    }
+
+    // the event of the note, a note without one, e.g. of a legato key going back, starts where it is rendered
+    int offset = renderPosition;
+    for (int i = 0; i < numPending; ++i) {
+        const PendingNote& p = pending[static_cast<size_t>(i)];
+        if (p.note == midiNoteNumber && p.channel == midiChannel) {
+            offset = p.offset;
+            std::copy(pending.begin() + i + 1, pending.begin() + numPending, pending.begin() + i);
+            --numPending;
+            break;
+        }
+    }
+    sumEventOffset = sumEventOffset + offset;
+
+    // a stolen voice ends the note it had in flight
+    int t = 0;
+    while (t < numTracked && tracked[static_cast<size_t>(t)].voice != voice) {
+        ++t;
+    }
+    if (t < numTracked) {
+        ++numSilent;
+    } else if (numTracked < maxTrackedNotes) {
+        ++numTracked;
+    } else {
+        ++numSilent;
+        return;
+    }
+    tracked[static_cast<size_t>(t)] = { voice, midiNoteNumber, blockPosition + offset };
+}
+
+void NoteLatency::voicesRendered(int endSample)
+{
+    renderPosition = endSample;
+    const int64 end = blockPosition + endSample + outputLatency;
+    int n = 0;
+    for (int t = 0; t < numTracked; ++t) {
+        const TrackedNote& note = tracked[static_cast<size_t>(t)];
+        if (!note.voice->isVoiceActive() || note.voice->getCurrentlyPlayingNote() != note.note) {
+            ++numSilent;
+        } else if (note.voice->hasTake() || note.voice->getLevel() > audibleLevel) {
+            // a take of the note cache starts at the level it was recorded with
+            addNote(1000. * static_cast<double>(end - note.eventPosition) / sampleRate);
+        } else {
+            tracked[static_cast<size_t>(n++)] = note;
+        }
+    }
+    numTracked = n;
+}
+
+void NoteLatency::endBlock()
+{
+    blockPosition += blockSize;
+    blockSize = 0;
+    renderPosition = 0;
+}
+
+void NoteLatency::addNote(double latencyMs)
+{
+    ++numNotes;
+    sumMs = sumMs + latencyMs;
+    sumSquaresMs = sumSquaresMs + latencyMs * latencyMs;
+    if (latencyMs < minMs) {
+        minMs = latencyMs;
+    }
+    if (latencyMs > maxMs) {
+        maxMs = latencyMs;
+    }
+}
+
+NoteLatency::Report NoteLatency::getReport() const
+{
+    Report r;
+    r.numNotes = numNotes;
+    r.numSilent = numSilent;
+    const double n = static_cast<double>(r.numNotes);
+    r.meanMs = n > 0. ? sumMs / n : 0.;
+    r.minMs = n > 0. ? minMs.load() : 0.;
+    r.maxMs = maxMs;
+    r.jitterMs = n > 1. ? std::sqrt(jmax(0., sumSquaresMs / n - r.meanMs * r.meanMs)) : 0.;
+    const int64 starts = numStarts;
+    r.meanStartMs = starts > 0 ? sumStartMs / static_cast<double>(starts) : 0.;
+    r.maxStartMs = maxStartMs;
+    r.meanEventOffset = starts > 0 ? sumEventOffset / static_cast<double>(starts) : 0.;
+    return r;
+}
+
+String NoteLatency::formatReport(const Report& r)
+{
+    String text;
+    text << "note latency: " << String(r.numNotes) << " notes, " << String(r.meanMs, 2) << " ms on average, "
+         << String(r.minMs, 2) << " to " << String(r.maxMs, 2) << " ms, jitter " << String(r.jitterMs, 2) << " ms";
+    if (r.numSilent > 0) {
+        text << ", " << String(r.numSilent) << " never audible";
+    }
+    text << "\nvoices start " << String(r.meanStartMs, 3) << " ms into the callback on average, "
+         << String(r.maxStartMs, 3) << " ms at most, events " << String(r.meanEventOffset, 1) << " samples into their blocks";
+    return text;
+}
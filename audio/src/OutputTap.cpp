@@ -0,0 +1,78 @@
+/*
+  ==============================================================================
+
+    OutputTap.cpp
+    Created: 15 Oct 2026 6:48:02am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "OutputTap.h"
+
+OutputTap::OutputTap()
+    : fifo(capacity)
+    , ring(static_cast<size_t>(capacity), true)
+    , enabled(false)
+    , rate(44100.f)
+    , decimation(1)
+    , sum(0.f)
+    , summed(0)
+{
+}
+
+void OutputTap::prepare(double sampleRate)
+{
+    decimation = jmax(1, static_cast<int>(sampleRate / minRate));
+    rate.store(static_cast<float>(sampleRate / decimation), std::memory_order_relaxed);
+    sum = 0.f;
+    summed = 0;
+}
+
+void OutputTap::push(const AudioSampleBuffer& buffer)
+{
+    if (!enabled.load(std::memory_order_relaxed)) {
+        sum = 0.f;
+        summed = 0;
+        return;
+    }
+
+    const int numChannels = jmin(buffer.getNumChannels(), 2);
+    const int numSamples = buffer.getNumSamples();
+    if (numChannels == 0) {
+        return;
+    }
+    const float *left = buffer.getReadPointer(0);
+    const float *right = buffer.getReadPointer(numChannels - 1);
+
+    // what does not fit is dropped, the reader is far behind anyway
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite((summed + numSamples) / decimation, start1, size1, start2, size2);
+    const int numWritten = size1 + size2;
+
+    const float gain = 1.f / static_cast<float>(2 * decimation);
+    int out = 0;
+    for (int s = 0; s < numSamples; ++s) {
+        sum += left[s] + right[s];
+        if (++summed < decimation) {
+            continue;
+        }
+        if (out < numWritten) {
+            ring[out < size1 ? start1 + out : start2 + out - size1] = sum * gain;
+        }
+        ++out;
+        sum = 0.f;
+        summed = 0;
+    }
+    fifo.finishedWrite(numWritten);
+}
+
+int OutputTap::read(float* dst, int maxSamples)
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToRead(maxSamples, start1, size1, start2, size2);
+    FloatVectorOperations::copy(dst, ring + start1, size1);
+    FloatVectorOperations::copy(dst + size1, ring + start2, size2);
+    fifo.finishedRead(size1 + size2);
+    return size1 + size2;
+}
@@ -0,0 +1,67 @@
+/*
+  ==============================================================================
+
+    Oversampler.cpp
+    Created: 14 Oct 2026 8:40:12pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "Oversampler.h"
+#include "DspTables.h"
+
+void HalfbandDecimator::reset()
+{
+    DspTables::get(); // built on first use, which is the construction of the voices
+    std::fill(history, history + 2 * numTaps, 0.f);
+    pos = 0;
+}
+
+void HalfbandInterpolator::reset()
+{
+    DspTables::get();
+    std::fill(history, history + 2 * numInputs, 0.f);
+    pos = 0;
+}
+
+void HalfbandInterpolator::process(const float *in, float *out, int numIn)
+{
+    const std::array<float, HalfbandDecimator::numOddTaps>& taps = DspTables::get().halfbandTaps;
+    const int mid = numInputs / 2;
+
+    for (int m = 0; m < numIn; ++m) {
+        push(in[m]);
+
+        // oldest input at w[0], newest at w[numInputs - 1]; the filtered sample lies half way
+        // between w[mid - 1] and w[mid], the copied one is w[mid]
+        const float *w = history + pos;
+        float y = 0.f;
+        for (int i = 0; i < HalfbandDecimator::numOddTaps; ++i) {
+            y += taps[i] * (w[mid + i] + w[mid - 1 - i]);
+        }
+        out[2 * m] = 2.f * y;
+        out[2 * m + 1] = w[mid];
+    }
+}
+
+void HalfbandDecimator::process(const float *in, float *out, int numOut)
+{
+    const std::array<float, numOddTaps>& taps = DspTables::get().halfbandTaps;
+
+    for (int m = 0; m < numOut; ++m) {
+        // read both inputs first, out may point to in
+        const float even = in[2 * m];
+        const float odd = in[2 * m + 1];
+        push(even);
+        push(odd);
+
+        // oldest input at w[0], newest at w[numTaps - 1]
+        const float *w = history + pos;
+        float y = .5f * w[centre];
+        for (int i = 0; i < numOddTaps; ++i) {
+            y += taps[i] * (w[centre - 1 - 2 * i] + w[centre + 1 + 2 * i]);
+        }
+        out[m] = y;
+    }
+}
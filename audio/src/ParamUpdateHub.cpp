@@ -0,0 +1,137 @@
+/*
+  ==============================================================================
+
+    ParamUpdateHub.cpp
+    Created: 15 Oct 2026 7:02:37am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "ParamUpdateHub.h"
+#include "Param.h"
+#include <algorithm>
+
+ParamUpdateHub::ParamUpdateHub()
+    : changed(nullptr)
+    , editorShowing(true)
+    , audioLoad(nullptr)
+    , throttleThreshold(nullptr)
+    , throttled(false)
+    , ticksBelowThreshold(0)
+{
+}
+
+ParamUpdateHub::~ParamUpdateHub()
+{
+    stopTimer();
+}
+
+void ParamUpdateHub::addListener(Param* p, Listener* l)
+{
+    const auto range = listeners.equal_range(p);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == l) {
+            return;
+        }
+    }
+    listeners.emplace(p, l);
+    p->setUpdateHub(this);
+    if (editorShowing && !isTimerRunning()) {
+        startTimerHz(throttled ? throttledRate : updateRate);
+    }
+}
+
+void ParamUpdateHub::removeListener(Listener* l)
+{
+    for (auto it = listeners.begin(); it != listeners.end();) {
+        if (it->second == l) {
+            it = listeners.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (listeners.empty()) {
+        stopTimer();
+    }
+}
+
+void ParamUpdateHub::setEditorShowing(bool showing)
+{
+    if (showing == editorShowing) {
+        return;
+    }
+    editorShowing = showing;
+    if (showing) {
+        if (!listeners.empty()) {
+            startTimerHz(throttled ? throttledRate : updateRate);
+        }
+        // the single resync of everything that changed while hidden
+        timerCallback();
+    } else {
+        stopTimer();
+    }
+    showingListeners.call(&ShowingListener::editorShowingChanged, showing);
+}
+
+void ParamUpdateHub::push(Param* p)
+{
+    Param* head = changed.load(std::memory_order_relaxed);
+    do {
+        p->updateNext_ = head;
+    } while (!changed.compare_exchange_weak(head, p, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void ParamUpdateHub::updateThrottling()
+{
+    if (audioLoad == nullptr || throttleThreshold == nullptr) {
+        return;
+    }
+    const float threshold = throttleThreshold->get() / 100.f;
+    const bool overloaded = threshold < 1.f && audioLoad->load(std::memory_order_relaxed) > threshold;
+
+    // the audio thread's peak hold already smooths the load, a second below it ends the throttling
+    bool throttle = throttled;
+    if (overloaded) {
+        throttle = true;
+        ticksBelowThreshold = 0;
+    } else if (throttled && ++ticksBelowThreshold >= recoveryTicks) {
+        throttle = false;
+    }
+    if (throttle == throttled) {
+        return;
+    }
+    throttled = throttle;
+    ticksBelowThreshold = 0;
+    if (isTimerRunning()) {
+        startTimerHz(throttled ? throttledRate : updateRate);
+    }
+    showingListeners.call(&ShowingListener::editorThrottledChanged, throttled);
+}
+
+void ParamUpdateHub::timerCallback()
+{
+    updateThrottling();
+
+    Param* p = changed.exchange(nullptr, std::memory_order_acquire);
+    while (p != nullptr) {
+        // a change from now on links the param again, after its next pointer was read
+        Param* const next = p->updateNext_;
+        p->updateQueued_.store(false);
+
+        const auto range = listeners.equal_range(p);
+        for (auto it = range.first; it != range.second; ++it) {
+            it->second->paramChanged(p);
+            if (std::find(dispatched.begin(), dispatched.end(), it->second) == dispatched.end()) {
+                dispatched.push_back(it->second);
+            }
+        }
+        p = next;
+    }
+
+    // the components repaint once per tick however many of their params changed
+    for (Listener* l : dispatched) {
+        l->paramsDispatched();
+    }
+    dispatched.clear();
+}
@@ -0,0 +1,145 @@
+/*
+  ==============================================================================
+
+    PatchCost.cpp
+    Created: 15 Oct 2026 10:31:07pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "PatchCost.h"
+
+namespace {
+    const char* const waveKeys[] = { "square", "saw", "noise", "wavetable", "sample" };
+    const char* const filterKeys[] = { "lowpass", "highpass", "bandpass", "ladder" };
+    const char* const fxKeys[] = { "lofi", "clipping", "delay", "chorus", "reverb", "waveshaper" };
+}
+
+File KernelCosts::getFile()
+{
+    return File::getSpecialLocation(File::commonDocumentsDirectory).getChildFile("Synister").getChildFile("kernel-costs.json");
+}
+
+KernelCosts KernelCosts::load()
+{
+    KernelCosts costs;
+    const File f = getFile();
+    if (f.existsAsFile()) {
+        costs.measured = costs.fromJson(JSON::parse(f));
+    }
+    return costs;
+}
+
+bool KernelCosts::save() const
+{
+    return getFile().getParentDirectory().createDirectory() && getFile().replaceWithText(JSON::toString(toJson()));
+}
+
+var KernelCosts::toJson() const
+{
+    DynamicObject::Ptr o = new DynamicObject();
+    o->setProperty("metric", "nsPerSample");
+    o->setProperty("blockSize", PatchCostEstimate::liveBlockSize);
+    o->setProperty("measuredOn", measuredOn);
+    o->setProperty("voice", voice);
+    for (size_t w = 0; w < wave.size(); ++w) {
+        o->setProperty(waveKeys[w], wave[w]);
+    }
+    o->setProperty("unisonCopy", unisonCopy);
+    for (size_t f = 0; f < biquad.size(); ++f) {
+        o->setProperty(filterKeys[f], biquad[f]);
+    }
+    o->setProperty("svf", svf);
+    o->setProperty("modRow", modRow);
+    for (size_t t = 0; t < fx.size(); ++t) {
+        o->setProperty(fxKeys[t], fx[t]);
+    }
+    return var(o.get());
+}
+
+bool KernelCosts::fromJson(const var& json)
+{
+    if (json.getProperty("metric", var()).toString() != "nsPerSample") {
+        return false;
+    }
+    const auto read = [&json](const char* key, double& value) {
+        const var v = json.getProperty(key, var());
+        if (!v.isVoid()) {
+            value = jmax(0., static_cast<double>(v));
+        }
+    };
+    measuredOn = json.getProperty("measuredOn", var()).toString();
+    read("voice", voice);
+    for (size_t w = 0; w < wave.size(); ++w) {
+        read(waveKeys[w], wave[w]);
+    }
+    read("unisonCopy", unisonCopy);
+    for (size_t f = 0; f < biquad.size(); ++f) {
+        read(filterKeys[f], biquad[f]);
+    }
+    read("svf", svf);
+    read("modRow", modRow);
+    for (size_t t = 0; t < fx.size(); ++t) {
+        read(fxKeys[t], fx[t]);
+    }
+    return true;
+}
+
+PatchCostEstimate PatchCostEstimate::estimate(const SynthParams& p, const KernelCosts& costs)
+{
+    PatchCostEstimate e;
+
+    double oscNs = 0.;
+    for (const SynthParams::Osc& o : p.osc) {
+        if (o.oscActivation.getStep() != eOnOffToggle::eOn) {
+            continue;
+        }
+        ++e.numOscillators;
+        const eOscWaves wave = o.waveForm.getStep();
+        oscNs += costs.wave[static_cast<size_t>(wave)];
+        if (wave == eOscWaves::eOscSquare || wave == eOscWaves::eOscSaw) {
+            oscNs += costs.unisonCopy * (jlimit(1, 8, roundToInt(o.unisonVoices.get())) - 1);
+        }
+    }
+
+    double filterNs = 0.;
+    int activeFilters = 0;
+    for (const SynthParams::Filter& f : p.filter) {
+        if (f.filterActivation.getStep() != eOnOffToggle::eOn) {
+            continue;
+        }
+        ++activeFilters;
+        const eBiquadFilters type = f.passtype.getStep();
+        if (type == eBiquadFilters::eLadder) {
+            // the local oversampling of the ladder doubles it
+            filterNs += costs.biquad[static_cast<size_t>(type)] * (f.ladderOversampling.getStep() == eOnOffToggle::eOn ? 2. : 1.);
+        } else {
+            filterNs += f.topology.getStep() == eFilterTopology::eSvf ? costs.svf : costs.biquad[static_cast<size_t>(type)];
+        }
+    }
+    // per oscillator every oscillator runs through its own filters
+    const int filterPasses = p.filterRouting.getStep() == eFilterRouting::ePerOscillator ? jmax(1, e.numOscillators) : 1;
+    e.numFilters = activeFilters * filterPasses;
+
+    const eOversampling os = p.oversampling.getStep();
+    // adaptive voices the factor of 4, the cost of the worst case and not of the usual one
+    const double oversampling = static_cast<double>(SynthParams::getOversamplingFactor(os));
+
+    e.numModRows = p.globalModMatrix.countActiveRows();
+    e.voiceNs = costs.voice + costs.modRow * e.numModRows + oversampling * (oscNs + filterNs * filterPasses);
+    // legato plays all held keys on one voice
+    e.numVoices = p.voiceMode.getStep() == eVoiceMode::eLegato ? 1 : jmax(1, roundToInt(p.polyphony.get()));
+
+    const eOnOffToggle fxOn[] = {
+        p.lowFiActivation.getStep(), p.clippingActivation.getStep(), p.delayActivation.getStep(),
+        p.chorActivation.getStep(), p.reverbActivation.getStep(), p.shaperActivation.getStep()
+    };
+    for (size_t t = 0; t < costs.fx.size(); ++t) {
+        if (fxOn[t] == eOnOffToggle::eOn) {
+            ++e.numFx;
+            e.fxNs += 2. * costs.fx[t];
+        }
+    }
+    return e;
+}
@@ -0,0 +1,183 @@
+/*
+  ==============================================================================
+
+    PatchLoader.cpp
+    Created: 15 Oct 2026 4:52:18am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "PatchLoader.h"
+#include "SynthParams.h"
+
+//==============================================================================
+PatchLoader::PatchLoader(SynthParams& p, int numParams)
+    : params(p)
+    , pendingPreset(0)
+    , pendingWhich(eSerializationParams::eAll)
+    , pendingReset(false)
+    , hasPending(false)
+    , parsedVersion(0.f)
+    , parsedIsPatch(true)
+    , writeSlot(0)
+    , readSlot(1)
+    , middleSlot(2)
+{
+    // the slots never grow, so neither the worker nor the audio thread allocate
+    for (PatchValues& slot : slots) {
+        slot.values.resize(static_cast<size_t>(numParams));
+    }
+    jobs->add(this, BackgroundJobs::ePriority::eHigh);
+}
+
+PatchLoader::~PatchLoader()
+{
+    // waits until a running parse is done
+    jobs->remove(this);
+    cancelPendingUpdate();
+}
+
+void PatchLoader::load(const File& file, eSerializationParams which, bool resetVoices)
+{
+    ScopedPointer<XmlElement> replaced;
+    PresetBank::Ptr replacedBank;
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        // the replaced patch is deleted outside of the spin lock
+        replaced = pendingPatch.release();
+        replacedBank = pendingBank;
+        pendingBank = nullptr;
+        pendingFile = file;
+        pendingWhich = which;
+        pendingReset = resetVoices;
+        hasPending = true;
+    }
+    jobs->wake(this);
+}
+
+void PatchLoader::load(XmlElement* parsedPatch, eSerializationParams which, bool resetVoices)
+{
+    ScopedPointer<XmlElement> replaced;
+    PresetBank::Ptr replacedBank;
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        replaced = pendingPatch.release();
+        pendingPatch = parsedPatch;
+        replacedBank = pendingBank;
+        pendingBank = nullptr;
+        pendingFile = File::nonexistent;
+        pendingWhich = which;
+        pendingReset = resetVoices;
+        hasPending = true;
+    }
+    jobs->wake(this);
+}
+
+void PatchLoader::load(PresetBank* bank, int preset, bool resetVoices)
+{
+    ScopedPointer<XmlElement> replaced;
+    PresetBank::Ptr replacedBank;
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        replaced = pendingPatch.release();
+        replacedBank = pendingBank;
+        pendingBank = bank;
+        pendingPreset = preset;
+        pendingFile = File::nonexistent;
+        pendingWhich = eSerializationParams::eAll;
+        pendingReset = resetVoices;
+        hasPending = true;
+    }
+    jobs->wake(this);
+}
+
+bool PatchLoader::applyPending()
+{
+    if ((middleSlot.load(std::memory_order_relaxed) & newFlag) == 0) {
+        return false;
+    }
+    readSlot = middleSlot.exchange(readSlot, std::memory_order_acq_rel) & slotMask;
+    const PatchValues& patch = slots[readSlot];
+    params.applyPatch(patch);
+    return patch.resetVoices;
+}
+
+int PatchLoader::useTimeSlice()
+{
+    File file;
+    ScopedPointer<XmlElement> patch;
+    PresetBank::Ptr bank;
+    int preset;
+    eSerializationParams which;
+    bool resetVoices;
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        if (!hasPending) {
+            return 100;
+        }
+        file = pendingFile;
+        patch = pendingPatch.release();
+        bank = pendingBank;
+        pendingBank = nullptr;
+        preset = pendingPreset;
+        which = pendingWhich;
+        resetVoices = pendingReset;
+        hasPending = false;
+    }
+
+    if (bank != nullptr) {
+        // a record of the mapped bank, nothing to parse
+        PatchValues& slot = slots[writeSlot];
+        if (!bank->readPreset(preset, params, slot)) {
+            return 0;
+        }
+        slot.resetVoices = resetVoices;
+        writeSlot = middleSlot.exchange(writeSlot | newFlag, std::memory_order_acq_rel) & slotMask;
+        {
+            const SpinLock::ScopedLockType sl(lock);
+            parsedName = bank->getName(preset);
+            parsedVersion = bank->getSynthVersion();
+            parsedIsPatch = true;
+        }
+        triggerAsyncUpdate();
+        return 0;
+    }
+
+    if (patch == nullptr) {
+        patch = XmlDocument::parse(file);
+    }
+    if (patch == nullptr) {
+        return 0;
+    }
+
+    PatchValues& slot = slots[writeSlot];
+    params.parsePatch(*patch, which, slot);
+    slot.resetVoices = resetVoices;
+    writeSlot = middleSlot.exchange(writeSlot | newFlag, std::memory_order_acq_rel) & slotMask;
+
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        parsedName = patch->getStringAttribute("patchname");
+        parsedVersion = static_cast<float>(patch->getDoubleAttribute("version"));
+        parsedIsPatch = patch->getTagName() == "patch";
+    }
+    triggerAsyncUpdate();
+    return 0;
+}
+
+void PatchLoader::handleAsyncUpdate()
+{
+    String name;
+    float version;
+    bool isPatch;
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        name = parsedName;
+        version = parsedVersion;
+        isPatch = parsedIsPatch;
+    }
+    params.checkPatchVersion(version, isPatch);
+    params.patchName = name;
+    params.patchNameDirty = true;
+}
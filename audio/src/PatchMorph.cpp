@@ -0,0 +1,179 @@
+/*
+  ==============================================================================
+
+    PatchMorph.cpp
+    Created: 15 Oct 2026 9:26:44pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "PatchMorph.h"
+#include "SynthParams.h"
+#include <algorithm>
+
+PatchMorph::PatchMorph(SynthParams& p)
+    : params(p)
+    , version(0)
+    , lastX(-1.f)
+    , lastY(-1.f)
+{
+    // the part of a multitimbral setup, the engine structure and the editor stay as they are
+    const Param* const fixed[] = {
+        &p.morphX, &p.morphY, &p.midiChannel, &p.polyphony, &p.oversampling, &p.filterRouting, &p.mpeMode, &p.openGLRendering,
+        &p.oscSection, &p.envSection, &p.lfoSection, &p.filterSection, &p.fxSection, &p.seqSection, &p.scopeSection
+    };
+    for (Param* param : p.serializeParams) {
+        if (std::find(std::begin(fixed), std::end(fixed), param) == std::end(fixed)
+            && std::find(morphed.begin(), morphed.end(), param) == morphed.end()) {
+            morphed.push_back(param);
+        }
+    }
+    blended.resize(morphed.size());
+    stored.fill(false);
+}
+
+void PatchMorph::storeCorner(int corner)
+{
+    std::vector<float>& values = corners[static_cast<size_t>(corner)];
+    values.resize(morphed.size());
+    for (size_t i = 0; i < morphed.size(); ++i) {
+        values[i] = morphed[i]->get();
+    }
+    stored[static_cast<size_t>(corner)] = true;
+    publish();
+}
+
+void PatchMorph::clearCorner(int corner)
+{
+    stored[static_cast<size_t>(corner)] = false;
+    publish();
+}
+
+void PatchMorph::publish()
+{
+    version.fetch_add(1, std::memory_order_acq_rel);
+    Table& t = tables.getWriteSlot();
+    t.numCorners = stored[0] && stored[1] ? (stored[2] && stored[3] ? 4 : 2) : 0;
+    t.continuous.clear();
+    t.start.clear();
+    t.deltaX.clear();
+    t.deltaY.clear();
+    t.deltaXY.clear();
+    t.stepped.clear();
+    for (std::vector<float>& s : t.steps) {
+        s.clear();
+    }
+
+    // the corners of an A/B morph at y = 1 are A and B again, so y changes nothing
+    const size_t c = t.numCorners == 4 ? 2 : 0;
+    const size_t d = t.numCorners == 4 ? 3 : 1;
+    for (size_t i = 0; t.numCorners > 0 && i < morphed.size(); ++i) {
+        const float a = corners[0][i];
+        const float b = corners[1][i];
+        const float cy = corners[c][i];
+        const float dy = corners[d][i];
+        if (a == b && a == cy && a == dy) {
+            continue;
+        }
+        if (morphed[i]->getNumSteps() > 0) {
+            t.stepped.push_back(morphed[i]);
+            t.steps[0].push_back(a);
+            t.steps[1].push_back(b);
+            t.steps[2].push_back(cy);
+            t.steps[3].push_back(dy);
+        } else {
+            t.continuous.push_back(morphed[i]);
+            t.start.push_back(a);
+            t.deltaX.push_back(b - a);
+            t.deltaY.push_back(cy - a);
+            t.deltaXY.push_back(a - b - cy + dy);
+        }
+    }
+    tables.publish();
+}
+
+void PatchMorph::process()
+{
+    const bool newTable = tables.update();
+    const Table& t = tables.get();
+    if (t.numCorners == 0) {
+        return;
+    }
+    const float x = params.morphX.get();
+    const float y = t.numCorners == 4 ? params.morphY.get() : 0.f;
+    if (!newTable && x == lastX && y == lastY) {
+        return;
+    }
+    lastX = x;
+    lastY = y;
+
+    // A + x (B - A) + y (C - A) + xy (A - B - C + D)
+    const int n = static_cast<int>(t.continuous.size());
+    float* v = blended.data();
+    FloatVectorOperations::copy(v, t.start.data(), n);
+    FloatVectorOperations::addWithMultiply(v, t.deltaX.data(), x, n);
+    if (t.numCorners == 4) {
+        FloatVectorOperations::addWithMultiply(v, t.deltaY.data(), y, n);
+        FloatVectorOperations::addWithMultiply(v, t.deltaXY.data(), x * y, n);
+    }
+    for (int i = 0; i < n; ++i) {
+        Param* param = t.continuous[static_cast<size_t>(i)];
+        if (param->get() != v[i]) {
+            param->set(v[i], true);
+        }
+    }
+
+    const size_t nearest = (x >= .5f ? 1u : 0u) + (y >= .5f ? 2u : 0u);
+    for (size_t i = 0; i < t.stepped.size(); ++i) {
+        Param* param = t.stepped[i];
+        const float step = t.steps[nearest][i];
+        if (param->get() != step) {
+            param->setUI(step, false);
+            param->markUIDirty();
+        }
+    }
+}
+
+void PatchMorph::writeCorners(OutputStream& out) const
+{
+    out.writeInt(numCorners);
+    for (size_t c = 0; c < corners.size(); ++c) {
+        const int numValues = stored[c] ? static_cast<int>(morphed.size()) : 0;
+        out.writeInt(numValues);
+        for (int i = 0; i < numValues; ++i) {
+            out.writeInt(static_cast<int>(params.getParamId(params.getElementTag(*morphed[static_cast<size_t>(i)]))));
+            out.writeFloat(corners[c][static_cast<size_t>(i)]);
+        }
+    }
+}
+
+void PatchMorph::readCorners(InputStream& in)
+{
+    stored.fill(false);
+    const int numStored = in.getNumBytesRemaining() >= 4 ? in.readInt() : 0;
+    for (int c = 0; c < numStored && in.getNumBytesRemaining() >= 4; ++c) {
+        const int numValues = in.readInt();
+        if (c >= numCorners) {
+            in.skipNextBytes(8 * numValues);
+            continue;
+        }
+        // params the chunk does not know take their current value
+        std::vector<float>& values = corners[static_cast<size_t>(c)];
+        values.resize(morphed.size());
+        for (size_t i = 0; i < morphed.size(); ++i) {
+            values[i] = morphed[i]->get();
+        }
+        for (int i = 0; i < numValues && in.getNumBytesRemaining() >= 8; ++i) {
+            const uint32 id = static_cast<uint32>(in.readInt());
+            const float value = in.readFloat();
+            const Param* param = params.idRegistry[id];
+            const auto it = std::find(morphed.begin(), morphed.end(), param);
+            if (param != nullptr && it != morphed.end()) {
+                values[static_cast<size_t>(it - morphed.begin())] = value;
+            }
+        }
+        stored[static_cast<size_t>(c)] = numValues > 0;
+    }
+    publish();
+}
@@ -0,0 +1,78 @@
+/*
+  ==============================================================================
+
+    PatchStateCache.cpp
+    Created: 15 Oct 2026 11:02:18pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "PatchStateCache.h"
+#include <algorithm>
+
+PatchStateCache::PatchStateCache()
+    : numHits(0)
+{
+    entries.reserve(maxStates);
+}
+
+PatchStateCache::State::Ptr PatchStateCache::find(const void* data, int sizeInBytes)
+{
+    if (sizeInBytes <= 0 || sizeInBytes > maxChunkBytes) {
+        return nullptr;
+    }
+    const uint64 hash = hashChunk(data, sizeInBytes);
+
+    const ScopedLock sl(lock);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        const Entry& e = entries[i];
+        if (e.hash == hash && e.chunk.getSize() == static_cast<size_t>(sizeInBytes)
+            && std::memcmp(e.chunk.getData(), data, static_cast<size_t>(sizeInBytes)) == 0) {
+            const State::Ptr state = e.state;
+            std::rotate(entries.begin(), entries.begin() + static_cast<std::ptrdiff_t>(i), entries.begin() + static_cast<std::ptrdiff_t>(i) + 1);
+            ++numHits;
+            return state;
+        }
+    }
+    return nullptr;
+}
+
+void PatchStateCache::add(const void* data, int sizeInBytes, const State::Ptr& state)
+{
+    if (sizeInBytes <= 0 || sizeInBytes > maxChunkBytes || state == nullptr) {
+        return;
+    }
+    Entry e;
+    e.hash = hashChunk(data, sizeInBytes);
+    e.chunk.append(data, static_cast<size_t>(sizeInBytes));
+    e.state = state;
+
+    const ScopedLock sl(lock);
+    // two instances that parsed the same chunk at once keep one state
+    for (const Entry& other : entries) {
+        if (other.hash == e.hash && other.chunk == e.chunk) {
+            return;
+        }
+    }
+    if (static_cast<int>(entries.size()) >= maxStates) {
+        entries.pop_back();
+    }
+    entries.insert(entries.begin(), std::move(e));
+}
+
+int64 PatchStateCache::getNumHits() const
+{
+    const ScopedLock sl(lock);
+    return numHits;
+}
+
+uint64 PatchStateCache::hashChunk(const void* data, int sizeInBytes)
+{
+    uint64 h = 14695981039346656037ull;
+    const uint8* bytes = static_cast<const uint8*>(data);
+    for (int i = 0; i < sizeInBytes; ++i) {
+        h = (h ^ bytes[i]) * 1099511628211ull;
+    }
+    return h;
+}
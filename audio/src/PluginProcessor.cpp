@@ -11,19 +11,41 @@
 #include "PluginProcessor.h"
 #include "Voice.h"
 #include "HostParam.h"
+#include "Denormals.h"
+#include "RealtimeCheck.h"
+#include "Instrument.h"
+#include "DspTables.h"
 
 // UI header, should be hidden behind a factory
-#include <PluginEditor.h>
+#if !SYNISTER_ENGINE_ONLY
+ #include <PluginEditor.h>
+#endif
 
 //==============================================================================
 PluginAudioProcessor::PluginAudioProcessor()
-    : delay(*this)
-    , stepSeq(*this)
-    , chorus(*this)
+    : synth(*this)
+    , engineSampleRate(44100.)
+    , engineBlockSize(0)
+    , delay(*this)
     , clip(*this)
     , lowFi(*this)
-    , synth(midiState)
+    , stepSeq(*this)
+    , chorus(*this)
+    , reverb(*this)
+    , shaper(*this)
+    , fxChain(*this, lowFi, clip, delay, chorus, reverb, shaper)
+    , numAutomationRamps(0)
+    , factoryBank(*this)
+    , currentProgram(0)
+    , pendingProgram(-1)
+    , denormalCount(0)
+    , idle(false)
+    , bypassed(false)
+    , renderingFade(false)
+    , bypassFadeRemaining(0)
 {
+    telemetry.setMemorySource(this);
+    budgetSlot = instanceBudget->acquire();
     for (size_t i = 0; i < osc.size(); ++i) {
         addParameter(new HostParam<Param>(osc[i].fine));
         addParameter(new HostParam<Param>(osc[i].coarse));
@@ -79,50 +101,102 @@ PluginAudioProcessor::PluginAudioProcessor()
     addParameter(new HostParam<ParamStepped<eOnOffToggle>>(clippingActivation));
     addParameter(new HostParam<Param>(clippingFactor));
 
-    positionInfo[0].resetToDefault();
-    positionInfo[1].resetToDefault();
+    addParameter(new HostParam<Param>(polyphony));
+    addParameter(new HostParam<ParamStepped<eOversampling>>(oversampling));
+
+    for (size_t i = 0; i < osc.size(); ++i) {
+        addParameter(new HostParam<ParamStepped<eOnOffToggle>>(osc[i].bandLimited));
+    }
+
+    for (size_t i = 0; i < filter.size(); ++i) {
+        addParameter(new HostParam<ParamStepped<eFilterTopology>>(filter[i].topology));
+    }
+    addParameter(new HostParam<ParamStepped<eFilterRouting>>(filterRouting));
+
+    for (size_t i = 0; i < filter.size(); ++i) {
+        addParameter(new HostParam<ParamStepped<eOnOffToggle>>(filter[i].ladderOversampling));
+    }
+
+    for (size_t i = 0; i < lfo.size(); ++i) {
+        addParameter(new HostParam<ParamStepped<eOnOffToggle>>(lfo[i].global));
+    }
+
+    addParameter(new HostParam<Param>(lowFiDownsample));
+    addParameter(new HostParam<ParamStepped<eClippingMode>>(clippingMode));
+    addParameter(new HostParam<ParamStepped<eFxType>>(fxSlot0));
+    addParameter(new HostParam<ParamStepped<eFxType>>(fxSlot1));
+    addParameter(new HostParam<ParamStepped<eFxType>>(fxSlot2));
+    addParameter(new HostParam<ParamStepped<eFxType>>(fxSlot3));
+    addParameter(new HostParam<ParamStepped<eFxType>>(fxSlot4));
+
+    addParameter(new HostParam<ParamStepped<eOnOffToggle>>(reverbActivation));
+    addParameter(new HostParam<Param>(reverbDryWet));
+    addParameter(new HostParam<Param>(reverbSize));
+    addParameter(new HostParam<Param>(reverbDecay));
+    addParameter(new HostParamLog<Param>(reverbDamping, 4e3f));
+
+    for (size_t i = 0; i < osc.size(); ++i) {
+        addParameter(new HostParam<Param>(osc[i].unisonVoices));
+        addParameter(new HostParam<Param>(osc[i].unisonDetune));
+        addParameter(new HostParam<Param>(osc[i].unisonSpread));
+    }
+
+    addParameter(new HostParam<Param>(morphX));
+    addParameter(new HostParam<Param>(morphY));
+    addParameter(new HostParam<ParamStepped<eVoiceMode>>(voiceMode));
+    addParameter(new HostParam<Param>(glideTime));
+    addParameter(new HostParam<ParamStepped<eChorusInterpolation>>(chorInterpolation));
+
+    addParameter(new HostParam<ParamStepped<eFxType>>(fxSlot5));
+    addParameter(new HostParam<ParamStepped<eOnOffToggle>>(shaperActivation));
+    addParameter(new HostParam<Param>(shaperDrive));
+    addParameter(new HostParam<ParamStepped<eShaperCurve>>(shaperCurve));
+    addParameter(new HostParam<ParamStepped<eOnOffToggle>>(shaperOversampling));
+
+    addParameter(new HostParam<ParamStepped<eOnOffToggle>>(limiterActivation));
+    addParameter(new HostParam<Param>(limiterCeiling));
+
+    // the voices are made by the first prepareToPlay, a host that only scans the plugin never needs them
+    synth.addSound(new Sound());
 
 
     /*Create ModMatrixRows here*/
     for (size_t f = 0; f < filter.size(); ++f) {
-        String boxName = String::formatted("filter %u", f + 1);
-        globalModMatrix.addModMatrixRow(&filter[f].lpCutModSrc1, static_cast<destinations>(DEST_FILTER1_LC + f), &filter[f].lpModAmount1, boxName + " lpModSrcBox1");
-        globalModMatrix.addModMatrixRow(&filter[f].lpCutModSrc2, static_cast<destinations>(DEST_FILTER1_LC + f), &filter[f].lpModAmount2, boxName + " lpModSrcBox2");
-        globalModMatrix.addModMatrixRow(&filter[f].hpCutModSrc1, static_cast<destinations>(DEST_FILTER1_HC + f), &filter[f].hpModAmount1, boxName + " hpModSrcBox1");
-        globalModMatrix.addModMatrixRow(&filter[f].hpCutModSrc2, static_cast<destinations>(DEST_FILTER1_HC + f), &filter[f].hpModAmount2, boxName + " hpModSrcBox2");
-        globalModMatrix.addModMatrixRow(&filter[f].resonanceModSrc1, static_cast<destinations>(DEST_FILTER1_RES + f), &filter[f].resModAmount1, boxName + " resModSrcBox1");
-        globalModMatrix.addModMatrixRow(&filter[f].resonanceModSrc2, static_cast<destinations>(DEST_FILTER1_RES + f), &filter[f].resModAmount2, boxName + " resModSrcBox2");
+        globalModMatrix.addModMatrixRow(&filter[f].lpCutModSrc1, static_cast<destinations>(DEST_FILTER1_LC + f), &filter[f].lpModAmount1);
+        globalModMatrix.addModMatrixRow(&filter[f].lpCutModSrc2, static_cast<destinations>(DEST_FILTER1_LC + f), &filter[f].lpModAmount2);
+        globalModMatrix.addModMatrixRow(&filter[f].hpCutModSrc1, static_cast<destinations>(DEST_FILTER1_HC + f), &filter[f].hpModAmount1);
+        globalModMatrix.addModMatrixRow(&filter[f].hpCutModSrc2, static_cast<destinations>(DEST_FILTER1_HC + f), &filter[f].hpModAmount2);
+        globalModMatrix.addModMatrixRow(&filter[f].resonanceModSrc1, static_cast<destinations>(DEST_FILTER1_RES + f), &filter[f].resModAmount1);
+        globalModMatrix.addModMatrixRow(&filter[f].resonanceModSrc2, static_cast<destinations>(DEST_FILTER1_RES + f), &filter[f].resModAmount2);
     }
     for (size_t o = 0; o < osc.size(); ++o) {
-        String boxName = String::formatted("osc %u", o + 1);
-        globalModMatrix.addModMatrixRow(&osc[o].gainModSrc1, static_cast<destinations>(DEST_OSC1_GAIN + o), &osc[o].gainModAmount1, boxName + " GainModSrc1");
-        globalModMatrix.addModMatrixRow(&osc[o].gainModSrc2, static_cast<destinations>(DEST_OSC1_GAIN + o), &osc[o].gainModAmount2, boxName + " GainModSrc2");
-        globalModMatrix.addModMatrixRow(&osc[o].panModSrc1, static_cast<destinations>(DEST_OSC1_PAN + o), &osc[o].panModAmount1, boxName + " PanModSrc1");
-        globalModMatrix.addModMatrixRow(&osc[o].panModSrc2, static_cast<destinations>(DEST_OSC1_PAN + o), &osc[o].panModAmount2, boxName + " PanModSrc2");
-        globalModMatrix.addModMatrixRow(&osc[o].pitchModSrc1, static_cast<destinations>(DEST_OSC1_PI + o), &osc[o].pitchModAmount1, boxName + " oscPitchModSrc1");
-        globalModMatrix.addModMatrixRow(&osc[o].pitchModSrc2, static_cast<destinations>(DEST_OSC1_PI + o), &osc[o].pitchModAmount2, boxName + " oscPitchModSrc2");
-        globalModMatrix.addModMatrixRow(&osc[o].shapeModSrc1, static_cast<destinations>(DEST_OSC1_PW + o), &osc[o].shapeModAmount1, boxName + " WidthModSrc1");
-        globalModMatrix.addModMatrixRow(&osc[o].shapeModSrc2, static_cast<destinations>(DEST_OSC1_PW + o), &osc[o].shapeModAmount2, boxName + " WidthModSrc2");
+        globalModMatrix.addModMatrixRow(&osc[o].gainModSrc1, static_cast<destinations>(DEST_OSC1_GAIN + o), &osc[o].gainModAmount1);
+        globalModMatrix.addModMatrixRow(&osc[o].gainModSrc2, static_cast<destinations>(DEST_OSC1_GAIN + o), &osc[o].gainModAmount2);
+        globalModMatrix.addModMatrixRow(&osc[o].panModSrc1, static_cast<destinations>(DEST_OSC1_PAN + o), &osc[o].panModAmount1);
+        globalModMatrix.addModMatrixRow(&osc[o].panModSrc2, static_cast<destinations>(DEST_OSC1_PAN + o), &osc[o].panModAmount2);
+        globalModMatrix.addModMatrixRow(&osc[o].pitchModSrc1, static_cast<destinations>(DEST_OSC1_PI + o), &osc[o].pitchModAmount1);
+        globalModMatrix.addModMatrixRow(&osc[o].pitchModSrc2, static_cast<destinations>(DEST_OSC1_PI + o), &osc[o].pitchModAmount2);
+        globalModMatrix.addModMatrixRow(&osc[o].shapeModSrc1, static_cast<destinations>(DEST_OSC1_PW + o), &osc[o].shapeModAmount1);
+        globalModMatrix.addModMatrixRow(&osc[o].shapeModSrc2, static_cast<destinations>(DEST_OSC1_PW + o), &osc[o].shapeModAmount2);
     }
 
     for (size_t e = 0; e < env.size(); ++e) {
-        String boxName = String::formatted("env %u", e + 2);
-        globalModMatrix.addModMatrixRow(&env[e].speedModSrc1, static_cast<destinations>(DEST_ENV2_SPEED + e), &env[e].speedModAmount1, boxName + " envSpeedModSrcBox1");
-        globalModMatrix.addModMatrixRow(&env[e].speedModSrc2, static_cast<destinations>(DEST_ENV2_SPEED + e), &env[e].speedModAmount2, boxName + " envSpeedModSrcBox2");
+        globalModMatrix.addModMatrixRow(&env[e].speedModSrc1, static_cast<destinations>(DEST_ENV2_SPEED + e), &env[e].speedModAmount1);
+        globalModMatrix.addModMatrixRow(&env[e].speedModSrc2, static_cast<destinations>(DEST_ENV2_SPEED + e), &env[e].speedModAmount2);
     }
-    globalModMatrix.addModMatrixRow(&envVol[0].speedModSrc1, static_cast<destinations>(DEST_VOL_ENV_SPEED), &envVol[0].speedModAmount1, "env vol envSpeedModSrcBox1");
-    globalModMatrix.addModMatrixRow(&envVol[0].speedModSrc2, static_cast<destinations>(DEST_VOL_ENV_SPEED), &envVol[0].speedModAmount2, "env vol envSpeedModSrcBox1");
+    globalModMatrix.addModMatrixRow(&envVol[0].speedModSrc1, static_cast<destinations>(DEST_VOL_ENV_SPEED), &envVol[0].speedModAmount1);
+    globalModMatrix.addModMatrixRow(&envVol[0].speedModSrc2, static_cast<destinations>(DEST_VOL_ENV_SPEED), &envVol[0].speedModAmount2);
 
     for (size_t l = 0; l < lfo.size(); ++l) {
-        String boxName = String::formatted("lfo %u", l + 1);
-        globalModMatrix.addModMatrixRow(&lfo[l].freqModSrc1, static_cast<destinations>(DEST_LFO1_FREQ + l), &lfo[l].freqModAmount1, boxName + " freqModSrc1");
-        globalModMatrix.addModMatrixRow(&lfo[l].freqModSrc2, static_cast<destinations>(DEST_LFO1_FREQ + l), &lfo[l].freqModAmount2, boxName + " freqModSrc2");
+        globalModMatrix.addModMatrixRow(&lfo[l].freqModSrc1, static_cast<destinations>(DEST_LFO1_FREQ + l), &lfo[l].freqModAmount1);
+        globalModMatrix.addModMatrixRow(&lfo[l].freqModSrc2, static_cast<destinations>(DEST_LFO1_FREQ + l), &lfo[l].freqModAmount2);
         // LFO Gain is handled in directly @ voice.renderModulation()
     }
 }
 
 PluginAudioProcessor::~PluginAudioProcessor()
 {
+    instanceBudget->release(budgetSlot);
 }
 
 //==============================================================================
@@ -143,7 +217,12 @@ const String PluginAudioProcessor::getInputChannelName (int channelIndex) const
 
 const String PluginAudioProcessor::getOutputChannelName (int channelIndex) const
 {
-    return String (channelIndex + 1);
+    static const char* const busNames[] = { "Main", "Dry", "Delay", "Chorus" };
+    const int bus = channelIndex / 2;
+    if (getNumMainChannels() < 2 || !isPositiveAndBelow(bus, static_cast<int>(nOutputBuses))) {
+        return String (channelIndex + 1);
+    }
+    return String(busNames[bus]) + (channelIndex % 2 == 0 ? " L" : " R");
 }
 
 bool PluginAudioProcessor::isInputChannelStereoPair (int index) const
@@ -178,34 +257,55 @@ bool PluginAudioProcessor::producesMidi() const
 
 bool PluginAudioProcessor::silenceInProducesSilenceOut() const
 {
+    // the audio input is not used, the midi input plays notes out of silence
     return false;
 }
 
 double PluginAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    // a released voice sounds for the release time, then runs through the effects
+    const double sRate = engineSampleRate;
+    const double fxTail = sRate > 0. ? fxChain.getTailSamples() / sRate : 0.0;
+    return envVol[0].release.get() + fxTail;
 }
 
 int PluginAudioProcessor::getNumPrograms()
 {
-    return 1;   // NB: some hosts don't cope very well if you tell them there are 0 programs,
-                // so this should be at least 1, even if you're not really implementing programs.
+    return FactoryBank::getNumPrograms();
 }
 
 int PluginAudioProcessor::getCurrentProgram()
 {
-    return 0;
+    return currentProgram.load();
 }
 
 void PluginAudioProcessor::setCurrentProgram (int index)
 {
-    ignoreUnused(index);
+    if (!isPositiveAndBelow(index, FactoryBank::getNumPrograms())) {
+        return;
+    }
+    // the audio thread does not wait for the bank, so it is parsed by now
+    factoryBank.waitUntilParsed();
+    currentProgram.store(index);
+    pendingProgram.store(index);
+    patchName = FactoryBank::getProgramName(index);
+    patchNameDirty = true;
 }
 
 const String PluginAudioProcessor::getProgramName (int index)
 {
-    ignoreUnused(index);
-    return String();
+    return FactoryBank::getProgramName(index);
+}
+
+bool PluginAudioProcessor::applyProgram(int index)
+{
+    const PatchValues* program = factoryBank.getProgram(index);
+    if (program == nullptr) {
+        return false;
+    }
+    applyPatch(*program);
+    currentProgram.store(index);
+    return true;
 }
 
 void PluginAudioProcessor::changeProgramName (int index, const String& newName)
@@ -216,30 +316,225 @@ void PluginAudioProcessor::changeProgramName (int index, const String& newName)
 //==============================================================================
 void PluginAudioProcessor::prepareToPlay (double sRate, int samplesPerBlock)
 {
-    ignoreUnused(samplesPerBlock);
-    synth.setCurrentPlaybackSampleRate(sRate);
-    synth.clearVoices();
+    // the voices render in pieces of a fixed size, the block size of the host only sizes the engine blocks
+    const int engineFactor = fixedEngineRate.getStep() == eOnOffToggle::eOn ? EngineResampler::getFactor(sRate) : 1;
+    engineResampler.prepare(getNumOutputChannels(), engineFactor, samplesPerBlock);
+    engineSampleRate = sRate / engineFactor;
+    engineBlockSize = samplesPerBlock / engineFactor;
+    // the resampler and the pipeline carry the stems of the output buses, the rest renders the main bus
+    const int numMainChannels = getNumMainChannels();
 
-    for (int i = 8; --i >= 0;)
-    {
-        synth.addVoice(new Voice(*this, samplesPerBlock));
+    synth.allNotesOff(0, false);
+    synth.setCurrentPlaybackSampleRate(engineSampleRate);
+    synth.prepare(numMainChannels, samplesPerBlock / sRate);
+    partMidi.ensureSize(4096);
+    engineMidi.ensureSize(4096 + MidiEventList::capacity * MidiEventList::bytesPerEvent);
+    delayCompensation.prepare(numMainChannels);
+    if (pipelinedFx.getStep() == eOnOffToggle::eOn) {
+        // the engine blocks of the resampler are at most one sample longer than their share of the host block
+        fxPipeline.prepare(getNumOutputChannels(), engineFactor > 1 ? samplesPerBlock / engineFactor + 1 : samplesPerBlock, samplesPerBlock / sRate);
+    } else {
+        fxPipeline.release();
     }
-    synth.clearSounds();
-    synth.addSound(new Sound());
+    if (seqFreeze.getStep() == eOnOffToggle::eOn) {
+        freeze.prepare(*this, numMainChannels, engineSampleRate);
+    } else {
+        freeze.release();
+    }
+    setLatencySamples(getReportedLatency());
 
-    delay.init(getNumOutputChannels(), sRate);
-    chorus.init(getNumOutputChannels(), sRate);
+    fxChain.prepare(numMainChannels, engineSampleRate);
+    masterOutput.prepare(numMainChannels, sRate);
+    masterLimiter.prepare(numMainChannels, sRate);
+    telemetry.output.prepare(sRate);
+    midiClock.prepare(sRate);
+#if SYNISTER_NOTE_LATENCY
+    telemetry.notes.prepare(engineSampleRate);
+#endif
+    idle = false;
+    warmUp();
+
+    // with SYNISTER_CAPTURE_DIR every prepare starts a capture of the session from here
+    const File captureFile = SessionCapture::createCaptureFile();
+    if (captureFile != File::nonexistent) {
+        MemoryBlock state;
+        getStateInformation(state);
+        const Result captured = capture.start(captureFile, state, sRate, samplesPerBlock, getNumOutputChannels());
+        if (captured.failed()) {
+            DBG(captured.getErrorMessage());
+        }
+    }
+}
+
+void PluginAudioProcessor::warmUp()
+{
+    const int numSamples = engineBlockSize;
+    if (numSamples <= 0) {
+        // not prepared yet
+        return;
+    }
+    const ScopedFlushToZero flushToZero;
+
+    updateSnapshot(eQualityTier::eRealtime);
+    compileRenderPlan();
+    globalModMatrix.compile();
+
+    // low, middle and high keys, an adaptive voice takes a factor of its own for each
+    const int channel = mpeMode.getStep() == eOnOffToggle::eOn ? 2 : 1;
+    const int keys[] = { 36, 60, 84 };
+    MidiBuffer notesOn;
+    MidiBuffer notesOff;
+    for (int key : keys) {
+        notesOn.addEvent(MidiMessage::noteOn(channel, key, .8f), 0);
+        notesOff.addEvent(MidiMessage::noteOff(channel, key), 0);
+    }
+    MidiBuffer none;
+
+    AudioSampleBuffer scratch(getNumOutputChannels(), numSamples);
+    AudioSampleBuffer voices(scratch.getArrayOfWritePointers(), getNumMainChannels(), numSamples);
+    for (int b = 0; b < warmUpBlocks + 2; ++b) {
+        scratch.clear();
+        synth.renderNextBlock(voices, b == 0 ? notesOn : (b == warmUpBlocks ? notesOff : none), 0, numSamples);
+        processEffects(scratch, 0, numSamples);
+    }
+
+    // nothing of it is heard or carries over into the first block
+    synth.allNotesOff(0, false);
+    synth.resetSources();
+    fxChain.reset();
+    fxPipeline.reset();
+}
+
+void PluginAudioProcessor::filterMidiChannel(MidiBuffer& midiMessages)
+{
+    const int channel = static_cast<int>(midiChannel.get());
+    if (channel == 0) {
+        return;
+    }
+
+    partMidi.clear();
+    MidiBuffer::Iterator it(midiMessages);
+    const uint8* data;
+    int size;
+    int pos;
+    while (it.getNextEvent(data, size, pos)) {
+        // channel messages have a status byte below 0xf0
+        if (data[0] >= 0xf0 || (data[0] & 0x0f) + 1 == channel) {
+            partMidi.addEvent(data, size, pos);
+        }
+    }
+    // fewer events than before, the buffer of the host keeps its storage
+    midiMessages.clear();
+    midiMessages.addEvents(partMidi, 0, -1, 0);
 }
 
 void PluginAudioProcessor::releaseResources()
 {
-    // When playback stops, you can use this as an opportunity to free up any
-    // spare memory, etc.
+    capture.stop();
+}
+
+void PluginAudioProcessor::reset()
+{
+    fxChain.reset();
+    fxPipeline.reset();
+    masterLimiter.reset();
+    idle = false;
 }
 
 void PluginAudioProcessor::processBlock (AudioSampleBuffer& buffer, MidiBuffer& midiMessages)
 {
-    updateHostInfo();
+    const ScopedFlushToZero flushToZero;
+    const RealtimeCheck::ScopedAudioThread realtimeCheck;
+    BlockState block;
+    if (beginBlock(buffer, midiMessages, block)) {
+        renderBlock(block);
+        endBlock(buffer, block);
+    }
+}
+
+bool PluginAudioProcessor::beginBlock(AudioSampleBuffer& buffer, MidiBuffer& midiMessages, BlockState& block)
+{
+    // the host took the bypass back, the notes of the fade-out are stopped already
+    if (!renderingFade) {
+        bypassed = false;
+        bypassFadeRemaining = 0;
+    }
+
+    // a silent instance waits for something to play, without the host info and the master stage
+    if (idle && canSkipBlock(midiMessages)) {
+        SYNISTER_COUNT("skipped idle blocks", 1);
+        midiClock.process(midiMessages, buffer.getNumSamples());
+        capture.writeBlock(buffer.getNumSamples(), isNonRealtime(), nullptr, nullptr, 0, serializeParams, midiMessages);
+        buffer.clear();
+        // a skipped block costs nothing, the load the editor sees releases
+        telemetry.display.audioLoad.store(telemetry.display.audioLoad.load(std::memory_order_relaxed) * .95f, std::memory_order_relaxed);
+        return false;
+    }
+    idle = false;
+
+    block.startTicks = Time::getHighResolutionTicks();
+    CpuMeter& cpu = telemetry.cpu;
+    cpu.startBlock();
+
+    updateHostInfo(midiMessages, buffer.getNumSamples());
+    cpu.mark(eCpuStage::eHost);
+
+    // the changes of the host and the ui since the last block
+    drainParamEvents();
+    if (capture.isCapturing()) {
+        int numEvents;
+        const ParamEvent* events = getBlockEvents(numEvents);
+        capture.writeBlock(buffer.getNumSamples(), isNonRealtime(), hostPositionFailing || getPlayHead() == nullptr ? nullptr : &transport.getAudio(),
+                           events, numEvents, serializeParams, midiMessages);
+    }
+
+    filterMidiChannel(midiMessages);
+
+    // a patch loaded in the background, a program of the host or of a midi program change
+    // switches here as a whole, the notes of the old sound are released
+    bool releaseNotes = applyPendingPatch();
+    int program = pendingProgram.exchange(-1);
+    {
+        MidiBuffer::Iterator it(midiMessages);
+        MidiMessage m;
+        int pos;
+        while (it.getNextEvent(m, pos)) {
+            if (m.isProgramChange() && m.getProgramChangeNumber() < FactoryBank::getNumPrograms()) {
+                program = m.getProgramChangeNumber();
+            }
+        }
+    }
+    if (program >= 0) {
+        if (applyProgram(program)) {
+            releaseNotes = true;
+        } else {
+            // the bank is still being parsed
+            pendingProgram.store(program);
+        }
+    }
+    if (releaseNotes) {
+        synth.allNotesOff(0, true);
+    }
+
+    // the morph writes the params it blends, after the events so a move of the host is heard in this block
+    morph.process();
+
+    // the audio code reads the params of this block from the snapshot, bounces use the offline quality tier
+    updateSnapshot(isNonRealtime() ? eQualityTier::eOffline : eQualityTier::eRealtime);
+
+    // the decimation filters delay the voices, hosts pick the new value up for their compensation
+    const int latency = getEngineLatency();
+    if (getReportedLatency() != getLatencySamples()) {
+        setLatencySamples(getReportedLatency());
+    }
+
+    // the voices and the effects run at the engine rate, the midi events move to its positions
+    block.latency = latency;
+    block.resample = engineResampler.getFactor() > 1;
+    AudioSampleBuffer& engineBuffer = block.resample ? engineResampler.beginBlock(buffer.getNumSamples(), midiMessages) : buffer;
+    if (block.resample) {
+        engineBuffer.clear();
+    }
 
     // In case we have more outputs than inputs, this code clears any output
     // channels that didn't contain input data, (because these aren't
@@ -249,98 +544,1220 @@ void PluginAudioProcessor::processBlock (AudioSampleBuffer& buffer, MidiBuffer&
     // this code if your algorithm already fills all the output channels.
     for (int i = getNumInputChannels(); i < getNumOutputChannels(); ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
+    cpu.mark(eCpuStage::eEvents);
+
+    generatedMidi.clear();
+    stepSeq.runSeq(generatedMidi, engineBuffer.getNumSamples());
+    // a frozen sequence plays from its recording, the voices stay free for the other notes
+    freeze.beginBlock(*this, stepSeq, midiMessages, engineBuffer.getNumSamples());
+    if (freeze.isFrozen()) {
+        generatedMidi.clear();
+        if (freeze.isFreezing()) {
+            synth.fadeOutVoices();
+        }
+    }
+    const int numSequencerEvents = generatedMidi.size();
+    cpu.mark(eCpuStage::eSequencer);
 
-    stepSeq.runSeq(midiMessages, buffer.getNumSamples(), getSampleRate());
+    // the controller sources ramp inside a sub-block, dense controller streams need no short ones
+    synth.setMinimumRenderingSubdivisionSize(jmax(1, static_cast<int>(renderSubdivision.get())));
 
-    // pass these messages to the keyboard state so that it can update the component
-    // to show on-screen which keys are being pressed on the physical midi keyboard.
-    // This call will also add midi messages to the buffer which were generated by
-    // the mouse-clicking on the on-screen keyboard.
-    keyboardState.processNextMidiBuffer(midiMessages, 0, buffer.getNumSamples(), true);
+    // mark these messages for the keyboard component, so it can show on-screen which keys
+    // are being pressed on the physical midi keyboard. This call will also add midi messages
+    // to the engine midi which were generated by the mouse-clicking on the on-screen keyboard.
+    // Unlike MidiKeyboardState::processNextMidiBuffer() it takes no lock the ui holds.
+    keyboardInput.processNextMidiBuffer(midiMessages, generatedMidi, 0, engineBuffer.getNumSamples());
+    if (generatedMidi.size() > numSequencerEvents) {
+        freeze.notePlayed();
+    }
+    MidiBuffer& blockMidi = generatedMidi.mergeInto(midiMessages, engineMidi);
+#if SYNISTER_NOTE_LATENCY
+    telemetry.notes.beginBlock(blockMidi, engineBuffer.getNumSamples(), block.startTicks, latency);
+#endif
 
-    // and now get the synth to process the midi events and generate its output.
-    synth.renderNextBlock(buffer, midiMessages, 0, buffer.getNumSamples());
+    // the mod routing is fixed for the block, only the active routes are applied by the voices
+    globalModMatrix.compile();
+
+    // host automation is ramped in over sub-blocks, the pipeline renders the block in one piece
+    block.engineBuffer = &engineBuffer;
+    block.midi = &blockMidi;
+    const int numSamples = engineBuffer.getNumSamples();
+    block.numSubBlocks = collectAutomationRamps() > 0 && !fxPipeline.isActive() ? jmin(maxSubBlocks, numSamples / minSubBlockSize) : 1;
+    return true;
+}
+
+void PluginAudioProcessor::renderBlock(BlockState& block)
+{
+    // the synth processes the midi events of each sub-block and the fx follow;
+    // the fx of the pipeline run on another core while the voices render
+    AudioSampleBuffer& engineBuffer = *block.engineBuffer;
+    MidiBuffer& blockMidi = *block.midi;
+    const int latency = block.latency;
+    const int numSamples = engineBuffer.getNumSamples();
+    const int numSubBlocks = block.numSubBlocks;
+    if (fxPipeline.isActive()) {
+        renderPipelined(engineBuffer, blockMidi, latency);
+    } else if (numSubBlocks > 1) {
+        const eQualityTier tier = isNonRealtime() ? eQualityTier::eOffline : eQualityTier::eRealtime;
+        int start = 0;
+        for (int b = 1; b <= numSubBlocks; ++b) {
+            // each sub-block takes the value the ramp reaches at its end, the last one the new value
+            const float t = static_cast<float>(b) / static_cast<float>(numSubBlocks);
+            for (int r = 0; r < numAutomationRamps; ++r) {
+                const AutomationRamp& ramp = automationRamps[r];
+                ramp.param->setBlockValue(ramp.start + (ramp.end - ramp.start) * t);
+            }
+            updateSnapshot(tier);
 
-    // Low fidelity effect
-    //////////////////////
-    // If the effect is activated, the algorithm is applied
-    if (lowFiActivation.getStep() == eOnOffToggle::eOn) {
-        lowFi.bitReduction(buffer);
+            const int end = numSamples * b / numSubBlocks;
+            renderRange(engineBuffer, blockMidi, start, end - start, latency);
+            start = end;
+        }
+        for (int r = 0; r < numAutomationRamps; ++r) {
+            automationRamps[r].param->clearBlockValue();
+        }
+    } else {
+        renderRange(engineBuffer, blockMidi, 0, numSamples, latency);
+    }
+}
+
+void PluginAudioProcessor::endBlock(AudioSampleBuffer& buffer, const BlockState& block)
+{
+    CpuMeter& cpu = telemetry.cpu;
+    const MidiBuffer& blockMidi = *block.midi;
+#if SYNISTER_NOTE_LATENCY
+    telemetry.notes.endBlock();
+#endif
+    if (block.resample) {
+        engineResampler.endBlock(buffer);
     }
+    // the master stage and the meters only see the main bus, the stems leave as they are
+    AudioSampleBuffer main(buffer.getArrayOfWritePointers(), getNumMainChannels(), buffer.getNumSamples());
 
-    if (clippingActivation.getStep() == eOnOffToggle::eOn) {
-        clip.clipSignal(buffer, 0, buffer.getNumSamples());
+    // master volume and pan, smoothed and in one pass
+    masterOutput.process(main, Param::fromDb(masterAmp.getUI()), masterPan.get() / 100.f);
+    if (limiterActivation.getStep() == eOnOffToggle::eOn) {
+        masterLimiter.process(main, limiterCeiling.get());
     }
-    // fx
-    // delay
-    if (delayActivation.getStep() == eOnOffToggle::eOn) {
-        delay.render(buffer, 0, buffer.getNumSamples()); // adds the delay to the outputBuffer
+    // a preset auditioned in the browser, the patch of the instance plays on
+    audition.process(main, getSampleRate());
+
+    // only while an editor shows it
+    telemetry.output.push(main);
+    if (telemetry.hasReaders()) {
+        synth.fillModulationFrame(telemetry.modulation.getWriteSlot());
+        telemetry.modulation.publish();
     }
-    // chorus
-    if (chorActivation.getStep() == eOnOffToggle::eOn) {
-        chorus.render(buffer, 0); // adds the chorus to the outputBuffer
+    cpu.mark(eCpuStage::eMaster);
+    idle = isIdle(main);
+    if (cpu.isMeasuring()) {
+        cpu.endBlock(buffer.getNumSamples(), getSampleRate(), synth.countActiveVoices());
     }
+    Instrument::endBlock();
 
-    // master volume
-    for (int c = 0; c < buffer.getNumChannels(); ++c)
-    {
-        FloatVectorOperations::multiply(buffer.getWritePointer(c, 0), Param::fromDb(masterAmp.getUI()), buffer.getNumSamples());
+#if JUCE_DEBUG
+    // anything left here got past the flush-to-zero mode
+    denormalCount = synth.countDenormalState() + delay.countDenormalState();
+    for (int c = 0; c < buffer.getNumChannels(); ++c) {
+        denormalCount += Denormals::count(buffer.getReadPointer(c), buffer.getNumSamples());
+    }
+    if (denormalCount > 0) {
+        const RealtimeCheck::ScopedAllow debugOutput;
+        DBG("denormals in block: " + String(denormalCount));
     }
+#endif
 
-    // master pan
-    if (buffer.getNumChannels() == 2)
-    {
-        // Linear pan
-        float rightGain = ( (masterPan.get() / 100.f) + 1.f) / 2.f;
-        float leftGain = 1.f - rightGain;
-        // Constant power pan
-        //float p = (float_Pi * ((masterPan.get() / 100.f) + 1.f)) / 4.f;
-        //float rightGain = sin(p);
-        //float leftGain = cos(p);
+    // offline renders have no deadline
+    if (cpuVoiceLimit.getStep() == eOnOffToggle::eOn && !isNonRealtime()) {
+        synth.updateCpuLoad(Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - block.startTicks),
+                            buffer.getNumSamples() / getSampleRate());
+        // the budget of all instances, the quietest one gives up a releasing voice
+        float rms = 0.f;
+        for (int c = 0; c < main.getNumChannels(); ++c) {
+            rms = jmax(rms, main.getRMSLevel(c, 0, buffer.getNumSamples()));
+        }
+        instanceBudget->report(budgetSlot, synth.getCpuLoad(), synth.countActiveVoices(), synth.countReleasingVoices(), rms);
+        if (instanceBudget->shouldYield(budgetSlot) && synth.stealQuietestReleasing()) {
+            instanceBudget->countYield();
+        }
+    } else {
+        synth.resetCpuLoad();
+        instanceBudget->withdraw(budgetSlot);
+    }
 
-        // left
-        FloatVectorOperations::multiply(buffer.getWritePointer(0, 0), leftGain, buffer.getNumSamples());
-        // right
-        FloatVectorOperations::multiply(buffer.getWritePointer(1, 0), rightGain, buffer.getNumSamples());
+    // the blocks that came close to a dropout are logged with what they played
+    if (!isNonRealtime()) {
+        const double budgetSeconds = buffer.getNumSamples() / getSampleRate();
+        const double renderSeconds = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - block.startTicks);
+        const float load = static_cast<float>(renderSeconds / budgetSeconds);
+        if (telemetry.deadlines.addBlock(load)) {
+            reportDeadlineIncident(blockMidi, buffer.getNumSamples(), load);
+        }
+        // for the editor, which slows down under load; rises at once, releases over some blocks
+        std::atomic<float>& displayLoad = telemetry.display.audioLoad;
+        displayLoad.store(jmax(load, displayLoad.load(std::memory_order_relaxed) * .95f), std::memory_order_relaxed);
+    } else {
+        telemetry.display.audioLoad.store(0.f, std::memory_order_relaxed);
     }
 
     //midiMessages.clear(); // NOTE: for now so debugger does not complain
                           // should we set the JucePlugin_ProducesMidiOutput macro to 1 ?
 }
 
-void PluginAudioProcessor::updateHostInfo()
+void PluginAudioProcessor::processBlockBypassed (AudioSampleBuffer& buffer, MidiBuffer&)
 {
-    // currentPositionInfo used for getting the bpm.
+    const int numSamples = buffer.getNumSamples();
+    if (!bypassed) {
+        const int fadeLength = jmax(1, roundToInt(bypassFadeSeconds * getSampleRate()));
+        if (bypassFadeRemaining == 0) {
+            bypassFadeRemaining = fadeLength;
+        }
+        renderingFade = true;
+        processBlock(buffer, bypassMidi);
+        renderingFade = false;
+
+        const int n = jmin(bypassFadeRemaining, numSamples);
+        const float startGain = static_cast<float>(bypassFadeRemaining) / fadeLength;
+        const float endGain = static_cast<float>(bypassFadeRemaining - n) / fadeLength;
+        for (int c = 0; c < buffer.getNumChannels(); ++c) {
+            buffer.applyGainRamp(c, 0, n, startGain, endGain);
+            buffer.clear(c, n, numSamples - n);
+        }
+        bypassFadeRemaining -= n;
+        if (bypassFadeRemaining > 0) {
+            return;
+        }
+        // nothing of the old notes is heard when the host takes the bypass back
+        synth.allNotesOff(0, false);
+        fxChain.reset();
+        fxPipeline.reset();
+        masterLimiter.reset();
+        bypassed = true;
+        return;
+    }
+
+    // the synth has no inputs to pass through
+    for (int i = getNumInputChannels(); i < getNumOutputChannels(); ++i) {
+        buffer.clear(i, 0, numSamples);
+    }
+}
+
+bool PluginAudioProcessor::canSkipBlock(const MidiBuffer& midiMessages)
+{
+    if (!midiMessages.isEmpty() || keyboardInput.hasQueuedNotes() || hasPendingParamEvents()
+        || hasPendingPatch() || pendingProgram.load() >= 0 || seqPlayNoHost.getStep() == eOnOffToggle::eOn
+        || audition.isPlaying()) {
+        return false;
+    }
+    // only the transport of the host starts the synced sequencer
+    if (seqPlaySyncHost.getStep() == eOnOffToggle::eOn) {
+        AudioPlayHead::CurrentPositionInfo position;
+        AudioPlayHead* head = getPlayHead();
+        if (head != nullptr && head->getCurrentPosition(position) && position.isPlaying) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PluginAudioProcessor::isIdle(const AudioSampleBuffer& buffer)
+{
+    // the cheap conditions first, the magnitude catches the delay of the engine resampler
+    return synth.countActiveVoices() == 0 && !stepSeq.isPlaying() && fxChain.isAsleep()
+        && buffer.getMagnitude(0, buffer.getNumSamples()) < FxChain::silenceThreshold
+        && !fxPipeline.hasPendingSignal(FxChain::silenceThreshold);
+}
+
+void PluginAudioProcessor::reportDeadlineIncident(const MidiBuffer& midiMessages, int numSamples, float load)
+{
+    DeadlineIncident incident;
+    incident.timeMs = Time::getMillisecondCounter();
+    incident.load = load;
+    incident.numSamples = numSamples;
+    incident.sampleRate = getSampleRate();
+    incident.activeVoices = synth.countActiveVoices();
+
+    const ParamStepped<eOnOffToggle>* const fxActivation[] = {
+        &lowFiActivation, &clippingActivation, &delayActivation, &chorActivation, &reverbActivation, &shaperActivation
+    };
+    for (int f = 0; f < static_cast<int>(eFxType::nSteps); ++f) {
+        if (fxActivation[f]->getStep() == eOnOffToggle::eOn) {
+            incident.activeFx |= 1u << f;
+        }
+    }
+
+    MidiBuffer::Iterator it(midiMessages);
+    MidiMessage m;
+    int pos;
+    while (it.getNextEvent(m, pos)) {
+        const int e = incident.numMidiEvents++;
+        if (e < DeadlineIncident::maxMidiEvents) {
+            incident.midiPositions[static_cast<size_t>(e)] = pos;
+            const int numBytes = jmin(3, m.getRawDataSize());
+            for (int b = 0; b < numBytes; ++b) {
+                incident.midi[static_cast<size_t>(3 * e + b)] = m.getRawData()[b];
+            }
+        }
+    }
+    incident.numCounters = Instrument::getBlockCounters(incident.counterNames.data(), incident.counterValues.data(),
+                                                        DeadlineIncident::maxCounters);
+    telemetry.deadlines.addIncident(incident);
+}
+
+int PluginAudioProcessor::collectAutomationRamps()
+{
+    numAutomationRamps = 0;
+    int numEvents;
+    const ParamEvent* events = getBlockEvents(numEvents);
+    for (int i = 0; i < numEvents; ++i) {
+        const ParamEvent& e = events[i];
+        // steps switch, they have nothing to ramp
+        if (e.param->getNumSteps() != 0) {
+            continue;
+        }
+        // a param changed several times ramps from the value before its first change
+        int r = 0;
+        while (r < numAutomationRamps && automationRamps[r].param != e.param) {
+            ++r;
+        }
+        if (r == numAutomationRamps) {
+            automationRamps[numAutomationRamps++] = { e.param, e.previousValue, e.previousValue };
+        }
+    }
+
+    // the ramps end at the current value, the ones that end where they start are dropped
+    int n = 0;
+    for (int r = 0; r < numAutomationRamps; ++r) {
+        AutomationRamp ramp = automationRamps[r];
+        ramp.end = ramp.param->get();
+        if (ramp.end != ramp.start) {
+            automationRamps[n++] = ramp;
+        }
+    }
+    numAutomationRamps = n;
+    return n;
+}
+
+void PluginAudioProcessor::renderRange(AudioSampleBuffer& buffer, MidiBuffer& midiMessages, int startSample, int numSamples, int latency)
+{
+    // the sub-blocks of a ramp recompile only if a structural param crosses a step
+    compileRenderPlan();
+    synth.updateNoteCache();
+    AudioSampleBuffer voices(buffer.getArrayOfWritePointers(), getNumMainChannels(), buffer.getNumSamples());
+    synth.renderNextBlock(voices, midiMessages, startSample, numSamples);
+    freeze.processVoices(voices, startSample, numSamples);
+    delayCompensation.process(voices, startSample, numSamples, latency - Decimator::getLatency(getSnapshot().oversampling));
+    telemetry.cpu.mark(eCpuStage::eVoices);
+
+    // fx, the active effects in the order of the fx slots
+    processEffects(buffer, startSample, numSamples);
+}
+
+void PluginAudioProcessor::processEffects(AudioSampleBuffer& buffer, int startSample, int numSamples)
+{
+    AudioSampleBuffer main(buffer.getArrayOfWritePointers(), getNumMainChannels(), buffer.getNumSamples());
+    const int numBuses = main.getNumChannels() == 2 ? jmin(static_cast<int>(nOutputBuses), buffer.getNumChannels() / 2) : 1;
+    if (numBuses <= 1) {
+        fxChain.process(main, startSample, numSamples);
+        return;
+    }
+
+    // the returns are written in place, an inactive or sleeping effect returns silence
+    float* const* channels = buffer.getArrayOfWritePointers();
+    for (int c = 2; c < 2 * numBuses; ++c) {
+        buffer.clear(c, startSample, numSamples);
+    }
+    if (numBuses > eDryBus) {
+        for (int c = 0; c < 2; ++c) {
+            buffer.copyFrom(2 * eDryBus + c, startSample, main, c, startSample, numSamples);
+        }
+    }
+    FxChain::tReturns returns;
+    returns.fill(nullptr);
+    if (numBuses > eDelayReturnBus) {
+        returns[static_cast<size_t>(eFxType::eDelay)] = channels + 2 * eDelayReturnBus;
+    }
+    if (numBuses > eChorusReturnBus) {
+        returns[static_cast<size_t>(eFxType::eChorus)] = channels + 2 * eChorusReturnBus;
+    }
+    fxChain.process(main, startSample, numSamples, &returns);
+}
+
+void PluginAudioProcessor::renderPipelined(AudioSampleBuffer& buffer, MidiBuffer& midiMessages, int latency)
+{
+    // the stages only touch the synth and the effects, the params of the block are compiled before
+    class Stages : public FxPipeline::Stages {
+    public:
+        Stages(PluginAudioProcessor& p, MidiBuffer& m, int l) : processor(p), midi(m), voiceLatency(l) {}
+
+        void renderVoices(AudioSampleBuffer& b, int numSamples) override {
+            AudioSampleBuffer voices(b.getArrayOfWritePointers(), processor.getNumMainChannels(), b.getNumSamples());
+            processor.synth.renderNextBlock(voices, midi, 0, numSamples);
+            processor.freeze.processVoices(voices, 0, numSamples);
+            processor.delayCompensation.process(voices, 0, numSamples, voiceLatency);
+        }
+        void processEffects(AudioSampleBuffer& b, int numSamples) override {
+            // the stems travel through the pipeline with the main bus
+            processor.processEffects(b, 0, numSamples);
+        }
+
+    private:
+        PluginAudioProcessor& processor;
+        MidiBuffer& midi;
+        const int voiceLatency;
+    };
+
+    compileRenderPlan();
+    synth.updateNoteCache();
+    Stages stages(*this, midiMessages, latency - Decimator::getLatency(getSnapshot().oversampling));
+    fxPipeline.process(buffer, buffer.getNumSamples(), stages);
+    telemetry.cpu.mark(eCpuStage::eVoices);
+}
+
+void PluginAudioProcessor::processBlockBatch(PluginAudioProcessor* const* processors, AudioSampleBuffer* const* buffers,
+                                             MidiBuffer* const* midi, int numProcessors)
+{
+    jassert(numProcessors <= maxBatchSize);
+    const ScopedFlushToZero flushToZero;
+    std::array<BlockState, maxBatchSize> blocks;
+    std::array<bool, maxBatchSize> started;
+    std::array<int, maxBatchSize> members;     //!< processors rendering in lock-step, the first one leads
+    int numMembers = 0;
+
+    for (int i = 0; i < numProcessors; ++i) {
+        PluginAudioProcessor& p = *processors[i];
+        started[i] = p.beginBlock(*buffers[i], *midi[i], blocks[i]);
+        if (!started[i]) {
+            continue;
+        }
+        if (p.canRenderInBatch(blocks[i], blocks[numMembers > 0 ? members[0] : i])) {
+            members[numMembers++] = i;
+        } else {
+            p.renderBlock(blocks[i]);
+        }
+    }
+
+    // renderRange() of the whole block for every member, with the voices of all of them in the same lanes
+    if (numMembers > 0) {
+        std::array<Synth*, maxBatchSize> synths;
+        std::array<AudioSampleBuffer, maxBatchSize> voices;     //!< the main buses of the engine buffers
+        std::array<AudioSampleBuffer*, maxBatchSize> engineBuffers;
+        std::array<const MidiBuffer*, maxBatchSize> blockMidi;
+        for (int m = 0; m < numMembers; ++m) {
+            PluginAudioProcessor& p = *processors[members[m]];
+            p.compileRenderPlan();
+            p.synth.updateNoteCache();
+            synths[m] = &p.synth;
+            AudioSampleBuffer& engineBuffer = *blocks[members[m]].engineBuffer;
+            voices[m].setDataToReferTo(engineBuffer.getArrayOfWritePointers(), p.getNumMainChannels(), engineBuffer.getNumSamples());
+            engineBuffers[m] = &voices[m];
+            blockMidi[m] = blocks[members[m]].midi;
+        }
+        const int numSamples = engineBuffers[0]->getNumSamples();
+        Synth::renderNextBlockBatch(synths.data(), engineBuffers.data(), blockMidi.data(), numMembers, numSamples);
+
+        for (int m = 0; m < numMembers; ++m) {
+            PluginAudioProcessor& p = *processors[members[m]];
+            const BlockState& block = blocks[members[m]];
+            p.delayCompensation.process(voices[m], 0, numSamples, block.latency - Decimator::getLatency(p.getSnapshot().oversampling));
+            p.telemetry.cpu.mark(eCpuStage::eVoices);
+            p.processEffects(*block.engineBuffer, 0, numSamples);
+        }
+    }
+
+    for (int i = 0; i < numProcessors; ++i) {
+        if (started[i]) {
+            processors[i]->endBlock(*buffers[i], blocks[i]);
+        }
+    }
+}
+
+bool PluginAudioProcessor::canRenderInBatch(const BlockState& block, const BlockState& lead) const
+{
+    // the whole block in one range on this thread
+    if (block.numSubBlocks > 1 || fxPipeline.isActive() || freeze.isPrepared() || block.engineBuffer->getNumSamples() != lead.engineBuffer->getNumSamples()) {
+        return false;
+    }
+    // the same event positions, the synths split their blocks at the same samples
+    MidiBuffer::Iterator a(*block.midi);
+    MidiBuffer::Iterator b(*lead.midi);
+    const uint8* data;
+    int size;
+    int posA;
+    int posB;
+    for (;;) {
+        const bool hasA = a.getNextEvent(data, size, posA);
+        const bool hasB = b.getNextEvent(data, size, posB);
+        if (hasA != hasB || (hasA && posA != posB)) {
+            return false;
+        }
+        if (!hasA) {
+            return true;
+        }
+    }
+}
+
+void PluginAudioProcessor::Synth::prepare(int numChannels, double blockSeconds)
+{
+    // the voice pool is allocated once at maximum capacity, a later prepare only re-initialises it
+    if (voices.size() == 0) {
+        for (int i = static_cast<int>(params.polyphony.getMax()); --i >= 0;) {
+            addVoice(new Voice(params));
+        }
+    }
+
+    // unlocked before anything below is reallocated
+    engineMemory.clear();
+    engineMemory.setLocking(params.lockMemory.getStep() == eOnOffToggle::eOn);
+
+    // the scratch memory of all voices is one allocation, it only grows
+    const size_t voiceSize = Voice::getArenaSize(internalBlockSize);
+    const size_t arenaSize = voiceSize * static_cast<size_t>(voices.size()) + Voice::arenaAlignment;
+    if (arenaSize > voiceArenaSize) {
+        voiceArena.allocate(arenaSize, true);
+        voiceArenaSize = arenaSize;
+    }
+
+    const size_t cacheLine = sizeof(float) * Voice::arenaAlignment;
+    const size_t misalignment = reinterpret_cast<pointer_sized_uint>(voiceArena.getData()) % cacheLine;
+    float *arena = voiceArena + (misalignment == 0 ? 0 : (cacheLine - misalignment) / sizeof(float));
+
+    for (size_t l = 0; l < globalLfo.size(); ++l) {
+        globalLfo[l].audioBuffer.setSize(1, internalBlockSize);
+        engineMemory.add(globalLfo[l].audioBuffer.getWritePointer(0), static_cast<size_t>(internalBlockSize) * sizeof(float));
+    }
+
+    // the takes of rendered notes, the voices released theirs with the notes stopped before
+    if (params.noteCache.getStep() == eOnOffToggle::eOn) {
+        noteCache.prepare(params, numChannels, getSampleRate());
+    } else {
+        noteCache.release();
+    }
+
+    for (int v = 0; v < voices.size(); ++v) {
+        Voice* voice = static_cast<Voice*>(voices.getUnchecked(v));
+        voice->prepare(getSampleRate(), internalBlockSize, arena + v * voiceSize);
+        voice->setNoteCache(&noteCache);
+        for (size_t l = 0; l < globalLfo.size(); ++l) {
+            voice->setGlobalLfo(l, globalLfo[l].audioBuffer.getReadPointer(0));
+        }
+    }
+
+    resetSources();
+
+    voiceBank.prepare(internalBlockSize, engineMemory);
+    filterBank.prepare(internalBlockSize, engineMemory);
+    // the first note after a load would fault on the pages calloc has not mapped yet
+    engineMemory.add(voiceArena.getData(), voiceArenaSize * sizeof(float));
+
+    if (params.parallelVoices.getStep() == eOnOffToggle::eOn) {
+        // the workers are shared by all instances of the process
+        workerPool.prepare(voices.size(), numChannels, internalBlockSize, blockSeconds);
+    } else {
+        workerPool.release();
+    }
+}
+
+void PluginAudioProcessor::Synth::resetSources()
+{
+    for (size_t l = 0; l < globalLfo.size(); ++l) {
+        globalLfo[l].reset();
+        globalLfo[l].sine.phase = .25f;
+        // the seeds of the voices start at 1
+        globalLfo[l].random.random.setSeed(static_cast<uint32>(l));
+        globalLfo[l].random.newHeldValue();
+    }
+    for (int v = 0; v < voices.size(); ++v) {
+        static_cast<Voice*>(voices.getUnchecked(v))->setRandomSeed(static_cast<uint32>(v + 1));
+    }
+}
+
+SynthesiserVoice* PluginAudioProcessor::Synth::findFreeVoice(SynthesiserSound* soundToPlay, int midiChannel,
+                                                            int midiNoteNumber, bool stealIfNoneAvailable) const
+{
+    const int maxVoices = jmin(static_cast<int>(params.polyphony.get() + .5f), budgetVoices);
+    int numActive = 0;
+
+    for (int i = 0; i < voices.size(); ++i) {
+        if (voices.getUnchecked(i)->isVoiceActive()) {
+            ++numActive;
+        }
+    }
+
+    if (numActive < maxVoices) {
+        for (int i = 0; i < voices.size(); ++i) {
+            SynthesiserVoice* const voice = voices.getUnchecked(i);
+            if (!voice->isVoiceActive() && voice->canPlaySound(soundToPlay)) {
+                return voice;
+            }
+        }
+    }
+
+    if (!stealIfNoneAvailable) {
+        return nullptr;
+    }
+    SynthesiserVoice* const stolen = findVoiceToSteal(soundToPlay, midiChannel, midiNoteNumber);
+    if (stolen != nullptr) {
+        RtLog::write(RtLog::eLevel::eInfo, "voice of note {} stolen for note {}, {} voices", stolen->getCurrentlyPlayingNote(),
+                     midiNoteNumber, maxVoices);
+    }
+    return stolen;
+}
+
+SynthesiserVoice* PluginAudioProcessor::Synth::findVoiceToSteal(SynthesiserSound* soundToPlay, int /*midiChannel*/,
+                                                               int midiNoteNumber) const
+{
+    SynthesiserVoice* sameNote = nullptr;
+    SynthesiserVoice* oldestReleased = nullptr;
+    SynthesiserVoice* oldestNotHeld = nullptr;
+    SynthesiserVoice* oldest = nullptr;
+
+    for (int i = 0; i < voices.size(); ++i) {
+        SynthesiserVoice* const voice = voices.getUnchecked(i);
+
+        // voices above a reduced polyphony may still be releasing, only steal playing ones
+        if (!voice->isVoiceActive() || !voice->canPlaySound(soundToPlay)) {
+            continue;
+        }
+        if (voice->getCurrentlyPlayingNote() == midiNoteNumber && (sameNote == nullptr || voice->wasStartedBefore(*sameNote))) {
+            sameNote = voice;
+        }
+        if (voice->isPlayingButReleased() && (oldestReleased == nullptr || voice->wasStartedBefore(*oldestReleased))) {
+            oldestReleased = voice;
+        }
+        if (!voice->isKeyDown() && (oldestNotHeld == nullptr || voice->wasStartedBefore(*oldestNotHeld))) {
+            oldestNotHeld = voice;
+        }
+        if (oldest == nullptr || voice->wasStartedBefore(*oldest)) {
+            oldest = voice;
+        }
+    }
+
+    if (sameNote != nullptr) {
+        return sameNote;
+    }
+    if (oldestReleased != nullptr) {
+        return oldestReleased;
+    }
+    if (oldestNotHeld != nullptr) {
+        return oldestNotHeld;
+    }
+    return oldest;
+}
+
+void PluginAudioProcessor::Synth::updateCpuLoad(double renderSeconds, double budgetSeconds)
+{
+    //! thresholds relative to the block duration
+    const float highLoad = .8f;
+    const float lowLoad = .5f;
+
+    const float load = budgetSeconds > 0. ? static_cast<float>(renderSeconds / budgetSeconds) : 0.f;
+    // react immediately to spikes, but release slowly
+    cpuLoad = jmax(load, cpuLoad * .95f);
+
+    const int maxVoices = static_cast<int>(params.polyphony.get() + .5f);
+
+    if (cpuLoad > highLoad) {
+        const ScopedLock sl(lock);
+
+        int numActive = 0;
+        Voice* quietest = nullptr;
+        for (int i = 0; i < voices.size(); ++i) {
+            Voice* const voice = static_cast<Voice*>(voices.getUnchecked(i));
+            if (voice->isVoiceActive() && !voice->isFadingOut()) {
+                ++numActive;
+                if (voice->isReleasing() && (quietest == nullptr || voice->getLevel() < quietest->getLevel())) {
+                    quietest = voice;
+                }
+            }
+        }
+        if (quietest != nullptr) {
+            quietest->fadeOut();
+            --numActive;
+        }
+        budgetVoices = jmax(1, jmin(numActive, maxVoices));
+    } else if (cpuLoad < lowLoad && budgetVoices < maxVoices) {
+        ++budgetVoices;
+    }
+}
+
+int PluginAudioProcessor::Synth::countDenormalState() const
+{
+    int numDenormals = 0;
+    for (int v = 0; v < voices.size(); ++v) {
+        numDenormals += static_cast<const Voice*>(voices.getUnchecked(v))->countDenormalState();
+    }
+    return numDenormals;
+}
+
+int PluginAudioProcessor::Synth::countActiveVoices() const
+{
+    int numActive = 0;
+    for (int v = 0; v < voices.size(); ++v) {
+        numActive += voices.getUnchecked(v)->isVoiceActive() ? 1 : 0;
+    }
+    return numActive;
+}
+
+int PluginAudioProcessor::Synth::countReleasingVoices() const
+{
+    int numReleasing = 0;
+    for (int v = 0; v < voices.size(); ++v) {
+        const Voice* const voice = static_cast<const Voice*>(voices.getUnchecked(v));
+        numReleasing += voice->isVoiceActive() && voice->isReleasing() && !voice->isFadingOut() ? 1 : 0;
+    }
+    return numReleasing;
+}
+
+void PluginAudioProcessor::Synth::fadeOutVoices()
+{
+    const ScopedLock sl(lock);
+    for (int i = 0; i < voices.size(); ++i) {
+        Voice* const voice = static_cast<Voice*>(voices.getUnchecked(i));
+        if (voice->isVoiceActive()) {
+            voice->fadeOut();
+        }
+    }
+}
+
+bool PluginAudioProcessor::Synth::stealQuietestReleasing()
+{
+    const ScopedLock sl(lock);
+
+    Voice* quietest = nullptr;
+    for (int i = 0; i < voices.size(); ++i) {
+        Voice* const voice = static_cast<Voice*>(voices.getUnchecked(i));
+        if (voice->isVoiceActive() && !voice->isFadingOut() && voice->isReleasing()
+            && (quietest == nullptr || voice->getLevel() < quietest->getLevel())) {
+            quietest = voice;
+        }
+    }
+    if (quietest == nullptr) {
+        return false;
+    }
+    quietest->fadeOut();
+    return true;
+}
+
+void PluginAudioProcessor::Synth::fillModulationFrame(ModulationFrame& frame) const
+{
+    const Voice* latest = nullptr;
+    for (int v = 0; v < voices.size(); ++v) {
+        const Voice* voice = static_cast<const Voice*>(voices.getUnchecked(v));
+        if (voice->isVoiceActive() && (latest == nullptr || latest->wasStartedBefore(*voice))) {
+            latest = voice;
+        }
+    }
+    if (latest != nullptr) {
+        latest->fillModulationFrame(frame);
+    } else {
+        frame.note = -1;
+    }
+}
+
+void PluginAudioProcessor::Synth::noteOn(int midiChannel, int midiNoteNumber, float velocity)
+{
+    if (params.voiceMode.getStep() != eVoiceMode::eLegato) {
+        Synthesiser::noteOn(midiChannel, midiNoteNumber, velocity);
+        traceNoteStart(midiChannel, midiNoteNumber);
+        return;
+    }
+    const ScopedLock sl(lock);
+
+    if (legatoVoice != nullptr && legatoVoice->isVoiceActive() && legatoVoice->isKeyDown()
+        && legatoVoice->isPlayingChannel(midiChannel) && numHeldNotes > 0) {
+        // the envelopes go on, only the pitch moves
+        for (int i = 0; i < numHeldNotes; ++i) {
+            if (heldNotes[static_cast<size_t>(i)] == midiNoteNumber) {
+                std::copy(heldNotes.begin() + i + 1, heldNotes.begin() + numHeldNotes, heldNotes.begin() + i);
+                --numHeldNotes;
+                break;
+            }
+        }
+        heldNotes[static_cast<size_t>(numHeldNotes++)] = midiNoteNumber;
+        legatoVoice->legatoTo(midiNoteNumber, params.glideTime.get());
+        return;
+    }
+
+    // no key of the legato voice is down, the note starts like in poly mode
+    Synthesiser::noteOn(midiChannel, midiNoteNumber, velocity);
+    legatoVoice = nullptr;
+    for (int v = 0; v < voices.size(); ++v) {
+        Voice* const voice = static_cast<Voice*>(voices.getUnchecked(v));
+        if (voice->getCurrentlyPlayingNote() == midiNoteNumber && voice->isPlayingChannel(midiChannel) && voice->isKeyDown()
+            && (legatoVoice == nullptr || legatoVoice->wasStartedBefore(*voice))) {
+            legatoVoice = voice;
+        }
+    }
+    heldNotes[0] = midiNoteNumber;
+    numHeldNotes = 1;
+    traceNoteStart(midiChannel, midiNoteNumber);
+}
+
+void PluginAudioProcessor::Synth::traceNoteStart(int midiChannel, int midiNoteNumber)
+{
+#if SYNISTER_NOTE_LATENCY
+    // the voice the Synthesiser started last for the key
+    Voice* started = nullptr;
+    for (int v = 0; v < voices.size(); ++v) {
+        Voice* const voice = static_cast<Voice*>(voices.getUnchecked(v));
+        if (voice->getCurrentlyPlayingNote() == midiNoteNumber && voice->isPlayingChannel(midiChannel) && voice->isKeyDown()
+            && (started == nullptr || started->wasStartedBefore(*voice))) {
+            started = voice;
+        }
+    }
+    if (started != nullptr) {
+        params.telemetry.notes.noteStarted(started, midiChannel, midiNoteNumber);
+    }
+#else
+    ignoreUnused(midiChannel, midiNoteNumber);
+#endif
+}
+
+void PluginAudioProcessor::Synth::noteOff(int midiChannel, int midiNoteNumber, float velocity, bool allowTailOff)
+{
+    const ScopedLock sl(lock);
+
+    if (params.voiceMode.getStep() != eVoiceMode::eLegato || legatoVoice == nullptr || !legatoVoice->isVoiceActive()
+        || !legatoVoice->isKeyDown() || !legatoVoice->isPlayingChannel(midiChannel)) {
+        Synthesiser::noteOff(midiChannel, midiNoteNumber, velocity, allowTailOff);
+        return;
+    }
+
+    const int numBefore = numHeldNotes;
+    for (int i = 0; i < numHeldNotes; ++i) {
+        if (heldNotes[static_cast<size_t>(i)] == midiNoteNumber) {
+            std::copy(heldNotes.begin() + i + 1, heldNotes.begin() + numHeldNotes, heldNotes.begin() + i);
+            --numHeldNotes;
+            break;
+        }
+    }
+    if (numHeldNotes == numBefore) {
+        // a key of another voice, e.g. one started before the mode changed
+        if (midiNoteNumber != legatoVoice->getCurrentlyPlayingNote()) {
+            Synthesiser::noteOff(midiChannel, midiNoteNumber, velocity, allowTailOff);
+        }
+        return;
+    }
+
+    if (numHeldNotes == 0) {
+        // the Synthesiser knows the voice by the note it started with, the sustain pedal may hold it
+        Synthesiser::noteOff(midiChannel, legatoVoice->getCurrentlyPlayingNote(), velocity, allowTailOff);
+    } else if (legatoVoice->getSoundingNote() == midiNoteNumber) {
+        legatoVoice->legatoTo(heldNotes[static_cast<size_t>(numHeldNotes - 1)], params.glideTime.get());
+    }
+}
+
+void PluginAudioProcessor::Synth::allNotesOff(int midiChannel, bool allowTailOff)
+{
+    const ScopedLock sl(lock);
+    numHeldNotes = 0;
+    legatoVoice = nullptr;
+    Synthesiser::allNotesOff(midiChannel, allowTailOff);
+}
+
+void PluginAudioProcessor::Synth::handleController(int midiChannel, int controllerNumber, int newValue)
+{
+    if (controllerNumber == 74) {
+        midiState.setTimbre(midiChannel, newValue);
+    }
+    if (isChannelWide(midiChannel)) {
+        switch (controllerNumber) {
+        case 1: //Modwheel
+            midiState.set(MidiState::eModwheel, newValue);
+            break;
+        case 4: //Foot Controller
+            midiState.set(MidiState::eFoot, newValue);
+            break;
+        case 11: //Expression Control
+            midiState.set(MidiState::eExpPedal, newValue);
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (isMpeMasterChannel(midiChannel)) {
+        // the voices play on the member channels, the pedals included
+        for (int channel = 1; channel <= MidiState::numChannels; ++channel) {
+            Synthesiser::handleController(channel, controllerNumber, newValue);
+        }
+    } else {
+        Synthesiser::handleController(midiChannel, controllerNumber, newValue);
+    }
+}
+
+void PluginAudioProcessor::Synth::handleChannelPressure(int midiChannel, int channelPressureValue)
+{
+    if (isChannelWide(midiChannel)) {
+        midiState.set(MidiState::eAftertouch, channelPressureValue);
+    }
+    if (isMpeMasterChannel(midiChannel)) {
+        const ScopedLock sl(lock);
+        for (int i = voices.size(); --i >= 0;) {
+            static_cast<Voice*>(voices.getUnchecked(i))->masterChannelPressureChanged(channelPressureValue);
+        }
+    } else {
+        Synthesiser::handleChannelPressure(midiChannel, channelPressureValue);
+    }
+}
+
+void PluginAudioProcessor::Synth::handlePitchWheel(int midiChannel, int wheelValue)
+{
+    if (isChannelWide(midiChannel)) {
+        midiState.set(MidiState::ePitchbend, wheelValue);
+    }
+    if (isMpeMasterChannel(midiChannel)) {
+        const ScopedLock sl(lock);
+        for (int i = voices.size(); --i >= 0;) {
+            static_cast<Voice*>(voices.getUnchecked(i))->masterPitchWheelMoved(wheelValue);
+        }
+    } else {
+        Synthesiser::handlePitchWheel(midiChannel, wheelValue);
+    }
+}
+
+void PluginAudioProcessor::Synth::renderGlobalLfos(int numSamples)
+{
+    const ParamSnapshot& snap = params.getSnapshot();
+    for (size_t l = 0; l < globalLfo.size(); ++l) {
+        if (snap.lfo[l].global) {
+            globalLfo[l].setPhaseDelta(snap.lfo[l]);
+            globalLfo[l].render(snap.lfo[l].wave, globalLfo[l].audioBuffer.getWritePointer(0), 1.f, numSamples);
+        }
+    }
+}
+
+void PluginAudioProcessor::Synth::renderVoices(AudioSampleBuffer& outputAudio, int startSample, int numSamples)
+{
+    for (int done = 0; done < numSamples; done += internalBlockSize) {
+        renderVoicesChunk(outputAudio, startSample + done, jmin(internalBlockSize, numSamples - done));
+    }
+}
+
+void PluginAudioProcessor::Synth::renderVoicesChunk(AudioSampleBuffer& outputAudio, int startSample, int numSamples)
+{
+    renderGlobalLfos(numSamples);
+
+    if (params.parallelVoices.getStep() == eOnOffToggle::eOn && workerPool.getNumWorkers() > 0) {
+        workerPool.render(voices, outputAudio, startSample, numSamples);
+    } else if (params.voiceBankMode.getStep() == eOnOffToggle::eOn) {
+        renderVoiceBank(outputAudio, startSample, numSamples);
+    } else {
+        Synthesiser::renderVoices(outputAudio, startSample, numSamples);
+    }
+#if SYNISTER_NOTE_LATENCY
+    params.telemetry.notes.voicesRendered(startSample + numSamples);
+#endif
+}
+
+void PluginAudioProcessor::Synth::renderVoiceBank(AudioSampleBuffer& outputAudio, int startSample, int numSamples)
+{
+    Synth* const self = this;
+    AudioSampleBuffer* const output = &outputAudio;
+    renderVoiceLanes(&self, &output, 1, startSample, numSamples);
+}
+
+void PluginAudioProcessor::Synth::renderVoiceLanes(Synth* const* synths, AudioSampleBuffer* const* outputs, int numSynths, int startSample, int numSamples)
+{
+    // the patch is the same, the banks, the plan and the snapshot of the first synth serve all of them
+    Synth& lead = *synths[0];
+    SynthParams& params = lead.params;
+    VoiceBank& voiceBank = lead.voiceBank;
+    FilterBank& filterBank = lead.filterBank;
+    std::array<Voice*, VoiceBank::numLanes> group;
+    std::array<AudioSampleBuffer*, VoiceBank::numLanes> groupOutput;
+    int s = 0;
+    int v = lead.voices.size();
+
+    while (s < numSynths) {
+        // collect the next group of voices which have something to render, across the synths
+        int numActive = 0;
+        while (s < numSynths && numActive < VoiceBank::numLanes) {
+            if (v == 0) {
+                if (++s < numSynths) {
+                    v = synths[s]->voices.size();
+                }
+                continue;
+            }
+            Voice* voice = static_cast<Voice*>(synths[s]->voices.getUnchecked(--v));
+            if (voice->hasTake()) {
+                // recorded or played alone, see NoteCache
+                voice->renderNextBlock(*outputs[s], startSample, numSamples);
+            } else if (voice->beginBlock(numSamples)) {
+                groupOutput[numActive] = outputs[s];
+                group[numActive++] = voice;
+            }
+        }
+        if (numActive == 0) {
+            break;
+        }
+        SYNISTER_SCOPE("voice bank group");
+
+        if (group[0]->getFilterRouting() == eFilterRouting::ePostMix) {
+            // the shared filters need the mix of all oscillators of a voice, render the voices one by one
+            for (int l = 0; l < numActive; ++l) {
+                group[l]->renderPostMix(*groupOutput[l], startSample, numSamples);
+            }
+        } else {
+            const RenderPlan& plan = params.getRenderPlan();
+            for (int i = 0; i < plan.numActiveOscillators; ++i) {
+                const size_t o = static_cast<size_t>(plan.oscillators[i]);
+                if (!plan.isBankOscillator(o)) {
+                    // table lookups, samples, oversampled oscillators and unison, whose copies are lanes already, are rendered voice by voice
+                    for (int l = 0; l < numActive; ++l) {
+                        if (group[l]->isOscillatorAudible(o, numSamples)) {
+                            group[l]->renderOscillator(o, numSamples);
+                            group[l]->mixOscillator(o, *groupOutput[l], startSample, numSamples);
+                        } else {
+                            group[l]->skipOscillator(o, numSamples);
+                        }
+                    }
+                } else {
+                    // the lanes run together, the group skips the oscillator only if no voice can hear it
+                    bool audible = false;
+                    for (int l = 0; l < numActive && !audible; ++l) {
+                        audible = group[l]->isOscillatorAudible(o, numSamples);
+                    }
+                    if (!audible) {
+                        for (int l = 0; l < numActive; ++l) {
+                            group[l]->skipOscillator(o, numSamples);
+                        }
+                        continue;
+                    }
+
+                    const ParamSnapshot::Osc& snap = params.getSnapshot().osc[o];
+                    const float shapeMin = snap.waveForm == eOscWaves::eOscSaw ? snap.trngMin : snap.pulseWidthMin;
+                    const float shapeMax = snap.waveForm == eOscWaves::eOscSaw ? snap.trngMax : snap.pulseWidthMax;
+
+                    voiceBank.begin(numSamples, numActive);
+                    for (int l = 0; l < numActive; ++l) {
+                        group[l]->loadBankLane(o, voiceBank, l);
+                    }
+                    voiceBank.render(snap.waveForm, snap.bandLimited, shapeMin, shapeMax);
+                    for (int l = 0; l < numActive; ++l) {
+                        group[l]->storeBankLane(o, voiceBank, l);
+                    }
+
+                    // the filters of the group in lanes as well, unless the settings have no lane version
+                    for (int j = 0; j < plan.numActiveFilters; ++j) {
+                        const size_t f = static_cast<size_t>(plan.filters[j]);
+                        const ParamSnapshot::Filter& filterSnap = params.getSnapshot().filter[f];
+                        if (plan.isBankFilter(f)) {
+                            filterBank.begin(filterSnap, static_cast<float>(lead.getSampleRate()), numSamples, numActive);
+                            for (int l = 0; l < numActive; ++l) {
+                                group[l]->loadFilterLane(o, f, filterBank, l);
+                            }
+                            filterBank.render(params.getSnapshot().mathAccuracy);
+                            for (int l = 0; l < numActive; ++l) {
+                                group[l]->storeFilterLane(o, f, filterBank, l);
+                            }
+                        } else {
+                            for (int l = 0; l < numActive; ++l) {
+                                group[l]->filterScratch(o, f, numSamples);
+                            }
+                        }
+                    }
+
+                    for (int l = 0; l < numActive; ++l) {
+                        group[l]->mixOscillator(o, *groupOutput[l], startSample, numSamples);
+                    }
+                }
+            }
+        }
+
+        for (int l = 0; l < numActive; ++l) {
+            group[l]->endBlock(numSamples);
+        }
+    }
+}
+
+void PluginAudioProcessor::Synth::renderNextBlockBatch(Synth* const* synths, AudioSampleBuffer* const* outputs, const MidiBuffer* const* midi,
+                                                       int numSynths, int numSamples)
+{
+    // the loop of Synthesiser::renderNextBlock(), the n-th events of the synths are at the same position;
+    // offline, no other thread plays the synths, so their locks are not taken
+    std::array<ScopedPointer<MidiBuffer::Iterator>, maxBatchSize> iterators;
+    std::array<MidiMessage, maxBatchSize> events;
+    for (int i = 0; i < numSynths; ++i) {
+        iterators[i] = new MidiBuffer::Iterator(*midi[i]);
+    }
+    const int minimumSubBlockSize = jmax(1, static_cast<int>(synths[0]->params.renderSubdivision.get()));
+    int eventPos = 0;
+
+    // the next event of every synth, false after the last one
+    auto readEvents = [&] {
+        bool found = false;
+        for (int i = 0; i < numSynths; ++i) {
+            found = iterators[i]->getNextEvent(events[i], eventPos) || found;
+        }
+        return found;
+    };
+    auto handleEvents = [&] {
+        for (int i = 0; i < numSynths; ++i) {
+            synths[i]->handleMidiEvent(events[i]);
+        }
+    };
+    // like renderVoices(), in pieces of internalBlockSize
+    auto render = [&](int startSample, int n) {
+        for (int done = 0; done < n; done += internalBlockSize) {
+            const int chunk = jmin(internalBlockSize, n - done);
+            for (int i = 0; i < numSynths; ++i) {
+                synths[i]->renderGlobalLfos(chunk);
+            }
+            renderVoiceLanes(synths, outputs, numSynths, startSample + done, chunk);
+#if SYNISTER_NOTE_LATENCY
+            for (int i = 0; i < numSynths; ++i) {
+                synths[i]->params.telemetry.notes.voicesRendered(startSample + done + chunk);
+            }
+#endif
+        }
+    };
+
+    int startSample = 0;
+    while (numSamples > 0) {
+        if (!readEvents()) {
+            render(startSample, numSamples);
+            return;
+        }
+        const int samplesToNextEvent = eventPos - startSample;
+        if (samplesToNextEvent >= numSamples) {
+            render(startSample, numSamples);
+            handleEvents();
+            break;
+        }
+        if (samplesToNextEvent < minimumSubBlockSize) {
+            handleEvents();
+            continue;
+        }
+        render(startSample, samplesToNextEvent);
+        handleEvents();
+        startSample += samplesToNextEvent;
+        numSamples -= samplesToNextEvent;
+    }
+    while (readEvents()) {
+        handleEvents();
+    }
+}
+
+void PluginAudioProcessor::fillMemoryFootprint(MemoryFootprint& m) const
+{
+    synth.fillMemoryFootprint(m);
+    m.instance[MemoryFootprint::eDelay] = delay.getMemoryBytes();
+    m.instance[MemoryFootprint::eChorus] = chorus.getMemoryBytes();
+    m.instance[MemoryFootprint::eReverb] = reverb.getMemoryBytes();
+    m.instance[MemoryFootprint::eOtherFx] = static_cast<int64>(sizeof(lowFi) + sizeof(clip) + sizeof(fxChain) + sizeof(masterOutput) + sizeof(masterLimiter))
+        + masterLimiter.getMemoryBytes() + lowFi.getMemoryBytes() + clip.getMemoryBytes() + shaper.getMemoryBytes();
+    m.instance[MemoryFootprint::eParams] = static_cast<int64>(sizeof(SynthParams) + sizeof(ParamSnapshot)
+                                                              + getParameters().size() * sizeof(HostParam<Param>));
+    m.instance[MemoryFootprint::eNoteCache] += freeze.getMemoryBytes();
+    m.instance[MemoryFootprint::eEngine] += engineResampler.getMemoryBytes() + fxPipeline.getMemoryBytes()
+        + static_cast<int64>(getNumMainChannels()) * DelayCompensation::maxDelay * static_cast<int64>(sizeof(float));
+
+    m.shared[MemoryFootprint::eDspTables] = static_cast<int64>(sizeof(DspTables));
+    m.shared[MemoryFootprint::eSamples] = osc[0].sample.getLibrary().getMappedBytes();
+}
+
+void PluginAudioProcessor::Synth::fillMemoryFootprint(MemoryFootprint& m) const
+{
+    m.instance[MemoryFootprint::eVoicePool] = static_cast<int64>(voices.size()) * static_cast<int64>(sizeof(Voice));
+    m.instance[MemoryFootprint::eVoiceBuffers] = static_cast<int64>(voiceArenaSize * sizeof(float))
+        + static_cast<int64>(globalLfo.size()) * internalBlockSize * static_cast<int64>(sizeof(float));
+    m.instance[MemoryFootprint::eNoteCache] = noteCache.getMemoryBytes();
+    m.instance[MemoryFootprint::eEngine] = voiceBank.getMemoryBytes() + filterBank.getMemoryBytes() + workerPool.getMemoryBytes();
+    if (voices.size() > 0) {
+        // the voices hold the tables, this reference only counts them
+        const SharedWavetables wavetables;
+        m.shared[MemoryFootprint::eWavetables] = wavetables->getMemoryBytes();
+    }
+}
+
+int PluginAudioProcessor::getReportedLatency() const
+{
+    // the waveshaper runs at the engine rate behind the voices
+    const int shaperLatency = FxWaveshaper::getLatency(shaperActivation.getStep() == eOnOffToggle::eOn
+                                                       && shaperOversampling.getStep() == eOnOffToggle::eOn);
+    // the limiter runs at the host rate behind the resampler
+    const int limiterLatency = limiterActivation.getStep() == eOnOffToggle::eOn ? masterLimiter.getLatency() : 0;
+    return (getEngineLatency() + shaperLatency + fxPipeline.getLatency()) * engineResampler.getFactor() + engineResampler.getLatency() + limiterLatency;
+}
+
+int PluginAudioProcessor::getEngineLatency() const
+{
+    const int factor = getOversamplingFactor(oversampling.getStep());
+    if (offlineQuality.getStep() == eOnOffToggle::eOn) {
+        return Decimator::getLatency(jmax(factor, static_cast<int>(offlineOversampling)));
+    }
+    return Decimator::getLatency(factor);
+}
+
+void PluginAudioProcessor::updateHostInfo(const MidiBuffer& midiMessages, int numSamples)
+{
+    // the clock is followed in every block, it only stands in for a host without a position
+    midiClock.process(midiMessages, numSamples);
+
+    // position of the host for the tempo of the block and the editor
     if (AudioPlayHead* pHead = getPlayHead())
     {
-        if (pHead->getCurrentPosition (positionInfo[getAudioIndex()])) {
-            positionIndex.exchange(getGUIIndex());
-            return;
+        const bool failing = !pHead->getCurrentPosition (transport.getAudio());
+        if (failing) {
+            transport.getAudio().resetToDefault();
+        }
+        if (failing != hostPositionFailing) {
+            // once per change, not for every block
+            RtLog::write(failing ? RtLog::eLevel::eWarning : RtLog::eLevel::eInfo,
+                         failing ? "host play head gives no position, default transport" : "host play head gives a position again");
+            hostPositionFailing = failing;
         }
+    } else {
+        transport.getAudio().resetToDefault();
     }
-    positionInfo[getAudioIndex()].resetToDefault();
+    if ((getPlayHead() == nullptr || hostPositionFailing) && midiClock.isLocked()) {
+        // external gear drives the sequencer, the synced lfos and the delay
+        midiClock.fillPosition(transport.getAudio());
+    }
+    tempo.update(transport.getAudio(), engineSampleRate);
+    transport.publish();
 }
 
 //==============================================================================
 bool PluginAudioProcessor::hasEditor() const
 {
-    return true; // (change this to false if you choose to not supply an editor)
+    // the engine library is built without the gui sources
+    return !SYNISTER_ENGINE_ONLY;
 }
 
 AudioProcessorEditor* PluginAudioProcessor::createEditor()
 {
+#if SYNISTER_ENGINE_ONLY
+    return nullptr;
+#else
     return new PluginAudioProcessorEditor (*this);
+#endif
 }
 
 //==============================================================================
 void PluginAudioProcessor::getStateInformation (MemoryBlock& destData)
 {
-    SynthParams::writeXMLPatchHost(destData, eSerializationParams::eAll);
+    // a program the audio thread has not picked up yet, e.g. while the host does not process
+    const int program = pendingProgram.exchange(-1);
+    if (program >= 0) {
+        applyProgram(program);
+    }
+    SynthParams::writeCachedPatchHost(destData);
 }
 
 void PluginAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
 {
-    SynthParams::readXMLPatchHost(data, sizeInBytes, eSerializationParams::eAll);
+    SynthParams::readPatchHost(data, sizeInBytes);
+
+    // the host renders silence while the restored patch warms up, a suspension of the host stays
+    const bool wasSuspended = isSuspended();
+    suspendProcessing(true);
+    warmUp();
+    if (!wasSuspended) {
+        suspendProcessing(false);
+    }
 }
 
 //==============================================================================
@@ -0,0 +1,282 @@
+/*
+  ==============================================================================
+
+    PresetBank.cpp
+    Created: 16 Oct 2026 4:05:31pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "PresetBank.h"
+#include "SynthParams.h"
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+const char* const PresetBank::fileExtension = ".synbank";
+
+namespace {
+    //! the records start on a cache line
+    const size_t recordAlignment = 64;
+
+    size_t alignUp(size_t n, size_t alignment)
+    {
+        return (n + alignment - 1) / alignment * alignment;
+    }
+
+    float toFloat(uint32 bits)
+    {
+        float f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+
+    //! a patch file as it is written to the bank
+    struct BankPreset {
+        String strings[2 + PresetBank::numSampleSlots];   //!< name, tags, samples
+        std::vector<float> values;
+        SeqPattern::Data pattern;
+        bool hasPattern = false;
+    };
+}
+
+PresetBank::PresetBank(const File& f, MemoryMappedFile* m)
+    : file(f)
+    , mapped(m)
+    , data(static_cast<const char*>(m->getData()))
+    , size(m->getSize())
+    , numPresets(0)
+    , numColumns(0)
+    , synthVersion(0.f)
+    , recordSize(0)
+    , columnsOffset(0)
+    , indexOffset(0)
+    , stringsOffset(0)
+    , stringsSize(0)
+    , recordsOffset(0)
+{
+}
+
+PresetBank::Ptr PresetBank::open(const File& file)
+{
+    ScopedPointer<MemoryMappedFile> m = new MemoryMappedFile(file, MemoryMappedFile::readOnly);
+    if (m->getData() == nullptr || m->getSize() < static_cast<size_t>(4 * headerInts)) {
+        return nullptr;
+    }
+    Ptr bank = new PresetBank(file, m.release());
+    return bank->validate() ? bank : nullptr;
+}
+
+bool PresetBank::validate()
+{
+    if (readInt(0) != magic || readInt(4) > formatVersion) {
+        return false;
+    }
+    synthVersion = toFloat(readInt(8));
+    numPresets = static_cast<int>(readInt(12));
+    numColumns = static_cast<int>(readInt(16));
+    recordSize = readInt(20);
+    columnsOffset = readInt(24);
+    indexOffset = readInt(28);
+    stringsOffset = readInt(32);
+    stringsSize = readInt(36);
+    recordsOffset = readInt(40);
+
+    // in size_t, so a damaged count cannot overflow
+    const size_t presets = static_cast<size_t>(numPresets);
+    const size_t columns = static_cast<size_t>(numColumns);
+    return numPresets >= 0 && numColumns >= 0
+        && recordSize >= 4 * (1 + columns + SeqPattern::maxSteps)
+        && columnsOffset + 4 * columns <= size
+        && indexOffset + 8 * nIndexStrings * presets <= size
+        && stringsOffset + stringsSize <= size
+        && recordsOffset <= size && presets <= (size - recordsOffset) / recordSize;
+}
+
+uint32 PresetBank::readInt(size_t offset) const
+{
+    return ByteOrder::littleEndianInt(data + offset);
+}
+
+String PresetBank::getString(int preset, int which) const
+{
+    if (!isPositiveAndBelow(preset, numPresets)) {
+        return String();
+    }
+    const size_t ref = indexOffset + 8 * (static_cast<size_t>(preset) * nIndexStrings + static_cast<size_t>(which));
+    const size_t offset = readInt(ref);
+    const size_t length = readInt(ref + 4);
+    if (offset > stringsSize || length > stringsSize - offset) {
+        return String();
+    }
+    return String::fromUTF8(data + stringsOffset + offset, static_cast<int>(length));
+}
+
+String PresetBank::getName(int preset) const
+{
+    return getString(preset, eName);
+}
+
+StringArray PresetBank::getTags(int preset) const
+{
+    StringArray tags = StringArray::fromTokens(getString(preset, eTags), ",", "");
+    tags.trim();
+    tags.removeEmptyStrings();
+    return tags;
+}
+
+void PresetBank::search(const String& text, Array<int>& dst) const
+{
+    dst.clearQuick();
+    for (int p = 0; p < numPresets; ++p) {
+        if (text.isEmpty() || getString(p, eName).containsIgnoreCase(text) || getString(p, eTags).containsIgnoreCase(text)) {
+            dst.add(p);
+        }
+    }
+}
+
+bool PresetBank::readPreset(int preset, const SynthParams& params, PatchValues& dst) const
+{
+    if (!isPositiveAndBelow(preset, numPresets)) {
+        return false;
+    }
+    const size_t record = recordsOffset + static_cast<size_t>(preset) * recordSize;
+
+    // columns of params this version does not know are skipped, like unknown ids of the chunk
+    dst.numValues = 0;
+    for (int c = 0; c < numColumns; ++c) {
+        Param* param = params.idRegistry[readInt(columnsOffset + 4 * static_cast<size_t>(c))];
+        const float value = toFloat(readInt(record + 4 * static_cast<size_t>(1 + c)));
+        if (param != nullptr && !std::isnan(value) && dst.numValues < static_cast<int>(dst.values.size())) {
+            dst.values[dst.numValues++] = std::make_pair(param, value);
+        }
+    }
+
+    dst.hasPattern = (readInt(record) & hasPatternFlag) != 0;
+    if (dst.hasPattern) {
+        const size_t steps = record + 4 * static_cast<size_t>(1 + numColumns);
+        for (size_t s = 0; s < dst.pattern.size(); ++s) {
+            dst.pattern[s] = readInt(steps + 4 * s);
+        }
+    }
+
+    // like a complete patch, an oscillator without a sample file plays none
+    dst.hasSamples = true;
+    dst.samples.fill(nullptr);
+    for (int o = 0; o < numSampleSlots && o < static_cast<int>(params.osc.size()); ++o) {
+        const String path = getString(preset, eFirstSample + o);
+        if (path.isNotEmpty()) {
+            params.osc[0].sample.getLibrary().load(File(path), dst.samples[static_cast<size_t>(o)]);
+        }
+    }
+    return true;
+}
+
+String PresetBank::write(const Array<File>& patches, const File& dst, const SynthParams& params)
+{
+    // the columns are the serialized params of this version
+    StringArray tags;
+    for (HashMap<String, Param*>::Iterator i(params.serializeRegistry); i.next();) {
+        tags.add(i.getKey());
+    }
+    tags.sort(false);
+    HashMap<String, int> columnOfTag(jmax(101, 2 * tags.size()));
+    for (int c = 0; c < tags.size(); ++c) {
+        columnOfTag.set(tags[c], c);
+    }
+
+    std::vector<BankPreset> presets(static_cast<size_t>(patches.size()));
+    for (int p = 0; p < patches.size(); ++p) {
+        const File& f = patches.getReference(p);
+        ScopedPointer<XmlElement> patch = XmlDocument::parse(f);
+        if (patch == nullptr || patch->getTagName() != "patch") {
+            return "no patch: " + f.getFullPathName();
+        }
+
+        BankPreset& preset = presets[static_cast<size_t>(p)];
+        const String name = patch->getStringAttribute("patchname");
+        preset.strings[eName] = name.isNotEmpty() ? name : f.getFileNameWithoutExtension();
+        preset.strings[eTags] = patch->getStringAttribute("tags");
+        preset.values.assign(static_cast<size_t>(tags.size()), std::numeric_limits<float>::quiet_NaN());
+        // a sparse patch leaves out the params at their default, the record stays complete
+        if (patch->getBoolAttribute(SynthParams::sparseAttribute)) {
+            for (int c = 0; c < tags.size(); ++c) {
+                preset.values[static_cast<size_t>(c)] = params.serializeRegistry[tags[c]]->getDefaultUI();
+            }
+            SeqPattern::getDefaultData(preset.pattern);
+            preset.hasPattern = true;
+        }
+        // in the order of the xml, so a repeated element wins like in parsePatch()
+        forEachXmlChildElement(*patch, element) {
+            if (columnOfTag.contains(element->getTagName())) {
+                preset.values[static_cast<size_t>(columnOfTag[element->getTagName()])] = static_cast<float>(element->getDoubleAttribute("value"));
+            } else if (element->hasTagName(SynthParams::seqPatternTag)) {
+                preset.hasPattern = SeqPattern::fromString(element->getStringAttribute("steps"), preset.pattern);
+            } else if (element->hasTagName(SynthParams::oscSampleTag)) {
+                const int o = element->getIntAttribute("osc", -1);
+                if (o >= 0 && o < numSampleSlots) {
+                    preset.strings[eFirstSample + o] = element->getStringAttribute("file");
+                }
+            }
+        }
+    }
+
+    // the string table, then the offsets of everything
+    MemoryOutputStream strings;
+    std::vector<StringRef> refs;
+    refs.reserve(presets.size() * nIndexStrings);
+    for (const BankPreset& preset : presets) {
+        for (const String& s : preset.strings) {
+            const StringRef ref = { static_cast<uint32>(strings.getPosition()), static_cast<uint32>(s.getNumBytesAsUTF8()) };
+            refs.push_back(ref);
+            strings.write(s.toRawUTF8(), ref.length);
+        }
+    }
+    const size_t numColumns = static_cast<size_t>(tags.size());
+    const size_t columnsOffset = 4 * headerInts;
+    const size_t indexOffset = columnsOffset + 4 * numColumns;
+    const size_t stringsOffset = indexOffset + 8 * refs.size();
+    const size_t recordsOffset = alignUp(stringsOffset + strings.getDataSize(), recordAlignment);
+    const size_t recordSize = 4 * (1 + numColumns + SeqPattern::maxSteps);
+
+    MemoryOutputStream out;
+    out.preallocate(static_cast<int64>(recordsOffset + presets.size() * recordSize));
+    out.writeInt(static_cast<int>(magic));
+    out.writeInt(static_cast<int>(formatVersion));
+    out.writeFloat(params.version);
+    out.writeInt(static_cast<int>(presets.size()));
+    out.writeInt(static_cast<int>(numColumns));
+    out.writeInt(static_cast<int>(recordSize));
+    out.writeInt(static_cast<int>(columnsOffset));
+    out.writeInt(static_cast<int>(indexOffset));
+    out.writeInt(static_cast<int>(stringsOffset));
+    out.writeInt(static_cast<int>(strings.getDataSize()));
+    out.writeInt(static_cast<int>(recordsOffset));
+    out.writeInt(0);
+
+    for (const String& tag : tags) {
+        out.writeInt(static_cast<int>(SynthParams::getParamId(tag)));
+    }
+    for (const StringRef& ref : refs) {
+        out.writeInt(static_cast<int>(ref.offset));
+        out.writeInt(static_cast<int>(ref.length));
+    }
+    out.write(strings.getData(), strings.getDataSize());
+    out.writeRepeatedByte(0, recordsOffset - static_cast<size_t>(out.getPosition()));
+
+    for (const BankPreset& preset : presets) {
+        out.writeInt(static_cast<int>(preset.hasPattern ? hasPatternFlag : 0u));
+        for (float value : preset.values) {
+            out.writeFloat(value);
+        }
+        for (size_t s = 0; s < preset.pattern.size(); ++s) {
+            out.writeInt(preset.hasPattern ? static_cast<int>(preset.pattern[s]) : 0);
+        }
+    }
+
+    if (!dst.replaceWithData(out.getData(), out.getDataSize())) {
+        return "cannot write " + dst.getFullPathName();
+    }
+    return String();
+}
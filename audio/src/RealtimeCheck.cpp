@@ -0,0 +1,214 @@
+/*
+  ==============================================================================
+
+    RealtimeCheck.cpp
+    Created: 15 Oct 2026 4:21:36am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "RealtimeCheck.h"
+
+#if SYNISTER_REALTIME_CHECKS
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if JUCE_LINUX
+ #include <pthread.h>
+ // the glibc implementations behind the hooks below
+ extern "C" {
+     void* __libc_malloc(size_t);
+     void* __libc_calloc(size_t, size_t);
+     void* __libc_realloc(void*, size_t);
+     void __libc_free(void*);
+     int __pthread_mutex_lock(pthread_mutex_t*);
+ }
+#elif JUCE_WINDOWS && defined (_DEBUG)
+ #include <crtdbg.h>
+#endif
+
+#if JUCE_LINUX
+ // the lazy allocation of the dynamic tls model would call the malloc hook from within itself
+ #define SYNISTER_RT_THREAD_LOCAL thread_local __attribute__((tls_model("initial-exec")))
+#else
+ #define SYNISTER_RT_THREAD_LOCAL thread_local
+#endif
+
+namespace {
+    SYNISTER_RT_THREAD_LOCAL int audioDepth = 0;        //!< nesting of ScopedAudioThread
+    SYNISTER_RT_THREAD_LOCAL int allowDepth = 0;        //!< nesting of ScopedAllow
+    SYNISTER_RT_THREAD_LOCAL bool reporting = false;    //!< the report allocates and locks itself
+
+    std::atomic<int> violationCount(0);
+    std::atomic<int64> allocationCount(0);
+
+    void countAllocation() {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //! hashes of the backtraces already written to the log
+    const int maxReported = 256;
+    int reportedHashes[maxReported];
+    int numReported = 0;
+    SpinLock reportLock;    //!< a SpinLock does not go through the hooked mutex
+
+    bool isChecking() {
+        return audioDepth > 0 && allowDepth == 0 && !reporting;
+    }
+
+    //! \brief true the first time a backtrace is seen
+    bool isNewReport(int hash) {
+        const SpinLock::ScopedLockType sl(reportLock);
+        for (int i = 0; i < numReported; ++i) {
+            if (reportedHashes[i] == hash) {
+                return false;
+            }
+        }
+        if (numReported < maxReported) {
+            reportedHashes[numReported++] = hash;
+        }
+        return true;
+    }
+}
+
+RealtimeCheck::ScopedAudioThread::ScopedAudioThread() { ++audioDepth; }
+RealtimeCheck::ScopedAudioThread::~ScopedAudioThread() { --audioDepth; }
+
+RealtimeCheck::ScopedAllow::ScopedAllow() { ++allowDepth; }
+RealtimeCheck::ScopedAllow::~ScopedAllow() { --allowDepth; }
+
+void RealtimeCheck::violation(const char* what)
+{
+    if (!isChecking()) {
+        return;
+    }
+    reporting = true;
+    violationCount.fetch_add(1);
+
+    const String trace = SystemStats::getStackBacktrace();
+    if (isNewReport(trace.hashCode())) {
+        Logger::writeToLog("realtime violation on the audio thread: " + String(what) + "\n" + trace);
+    }
+    reporting = false;
+}
+
+int RealtimeCheck::getViolationCount()
+{
+    return violationCount.load();
+}
+
+int64 RealtimeCheck::getAllocationCount()
+{
+    return allocationCount.load();
+}
+
+//==============================================================================
+#if JUCE_LINUX
+// the plugin and the standalone bind these before libc, they cover the C++ allocations as well
+extern "C" {
+    void* malloc(size_t size) {
+        countAllocation();
+        RealtimeCheck::violation("malloc");
+        return __libc_malloc(size);
+    }
+
+    void* calloc(size_t n, size_t size) {
+        countAllocation();
+        RealtimeCheck::violation("calloc");
+        return __libc_calloc(n, size);
+    }
+
+    void* realloc(void* p, size_t size) {
+        countAllocation();
+        RealtimeCheck::violation("realloc");
+        return __libc_realloc(p, size);
+    }
+
+    void free(void* p) {
+        if (p != nullptr) {
+            RealtimeCheck::violation("free");
+        }
+        __libc_free(p);
+    }
+
+    int pthread_mutex_lock(pthread_mutex_t* m) {
+        RealtimeCheck::violation("pthread_mutex_lock");
+        return __pthread_mutex_lock(m);
+    }
+}
+
+#elif JUCE_WINDOWS && defined (_DEBUG)
+namespace {
+    int allocHook(int type, void*, size_t, int blockType, long, const unsigned char*, int) {
+        // the crt allocates for itself while reporting
+        if (blockType != _CRT_BLOCK) {
+            if (type != _HOOK_FREE) {
+                countAllocation();
+            }
+            RealtimeCheck::violation(type == _HOOK_FREE ? "free" : "malloc");
+        }
+        return TRUE;
+    }
+
+    struct AllocHookInstaller {
+        AllocHookInstaller() { _CrtSetAllocHook(allocHook); }
+    } allocHookInstaller;
+}
+
+#else
+// no allocation hook, at least the C++ allocations are seen
+void* operator new(size_t size)
+{
+    countAllocation();
+    RealtimeCheck::violation("operator new");
+    if (void* p = std::malloc(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    countAllocation();
+    RealtimeCheck::violation("operator new[]");
+    if (void* p = std::malloc(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    countAllocation();
+    RealtimeCheck::violation("operator new");
+    return std::malloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    countAllocation();
+    RealtimeCheck::violation("operator new[]");
+    return std::malloc(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    if (p != nullptr) {
+        RealtimeCheck::violation("operator delete");
+    }
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    if (p != nullptr) {
+        RealtimeCheck::violation("operator delete[]");
+    }
+    std::free(p);
+}
+#endif
+
+#endif  // SYNISTER_REALTIME_CHECKS
@@ -0,0 +1,114 @@
+/*
+  ==============================================================================
+
+    RealtimeMemory.cpp
+    Created: 17 Oct 2026 3:41:09pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "RealtimeMemory.h"
+#include "RtLog.h"
+
+#if ! JUCE_WINDOWS
+ #include <sys/mman.h>
+ #include <unistd.h>
+#endif
+
+namespace {
+    size_t getPageSize()
+    {
+#if JUCE_WINDOWS
+        return 4096;
+#else
+        static const size_t pageSize = static_cast<size_t>(jmax(4096L, sysconf(_SC_PAGESIZE)));
+        return pageSize;
+#endif
+    }
+
+#if JUCE_WINDOWS
+    // windows.h is not included, kernel32 is loaded once for the process
+    typedef int (__stdcall *tVirtualLock)(void* address, size_t size);
+
+    tVirtualLock getKernelFunction(const char* name)
+    {
+        static DynamicLibrary kernel32("kernel32.dll");
+        return reinterpret_cast<tVirtualLock>(kernel32.getFunction(name));
+    }
+#endif
+
+    bool lockPages(void* data, size_t bytes)
+    {
+#if JUCE_WINDOWS
+        // the working set of a process is small by default, the lock fails above it
+        static const tVirtualLock virtualLock = getKernelFunction("VirtualLock");
+        return virtualLock != nullptr && virtualLock(data, bytes) != 0;
+#else
+        return mlock(data, bytes) == 0;
+#endif
+    }
+
+    void unlockPages(void* data, size_t bytes)
+    {
+#if JUCE_WINDOWS
+        static const tVirtualLock virtualUnlock = getKernelFunction("VirtualUnlock");
+        if (virtualUnlock != nullptr) {
+            virtualUnlock(data, bytes);
+        }
+#else
+        munlock(data, bytes);
+#endif
+    }
+}
+
+void RealtimeMemory::touchPages(void* data, size_t bytes)
+{
+    if (data == nullptr || bytes == 0) {
+        return;
+    }
+    const size_t pageSize = getPageSize();
+    volatile char* const begin = static_cast<volatile char*>(data);
+    // the first byte, then the first byte of every following page
+    const size_t firstPage = pageSize - reinterpret_cast<pointer_sized_uint>(data) % pageSize;
+    begin[0] = begin[0];
+    for (size_t i = firstPage; i < bytes; i += pageSize) {
+        begin[i] = begin[i];
+    }
+}
+
+void RealtimeMemory::add(void* data, size_t bytes)
+{
+    if (data == nullptr || bytes == 0) {
+        return;
+    }
+    touchPages(data, bytes);
+    if (!locking) {
+        return;
+    }
+    if (!lockPages(data, bytes)) {
+        RtLog::write(RtLog::eLevel::eWarning, "{} bytes of engine memory not locked into RAM, they may page out", static_cast<double>(bytes));
+        return;
+    }
+    const ScopedLock sl(regionLock);
+    locked.push_back({ data, bytes });
+}
+
+void RealtimeMemory::clear()
+{
+    const ScopedLock sl(regionLock);
+    for (const Region& r : locked) {
+        unlockPages(r.data, r.bytes);
+    }
+    locked.clear();
+}
+
+int64 RealtimeMemory::getLockedBytes() const
+{
+    const ScopedLock sl(regionLock);
+    int64 bytes = 0;
+    for (const Region& r : locked) {
+        bytes += static_cast<int64>(r.bytes);
+    }
+    return bytes;
+}
@@ -0,0 +1,107 @@
+/*
+  ==============================================================================
+
+    RealtimeScheduling.cpp
+    Created: 16 Oct 2026 11:08:19pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "RealtimeScheduling.h"
+#include "RtLog.h"
+#include <atomic>
+
+#if JUCE_MAC
+ #include <mach/mach.h>
+ #include <mach/mach_time.h>
+ #include <mach/thread_policy.h>
+ #include <pthread.h>
+#elif ! JUCE_WINDOWS
+ #include <pthread.h>
+ #include <sched.h>
+ #include <cerrno>
+#endif
+
+namespace {
+    std::atomic<int> numPromoted(0);
+    std::atomic<int> numFailed(0);
+    std::atomic<int> lastError(0);
+
+    //! \brief 0 if the system took the thread, its error code otherwise
+    int requestAudioClass(double periodSeconds)
+    {
+#if JUCE_WINDOWS
+        // avrt is not linked, it is loaded once for the process
+        typedef void* (__stdcall *AvSetMmThreadCharacteristics)(const wchar_t* task, unsigned long* taskIndex);
+        static DynamicLibrary avrt("avrt.dll");
+        ignoreUnused(periodSeconds);
+        AvSetMmThreadCharacteristics setTask = reinterpret_cast<AvSetMmThreadCharacteristics>(avrt.getFunction("AvSetMmThreadCharacteristicsW"));
+        if (setTask == nullptr) {
+            return -1;
+        }
+        unsigned long taskIndex = 0;
+        return setTask(L"Pro Audio", &taskIndex) != nullptr ? 0 : 1;
+#elif JUCE_MAC
+        mach_timebase_info_data_t timebase;
+        mach_timebase_info(&timebase);
+        const double ticksPerSecond = 1.e9 * timebase.denom / timebase.numer;
+        // the system refuses a computation above 50 ms
+        thread_time_constraint_policy_data_t policy;
+        policy.period = static_cast<uint32_t>(periodSeconds * ticksPerSecond);
+        policy.computation = static_cast<uint32_t>(jmin(.5 * periodSeconds, .05) * ticksPerSecond);
+        policy.constraint = policy.period;
+        policy.preemptible = 1;
+        return thread_policy_set(pthread_mach_thread_np(pthread_self()), THREAD_TIME_CONSTRAINT_POLICY,
+                                 reinterpret_cast<thread_policy_t>(&policy), THREAD_TIME_CONSTRAINT_POLICY_COUNT);
+#else
+        ignoreUnused(periodSeconds);
+        sched_param param;
+        param.sched_priority = sched_get_priority_max(SCHED_RR);
+        return pthread_setschedparam(pthread_self(), SCHED_RR, &param);
+#endif
+    }
+}
+
+bool RealtimeScheduling::promoteCurrentThread(double periodSeconds)
+{
+    const int error = requestAudioClass(periodSeconds > 0. ? periodSeconds : defaultPeriod);
+    if (error == 0) {
+        numPromoted.fetch_add(1);
+        return true;
+    }
+
+#if JUCE_WINDOWS
+    // the best a normal thread gets, elsewhere it keeps the priority it was started with
+    Thread::setCurrentThreadPriority(10);
+#endif
+    numFailed.fetch_add(1);
+    lastError.store(error);
+    RtLog::write(RtLog::eLevel::eWarning, "thread not scheduled like an audio thread, error {}, on normal priority", error);
+    return false;
+}
+
+int RealtimeScheduling::getNumPromoted()
+{
+    return numPromoted.load();
+}
+
+int RealtimeScheduling::getNumFailed()
+{
+    return numFailed.load();
+}
+
+int RealtimeScheduling::getLastError()
+{
+    return lastError.load();
+}
+
+String RealtimeScheduling::getReport()
+{
+    String text;
+    text << "real-time scheduling: " << getNumPromoted() << " granted";
+    if (getNumFailed() > 0) {
+        text << ", " << getNumFailed() << " refused (error " << getLastError() << ")";
+    }
+    return text;
+}
@@ -0,0 +1,290 @@
+/*
+  ==============================================================================
+
+    RealtimeThreadPool.cpp
+    Created: 15 Oct 2026 1:14:26pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "RealtimeThreadPool.h"
+#include "Denormals.h"
+#include "RealtimeCheck.h"
+#include "RealtimeScheduling.h"
+
+#if JUCE_INTEL
+ #include <xmmintrin.h>
+#endif
+
+namespace {
+    //! \brief tells the core we are spinning, the other hyperthread gets the pipeline
+    inline void spinPause()
+    {
+#if JUCE_INTEL
+        _mm_pause();
+#elif JUCE_ARM && defined (__GNUC__)
+        asm volatile("yield");
+#endif
+    }
+
+    inline uint64 packRange(int first, int end)
+    {
+        return static_cast<uint32>(first) | (static_cast<uint64>(static_cast<uint32>(end)) << 32);
+    }
+}
+
+RealtimeThreadPool::Batch::Batch(JobFunction function, void* context, int n)
+    : jobFunction(function)
+    , jobContext(context)
+    , numJobs(n)
+    , numRanges(0)
+    , remaining(n)
+{
+}
+
+void RealtimeThreadPool::Batch::split(int numParticipants)
+{
+    numRanges = jlimit(1, maxRanges, jmin(numParticipants, numJobs));
+    for (int r = 0; r < numRanges; ++r) {
+        ranges[r].store(packRange(r * numJobs / numRanges, (r + 1) * numJobs / numRanges), std::memory_order_relaxed);
+    }
+}
+
+bool RealtimeThreadPool::Batch::pop(int range, int& job)
+{
+    uint64 r = ranges[range].load(std::memory_order_relaxed);
+    for (;;) {
+        const int first = static_cast<int>(r & 0xffffffffu);
+        const int end = static_cast<int>(r >> 32);
+        if (first >= end) {
+            return false;
+        }
+        if (ranges[range].compare_exchange_weak(r, packRange(first + 1, end), std::memory_order_acquire)) {
+            job = first;
+            return true;
+        }
+    }
+}
+
+bool RealtimeThreadPool::Batch::steal(int range, int& job)
+{
+    uint64 r = ranges[range].load(std::memory_order_relaxed);
+    for (;;) {
+        const int first = static_cast<int>(r & 0xffffffffu);
+        const int end = static_cast<int>(r >> 32);
+        if (first >= end) {
+            return false;
+        }
+        if (ranges[range].compare_exchange_weak(r, packRange(first, end - 1), std::memory_order_acquire)) {
+            job = end - 1;
+            return true;
+        }
+    }
+}
+
+bool RealtimeThreadPool::Batch::work(int range)
+{
+    range %= numRanges;
+    bool any = false;
+    int job;
+    for (;;) {
+        bool found = pop(range, job);
+        for (int k = 1; k < numRanges && !found; ++k) {
+            found = steal((range + k) % numRanges, job);
+        }
+        if (!found) {
+            return any;
+        }
+        jobFunction(jobContext, job);
+        remaining.fetch_sub(1, std::memory_order_release);
+        any = true;
+    }
+}
+
+RealtimeThreadPool::Worker::Worker(RealtimeThreadPool& p, int i)
+    : Thread("realtime worker " + String(i))
+    , sleeping(false)
+    , pool(p)
+    , index(i)
+    , setupGeneration(0)
+    , periodGeneration(-1)
+{
+}
+
+void RealtimeThreadPool::Worker::run()
+{
+    // same floating point mode as in processBlock for the whole life of the worker
+    const ScopedFlushToZero flushToZero;
+    int idle = 0;
+    while (!threadShouldExit()) {
+        pool.scheduleWorker(periodGeneration);
+        pool.setUpWorker(index, setupGeneration);
+        if (index <= pool.numActiveWorkers.load(std::memory_order_relaxed) && pool.workOnBatches(index)) {
+            idle = 0;
+            continue;
+        }
+        if (++idle < workerSpins) {
+            spinPause();
+            continue;
+        }
+
+        // announce the sleep before the last look, a batch published in between wakes us
+        sleeping.store(true);
+        if (!(index <= pool.numActiveWorkers.load() && pool.workOnBatches(index)) && !threadShouldExit()) {
+            wakeEvent.wait();
+        }
+        sleeping.store(false);
+        idle = 0;
+    }
+}
+
+RealtimeThreadPool::RealtimeThreadPool()
+    : numActiveWorkers(0)
+    , workerSetup(nullptr)
+    , setupContext(nullptr)
+    , setupGeneration(0)
+    , blockPeriod(0.)
+    , periodGeneration(0)
+    , numPublished(0)
+{
+    for (int i = 0; i < maxBatches; ++i) {
+        batches[i].store(nullptr);
+        users[i].store(0);
+    }
+
+    // one core stays with the audio thread of the host
+    const int numWorkers = jmax(0, SystemStats::getNumCpus() - 1);
+    for (int w = 1; w <= numWorkers; ++w) {
+        workers.add(new Worker(*this, w))->startThread(9);
+    }
+    numActiveWorkers.store(numWorkers);
+}
+
+RealtimeThreadPool::~RealtimeThreadPool()
+{
+    for (Worker* w : workers) {
+        w->signalThreadShouldExit();
+        w->wakeEvent.signal();
+    }
+    for (Worker* w : workers) {
+        w->stopThread(1000);
+    }
+}
+
+void RealtimeThreadPool::configureWorkers(int numWorkers, WorkerSetup setup, void* context)
+{
+    {
+        const SpinLock::ScopedLockType sl(setupLock);
+        workerSetup = setup;
+        setupContext = context;
+        numActiveWorkers.store(jlimit(0, workers.size(), numWorkers));
+        setupGeneration.fetch_add(1);
+    }
+    // the sleeping workers set themselves up now rather than in the middle of a batch
+    for (Worker* w : workers) {
+        w->wakeEvent.signal();
+    }
+}
+
+void RealtimeThreadPool::setBlockPeriod(double seconds)
+{
+    double period = blockPeriod.load();
+    while ((period == 0. || seconds < period) && !blockPeriod.compare_exchange_weak(period, seconds)) {}
+    if (period == 0. || seconds < period) {
+        periodGeneration.fetch_add(1);
+        for (Worker* w : workers) {
+            w->wakeEvent.signal();
+        }
+    }
+}
+
+void RealtimeThreadPool::scheduleWorker(int& generation)
+{
+    const int current = periodGeneration.load(std::memory_order_acquire);
+    if (current != generation) {
+        generation = current;
+        RealtimeScheduling::promoteCurrentThread(blockPeriod.load());
+    }
+}
+
+void RealtimeThreadPool::setUpWorker(int worker, int& generation)
+{
+    const int current = setupGeneration.load(std::memory_order_acquire);
+    if (current == generation) {
+        return;
+    }
+    const SpinLock::ScopedLockType sl(setupLock);
+    generation = setupGeneration.load();
+    if (workerSetup != nullptr) {
+        workerSetup(setupContext, worker);
+    }
+}
+
+void RealtimeThreadPool::run(Batch& batch)
+{
+    const int numActive = numActiveWorkers.load(std::memory_order_relaxed);
+    batch.split(numActive + 1);
+
+    int slot = -1;
+    if (batch.numRanges > 1) {
+        for (int i = 0; i < maxBatches && slot < 0; ++i) {
+            Batch* expected = nullptr;
+            if (batches[i].compare_exchange_strong(expected, &batch)) {
+                slot = i;
+            }
+        }
+    }
+
+    if (slot >= 0) {
+        numPublished.fetch_add(1);
+        // the wake up takes the mutex of the event, known and accepted for now
+        const RealtimeCheck::ScopedAllow wakeUp;
+        int toWake = batch.numRanges - 1;
+        for (int w = 0; w < numActive && toWake > 0; ++w) {
+            if (workers.getUnchecked(w)->sleeping.load()) {
+                workers.getUnchecked(w)->wakeEvent.signal();
+                --toWake;
+            }
+        }
+    }
+
+    // the calling thread works on its own range first, unpublished it does all jobs
+    batch.work(0);
+
+    for (int spins = 0; batch.remaining.load(std::memory_order_acquire) > 0; ++spins) {
+        // the last jobs run on the workers
+        if (spins < callerSpins) {
+            spinPause();
+        } else {
+            Thread::yield();
+        }
+    }
+
+    if (slot >= 0) {
+        batches[slot].store(nullptr);
+        numPublished.fetch_sub(1);
+        while (users[slot].load() > 0) {
+            // a worker looked at the batch just before it was taken back
+            spinPause();
+        }
+    }
+}
+
+bool RealtimeThreadPool::workOnBatches(int participant)
+{
+    if (numPublished.load() == 0) {
+        return false;
+    }
+
+    bool any = false;
+    for (int i = 0; i < maxBatches; ++i) {
+        users[i].fetch_add(1);
+        if (Batch* b = batches[i].load()) {
+            const RealtimeCheck::ScopedAudioThread realtimeCheck;
+            any = b->work(participant) || any;
+        }
+        users[i].fetch_sub(1);
+    }
+    return any;
+}
@@ -0,0 +1,224 @@
+/*
+  ==============================================================================
+
+    RtLog.cpp
+    Created: 16 Oct 2026 6:48:35pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "RtLog.h"
+#include <array>
+#include <atomic>
+#include <cmath>
+
+namespace {
+    struct Record {
+        std::atomic<uint64> sequence;   //!< index + 1 of the record in the slot, 0 while empty
+        const char* format;
+        int64 millis;
+        double args[4];
+        char text[RtLog::maxTextBytes];
+        int thread;
+        RtLog::eLevel level;
+        bool hasText;
+    };
+
+    const int ringSize = 1 << 12;
+    const uint64 ringMask = ringSize - 1;
+
+    // zero in static storage, a thread may log before anything of the process is constructed
+    std::array<Record, ringSize> ring;
+    std::atomic<uint64> head;
+    std::atomic<int64> dropped;
+
+    std::atomic<int> nextThreadId(1);
+    //! \brief small number of the calling thread
+    int getThreadId()
+    {
+        static thread_local int id = nextThreadId.fetch_add(1);
+        return id;
+    }
+
+    Record& claim(RtLog::eLevel level, const char* format, uint64& index)
+    {
+        index = head.fetch_add(1, std::memory_order_relaxed);
+        Record& r = ring[static_cast<size_t>(index & ringMask)];
+        // a writer that reads the slot sees it is not complete
+        r.sequence.store(0, std::memory_order_relaxed);
+        r.format = format;
+        r.millis = Time::currentTimeMillis();
+        r.thread = getThreadId();
+        r.level = level;
+        return r;
+    }
+
+    const char* getLevelName(RtLog::eLevel level)
+    {
+        switch (level) {
+        case RtLog::eLevel::eWarning: return "warning";
+        case RtLog::eLevel::eError:   return "error";
+        default:                      return "info";
+        }
+    }
+
+    String formatNumber(double v)
+    {
+        return v == std::floor(v) && std::abs(v) < 1.e15 ? String(static_cast<int64>(v)) : String(v, 3);
+    }
+
+    //! \brief the format with its "{}" replaced, the text first if there is one
+    String format(const char* format, const char* text, const double* args)
+    {
+        String line;
+        int arg = text != nullptr ? -1 : 0;
+        for (const char* c = format; *c != 0; ++c) {
+            if (c[0] == '{' && c[1] == '}') {
+                if (arg < 0) {
+                    line << String::fromUTF8(text);
+                } else if (arg < 4) {
+                    line << formatNumber(args[arg]);
+                }
+                ++arg;
+                ++c;
+            } else {
+                line << *c;
+            }
+        }
+        return line;
+    }
+}
+
+void RtLog::write(eLevel level, const char* format, double a, double b, double c, double d)
+{
+    uint64 index;
+    Record& r = claim(level, format, index);
+    r.args[0] = a;
+    r.args[1] = b;
+    r.args[2] = c;
+    r.args[3] = d;
+    r.hasText = false;
+    r.sequence.store(index + 1, std::memory_order_release);
+}
+
+void RtLog::writeText(eLevel level, const char* format, const char* text, double a, double b, double c)
+{
+    uint64 index;
+    Record& r = claim(level, format, index);
+    r.args[0] = a;
+    r.args[1] = b;
+    r.args[2] = c;
+    r.args[3] = 0.;
+    // the bytes up to the limit, a cut UTF-8 sequence is dropped by the formatting
+    int n = 0;
+    for (; text != nullptr && text[n] != 0 && n < maxTextBytes - 1; ++n) {
+        r.text[n] = text[n];
+    }
+    r.text[n] = 0;
+    r.hasText = true;
+    r.sequence.store(index + 1, std::memory_order_release);
+}
+
+int64 RtLog::getNumDropped()
+{
+    return dropped.load();
+}
+
+//==============================================================================
+RtLog::Writer::Writer()
+    : thread("Log Writer")
+   #if JUCE_DEBUG
+    , console(true)
+   #else
+    , console(false)
+   #endif
+{
+    const uint64 end = head.load();
+    tail = end > ringSize ? end - ringSize : 0;
+
+    const String file = SystemStats::getEnvironmentVariable("SYNISTER_LOG_FILE", String());
+    if (file.isNotEmpty()) {
+        setFile(File::getCurrentWorkingDirectory().getChildFile(file));
+    }
+    thread.addTimeSliceClient(this);
+    thread.startThread(2);
+}
+
+RtLog::Writer::~Writer()
+{
+    thread.removeTimeSliceClient(this);
+    thread.stopThread(2000);
+    const ScopedLock sl(outputLock);
+    drain();
+}
+
+void RtLog::Writer::setFile(const File& file)
+{
+    const ScopedLock sl(outputLock);
+    output = nullptr;
+    if (file != File::nonexistent) {
+        output = file.createOutputStream();
+    }
+}
+
+void RtLog::Writer::setConsoleOutput(bool shouldWrite)
+{
+    const ScopedLock sl(outputLock);
+    console = shouldWrite;
+}
+
+int RtLog::Writer::useTimeSlice()
+{
+    const ScopedLock sl(outputLock);
+    drain();
+    return 50;
+}
+
+void RtLog::Writer::drain()
+{
+    const uint64 end = head.load(std::memory_order_acquire);
+    if (end - tail > ringSize) {
+        // the threads went round the ring since the last drain
+        dropped.fetch_add(static_cast<int64>(end - tail - ringSize));
+        tail = end - ringSize;
+    }
+
+    bool wrote = false;
+    while (tail < end) {
+        Record& r = ring[static_cast<size_t>(tail & ringMask)];
+        if (r.sequence.load(std::memory_order_acquire) != tail + 1) {
+            // claimed but not written yet
+            break;
+        }
+        const char* const recordFormat = r.format;
+        const int64 millis = r.millis;
+        const int threadId = r.thread;
+        const eLevel level = r.level;
+        double args[4] = { r.args[0], r.args[1], r.args[2], r.args[3] };
+        char text[maxTextBytes];
+        const bool hasText = r.hasText;
+        memcpy(text, r.text, sizeof(text));
+        text[maxTextBytes - 1] = 0;
+        // overwritten while it was copied
+        if (r.sequence.load(std::memory_order_acquire) != tail + 1) {
+            dropped.fetch_add(1);
+            ++tail;
+            continue;
+        }
+        ++tail;
+
+        const String line = Time(millis).formatted("%Y-%m-%d %H:%M:%S.") + String(millis % 1000).paddedLeft('0', 3)
+            + " [" + getLevelName(level) + "] t" + String(threadId) + " " + format(recordFormat, hasText ? text : nullptr, args);
+        if (output != nullptr) {
+            output->writeText(line + "\n", false, false);
+            wrote = true;
+        }
+        if (console) {
+            Logger::outputDebugString(line);
+        }
+    }
+    if (wrote) {
+        output->flush();
+    }
+}
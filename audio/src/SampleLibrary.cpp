@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    SampleLibrary.cpp
+    Created: 15 Oct 2026 2:41:18pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "SampleLibrary.h"
+
+namespace {
+    const int64 pageSize = 4096;
+}
+
+MappedSample::MappedSample(const File& f, MemoryMappedAudioFormatReader* r)
+    : file(f)
+    , reader(r)
+{
+}
+
+void MappedSample::prefetch(int64 numSamples) const
+{
+    const int64 bytesPerFrame = jmax(1, static_cast<int>(reader->bitsPerSample / 8 * reader->numChannels));
+    const int64 step = jmax(static_cast<int64>(1), pageSize / bytesPerFrame);
+    const int64 end = jmin(numSamples, getLength());
+    for (int64 i = 0; i < end; i += step) {
+        reader->touchSample(i);
+    }
+}
+
+SampleLibrary::SampleLibrary()
+{
+    formats.registerBasicFormats();
+}
+
+Result SampleLibrary::load(const File& file, const MappedSample*& sample)
+{
+    const ScopedLock sl(lock);
+    for (const MappedSample* s : samples) {
+        if (s->getFile() == file) {
+            sample = s;
+            return Result::ok();
+        }
+    }
+
+    if (!file.existsAsFile()) {
+        return Result::fail("File not found: " + file.getFullPathName());
+    }
+    AudioFormat* format = formats.findFormatForFileExtension(file.getFileExtension());
+    ScopedPointer<MemoryMappedAudioFormatReader> reader(format != nullptr ? format->createMemoryMappedReader(file) : nullptr);
+    if (reader == nullptr) {
+        return Result::fail("Not a wav or aiff file: " + file.getFileName());
+    }
+    if (!reader->mapEntireFile()) {
+        return Result::fail("The file could not be mapped: " + file.getFileName());
+    }
+    if (reader->numChannels < 1 || reader->numChannels > 2 || reader->lengthInSamples < 2) {
+        return Result::fail("Only mono and stereo samples can be played: " + file.getFileName());
+    }
+
+    MappedSample* s = samples.add(new MappedSample(file, reader.release()));
+    s->prefetch(s->getLength());
+    sample = s;
+    return Result::ok();
+}
+
+int64 SampleLibrary::getMappedBytes() const
+{
+    const ScopedLock sl(lock);
+    int64 bytes = 0;
+    for (const MappedSample* s : samples) {
+        bytes += s->getFile().getSize();
+    }
+    return bytes;
+}
+
+Result SampleSlot::load(const File& file)
+{
+    const MappedSample* s = nullptr;
+    const Result result = library->load(file, s);
+    if (result.wasOk()) {
+        set(s);
+    }
+    return result;
+}
+
+File SampleSlot::getFile() const
+{
+    const MappedSample* s = get();
+    return s != nullptr ? s->getFile() : File::nonexistent;
+}
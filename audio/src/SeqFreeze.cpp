@@ -0,0 +1,195 @@
+/*
+  ==============================================================================
+
+    SeqFreeze.cpp
+    Created: 15 Oct 2026 9:41:52pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "SeqFreeze.h"
+#include "Instrument.h"
+
+SeqFreeze::SeqFreeze()
+    : state(eOff)
+    , sampleRate(0.)
+    , loopLength(0.)
+    , samplesPerBeat(0.)
+    , patternVersion(0)
+    , numRestarts(0)
+    , loopSamples(0)
+    , loopFadeSamples(0)
+    , switchFadeSamples(1)
+    , cleanPeriod(false)
+    , recordStart(0)
+    , recorded(0)
+    , blockPhase(0)
+    , playPhase(0)
+    , fadeIn(0)
+    , fadeOut(0)
+    , fadeOutPhase(0)
+    , fadeOutLoop(1)
+{
+}
+
+void SeqFreeze::prepare(const SynthParams& params, int numChannels, double rate)
+{
+    sampleRate = rate;
+    loopFadeSamples = jmax(1, static_cast<int>(loopFadeSeconds * rate));
+    switchFadeSamples = jmax(1, static_cast<int>(switchFadeSeconds * rate));
+    recording.setSize(numChannels, static_cast<int>(maxSeconds * rate) + loopFadeSamples);
+    recording.clear();
+
+    // the first beginBlock() compares with this state, it matches no block
+    lastState.prepare(params);
+    state = eOff;
+    fadeOut = 0;
+}
+
+void SeqFreeze::release()
+{
+    recording.setSize(0, 0);
+    state = eOff;
+    fadeOut = 0;
+}
+
+void SeqFreeze::thaw()
+{
+    if (state == eFrozen) {
+        SYNISTER_COUNT("sequencer thaws", 1);
+        fadeOut = switchFadeSamples;
+        fadeOutPhase = playPhase;
+        fadeOutLoop = loopSamples;
+    }
+    state = eClean;
+    cleanPeriod = false;
+}
+
+void SeqFreeze::beginBlock(const SynthParams& params, const StepSequencer& seq, const MidiBuffer& hostMidi, int numSamples)
+{
+    if (!isPrepared()) {
+        return;
+    }
+
+    // compared every block, so a change is seen once
+    const bool patchChanged = lastState.hasChanged(params);
+
+    const double position = seq.getBlockPosition();
+    const double length = seq.getLoopLength();
+    const bool qualifies = params.seqFreeze.getStep() == eOnOffToggle::eOn && position >= 0. && length > 0.
+        && params.seqPlayMode.getStep() != eSeqPlayModes::eRandom && !PatchState::hasLiveModulation(params);
+    const bool periodChanged = length != loopLength || params.tempo.samplesPerBeat != samplesPerBeat
+        || seq.getEventsVersion() != patternVersion || seq.getNumRestarts() != numRestarts;
+
+    if (!qualifies || patchChanged || periodChanged) {
+        thaw();
+        loopLength = length;
+        samplesPerBeat = params.tempo.samplesPerBeat;
+        patternVersion = seq.getEventsVersion();
+        numRestarts = seq.getNumRestarts();
+        loopSamples = roundToInt(loopLength * samplesPerBeat);
+        // a period longer than the recording plays on the voices
+        if (!qualifies || loopSamples <= 0 || loopSamples + loopFadeSamples > recording.getNumSamples()) {
+            state = eOff;
+            return;
+        }
+    }
+    if (state == eOff) {
+        state = eClean;
+        cleanPeriod = false;
+    }
+
+    // the position in the period follows the host, the frames of a recording stay on its grid
+    blockPhase = roundToInt(std::fmod(position, loopLength) * samplesPerBeat) % loopSamples;
+    const int boundary = blockPhase == 0 ? 0 : loopSamples - blockPhase;
+
+    bool hostNote = false;
+    {
+        MidiBuffer::Iterator it(hostMidi);
+        MidiMessage m;
+        int pos;
+        while (!hostNote && it.getNextEvent(m, pos)) {
+            hostNote = m.isNoteOnOrOff();
+        }
+    }
+
+    switch (state) {
+    case eClean:
+        if (hostNote) {
+            cleanPeriod = false;
+        } else if (boundary < numSamples) {
+            // the second period start without a change is the start of the recording
+            if (cleanPeriod) {
+                state = eRecording;
+                recordStart = boundary;
+                recorded = 0;
+            }
+            cleanPeriod = true;
+        }
+        break;
+    case eRecording:
+        if (hostNote) {
+            state = eClean;
+            cleanPeriod = false;
+        } else if (recorded >= loopSamples + loopFadeSamples) {
+            SYNISTER_COUNT("sequencer freezes", 1);
+            state = eFrozen;
+            fadeIn = 0;
+        } else {
+            recordStart = 0;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void SeqFreeze::notePlayed()
+{
+    if (state == eClean || state == eRecording) {
+        state = eClean;
+        cleanPeriod = false;
+    }
+}
+
+void SeqFreeze::processVoices(AudioSampleBuffer& buffer, int startSample, int numSamples)
+{
+    const int numChannels = jmin(buffer.getNumChannels(), recording.getNumChannels());
+
+    // a thawed recording fades out while the voices come back
+    if (fadeOut > 0) {
+        for (int s = 0; s < numSamples && fadeOut > 0; ++s, --fadeOut) {
+            const float gain = static_cast<float>(fadeOut) / static_cast<float>(switchFadeSamples);
+            for (int c = 0; c < numChannels; ++c) {
+                buffer.addSample(c, startSample + s, recording.getSample(c, fadeOutPhase) * gain);
+            }
+            fadeOutPhase = fadeOutPhase + 1 < fadeOutLoop ? fadeOutPhase + 1 : 0;
+        }
+    }
+
+    if (state == eRecording) {
+        const int first = jmax(startSample, recordStart);
+        const int n = jmin(startSample + numSamples - first, loopSamples + loopFadeSamples - recorded);
+        for (int c = 0; c < numChannels && n > 0; ++c) {
+            recording.copyFrom(c, recorded, buffer, c, first, n);
+        }
+        recorded += jmax(0, n);
+    } else if (state == eFrozen) {
+        // the end of the period fades into its start, the recording fades in over the fading voices
+        int phase = (blockPhase + startSample) % loopSamples;
+        for (int s = 0; s < numSamples; ++s) {
+            const float gain = fadeIn < switchFadeSamples ? static_cast<float>(fadeIn++) / static_cast<float>(switchFadeSamples) : 1.f;
+            const float tail = phase < loopFadeSamples ? 1.f - static_cast<float>(phase) / static_cast<float>(loopFadeSamples) : 0.f;
+            for (int c = 0; c < numChannels; ++c) {
+                float v = recording.getSample(c, phase);
+                if (tail > 0.f) {
+                    v += (recording.getSample(c, loopSamples + phase) - v) * tail;
+                }
+                buffer.addSample(c, startSample + s, v * gain);
+            }
+            phase = phase + 1 < loopSamples ? phase + 1 : 0;
+        }
+        playPhase = phase;
+    }
+}
@@ -0,0 +1,143 @@
+/*
+  ==============================================================================
+
+    SeqPattern.cpp
+    Created: 15 Oct 2026 6:12:37am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "SeqPattern.h"
+
+namespace {
+    //! the defaults of the seqStep params, repeated for the steps after the eighth
+    const uint8 defaultNotes[] = { 60, 62, 64, 65, 67, 69, 71, 72 };
+    const uint8 defaultVelocity = 64;   // 0.5f like the sequencer sent before velocities
+    const uint8 defaultGate = 100;
+}
+
+SeqPattern::SeqPattern()
+    : version(0)
+    , sequence(0)
+    , editDepth(0)
+{
+    Data data;
+    getDefaultData(data);
+    for (int i = 0; i < maxSteps; ++i) {
+        steps[static_cast<size_t>(i)].store(data[static_cast<size_t>(i)], std::memory_order_relaxed);
+    }
+}
+
+SeqPattern::Step SeqPattern::getStep(int step) const
+{
+    return unpack(steps[static_cast<size_t>(jlimit(0, maxSteps - 1, step))].load(std::memory_order_relaxed));
+}
+
+void SeqPattern::setStep(int step, const Step& s)
+{
+    const uint32 packed = pack(s);
+    if (steps[static_cast<size_t>(jlimit(0, maxSteps - 1, step))].exchange(packed, std::memory_order_relaxed) != packed) {
+        version.fetch_add(1, std::memory_order_release);
+    }
+}
+
+void SeqPattern::getData(Data& dst) const
+{
+    for (int i = 0; i < maxSteps; ++i) {
+        dst[static_cast<size_t>(i)] = steps[static_cast<size_t>(i)].load(std::memory_order_relaxed);
+    }
+}
+
+void SeqPattern::setData(const Data& src)
+{
+    const ScopedEdit edit(*this);
+    bool changed = false;
+    for (int i = 0; i < maxSteps; ++i) {
+        // repacked, so a value out of range in a patch is clamped
+        const uint32 packed = pack(unpack(src[static_cast<size_t>(i)]));
+        changed = steps[static_cast<size_t>(i)].exchange(packed, std::memory_order_relaxed) != packed || changed;
+    }
+    if (changed) {
+        version.fetch_add(1, std::memory_order_release);
+    }
+}
+
+void SeqPattern::beginEdit()
+{
+    if (editDepth++ == 0) {
+        sequence.fetch_add(1, std::memory_order_relaxed);
+        // the writes of the edit are not seen before the odd sequence
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+}
+
+void SeqPattern::endEdit()
+{
+    jassert(editDepth > 0);
+    if (--editDepth == 0) {
+        sequence.fetch_add(1, std::memory_order_release);
+    }
+}
+
+bool SeqPattern::readData(Data& dst, uint32& dataVersion, uint32 since) const
+{
+    if ((since & 1u) != 0) {
+        return false;
+    }
+    dataVersion = version.load(std::memory_order_acquire);
+    getData(dst);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return sequence.load(std::memory_order_relaxed) == since;
+}
+
+void SeqPattern::getDefaultData(Data& dst)
+{
+    for (int i = 0; i < maxSteps; ++i) {
+        Step s;
+        s.note = defaultNotes[i % 8];
+        s.velocity = defaultVelocity;
+        s.gate = defaultGate;
+        s.active = true;
+        dst[static_cast<size_t>(i)] = pack(s);
+    }
+}
+
+String SeqPattern::toString(const Data& src)
+{
+    String s;
+    s.preallocateBytes(static_cast<size_t>(maxSteps * 8));
+    for (uint32 packed : src) {
+        s << String::toHexString(static_cast<int>(packed)).paddedLeft('0', 8);
+    }
+    return s;
+}
+
+bool SeqPattern::fromString(const String& s, Data& dst)
+{
+    if (s.length() != maxSteps * 8 || !s.containsOnly("0123456789abcdefABCDEF")) {
+        return false;
+    }
+    for (int i = 0; i < maxSteps; ++i) {
+        dst[static_cast<size_t>(i)] = static_cast<uint32>(s.substring(i * 8, i * 8 + 8).getHexValue32());
+    }
+    return true;
+}
+
+uint32 SeqPattern::pack(const Step& s)
+{
+    return static_cast<uint32>(jmin<int>(s.note, 127))
+        | static_cast<uint32>(jlimit<int>(1, 127, s.velocity)) << 8
+        | static_cast<uint32>(jlimit<int>(1, 100, s.gate)) << 16
+        | (s.active ? 1u : 0u) << 24;
+}
+
+SeqPattern::Step SeqPattern::unpack(uint32 packed)
+{
+    Step s;
+    s.note = static_cast<uint8>(jmin(packed & 0xffu, 127u));
+    s.velocity = static_cast<uint8>(jlimit(1u, 127u, (packed >> 8) & 0xffu));
+    s.gate = static_cast<uint8>(jlimit(1u, 100u, (packed >> 16) & 0xffu));
+    s.active = ((packed >> 24) & 1u) != 0;
+    return s;
+}
@@ -0,0 +1,347 @@
+/*
+  ==============================================================================
+
+    SessionCapture.cpp
+    Created: 16 Oct 2026 11:47:02pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "SessionCapture.h"
+#include "RtLog.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    const char magic[8] = { 'S', 'Y', 'N', 'C', 'A', 'P', '0', '1' };
+
+    //! the payload of a record follows its size and its type
+    enum eRecord : uint8 {
+        eBlock = 'B',
+        eEnd = 'E'
+    };
+
+    enum eBlockFlags : uint8 {
+        eNonRealtime = 1,
+        eHasPosition = 2
+    };
+
+    //! \brief native byte order into a fixed buffer, ok is false once it is full
+    struct Packer {
+        uint8* data;
+        int capacity;
+        int size;
+        bool ok;
+
+        template <typename T>
+        void put(T v) {
+            putBytes(&v, static_cast<int>(sizeof(T)));
+        }
+        void putBytes(const void* src, int n) {
+            if (!ok || size + n > capacity) {
+                ok = false;
+                return;
+            }
+            std::memcpy(data + size, src, static_cast<size_t>(n));
+            size += n;
+        }
+    };
+
+    //! \brief reads what a Packer wrote, ok is false once it read past the end
+    struct Unpacker {
+        const uint8* data;
+        size_t size;
+        size_t pos;
+        bool ok;
+
+        template <typename T>
+        T get() {
+            T v = T();
+            getBytes(&v, sizeof(T));
+            return v;
+        }
+        void getBytes(void* dst, size_t n) {
+            if (!ok || pos + n > size) {
+                ok = false;
+                return;
+            }
+            std::memcpy(dst, data + pos, n);
+            pos += n;
+        }
+        const uint8* skip(size_t n) {
+            if (!ok || pos + n > size) {
+                ok = false;
+                return nullptr;
+            }
+            const uint8* p = data + pos;
+            pos += n;
+            return p;
+        }
+    };
+
+    void packPosition(Packer& p, const AudioPlayHead::CurrentPositionInfo& i)
+    {
+        p.put(i.bpm);
+        p.put(static_cast<int32>(i.timeSigNumerator));
+        p.put(static_cast<int32>(i.timeSigDenominator));
+        p.put(i.timeInSamples);
+        p.put(i.timeInSeconds);
+        p.put(i.editOriginTime);
+        p.put(i.ppqPosition);
+        p.put(i.ppqPositionOfLastBarStart);
+        p.put(static_cast<int32>(i.frameRate));
+        p.put(static_cast<uint8>(i.isPlaying));
+        p.put(static_cast<uint8>(i.isRecording));
+        p.put(i.ppqLoopStart);
+        p.put(i.ppqLoopEnd);
+        p.put(static_cast<uint8>(i.isLooping));
+    }
+
+    void unpackPosition(Unpacker& u, AudioPlayHead::CurrentPositionInfo& i)
+    {
+        i.bpm = u.get<double>();
+        i.timeSigNumerator = u.get<int32>();
+        i.timeSigDenominator = u.get<int32>();
+        i.timeInSamples = u.get<int64>();
+        i.timeInSeconds = u.get<double>();
+        i.editOriginTime = u.get<double>();
+        i.ppqPosition = u.get<double>();
+        i.ppqPositionOfLastBarStart = u.get<double>();
+        i.frameRate = static_cast<AudioPlayHead::FrameRateType>(u.get<int32>());
+        i.isPlaying = u.get<uint8>() != 0;
+        i.isRecording = u.get<uint8>() != 0;
+        i.ppqLoopStart = u.get<double>();
+        i.ppqLoopEnd = u.get<double>();
+        i.isLooping = u.get<uint8>() != 0;
+    }
+}
+
+SessionCapture::SessionCapture()
+    : fifo(ringBytes)
+    , capturing(false)
+    , droppedBlocks(0)
+{
+}
+
+SessionCapture::~SessionCapture()
+{
+    stop();
+}
+
+Result SessionCapture::start(const File& file, const MemoryBlock& state, double sampleRate, int maxBlockSize, int numChannels)
+{
+    stop();
+
+    file.deleteFile();
+    ScopedPointer<FileOutputStream> stream = file.createOutputStream();
+    if (stream == nullptr || stream->failedToOpen()) {
+        return Result::fail("cannot write " + file.getFullPathName());
+    }
+    stream->write(magic, sizeof(magic));
+    stream->write(&sampleRate, sizeof(sampleRate));
+    const int32 header[] = { maxBlockSize, numChannels, static_cast<int32>(state.getSize()) };
+    stream->write(header, sizeof(header));
+    stream->write(state.getData(), state.getSize());
+
+    // only an instance that captures holds the ring
+    ring.allocate(ringBytes, false);
+    scratch.allocate(maxRecordBytes, false);
+    fifo.reset();
+    droppedBlocks.store(0);
+    {
+        const ScopedLock sl(outputLock);
+        output = stream.release();
+    }
+    capturing.store(true);
+    jobs->add(this, BackgroundJobs::ePriority::eNormal);
+    return Result::ok();
+}
+
+void SessionCapture::stop()
+{
+    if (!capturing.exchange(false)) {
+        return;
+    }
+    jobs->remove(this);
+
+    const ScopedLock sl(outputLock);
+    drain();
+    const int64 dropped = droppedBlocks.load();
+    const uint32 size = sizeof(dropped);
+    const uint8 type = eEnd;
+    output->write(&size, sizeof(size));
+    output->write(&type, sizeof(type));
+    output->write(&dropped, sizeof(dropped));
+    output = nullptr;
+    if (dropped > 0) {
+        RtLog::write(RtLog::eLevel::eWarning, "session capture dropped {} blocks, its replay is not exact", static_cast<double>(dropped));
+    }
+}
+
+void SessionCapture::writeBlock(int numSamples, bool nonRealtime, const AudioPlayHead::CurrentPositionInfo* position,
+                                const ParamEvent* events, int numEvents, const std::vector<Param*>& params, const MidiBuffer& midi)
+{
+    if (!capturing.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    // the size goes in front once it is known
+    Packer p = { scratch.getData(), maxRecordBytes, static_cast<int>(sizeof(uint32)), true };
+    p.put(static_cast<uint8>(eBlock));
+    p.put(static_cast<int32>(numSamples));
+    p.put(static_cast<uint8>((nonRealtime ? eNonRealtime : 0) | (position != nullptr ? eHasPosition : 0)));
+    if (position != nullptr) {
+        packPosition(p, *position);
+    }
+
+    int numParams = 0;
+    const int numParamsAt = p.size;
+    p.put(static_cast<uint32>(0));
+    for (int e = 0; e < numEvents; ++e) {
+        const auto it = std::find(params.begin(), params.end(), events[e].param);
+        if (it != params.end()) {
+            p.put(static_cast<int32>(it - params.begin()));
+            p.put(events[e].value);
+            ++numParams;
+        }
+    }
+    if (p.ok) {
+        std::memcpy(p.data + numParamsAt, &numParams, sizeof(uint32));
+    }
+
+    const int numMidiAt = p.size;
+    p.put(static_cast<uint32>(0));
+    uint32 numMidi = 0;
+    MidiBuffer::Iterator it(midi);
+    const uint8* data;
+    int size;
+    int pos;
+    while (it.getNextEvent(data, size, pos)) {
+        p.put(static_cast<int32>(pos));
+        p.put(static_cast<uint16>(size));
+        p.putBytes(data, size);
+        ++numMidi;
+    }
+    if (p.ok) {
+        std::memcpy(p.data + numMidiAt, &numMidi, sizeof(uint32));
+    }
+
+    if (!p.ok || fifo.getFreeSpace() < p.size) {
+        droppedBlocks.fetch_add(1);
+        return;
+    }
+    const uint32 payload = static_cast<uint32>(p.size) - sizeof(uint32) - 1;
+    std::memcpy(p.data, &payload, sizeof(uint32));
+
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite(p.size, start1, size1, start2, size2);
+    std::memcpy(ring + start1, p.data, static_cast<size_t>(size1));
+    std::memcpy(ring + start2, p.data + size1, static_cast<size_t>(size2));
+    fifo.finishedWrite(size1 + size2);
+}
+
+int SessionCapture::useTimeSlice()
+{
+    const ScopedLock sl(outputLock);
+    drain();
+    return 20;
+}
+
+void SessionCapture::drain()
+{
+    if (output == nullptr) {
+        return;
+    }
+    int start1, size1, start2, size2;
+    fifo.prepareToRead(fifo.getNumReady(), start1, size1, start2, size2);
+    output->write(ring + start1, static_cast<size_t>(size1));
+    output->write(ring + start2, static_cast<size_t>(size2));
+    fifo.finishedRead(size1 + size2);
+}
+
+File SessionCapture::createCaptureFile()
+{
+    const String dir = SystemStats::getEnvironmentVariable("SYNISTER_CAPTURE_DIR", String());
+    if (dir.isEmpty()) {
+        return File::nonexistent;
+    }
+    const File folder = File::getCurrentWorkingDirectory().getChildFile(dir);
+    folder.createDirectory();
+    return folder.getNonexistentChildFile("synister " + Time::getCurrentTime().formatted("%Y-%m-%d %H-%M-%S"), ".capture");
+}
+
+Result SessionCapture::read(const File& file, Session& session)
+{
+    MemoryBlock bytes;
+    if (!file.loadFileAsData(bytes)) {
+        return Result::fail("cannot read " + file.getFullPathName());
+    }
+    Unpacker u = { static_cast<const uint8*>(bytes.getData()), bytes.getSize(), 0, true };
+
+    char fileMagic[sizeof(magic)];
+    u.getBytes(fileMagic, sizeof(fileMagic));
+    if (!u.ok || std::memcmp(fileMagic, magic, sizeof(magic)) != 0) {
+        return Result::fail(file.getFileName() + " is no session capture");
+    }
+    session = Session();
+    session.sampleRate = u.get<double>();
+    session.maxBlockSize = u.get<int32>();
+    session.numChannels = u.get<int32>();
+    const size_t stateBytes = static_cast<size_t>(u.get<int32>());
+    if (const uint8* state = u.skip(stateBytes)) {
+        session.state.append(state, stateBytes);
+    }
+    if (!u.ok || session.sampleRate <= 0. || session.maxBlockSize <= 0 || session.numChannels <= 0) {
+        return Result::fail(file.getFileName() + " has a broken header");
+    }
+
+    // a capture that was not stopped, e.g. of a crashed host, ends in the middle of a record
+    session.droppedBlocks = -1;
+    while (u.pos < u.size) {
+        const uint32 payload = u.get<uint32>();
+        const uint8 type = u.get<uint8>();
+        const uint8* record = u.skip(payload);
+        if (!u.ok) {
+            break;
+        }
+        Unpacker r = { record, payload, 0, true };
+        if (type == eEnd) {
+            session.droppedBlocks = r.get<int64>();
+            break;
+        }
+        if (type != eBlock) {
+            continue;
+        }
+
+        Block b;
+        b.numSamples = r.get<int32>();
+        const uint8 flags = r.get<uint8>();
+        b.nonRealtime = (flags & eNonRealtime) != 0;
+        b.hasPosition = (flags & eHasPosition) != 0;
+        b.position.resetToDefault();
+        if (b.hasPosition) {
+            unpackPosition(r, b.position);
+        }
+        const uint32 numParams = r.get<uint32>();
+        for (uint32 i = 0; i < numParams && r.ok; ++i) {
+            ParamChange c;
+            c.index = r.get<int32>();
+            c.value = r.get<float>();
+            b.params.push_back(c);
+        }
+        const uint32 numMidi = r.get<uint32>();
+        for (uint32 i = 0; i < numMidi && r.ok; ++i) {
+            const int pos = r.get<int32>();
+            const uint16 size = r.get<uint16>();
+            if (const uint8* data = r.skip(size)) {
+                b.midi.addEvent(data, size, pos);
+            }
+        }
+        if (!r.ok || b.numSamples <= 0 || b.numSamples > session.maxBlockSize) {
+            return Result::fail(file.getFileName() + " has a broken block " + String(static_cast<int>(session.blocks.size())));
+        }
+        session.blocks.push_back(std::move(b));
+    }
+    return Result::ok();
+}
@@ -0,0 +1,214 @@
+/*
+  ==============================================================================
+
+    SimdKernels.cpp
+    Created: 15 Oct 2026 11:48:52am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "SimdKernels.h"
+#include "CpuFeatures.h"
+#include "Oscillator.h"
+#include "FastRandom.h"
+#include <cmath>
+#include <cstring>
+
+namespace {
+    //! the lane loop of VoiceBank, fixed trip count per sample and no branches depending on the lane
+    template<float(*_waveform)(float, float, float)>
+    void oscillatorLanes(SimdKernels::OscillatorLanes& osc, const float* pitchMod, const float* shapeMod, float* out,
+                         int numLanes, int numSamples, float shapeMin, float shapeMax)
+    {
+        for (int s = 0; s < numSamples; ++s) {
+            const float *pit = pitchMod + s * SimdKernels::laneStride;
+            const float *shp = shapeMod + s * SimdKernels::laneStride;
+            float *o = out + s * SimdKernels::laneStride;
+            for (int l = 0; l < numLanes; ++l) {
+                const float currentShape = std::min(std::max(osc.shape[l] + shp[l], shapeMin), shapeMax);
+                const float increment = osc.phaseDelta[l] * pit[l];
+                o[l] = _waveform(osc.phase[l], currentShape, increment);
+
+                const float p = osc.phase[l] + increment;
+                osc.phase[l] = p - static_cast<float>(static_cast<int>(p));
+            }
+        }
+    }
+
+    float squareLane(float phs, float shp, float /*unused*/) { return Waveforms::square(phs, 0.f, shp); }
+    float sawLane(float phs, float shp, float /*unused*/) { return Waveforms::saw(phs, shp, 0.f); }
+
+    void noiseLanes(uint32_t* state, float* out, int numLanes, int numSamples)
+    {
+        for (int s = 0; s < numSamples; ++s) {
+            float *o = out + s * SimdKernels::laneStride;
+            for (int l = 0; l < numLanes; ++l) {
+                state[l] = FastRandom::step(state[l]);
+                o[l] = FastRandom::toFloat(state[l]);
+            }
+        }
+    }
+
+    void biquadLanes(SimdKernels::BiquadLanes& bq, float* samples, int numLanes, int numSamples)
+    {
+        for (int s = 0; s < numSamples; ++s) {
+            float *io = samples + s * SimdKernels::laneStride;
+            for (int l = 0; l < numLanes; ++l) {
+                bq.b0[l] += bq.db0[l];
+                bq.b1[l] += bq.db1[l];
+                bq.b2[l] += bq.db2[l];
+                bq.a1[l] += bq.da1[l];
+                bq.a2[l] += bq.da2[l];
+
+                // same as Filter::biquadSample(), the feedback takes the output before the clamp
+                const float x = io[l];
+                const float y = bq.b0[l] * x + bq.b1[l] * bq.x1[l] + bq.b2[l] * bq.x2[l] - bq.a1[l] * bq.y1[l] - bq.a2[l] * bq.y2[l];
+                bq.x2[l] = bq.x1[l];
+                bq.x1[l] = x;
+                bq.y2[l] = bq.y1[l];
+                bq.y1[l] = y;
+                io[l] = std::min(std::max(y, -1.f), 1.f);
+            }
+        }
+    }
+
+    void stereoBiquadFrames(SimdKernels::StereoBiquad& bq, float* frames, int numFrames)
+    {
+        for (int s = 0; s < numFrames; ++s) {
+            float *io = frames + 2 * s;
+            for (int c = 0; c < 2; ++c) {
+                const float x = io[c];
+                const float y = bq.b0 * x + bq.b1 * bq.x1[c] + bq.b2 * bq.x2[c] - bq.a1 * bq.y1[c] - bq.a2 * bq.y2[c];
+                bq.x2[c] = bq.x1[c];
+                bq.x1[c] = x;
+                bq.y2[c] = bq.y1[c];
+                bq.y1[c] = y;
+                io[c] = y;
+            }
+        }
+    }
+
+    void quantize(float* samples, float coeff, float invCoeff, int numSamples)
+    {
+        for (int s = 0; s < numSamples; ++s) {
+            // the truncating conversion vectorises, the offset turns it into rounding
+            const float x = samples[s] * coeff;
+            samples[s] = static_cast<float>(static_cast<int>(x + (x < 0.f ? -.5f : .5f))) * invCoeff;
+        }
+    }
+
+    void packInt16(const float* src, int16_t* dst, float scale, int numSamples)
+    {
+        for (int s = 0; s < numSamples; ++s) {
+            // clamped before the conversion, which rounds to nearest even like cvtps2dq
+            const float x = std::min(std::max(src[s] * scale, -32768.f), 32767.f);
+            dst[s] = static_cast<int16_t>(std::lrint(x));
+        }
+    }
+
+    void unpackInt16(const int16_t* src, float* dst, float invScale, int numSamples)
+    {
+        for (int s = 0; s < numSamples; ++s) {
+            dst[s] = static_cast<float>(src[s]) * invScale;
+        }
+    }
+
+    void packHalf(const float* src, uint16_t* dst, int numSamples)
+    {
+        const float subnormalMagic = .5f;  //!< puts the half subnormal in the low bits of the mantissa, rounded by the fpu
+        uint32_t magicBits;
+        std::memcpy(&magicBits, &subnormalMagic, sizeof(magicBits));
+
+        for (int s = 0; s < numSamples; ++s) {
+            uint32_t x;
+            std::memcpy(&x, src + s, sizeof(x));
+            const uint16_t sign = static_cast<uint16_t>((x >> 16) & 0x8000u);
+            x &= 0x7fffffffu;
+
+            uint16_t h;
+            if (x >= 0x7f800000u) {
+                // inf stays inf, nan stays a quiet nan
+                h = x > 0x7f800000u ? 0x7e00u : 0x7c00u;
+            } else if (x >= 0x477ff000u) {
+                // at least halfway above the largest half, 65504
+                h = 0x7c00u;
+            } else if (x < 0x38800000u) {
+                // below the smallest normal half, 2^-14
+                float f;
+                std::memcpy(&f, &x, sizeof(f));
+                f += subnormalMagic;
+                uint32_t bits;
+                std::memcpy(&bits, &f, sizeof(bits));
+                h = static_cast<uint16_t>(bits - magicBits);
+            } else {
+                // new exponent bias, and the dropped 13 bits rounded to nearest even
+                const uint32_t odd = (x >> 13) & 1u;
+                x += 0xc8000fffu + odd;
+                h = static_cast<uint16_t>(x >> 13);
+            }
+            dst[s] = sign | h;
+        }
+    }
+
+    void unpackHalf(const uint16_t* src, float* dst, int numSamples)
+    {
+        const uint32_t shiftedExponent = 0x7c00u << 13;
+        const float subnormalMagic = 6.103515625e-05f;    //!< 2^-14, the value of the implicit bit of a subnormal
+
+        for (int s = 0; s < numSamples; ++s) {
+            uint32_t x = (src[s] & 0x7fffu) << 13;
+            const uint32_t exponent = x & shiftedExponent;
+            x += (127u - 15u) << 23;
+            if (exponent == shiftedExponent) {
+                // inf and nan
+                x += (128u - 16u) << 23;
+            } else if (exponent == 0) {
+                // a subnormal is normalised by the fpu
+                x += 1u << 23;
+                float f;
+                std::memcpy(&f, &x, sizeof(f));
+                f -= subnormalMagic;
+                std::memcpy(&x, &f, sizeof(x));
+            }
+            x |= static_cast<uint32_t>(src[s] & 0x8000u) << 16;
+            std::memcpy(dst + s, &x, sizeof(x));
+        }
+    }
+}
+
+SimdKernels::SimdKernels()
+    : squareLanes(&oscillatorLanes<&squareLane>)
+    , sawLanes(&oscillatorLanes<&sawLane>)
+    , noiseLanes(&::noiseLanes)
+    , biquadLanes(&::biquadLanes)
+    , stereoBiquadFrames(&::stereoBiquadFrames)
+    , quantize(&::quantize)
+    , packInt16(&::packInt16)
+    , unpackInt16(&::unpackInt16)
+    , packHalf(&::packHalf)
+    , unpackHalf(&::unpackHalf)
+    , name(CpuFeatures::getName(CpuFeatures::eLevel::eScalar))
+{
+    // every level brings the kernels of the ones below it, AVX-512 runs the AVX2 ones: the lanes are 8 wide
+    typedef CpuFeatures::eLevel eLevel;
+    const eLevel level = CpuFeatures::getSelected();
+    if (level >= eLevel::eSse2 && level <= eLevel::eAvx512 && useSse2(*this)) {
+        name = CpuFeatures::getName(eLevel::eSse2);
+    }
+    if (level >= eLevel::eAvx && level <= eLevel::eAvx512 && useAvx(*this)) {
+        name = CpuFeatures::getName(eLevel::eAvx);
+    }
+    if (level >= eLevel::eAvx2 && level <= eLevel::eAvx512 && useAvx2(*this)) {
+        name = CpuFeatures::getName(eLevel::eAvx2);
+    }
+    if (level == eLevel::eNeon && useNeon(*this)) {
+        name = CpuFeatures::getName(eLevel::eNeon);
+    }
+}
+
+const SimdKernels& SimdKernels::get()
+{
+    static const SimdKernels kernels;
+    return kernels;
+}
@@ -0,0 +1,237 @@
+/*
+  ==============================================================================
+
+    SimdKernelsAvx.cpp
+    Created: 15 Oct 2026 12:21:47pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "SimdKernels.h"
+
+#if defined (_M_X64) || defined (_M_IX86) || defined (__x86_64__) || defined (__i386__)
+ #define SYNISTER_AVX_KERNELS 1
+ #include <immintrin.h>
+#else
+ #define SYNISTER_AVX_KERNELS 0
+#endif
+
+#if SYNISTER_AVX_KERNELS
+
+// gcc and clang compile only these functions for AVX, MSVC builds the file with /arch:AVX so
+// that the 128 bit instructions around the intrinsics are VEX encoded as well
+// every cpu with AVX2 has the half float conversions of F16C, they came one generation earlier
+#if defined (__GNUC__)
+ #define SYNISTER_AVX __attribute__((target("avx")))
+ #define SYNISTER_AVX2 __attribute__((target("avx2")))
+ #define SYNISTER_AVX2_F16C __attribute__((target("avx2,f16c")))
+#else
+ #define SYNISTER_AVX
+ #define SYNISTER_AVX2
+ #define SYNISTER_AVX2_F16C
+#endif
+
+namespace {
+    const int stride = SimdKernels::laneStride;
+    static_assert(SimdKernels::laneStride == 8, "the AVX kernels render the lanes in one register");
+
+    // all eight lanes are one register, the kernels render them whatever numLanes is
+
+    SYNISTER_AVX inline __m256 clamp(__m256 x, __m256 lo, __m256 hi) {
+        return _mm256_min_ps(hi, _mm256_max_ps(lo, x));
+    }
+
+    SYNISTER_AVX inline __m256 wrap(__m256 p) {
+        return _mm256_sub_ps(p, _mm256_cvtepi32_ps(_mm256_cvttps_epi32(p)));
+    }
+
+    struct Square {
+        SYNISTER_AVX static __m256 wave(__m256 phs, __m256 width) {
+            return _mm256_blendv_ps(_mm256_set1_ps(-1.f), _mm256_set1_ps(1.f), _mm256_cmp_ps(phs, width, _CMP_LT_OQ));
+        }
+    };
+
+    struct Saw {
+        SYNISTER_AVX static __m256 wave(__m256 phs, __m256 trngAmount) {
+            const __m256 two = _mm256_set1_ps(2.f);
+            const __m256 one = _mm256_set1_ps(1.f);
+            const __m256 corner = _mm256_mul_ps(_mm256_set1_ps(.5f), trngAmount);
+            const __m256 falling = _mm256_sub_ps(one, _mm256_mul_ps(_mm256_div_ps(two, corner), phs));
+            const __m256 rising = _mm256_add_ps(_mm256_set1_ps(-1.f), _mm256_mul_ps(_mm256_div_ps(two, _mm256_sub_ps(one, corner)), _mm256_sub_ps(phs, corner)));
+            return _mm256_blendv_ps(rising, falling, _mm256_cmp_ps(phs, corner, _CMP_LT_OQ));
+        }
+    };
+
+    template<typename _wave>
+    SYNISTER_AVX void oscillatorLanes(SimdKernels::OscillatorLanes& osc, const float* pitchMod, const float* shapeMod, float* out,
+                                      int /*numLanes*/, int numSamples, float shapeMin, float shapeMax)
+    {
+        const __m256 lo = _mm256_set1_ps(shapeMin);
+        const __m256 hi = _mm256_set1_ps(shapeMax);
+        __m256 phase = _mm256_loadu_ps(osc.phase);
+        const __m256 delta = _mm256_loadu_ps(osc.phaseDelta);
+        const __m256 shape = _mm256_loadu_ps(osc.shape);
+        for (int s = 0; s < numSamples; ++s) {
+            const int i = s * stride;
+            const __m256 currentShape = clamp(_mm256_add_ps(shape, _mm256_loadu_ps(shapeMod + i)), lo, hi);
+            const __m256 increment = _mm256_mul_ps(delta, _mm256_loadu_ps(pitchMod + i));
+            _mm256_storeu_ps(out + i, _wave::wave(phase, currentShape));
+            phase = wrap(_mm256_add_ps(phase, increment));
+        }
+        _mm256_storeu_ps(osc.phase, phase);
+        _mm256_zeroupper();
+    }
+
+    //! 256 bit integer shifts are AVX2
+    SYNISTER_AVX2 void noiseLanes(uint32_t* state, float* out, int /*numLanes*/, int numSamples)
+    {
+        const __m256 scale = _mm256_set1_ps(2.f / 16777216.f);
+        const __m256 one = _mm256_set1_ps(1.f);
+        __m256i st = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state));
+        for (int s = 0; s < numSamples; ++s) {
+            st = _mm256_xor_si256(st, _mm256_slli_epi32(st, 13));
+            st = _mm256_xor_si256(st, _mm256_srli_epi32(st, 17));
+            st = _mm256_xor_si256(st, _mm256_slli_epi32(st, 5));
+            _mm256_storeu_ps(out + s * stride, _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(st, 8)), scale), one));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(state), st);
+        _mm256_zeroupper();
+    }
+
+    SYNISTER_AVX void biquadLanes(SimdKernels::BiquadLanes& bq, float* samples, int /*numLanes*/, int numSamples)
+    {
+        const __m256 lo = _mm256_set1_ps(-1.f);
+        const __m256 hi = _mm256_set1_ps(1.f);
+        __m256 b0 = _mm256_loadu_ps(bq.b0), b1 = _mm256_loadu_ps(bq.b1), b2 = _mm256_loadu_ps(bq.b2);
+        __m256 a1 = _mm256_loadu_ps(bq.a1), a2 = _mm256_loadu_ps(bq.a2);
+        const __m256 db0 = _mm256_loadu_ps(bq.db0), db1 = _mm256_loadu_ps(bq.db1), db2 = _mm256_loadu_ps(bq.db2);
+        const __m256 da1 = _mm256_loadu_ps(bq.da1), da2 = _mm256_loadu_ps(bq.da2);
+        __m256 x1 = _mm256_loadu_ps(bq.x1), x2 = _mm256_loadu_ps(bq.x2);
+        __m256 y1 = _mm256_loadu_ps(bq.y1), y2 = _mm256_loadu_ps(bq.y2);
+
+        for (int s = 0; s < numSamples; ++s) {
+            float *io = samples + s * stride;
+            b0 = _mm256_add_ps(b0, db0);
+            b1 = _mm256_add_ps(b1, db1);
+            b2 = _mm256_add_ps(b2, db2);
+            a1 = _mm256_add_ps(a1, da1);
+            a2 = _mm256_add_ps(a2, da2);
+
+            const __m256 x = _mm256_loadu_ps(io);
+            __m256 y = _mm256_add_ps(_mm256_mul_ps(b0, x), _mm256_mul_ps(b1, x1));
+            y = _mm256_add_ps(y, _mm256_mul_ps(b2, x2));
+            y = _mm256_sub_ps(y, _mm256_mul_ps(a1, y1));
+            y = _mm256_sub_ps(y, _mm256_mul_ps(a2, y2));
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            _mm256_storeu_ps(io, clamp(y, lo, hi));
+        }
+
+        _mm256_storeu_ps(bq.b0, b0);
+        _mm256_storeu_ps(bq.b1, b1);
+        _mm256_storeu_ps(bq.b2, b2);
+        _mm256_storeu_ps(bq.a1, a1);
+        _mm256_storeu_ps(bq.a2, a2);
+        _mm256_storeu_ps(bq.x1, x1);
+        _mm256_storeu_ps(bq.x2, x2);
+        _mm256_storeu_ps(bq.y1, y1);
+        _mm256_storeu_ps(bq.y2, y2);
+        _mm256_zeroupper();
+    }
+
+    SYNISTER_AVX void quantize(float* samples, float coeff, float invCoeff, int numSamples)
+    {
+        const __m256 c = _mm256_set1_ps(coeff);
+        const __m256 inv = _mm256_set1_ps(invCoeff);
+        const __m256 half = _mm256_set1_ps(.5f);
+        const __m256 sign = _mm256_set1_ps(-0.f);
+        int s = 0;
+        for (; s + 8 <= numSamples; s += 8) {
+            const __m256 x = _mm256_mul_ps(_mm256_loadu_ps(samples + s), c);
+            const __m256 rounded = _mm256_cvtepi32_ps(_mm256_cvttps_epi32(_mm256_add_ps(x, _mm256_or_ps(half, _mm256_and_ps(x, sign)))));
+            _mm256_storeu_ps(samples + s, _mm256_mul_ps(rounded, inv));
+        }
+        _mm256_zeroupper();
+        for (; s < numSamples; ++s) {
+            const float x = samples[s] * coeff;
+            samples[s] = static_cast<float>(static_cast<int>(x + (x < 0.f ? -.5f : .5f))) * invCoeff;
+        }
+    }
+
+    //! the last samples go through a register of zeros, the scalar kernels are in another file
+    SYNISTER_AVX2_F16C void packHalf(const float* src, uint16_t* dst, int numSamples)
+    {
+        int s = 0;
+        for (; s + 8 <= numSamples; s += 8) {
+            const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + s), _MM_FROUND_TO_NEAREST_INT);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + s), h);
+        }
+        if (s < numSamples) {
+            float in[8] = {};
+            uint16_t out[8];
+            for (int i = s; i < numSamples; ++i) {
+                in[i - s] = src[i];
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_cvtps_ph(_mm256_loadu_ps(in), _MM_FROUND_TO_NEAREST_INT));
+            for (int i = s; i < numSamples; ++i) {
+                dst[i] = out[i - s];
+            }
+        }
+        _mm256_zeroupper();
+    }
+
+    SYNISTER_AVX2_F16C void unpackHalf(const uint16_t* src, float* dst, int numSamples)
+    {
+        int s = 0;
+        for (; s + 8 <= numSamples; s += 8) {
+            const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + s));
+            _mm256_storeu_ps(dst + s, _mm256_cvtph_ps(h));
+        }
+        if (s < numSamples) {
+            uint16_t in[8] = {};
+            float out[8];
+            for (int i = s; i < numSamples; ++i) {
+                in[i - s] = src[i];
+            }
+            _mm256_storeu_ps(out, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in))));
+            for (int i = s; i < numSamples; ++i) {
+                dst[i] = out[i - s];
+            }
+        }
+        _mm256_zeroupper();
+    }
+}
+
+bool SimdKernels::useAvx(SimdKernels& k)
+{
+    k.squareLanes = &oscillatorLanes<Square>;
+    k.sawLanes = &oscillatorLanes<Saw>;
+    k.biquadLanes = &::biquadLanes;
+    k.quantize = &::quantize;
+    return true;
+}
+
+bool SimdKernels::useAvx2(SimdKernels& k)
+{
+    k.noiseLanes = &::noiseLanes;
+    k.packHalf = &::packHalf;
+    k.unpackHalf = &::unpackHalf;
+    return true;
+}
+
+#else
+
+bool SimdKernels::useAvx(SimdKernels&)
+{
+    return false;
+}
+
+bool SimdKernels::useAvx2(SimdKernels&)
+{
+    return false;
+}
+
+#endif
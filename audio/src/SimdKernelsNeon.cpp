@@ -0,0 +1,232 @@
+/*
+  ==============================================================================
+
+    SimdKernelsNeon.cpp
+    Created: 15 Oct 2026 12:38:09pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "SimdKernels.h"
+
+// 32 bit ARM has no vector division, it keeps the scalar kernels
+#if defined (__aarch64__) || defined (_M_ARM64)
+ #define SYNISTER_NEON_KERNELS 1
+ #include <arm_neon.h>
+#else
+ #define SYNISTER_NEON_KERNELS 0
+#endif
+
+#if SYNISTER_NEON_KERNELS
+
+namespace {
+    const int stride = SimdKernels::laneStride;
+
+    //! \brief std::min(std::max(x, lo), hi) up to the sign of a zero shape, which no sample depends on
+    inline float32x4_t clamp(float32x4_t x, float32x4_t lo, float32x4_t hi) {
+        return vminq_f32(vmaxq_f32(x, lo), hi);
+    }
+
+    inline float32x4_t wrap(float32x4_t p) {
+        return vsubq_f32(p, vcvtq_f32_s32(vcvtq_s32_f32(p)));
+    }
+
+    struct Square {
+        static float32x4_t wave(float32x4_t phs, float32x4_t width) {
+            return vbslq_f32(vcltq_f32(phs, width), vdupq_n_f32(1.f), vdupq_n_f32(-1.f));
+        }
+    };
+
+    struct Saw {
+        static float32x4_t wave(float32x4_t phs, float32x4_t trngAmount) {
+            const float32x4_t two = vdupq_n_f32(2.f);
+            const float32x4_t one = vdupq_n_f32(1.f);
+            const float32x4_t corner = vmulq_f32(vdupq_n_f32(.5f), trngAmount);
+            const float32x4_t falling = vsubq_f32(one, vmulq_f32(vdivq_f32(two, corner), phs));
+            const float32x4_t rising = vaddq_f32(vdupq_n_f32(-1.f), vmulq_f32(vdivq_f32(two, vsubq_f32(one, corner)), vsubq_f32(phs, corner)));
+            return vbslq_f32(vcltq_f32(phs, corner), falling, rising);
+        }
+    };
+
+    template<typename _wave>
+    void oscillatorLanes(SimdKernels::OscillatorLanes& osc, const float* pitchMod, const float* shapeMod, float* out,
+                         int numLanes, int numSamples, float shapeMin, float shapeMax)
+    {
+        const float32x4_t lo = vdupq_n_f32(shapeMin);
+        const float32x4_t hi = vdupq_n_f32(shapeMax);
+        for (int g = 0; g < numLanes; g += 4) {
+            float32x4_t phase = vld1q_f32(osc.phase + g);
+            const float32x4_t delta = vld1q_f32(osc.phaseDelta + g);
+            const float32x4_t shape = vld1q_f32(osc.shape + g);
+            for (int s = 0; s < numSamples; ++s) {
+                const int i = s * stride + g;
+                const float32x4_t currentShape = clamp(vaddq_f32(shape, vld1q_f32(shapeMod + i)), lo, hi);
+                const float32x4_t increment = vmulq_f32(delta, vld1q_f32(pitchMod + i));
+                vst1q_f32(out + i, _wave::wave(phase, currentShape));
+                phase = wrap(vaddq_f32(phase, increment));
+            }
+            vst1q_f32(osc.phase + g, phase);
+        }
+    }
+
+    void noiseLanes(uint32_t* state, float* out, int numLanes, int numSamples)
+    {
+        const float32x4_t scale = vdupq_n_f32(2.f / 16777216.f);
+        const float32x4_t one = vdupq_n_f32(1.f);
+        for (int g = 0; g < numLanes; g += 4) {
+            uint32x4_t st = vld1q_u32(state + g);
+            for (int s = 0; s < numSamples; ++s) {
+                st = veorq_u32(st, vshlq_n_u32(st, 13));
+                st = veorq_u32(st, vshrq_n_u32(st, 17));
+                st = veorq_u32(st, vshlq_n_u32(st, 5));
+                const float32x4_t f = vcvtq_f32_s32(vreinterpretq_s32_u32(vshrq_n_u32(st, 8)));
+                vst1q_f32(out + s * stride + g, vsubq_f32(vmulq_f32(f, scale), one));
+            }
+            vst1q_u32(state + g, st);
+        }
+    }
+
+    void biquadLanes(SimdKernels::BiquadLanes& bq, float* samples, int numLanes, int numSamples)
+    {
+        const float32x4_t lo = vdupq_n_f32(-1.f);
+        const float32x4_t hi = vdupq_n_f32(1.f);
+        for (int g = 0; g < numLanes; g += 4) {
+            float32x4_t b0 = vld1q_f32(bq.b0 + g), b1 = vld1q_f32(bq.b1 + g), b2 = vld1q_f32(bq.b2 + g);
+            float32x4_t a1 = vld1q_f32(bq.a1 + g), a2 = vld1q_f32(bq.a2 + g);
+            const float32x4_t db0 = vld1q_f32(bq.db0 + g), db1 = vld1q_f32(bq.db1 + g), db2 = vld1q_f32(bq.db2 + g);
+            const float32x4_t da1 = vld1q_f32(bq.da1 + g), da2 = vld1q_f32(bq.da2 + g);
+            float32x4_t x1 = vld1q_f32(bq.x1 + g), x2 = vld1q_f32(bq.x2 + g);
+            float32x4_t y1 = vld1q_f32(bq.y1 + g), y2 = vld1q_f32(bq.y2 + g);
+
+            for (int s = 0; s < numSamples; ++s) {
+                float *io = samples + s * stride + g;
+                b0 = vaddq_f32(b0, db0);
+                b1 = vaddq_f32(b1, db1);
+                b2 = vaddq_f32(b2, db2);
+                a1 = vaddq_f32(a1, da1);
+                a2 = vaddq_f32(a2, da2);
+
+                // separate multiplies and adds, vmlaq may fuse them
+                const float32x4_t x = vld1q_f32(io);
+                float32x4_t y = vaddq_f32(vmulq_f32(b0, x), vmulq_f32(b1, x1));
+                y = vaddq_f32(y, vmulq_f32(b2, x2));
+                y = vsubq_f32(y, vmulq_f32(a1, y1));
+                y = vsubq_f32(y, vmulq_f32(a2, y2));
+                x2 = x1;
+                x1 = x;
+                y2 = y1;
+                y1 = y;
+                vst1q_f32(io, clamp(y, lo, hi));
+            }
+
+            vst1q_f32(bq.b0 + g, b0);
+            vst1q_f32(bq.b1 + g, b1);
+            vst1q_f32(bq.b2 + g, b2);
+            vst1q_f32(bq.a1 + g, a1);
+            vst1q_f32(bq.a2 + g, a2);
+            vst1q_f32(bq.x1 + g, x1);
+            vst1q_f32(bq.x2 + g, x2);
+            vst1q_f32(bq.y1 + g, y1);
+            vst1q_f32(bq.y2 + g, y2);
+        }
+    }
+
+    void stereoBiquadFrames(SimdKernels::StereoBiquad& bq, float* frames, int numFrames)
+    {
+        const float32x2_t b0 = vdup_n_f32(bq.b0), b1 = vdup_n_f32(bq.b1), b2 = vdup_n_f32(bq.b2);
+        const float32x2_t a1 = vdup_n_f32(bq.a1), a2 = vdup_n_f32(bq.a2);
+        float32x2_t x1 = vld1_f32(bq.x1), x2 = vld1_f32(bq.x2);
+        float32x2_t y1 = vld1_f32(bq.y1), y2 = vld1_f32(bq.y2);
+
+        for (int s = 0; s < numFrames; ++s) {
+            float *io = frames + 2 * s;
+            const float32x2_t x = vld1_f32(io);
+            float32x2_t y = vadd_f32(vmul_f32(b0, x), vmul_f32(b1, x1));
+            y = vadd_f32(y, vmul_f32(b2, x2));
+            y = vsub_f32(y, vmul_f32(a1, y1));
+            y = vsub_f32(y, vmul_f32(a2, y2));
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            vst1_f32(io, y);
+        }
+
+        vst1_f32(bq.x1, x1);
+        vst1_f32(bq.x2, x2);
+        vst1_f32(bq.y1, y1);
+        vst1_f32(bq.y2, y2);
+    }
+
+    void quantize(float* samples, float coeff, float invCoeff, int numSamples)
+    {
+        const float32x4_t c = vdupq_n_f32(coeff);
+        const float32x4_t inv = vdupq_n_f32(invCoeff);
+        const uint32x4_t half = vreinterpretq_u32_f32(vdupq_n_f32(.5f));
+        const uint32x4_t sign = vdupq_n_u32(0x80000000u);
+        int s = 0;
+        for (; s + 4 <= numSamples; s += 4) {
+            const float32x4_t x = vmulq_f32(vld1q_f32(samples + s), c);
+            const float32x4_t h = vreinterpretq_f32_u32(vorrq_u32(half, vandq_u32(vreinterpretq_u32_f32(x), sign)));
+            const float32x4_t rounded = vcvtq_f32_s32(vcvtq_s32_f32(vaddq_f32(x, h)));
+            vst1q_f32(samples + s, vmulq_f32(rounded, inv));
+        }
+        for (; s < numSamples; ++s) {
+            const float x = samples[s] * coeff;
+            samples[s] = static_cast<float>(static_cast<int>(x + (x < 0.f ? -.5f : .5f))) * invCoeff;
+        }
+    }
+
+    void packInt16(const float* src, int16_t* dst, float scale, int numSamples)
+    {
+        // rounds to nearest even like the scalar kernel, the narrowing saturates
+        const float32x4_t c = vdupq_n_f32(scale);
+        int s = 0;
+        for (; s + 8 <= numSamples; s += 8) {
+            const int32x4_t a = vcvtnq_s32_f32(vmulq_f32(vld1q_f32(src + s), c));
+            const int32x4_t b = vcvtnq_s32_f32(vmulq_f32(vld1q_f32(src + s + 4), c));
+            vst1q_s16(dst + s, vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+        }
+        for (; s < numSamples; ++s) {
+            const int32_t x = vcvtns_s32_f32(src[s] * scale);
+            dst[s] = static_cast<int16_t>(x < -32768 ? -32768 : (x > 32767 ? 32767 : x));
+        }
+    }
+
+    void unpackInt16(const int16_t* src, float* dst, float invScale, int numSamples)
+    {
+        const float32x4_t inv = vdupq_n_f32(invScale);
+        int s = 0;
+        for (; s + 8 <= numSamples; s += 8) {
+            const int16x8_t x = vld1q_s16(src + s);
+            vst1q_f32(dst + s, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))), inv));
+            vst1q_f32(dst + s + 4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(x))), inv));
+        }
+        for (; s < numSamples; ++s) {
+            dst[s] = static_cast<float>(src[s]) * invScale;
+        }
+    }
+}
+
+bool SimdKernels::useNeon(SimdKernels& k)
+{
+    k.squareLanes = &oscillatorLanes<Square>;
+    k.sawLanes = &oscillatorLanes<Saw>;
+    k.noiseLanes = &::noiseLanes;
+    k.biquadLanes = &::biquadLanes;
+    k.stereoBiquadFrames = &::stereoBiquadFrames;
+    k.quantize = &::quantize;
+    k.packInt16 = &::packInt16;
+    k.unpackInt16 = &::unpackInt16;
+    return true;
+}
+
+#else
+
+bool SimdKernels::useNeon(SimdKernels&)
+{
+    return false;
+}
+
+#endif
@@ -0,0 +1,249 @@
+/*
+  ==============================================================================
+
+    SimdKernelsSse2.cpp
+    Created: 15 Oct 2026 12:05:31pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "SimdKernels.h"
+
+#if defined (_M_X64) || defined (_M_IX86) || defined (__x86_64__) || defined (__i386__)
+ #define SYNISTER_SSE2_KERNELS 1
+ #include <emmintrin.h>
+#else
+ #define SYNISTER_SSE2_KERNELS 0
+#endif
+
+#if SYNISTER_SSE2_KERNELS
+
+// a 32 bit build may target a cpu without SSE2, the kernels are only picked if it has it
+#if defined (__GNUC__)
+ #define SYNISTER_SSE2 __attribute__((target("sse2")))
+#else
+ #define SYNISTER_SSE2
+#endif
+
+namespace {
+    const int stride = SimdKernels::laneStride;
+
+    SYNISTER_SSE2 inline __m128 select(__m128 mask, __m128 a, __m128 b) {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    //! \brief std::min(std::max(x, lo), hi), the operands in that order keep the result of equal values
+    SYNISTER_SSE2 inline __m128 clamp(__m128 x, __m128 lo, __m128 hi) {
+        return _mm_min_ps(hi, _mm_max_ps(lo, x));
+    }
+
+    //! \brief p - static_cast<float>(static_cast<int>(p))
+    SYNISTER_SSE2 inline __m128 wrap(__m128 p) {
+        return _mm_sub_ps(p, _mm_cvtepi32_ps(_mm_cvttps_epi32(p)));
+    }
+
+    struct Square {
+        SYNISTER_SSE2 static __m128 wave(__m128 phs, __m128 width) {
+            return select(_mm_cmplt_ps(phs, width), _mm_set1_ps(1.f), _mm_set1_ps(-1.f));
+        }
+    };
+
+    struct Saw {
+        SYNISTER_SSE2 static __m128 wave(__m128 phs, __m128 trngAmount) {
+            const __m128 two = _mm_set1_ps(2.f);
+            const __m128 one = _mm_set1_ps(1.f);
+            const __m128 corner = _mm_mul_ps(_mm_set1_ps(.5f), trngAmount);
+            const __m128 falling = _mm_sub_ps(one, _mm_mul_ps(_mm_div_ps(two, corner), phs));
+            const __m128 rising = _mm_add_ps(_mm_set1_ps(-1.f), _mm_mul_ps(_mm_div_ps(two, _mm_sub_ps(one, corner)), _mm_sub_ps(phs, corner)));
+            return select(_mm_cmplt_ps(phs, corner), falling, rising);
+        }
+    };
+
+    template<typename _wave>
+    SYNISTER_SSE2 void oscillatorLanes(SimdKernels::OscillatorLanes& osc, const float* pitchMod, const float* shapeMod, float* out,
+                                       int numLanes, int numSamples, float shapeMin, float shapeMax)
+    {
+        const __m128 lo = _mm_set1_ps(shapeMin);
+        const __m128 hi = _mm_set1_ps(shapeMax);
+        for (int g = 0; g < numLanes; g += 4) {
+            __m128 phase = _mm_loadu_ps(osc.phase + g);
+            const __m128 delta = _mm_loadu_ps(osc.phaseDelta + g);
+            const __m128 shape = _mm_loadu_ps(osc.shape + g);
+            for (int s = 0; s < numSamples; ++s) {
+                const int i = s * stride + g;
+                const __m128 currentShape = clamp(_mm_add_ps(shape, _mm_loadu_ps(shapeMod + i)), lo, hi);
+                const __m128 increment = _mm_mul_ps(delta, _mm_loadu_ps(pitchMod + i));
+                _mm_storeu_ps(out + i, _wave::wave(phase, currentShape));
+                phase = wrap(_mm_add_ps(phase, increment));
+            }
+            _mm_storeu_ps(osc.phase + g, phase);
+        }
+    }
+
+    SYNISTER_SSE2 void noiseLanes(uint32_t* state, float* out, int numLanes, int numSamples)
+    {
+        const __m128 scale = _mm_set1_ps(2.f / 16777216.f);
+        const __m128 one = _mm_set1_ps(1.f);
+        for (int g = 0; g < numLanes; g += 4) {
+            __m128i st = _mm_loadu_si128(reinterpret_cast<const __m128i*>(state + g));
+            for (int s = 0; s < numSamples; ++s) {
+                st = _mm_xor_si128(st, _mm_slli_epi32(st, 13));
+                st = _mm_xor_si128(st, _mm_srli_epi32(st, 17));
+                st = _mm_xor_si128(st, _mm_slli_epi32(st, 5));
+                _mm_storeu_ps(out + s * stride + g, _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(st, 8)), scale), one));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(state + g), st);
+        }
+    }
+
+    SYNISTER_SSE2 void biquadLanes(SimdKernels::BiquadLanes& bq, float* samples, int numLanes, int numSamples)
+    {
+        const __m128 lo = _mm_set1_ps(-1.f);
+        const __m128 hi = _mm_set1_ps(1.f);
+        for (int g = 0; g < numLanes; g += 4) {
+            __m128 b0 = _mm_loadu_ps(bq.b0 + g), b1 = _mm_loadu_ps(bq.b1 + g), b2 = _mm_loadu_ps(bq.b2 + g);
+            __m128 a1 = _mm_loadu_ps(bq.a1 + g), a2 = _mm_loadu_ps(bq.a2 + g);
+            const __m128 db0 = _mm_loadu_ps(bq.db0 + g), db1 = _mm_loadu_ps(bq.db1 + g), db2 = _mm_loadu_ps(bq.db2 + g);
+            const __m128 da1 = _mm_loadu_ps(bq.da1 + g), da2 = _mm_loadu_ps(bq.da2 + g);
+            __m128 x1 = _mm_loadu_ps(bq.x1 + g), x2 = _mm_loadu_ps(bq.x2 + g);
+            __m128 y1 = _mm_loadu_ps(bq.y1 + g), y2 = _mm_loadu_ps(bq.y2 + g);
+
+            for (int s = 0; s < numSamples; ++s) {
+                float *io = samples + s * stride + g;
+                b0 = _mm_add_ps(b0, db0);
+                b1 = _mm_add_ps(b1, db1);
+                b2 = _mm_add_ps(b2, db2);
+                a1 = _mm_add_ps(a1, da1);
+                a2 = _mm_add_ps(a2, da2);
+
+                const __m128 x = _mm_loadu_ps(io);
+                __m128 y = _mm_add_ps(_mm_mul_ps(b0, x), _mm_mul_ps(b1, x1));
+                y = _mm_add_ps(y, _mm_mul_ps(b2, x2));
+                y = _mm_sub_ps(y, _mm_mul_ps(a1, y1));
+                y = _mm_sub_ps(y, _mm_mul_ps(a2, y2));
+                x2 = x1;
+                x1 = x;
+                y2 = y1;
+                y1 = y;
+                _mm_storeu_ps(io, clamp(y, lo, hi));
+            }
+
+            _mm_storeu_ps(bq.b0 + g, b0);
+            _mm_storeu_ps(bq.b1 + g, b1);
+            _mm_storeu_ps(bq.b2 + g, b2);
+            _mm_storeu_ps(bq.a1 + g, a1);
+            _mm_storeu_ps(bq.a2 + g, a2);
+            _mm_storeu_ps(bq.x1 + g, x1);
+            _mm_storeu_ps(bq.x2 + g, x2);
+            _mm_storeu_ps(bq.y1 + g, y1);
+            _mm_storeu_ps(bq.y2 + g, y2);
+        }
+    }
+
+    //! a frame is the lower half of a register, the upper one is ignored
+    SYNISTER_SSE2 void stereoBiquadFrames(SimdKernels::StereoBiquad& bq, float* frames, int numFrames)
+    {
+        const __m128 b0 = _mm_set1_ps(bq.b0), b1 = _mm_set1_ps(bq.b1), b2 = _mm_set1_ps(bq.b2);
+        const __m128 a1 = _mm_set1_ps(bq.a1), a2 = _mm_set1_ps(bq.a2);
+        const __m128 zero = _mm_setzero_ps();
+        __m128 x1 = _mm_loadl_pi(zero, reinterpret_cast<const __m64*>(bq.x1));
+        __m128 x2 = _mm_loadl_pi(zero, reinterpret_cast<const __m64*>(bq.x2));
+        __m128 y1 = _mm_loadl_pi(zero, reinterpret_cast<const __m64*>(bq.y1));
+        __m128 y2 = _mm_loadl_pi(zero, reinterpret_cast<const __m64*>(bq.y2));
+
+        for (int s = 0; s < numFrames; ++s) {
+            __m64* io = reinterpret_cast<__m64*>(frames + 2 * s);
+            const __m128 x = _mm_loadl_pi(zero, io);
+            __m128 y = _mm_add_ps(_mm_mul_ps(b0, x), _mm_mul_ps(b1, x1));
+            y = _mm_add_ps(y, _mm_mul_ps(b2, x2));
+            y = _mm_sub_ps(y, _mm_mul_ps(a1, y1));
+            y = _mm_sub_ps(y, _mm_mul_ps(a2, y2));
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            _mm_storel_pi(io, y);
+        }
+
+        _mm_storel_pi(reinterpret_cast<__m64*>(bq.x1), x1);
+        _mm_storel_pi(reinterpret_cast<__m64*>(bq.x2), x2);
+        _mm_storel_pi(reinterpret_cast<__m64*>(bq.y1), y1);
+        _mm_storel_pi(reinterpret_cast<__m64*>(bq.y2), y2);
+    }
+
+    SYNISTER_SSE2 void quantize(float* samples, float coeff, float invCoeff, int numSamples)
+    {
+        const __m128 c = _mm_set1_ps(coeff);
+        const __m128 inv = _mm_set1_ps(invCoeff);
+        const __m128 half = _mm_set1_ps(.5f);
+        const __m128 sign = _mm_set1_ps(-0.f);
+        int s = 0;
+        for (; s + 4 <= numSamples; s += 4) {
+            // half with the sign of x, rounds -0 to 0 like the scalar version
+            const __m128 x = _mm_mul_ps(_mm_loadu_ps(samples + s), c);
+            const __m128 rounded = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_add_ps(x, _mm_or_ps(half, _mm_and_ps(x, sign)))));
+            _mm_storeu_ps(samples + s, _mm_mul_ps(rounded, inv));
+        }
+        for (; s < numSamples; ++s) {
+            const float x = samples[s] * coeff;
+            samples[s] = static_cast<float>(static_cast<int>(x + (x < 0.f ? -.5f : .5f))) * invCoeff;
+        }
+    }
+
+    SYNISTER_SSE2 void packInt16(const float* src, int16_t* dst, float scale, int numSamples)
+    {
+        // the clamp keeps cvtps2dq in range, the pack saturates nothing any more
+        const __m128 c = _mm_set1_ps(scale);
+        const __m128 lo = _mm_set1_ps(-32768.f);
+        const __m128 hi = _mm_set1_ps(32767.f);
+        int s = 0;
+        for (; s + 8 <= numSamples; s += 8) {
+            const __m128i a = _mm_cvtps_epi32(clamp(_mm_mul_ps(_mm_loadu_ps(src + s), c), lo, hi));
+            const __m128i b = _mm_cvtps_epi32(clamp(_mm_mul_ps(_mm_loadu_ps(src + s + 4), c), lo, hi));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + s), _mm_packs_epi32(a, b));
+        }
+        for (; s < numSamples; ++s) {
+            dst[s] = static_cast<int16_t>(_mm_cvtss_si32(clamp(_mm_set_ss(src[s] * scale), lo, hi)));
+        }
+    }
+
+    SYNISTER_SSE2 void unpackInt16(const int16_t* src, float* dst, float invScale, int numSamples)
+    {
+        const __m128 inv = _mm_set1_ps(invScale);
+        int s = 0;
+        for (; s + 8 <= numSamples; s += 8) {
+            // the sample in the upper half of a 32 bit lane, shifted down with its sign
+            const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + s));
+            const __m128i a = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+            const __m128i b = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+            _mm_storeu_ps(dst + s, _mm_mul_ps(_mm_cvtepi32_ps(a), inv));
+            _mm_storeu_ps(dst + s + 4, _mm_mul_ps(_mm_cvtepi32_ps(b), inv));
+        }
+        for (; s < numSamples; ++s) {
+            dst[s] = static_cast<float>(src[s]) * invScale;
+        }
+    }
+}
+
+bool SimdKernels::useSse2(SimdKernels& k)
+{
+    k.squareLanes = &oscillatorLanes<Square>;
+    k.sawLanes = &oscillatorLanes<Saw>;
+    k.noiseLanes = &::noiseLanes;
+    k.biquadLanes = &::biquadLanes;
+    k.stereoBiquadFrames = &::stereoBiquadFrames;
+    k.quantize = &::quantize;
+    k.packInt16 = &::packInt16;
+    k.unpackInt16 = &::unpackInt16;
+    return true;
+}
+
+#else
+
+bool SimdKernels::useSse2(SimdKernels&)
+{
+    return false;
+}
+
+#endif
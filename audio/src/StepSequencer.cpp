@@ -10,6 +10,7 @@
 
 #include "StepSequencer.h"
 #include "SynthParams.h"
+#include "Instrument.h"
 
 //==============================================================================
 // PUBLIC
@@ -17,17 +18,36 @@
 // contructer & destructer
 StepSequencer::StepSequencer(SynthParams &p)
     : params(p)
-    , currSeqNote(0)
+    , seqPattern(p.seqPattern)
+    , events(nullptr)
+    , pendingEvents(nullptr)
+    , numEvents(0)
+    , numPendingEvents(0)
+    , hasPendingEvents(false)
+    , swapPosition(0.0)
+    , eventsGeneration(0)
+    , eventsVersion(0)
+    , eventsNumSteps(0)
+    , eventsPlayMode(eSeqPlayModes::eSequential)
+    , eventsStepLength(0.0)
+    , random(static_cast<uint32>(Time::getHighResolutionTicks()))
+    , lastPlayedStep(0)
     , lastPlayedNote(0)
-    , seqNoteAdd(1)
     , seqNextStep(0.0)
+    , lastStepPosition(0.0)
     , stopNoteTime(0.0)
     , lastPlayHeadPosition(0.0)
-    , nextPlaySample(0)
-    , noteOffSample(0)
+    , noHostPosition(0.0)
     , seqNoteIsPlaying(false)
+    , lastNoteSent(false)
+    , blockPosition(-1.0)
+    , numRestarts(0)
     , seqStopped(true)
 {
+    // the buffers exist once the members are initialised
+    events = &eventBuffers[0];
+    pendingEvents = &eventBuffers[1];
+
     // save some params in arrays for easier access
     currMidiStepSeq = { &params.seqStep0,
                         &params.seqStep1,
@@ -46,28 +66,26 @@ StepSequencer::StepSequencer(SynthParams &p)
                       &params.seqStepActive5,
                       &params.seqStepActive6,
                       &params.seqStepActive7 };
-    for (int i = 0; i < 8; ++i)
-    {
-        prevMidiStepSeq[i] = static_cast<int>(currMidiStepSeq[i]->get());
-        prevStepOnOff[i] = currStepOnOff[i]->getStep();
-    }
 
     // get GUI params
     seqStepSpeed = 4.0f / params.seqStepSpeed.get(); // internally working with 1/4 = 1.0f
     seqStepLength = jmin(4.0f / params.seqStepLength.get(), seqStepSpeed);
-    seqNumSteps = static_cast<int>(params.seqNumSteps.get());
+    seqNumSteps = jlimit(1, SeqPattern::maxSteps, static_cast<int>(params.seqNumSteps.get()));
+
+    // the first events, stopped they play at once
+    updateEvents();
 }
 
 StepSequencer::~StepSequencer()
 {
 }
 //==============================================================================
-void StepSequencer::runSeq(MidiBuffer & midiMessages, int bufferSize, double sampleRate)
+void StepSequencer::runSeq(MidiEventList& midiMessages, int bufferSize)
 {
     // get GUI params
     seqStepSpeed = 4.0f / params.seqStepSpeed.get(); // internally working with 1/4 = 1.0f
     seqStepLength = jmin(4.0f / params.seqStepLength.get(), seqStepSpeed);
-    seqNumSteps = static_cast<int>(params.seqNumSteps.get());
+    seqNumSteps = jlimit(1, SeqPattern::maxSteps, static_cast<int>(params.seqNumSteps.get()));
 
     if (params.seqDottedLength.getStep() == eOnOffToggle::eOn)
     {
@@ -80,13 +98,22 @@ void StepSequencer::runSeq(MidiBuffer & midiMessages, int bufferSize, double sam
         seqStepLength *= 2.0f / 3.0f;
     }
 
+    // rebuilt only if a step or a play setting changed
+    updateEvents();
+    if (numEvents == 0)
+    {
+        // no pattern could be read yet
+        stopSeq(midiMessages);
+        return;
+    }
+
     if (params.seqPlaySyncHost.getStep() == eOnOffToggle::eOn)
     {
-        seqHostSync(midiMessages);
+        seqHostSync(midiMessages, bufferSize);
     }
     else if (params.seqPlayNoHost.getStep() == eOnOffToggle::eOn)
     {
-        seqNoHostSync(midiMessages, bufferSize, sampleRate);
+        seqNoHostSync(midiMessages, bufferSize);
     }
     else
     {
@@ -136,7 +163,9 @@ void StepSequencer::playRandom(bool play)
 //==============================================================================
 void StepSequencer::generateRandomSeq()
 {
-    for (int i = 0; i < 8; ++i)
+    // the new steps play together
+    const SeqPattern::ScopedEdit edit(seqPattern);
+    for (int i = 0; i < getNumStep(); ++i)
     {
         setStepRandom(i);
     }
@@ -147,28 +176,65 @@ void StepSequencer::setStepRandom(int step)
     float min = params.seqRandomMin.get();
     float max = params.seqRandomMax.get();
 
+    // message thread, the random play mode uses the generator of the audio thread
     Random r = Random();
     r.setSeedRandomly();
-    currMidiStepSeq[step]->set(r.nextFloat() * (max - min) + min, true);
+    const float note = r.nextFloat() * (max - min) + min;
+
+    step = jlimit(0, SeqPattern::maxSteps - 1, step);
+    if (step < numParamSteps)
+    {
+        currMidiStepSeq[step]->set(note, true);
+    }
+    SeqPattern::Step s = seqPattern.getStep(step);
+    s.note = static_cast<uint8>(jlimit(0, 127, static_cast<int>(note)));
+    seqPattern.setStep(step, s);
 }
 
-void StepSequencer::setStepActive(int step, bool active)
+void StepSequencer::setStepNote(int step, int note)
 {
-    if (active)
+    step = jlimit(0, SeqPattern::maxSteps - 1, step);
+    note = jlimit(0, 127, note);
+    if (step < numParamSteps)
     {
-        currStepOnOff[jmax(0, jmin(step, 7))]->setStep(eOnOffToggle::eOn);
+        currMidiStepSeq[step]->set(static_cast<float>(note), true);
     }
-    else
+    SeqPattern::Step s = seqPattern.getStep(step);
+    s.note = static_cast<uint8>(note);
+    seqPattern.setStep(step, s);
+}
+
+void StepSequencer::setStepActive(int step, bool active)
+{
+    step = jlimit(0, SeqPattern::maxSteps - 1, step);
+    if (step < numParamSteps)
     {
-        currStepOnOff[jmax(0, jmin(step, 7))]->setStep(eOnOffToggle::eOff);
+        currStepOnOff[step]->setStep(active ? eOnOffToggle::eOn : eOnOffToggle::eOff);
     }
+    SeqPattern::Step s = seqPattern.getStep(step);
+    s.active = active;
+    seqPattern.setStep(step, s);
+}
+
+void StepSequencer::setStepVelocity(int step, int velocity)
+{
+    SeqPattern::Step s = seqPattern.getStep(step);
+    s.velocity = static_cast<uint8>(jlimit(1, 127, velocity));
+    seqPattern.setStep(step, s);
+}
+
+void StepSequencer::setStepGate(int step, int gate)
+{
+    SeqPattern::Step s = seqPattern.getStep(step);
+    s.gate = static_cast<uint8>(jlimit(1, 100, gate));
+    seqPattern.setStep(step, s);
 }
 
 void StepSequencer::setNumSteps(int numSteps)
 {
     //if (!isPlayRandom())
     //{
-        params.seqNumSteps.set(static_cast<float>(jmax(1, jmin(numSteps, 8))));
+        params.seqNumSteps.set(static_cast<float>(jlimit(1, SeqPattern::maxSteps, numSteps)));
     //}
 }
 
@@ -215,10 +281,15 @@ void StepSequencer::setRandMax(int max)
 {
     params.seqRandomMax.set(jmax(0.0f, jmin(static_cast<float>(max), 127.0f)));
 }
+
+void StepSequencer::setRandomSeed(int seed)
+{
+    params.seqRandomSeed.set(static_cast<float>(jlimit(0, 65535, seed)));
+}
 //==============================================================================
 int StepSequencer::getLastSeqNote()
 {
-    return static_cast<int>(params.seqLastPlayedStep.get());
+    return jmax(0, params.telemetry.display.seqStep.load(std::memory_order_relaxed));
 }
 
 int StepSequencer::getNumStep()
@@ -228,7 +299,21 @@ int StepSequencer::getNumStep()
 
 int StepSequencer::getStepNoteAsInt(int step)
 {
-    return static_cast<int>(currMidiStepSeq[jmax(0, jmin(step, 7))]->get());
+    if (isPositiveAndBelow(step, numParamSteps))
+    {
+        return static_cast<int>(currMidiStepSeq[step]->get());
+    }
+    return seqPattern.getStep(step).note;
+}
+
+int StepSequencer::getStepVelocity(int step)
+{
+    return seqPattern.getStep(step).velocity;
+}
+
+int StepSequencer::getStepGate(int step)
+{
+    return seqPattern.getStep(step).gate;
 }
 
 int StepSequencer::getRandMin()
@@ -270,9 +355,7 @@ String StepSequencer::getRandMaxNoteName(bool sharps, bool octaveNumber, int mid
 //==============================================================================
 bool StepSequencer::isPlaying()
 {
-    AudioPlayHead::CurrentPositionInfo hostPlayHead = params.positionInfo[params.getAudioIndex()];
-
-    if ((params.seqPlayNoHost.getStep() == eOnOffToggle::eOn) || ((params.seqPlaySyncHost.getStep() == eOnOffToggle::eOn) && hostPlayHead.isPlaying))
+    if ((params.seqPlayNoHost.getStep() == eOnOffToggle::eOn) || ((params.seqPlaySyncHost.getStep() == eOnOffToggle::eOn) && params.tempo.isPlaying))
     {
         return true;
     }
@@ -304,261 +387,325 @@ bool StepSequencer::isTripletActive()
 
 bool StepSequencer::isStepActive(int step)
 {
-    return currStepOnOff[jmax(0, jmin(step, 7))]->getStep() == eOnOffToggle::eOn;
+    if (isPositiveAndBelow(step, numParamSteps))
+    {
+        return currStepOnOff[step]->getStep() == eOnOffToggle::eOn;
+    }
+    return seqPattern.getStep(step).active;
 }
 //==============================================================================
 // PRIVATE
 //==============================================================================
 /**
-* Called if stepSequencer plays without host.
+* Called if stepSequencer plays without host. The stepSequencer keeps its own position in quarter notes,
+* which starts at 0 and advances with the tempo like the position of a host would.
 */
-void StepSequencer::seqNoHostSync(MidiBuffer& midiMessages, int bufferSize, double sampleRate)
+void StepSequencer::seqNoHostSync(MidiEventList& midiMessages, int bufferSize)
 {
-    // if is playing a note then prepare sending midi noteOff message
-    if (seqNoteIsPlaying)
+    const double blockStart = seqStopped ? 0.0 : noHostPosition;
+
+    playRange(midiMessages, blockStart, bufferSize, seqStopped);
+
+    noHostPosition = blockStart + static_cast<double>(bufferSize) * params.tempo.beatsPerSample;
+    seqStopped = false;
+}
+
+/**
+* Called while stepSequencer is synced with host.
+*/
+void StepSequencer::seqHostSync(MidiEventList& midiMessages, int bufferSize)
+{
+    const TempoContext& tempo = params.tempo;
+    const double blockStart = tempo.ppqPosition;
+
+    // if host ist playing
+    // NOTE: in Cubase 5 tempo.isPlaying even before actual playhead starts playing,
+    //       at the beginning currPos can be negative
+    if (tempo.isPlaying && (blockStart >= 0.0))
     {
-        // if midi noteOff message fits into current buffer
-        if (noteOffSample < bufferSize - 1)
-        {
-            sendMidiNoteOffMessage(midiMessages, noteOffSample);
+        // start, loop or rewind (blockStart < lastPlayHeadPosition) or a jump past the next step
+        const bool restart = seqStopped || (blockStart < lastPlayHeadPosition) || (seqNextStep < blockStart - tempo.beatsPerSample);
 
-            // calculate currSeqNote to play after previous has been stopped
-            if (params.seqPlayMode.getStep() == eSeqPlayModes::eUpDown)
-            {
-                // if last note then play twice and then play reverse order
-                if (currSeqNote%seqNumSteps == seqNumSteps - 1)
-                {
-                    if ((seqNoteAdd == 0) || (seqNoteAdd == 1))
-                    {
-                        seqNoteAdd--;
-                    }
-                }
-                // if first note then play twice
-                else if (currSeqNote%seqNumSteps == 0)
-                {
-                    if ((seqNoteAdd == 0) || (seqNoteAdd == -1))
-                    {
-                        seqNoteAdd++;
-                    }
-                }
-                else
-                {
-                    // if not first or last note then seqNoteAdd must not be 0
-                    if (seqNoteAdd == 0)
-                    {
-                        seqNoteAdd = 1;
-                    }
-                }
-            }
-            else
-            {
-                seqNoteAdd = 1;
-            }
+        playRange(midiMessages, blockStart, bufferSize, restart);
 
-            currSeqNote += seqNoteAdd;
-            if (currSeqNote < 0)
-            {
-                currSeqNote = seqNumSteps - 1;
-            }
-            currSeqNote = currSeqNote%seqNumSteps;
+        lastPlayHeadPosition = blockStart;
+        seqStopped = false;
+    }
+    else
+    {
+        // if host is not playing then stop sequencer and reset variables
+        stopSeq(midiMessages);
+    }
+}
+
+/**
+* Walk the events of the block that starts at ppq position blockStart. Every step and note end
+* that falls into the block is sent at its own sample, computed from the samples per beat.
+* On a restart the step under the playhead plays at the first sample.
+*/
+void StepSequencer::playRange(MidiEventList& midiMessages, double blockStart, int bufferSize, bool restart)
+{
+    const double blockEnd = blockStart + static_cast<double>(bufferSize) * params.tempo.beatsPerSample;
+    blockPosition = blockStart;
+
+    if (restart)
+    {
+        ++numRestarts;
+
+        // a fixed seed repeats the random notes from every start
+        const int seed = static_cast<int>(params.seqRandomSeed.get());
+        if (seed > 0)
+        {
+            random.setSeed(static_cast<uint32>(seed));
         }
-        else
+
+        if (seqNoteIsPlaying)
+        {
+            sendMidiNoteOffMessage(midiMessages, 0);
+        }
+        // a restart plays the newest events at once
+        if (hasPendingEvents)
         {
-            nextPlaySample -= bufferSize - 1;
-            noteOffSample -= bufferSize - 1;
+            swapEvents();
         }
+        playStep(midiMessages, blockStart, 0);
     }
 
-    // if is not playing a note then prepare sending midi noteOn message
-    if (!seqNoteIsPlaying)
+    // all note ends and steps inside the block in time order
+    for (;;)
     {
-        // if midi noteOn message fits into current buffer
-        if (nextPlaySample < bufferSize - 1)
+        if (seqNoteIsPlaying && (stopNoteTime < blockEnd) && (stopNoteTime <= seqNextStep))
+        {
+            sendMidiNoteOffMessage(midiMessages, getSampleOffset(stopNoteTime, blockStart, bufferSize));
+        }
+        else if (seqNextStep < blockEnd)
         {
-            // set upcoming note to play as random
-            if (params.seqPlayMode.getStep() == eSeqPlayModes:: eRandom)
+            const int sample = getSampleOffset(seqNextStep, blockStart, bufferSize);
+
+            // stop note if could not stopped before playing seqNote (important for seqNoteLength == seqStepSpeed)
+            if (seqNoteIsPlaying)
             {
-                setStepRandom(currSeqNote);
+                sendMidiNoteOffMessage(midiMessages, sample);
             }
-
-            // if any note changed or is muted then send noteOff message to that note
-            midiNoteChanged(midiMessages);
-
-            // send midimessage into midibuffer
-            sendMidiNoteOnMessage(midiMessages, nextPlaySample);
-
-            // calculate noteOffSample and nextPlaySample
-            double quarterSec = 60.0 / params.positionInfo[params.getAudioIndex()].bpm;
-            int diff = bufferSize - 1 - nextPlaySample;
-            noteOffSample = static_cast<int>(quarterSec * seqStepLength * sampleRate) - diff;
-            nextPlaySample = static_cast<int>(quarterSec * seqStepSpeed * sampleRate) - diff;
+            if (hasPendingEvents && (seqNextStep >= swapPosition - 1.0e-6))
+            {
+                swapEvents();
+            }
+            playStep(midiMessages, seqNextStep, sample);
         }
         else
         {
-            nextPlaySample -= bufferSize - 1;
-            noteOffSample -= bufferSize - 1;
+            break;
         }
     }
-    seqStopped = false;
 }
 
 /**
-* Called while stepSequencer is synced with host.
+* Play the event of the step that contains ppq position stepPos at the given sample and advance seqNextStep.
 */
-void StepSequencer::seqHostSync(MidiBuffer& midiMessages)
+void StepSequencer::playStep(MidiEventList& midiMessages, double stepPos, int sample)
 {
-    AudioPlayHead::CurrentPositionInfo hostPlayHead = params.positionInfo[params.getAudioIndex()];
-    double currPos = hostPlayHead.ppqPosition;
+    SYNISTER_COUNT("sequencer steps", 1);
+    const double stepSpeed = static_cast<double>(seqStepSpeed);
 
-    // if host ist playing
-    // NOTE: in Cubase 5 hostPlayHead.isPlaying even before actual playhead starts playing,
-    //       at the beginning currPos can be negative
-    if (hostPlayHead.isPlaying && (currPos >= 0.0))
+    // the epsilon keeps a step boundary from rounding down into the previous step
+    const int64 step = static_cast<int64>(std::floor(stepPos / stepSpeed + 1.0e-6));
+    const SeqEvent& e = (*events)[static_cast<size_t>(step % numEvents)];
+
+    int note = e.note;
+    if (params.seqPlayMode.getStep() == eSeqPlayModes::eRandom)
     {
-        // if currPos passes stopNoteTime
-        if (currPos >= stopNoteTime)
+        // the steps keep their notes, the ui only shows the random one
+        note = nextRandomNote();
+        if (e.step < numParamSteps)
         {
-            if (seqNoteIsPlaying)
-            {
-                sendMidiNoteOffMessage(midiMessages, 0);
-            }
+            params.seqRandomNotes.push(e.step, note);
         }
+    }
 
-        // if currPos passes seqNextStep or (currPos < lastPlayHeadPosition) implies loop or rewind
-        if ((currPos >= seqNextStep) || (currPos < lastPlayHeadPosition))
-        {
-            // stop note if could not stopped before playing seqNote (important for seqNoteLength == seqStepSpeed)
-            if (seqNoteIsPlaying)
-            {
-                sendMidiNoteOffMessage(midiMessages, 0);
-            }
-
-            // calculate note to play
-            currSeqNote = jmax(0, static_cast<int>(currPos / static_cast<double>(seqStepSpeed)) % seqNumSteps);
-            currSeqNote = jmin(currSeqNote, 7);
-
-            // if play upDown -> for all odd periods, play in reverse order (down sequence)
-            if (params.seqPlayMode.getStep() == eSeqPlayModes::eUpDown)
-            {
-                int upDownSeq = jmax(0, static_cast<int>(currPos / static_cast<double>(seqNumSteps) / static_cast<double>(seqStepSpeed)) % 2);
-                if (upDownSeq == 1)
-                {
-                    currSeqNote = seqNumSteps - 1 - currSeqNote;
-                }
-            }
-
-            // if is not playing a note then prepare sending midi noteOn message
-            if (!seqNoteIsPlaying)
-            {
-                // set note to play as random
-                if (params.seqPlayMode.getStep() == eSeqPlayModes::eRandom)
-                {
-                    setStepRandom(currSeqNote);
-                }
+    // send midimessage into midibuffer
+    sendMidiNoteOnMessage(midiMessages, e, note, sample);
 
-                // if any note changed or is muted then send noteOff message to that note
-                midiNoteChanged(midiMessages);
+    // calculate next stopNoteTime and seqNextStep on the grid of the current step speed
+    stopNoteTime = stepPos + e.length;
+    lastStepPosition = stepPos;
+    seqNextStep = static_cast<double>(step + 1) * stepSpeed;
+}
 
-                // send midimessage into midibuffer
-                sendMidiNoteOnMessage(midiMessages, 0);
+/**
+* Draw a note between the random min and max from the generator of the stepSequencer.
+*/
+int StepSequencer::nextRandomNote()
+{
+    const float min = params.seqRandomMin.get();
+    const float max = params.seqRandomMax.get();
+    const float r = (random.nextFloat() + 1.0f) * 0.5f;
+    return jlimit(0, 127, static_cast<int>(r * (max - min) + min));
+}
 
-                // calculate next stopNoteTime
-                stopNoteTime = currPos + seqStepLength;
-            }
-        }
-        // calculate next seqNextStep and save lastPlayHeadPosition
-        double offset = static_cast<double>(seqStepSpeed) - fmod(jmax(0.0, currPos), static_cast<double>(seqStepSpeed));
-        seqNextStep = jmax(0.0, currPos) + offset;
-        lastPlayHeadPosition = currPos;
-        seqStopped = false;
-    }
-    else
-    {
-        // if host is not playing then stop sequencer and reset variables
-        stopSeq(midiMessages);
-    }
+/**
+* Sample of the block starting at ppq position blockStart at which pos is reached, clamped into the block.
+*/
+int StepSequencer::getSampleOffset(double pos, double blockStart, int bufferSize) const
+{
+    const double offset = std::ceil((pos - blockStart) * params.tempo.samplesPerBeat);
+    return jlimit(0, jmax(0, bufferSize - 1), static_cast<int>(offset));
 }
 
 /**
 * Send midi note off message into buffer at given sample position.
 */
-void StepSequencer::sendMidiNoteOffMessage(MidiBuffer& midiMessages, int sample)
+void StepSequencer::sendMidiNoteOffMessage(MidiEventList& midiMessages, int sample)
 {
-    if (currStepOnOff[static_cast<int>(params.seqLastPlayedStep.get())]->getStep() == eOnOffToggle::eOn)
+    if (lastNoteSent)
     {
         MidiMessage m = MidiMessage::noteOff(1, lastPlayedNote);
         midiMessages.addEvent(m, sample);
     }
+    lastNoteSent = false;
     seqNoteIsPlaying = false;
 }
 
 /**
-* Send midi note on message into buffer at given sample position.
+* Send midi note on message of an event into buffer at given sample position, a muted step only moves the position.
 */
-void StepSequencer::sendMidiNoteOnMessage(MidiBuffer & midiMessages, int sample)
+void StepSequencer::sendMidiNoteOnMessage(MidiEventList& midiMessages, const SeqEvent& e, int note, int sample)
 {
-    if (currStepOnOff[currSeqNote]->getStep() == eOnOffToggle::eOn)
+    if (e.active)
     {
-        // emphasis on step 1
-        float seqVelocity = 0.5f;
-        //if (seqNote == 0)
-        //{
-        //    seqVelocity = 0.85f;
-        //}
-
-        MidiMessage m = MidiMessage::noteOn(1, static_cast<int>(currMidiStepSeq[currSeqNote]->get()), seqVelocity);
+        MidiMessage m = MidiMessage::noteOn(1, note, e.velocity);
         midiMessages.addEvent(m, sample);
     }
+    lastNoteSent = e.active;
     seqNoteIsPlaying = true;
-    params.seqLastPlayedStep.set(jmax(0.0f, jmin(static_cast<float>(currSeqNote), 7.0f)));
-    lastPlayedNote = static_cast<int>(currMidiStepSeq[currSeqNote]->get());
+    params.telemetry.display.seqStep.store(e.step, std::memory_order_relaxed);
+    lastPlayedStep = e.step;
+    lastPlayedNote = note;
 }
 
 /**
-* If any seqStepNote changed or is muted then send noteOff message for the old note.
+* Copy the step params into the pattern and rebuild the pending events if the pattern or the play settings changed.
+* While an edit of the pattern is open nothing is read, the edit is taken as a whole in a later block.
 */
-void StepSequencer::midiNoteChanged(MidiBuffer & midiMessages)
+void StepSequencer::updateEvents()
 {
-    for (int i = 0; i < seqNumSteps; ++i)
+    const uint32 sequence = seqPattern.getSequence();
+    if ((sequence & 1u) != 0)
     {
-        // compare with current sequence
-        if ((prevMidiStepSeq[i] != static_cast<int>(currMidiStepSeq[i]->get())) || (prevStepOnOff[i] != currStepOnOff[i]->getStep()))
+        return;
+    }
+
+    // the host and the ui change the first steps through their params
+    for (int i = 0; i < numParamSteps; ++i)
+    {
+        SeqPattern::Step s = seqPattern.getStep(i);
+        s.note = static_cast<uint8>(jlimit(0, 127, static_cast<int>(currMidiStepSeq[i]->get())));
+        s.active = currStepOnOff[i]->getStep() == eOnOffToggle::eOn;
+        seqPattern.setStep(i, s);
+    }
+
+    const eSeqPlayModes playMode = params.seqPlayMode.getStep();
+    if ((seqPattern.getVersion() != eventsVersion) || (seqNumSteps != eventsNumSteps)
+        || (playMode != eventsPlayMode) || (seqStepLength != eventsStepLength))
+    {
+        SeqPattern::Data data;
+        uint32 version;
+        if (!seqPattern.readData(data, version, sequence))
+        {
+            // an edit started meanwhile
+            return;
+        }
+
+        // one event per step, upDown plays the steps in reverse order for all odd periods
+        numPendingEvents = 0;
+        for (int i = 0; i < seqNumSteps; ++i)
+        {
+            addEvent(data, i);
+        }
+        if (playMode == eSeqPlayModes::eUpDown)
         {
-            if (i == static_cast<int>(params.seqLastPlayedStep.get()))
+            for (int i = seqNumSteps - 1; i >= 0; --i)
             {
-                MidiMessage m = MidiMessage::noteOff(1, prevMidiStepSeq[i]);
-                midiMessages.addEvent(m, 0);
+                addEvent(data, i);
             }
         }
+
+        eventsVersion = version;
+        eventsNumSteps = seqNumSteps;
+        eventsPlayMode = playMode;
+        eventsStepLength = seqStepLength;
+
+        // a rebuild of waiting events keeps their swap position
+        if (!hasPendingEvents)
+        {
+            swapPosition = getSwapPosition();
+            hasPendingEvents = true;
+        }
     }
 
-    // save new sequence
-    for (int i = 0; i < 8; ++i)
+    // a stopped sequencer starts with the newest events
+    if (hasPendingEvents && seqStopped)
     {
-        prevMidiStepSeq[i] = static_cast<int>(currMidiStepSeq[i]->get());
-        prevStepOnOff[i] = currStepOnOff[i]->getStep();
+        swapEvents();
     }
 }
 
+void StepSequencer::addEvent(const SeqPattern::Data& data, int step)
+{
+    const SeqPattern::Step s = SeqPattern::unpack(data[static_cast<size_t>(step)]);
+    SeqEvent& e = (*pendingEvents)[static_cast<size_t>(numPendingEvents++)];
+    e.length = seqStepLength * static_cast<double>(s.gate) / 100.0;
+    e.step = step;
+    e.note = s.note;
+    e.velocity = s.velocity;
+    e.active = s.active;
+}
+
+/**
+* Ppq position from which on the pending events play: the next step, or the first step at or after the
+* start of the next bar. Bars are counted from ppq position 0 with the time signature of the host.
+*/
+double StepSequencer::getSwapPosition() const
+{
+    if (params.seqPatternSwap.getStep() == eSeqPatternSwap::eStep)
+    {
+        return 0.0;
+    }
+    const double barLength = params.tempo.barLength;
+    return (std::floor(lastStepPosition / barLength + 1.0e-6) + 1.0) * barLength;
+}
+
+/**
+* The pending events play from the next step on, the playing note ends as it would have.
+*/
+void StepSequencer::swapEvents()
+{
+    std::swap(events, pendingEvents);
+    numEvents = numPendingEvents;
+    hasPendingEvents = false;
+    ++eventsGeneration;
+}
+
 /**
 * Stop stepSequencer and reset not GUI variables.
 */
-void StepSequencer::stopSeq(MidiBuffer& midiMessages)
+void StepSequencer::stopSeq(MidiEventList& midiMessages)
 {
     // stop and reset only if not already stopped
     if (!seqStopped)
     {
-        params.seqLastPlayedStep.set(0.0f);
-        currSeqNote = 0;
+        params.telemetry.display.seqStep.store(-1, std::memory_order_relaxed);
+        blockPosition = -1.0;
+        lastPlayedStep = 0;
         lastPlayedNote = 0;
-        seqNoteAdd = 1;
-        nextPlaySample = 0;
-        noteOffSample = 0;
         seqNextStep = 0.0;
+        lastStepPosition = 0.0;
         stopNoteTime = 0.0;
         lastPlayHeadPosition = 0.0;
+        noHostPosition = 0.0;
         seqStopped = true;
         seqNoteIsPlaying = false;
+        lastNoteSent = false;
 
         // stop all midimessages from sequencer
         MidiMessage m = MidiMessage::allNotesOff(1);
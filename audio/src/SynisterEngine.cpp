@@ -0,0 +1,149 @@
+/*
+  ==============================================================================
+
+    SynisterEngine.cpp
+    Created: 16 Oct 2026 6:02:14pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "SynisterEngine.h"
+#include "PluginProcessor.h"
+
+struct SynisterEngine::Impl {
+    //! the timers and async updates of the processor need a message manager, also in a host without one
+    ScopedJuceInitialiser_GUI juceInitialiser;
+    ScopedPointer<PluginAudioProcessor> processor;
+    Settings settings;
+    MidiBuffer pending;     //!< at offsets from the start of the next render()
+    MidiBuffer blockMidi;
+    MidiBuffer carried;
+    String lastError;
+
+    explicit Impl(const Settings& s)
+        : processor(new PluginAudioProcessor())
+        , settings(s)
+    {
+        // room for a few thousand events, so render() does not allocate for ordinary sequences
+        pending.ensureSize(8192);
+        blockMidi.ensureSize(8192);
+        carried.ensureSize(8192);
+        prepare();
+    }
+
+    ~Impl()
+    {
+        processor->releaseResources();
+    }
+
+    void prepare()
+    {
+        processor->setPlayConfigDetails(0, 2, settings.sampleRate, settings.maxBlockSize);
+        processor->setNonRealtime(!settings.realtime);
+        processor->prepareToPlay(settings.sampleRate, settings.maxBlockSize);
+    }
+
+    //! like the OfflineRenderer, the params the patch leaves out get their default
+    bool load(const XmlElement* patch, const String& source)
+    {
+        if (patch == nullptr || patch->getTagName() != "patch") {
+            lastError = "no patch: " + source;
+            return false;
+        }
+        processor->applyPatch(processor->getDefaultPatch());
+
+        PatchValues values;
+        values.values.resize(processor->serializeParams.size());
+        processor->parsePatch(*patch, eSerializationParams::eAll, values);
+        processor->applyPatch(values);
+        processor->patchName = patch->getStringAttribute("patchname");
+        lastError = String();
+        return true;
+    }
+};
+
+//==============================================================================
+std::unique_ptr<SynisterEngine> SynisterEngine::create(const Settings& settings)
+{
+    if (settings.sampleRate < 8000. || settings.sampleRate > 384000. || settings.maxBlockSize < 1 || settings.maxBlockSize > 8192) {
+        return nullptr;
+    }
+    return std::unique_ptr<SynisterEngine>(new SynisterEngine(new Impl(settings)));
+}
+
+SynisterEngine::SynisterEngine(Impl* i)
+    : impl(i)
+{
+}
+
+SynisterEngine::~SynisterEngine()
+{
+}
+
+bool SynisterEngine::loadPatch(const char* path)
+{
+    const File file(File::getCurrentWorkingDirectory().getChildFile(String::fromUTF8(path)));
+    ScopedPointer<XmlElement> patch = XmlDocument::parse(file);
+    return impl->load(patch, file.getFullPathName());
+}
+
+bool SynisterEngine::loadPatchXml(const char* xml)
+{
+    ScopedPointer<XmlElement> patch = XmlDocument::parse(String::fromUTF8(xml));
+    return impl->load(patch, "xml text");
+}
+
+void SynisterEngine::pushMidi(const unsigned char* data, int numBytes, int frameOffset)
+{
+    impl->pending.addEvent(data, numBytes, jmax(0, frameOffset));
+}
+
+void SynisterEngine::noteOn(int channel, int note, float velocity, int frameOffset)
+{
+    const MidiMessage m = MidiMessage::noteOn(jlimit(1, 16, channel), jlimit(0, 127, note), jlimit(0.f, 1.f, velocity));
+    impl->pending.addEvent(m, jmax(0, frameOffset));
+}
+
+void SynisterEngine::noteOff(int channel, int note, int frameOffset)
+{
+    impl->pending.addEvent(MidiMessage::noteOff(jlimit(1, 16, channel), jlimit(0, 127, note)), jmax(0, frameOffset));
+}
+
+void SynisterEngine::reset()
+{
+    impl->pending.clear();
+    // prepared again like for every render of the OfflineRenderer, no voice or echo is left
+    impl->processor->releaseResources();
+    impl->prepare();
+}
+
+void SynisterEngine::render(float* left, float* right, int numFrames)
+{
+    const int maxBlockSize = impl->settings.maxBlockSize;
+    for (int start = 0; start < numFrames; start += maxBlockSize) {
+        const int numSamples = jmin(maxBlockSize, numFrames - start);
+        float* channels[2] = { left + start, right + start };
+        AudioSampleBuffer buffer(channels, 2, numSamples);
+        buffer.clear();
+
+        impl->blockMidi.clear();
+        impl->blockMidi.addEvents(impl->pending, start, numSamples, -start);
+        impl->processor->processBlock(buffer, impl->blockMidi);
+    }
+
+    // the events after these frames play in the next call
+    impl->carried.clear();
+    impl->carried.addEvents(impl->pending, numFrames, -1, -numFrames);
+    impl->pending.swapWith(impl->carried);
+}
+
+double SynisterEngine::getSampleRate() const
+{
+    return impl->settings.sampleRate;
+}
+
+const char* SynisterEngine::getLastError() const
+{
+    return impl->lastError.toRawUTF8();
+}
@@ -1,4 +1,6 @@
 #include "SynthParams.h"
+#include "FxChain.h"
+#include "FilterBank.h"
 
 
 namespace {
@@ -18,32 +20,82 @@ namespace {
         "Sequential", "Up/Down", "Random", nullptr
     };
 
+    static const char *seqPatternSwapNames[] = {
+        "Next Step", "Next Bar", nullptr
+    };
+
+    static const char *modulationRateNames[] = {
+        "Sample Rate", "16 Samples", "32 Samples", "Adaptive", nullptr
+    };
+
+    static const char *oversamplingNames[] = {
+        "Off", "2x", "4x", "Adaptive", nullptr
+    };
+
+    static const char *filterRoutingNames[] = {
+        "Per Oscillator", "Post Mix", nullptr
+    };
+
+    static const char *chorusInterpolationNames[] = {
+        "Linear", "Hermite", "Allpass", nullptr
+    };
+
+    static const char *delayStorageNames[] = {
+        "32 Bit Float", "16 Bit Fixed", "16 Bit Half", nullptr
+    };
+
+    static const char *voiceModeNames[] = {
+        "Poly", "Legato", nullptr
+    };
+
     static const char *biquadFilters[] = {
         "Lowpass", "Highpass", "Bandpass", "Ladder", nullptr
     };
 
+    static const char *filterTopologyNames[] = {
+        "Biquad", "SVF", nullptr
+    };
+
+    static const char *clippingModeNames[] = {
+        "Hard", "Tanh", "Cubic", nullptr
+    };
+
+    static const char *fxTypeNames[] = {
+        "LowFi", "Clipping", "Delay", "Chorus", "Reverb", "Waveshaper", nullptr
+    };
+
+    static const char *shaperCurveNames[] = {
+        "Tanh", "Asymmetric", "Foldback", nullptr
+    };
+
     static const char *modsourcenames[] = {
         "None", "Aftertouch (AT)", "KeyBipolar (KB)", "InvertedVelocity (-Vel)", "Velocity (Vel)", "Foot (Ft)", "ExpPedal (Ped)", "Modwheel (MW)", "Pitchbend (PB)",
-        "LFO1", "LFO2", "LFO3", "VolEnvelope", "Envelope2", "Envelope3", nullptr
+        "LFO1", "LFO2", "LFO3", "VolEnvelope", "Envelope2", "Envelope3",
+        "NotePitch (NP)", "NotePressure (NPr)", "NoteTimbre (NT)", nullptr
     };
 
     static const char *modSourceNamesShort[] = {
         " ", "AT", "KB", "-Vel", "Vel", "Ft", "Ped", "MW", "PB",
-        "1", "2", "3", "1", "2", "3", nullptr
+        "1", "2", "3", "1", "2", "3", "NP", "NPr", "NT", nullptr
     };
 
     static const char *waveformNames[] = {
-        "Square", "Saw", "White-noise"
+        "Square", "Saw", "White-noise", "Wavetable", "Sample"
     };
 }
 
 
+const char* const SynthParams::seqPatternTag = "seqPattern";
+const char* const SynthParams::oscSampleTag = "oscSample";
+const char* const SynthParams::sparseAttribute = "sparse";
+
 const Colour SynthParams::oscColour (0xff6c788c);
 const Colour SynthParams::envColour (0xffbfa65a);
 const Colour SynthParams::lfoColour (0xff855050);
 const Colour SynthParams::filterColour (0xff557144);
 const Colour SynthParams::fxColour (0xff2b3240);
 const Colour SynthParams::stepSeqColour (0xff564c43);
+const Colour SynthParams::scopeColour (0xff3c4a4f);
 const Colour SynthParams::onOffSwitchEnabled (0xff557144);
 const Colour SynthParams::onOffSwitchDisabled (102, 102, 102);
 const Colour SynthParams::envelopeCurveLine (216, 202, 155);
@@ -57,34 +109,45 @@ SynthParams::SynthParams()
         // TODO: Think of another way to register all the struct params?
     //Oscillators PArams
     &osc[0].fine, &osc[0].coarse, &osc[0].panDir,&osc[0].vol,&osc[0].trngAmount,&osc[0].pulseWidth,&osc[0].waveForm,&osc[0].pitchModAmount1, &osc[0].pitchModAmount2,&osc[0].pitchModSrc1, &osc[0].pitchModSrc2,
-    &osc[0].panModAmount1, &osc[0].panModAmount2, &osc[0].panModSrc1,&osc[0].panModSrc2,&osc[0].shapeModAmount1,&osc[0].shapeModAmount2,&osc[0].shapeModSrc1, &osc[0].shapeModSrc2,&osc[0].gainModAmount1,&osc[0].gainModAmount2,&osc[0].gainModSrc1,&osc[0].gainModSrc2, &osc[0].oscActivation,
+    &osc[0].panModAmount1, &osc[0].panModAmount2, &osc[0].panModSrc1,&osc[0].panModSrc2,&osc[0].shapeModAmount1,&osc[0].shapeModAmount2,&osc[0].shapeModSrc1, &osc[0].shapeModSrc2,&osc[0].gainModAmount1,&osc[0].gainModAmount2,&osc[0].gainModSrc1,&osc[0].gainModSrc2, &osc[0].oscActivation, &osc[0].bandLimited, &osc[0].unisonVoices, &osc[0].unisonDetune, &osc[0].unisonSpread,
     &osc[1].fine, &osc[1].coarse, &osc[1].panDir,&osc[1].vol,&osc[1].trngAmount,&osc[1].pulseWidth,&osc[1].waveForm,&osc[1].pitchModAmount1, &osc[1].pitchModAmount2,&osc[1].pitchModSrc1, &osc[1].pitchModSrc2,
-    &osc[1].panModAmount1, &osc[1].panModAmount2, &osc[1].panModSrc1, &osc[1].panModSrc2,&osc[1].shapeModAmount1,&osc[1].shapeModAmount2,&osc[1].shapeModSrc1, &osc[1].shapeModSrc2,&osc[1].gainModAmount1,&osc[1].gainModAmount2,&osc[1].gainModSrc1,&osc[1].gainModSrc2, &osc[1].oscActivation,
+    &osc[1].panModAmount1, &osc[1].panModAmount2, &osc[1].panModSrc1, &osc[1].panModSrc2,&osc[1].shapeModAmount1,&osc[1].shapeModAmount2,&osc[1].shapeModSrc1, &osc[1].shapeModSrc2,&osc[1].gainModAmount1,&osc[1].gainModAmount2,&osc[1].gainModSrc1,&osc[1].gainModSrc2, &osc[1].oscActivation, &osc[1].bandLimited, &osc[1].unisonVoices, &osc[1].unisonDetune, &osc[1].unisonSpread,
     &osc[2].fine, &osc[2].coarse, &osc[2].panDir,&osc[2].vol,&osc[2].trngAmount,&osc[2].pulseWidth,&osc[2].waveForm,&osc[2].pitchModAmount1, &osc[2].pitchModAmount2,&osc[2].pitchModSrc1, &osc[2].pitchModSrc2,
-    &osc[2].panModAmount1, &osc[2].panModAmount2, &osc[2].panModSrc1, &osc[2].panModSrc2, &osc[2].shapeModAmount1,&osc[2].shapeModAmount2,&osc[2].shapeModSrc1, &osc[2].shapeModSrc2,&osc[2].gainModAmount1,&osc[2].gainModAmount2,&osc[2].gainModSrc1,&osc[2].gainModSrc2, &osc[2].oscActivation,
+    &osc[2].panModAmount1, &osc[2].panModAmount2, &osc[2].panModSrc1, &osc[2].panModSrc2, &osc[2].shapeModAmount1,&osc[2].shapeModAmount2,&osc[2].shapeModSrc1, &osc[2].shapeModSrc2,&osc[2].gainModAmount1,&osc[2].gainModAmount2,&osc[2].gainModSrc1,&osc[2].gainModSrc2, &osc[2].oscActivation, &osc[2].bandLimited, &osc[2].unisonVoices, &osc[2].unisonDetune, &osc[2].unisonSpread,
     //Envelopes Params
     &env[0].attack, &env[0].decay, &env[0].sustain, &env[0].release, &env[0].attackShape, &env[0].decayShape, &env[0].releaseShape, &env[0].speedModAmount1, &env[0].speedModAmount2, &env[0].speedModSrc1, &env[0].speedModSrc2,
     &env[1].attack, &env[1].decay, &env[1].sustain, &env[1].release, &env[1].attackShape, &env[1].decayShape, &env[1].releaseShape, &env[1].speedModAmount1, &env[1].speedModAmount2, &env[1].speedModSrc1, &env[1].speedModSrc2,
     &envVol[0].attack, &envVol[0].decay, &envVol[0].sustain, &envVol[0].release, &envVol[0].attackShape, &envVol[0].decayShape, &envVol[0].releaseShape, &envVol[0].speedModAmount1, &envVol[0].speedModAmount2, &envVol[0].speedModSrc1, &envVol[0].speedModSrc2,
     //LFOs Params
-    &lfo[0].fadeIn, &lfo[0].freq, &lfo[0].freqModSrc1, &lfo[0].freqModSrc2, &lfo[0].freqModAmount1, &lfo[0].freqModAmount2, &lfo[0].tempSync, &lfo[0].wave, &lfo[0].noteLength, &lfo[0].gainModSrc, &lfo[0].lfoTriplets, &lfo[0].lfoDottedLength,
-    &lfo[1].fadeIn, &lfo[1].freq, &lfo[1].freqModSrc1, &lfo[1].freqModSrc2, &lfo[1].freqModAmount1, &lfo[1].freqModAmount2, &lfo[1].tempSync, &lfo[1].wave, &lfo[1].noteLength, &lfo[1].gainModSrc, &lfo[1].lfoTriplets, &lfo[1].lfoDottedLength,
-    &lfo[2].fadeIn, &lfo[2].freq, &lfo[2].freqModSrc1, &lfo[2].freqModSrc2, &lfo[2].freqModAmount1, &lfo[2].freqModAmount2, &lfo[2].tempSync, &lfo[2].wave, &lfo[2].noteLength, &lfo[2].gainModSrc, &lfo[2].lfoTriplets, &lfo[2].lfoDottedLength,
+    &lfo[0].fadeIn, &lfo[0].freq, &lfo[0].freqModSrc1, &lfo[0].freqModSrc2, &lfo[0].freqModAmount1, &lfo[0].freqModAmount2, &lfo[0].tempSync, &lfo[0].wave, &lfo[0].noteLength, &lfo[0].gainModSrc, &lfo[0].lfoTriplets, &lfo[0].lfoDottedLength, &lfo[0].global,
+    &lfo[1].fadeIn, &lfo[1].freq, &lfo[1].freqModSrc1, &lfo[1].freqModSrc2, &lfo[1].freqModAmount1, &lfo[1].freqModAmount2, &lfo[1].tempSync, &lfo[1].wave, &lfo[1].noteLength, &lfo[1].gainModSrc, &lfo[1].lfoTriplets, &lfo[1].lfoDottedLength, &lfo[1].global,
+    &lfo[2].fadeIn, &lfo[2].freq, &lfo[2].freqModSrc1, &lfo[2].freqModSrc2, &lfo[2].freqModAmount1, &lfo[2].freqModAmount2, &lfo[2].tempSync, &lfo[2].wave, &lfo[2].noteLength, &lfo[2].gainModSrc, &lfo[2].lfoTriplets, &lfo[2].lfoDottedLength, &lfo[2].global,
     //Filters Params
-    &filter[0].passtype, &filter[0].lpCutoff, &filter[0].hpCutoff, &filter[0].resonance, &filter[0].lpModAmount1, &filter[0].lpModAmount2, &filter[0].lpCutModSrc1, &filter[0].lpCutModSrc2, &filter[0].hpModAmount1, &filter[0].hpModAmount2, &filter[0].hpCutModSrc1, &filter[0].hpCutModSrc2, &filter[0].resModAmount1, &filter[0].resModAmount2, &filter[0].resonanceModSrc1, &filter[0].resonanceModSrc2, &filter[0].filterActivation,
-    &filter[1].passtype, &filter[1].lpCutoff, &filter[1].hpCutoff, &filter[1].resonance, &filter[1].lpModAmount1, &filter[1].lpModAmount2, &filter[1].lpCutModSrc1, &filter[1].lpCutModSrc2, &filter[1].hpModAmount1, &filter[1].hpModAmount2, &filter[1].hpCutModSrc1, &filter[1].hpCutModSrc2, &filter[1].resModAmount1, &filter[1].resModAmount2, &filter[1].resonanceModSrc1, &filter[1].resonanceModSrc2, &filter[1].filterActivation,
+    &filter[0].passtype, &filter[0].topology, &filter[0].ladderOversampling, &filter[0].lpCutoff, &filter[0].hpCutoff, &filter[0].resonance, &filter[0].lpModAmount1, &filter[0].lpModAmount2, &filter[0].lpCutModSrc1, &filter[0].lpCutModSrc2, &filter[0].hpModAmount1, &filter[0].hpModAmount2, &filter[0].hpCutModSrc1, &filter[0].hpCutModSrc2, &filter[0].resModAmount1, &filter[0].resModAmount2, &filter[0].resonanceModSrc1, &filter[0].resonanceModSrc2, &filter[0].filterActivation,
+    &filter[1].passtype, &filter[1].topology, &filter[1].ladderOversampling, &filter[1].lpCutoff, &filter[1].hpCutoff, &filter[1].resonance, &filter[1].lpModAmount1, &filter[1].lpModAmount2, &filter[1].lpCutModSrc1, &filter[1].lpCutModSrc2, &filter[1].hpModAmount1, &filter[1].hpModAmount2, &filter[1].hpCutModSrc1, &filter[1].hpCutModSrc2, &filter[1].resModAmount1, &filter[1].resModAmount2, &filter[1].resonanceModSrc1, &filter[1].resonanceModSrc2, &filter[1].filterActivation,
     //Step Sequencer
     &seqPlaySyncHost, &seqPlayMode, &seqNumSteps, &seqStepSpeed, &seqStepLength, &seqTriplets, &seqDottedLength, &seqStep0, &seqStep1, &seqStep2, &seqStep3, &seqStep4, &seqStep5, &seqStep6, &seqStep7,
-    &seqStepActive0, &seqStepActive1, &seqStepActive2, &seqStepActive3, &seqStepActive4, &seqStepActive5, &seqStepActive6, &seqStepActive7, &seqRandomMin, &seqRandomMax,
+    &seqStepActive0, &seqStepActive1, &seqStepActive2, &seqStepActive3, &seqStepActive4, &seqStepActive5, &seqStepActive6, &seqStepActive7, &seqRandomMin, &seqRandomMax, &seqRandomSeed, &seqPatternSwap,
     //Delay
-    &delayDryWet, &delayFeedback, &delayTime, &delaySync, &delayDividend, &delayDivisor, &delayCutoff, &delayResonance, &delayTriplet, &delayDottedLength, &delayRecordFilter, &delayReverse, &delayActivation, &syncToggle,
+    &delayDryWet, &delayFeedback, &delayTime, &delaySync, &delayDividend, &delayDivisor, &delayCutoff, &delayResonance, &delayTriplet, &delayDottedLength, &delayRecordFilter, &delayReverse, &delayPingPong, &delayActivation, &syncToggle, &delayStorage,
     //Others
-    &freq, &masterAmp, &masterPan, &chorActivation, &chorActivation, &chorDelayLength, &chorDryWet, &chorModDepth, &chorModRate, &lowFiActivation, &nBitsLowFi, &clippingActivation, &clippingFactor,
+    &freq, &polyphony, &midiChannel, &oversampling, &filterRouting, &mpeMode, &voiceMode, &openGLRendering, &masterAmp, &masterPan, &limiterActivation, &limiterCeiling, &morphX, &morphY, &glideTime, &chorActivation, &chorActivation, &chorDelayLength, &chorDryWet, &chorModDepth, &chorModRate, &chorInterpolation, &lowFiActivation, &nBitsLowFi, &lowFiDownsample, &clippingActivation, &clippingFactor, &clippingMode, &fxSlot0, &fxSlot1, &fxSlot2, &fxSlot3, &fxSlot4, &fxSlot5,
+    &reverbSize, &reverbDecay, &reverbDamping, &reverbDryWet, &reverbActivation, &shaperDrive, &shaperCurve, &shaperOversampling, &shaperActivation,
     //Sections
-    &oscSection, &envSection, &lfoSection, &filterSection, &fxSection, &seqSection
+    &oscSection, &envSection, &lfoSection, &filterSection, &fxSection, &seqSection, &scopeSection
     }
     , stepSeqParams{ &seqPlaySyncHost, &seqPlayMode, &seqNumSteps, &seqStepSpeed, &seqStepLength, &seqTriplets, &seqDottedLength, &seqStep0, &seqStep1, &seqStep2, &seqStep3, &seqStep4, &seqStep5, &seqStep6, &seqStep7,
-    &seqStepActive0, &seqStepActive1, &seqStepActive2, &seqStepActive3, &seqStepActive4, &seqStepActive5, &seqStepActive6, &seqStepActive7, &seqRandomMin, &seqRandomMax }
+    &seqStepActive0, &seqStepActive1, &seqStepActive2, &seqStepActive3, &seqStepActive4, &seqStepActive5, &seqStepActive6, &seqStepActive7, &seqRandomMin, &seqRandomMax, &seqRandomSeed, &seqPatternSwap }
+    , masterAmp("master amp", "masterAmp", "Master amp", "dB", -96.f, 12.f, -6.f)
+    , masterPan("master pan", "masterPan", "Master pan", "%", -100.f, 100.f, 0.f)
+    , limiterActivation("Limiter", "limiterActivation", "Limiter Active", eOnOffToggle::eOff, onoffnames)
+    , limiterCeiling("ceiling", "limiterCeiling", "Limiter ceiling", "dB", -12.f, 0.f, -0.3f)
+    , freq("main freq", "freq", "freq", "Hz", 220.f, 880.f, 440.f)
+    , polyphony("polyphony", "polyphony", "Polyphony", "", 1.f, 64.f, 8.f)
+    , midiChannel("midi channel", "midiChannel", "Midi channel", "", 0.f, 16.f, 0.f)
+    , morphX("morph x", "morphX", "Morph X", "", 0.f, 1.f, 0.f)
+    , morphY("morph y", "morphY", "Morph Y", "", 0.f, 1.f, 0.f)
+    , glideTime("glide", "glideTime", "Glide Time", "s", 0.f, 2.f, 0.f)
     // section states
     , oscSection("oscillator section", "oscSection", "oscillator section", eSectionState::eExpanded, sectionStateNames)
     , envSection("envelopes section", "envSection", "envelopes section", eSectionState::eCollapsed, sectionStateNames)
@@ -92,46 +155,46 @@ SynthParams::SynthParams()
     , filterSection("filter section", "filterSection", "filter section", eSectionState::eCollapsed, sectionStateNames)
     , fxSection("fx section", "fxSection", "fx section", eSectionState::eCollapsed, sectionStateNames)
     , seqSection("sequencer section", "seqSection", "sequencer section", eSectionState::eCollapsed, sectionStateNames)
-    , masterAmp("master amp", "masterAmp", "Master amp", "dB", -96.f, 12.f, -6.f)
-    , masterPan("master pan", "masterPan", "Master pan", "%", -100.f, 100.f, 0.f)
-    , freq("main freq", "freq", "freq", "Hz", 220.f, 880.f, 440.f)
+    , scopeSection("scope section", "scopeSection", "scope section", eSectionState::eCollapsed, sectionStateNames)
     // FX
-    , delayDryWet("dry/wet", "delWet", "Delay dry/wet", "", 0.f, 1.f, 0.f)
-    , delayFeedback("feedback", "delFeed", "Delay feedback", "", 0.f, 1.f, 0.f)
-    , delayTime("time", "delTime", "Delay time", "ms", 1., 20000., 1000.)
-    , delaySync("Tempo Sync", "delSync", "Delay sync", eOnOffToggle::eOff, onoffnames)
-    , delayDividend("SyncDel Dividend", "delDivd", "Delay dividend", "", 1, 5, 1)
-    , delayDivisor("SyncDel Divisor", "delDivs", "Delay divisor", "", 1, 64, 4)
-    , delayCutoff("lp cutoff", "delCut", "Delay cutoff", "Hz", 40.f, 20000.f, 20000.f)
-    , delayResonance("resonance", "delRes", "Delay resonance", "dB", -25.f, 0.f, 0.f)
-    , delayTriplet("Delay Triplet", "delTrip", "Delay triplet", eOnOffToggle::eOff, onoffnames)
-    , delayDottedLength("Delay Dotted Length", "delDot", "Delay dotted length", eOnOffToggle::eOff, onoffnames)
-    , delayRecordFilter("Delay Record", "delRec", "Delay record filter", eOnOffToggle::eOff, onoffnames)
-    , delayReverse("Delay Reverse", "delRev", "Delay reverse", eOnOffToggle::eOff, onoffnames)
-    , delayActivation("Delay Activation", "delayActivation", "Delay Active", eOnOffToggle::eOff, onoffnames)
-    , syncToggle("Delay Sync", "syncToggle", "Sync Toggle", eOnOffToggle::eOff, onoffnames)
-    , lowFiActivation("Activation", "lowFiActivation", "LowFi Active", eOnOffToggle::eOff, onoffnames)
-    , nBitsLowFi("bit degr.", "nBitsLowFi", "Number Bits", "bit", 1.f, 16.f, 16.f)
+    , clippingFactor("clipping", "clippingFactor", "Clipping", "dB", 0.f, 25.f, 0.0f)
+    , clippingActivation("Activation", "clippingActivation", "Clipping Active", eOnOffToggle::eOff, onoffnames)
+    , clippingMode("Mode", "clippingMode", "Clipping Mode", eClippingMode::eHard, clippingModeNames)
     , chorDelayLength("width", "chorWidth", "Chorus Width", "s", .02f, .08f, .05f)
     , chorModRate("rate", "chorRate", "Chorus Rate", "Hz", 0.f, 1.5f, 0.5f)
     , chorDryWet("dry/wet", "ChorAmount", "Chorus Dry/Wet", "", 0.f, 1.f, 0.f)
     , chorModDepth("depth", "ChorDepth", "Chorus Depth", "ms", 1.f, 20.f, 15.f)
     , chorActivation("Activation", "chorActivation", "Chorus Active", eOnOffToggle::eOff, onoffnames)
-    , clippingFactor("clipping", "clippingFactor", "Clipping", "dB", 0.f, 25.f, 0.0f)
-    , clippingActivation("Activation", "clippingActivation", "Clipping Active", eOnOffToggle::eOff, onoffnames)
+    , chorInterpolation("Interpolation", "chorInterp", "Chorus Interpolation", eChorusInterpolation::eLinear, chorusInterpolationNames)
+    , fxSlot0("FX Slot 1", "fxSlot0", "FX Slot 1", eFxType::eLowFi, fxTypeNames)
+    , fxSlot1("FX Slot 2", "fxSlot1", "FX Slot 2", eFxType::eClipping, fxTypeNames)
+    , fxSlot2("FX Slot 3", "fxSlot2", "FX Slot 3", eFxType::eDelay, fxTypeNames)
+    , fxSlot3("FX Slot 4", "fxSlot3", "FX Slot 4", eFxType::eChorus, fxTypeNames)
+    , fxSlot4("FX Slot 5", "fxSlot4", "FX Slot 5", eFxType::eReverb, fxTypeNames)
+    , fxSlot5("FX Slot 6", "fxSlot5", "FX Slot 6", eFxType::eWaveshaper, fxTypeNames)
+    , reverbSize("size", "reverbSize", "Reverb Size", "", .5f, 2.f, 1.f)
+    , reverbDecay("decay", "reverbDecay", "Reverb Decay", "s", .2f, 10.f, 2.f)
+    , reverbDamping("damping", "reverbDamping", "Reverb Damping", "Hz", 500.f, 20000.f, 6000.f)
+    , reverbDryWet("dry/wet", "reverbDryWet", "Reverb Dry/Wet", "", 0.f, 1.f, .3f)
+    , reverbActivation("Activation", "reverbActivation", "Reverb Active", eOnOffToggle::eOff, onoffnames)
+    , shaperDrive("drive", "shaperDrive", "Waveshaper Drive", "dB", 0.f, 24.f, 12.f)
+    , shaperCurve("Curve", "shaperCurve", "Waveshaper Curve", eShaperCurve::eTanh, shaperCurveNames)
+    , shaperOversampling("Oversampling", "shaperOversampling", "Waveshaper Oversampling", eOnOffToggle::eOff, onoffnames)
+    , shaperActivation("Activation", "shaperActivation", "Waveshaper Active", eOnOffToggle::eOff, onoffnames)
     // sequencer
     , seqPlaceHolder("Placeholder", "seqPlaceholder", "SeqPlaceholder", "", 0.0f, 127.0f, 126.0f)
     , seqPlayNoHost("Play No Host", "seqPlayNoHost", "seqPlayNoHost", eOnOffToggle::eOff, onoffnames)
     , seqPlaySyncHost("Play Sync Host", "seqPlaySyncHost", "seqPlaySyncHost", eOnOffToggle::eOff, onoffnames)
     , seqPlayMode("SeqPlayMode", "seqPlayMode", "SeqPlayMode", eSeqPlayModes::eSequential, seqPlayModeNames)
-    , seqLastPlayedStep("Last Played Step", "lastPlayedStep", "Last Played Step", "", 0.0f, 7.0f, 0.0f)
-    , seqNumSteps("Steps", "seqNumSteps", "Steps", "", 1.0f, 8.0f, 8.0f)
+    , seqNumSteps("Steps", "seqNumSteps", "Steps", "", 1.0f, static_cast<float>(SeqPattern::maxSteps), 8.0f)
     , seqStepSpeed("Speed", "seqStepSpeed", "Speed", "", 1.0f, 64.0f, 4.0f)
     , seqStepLength("Length", "seqNoteLength", "Length", "", 1.0f, 64.0f, 4.0f)
     , seqTriplets("Seq Triplets", "seqTriplets", "Seq Triplets", eOnOffToggle::eOff, onoffnames)
     , seqDottedLength("Seq Dotted Length", "seqDottedLength", "Seq Dotted Length", eOnOffToggle::eOff, onoffnames)
     , seqRandomMin("Min", "seqRandomMin", "Min", "", 0.0f, 127.0f, 0.0f)
     , seqRandomMax("Max", "seqRandomMax", "Max", "", 0.0f, 127.0f, 127.0f)
+    , seqRandomSeed("Random Seed", "seqRandomSeed", "Random Seed", "", 0.0f, 65535.0f, 0.0f)
+    , seqPatternSwap("Pattern Swap", "seqPatternSwap", "Pattern Swap", eSeqPatternSwap::eStep, seqPatternSwapNames)
     , seqStep0("Step 0", "seqNote0", "Step 0", "", 0.0f, 127.0f, 60.0f)
     , seqStep1("Step 1", "seqNote1", "Step 1", "", 0.0f, 127.0f, 62.0f)
     , seqStep2("Step 2", "seqNote2", "Step 2", "", 0.0f, 127.0f, 64.0f)
@@ -148,11 +211,59 @@ SynthParams::SynthParams()
     , seqStepActive5("Step 5 Active", "seqStepActive5", "Step 5 Active", eOnOffToggle::eOn, onoffnames)
     , seqStepActive6("Step 6 Active", "seqStepActive6", "Step 6 Active", eOnOffToggle::eOn, onoffnames)
     , seqStepActive7("Step 7 Active", "seqStepActive7", "Step 7 Active", eOnOffToggle::eOn, onoffnames)
+    // FX
+    , lowFiActivation("Activation", "lowFiActivation", "LowFi Active", eOnOffToggle::eOff, onoffnames)
+    , nBitsLowFi("bit degr.", "nBitsLowFi", "Number Bits", "bit", 1.f, 16.f, 16.f)
+    , lowFiDownsample("downsample", "lowFiDownsample", "LowFi Downsampling", "x", 1.f, 32.f, 1.f)
+    , delayDryWet("dry/wet", "delWet", "Delay dry/wet", "", 0.f, 1.f, 0.f)
+    , delayFeedback("feedback", "delFeed", "Delay feedback", "", 0.f, 1.f, 0.f)
+    , delayTime("time", "delTime", "Delay time", "ms", 1., 20000., 1000.)
+    , delaySync("Tempo Sync", "delSync", "Delay sync", eOnOffToggle::eOff, onoffnames)
+    , delayDividend("SyncDel Dividend", "delDivd", "Delay dividend", "", 1, 5, 1)
+    , delayDivisor("SyncDel Divisor", "delDivs", "Delay divisor", "", 1, 64, 4)
+    , delayCutoff("lp cutoff", "delCut", "Delay cutoff", "Hz", 40.f, 20000.f, 20000.f)
+    , delayResonance("resonance", "delRes", "Delay resonance", "dB", -25.f, 0.f, 0.f)
+    , delayTriplet("Delay Triplet", "delTrip", "Delay triplet", eOnOffToggle::eOff, onoffnames)
+    , delayDottedLength("Delay Dotted Length", "delDot", "Delay dotted length", eOnOffToggle::eOff, onoffnames)
+    , delayRecordFilter("Delay Record", "delRec", "Delay record filter", eOnOffToggle::eOff, onoffnames)
+    , delayReverse("Delay Reverse", "delRev", "Delay reverse", eOnOffToggle::eOff, onoffnames)
+    , delayPingPong("Delay Ping-Pong", "delPingPong", "Delay ping-pong", eOnOffToggle::eOff, onoffnames)
+    , delayActivation("Delay Activation", "delayActivation", "Delay Active", eOnOffToggle::eOff, onoffnames)
+    , syncToggle("Delay Sync", "syncToggle", "Sync Toggle", eOnOffToggle::eOff, onoffnames)
+    , delayStorage("Delay Storage", "delStorage", "Delay storage", eDelayStorage::eFloat, delayStorageNames)
+    // engine
+    , voiceBankMode("Voice Bank", "voiceBankMode", "Voice Bank", eOnOffToggle::eOff, onoffnames)
+    , parallelVoices("Parallel Voices", "parallelVoices", "Parallel Voices", eOnOffToggle::eOff, onoffnames)
+    , modulationRate("Modulation Rate", "modulationRate", "Modulation Rate", eModulationRate::eAdaptive, modulationRateNames)
+    , releaseTailLevel("Release Tail", "releaseTailLevel", "Release Tail", "dB", -96.f, 0.f, -60.f)
+    , cpuVoiceLimit("CPU Voice Limit", "cpuVoiceLimit", "CPU Voice Limit", eOnOffToggle::eOn, onoffnames)
+    , oversampling("Oversampling", "oversampling", "Oversampling", eOversampling::eOff, oversamplingNames)
+    , filterRouting("Filter Routing", "filterRouting", "Filter Routing", eFilterRouting::ePerOscillator, filterRoutingNames)
+    , mpeMode("MPE", "mpeMode", "MPE", eOnOffToggle::eOff, onoffnames)
+    , voiceMode("Voice Mode", "voiceMode", "Voice Mode", eVoiceMode::ePoly, voiceModeNames)
+    , openGLRendering("OpenGL Rendering", "openGLRendering", "OpenGL Rendering", eOnOffToggle::eOff, onoffnames)
+    , offlineQuality("Offline Quality", "offlineQuality", "Offline Quality", eOnOffToggle::eOn, onoffnames)
+    , renderSubdivision("Render Subdivision", "renderSubdivision", "Render Subdivision", "samples", 1.f, 512.f, 64.f)
+    , noteCache("Note Cache", "noteCache", "Note Cache", eOnOffToggle::eOff, onoffnames)
+    , fixedEngineRate("Fixed Engine Rate", "fixedEngineRate", "Fixed Engine Rate", eOnOffToggle::eOff, onoffnames)
+    , lockMemory("Lock Memory", "lockMemory", "Lock Memory", eOnOffToggle::eOff, onoffnames)
+    , pipelinedFx("Pipelined FX", "pipelinedFx", "Pipelined FX", eOnOffToggle::eOff, onoffnames)
+    , seqFreeze("Seq Freeze", "seqFreeze", "Seq Freeze", eOnOffToggle::eOff, onoffnames)
+    , guiThrottle("GUI Throttle", "guiThrottle", "GUI Throttle", "%", 10.f, 100.f, 70.f)
     //Others
-    , positionIndex(0)
+    , snapshot(nullptr)
+    , numBlockEvents(0)
+    , patchLoader(*this, static_cast<int>(serializeParams.size()))
+    , morph(*this)
 {    
-    positionInfo[0].resetToDefault();
-    positionInfo[1].resetToDefault();
+    const size_t alignment = alignof(ParamSnapshot);
+    snapshotStorage.allocate(sizeof(ParamSnapshot) + alignment - 1, true);
+    void* alignedStorage = snapshotStorage.getData() + (alignment - reinterpret_cast<pointer_sized_uint>(snapshotStorage.getData()) % alignment) % alignment;
+    snapshot = new (alignedStorage) ParamSnapshot();
+
+    // empty until the first block compiles it, no key matches
+    std::memset(&renderPlan, 0, sizeof(renderPlan));
+    renderPlanKey.fill(-1);
 
     osc[0].setName("osc 1");
     osc[1].setName("osc 2");
@@ -168,6 +279,41 @@ SynthParams::SynthParams()
 
     filter[0].setName("filter 1");
     filter[1].setName("filter 2");
+
+    for (Param* p : serializeParams) {
+        p->setEventQueues(&hostEvents, &uiEvents);
+    }
+
+    // after the names, the element tags contain the prefixes
+    buildRegistry(serializeRegistry, serializeParams);
+    buildRegistry(stepSeqRegistry, stepSeqParams);
+    for (Param* p : serializeParams) {
+        if (p->serializationTag() != "") {
+            const uint32 id = getParamId(getElementTag(*p));
+            // a hash collision, one of the tags has to change
+            jassert(!idRegistry.contains(id));
+            idRegistry.set(id, p);
+            p->setStateGeneration(&stateGeneration);
+        }
+    }
+
+    // the editor slows down while the audio thread is busy
+    uiUpdates.setLoadMonitor(&telemetry.display.audioLoad, &guiThrottle);
+
+    // what sparse patches and chunks are relative to, built once
+    defaultPatch.values.resize(serializeParams.size());
+    defaultPatch.numValues = static_cast<int>(serializeParams.size());
+    for (size_t i = 0; i < serializeParams.size(); ++i) {
+        defaultPatch.values[i] = std::make_pair(serializeParams[i], serializeParams[i]->getDefaultUI());
+    }
+    SeqPattern::getDefaultData(defaultPatch.pattern);
+    defaultPatch.hasPattern = true;
+
+    // automated gains of the feedback loop click without a ramp
+    delayFeedback.setSmoothingTime(.02f);
+    delayDryWet.setSmoothingTime(.02f);
+
+    updateSnapshot();
 }
 
 SynthParams::Osc::Osc()
@@ -196,6 +342,10 @@ SynthParams::Osc::Osc()
     , gainModSrc1("GainModSrc1", "GainModSrc1", "Gain ModSource 1", eModSource::eNone, modsourcenames)
     , gainModSrc2("GainModSrc2", "GainModSrc2", "Gain ModSource 2", eModSource::eNone, modsourcenames)
     , oscActivation("Activation", "Activation", "Active", eOnOffToggle::eOn, onoffnames)
+    , bandLimited("Band-limited", "bandLimited", "Band-limited", eOnOffToggle::eOn, onoffnames)
+    , unisonVoices("unison", "unisonVoices", "unison voices", "", 1.f, 8.f, 1.f, 8)
+    , unisonDetune("detune", "unisonDetune", "unison detune", "ct", 0.f, 100.f, 20.f)
+    , unisonSpread("spread", "unisonSpread", "unison spread", "%", 0.f, 100.f, 50.f)
 {
 }
 
@@ -240,11 +390,14 @@ SynthParams::Lfo::Lfo()
     , freqModSrc1("FreqModSrc1", "LFOFreqModSrc1", "Freq ModSource 1", eModSource::eNone, modsourcenames)
     , freqModSrc2("FreqModSrc2", "LFOFreqModSrc2", "Freq ModSource 2", eModSource::eNone, modsourcenames)
     , gainModSrc("GainModSrc", "LFOGainModSrc", "Gain ModSource", eModSource::eNone, modsourcenames)
+    , global("Global", "LFOGlobal", "Global", eOnOffToggle::eOff, onoffnames)
 {
 }
 
 SynthParams::Filter::Filter()
     : passtype("Type", "FILTERType", "Type", eBiquadFilters::eLowpass, biquadFilters)
+    , topology("Topology", "FILTERTopology", "Topology", eFilterTopology::eBiquad, filterTopologyNames)
+    , ladderOversampling("Ladder 2x", "FILTERLadderOversampling", "Ladder Oversampling", eOnOffToggle::eOff, onoffnames)
     , lpCutoff("LPcutoff", "lpCutoff", "LP Cutoff", "Hz", 10.f, 20000.f, 20000.f)
     , hpCutoff("HPcutoff", "hpCutoff", "HP Cutoff", "Hz", 10.f, 20000.f, 10.f)
     , resonance("reson.", "FILTERResonance", "Resonance", "", 0.f, 10.f, 0.f)
@@ -265,6 +418,24 @@ SynthParams::Filter::Filter()
 {
 }
 
+void SynthParams::Filter::fillSnapshot(ParamSnapshot::Filter& dst) const
+{
+    dst.active = filterActivation.getStep() == eOnOffToggle::eOn;
+    dst.passtype = passtype.getStep();
+    dst.topology = topology.getStep();
+    dst.ladderOversampling = ladderOversampling.getStep() == eOnOffToggle::eOn;
+    dst.lpCutoff = lpCutoff.getBlockValue();
+    dst.hpCutoff = hpCutoff.getBlockValue();
+    dst.cutoffMin = lpCutoff.getMin();
+    dst.cutoffMax = lpCutoff.getMax();
+    dst.resonance = resonance.getBlockValue();
+    dst.resonanceMin = resonance.getMin();
+    dst.resonanceMax = resonance.getMax();
+    dst.lpModRange = lpModAmount1.getMax();
+    dst.hpModRange = hpModAmount1.getMax();
+    dst.resModRange = resModAmount1.getMax();
+}
+
 void SynthParams::addElement(XmlElement* patch, String name, float value) {
     XmlElement* node = new XmlElement(name);
     node->setAttribute("value", value);
@@ -282,14 +453,35 @@ void SynthParams::writeXMLPatchTree(XmlElement* patch, eSerializationParams para
         parameters = stepSeqParams;
     }
 
+    // a complete patch only needs the params off their default, the sequencer params stay complete
+    const bool sparse = paramsToSerialize == eSerializationParams::eAll;
+    if (sparse) {
+        patch->setAttribute(sparseAttribute, 1);
+    }
+
     // iterate over all params and insert them into the tree
     for (auto &param : parameters) {
         float value = param->getUI();
-        if (param->serializationTag() != "") {
-            String prefixedName = (param->prefix() + param->serializationTag()).replace(" ", "");
-            addElement(patch, prefixedName, value);
+        if (param->serializationTag() != "" && !(sparse && value == param->getDefaultUI())) {
+            addElement(patch, getElementTag(*param), value);
     }
 }
+
+    // the steps beyond the params, velocities and gates
+    SeqPattern::Data pattern;
+    seqPattern.getData(pattern);
+    patch->createNewChildElement(seqPatternTag)->setAttribute("steps", SeqPattern::toString(pattern));
+
+    if (paramsToSerialize == eSerializationParams::eAll) {
+        for (size_t o = 0; o < osc.size(); ++o) {
+            const File file = osc[o].sample.getFile();
+            if (file != File::nonexistent) {
+                XmlElement* element = patch->createNewChildElement(oscSampleTag);
+                element->setAttribute("osc", static_cast<int>(o));
+                element->setAttribute("file", file.getFullPathName());
+            }
+        }
+    }
 }
 
 // TODO: add more diverse colours, note that what if lfo modulates lfo? -> same colour, currently draw saturn with saturation
@@ -342,58 +534,371 @@ void SynthParams::writeXMLPatchStandalone(eSerializationParams paramsToSerialize
 }
 
 
-// adds the value if it exists in the xml
-void SynthParams::fillValueIfExists(XmlElement* patch, String paramName, Param& param) {
-    String prefixedName = (param.prefix() + param.serializationTag()).replace(" ", "");
-    if (patch->getChildByName(prefixedName) != NULL) {
-        param.setUI(static_cast<float>(patch->getChildByName(prefixedName)->getDoubleAttribute("value")));
-        //! \todo dirty flag needs to be set! This is a bad hack, please use get/set instead of getUI/setUI
-        param.set(param.get(),true);
-        //param.set(static_cast<float>(patch->getChildByName(paramName)->getDoubleAttribute("value")), true); // NOTE: needed at least for seq standalone and envShape params but then at least
-                                                                                                            // delay feedback and dry are bad and (ampVol sometimes); not further tested
+String SynthParams::getElementTag(const Param& param) {
+    return (param.prefix() + param.serializationTag()).replace(" ", "");
+}
+
+void SynthParams::buildRegistry(HashMap<String, Param*>& registry, const std::vector<Param*>& parameters) {
+    for (Param* param : parameters) {
+        if (param->serializationTag() != "") {
+            const String tag = getElementTag(*param);
+            // two params with one tag would be read from the same element
+            jassert(!registry.contains(tag));
+            registry.set(tag, param);
+        }
     }
 }
 
+uint32 SynthParams::getParamId(const String& elementTag) {
+    // FNV-1a, unlike String::hashCode() it is part of the format
+    uint32 h = 2166136261u;
+    for (const char* c = elementTag.toRawUTF8(); *c != 0; ++c) {
+        h = (h ^ static_cast<uint8>(*c)) * 16777619u;
+    }
+    return h;
+}
+
+// sets a value of the patch
+void SynthParams::fillValue(Param& param, float value) {
+    param.setUI(value);
+    //! \todo dirty flag needs to be set! This is a bad hack, please use get/set instead of getUI/setUI
+    param.set(param.get(),true);
+    //param.set(static_cast<float>(patch->getChildByName(paramName)->getDoubleAttribute("value")), true); // NOTE: needed at least for seq standalone and envShape params but then at least
+                                                                                                        // delay feedback and dry are bad and (ampVol sometimes); not further tested
+}
+
 // set all values from xml file in params
 void SynthParams::fillValues(XmlElement* patch, eSerializationParams paramsToSerialize) {
-    // if the versions don't align, inform the user
     if (patch == NULL) return;
-    if (patch->getTagName() != "patch" || (static_cast<float>(patch->getDoubleAttribute("version"))) > version) {
-        AlertWindow::showMessageBoxAsync(AlertWindow::WarningIcon, "Version Conflict",
-            "The file was created by a newer version of the software, some settings may be ignored.",
-            "OK");
-    }
+    checkPatchVersion(static_cast<float>(patch->getDoubleAttribute("version")), patch->getTagName() == "patch");
 
-    std::vector<Param*> parameters = serializeParams;
-    if (paramsToSerialize == eSerializationParams::eSequencerOnly)
-    {
-        parameters = stepSeqParams;
-    }
+    const HashMap<String, Param*>& registry = paramsToSerialize == eSerializationParams::eSequencerOnly ? stepSeqRegistry : serializeRegistry;
 
     patchName = patch->getStringAttribute("patchname");
     patchNameDirty = true;
 
-    // iterate over all params and set the values if they exist in the xml
-    for (auto &param : parameters) {
-        if (param->serializationTag() != "") {
-        fillValueIfExists(patch, param->serializationTag(), *param);
+    // the params a sparse patch leaves out are at their default
+    if (paramsToSerialize == eSerializationParams::eAll && patch->getBoolAttribute(sparseAttribute)) {
+        fillDefaults();
     }
+
+    // a patch without a sample element plays none
+    if (paramsToSerialize == eSerializationParams::eAll) {
+        for (Osc& o : osc) {
+            o.sample.set(nullptr);
+        }
     }
 
+    // iterate over the xml once and set the values of the params it contains
+    forEachXmlChildElement(*patch, element) {
+        if (Param* param = registry[element->getTagName()]) {
+            fillValue(*param, static_cast<float>(element->getDoubleAttribute("value")));
+        } else if (element->hasTagName(seqPatternTag)) {
+            SeqPattern::Data pattern;
+            if (SeqPattern::fromString(element->getStringAttribute("steps"), pattern)) {
+                seqPattern.setData(pattern);
+            }
+        } else if (element->hasTagName(oscSampleTag) && paramsToSerialize == eSerializationParams::eAll) {
+            const int o = element->getIntAttribute("osc", -1);
+            if (o >= 0 && o < static_cast<int>(osc.size())) {
+                osc[static_cast<size_t>(o)].sample.load(File(element->getStringAttribute("file")));
+            }
+        }
+    }
+
+}
+void SynthParams::fillDefaults() {
+    for (int i = 0; i < defaultPatch.numValues; ++i) {
+        fillValue(*defaultPatch.values[i].first, defaultPatch.values[i].second);
+    }
+    seqPattern.setData(defaultPatch.pattern);
 }
+
 void SynthParams::readXMLPatchHost(const void* data, int sizeInBytes, eSerializationParams paramsToSerialize) {
     ScopedPointer<XmlElement> patch = AudioProcessor::getXmlFromBinary(data, sizeInBytes);
     fillValues(patch, paramsToSerialize);
 }
 
+void SynthParams::parsePatch(const XmlElement& patch, eSerializationParams paramsToSerialize, PatchValues& dst) const {
+    const HashMap<String, Param*>& registry = paramsToSerialize == eSerializationParams::eSequencerOnly ? stepSeqRegistry : serializeRegistry;
+
+    // in the order of the xml, so a repeated element wins like in fillValues()
+    dst.fromDefaults = paramsToSerialize == eSerializationParams::eAll && patch.getBoolAttribute(sparseAttribute);
+    dst.numValues = 0;
+    dst.hasPattern = false;
+    dst.hasSamples = paramsToSerialize == eSerializationParams::eAll;
+    dst.samples.fill(nullptr);
+    forEachXmlChildElement(patch, element) {
+        if (Param* param = registry[element->getTagName()]) {
+            if (dst.numValues < static_cast<int>(dst.values.size())) {
+                dst.values[dst.numValues++] = std::make_pair(param, static_cast<float>(element->getDoubleAttribute("value")));
+            }
+        } else if (element->hasTagName(seqPatternTag)) {
+            dst.hasPattern = SeqPattern::fromString(element->getStringAttribute("steps"), dst.pattern);
+        } else if (element->hasTagName(oscSampleTag) && dst.hasSamples) {
+            // mapped here on the loader thread, the audio thread only sets the pointers
+            const int o = element->getIntAttribute("osc", -1);
+            if (o >= 0 && o < static_cast<int>(dst.samples.size())) {
+                osc[0].sample.getLibrary().load(File(element->getStringAttribute("file")), dst.samples[static_cast<size_t>(o)]);
+            }
+        }
+    }
+}
+
+void SynthParams::applyPatch(const PatchValues& patch) {
+    // the sequencer takes the step params and the pattern together
+    const SeqPattern::ScopedEdit edit(seqPattern);
+    if (patch.fromDefaults) {
+        applyPatch(defaultPatch);
+    }
+    for (int i = 0; i < patch.numValues; ++i) {
+        Param* param = patch.values[i].first;
+        // out of range values of older patches are skipped like in Param::setUI()
+        param->setUI(patch.values[i].second, false);
+        param->markUIDirty();
+    }
+    if (patch.hasPattern) {
+        seqPattern.setData(patch.pattern);
+    }
+    if (patch.hasSamples) {
+        for (size_t o = 0; o < osc.size(); ++o) {
+            osc[o].sample.set(patch.samples[o]);
+        }
+    }
+}
+
+void SynthParams::checkPatchVersion(float patchVersion, bool isPatch) {
+    // if the versions don't align, inform the user
+    if (!isPatch || patchVersion > version) {
+#if SYNISTER_ENGINE_ONLY
+        // an embedding host may have no message loop for a window
+        DBG("The file was created by a newer version of the software, some settings may be ignored.");
+#else
+        AlertWindow::showMessageBoxAsync(AlertWindow::WarningIcon, "Version Conflict",
+            "The file was created by a newer version of the software, some settings may be ignored.",
+            "OK");
+#endif
+    }
+}
+
+void SynthParams::writeBinaryPatchHost(MemoryBlock& destData) {
+    destData.reset();
+    MemoryOutputStream out(destData, false);
+    // header, the name is the only field of variable size
+    out.writeInt(static_cast<int>(binaryMagic));
+    out.writeInt(static_cast<int>(binaryFormatVersion));
+    out.writeFloat(version);
+    out.writeString(patchName);
+
+    // sparse, only the params off their default, the reader starts from getDefaultPatch()
+    int numChanged = 0;
+    for (HashMap<uint32, Param*>::Iterator i(idRegistry); i.next();) {
+        numChanged += i.getValue()->getUI() != i.getValue()->getDefaultUI() ? 1 : 0;
+    }
+    out.preallocate(static_cast<int64>(28 + patchName.getNumBytesAsUTF8() + 8 * numChanged + 4 * SeqPattern::maxSteps));
+    out.writeInt(numChanged);
+    for (HashMap<uint32, Param*>::Iterator i(idRegistry); i.next();) {
+        const float value = i.getValue()->getUI();
+        if (value != i.getValue()->getDefaultUI()) {
+            out.writeInt(static_cast<int>(i.getKey()));
+            out.writeFloat(value);
+        }
+    }
+
+    // appended, version 1 readers stop after the params
+    SeqPattern::Data pattern;
+    seqPattern.getData(pattern);
+    out.writeInt(SeqPattern::maxSteps);
+    for (uint32 step : pattern) {
+        out.writeInt(static_cast<int>(step));
+    }
+
+    // appended, readers without samples stop after the pattern
+    out.writeInt(static_cast<int>(osc.size()));
+    for (const Osc& o : osc) {
+        const File file = o.sample.getFile();
+        out.writeString(file != File::nonexistent ? file.getFullPathName() : String());
+    }
+
+    // appended, readers without a morph stop after the samples
+    morph.writeCorners(out);
+}
+
+SynthParams::StateKey SynthParams::getStateKey() const {
+    StateKey key;
+    key.generation = stateGeneration.load(std::memory_order_acquire);
+    key.patternVersion = seqPattern.getVersion();
+    key.morphVersion = morph.getVersion();
+    key.patchName = patchName;
+    for (size_t o = 0; o < osc.size(); ++o) {
+        key.samples[o] = osc[o].sample.get();
+    }
+    return key;
+}
+
+void SynthParams::writeCachedPatchHost(MemoryBlock& destData) {
+    const ScopedLock sl(cachedStateLock);
+    // taken before the chunk is written, a change meanwhile rebuilds it on the next call
+    const StateKey key = getStateKey();
+    if (!cachedStateValid || !(key == cachedStateKey)) {
+        writeBinaryPatchHost(cachedState);
+        cachedStateKey = key;
+        cachedStateValid = true;
+    }
+    destData = cachedState;
+}
+
+void SynthParams::readPatchHost(const void* data, int sizeInBytes) {
+    // the instances of a session often restore one chunk, it is parsed once
+    PatchStateCache::State::Ptr state = stateCache->find(data, sizeInBytes);
+    if (state == nullptr) {
+        state = new PatchStateCache::State();
+        if (!parseHostState(data, sizeInBytes, *state)) {
+            if (state->tooNew) {
+                checkPatchVersion(state->patchVersion, true);
+            }
+            return;
+        }
+        stateCache->add(data, sizeInBytes, state);
+    }
+    applyHostState(*state);
+}
+
+bool SynthParams::parseHostState(const void* data, int sizeInBytes, PatchStateCache::State& dst) const {
+    dst.samples.clear();
+    for (size_t o = 0; o < osc.size(); ++o) {
+        dst.samples.add(String());
+    }
+
+    MemoryInputStream in(data, static_cast<size_t>(sizeInBytes), false);
+    if (sizeInBytes < 16 || static_cast<uint32>(in.readInt()) != binaryMagic) {
+        // saved before the binary format, the elements are matched by their tags like in fillValues()
+        ScopedPointer<XmlElement> patch = AudioProcessor::getXmlFromBinary(data, sizeInBytes);
+        if (patch == nullptr) {
+            return false;
+        }
+        dst.patchVersion = static_cast<float>(patch->getDoubleAttribute("version"));
+        dst.isPatch = patch->getTagName() == "patch";
+        dst.patchName = patch->getStringAttribute("patchname");
+        dst.fromDefaults = patch->getBoolAttribute(sparseAttribute);
+        forEachXmlChildElement(*patch, element) {
+            if (serializeRegistry.contains(element->getTagName())) {
+                dst.values.push_back(std::make_pair(getParamId(element->getTagName()), static_cast<float>(element->getDoubleAttribute("value"))));
+            } else if (element->hasTagName(seqPatternTag)) {
+                if (SeqPattern::fromString(element->getStringAttribute("steps"), dst.pattern)) {
+                    dst.hasPattern = true;
+                    dst.numSteps = SeqPattern::maxSteps;
+                }
+            } else if (element->hasTagName(oscSampleTag)) {
+                const int o = element->getIntAttribute("osc", -1);
+                if (o >= 0 && o < dst.samples.size()) {
+                    dst.samples.set(o, element->getStringAttribute("file"));
+                }
+            }
+        }
+        return true;
+    }
+
+    // a format this version cannot read is not guessed at
+    const uint32 formatVersion = static_cast<uint32>(in.readInt());
+    if (formatVersion > binaryFormatVersion) {
+        dst.tooNew = true;
+        dst.patchVersion = std::numeric_limits<float>::max();
+        return false;
+    }
+    dst.patchVersion = in.readFloat();
+    dst.isPatch = true;
+    dst.patchName = in.readString();
+
+    // a sparse chunk has the params off their default, the pattern follows in full
+    dst.fromDefaults = formatVersion >= sparseFormatVersion;
+
+    // unknown ids are from newer versions, applying skips them
+    const int numParams = in.readInt();
+    dst.values.reserve(static_cast<size_t>(jlimit(0, static_cast<int>(in.getNumBytesRemaining() / 8), numParams)));
+    for (int i = 0; i < numParams && in.getNumBytesRemaining() >= 8; ++i) {
+        const uint32 id = static_cast<uint32>(in.readInt());
+        const float value = in.readFloat();
+        dst.values.push_back(std::make_pair(id, value));
+    }
+
+    // chunks of older versions end here, the steps not saved keep their value
+    if (in.getNumBytesRemaining() >= 4) {
+        dst.hasPattern = true;
+        const int numSteps = in.readInt();
+        for (int i = 0; i < numSteps && in.getNumBytesRemaining() >= 4; ++i) {
+            const uint32 step = static_cast<uint32>(in.readInt());
+            if (i < SeqPattern::maxSteps) {
+                dst.pattern[static_cast<size_t>(i)] = step;
+                dst.numSteps = i + 1;
+            }
+        }
+    }
+
+    // chunks without samples play none
+    if (in.getNumBytesRemaining() >= 4) {
+        const int numSamples = in.readInt();
+        for (int i = 0; i < numSamples && !in.isExhausted(); ++i) {
+            const String path = in.readString();
+            if (i < dst.samples.size()) {
+                dst.samples.set(i, path);
+            }
+        }
+    }
+
+    // chunks without corners play no morph
+    dst.hasMorph = true;
+    in.readIntoMemoryBlock(dst.morphCorners);
+    return true;
+}
+
+void SynthParams::applyHostState(const PatchStateCache::State& state) {
+    checkPatchVersion(state.patchVersion, state.isPatch);
+
+    // the sequencer takes the step params and the pattern together
+    const SeqPattern::ScopedEdit edit(seqPattern);
+
+    patchName = state.patchName;
+    patchNameDirty = true;
+
+    if (state.fromDefaults) {
+        fillDefaults();
+    }
+    // params the chunk does not know keep their value
+    for (const std::pair<uint32, float>& v : state.values) {
+        if (Param* param = idRegistry[v.first]) {
+            fillValue(*param, v.second);
+        }
+    }
+
+    if (state.hasPattern) {
+        SeqPattern::Data pattern;
+        seqPattern.getData(pattern);
+        std::copy(state.pattern.begin(), state.pattern.begin() + state.numSteps, pattern.begin());
+        seqPattern.setData(pattern);
+    }
+
+    for (size_t o = 0; o < osc.size(); ++o) {
+        osc[o].sample.set(nullptr);
+        const String& path = state.samples[static_cast<int>(o)];
+        if (path.isNotEmpty()) {
+            osc[o].sample.load(File(path));
+        }
+    }
+
+    if (state.hasMorph) {
+        MemoryInputStream in(state.morphCorners, false);
+        morph.readCorners(in);
+    }
+}
+
 void SynthParams::readXMLPatchStandalone(eSerializationParams paramsToSerialize) {
     // read the xml params into the synth params
     FileChooser openFileChooser("Please select the patch you want to read!", 
         File::getSpecialLocation(File::commonDocumentsDirectory).getChildFile("Synister"), "*.xml");
     if (openFileChooser.browseForFileToOpen()) {
-        File openedFile(openFileChooser.getResult());
-        ScopedPointer<XmlElement> patch = XmlDocument::parse(openedFile);
-        fillValues(patch, paramsToSerialize);
+        // parsed in the background, the audio thread switches to the whole patch at once
+        patchLoader.load(openFileChooser.getResult(), paramsToSerialize, paramsToSerialize == eSerializationParams::eAll);
     }
 }
 
@@ -419,12 +924,303 @@ String SynthParams::getShortModSrcName(int index)
     }
 }
 
-int SynthParams::getAudioIndex()
+bool SynthParams::isModSourceRead(eModSource source) const
+{
+    if (globalModMatrix.isSourceUsed(source)) {
+        return true;
+    }
+    for (const Lfo& l : lfo) {
+        if (l.gainModSrc.getStep() == source || l.freqModSrc1.getStep() == source || l.freqModSrc2.getStep() == source) {
+            return true;
+        }
+    }
+    return envVol[0].speedModSrc1.getStep() == source || envVol[0].speedModSrc2.getStep() == source
+        || env[0].speedModSrc1.getStep() == source || env[0].speedModSrc2.getStep() == source
+        || env[1].speedModSrc1.getStep() == source || env[1].speedModSrc2.getStep() == source;
+}
+
+void SynthParams::drainParamEvents()
 {
-    return positionIndex.load();
+    numBlockEvents = hostEvents.pop(blockEvents.data(), maxBlockEvents);
+    numBlockEvents += uiEvents.pop(blockEvents.data() + numBlockEvents, maxBlockEvents - numBlockEvents);
+
+    // what does not fit is already in the params, the queues must not fill up
+    ParamEvent dropped[16];
+    while (hostEvents.pop(dropped, 16) > 0) {}
+    while (uiEvents.pop(dropped, 16) > 0) {}
+
+    // insertion sort, stable and without allocation
+    for (int i = 1; i < numBlockEvents; ++i) {
+        const ParamEvent e = blockEvents[i];
+        int j = i;
+        for (; j > 0 && blockEvents[j - 1].sampleOffset > e.sampleOffset; --j) {
+            blockEvents[j] = blockEvents[j - 1];
+        }
+        blockEvents[j] = e;
+    }
+}
+
+void SynthParams::dispatchAudioEvents()
+{
+    ParamEvent events[64];
+    int n;
+    while ((n = audioEvents.pop(events, 64)) > 0) {
+        for (int i = 0; i < n; ++i) {
+            events[i].param->markUIDirty();
+        }
+    }
 }
 
-int SynthParams::getGUIIndex()
+void SynthParams::updateSnapshot(eQualityTier tier)
 {
-    return (positionIndex.load() + 1) % 2;
+    ParamSnapshot& snap = *snapshot;
+
+    snap.quality = offlineQuality.getStep() == eOnOffToggle::eOn ? tier : eQualityTier::eRealtime;
+    const bool offline = snap.quality == eQualityTier::eOffline;
+    snap.mathAccuracy = offline ? eMathAccuracy::eAccurate : eMathAccuracy::eFast;
+
+    snap.freq = freq.getBlockValue();
+    const bool tuningChanged = tuning.update(snap.freq);
+    snap.modulationRate = offline ? eModulationRate::eSampleRate : modulationRate.getStep();
+    // adaptive voices line up with the decimators of 4x, which is what the processor reports as latency
+    snap.adaptiveOversampling = oversampling.getStep() == eOversampling::eAdaptive;
+    snap.minOversampling = offline ? offlineOversampling : 1;
+    snap.oversampling = jmax(getOversamplingFactor(oversampling.getStep()), snap.minOversampling);
+    snap.tailLevel = offline ? 0.f : releaseTailLevel.get();
+    snap.filterRouting = filterRouting.getStep();
+
+    for (size_t o = 0; o < osc.size(); ++o) {
+        ParamSnapshot::Osc& dst = snap.osc[o];
+        const Osc& src = osc[o];
+        dst.active = src.oscActivation.getStep() == eOnOffToggle::eOn;
+        dst.bandLimited = offline || src.bandLimited.getStep() == eOnOffToggle::eOn;
+        dst.waveForm = src.waveForm.getStep();
+        dst.unisonVoices = jlimit(1, static_cast<int>(src.unisonVoices.getMax()), static_cast<int>(src.unisonVoices.get() + .5f));
+        dst.unisonDetune = src.unisonDetune.getBlockValue();
+        dst.unisonSpread = src.unisonSpread.getBlockValue() / 100.f;
+        dst.trngAmount = src.trngAmount.getBlockValue();
+        dst.trngMin = src.trngAmount.getMin();
+        dst.trngMax = src.trngAmount.getMax();
+        dst.pulseWidth = src.pulseWidth.getBlockValue();
+        dst.pulseWidthMin = src.pulseWidth.getMin();
+        dst.pulseWidthMax = src.pulseWidth.getMax();
+        dst.vol = src.vol.getBlockValue();
+        dst.panDir = src.panDir.getBlockValue();
+        dst.pitchModRange = src.pitchModAmount1.getMax();
+        dst.gainModRange = src.gainModAmount1.getMax();
+
+        // the note table of the oscillator only changes with the tuning and the coarse and fine tune
+        const float fine = src.fine.getBlockValue();
+        const float coarse = src.coarse.getBlockValue();
+        if (tuningChanged || fine != dst.fine || coarse != dst.coarse) {
+            const float transpose = Param::fromCent(fine) * Param::fromSemi(coarse);
+            for (int n = 0; n < Tuning::numNotes; ++n) {
+                dst.noteFreq[n] = tuning.getNoteFrequency(n) * transpose;
+            }
+        }
+        dst.fine = fine;
+        dst.coarse = coarse;
+    }
+
+    for (size_t f = 0; f < filter.size(); ++f) {
+        filter[f].fillSnapshot(snap.filter[f]);
+    }
+
+    auto copyEnv = [](ParamSnapshot::Env& dst, const EnvBase& src, const Param& sustain) {
+        dst.attack = src.attack.getBlockValue();
+        dst.decay = src.decay.getBlockValue();
+        dst.release = src.release.getBlockValue();
+        dst.attackShape = src.attackShape.getBlockValue();
+        dst.decayShape = src.decayShape.getBlockValue();
+        dst.releaseShape = src.releaseShape.getBlockValue();
+        dst.sustain = sustain.getBlockValue();
+        dst.speedModAmount1 = src.speedModAmount1.getBlockValue();
+        dst.speedModAmount2 = src.speedModAmount2.getBlockValue();
+        dst.speedModMin = src.speedModAmount1.getMin();
+        dst.speedModMax = src.speedModAmount1.getMax();
+
+        // a unipolar source scales with the bipolar amount and the other way round, like the mod matrix
+        const auto intensity = [&dst](float amount, eModSource source) {
+            return isUnipolar(source) ? toBipolar(dst.speedModMin, dst.speedModMax, amount)
+                                      : toUnipolar(dst.speedModMin, dst.speedModMax, amount);
+        };
+        dst.speedModSrc1 = src.speedModSrc1.getStep();
+        dst.speedModSrc2 = src.speedModSrc2.getStep();
+        // no source is no modulation, the voices skip it
+        dst.speedModIntensity1 = dst.speedModSrc1 == eModSource::eNone ? 0.f : intensity(dst.speedModAmount1, dst.speedModSrc1);
+        dst.speedModIntensity2 = dst.speedModSrc2 == eModSource::eNone ? 0.f : intensity(dst.speedModAmount2, dst.speedModSrc2);
+        dst.speedModIntensity21 = dst.speedModSrc2 == eModSource::eNone ? 0.f : intensity(dst.speedModAmount1, dst.speedModSrc2);
+    };
+    for (size_t e = 0; e < envVol.size(); ++e) {
+        copyEnv(snap.envVol[e], envVol[e], envVol[e].sustain);
+    }
+    for (size_t e = 0; e < env.size(); ++e) {
+        copyEnv(snap.env[e], env[e], env[e].sustain);
+    }
+
+    for (size_t l = 0; l < lfo.size(); ++l) {
+        ParamSnapshot::Lfo& dst = snap.lfo[l];
+        const Lfo& src = lfo[l];
+        dst.tempSync = src.tempSync.getStep() == eOnOffToggle::eOn;
+        dst.triplets = src.lfoTriplets.getStep() == eOnOffToggle::eOn;
+        dst.dottedLength = src.lfoDottedLength.getStep() == eOnOffToggle::eOn;
+        dst.wave = src.wave.getStep();
+        dst.freq = src.freq.getBlockValue();
+        dst.noteLength = src.noteLength.getBlockValue();
+        dst.phaseDelta = dst.tempSync
+            ? tempo.getPhaseDelta(dst.noteLength, dst.dottedLength, dst.triplets)
+            : dst.freq / static_cast<float>(tempo.sampleRate);
+        dst.fadeIn = src.fadeIn.getBlockValue();
+        dst.global = src.global.getStep() == eOnOffToggle::eOn;
+    }
+
+    snap.clippingFactor = clippingFactor.getBlockValue();
+    snap.clippingMode = clippingMode.getStep();
+    snap.nBitsLowFi = nBitsLowFi.getBlockValue();
+    snap.lowFiDownsample = lowFiDownsample.getBlockValue();
+
+    snap.chorDelayLength = chorDelayLength.getBlockValue();
+    snap.chorDryWet = chorDryWet.getBlockValue();
+    snap.chorModRate = chorModRate.getBlockValue();
+    snap.chorModDepth = chorModDepth.getBlockValue();
+    snap.chorInterpolation = offline ? eChorusInterpolation::eHermite : chorInterpolation.getStep();
+
+    snap.delayFeedback = delayFeedback.getBlockValue();
+    snap.delayDryWet = delayDryWet.getBlockValue();
+    snap.delayTime = delayTime.getBlockValue();
+    snap.delayDividend = delayDividend.getBlockValue();
+    snap.delayDivisor = delayDivisor.getBlockValue();
+    snap.delayCutoff = delayCutoff.getBlockValue();
+    snap.delaySync = delaySync.getStep() == eOnOffToggle::eOn;
+    snap.delayTriplet = delayTriplet.getStep() == eOnOffToggle::eOn;
+    snap.delayDottedLength = delayDottedLength.getStep() == eOnOffToggle::eOn;
+    snap.delayRecordFilter = delayRecordFilter.getStep() == eOnOffToggle::eOn;
+    snap.delayReverse = delayReverse.getStep() == eOnOffToggle::eOn;
+    snap.delayPingPong = delayPingPong.getStep() == eOnOffToggle::eOn;
+
+    snap.fxOrder[0] = fxSlot0.getStep();
+    snap.fxOrder[1] = fxSlot1.getStep();
+    snap.fxOrder[2] = fxSlot2.getStep();
+    snap.fxOrder[3] = fxSlot3.getStep();
+    snap.fxOrder[4] = fxSlot4.getStep();
+    snap.fxOrder[5] = fxSlot5.getStep();
+
+    snap.reverbSize = reverbSize.getBlockValue();
+    snap.reverbDecay = reverbDecay.getBlockValue();
+    snap.reverbDamping = reverbDamping.getBlockValue();
+    snap.reverbDryWet = reverbDryWet.getBlockValue();
+
+    snap.shaperDrive = Decibels::decibelsToGain(shaperDrive.getBlockValue());
+    snap.shaperCurve = shaperCurve.getStep();
+    snap.shaperOversampling = shaperOversampling.getStep() == eOnOffToggle::eOn;
+}
+
+void SynthParams::compileRenderPlan()
+{
+    const ParamSnapshot& snap = *snapshot;
+
+    uint32 consumed = 1u << static_cast<int>(eModSource::eVolEnv);
+    for (int s = eModSource::eNone + 1; s < eModSource::nSteps; ++s) {
+        if (isModSourceRead(static_cast<eModSource>(s))) {
+            consumed |= 1u << s;
+        }
+    }
+    const std::array<const ParamStepped<eOnOffToggle>*, RenderPlan::numFx> fxActivation = { {
+        &lowFiActivation, &clippingActivation, &delayActivation, &chorActivation, &reverbActivation, &shaperActivation
+    } };
+
+    RenderPlan::tKey key;
+    size_t k = 0;
+    for (const ParamSnapshot::Osc& o : snap.osc) {
+        key[k++] = o.active ? 1 : 0;
+        key[k++] = static_cast<int>(o.waveForm);
+        key[k++] = o.bandLimited ? 1 : 0;
+        key[k++] = o.unisonVoices > 1 ? 1 : 0;
+    }
+    key[k++] = snap.oversampling;
+    key[k++] = static_cast<int>(snap.filterRouting);
+    for (const ParamSnapshot::Filter& f : snap.filter) {
+        key[k++] = f.active ? 1 : 0;
+        key[k++] = static_cast<int>(f.passtype);
+        key[k++] = static_cast<int>(f.topology);
+        key[k++] = f.ladderOversampling ? 1 : 0;
+    }
+    for (int t = 0; t < RenderPlan::numFx; ++t) {
+        key[k++] = static_cast<int>(snap.fxOrder[static_cast<size_t>(t)]);
+        key[k++] = fxActivation[static_cast<size_t>(t)]->getStep() == eOnOffToggle::eOn ? 1 : 0;
+    }
+    key[k++] = static_cast<int>(consumed);
+    jassert(k == key.size());
+
+    if (key == renderPlanKey) {
+        return;
+    }
+    renderPlanKey = key;
+
+    RenderPlan& plan = renderPlan;
+    plan.numActiveOscillators = 0;
+    plan.activeOscillators = 0;
+    plan.bankOscillators = 0;
+    for (int o = 0; o < RenderPlan::numOscillators; ++o) {
+        const ParamSnapshot::Osc& src = snap.osc[static_cast<size_t>(o)];
+        const bool unison = src.unisonVoices > 1;
+        RenderPlan::eOscKernel kernel;
+        switch (src.waveForm) {
+            case eOscWaves::eOscSquare:
+                kernel = unison ? (src.bandLimited ? RenderPlan::eSquareUnisonBandLimited : RenderPlan::eSquareUnison)
+                                : (src.bandLimited ? RenderPlan::eSquareBandLimited : RenderPlan::eSquare);
+                break;
+            case eOscWaves::eOscSaw:
+                kernel = unison ? (src.bandLimited ? RenderPlan::eSawUnisonBandLimited : RenderPlan::eSawUnison)
+                                : (src.bandLimited ? RenderPlan::eSawBandLimited : RenderPlan::eSaw);
+                break;
+            case eOscWaves::eOscWavetable:
+                kernel = RenderPlan::eWavetable;
+                break;
+            case eOscWaves::eOscSample:
+                kernel = RenderPlan::eSample;
+                break;
+            default:
+                kernel = RenderPlan::eNoise;
+                break;
+        }
+        plan.kernel[static_cast<size_t>(o)] = kernel;
+        if (!src.active) {
+            continue;
+        }
+        plan.oscillators[static_cast<size_t>(plan.numActiveOscillators++)] = o;
+        plan.activeOscillators |= 1u << o;
+        // table lookups, samples, oversampled oscillators and unison, whose copies are lanes already, are rendered voice by voice
+        if (kernel != RenderPlan::eWavetable && kernel != RenderPlan::eSample && !unison && snap.oversampling == 1) {
+            plan.bankOscillators |= 1u << o;
+        }
+    }
+
+    plan.numActiveFilters = 0;
+    plan.activeFilters = 0;
+    plan.bankFilters = 0;
+    for (int f = 0; f < RenderPlan::numFilters; ++f) {
+        const ParamSnapshot::Filter& src = snap.filter[static_cast<size_t>(f)];
+        if (src.active) {
+            plan.filters[static_cast<size_t>(plan.numActiveFilters++)] = f;
+            plan.activeFilters |= 1u << f;
+            if (FilterBank::supports(src)) {
+                plan.bankFilters |= 1u << f;
+            }
+        }
+    }
+
+    plan.consumedSources = consumed;
+
+    FxChain::tOrder order;
+    FxChain::resolveOrder(snap.fxOrder, order);
+    plan.numActiveFx = 0;
+    for (eFxType type : order) {
+        if (fxActivation[static_cast<size_t>(type)]->getStep() == eOnOffToggle::eOn) {
+            plan.fx[static_cast<size_t>(plan.numActiveFx++)] = type;
+        }
+    }
+
+    ++plan.generation;
+    SYNISTER_COUNT("render plan compiles", 1);
 }
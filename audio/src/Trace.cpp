@@ -0,0 +1,211 @@
+/*
+  ==============================================================================
+
+    Trace.cpp
+    Created: 15 Oct 2026 9:12:48am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "Trace.h"
+
+#if SYNISTER_TRACE
+#include <array>
+#include <atomic>
+
+namespace {
+    struct Span {
+        std::atomic<uint64> sequence;   //!< index + 1 of the span in the slot, 0 while empty
+        const char* name;
+        int64 startTicks;
+        int64 endTicks;     //!< the value of a counter
+        int thread;
+        bool isCounter;
+    };
+
+    const int ringSize = 1 << 16;
+    const uint64 ringMask = ringSize - 1;
+
+    std::atomic<int> nextThreadId(1);
+    //! \brief small number of the calling thread, for the tid of the trace
+    int getThreadId()
+    {
+        static thread_local int id = nextThreadId.fetch_add(1);
+        return id;
+    }
+
+    //! the ring and the writer thread of the process
+    class Recorder : private TimeSliceClient {
+    public:
+        Recorder()
+            : writer("Trace Writer")
+            , head(0)
+            , tail(0)
+            , originTicks(0)
+            , recording(false)
+            , dropped(0)
+        {
+            for (Span& s : ring) {
+                s.sequence.store(0);
+            }
+            const String file = SystemStats::getEnvironmentVariable("SYNISTER_TRACE_FILE", String());
+            if (file.isNotEmpty()) {
+                start(File::getCurrentWorkingDirectory().getChildFile(file));
+            }
+        }
+
+        ~Recorder()
+        {
+            stop();
+        }
+
+        void start(const File& file)
+        {
+            stop();
+            const ScopedLock sl(outputLock);
+            file.deleteFile();
+            output = file.createOutputStream();
+            if (output == nullptr) {
+                return;
+            }
+            // the json array format, the closing bracket is optional
+            output->writeText("[\n", false, false);
+            originTicks = Time::getHighResolutionTicks();
+            tail = head.load();
+            recording.store(true);
+            writer.addTimeSliceClient(this);
+            writer.startThread(2);
+        }
+
+        void stop()
+        {
+            if (!recording.exchange(false)) {
+                return;
+            }
+            writer.removeTimeSliceClient(this);
+            writer.stopThread(2000);
+            const ScopedLock sl(outputLock);
+            drain();
+            output->writeText("{}]\n", false, false);
+            output = nullptr;
+        }
+
+        void record(const char* name, int64 startTicks, int64 endTicks, bool isCounter)
+        {
+            const uint64 index = head.fetch_add(1, std::memory_order_relaxed);
+            Span& s = ring[static_cast<size_t>(index & ringMask)];
+            s.name = name;
+            s.startTicks = startTicks;
+            s.endTicks = endTicks;
+            s.thread = getThreadId();
+            s.isCounter = isCounter;
+            s.sequence.store(index + 1, std::memory_order_release);
+        }
+
+        bool isRecording() const { return recording.load(std::memory_order_relaxed); }
+        int64 getNumDropped() const { return dropped.load(); }
+
+    private:
+        int useTimeSlice() override
+        {
+            const ScopedLock sl(outputLock);
+            drain();
+            return 20;
+        }
+
+        //! writes the spans that are complete, with outputLock
+        void drain()
+        {
+            if (output == nullptr) {
+                return;
+            }
+            const double toMicroseconds = 1.e6 / static_cast<double>(Time::getHighResolutionTicksPerSecond());
+            const uint64 end = head.load(std::memory_order_acquire);
+            if (end - tail > ringSize) {
+                // the writers went round the ring since the last drain
+                dropped.fetch_add(static_cast<int64>(end - tail - ringSize));
+                tail = end - ringSize;
+            }
+            while (tail < end) {
+                Span& s = ring[static_cast<size_t>(tail & ringMask)];
+                if (s.sequence.load(std::memory_order_acquire) != tail + 1) {
+                    // claimed but not written yet
+                    break;
+                }
+                const char* name = s.name;
+                const int64 startTicks = s.startTicks;
+                const int64 endTicks = s.endTicks;
+                const int thread = s.thread;
+                const bool isCounter = s.isCounter;
+                // overwritten while it was copied
+                if (s.sequence.load(std::memory_order_acquire) != tail + 1) {
+                    dropped.fetch_add(1);
+                    ++tail;
+                    continue;
+                }
+                ++tail;
+
+                String line;
+                const String ts = String(static_cast<double>(startTicks - originTicks) * toMicroseconds, 3);
+                if (isCounter) {
+                    line << "{\"name\":\"" << name << "\",\"ph\":\"C\",\"pid\":1,\"ts\":" << ts
+                         << ",\"args\":{\"value\":" << endTicks << "}},\n";
+                } else {
+                    line << "{\"name\":\"" << name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread << ",\"ts\":" << ts
+                         << ",\"dur\":" << String(static_cast<double>(endTicks - startTicks) * toMicroseconds, 3) << "},\n";
+                }
+                output->writeText(line, false, false);
+            }
+            output->flush();
+        }
+
+        TimeSliceThread writer;
+        std::array<Span, ringSize> ring;
+        std::atomic<uint64> head;   //!< next slot to claim
+        uint64 tail;                //!< next slot to write, writer thread
+        int64 originTicks;
+        std::atomic<bool> recording;
+        std::atomic<int64> dropped;
+
+        CriticalSection outputLock;
+        ScopedPointer<FileOutputStream> output;
+    };
+
+    Recorder& getRecorder()
+    {
+        static Recorder recorder;
+        return recorder;
+    }
+}
+
+bool Trace::isRecording()
+{
+    return getRecorder().isRecording();
+}
+
+void Trace::start(const File& file)
+{
+    getRecorder().start(file);
+}
+
+void Trace::stop()
+{
+    getRecorder().stop();
+}
+
+int64 Trace::getNumDropped()
+{
+    return getRecorder().getNumDropped();
+}
+
+void Trace::record(const char* name, int64 startTicks, int64 endTicks)
+{
+    getRecorder().record(name, startTicks, endTicks, false);
+}
+
+void Trace::recordCounter(const char* name, int64 ticks, int64 value)
+{
+    getRecorder().record(name, ticks, value, true);
+}
+#endif
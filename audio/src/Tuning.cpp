@@ -0,0 +1,151 @@
+/*
+  ==============================================================================
+
+    Tuning.cpp
+    Created: 14 Oct 2026 11:48:15pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "Tuning.h"
+#include "DspTables.h"
+
+namespace {
+    //! pitch value of a Scala line: cents if it contains a period, a ratio or an integer otherwise
+    bool parseScalaPitch(const String& line, double& ratio)
+    {
+        // anything after the value is a comment
+        const String value = line.trim().upToFirstOccurrenceOf(" ", false, false).upToFirstOccurrenceOf("\t", false, false);
+        if (value.isEmpty()) {
+            return false;
+        }
+
+        if (value.containsChar('.')) {
+            if (!value.containsOnly("-+.0123456789")) {
+                return false;
+            }
+            ratio = std::pow(2., value.getDoubleValue() / 1200.);
+        } else {
+            if (!value.containsOnly("/0123456789")) {
+                return false;
+            }
+            const double numerator = value.upToFirstOccurrenceOf("/", false, false).getDoubleValue();
+            const double denominator = value.containsChar('/') ? value.fromFirstOccurrenceOf("/", false, false).getDoubleValue() : 1.;
+            if (denominator <= 0.) {
+                return false;
+            }
+            ratio = numerator / denominator;
+        }
+        return ratio > 0.;
+    }
+}
+
+Tuning::Tuning()
+    : version(0)
+    , builtMasterTune(0.f)
+    , builtVersion(-1)
+{
+    noteFrequency.fill(0.f);
+}
+
+Result Tuning::loadScala(const String& scl)
+{
+    // the first two lines which are not comments are the description and the number of degrees
+    StringArray lines;
+    lines.addLines(scl);
+
+    String newDescription;
+    int numDegrees = -1;
+    Array<double> newRatios;
+    bool hasDescription = false;
+
+    for (const String& line : lines) {
+        if (line.startsWithChar('!')) {
+            continue;
+        }
+        if (!hasDescription) {
+            newDescription = line.trim();
+            hasDescription = true;
+        } else if (numDegrees < 0) {
+            const String count = line.trim().upToFirstOccurrenceOf(" ", false, false);
+            numDegrees = count.getIntValue();
+            if (numDegrees <= 0 || !count.containsOnly("0123456789")) {
+                return Result::fail("Invalid number of notes: " + line.trim());
+            }
+        } else if (newRatios.size() < numDegrees && line.trim().isNotEmpty()) {
+            double ratio;
+            if (!parseScalaPitch(line, ratio)) {
+                return Result::fail("Invalid pitch: " + line.trim());
+            }
+            newRatios.add(ratio);
+        }
+    }
+
+    if (numDegrees < 0 || newRatios.size() != numDegrees) {
+        return Result::fail("The scale is incomplete");
+    }
+    if (newRatios.getLast() <= 1.) {
+        return Result::fail("The period of the scale has to be above 1/1");
+    }
+
+    const SpinLock::ScopedLockType sl(lock);
+    ratios.swapWith(newRatios);
+    description = newDescription;
+    ++version;
+    return Result::ok();
+}
+
+Result Tuning::loadScalaFile(const File& file)
+{
+    if (!file.existsAsFile()) {
+        return Result::fail("File not found: " + file.getFullPathName());
+    }
+    return loadScala(file.loadFileAsString());
+}
+
+void Tuning::setEqualTemperament()
+{
+    const SpinLock::ScopedLockType sl(lock);
+    ratios.clear();
+    description = String::empty;
+    ++version;
+}
+
+String Tuning::getDescription() const
+{
+    const SpinLock::ScopedLockType sl(lock);
+    return description;
+}
+
+bool Tuning::update(float masterTune)
+{
+    // never wait for the message thread, a new scale is picked up by the next block instead
+    const GenericScopedTryLock<SpinLock> sl(lock);
+    if (!sl.isLocked() || (version == builtVersion && masterTune == builtMasterTune)) {
+        return false;
+    }
+
+    // the same as MidiMessage::getMidiNoteInHertz(), without a pow() per note
+    const std::array<double, numNotes>& equalTemperament = DspTables::get().equalTemperament;
+    if (ratios.size() == 0) {
+        for (int n = 0; n < numNotes; ++n) {
+            noteFrequency[n] = static_cast<float>(masterTune * equalTemperament[n]);
+        }
+    } else {
+        const int numDegrees = ratios.size();
+        const double period = ratios.getLast();
+        const double referenceFrequency = masterTune * equalTemperament[referenceNote];
+        for (int n = 0; n < numNotes; ++n) {
+            const int d = n - referenceNote;
+            const int repeat = (d >= 0) ? d / numDegrees : -((numDegrees - 1 - d) / numDegrees);
+            const int degree = d - repeat * numDegrees;
+            const double ratio = (degree == 0) ? 1. : ratios.getUnchecked(degree - 1);
+            noteFrequency[n] = static_cast<float>(referenceFrequency * std::pow(period, repeat) * ratio);
+        }
+    }
+
+    builtMasterTune = masterTune;
+    builtVersion = version;
+    return true;
+}
@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    UndoHistory.cpp
+    Created: 15 Oct 2026 9:58:12pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "UndoHistory.h"
+#include "Param.h"
+
+UndoHistory::UndoHistory()
+    : ring(static_cast<size_t>(capacity))
+    , first(0)
+    , numUndo(0)
+    , numRedo(0)
+{
+}
+
+void UndoHistory::record(Param& param, float before)
+{
+    const float after = param.getUI();
+    if (after == before) {
+        return;
+    }
+    // a new edit ends the steps that could be redone
+    numRedo = 0;
+
+    const int64 gesture = Desktop::getInstance().getMainMouseSource().getLastMouseDownTime().toMilliseconds();
+    for (int i = numUndo - 1; i >= 0 && entry(i).gesture == gesture; --i) {
+        if (entry(i).param == &param) {
+            entry(i).after = after;
+            return;
+        }
+    }
+
+    if (numUndo == capacity) {
+        first = (first + 1) % capacity;
+        --numUndo;
+    }
+    entry(numUndo) = { &param, before, after, gesture };
+    ++numUndo;
+}
+
+bool UndoHistory::undo()
+{
+    if (numUndo == 0) {
+        return false;
+    }
+    const int64 gesture = entry(numUndo - 1).gesture;
+    while (numUndo > 0 && entry(numUndo - 1).gesture == gesture) {
+        --numUndo;
+        ++numRedo;
+        apply(*entry(numUndo).param, entry(numUndo).before);
+    }
+    return true;
+}
+
+bool UndoHistory::redo()
+{
+    if (numRedo == 0) {
+        return false;
+    }
+    const int64 gesture = entry(numUndo).gesture;
+    while (numRedo > 0 && entry(numUndo).gesture == gesture) {
+        apply(*entry(numUndo).param, entry(numUndo).after);
+        ++numUndo;
+        --numRedo;
+    }
+    return true;
+}
+
+void UndoHistory::clear()
+{
+    first = 0;
+    numUndo = 0;
+    numRedo = 0;
+}
+
+void UndoHistory::apply(Param& param, float value)
+{
+    param.setUI(value);
+    // the panels show the restored value
+    param.markUIDirty();
+}
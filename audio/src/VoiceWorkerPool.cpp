@@ -0,0 +1,77 @@
+/*
+  ==============================================================================
+
+    VoiceWorkerPool.cpp
+    Created: 14 Oct 2026 10:03:41am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "VoiceWorkerPool.h"
+
+VoiceWorkerPool::VoiceWorkerPool()
+    : currentVoices(nullptr)
+    , currentNumSamples(0)
+{
+}
+
+VoiceWorkerPool::~VoiceWorkerPool()
+{
+    release();
+}
+
+void VoiceWorkerPool::prepare(int maxVoices, int numChannels, int blockSize, double blockSeconds)
+{
+    release();
+
+    // the workers of the process are started by the first instance to get here
+    threadPool = new SharedResourcePointer<RealtimeThreadPool>();
+    (*threadPool)->setBlockPeriod(blockSeconds);
+    for (int v = 0; v < maxVoices; ++v) {
+        scratch.add(new AudioSampleBuffer(numChannels, blockSize));
+    }
+    activeVoices.ensureStorageAllocated(maxVoices);
+}
+
+void VoiceWorkerPool::release()
+{
+    threadPool = nullptr;
+    scratch.clear();
+    activeVoices.clear();
+}
+
+void VoiceWorkerPool::render(const OwnedArray<SynthesiserVoice>& voices, AudioSampleBuffer& outputBuffer, int startSample, int numSamples)
+{
+    jassert(threadPool != nullptr && voices.size() <= scratch.size() && numSamples <= scratch[0]->getNumSamples());
+
+    // only the voices with something to render become jobs
+    activeVoices.clearQuick();
+    for (int v = 0; v < voices.size(); ++v) {
+        if (voices.getUnchecked(v)->isVoiceActive()) {
+            activeVoices.add(v);
+        }
+    }
+    currentVoices = &voices;
+    currentNumSamples = numSamples;
+
+    RealtimeThreadPool::Batch batch(&renderVoice, this, activeVoices.size());
+    (*threadPool)->run(batch);
+
+    // sum in a fixed order so the result is deterministic
+    const int numChannels = jmin(outputBuffer.getNumChannels(), scratch[0]->getNumChannels());
+    for (int j = 0; j < activeVoices.size(); ++j) {
+        const AudioSampleBuffer& s = *scratch.getUnchecked(j);
+        for (int c = 0; c < numChannels; ++c) {
+            outputBuffer.addFrom(c, startSample, s, c, 0, numSamples);
+        }
+    }
+}
+
+void VoiceWorkerPool::renderVoice(void* context, int job)
+{
+    VoiceWorkerPool& pool = *static_cast<VoiceWorkerPool*>(context);
+    AudioSampleBuffer& buffer = *pool.scratch.getUnchecked(job);
+    buffer.clear(0, pool.currentNumSamples);
+    pool.currentVoices->getUnchecked(pool.activeVoices.getUnchecked(job))->renderNextBlock(buffer, 0, pool.currentNumSamples);
+}
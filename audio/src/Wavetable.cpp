@@ -0,0 +1,75 @@
+/*
+  ==============================================================================
+
+    Wavetable.cpp
+    Created: 14 Oct 2026 4:02:17pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "Wavetable.h"
+
+namespace {
+    //! amplitude of harmonic k of the given frame, the frames are sums of sines
+    double harmonicAmplitude(int frame, int k)
+    {
+        const double odd = (k % 2 == 1) ? 1. : 0.;
+        switch (frame) {
+            case 0: // sine
+                return k == 1 ? 1. : 0.;
+            case 1: // triangle
+                return odd * ((k / 2) % 2 == 0 ? 1. : -1.) * 8. / (double_Pi * double_Pi * k * k);
+            case 2: // saw, rising from -1 to 1 like Waveforms::saw
+                return -2. / (double_Pi * k);
+            default: // square, positive in the first half like Waveforms::square
+                return odd * 4. / (double_Pi * k);
+        }
+    }
+}
+
+Wavetables::Wavetables()
+    : data(static_cast<size_t>(numTables * numFrames * (tableSize + 1)), 0.f)
+{
+    std::vector<double> sine(tableSize);
+    for (int n = 0; n < tableSize; ++n) {
+        sine[n] = std::sin(2. * double_Pi * n / tableSize);
+    }
+
+    std::vector<double> sum(tableSize);
+    for (int frame = 0; frame < numFrames; ++frame) {
+        std::fill(sum.begin(), sum.end(), 0.);
+
+        // from the last table (fewest harmonics) to the first, every harmonic is added only once
+        int harmonics = 0;
+        for (int table = numTables - 1; table >= 0; --table) {
+            const int maxHarmonic = (tableSize / 2) >> table;
+            for (int k = harmonics + 1; k <= maxHarmonic; ++k) {
+                const double amplitude = harmonicAmplitude(frame, k);
+                if (amplitude != 0.) {
+                    for (int n = 0; n < tableSize; ++n) {
+                        sum[n] += amplitude * sine[(k * n) & (tableSize - 1)];
+                    }
+                }
+            }
+            harmonics = maxHarmonic;
+
+            float *dest = &data[static_cast<size_t>((table * numFrames + frame) * (tableSize + 1))];
+            for (int n = 0; n < tableSize; ++n) {
+                dest[n] = static_cast<float>(sum[n]);
+            }
+            dest[tableSize] = dest[0];
+        }
+
+        // the gibbs overshoot of the full band tables would exceed [-1..1], all octaves get the same gain
+        float peak = 0.f;
+        for (int n = 0; n < tableSize; ++n) {
+            peak = jmax(peak, std::abs(getTable(0, frame)[n]));
+        }
+        if (peak > 1.f) {
+            for (int table = 0; table < numTables; ++table) {
+                FloatVectorOperations::multiply(&data[static_cast<size_t>((table * numFrames + frame) * (tableSize + 1))], 1.f / peak, tableSize + 1);
+            }
+        }
+    }
+}
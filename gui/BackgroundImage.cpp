@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+
+    BackgroundImage.cpp
+    Created: 17 Oct 2026 12:26:40am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "BackgroundImage.h"
+
+//==============================================================================
+BackgroundImage::BackgroundImage(Component& owner)
+    : component(owner)
+    , scale(1.f)
+    , requestedWidth(0)
+    , requestedHeight(0)
+    , pendingWidth(0)
+    , pendingHeight(0)
+    , pendingScale(1.f)
+{
+    jobs->add(this, BackgroundJobs::ePriority::eLow);
+}
+
+BackgroundImage::~BackgroundImage()
+{
+    // waits until a running image is done
+    jobs->remove(this);
+    cancelPendingUpdate();
+}
+
+void BackgroundImage::update(tPainter p)
+{
+    painter = std::move(p);
+    request();
+}
+
+void BackgroundImage::request()
+{
+    if (!painter || component.getWidth() <= 0 || component.getHeight() <= 0) {
+        return;
+    }
+    requestedWidth = component.getWidth();
+    requestedHeight = component.getHeight();
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        pending = painter;
+        pendingWidth = requestedWidth;
+        pendingHeight = requestedHeight;
+        pendingScale = scale;
+    }
+    jobs->wake(this);
+}
+
+bool BackgroundImage::draw(Graphics& g)
+{
+    Image image;
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        image = finished;
+    }
+
+    // a new scale, e.g. on another display, or a new size is rendered again
+    const float paintScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (paintScale != scale || component.getWidth() != requestedWidth || component.getHeight() != requestedHeight) {
+        scale = paintScale;
+        request();
+    }
+
+    if (!image.isValid()) {
+        return false;
+    }
+    g.drawImageTransformed(image, AffineTransform::scale(static_cast<float>(component.getWidth()) / image.getWidth(),
+                                                         static_cast<float>(component.getHeight()) / image.getHeight()));
+    return true;
+}
+
+int BackgroundImage::useTimeSlice()
+{
+    tPainter p;
+    int width, height;
+    float s;
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        if (!pending) {
+            return 50;
+        }
+        p = std::move(pending);
+        pending = nullptr;
+        width = pendingWidth;
+        height = pendingHeight;
+        s = pendingScale;
+    }
+
+    Image image(Image::ARGB, jmax(1, roundToInt(width * s)), jmax(1, roundToInt(height * s)), true);
+    {
+        Graphics g(image);
+        g.addTransform(AffineTransform::scale(static_cast<float>(image.getWidth()) / width,
+                                              static_cast<float>(image.getHeight()) / height));
+        p(g, width, height);
+    }
+
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        finished = image;
+    }
+    triggerAsyncUpdate();
+    return 0;
+}
+
+void BackgroundImage::handleAsyncUpdate()
+{
+    component.repaint();
+}
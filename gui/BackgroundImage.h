@@ -0,0 +1,72 @@
+/*
+  ==============================================================================
+
+    BackgroundImage.h
+    Created: 17 Oct 2026 12:26:40am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef BACKGROUNDIMAGE_H_INCLUDED
+#define BACKGROUNDIMAGE_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "BackgroundJobs.h"
+#include <functional>
+
+//==============================================================================
+//! BackgroundImage: the look of a component rendered into an image on a background thread
+/*! Some hosts pass the automation of a plugin through its message thread, a paint that builds
+    and strokes long paths holds the automation up. The component hands a painter with copies
+    of the values it shows to update(), a shared low priority thread runs it into an image of
+    the size of the component at the physical pixel scale it was last drawn at, and the
+    component is repainted once the image is done. Its paint() only blits the latest image with
+    draw(). A newer update() replaces one that has not started yet, so a fast drag renders the
+    latest values only. Until the first image is done there is nothing to draw; a new size or
+    scale keeps the last image stretched until the next one is done.
+*/
+class BackgroundImage : private TimeSliceClient, private AsyncUpdater {
+public:
+    //! draws in the logical pixels of the component, on the render thread, only with what it captured
+    typedef std::function<void(Graphics&, int width, int height)> tPainter;
+
+    explicit BackgroundImage(Component& owner);
+    ~BackgroundImage();
+
+    //! \brief message thread: renders the painter in the background and repaints the owner when it is done
+    void update(tPainter painter);
+    //! \brief message thread, in paint() of the owner: the latest image over the owner, false before the first one
+    bool draw(Graphics& g);
+
+private:
+
+    //! renders the pending painter
+    int useTimeSlice() override;
+    //! repaints the owner with the finished image
+    void handleAsyncUpdate() override;
+    //! \brief queues the last painter for the current size and scale
+    void request();
+
+    Component& component;
+    SharedResourcePointer<BackgroundJobs> jobs;
+
+    //! \name message thread
+    ///@{
+    tPainter painter;       //!< the last of update()
+    float scale;            //!< physical pixels per logical pixel of the last paint()
+    int requestedWidth;     //!< size of the owner at the last request
+    int requestedHeight;
+    ///@}
+
+    SpinLock lock;          //!< guards the members below
+    tPainter pending;
+    int pendingWidth;
+    int pendingHeight;
+    float pendingScale;
+    Image finished;
+
+    JUCE_DECLARE_NON_COPYABLE(BackgroundImage)
+};
+
+#endif  // BACKGROUNDIMAGE_H_INCLUDED
@@ -12,10 +12,10 @@
 
 //==============================================================================
 // contructer & destructer
-CustomLookAndFeel::CustomLookAndFeel()
+CustomLookAndFeel::CustomLookAndFeel(Typeface::Ptr font)
     : LookAndFeel_V2()
+    , newFont(font)
 {
-	newFont = Typeface::createSystemTypefaceFor(BinaryData::world_of_water_ttf, BinaryData::world_of_water_ttfSize);
 }
 
 Typeface::Ptr CustomLookAndFeel::getTypefaceForFont(const Font & font)
@@ -48,8 +48,9 @@ void CustomLookAndFeel::drawRotarySlider(Graphics &g, int x, int y, int width, i
     const float radiusSource1 = radiusKnob + (radiusSource2 - radiusKnob) / 2.0f;
     Colour baseColour(s.findColour(Slider::rotarySliderFillColourId));
 
-    Path knob;
-    float r;
+    KnobImageCache::Face face;
+    face.startAngle = rotaryStartAngle;
+    face.endAngle = rotaryEndAngle;
 
     // if knob radius is bigger than 12, then downsize them for displaying possible modSource
     if (jmin(width, height) > 24)
@@ -64,7 +65,7 @@ void CustomLookAndFeel::drawRotarySlider(Graphics &g, int x, int y, int width, i
             eModSource source1 = sources[0]->getStep();
             if (source1 != eModSource::eNone)
             {
-                drawModSource(g, source1, static_cast<MouseOverKnob&>(s), amounts[0], centreX, centreY, radiusSource1, (radiusKnob / radiusSource1), currAngle, rotaryStartAngle, rotaryEndAngle);
+                drawModSource(g, source1, static_cast<MouseOverKnob&>(s), amounts[0], centreX, centreY, radiusSource1, (radiusKnob / radiusSource1), currAngle, rotaryStartAngle, rotaryEndAngle, static_cast<MouseOverKnob&>(s).getLiveModValue(1));
             }
         }
 
@@ -74,35 +75,30 @@ void CustomLookAndFeel::drawRotarySlider(Graphics &g, int x, int y, int width, i
             eModSource source2 = sources[1]->getStep();
             if (source2 != eModSource::eNone)
             {
-                drawModSource(g, source2, static_cast<MouseOverKnob&>(s), amounts[1], centreX, centreY, radiusSource2, (radiusSource1 / radiusSource2), currAngle, rotaryStartAngle, rotaryEndAngle);
+                drawModSource(g, source2, static_cast<MouseOverKnob&>(s), amounts[1], centreX, centreY, radiusSource2, (radiusSource1 / radiusSource2), currAngle, rotaryStartAngle, rotaryEndAngle, static_cast<MouseOverKnob&>(s).getLiveModValue(2));
             }
         }
 
-        // draw knob border
-        g.setColour(s.isEnabled() ? Colours::white : Colours::white.withAlpha(0.5f));
-        knob.addEllipse(centreX - radiusKnob, centreY - radiusKnob, radiusKnob * 2.0f, radiusKnob * 2.0f);
-        g.fillPath(knob);
-
-        g.setColour(s.isEnabled() ? (isMouseOver ? baseColour.brighter(0.1f) : baseColour) : baseColour.withAlpha(0.5f));
-        knob.clear();
-        r = radiusKnob * knobMargin;
+        // knob with border
+        face.radius = radiusKnob;
+        face.faceRadius = radiusKnob * knobMargin;
+        face.border = s.isEnabled() ? Colours::white : Colours::white.withAlpha(0.5f);
+        face.face = s.isEnabled() ? (isMouseOver ? baseColour.brighter(0.1f) : baseColour) : baseColour.withAlpha(0.5f);
     }
     else
     {
-        g.setColour(s.isEnabled() ? baseColour : baseColour.withAlpha(0.5f));
-        r = radiusSource2;
+        face.radius = radiusSource2;
+        face.faceRadius = radiusSource2;
+        face.face = s.isEnabled() ? baseColour : baseColour.withAlpha(0.5f);
     }
 
-    // draw first part of value pointer
-    knob.addPieSegment(centreX - r, centreY - r, r * 2.0f, r * 2.0f, -float_Pi, currAngle - float_Pi / 18.0f, 0.0f);
-    // draw second part of value pointer
-    knob.addPieSegment(centreX - r, centreY - r, r * 2.0f, r * 2.0f, float_Pi, currAngle + float_Pi / 18.0f, 0.0f);
-    g.fillPath(knob);
+    // the face and the value pointer are pre-rendered
+    knobImages->draw(g, face, centreX, centreY, sliderPosProportional);
 }
 
 void CustomLookAndFeel::drawModSource(Graphics &g, eModSource source, MouseOverKnob &s, Param *modAmount,
     float centreX, float centreY, float radius, float innerCircleSize,
-    float /*currAngle*/, float rotaryStartAngle, float rotaryEndAngle)
+    float currAngle, float rotaryStartAngle, float rotaryEndAngle, const float *liveValue)
 {
     const float val = static_cast<float>(s.getValue());
     const float min = static_cast<float>(s.getMinimum());
@@ -166,6 +162,25 @@ void CustomLookAndFeel::drawModSource(Graphics &g, eModSource source, MouseOverK
     g.setColour(s.isEnabled() ? SynthParams::getModSourceColour(source) : SynthParams::getModSourceColour(source).withAlpha(0.5f));
     saturn.addPieSegment(centreX - radius, centreY - radius, radius * 2.0f, radius * 2.0f, modStartAngle, modEndAngle, innerCircleSize * 1.03f);
     g.fillPath(saturn);
+
+    // live marker where the playing note's source moves the value to, along the saturn
+    if (liveValue != nullptr && s.isEnabled())
+    {
+        float liveAngle;
+        if (isUnipolar(source))
+        {
+            liveAngle = modEndAngle + jlimit(0.0f, 1.0f, *liveValue) * (modStartAngle - modEndAngle);
+        }
+        else
+        {
+            const float v = jlimit(-1.0f, 1.0f, *liveValue);
+            liveAngle = currAngle + std::abs(v) * ((v >= 0.0f ? modStartAngle : modEndAngle) - currAngle);
+        }
+        const float innerRadius = radius * innerCircleSize * 1.03f;
+        g.setColour(Colours::white);
+        g.drawLine(centreX + innerRadius * std::sin(liveAngle), centreY - innerRadius * std::cos(liveAngle),
+                   centreX + radius * std::sin(liveAngle), centreY - radius * std::cos(liveAngle), 2.0f);
+    }
 }
 
 void CustomLookAndFeel::drawLinearSlider(Graphics &g, int x, int y, int width, int height, float sliderPos, float minSliderPos, float maxSliderPos, const Slider::SliderStyle style, Slider &s)
@@ -483,9 +498,8 @@ void CustomLookAndFeel::drawToggleButton(Graphics &g, ToggleButton &b, bool isMo
 
     // draw text
     const int textX = (int)tickWidth + 5;
-    g.drawFittedText(b.getButtonText(),
-        textX, 0,
-        b.getWidth() - textX - 2, b.getHeight(),
+    textImages->drawFittedText(g, b.getButtonText(), Font(fontSize),
+        Rectangle<int>(textX, 0, b.getWidth() - textX - 2, b.getHeight()),
         Justification::centredLeft, 10);
 }
 
@@ -518,6 +532,31 @@ void CustomLookAndFeel::drawTickBox(Graphics &g, Component &/*c*/, float x, floa
     g.fillEllipse(centreX - boxSize / 2.0f, centreY - boxSize / 2.0f, boxSize, boxSize);
 }
 
+void CustomLookAndFeel::drawLabel(Graphics &g, Label &l)
+{
+    g.fillAll(l.findColour(Label::backgroundColourId));
+
+    // like LookAndFeel_V2, the text itself comes from the cache
+    const float alpha = l.isEnabled() ? 1.0f : 0.5f;
+    if (!l.isBeingEdited())
+    {
+        const Font font(getLabelFont(l));
+        const Rectangle<int> textArea(l.getBorderSize().subtractedFrom(l.getLocalBounds()));
+
+        g.setColour(l.findColour(Label::textColourId).withMultipliedAlpha(alpha));
+        textImages->drawFittedText(g, l.getText(), font, textArea, l.getJustificationType(),
+            jmax(1, static_cast<int>(textArea.getHeight() / font.getHeight())), l.getMinimumHorizontalScale());
+
+        g.setColour(l.findColour(Label::outlineColourId).withMultipliedAlpha(alpha));
+    }
+    else if (l.isEnabled())
+    {
+        g.setColour(l.findColour(Label::outlineColourId));
+    }
+
+    g.drawRect(l.getLocalBounds());
+}
+
 Font CustomLookAndFeel::getTextButtonFont(TextButton& /*t*/, int buttonHeight)
 {
     return Font(jmin(30.0f, buttonHeight * 0.95f));
@@ -15,13 +15,16 @@
 #include "JuceHeader.h"
 #include "SynthParams.h"
 #include "MouseOverKnob.h"
+#include "KnobImageCache.h"
+#include "TextImageCache.h"
 //[/Headers]
 
 class CustomLookAndFeel : public LookAndFeel_V2 // our default design
 {
 public:
     //==============================================================================
-    CustomLookAndFeel();
+    //! \param font typeface of all text, see GuiResources
+    explicit CustomLookAndFeel(Typeface::Ptr font);
 	Typeface::Ptr getTypefaceForFont(const Font & font);
     virtual ~CustomLookAndFeel();
     //==============================================================================
@@ -80,6 +83,15 @@ public:
     virtual Font getTextButtonFont(TextButton&, int buttonHeight);
     //==============================================================================
 
+    /**
+    * Draw label text from the text cache. The value boxes of the sliders and the text of the combo boxes are labels.
+    */
+    virtual void drawLabel(Graphics &g, Label &l);
+
+    //! \brief the editor text as cached images, for the panels that draw text themselves
+    TextImageCache& getTextCache() { return *textImages; }
+    //==============================================================================
+
     /**
     * Draw how combo box is displayed on GUI without selection popup box.
     */
@@ -143,6 +155,8 @@ public:
 //==============================================================================
 private:
 	Typeface::Ptr newFont;
+    SharedResourcePointer<KnobImageCache> knobImages;   //!< faces of the rotary sliders, see drawRotarySlider()
+    SharedResourcePointer<TextImageCache> textImages;   //!< labels, toggle buttons and group headers
     /**
     * Draw modSources of rotary slider as saturn.
     @param g canvas to draw on
@@ -157,7 +171,7 @@ private:
     @param rotaryStartAngle slider's minimum angle position
     @param rotaryEndAngle slider's maximum angle position
     */
-    void drawModSource(Graphics &g, eModSource source, MouseOverKnob &s, Param *modAmount, float centreX, float centreY, float radius, float innerCircleSize, float currAngle, float rotaryStartAngle, float rotaryEndAngle);
+    void drawModSource(Graphics &g, eModSource source, MouseOverKnob &s, Param *modAmount, float centreX, float centreY, float radius, float innerCircleSize, float currAngle, float rotaryStartAngle, float rotaryEndAngle, const float *liveValue);
 };
 
 #endif  // CUSTOMLOOKANDFEEL_H_INCLUDED
@@ -16,12 +16,12 @@ EnvelopeCurve::~EnvelopeCurve()
 {
 }
 
-void EnvelopeCurve::setSamples()
+void EnvelopeCurve::Curve::setSamples(int width)
 {
 
     sustainLevel_ = (96.f + sustain_) / 96.f;
 
-    float samplesSection = getWidth() / 4.0f;
+    float samplesSection = width / 4.0f;
 
     attackSamples = (attack_ * samplesSection/4) != 0.f ?
     static_cast<int>(ceil(attack_ * samplesSection/4)) :
@@ -33,48 +33,56 @@ void EnvelopeCurve::setSamples()
     1;
 
     // NOTE: the 2 at the end are responsible for the ending of the curve
-    sustainSamples = getWidth() - (attackSamples + decaySamples + releaseSamples + 2);
+    sustainSamples = width - (attackSamples + decaySamples + releaseSamples + 2);
 
     samplesCounter_ = 0;
 
 }
 
+void EnvelopeCurve::setValue(float& member, float value)
+{
+    if (member != value) {
+        member = value;
+        pathsValid_ = false;
+    }
+}
+
 void EnvelopeCurve::setAttack(float attack)
 {
-    attack_ = attack;
+    setValue(curve_.attack_, attack);
 }
 
 void EnvelopeCurve::setDecay(float decay)
 {
-    decay_ = decay;
+    setValue(curve_.decay_, decay);
 }
 
 void EnvelopeCurve::setSustain(float sustain)
 {
-    sustain_ = sustain;
+    setValue(curve_.sustain_, sustain);
 }
 
 void EnvelopeCurve::setRelease(float release)
 {
-    release_ = release;
+    setValue(curve_.release_, release);
 }
 
 void EnvelopeCurve::setAttackShape(float attackShape)
 {
-    attackShape_ = attackShape;
+    setValue(curve_.attackShape_, attackShape);
 }
 
 void EnvelopeCurve::setDecayShape(float decayShape)
 {
-    decayShape_ = decayShape;
+    setValue(curve_.decayShape_, decayShape);
 }
 
 void EnvelopeCurve::setReleaseShape(float releaseShape)
 {
-    releaseShape_ = releaseShape;
+    setValue(curve_.releaseShape_, releaseShape);
 }
 
-float EnvelopeCurve::getEnvCoef()
+float EnvelopeCurve::Curve::getEnvCoef()
 {
     float envCoeff;
 
@@ -140,6 +148,26 @@ float EnvelopeCurve::getEnvCoef()
 }
 
 void EnvelopeCurve::paint (Graphics& g)
+{
+    // the curve costs a log interpolation per pixel, it is only rendered again when it changed
+    if (!pathsValid_) {
+        updateImage();
+    }
+    if (!image_.draw(g)) {
+        g.fillAll(SynthParams::envelopeCurveBackground.withAlpha(1.f));
+    }
+}
+
+void EnvelopeCurve::updateImage()
+{
+    const Curve curve = curve_;
+    image_.update([curve](Graphics& g, int width, int height) {
+        paintCurve(g, width, height, curve);
+    });
+    pathsValid_ = true;
+}
+
+void EnvelopeCurve::paintCurve(Graphics& g, int width, int height, Curve curve)
 {
     // TODO: gradient for less than 1 samples
     FillType backgroundFill = FillType(SynthParams::envelopeCurveBackground);
@@ -147,39 +175,29 @@ void EnvelopeCurve::paint (Graphics& g)
     g.setFillType(backgroundFill);
     g.fillAll();
 
-	const int width = getWidth();
-
 	Path grid;
-	//grid.startNewSubPath(0.0f, static_cast<float>(getHeight()/2));
-	//grid.lineTo(width, static_cast<float>(getHeight() / 2));
-
-	grid.addLineSegment(Line< float >::Line(0.f, static_cast<float>(getHeight() / 2), width, static_cast<float>(getHeight() / 2)), 1.f);
-	grid.addLineSegment(Line< float >::Line(static_cast<float>(width/2), 0, static_cast<float>(width / 2), static_cast<float>(getHeight())), 1.f);
-	grid.addLineSegment(Line< float >::Line(static_cast<float>(width / 4), 0, static_cast<float>(width / 4), static_cast<float>(getHeight())), 1.f);
-	grid.addLineSegment(Line< float >::Line(static_cast<float>(width*3 / 4), 0, static_cast<float>(width*3 / 4), static_cast<float>(getHeight())), 1.f);
-
-	g.setColour(SynthParams::envColour);
-	g.setOpacity(.3f);
-	g.strokePath(grid, PathStrokeType(1.f));
-
+	grid.addLineSegment(Line< float >::Line(0.f, static_cast<float>(height / 2), width, static_cast<float>(height / 2)), 1.f);
+	grid.addLineSegment(Line< float >::Line(static_cast<float>(width/2), 0, static_cast<float>(width / 2), static_cast<float>(height)), 1.f);
+	grid.addLineSegment(Line< float >::Line(static_cast<float>(width / 4), 0, static_cast<float>(width / 4), static_cast<float>(height)), 1.f);
+	grid.addLineSegment(Line< float >::Line(static_cast<float>(width*3 / 4), 0, static_cast<float>(width*3 / 4), static_cast<float>(height)), 1.f);
 
     Path curvePath;
-
-    setSamples();
-    curvePath.startNewSubPath(0.0f, static_cast<float>(getHeight()));
+    curve.setSamples(width);
+    curvePath.startNewSubPath(0.0f, static_cast<float>(height));
 
     for (float i = 1.0f; i < width; ++i) {
-        curvePath.lineTo(i, (getHeight())*(1.013f - getEnvCoef()));
+        curvePath.lineTo(i, height * (1.013f - curve.getEnvCoef()));
     }
 
+	g.setColour(SynthParams::envColour);
+	g.setOpacity(.3f);
+	g.strokePath(grid, PathStrokeType(1.f));
+
     g.setColour(SynthParams::envelopeCurveLine);
     g.strokePath(curvePath, PathStrokeType(2.5f));
-
 }
 
 void EnvelopeCurve::resized()
 {
-    // This method is where you should set the bounds of any child
-    // components that your component contains..
-
+    pathsValid_ = false;
 }
@@ -14,6 +14,7 @@
 #include "JuceHeader.h"
 #include "SynthParams.h"
 #include "Envelope.h"
+#include "BackgroundImage.h"
 
 //==============================================================================
 /*
@@ -22,15 +23,12 @@ class EnvelopeCurve    : public Component
 {
 public:
     EnvelopeCurve(float attack, float decay, float sustain, float release, float attackShape, float decayShape, float releaseShape)
-    : attack_(attack)
-    , decay_(decay)
-    , sustain_(sustain)
-    , release_(release)
-    , attackShape_(attackShape)
-    , decayShape_(decayShape)
-    , releaseShape_(releaseShape)
-    , samplesCounter_(0)
-    {};
+    : pathsValid_(false)
+    , image_(*this)
+    {
+        Curve c = { attack, decay, sustain, release, attackShape, decayShape, releaseShape, 0.f, 0.f, 0, 0, 0, 0, 0 };
+        curve_ = c;
+    };
     ~EnvelopeCurve();
 
     void setAttack(float);
@@ -45,24 +43,38 @@ public:
     void resized();
 
 private:
-    float attack_;
-    float decay_;
-    float sustain_;
-    float release_;
-    float attackShape_;
-    float decayShape_;
-    float releaseShape_;
-    float valueAtRelease_;
-    float sustainLevel_;
-    int samplesCounter_;
+    //! the values of the envelope and the generator of its curve, a copy goes to the render thread
+    struct Curve {
+        float attack_;
+        float decay_;
+        float sustain_;
+        float release_;
+        float attackShape_;
+        float decayShape_;
+        float releaseShape_;
+        float valueAtRelease_;
+        float sustainLevel_;
+        int samplesCounter_;
 
-    int attackSamples;
-    int decaySamples;
-    int releaseSamples;
-    int sustainSamples;
+        int attackSamples;
+        int decaySamples;
+        int releaseSamples;
+        int sustainSamples;
 
-    float getEnvCoef();
-    void setSamples();
+        float getEnvCoef();
+        void setSamples(int width);
+    };
+
+    //! \brief sets a value of the envelope, the image is rendered again if it changed
+    void setValue(float& member, float value);
+    //! hands a painter of the current values to the image
+    void updateImage();
+    //! \brief render thread: background, grid and curve of the values for the given size
+    static void paintCurve(Graphics& g, int width, int height, Curve curve);
+
+    Curve curve_;
+    bool pathsValid_;   //!< false after a value or the size changed
+    BackgroundImage image_;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (EnvelopeCurve)
 };
@@ -0,0 +1,235 @@
+/*
+  ==============================================================================
+
+    FilterResponse.cpp
+    Created: 15 Oct 2026 1:05:42am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "FilterResponse.h"
+#include "Filter.h"
+#include <complex>
+
+namespace {
+    typedef std::complex<double> tComplex;
+
+    //! \brief analog prototype of the state variable filter, exact after the prewarping of the design
+    template<eBiquadFilters _type>
+    tComplex svfResponse(const Filter::SvfCoefficients& c, double freq, double rate)
+    {
+        const tComplex s(0., std::tan(double_Pi * freq / rate) / c.g);
+        const tComplex den = s * s + static_cast<double>(c.k) * s + 1.;
+        switch (_type) {
+            case eBiquadFilters::eLowpass: return 1. / den;
+            case eBiquadFilters::eHighpass: return s * s / den;
+            case eBiquadFilters::eBandpass: return static_cast<double>(c.k) * s / den;
+            default: return 0.;
+        }
+    }
+
+    //! \brief curve of one passtype, the design calls are the ones of Filter with the modulation at 0
+    template<eBiquadFilters _type>
+    void typeResponse(const ParamSnapshot::Filter& p, eFilterTopology topology, double rate, const double* freq, tComplex* h, int n)
+    {
+        const eMathAccuracy acc = eMathAccuracy::eAccurate;
+        if (_type == eBiquadFilters::eLadder) {
+            // four one poles b (1 + z^-1) / (1 - a z^-1) in a loop with the feedback delayed by one sample
+            Filter::LadderCoefficients c;
+            Filter::designLadder<acc>(p, 0.f, 0.f, static_cast<float>(rate), c);
+            const double a = 1. - 2. * c.b;
+            for (int i = 0; i < n; ++i) {
+                const tComplex z1 = std::polar(1., -2. * double_Pi * freq[i] / rate);
+                const tComplex stage = static_cast<double>(c.b) * (1. + z1) / (1. - a * z1);
+                const tComplex g4 = stage * stage * stage * stage;
+                h[i] = g4 / (1. + static_cast<double>(c.resonance) * z1 * g4);
+            }
+            return;
+        }
+
+        float bandRatio;
+        const float cutoffFreq = Filter::modulatedCutoff<_type, acc>(p, 0.f, 0.f, bandRatio) / static_cast<float>(rate);
+        if (topology == eFilterTopology::eSvf) {
+            Filter::SvfCoefficients c;
+            Filter::designSvf<_type, acc>(cutoffFreq, p.resonance, bandRatio, c);
+            for (int i = 0; i < n; ++i) {
+                h[i] = svfResponse<_type>(c, freq[i], rate);
+            }
+        } else {
+            Filter::BiquadCoefficients c;
+            Filter::designBiquad<_type, acc>(cutoffFreq, p.resonance, bandRatio, c);
+            const double b0 = c.b0, b1 = c.b1, b2 = c.b2, a1 = c.a1, a2 = c.a2;
+            for (int i = 0; i < n; ++i) {
+                const tComplex z1 = std::polar(1., -2. * double_Pi * freq[i] / rate);
+                h[i] = (b0 + (b1 + b2 * z1) * z1) / (1. + (a1 + a2 * z1) * z1);
+            }
+        }
+    }
+}
+
+bool FilterResponse::Request::operator== (const Request& other) const
+{
+    return filter.active == other.filter.active
+        && filter.passtype == other.filter.passtype
+        && filter.topology == other.filter.topology
+        && filter.ladderOversampling == other.filter.ladderOversampling
+        && filter.lpCutoff == other.filter.lpCutoff
+        && filter.hpCutoff == other.filter.hpCutoff
+        && filter.resonance == other.filter.resonance
+        && rate == other.rate;
+}
+
+//==============================================================================
+FilterResponse::FilterResponse(SynthParams& p, const SynthParams::Filter& f)
+    : params(p)
+    , filter(f)
+    , hasPending(false)
+    , resultVersion(0)
+    , hasRequested(false)
+    , curveVersion(0)
+    , active(false)
+    , image(*this)
+{
+    FloatVectorOperations::fill(result, maxDb, numPoints);
+    FloatVectorOperations::fill(curve, maxDb, numPoints);
+    setInterceptsMouseClicks(false, false);
+
+    jobs->add(this, BackgroundJobs::ePriority::eLow);
+    params.uiUpdates.addShowingListener(this);
+    editorShowingChanged(params.uiUpdates.isEditorShowing());
+}
+
+FilterResponse::~FilterResponse()
+{
+    params.uiUpdates.removeShowingListener(this);
+    stopTimer();
+    // waits until a running computation is done
+    jobs->remove(this);
+}
+
+void FilterResponse::editorShowingChanged(bool showing)
+{
+    if (showing && !params.uiUpdates.isThrottled()) {
+        startTimerHz(25);
+    } else {
+        stopTimer();
+    }
+}
+
+void FilterResponse::editorThrottledChanged(bool)
+{
+    editorShowingChanged(params.uiUpdates.isEditorShowing());
+}
+
+void FilterResponse::timerCallback()
+{
+    // a folded section keeps its last curve
+    if (!isShowing()) {
+        return;
+    }
+
+    Request r;
+    filter.fillSnapshot(r.filter);
+    r.rate = displayRate * static_cast<float>(SynthParams::getOversamplingFactor(params.oversampling.getStep()));
+
+    if (!hasRequested || r != requested) {
+        {
+            const SpinLock::ScopedLockType sl(lock);
+            pending = r;
+            hasPending = true;
+        }
+        jobs->wake(this);
+        requested = r;
+        hasRequested = true;
+    }
+
+    bool newCurve = false;
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        if (resultVersion != curveVersion) {
+            FloatVectorOperations::copy(curve, result, numPoints);
+            curveVersion = resultVersion;
+            newCurve = true;
+        }
+    }
+    if (newCurve || active != requested.filter.active) {
+        active = requested.filter.active;
+        std::array<float, numPoints> db;
+        std::copy(curve, curve + numPoints, db.begin());
+        const bool isActive = active;
+        image.update([db, isActive](Graphics& g, int width, int height) {
+            paintCurve(g, width, height, db, isActive);
+        });
+    }
+}
+
+int FilterResponse::useTimeSlice()
+{
+    Request r;
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        if (!hasPending) {
+            return 40;
+        }
+        r = pending;
+        hasPending = false;
+    }
+
+    float db[numPoints];
+    computeResponse(r, db);
+
+    const SpinLock::ScopedLockType sl(lock);
+    FloatVectorOperations::copy(result, db, numPoints);
+    ++resultVersion;
+    return 0;
+}
+
+void FilterResponse::computeResponse(const Request& r, float* db)
+{
+    double freq[numPoints];
+    for (int i = 0; i < numPoints; ++i) {
+        freq[i] = minFreq * std::pow(static_cast<double>(maxFreq / minFreq), i / static_cast<double>(numPoints - 1));
+    }
+
+    tComplex h[numPoints];
+    const eFilterTopology topology = r.filter.topology;
+    switch (r.filter.passtype) {
+        case eBiquadFilters::eLowpass: typeResponse<eBiquadFilters::eLowpass>(r.filter, topology, r.rate, freq, h, numPoints); break;
+        case eBiquadFilters::eHighpass: typeResponse<eBiquadFilters::eHighpass>(r.filter, topology, r.rate, freq, h, numPoints); break;
+        case eBiquadFilters::eBandpass: typeResponse<eBiquadFilters::eBandpass>(r.filter, topology, r.rate, freq, h, numPoints); break;
+        case eBiquadFilters::eLadder: typeResponse<eBiquadFilters::eLadder>(r.filter, topology, r.rate * (r.filter.ladderOversampling ? 2.f : 1.f), freq, h, numPoints); break;
+        default: std::fill(h, h + numPoints, tComplex(0.)); break;
+    }
+
+    for (int i = 0; i < numPoints; ++i) {
+        const double magnitude = std::abs(h[i]);
+        db[i] = magnitude > 0. ? jlimit(minDb, maxDb, static_cast<float>(20. * std::log10(magnitude))) : minDb;
+    }
+}
+
+void FilterResponse::paint(Graphics& g)
+{
+    // nothing to draw before the first curve is done
+    image.draw(g);
+}
+
+void FilterResponse::paintCurve(Graphics& g, int width, int height, const std::array<float, numPoints>& db, bool isActive)
+{
+    const float w = static_cast<float>(width);
+    const float h = static_cast<float>(height);
+
+    Path p;
+    for (int i = 0; i < numPoints; ++i) {
+        const float x = w * static_cast<float>(i) / static_cast<float>(numPoints - 1);
+        const float y = h * (maxDb - db[i]) / (maxDb - minDb);
+        if (i == 0) {
+            p.startNewSubPath(x, y);
+        } else {
+            p.lineTo(x, y);
+        }
+    }
+
+    g.setColour(Colours::white.withAlpha(isActive ? .35f : .12f));
+    g.strokePath(p, PathStrokeType(1.5f));
+}
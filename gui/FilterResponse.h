@@ -0,0 +1,90 @@
+/*
+  ==============================================================================
+
+    FilterResponse.h
+    Created: 15 Oct 2026 1:05:42am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef FILTERRESPONSE_H_INCLUDED
+#define FILTERRESPONSE_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "BackgroundJobs.h"
+#include "SynthParams.h"
+#include "BackgroundImage.h"
+#include <array>
+
+//==============================================================================
+//! FilterResponse: magnitude response curve of one filter of the voices
+/*! The curve is computed from the coefficient design of Filter for the unmodulated params.
+    It is cached until the passtype, topology, a cutoff or the resonance changes. The params
+    are polled at a low rate, and the curve of the latest values is computed on a shared
+    background thread. So dragging a knob costs the message thread only a compare and a
+    repaint, and the stroke is rendered into a BackgroundImage. The ladder shows its linear small signal response, the saturators are left out.
+*/
+class FilterResponse : public Component, private Timer, private TimeSliceClient, private ParamUpdateHub::ShowingListener
+{
+public:
+    FilterResponse(SynthParams& p, const SynthParams::Filter& f);
+    ~FilterResponse();
+
+    void paint(Graphics& g) override;
+
+    //! number of points of the curve, log spaced between minFreq and maxFreq
+    static const int numPoints = 96;
+    constexpr static float minFreq = 20.f;
+    constexpr static float maxFreq = 20000.f;
+    //! the editor does not know the host rate, the curve is drawn for this one times the oversampling
+    constexpr static float displayRate = 48000.f;
+    constexpr static float minDb = -30.f;   //!< bottom of the component
+    constexpr static float maxDb = 18.f;    //!< top of the component
+
+private:
+
+    //! params the curve depends on, the cache key
+    struct Request {
+        ParamSnapshot::Filter filter;
+        float rate;
+
+        bool operator== (const Request& other) const;
+        bool operator!= (const Request& other) const { return !(*this == other); }
+    };
+
+    //! checks the params and picks up a finished curve
+    void timerCallback() override;
+    //! the timer stops while the editor is hidden
+    void editorShowingChanged(bool showing) override;
+    //! the curve keeps its last shape while the audio thread is under load
+    void editorThrottledChanged(bool throttled) override;
+    //! computes the curve of the pending request on the background thread
+    int useTimeSlice() override;
+
+    //! \brief magnitude in dB at numPoints frequencies
+    static void computeResponse(const Request& r, float* db);
+    //! \brief render thread: the stroke of the curve for the given size
+    static void paintCurve(Graphics& g, int width, int height, const std::array<float, numPoints>& db, bool isActive);
+
+    SynthParams& params;
+    const SynthParams::Filter& filter;
+    SharedResourcePointer<BackgroundJobs> jobs;
+
+    SpinLock lock;          //!< guards the members up to resultVersion
+    Request pending;
+    bool hasPending;
+    float result[numPoints];
+    int resultVersion;
+
+    Request requested;      //!< last request of the message thread
+    bool hasRequested;
+    float curve[numPoints]; //!< the curve which is drawn
+    int curveVersion;
+    bool active;
+    BackgroundImage image;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FilterResponse)
+};
+
+#endif  // FILTERRESPONSE_H_INCLUDED
@@ -11,28 +11,37 @@
 
 #include "FoldablePanel.h"
 
-struct FoldablePanel::SectionComponent  : public Component
+struct FoldablePanel::SectionComponent  : public Component, private ParamUpdateHub::Listener
 {
     // TODO: add color and height of component
     SectionComponent (const String& sectionTitle,
-                      Component* const newPanel,
+                      const tPanelFactory& newPanel,
                       const Colour sectionColour,
                       const int sectionHeight,
-                      ParamStepped<eSectionState>* sectionState)
+                      ParamStepped<eSectionState>* sectionState,
+                      ParamUpdateHub& updateHub)
     : Component (sectionTitle),
     positionIndex(0),
     _sectionState(sectionState),
     titleHeight (28),
     isOpen (sectionState->getStep() == eSectionState::eExpanded),
     _sectionHeight(sectionHeight + titleHeight),
-    _sectionColour(sectionColour)
+    _sectionColour(sectionColour),
+    updates(updateHub)
     {
         jassert(sectionTitle.isNotEmpty());
+        shownHeight = getSectionHeight();
         addPanel (newPanel);
+        if (isOpen) {
+            createPanels();
+        }
+        // a patch or the host can fold the section as well
+        updates.addListener(_sectionState, this);
     }
 
     ~SectionComponent()
     {
+        updates.removeListener(this);
         panels.clear();
         positionIndex = 0;
     }
@@ -54,10 +63,24 @@ struct FoldablePanel::SectionComponent  : public Component
         }
     }
 
-    void addPanel(Component* const newPanel)
+    //! \brief the panel is created with the others when the section is expanded for the first time
+    void addPanel(const tPanelFactory& newPanel)
+    {
+        factories.push_back(newPanel);
+        if (panels.size() > 0) {
+            createPanels();
+        }
+    }
+
+    //! \brief creates the panels whose factories did not run yet
+    void createPanels()
     {
-        panels.insert(positionIndex++, newPanel);
-        addAndMakeVisible (newPanel, 0);
+        for (size_t i = static_cast<size_t>(panels.size()); i < factories.size(); ++i) {
+            Component* const newPanel = factories[i]();
+            panels.insert(positionIndex++, newPanel);
+            addChildComponent(newPanel, 0);
+            newPanel->setVisible(shownHeight > titleHeight);
+        }
         resized();
     }
 
@@ -77,16 +100,43 @@ struct FoldablePanel::SectionComponent  : public Component
         {
             isOpen = open;
             _sectionState->setStep(open ? eSectionState::eExpanded : eSectionState::eCollapsed);
-            for (int i = 0; i < panels.size(); ++i ) {
-                Component* const panel = panels.getUnchecked(i);
-                panel->setVisible(open);
+            // unfolding panels show while the section grows, folding ones hide once it settled
+            if (open) {
+                createPanels();
+                setPanelsVisible(true);
             }
+            startFolding();
+        }
+    }
 
-            if (FoldablePanel* const pp = findParentComponentOfClass<FoldablePanel>()) {
-                pp->resized();
+    //! \brief lets the holder animate the section to its new height
+    void startFolding();
 
-                pp->getBackToPoint(getY(), (open) ? getSectionHeight() - 22 : 0);
-            }
+    //! \brief moves the shown height one frame towards the section height, false once it is there
+    bool stepFolding()
+    {
+        const int target = getSectionHeight();
+        const int distance = target - shownHeight;
+        if (distance == 0) {
+            return false;
+        }
+        const int step = jmax(foldingMinStep, std::abs(distance) / 3);
+        shownHeight = distance > 0 ? jmin(target, shownHeight + step) : jmax(target, shownHeight - step);
+        if (shownHeight == target && !isOpen) {
+            setPanelsVisible(false);
+        }
+        return true;
+    }
+
+    bool isFolding() const
+    {
+        return shownHeight != (isOpen ? _sectionHeight : titleHeight);
+    }
+
+    void setPanelsVisible(bool visible)
+    {
+        for (int i = 0; i < panels.size(); ++i ) {
+            panels.getUnchecked(i)->setVisible(visible);
         }
     }
 
@@ -111,35 +161,52 @@ struct FoldablePanel::SectionComponent  : public Component
         return _sectionColour;
     }
 
-    int getSectionHeight()
+    int getSectionHeight() const
     {
         return (isOpen ? _sectionHeight : titleHeight);
     }
 
-    void updateOpennessState()
+    //! \brief the height while the section folds or unfolds, the section height otherwise
+    int getShownHeight() const
     {
-        if (_sectionState->isUIDirty()) {
-            setOpen(_sectionState->getStep() == eSectionState::eExpanded);
-        }
+        return shownHeight;
     }
 
+    void paramChanged(Param*) override
+    {
+        setOpen(_sectionState->getStep() == eSectionState::eExpanded);
+    }
+
+    static const int foldingMinStep = 8;    //!< pixels per frame at the end of a folding
+
     int positionIndex;
+    std::vector<tPanelFactory> factories;   //!< of all panels, the first panels.size() ones ran already
     OwnedArray<Component> panels;
     const int titleHeight;
     bool isOpen;
     const int _sectionHeight;
     ParamStepped<eSectionState>* _sectionState;
     const Colour _sectionColour;
+    ParamUpdateHub& updates;
+    int shownHeight;
 
     JUCE_DECLARE_NON_COPYABLE (SectionComponent)
 };
 
 //==============================================================================
-struct FoldablePanel::PanelHolderComponent  : public Component, private Timer
+//! lays the sections out below each other, the timer only runs while one of them folds or unfolds and the editor is showing
+struct FoldablePanel::PanelHolderComponent  : public Component, private Timer, private ParamUpdateHub::ShowingListener
 {
-    PanelHolderComponent()
+    explicit PanelHolderComponent(ParamUpdateHub& updateHub)
+        : updates(updateHub)
     {
-        startTimerHz(60);
+        updates.addShowingListener(this);
+    }
+
+    ~PanelHolderComponent()
+    {
+        updates.removeShowingListener(this);
+        stopTimer();
     }
 
     void paint (Graphics& g) override
@@ -153,7 +220,7 @@ struct FoldablePanel::PanelHolderComponent  : public Component, private Timer
         {
             SectionComponent* const section = sections.getUnchecked(i);
 
-            Rectangle<int> content (0, y + 22, getWidth(), section->getSectionHeight() - titleHeight);
+            Rectangle<int> content (0, y + 22, getWidth(), section->getShownHeight() - titleHeight);
             y = section->getBottom();
 
             g.setColour(section->getSectionColour());
@@ -163,18 +230,62 @@ struct FoldablePanel::PanelHolderComponent  : public Component, private Timer
 
     void updateLayout (int width)
     {
-        int y = 0;
+        setSize(width, getHeight());
+        updateLayoutFrom(0);
+        repaint();
+    }
 
-        for (int i = 0; i < sections.size(); ++i)
+    //! \brief the sections from the given one on, the ones above it keep their place
+    void updateLayoutFrom (int first)
+    {
+        int y = first > 0 ? sections.getUnchecked(first - 1)->getBottom() : 0;
+        const int top = y;
+
+        for (int i = first; i < sections.size(); ++i)
         {
             SectionComponent* const section = sections.getUnchecked(i);
-            section->setBounds (0, y, width, section->getSectionHeight());
+            section->setBounds (0, y, getWidth(), section->getShownHeight());
             y = section->getBottom();
         }
 
-        setSize(width, y);
+        setSize(getWidth(), y);
+        repaint(0, top, getWidth(), y - top);
+    }
 
-        repaint();
+    void startFolding()
+    {
+        if (!updates.isEditorShowing()) {
+            return;
+        }
+        // no animation while the audio thread is under load, the sections jump to their height
+        if (updates.isThrottled()) {
+            stopTimer();
+            while (stepSections()) {}
+        } else if (!isTimerRunning()) {
+            startTimerHz(60);
+        }
+    }
+
+    //! a hidden editor finishes the folding when it shows again
+    void editorShowingChanged(bool showing) override
+    {
+        bool folding = false;
+        for (int i = 0; i < sections.size() && !folding; ++i) {
+            folding = sections.getUnchecked(i)->isFolding();
+        }
+        if (!showing) {
+            stopTimer();
+        } else if (folding) {
+            startFolding();
+        }
+    }
+
+    //! a running folding finishes at once
+    void editorThrottledChanged(bool throttled) override
+    {
+        if (throttled && isTimerRunning()) {
+            startFolding();
+        }
     }
 
     void insertSection (int indexToInsertAt, SectionComponent* newSection)
@@ -190,21 +301,60 @@ struct FoldablePanel::PanelHolderComponent  : public Component, private Timer
 
     void timerCallback() override
     {
+        if (!stepSections()) {
+            stopTimer();
+        }
+    }
+
+    //! \brief one frame of all folding sections, false once none of them moved
+    bool stepSections()
+    {
+        int first = -1;
+        SectionComponent* unfolded = nullptr;
         for (int i = 0; i < sections.size(); ++i) {
             SectionComponent* const section = sections.getUnchecked(i);
-            section->updateOpennessState();
+            if (section->stepFolding()) {
+                first = first < 0 ? i : first;
+                if (!section->isFolding() && section->isOpen) {
+                    unfolded = section;
+                }
+            }
         }
+
+        if (first < 0) {
+            return false;
+        }
+        updateLayoutFrom(first);
+
+        // scroll a section that finished unfolding into view
+        if (unfolded != nullptr) {
+            if (FoldablePanel* const pp = findParentComponentOfClass<FoldablePanel>()) {
+                pp->getBackToPoint(unfolded->getY(), unfolded->getSectionHeight() - 22);
+            }
+        }
+        return true;
     }
 
     OwnedArray<SectionComponent> sections;
+    ParamUpdateHub& updates;
 
     JUCE_DECLARE_NON_COPYABLE (PanelHolderComponent)
 };
 
-FoldablePanel::FoldablePanel (const String& name)  : Component (name)
+void FoldablePanel::SectionComponent::startFolding()
+{
+    if (PanelHolderComponent* const holder = findParentComponentOfClass<PanelHolderComponent>()) {
+        holder->startFolding();
+    }
+}
+
+FoldablePanel::FoldablePanel (const String& name, ParamUpdateHub& updateHub)
+    : Component (name)
+    , lastPosY (0)
+    , updates (updateHub)
 {
     addAndMakeVisible (viewport);
-    viewport.setViewedComponent (panelHolderComponent = new PanelHolderComponent());
+    viewport.setViewedComponent (panelHolderComponent = new PanelHolderComponent(updateHub));
     viewport.setScrollBarsShown(true, false, false, false);
     ScrollBar* scrollbarY = viewport.getVerticalScrollBar();
     scrollbarY->setAutoHide(false);
@@ -245,7 +395,7 @@ void FoldablePanel::clear()
 }
 
 void FoldablePanel::addSection (const String& sectionTitle,
-                                Component* const newPanel,
+                                const tPanelFactory& newPanel,
                                 const Colour sectionColour,
                                 const int sectionHeight,
                                 ParamStepped<eSectionState>* sectionState,
@@ -257,25 +407,35 @@ void FoldablePanel::addSection (const String& sectionTitle,
         repaint();
     }
 
-    panelHolderComponent->insertSection (indexToInsertAt, new SectionComponent (sectionTitle, newPanel, sectionColour, sectionHeight, sectionState));
+    panelHolderComponent->insertSection (indexToInsertAt, new SectionComponent (sectionTitle, newPanel, sectionColour, sectionHeight, sectionState, updates));
     resized();
     updateLayout();
 }
 
 void FoldablePanel::getBackToPoint(const int y, int height)
 {
+    lastPosY = viewport.getViewPositionY();
     if (lastPosY + y + height > viewport.getViewHeight()) {
         viewport.setViewPosition(viewport.getX(), lastPosY + height);
     }
 }
 
-void FoldablePanel::addPanel(const int sectionIndex, Component* const newPanel)
+void FoldablePanel::addPanel(const int sectionIndex, const tPanelFactory& newPanel)
 {
     if (SectionComponent* s = panelHolderComponent->getSection (sectionIndex)) {
         s->addPanel(newPanel);
     }
 }
 
+int FoldablePanel::getNumCreatedPanels() const
+{
+    int numPanels = 0;
+    for (int i = 0; i < panelHolderComponent->sections.size(); ++i) {
+        numPanels += panelHolderComponent->sections.getUnchecked(i)->panels.size();
+    }
+    return numPanels;
+}
+
 void FoldablePanel::updateLayout() const
 {
     panelHolderComponent->updateLayout (getWidth());
@@ -13,18 +13,23 @@
 
 #include "JuceHeader.h"
 #include "SynthParams.h"
+#include <functional>
 
 class FoldablePanel : public Component
 {
 public:
-    FoldablePanel (const String& name);
+    //! creates the content of a section, which owns it afterwards
+    typedef std::function<Component*()> tPanelFactory;
+
+    FoldablePanel (const String& name, ParamUpdateHub& updateHub);
 
     ~FoldablePanel();
 
     void clear();
 
+    //! \brief the panels of a section are created the first time it is expanded
     void addSection (const String& sectionTitle,
-                     Component* const newPanel,
+                     const tPanelFactory& newPanel,
                      const Colour sectionColour,
                      const int sectionHeight,
                      ParamStepped<eSectionState>* sectionState,
@@ -32,7 +37,9 @@ public:
 
 
     bool isEmpty() const;
-    void addPanel(const int sectionIndex, Component* const newPanel);
+    void addPanel(const int sectionIndex, const tPanelFactory& newPanel);
+    //! \brief number of panels created so far, grows as sections are expanded for the first time
+    int getNumCreatedPanels() const;
     void getBackToPoint(const int y, int height);
     void paint (Graphics&) override;
     void resized() override;
@@ -40,6 +47,7 @@ public:
 private:
     Viewport viewport;
     int lastPosY;
+    ParamUpdateHub& updates;    //!< the section states reach the sections through it
     struct SectionComponent;
     struct PanelHolderComponent;
     ScopedPointer<PanelHolderComponent> panelHolderComponent;
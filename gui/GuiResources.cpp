@@ -0,0 +1,41 @@
+/*
+  ==============================================================================
+
+    GuiResources.cpp
+    Created: 15 Oct 2026 7:36:51am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "GuiResources.h"
+
+GuiResources::GuiResources()
+    : typeface(Typeface::createSystemTypefaceFor(BinaryData::world_of_water_ttf, BinaryData::world_of_water_ttfSize))
+{
+    lookAndFeel = new CustomLookAndFeel(typeface);
+    LookAndFeel::setDefaultLookAndFeel(lookAndFeel);
+}
+
+GuiResources::~GuiResources()
+{
+    // no component of an editor is left, nothing refers to the look and feel any more
+    LookAndFeel::setDefaultLookAndFeel(nullptr);
+    lookAndFeel = nullptr;
+}
+
+Image GuiResources::getImage(const void* data, int size, float alpha)
+{
+    const std::pair<const void*, float> key(data, alpha);
+    auto image = images.find(key);
+    if (image != images.end()) {
+        return image->second;
+    }
+
+    Image decoded = alpha == 1.f ? ImageFileFormat::loadFrom(data, static_cast<size_t>(size)) : getImage(data, size).createCopy();
+    if (alpha != 1.f) {
+        decoded.multiplyAllAlphas(alpha);
+    }
+    images[key] = decoded;
+    return decoded;
+}
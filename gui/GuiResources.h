@@ -0,0 +1,48 @@
+/*
+  ==============================================================================
+
+    GuiResources.h
+    Created: 15 Oct 2026 7:36:51am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef GUIRESOURCES_H_INCLUDED
+#define GUIRESOURCES_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "CustomLookAndFeel.h"
+#include <map>
+#include <utility>
+
+//==============================================================================
+//! GuiResources: the decoded images, the typeface and the look and feel of all editors of the process
+/*! Held through a SharedResourcePointer, so the resources are made when the first editor opens
+    and released with the last one. The pngs of BinaryData are decoded once, also in the faded
+    variants of the disabled buttons, and the look and feel is the default of all editors while
+    the resources exist. Message thread only.
+*/
+class GuiResources {
+public:
+    GuiResources();
+    ~GuiResources();
+
+    //! \brief the image of a png of BinaryData, decoded on first use
+    /*!
+    @param alpha multiplies the alpha of the image, e.g. for the off state of an image button
+    */
+    Image getImage(const void* data, int size, float alpha = 1.f);
+
+    Typeface::Ptr getTypeface() const { return typeface; }
+    CustomLookAndFeel& getLookAndFeel() { return *lookAndFeel; }
+
+private:
+    std::map<std::pair<const void*, float>, Image> images;
+    Typeface::Ptr typeface;
+    ScopedPointer<CustomLookAndFeel> lookAndFeel;
+
+    JUCE_DECLARE_NON_COPYABLE(GuiResources)
+};
+
+#endif  // GUIRESOURCES_H_INCLUDED
@@ -0,0 +1,84 @@
+/*
+  ==============================================================================
+
+    KnobImageCache.cpp
+    Created: 15 Oct 2026 7:10:26am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "KnobImageCache.h"
+#include <tuple>
+
+bool KnobImageCache::Key::operator< (const Key& other) const
+{
+    return std::tie(radius, faceRadius, border, face, scale, startAngle, endAngle)
+        < std::tie(other.radius, other.faceRadius, other.border, other.face, other.scale, other.startAngle, other.endAngle);
+}
+
+void KnobImageCache::draw(Graphics& g, const Face& f, float centreX, float centreY, float sliderPosProportional)
+{
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const Key key = {
+        roundToInt(f.radius * scale * 4.f), roundToInt(f.faceRadius * scale * 4.f),
+        f.border.getARGB(), f.face.getARGB(), roundToInt(scale * 100.f),
+        roundToInt(f.startAngle * 1000.f), roundToInt(f.endAngle * 1000.f)
+    };
+
+    auto strip = strips.find(key);
+    if (strip == strips.end()) {
+        if (static_cast<int>(strips.size()) >= maxStrips) {
+            strips.clear();
+        }
+        strip = strips.emplace(key, std::vector<Image>(static_cast<size_t>(numFrames))).first;
+    }
+
+    const int frame = jlimit(0, numFrames - 1, roundToInt(sliderPosProportional * (numFrames - 1)));
+    Image& image = strip->second[static_cast<size_t>(frame)];
+    if (image.isNull()) {
+        image = renderFrame(f, scale, frame);
+    }
+
+    // the image has physical pixels, its centre goes to the centre of the knob
+    const float halfSize = static_cast<float>(image.getWidth()) / (2.f * scale);
+    g.drawImageTransformed(image, AffineTransform::scale(1.f / scale).translated(centreX - halfSize, centreY - halfSize));
+}
+
+Image KnobImageCache::renderFrame(const Face& f, float scale, int frame)
+{
+    // one pixel of room for the antialiased edge
+    const int size = static_cast<int>(std::ceil(2.f * f.radius * scale)) + 2;
+    Image image(Image::ARGB, size, size, true);
+    Graphics g(image);
+    g.addTransform(AffineTransform::scale(scale));
+
+    const float centre = static_cast<float>(size) / (2.f * scale);
+    if (f.radius > f.faceRadius) {
+        g.setColour(f.border);
+        g.fillEllipse(centre - f.radius, centre - f.radius, f.radius * 2.0f, f.radius * 2.0f);
+    }
+
+    // the face with a gap at the pointer, the border shows through it
+    const float angle = f.startAngle + static_cast<float>(frame) / (numFrames - 1) * (f.endAngle - f.startAngle);
+    const float r = f.faceRadius;
+    Path knob;
+    knob.addPieSegment(centre - r, centre - r, r * 2.0f, r * 2.0f, -float_Pi, angle - float_Pi / 18.0f, 0.0f);
+    knob.addPieSegment(centre - r, centre - r, r * 2.0f, r * 2.0f, float_Pi, angle + float_Pi / 18.0f, 0.0f);
+    g.setColour(f.face);
+    g.fillPath(knob);
+    return image;
+}
+
+int64 KnobImageCache::getMemoryBytes() const
+{
+    int64 bytes = 0;
+    for (const auto& strip : strips) {
+        for (const Image& frame : strip.second) {
+            if (frame.isValid()) {
+                bytes += static_cast<int64>(frame.getWidth()) * frame.getHeight() * 4;
+            }
+        }
+    }
+    return bytes;
+}
@@ -0,0 +1,68 @@
+/*
+  ==============================================================================
+
+    KnobImageCache.h
+    Created: 15 Oct 2026 7:10:26am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef KNOBIMAGECACHE_H_INCLUDED
+#define KNOBIMAGECACHE_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <map>
+#include <vector>
+
+//==============================================================================
+//! KnobImageCache: pre-rendered frames of the rotary knob faces, shared by all editors of the process
+/*! A strip holds numFrames images of one knob look, the pointer stepping from the start to the
+    end angle. Strips are keyed by the radii, the colours and the physical pixel scale, and a
+    frame is rendered the first time it is drawn. Afterwards a repaint of the knob face is an
+    image blit. The saturns of the mod sources change with their amounts and stay procedural.
+    Message thread only.
+*/
+class KnobImageCache {
+public:
+    //! the look of a knob face, the key of a strip
+    struct Face {
+        float radius;       //!< of the border, the face without border if equal to faceRadius
+        float faceRadius;
+        Colour border;
+        Colour face;
+        float startAngle;   //!< pointer angle of the first frame
+        float endAngle;     //!< pointer angle of the last frame
+    };
+
+    //! \brief draws the face with the pointer at the nearest frame to the proportional position
+    void draw(Graphics& g, const Face& f, float centreX, float centreY, float sliderPosProportional);
+
+    //! \brief pixel bytes of the frames rendered so far
+    int64 getMemoryBytes() const;
+
+    //! pointer steps of a strip
+    static const int numFrames = 128;
+    //! strips kept, the cache starts over when a new one would exceed it
+    static const int maxStrips = 64;
+
+private:
+    struct Key {
+        int radius;     //!< quarter physical pixels
+        int faceRadius;
+        uint32 border;
+        uint32 face;
+        int scale;      //!< percent
+        int startAngle; //!< milliradians
+        int endAngle;
+
+        bool operator< (const Key& other) const;
+    };
+
+    //! \brief renders a frame, the centre of the knob at the centre of the image
+    static Image renderFrame(const Face& f, float scale, int frame);
+
+    std::map<Key, std::vector<Image>> strips;
+};
+
+#endif  // KNOBIMAGECACHE_H_INCLUDED
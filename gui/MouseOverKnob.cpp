@@ -16,6 +16,8 @@ MouseOverKnob::MouseOverKnob(const String& name)
     : Slider(name)
     , modSources({ nullptr })
     , modAmounts({ nullptr })
+    , liveModValues({ 0.f })
+    , hasLiveModValue({ false })
 {
     addAndMakeVisible(knobLabel = new Label("new label", TRANS(name)));
     knobLabel->setFont(Font(18.00f, Font::plain));
@@ -102,6 +104,26 @@ MouseOverKnob::modAmountConversion MouseOverKnob::getConversionType()
     return modSourceValueConverted;
 }
 
+void MouseOverKnob::setLiveModValue(int sourceNumber, const float *value)
+{
+    const size_t i = static_cast<size_t>(sourceNumber - 1);
+    // a marker moved by less than a pixel is not worth the repaint
+    const float threshold = 0.002f;
+    if (value == nullptr ? !hasLiveModValue[i] : hasLiveModValue[i] && std::abs(*value - liveModValues[i]) < threshold)
+    {
+        return;
+    }
+    hasLiveModValue[i] = value != nullptr;
+    liveModValues[i] = value != nullptr ? *value : 0.f;
+    repaint();
+}
+
+const float* MouseOverKnob::getLiveModValue(int sourceNumber) const
+{
+    const size_t i = static_cast<size_t>(sourceNumber - 1);
+    return hasLiveModValue[i] ? &liveModValues[i] : nullptr;
+}
+
 //==============================================================================
 
 void MouseOverKnob::setBounds(int x, int y, int width, int height)
@@ -64,6 +64,18 @@ public:
     std::array<Param*, 2> getModAmounts();
     modAmountConversion getConversionType();
 
+    /**
+    * Live value of a mod source in the playing note, drawn as a marker on its saturn. Repaints if it changed.
+    @param sourceNumber 1 is inner saturn, 2 is outer saturn
+    @param value of the source, nullptr if no note plays
+    */
+    void setLiveModValue(int sourceNumber, const float *value);
+
+    /**
+    * Live value set by setLiveModValue(), nullptr if there is none.
+    */
+    const float* getLiveModValue(int sourceNumber) const;
+
     //==============================================================================
 
     /*
@@ -130,6 +142,9 @@ private:
     std::array<ParamStepped<eModSource>*, 2> modSources;
     modAmountConversion modSourceValueConverted = modAmountConversion::noConversion;
 
+    std::array<float, 2> liveModValues;
+    std::array<bool, 2> hasLiveModValue;
+
     // for mod amount knob (textBoxWidth or textBoxHeight is 0 && knobheight < 19)
     bool displayBipolarValue = false;
 };
@@ -0,0 +1,225 @@
+/*
+  ==============================================================================
+
+    OutputScope.cpp
+    Created: 15 Oct 2026 6:48:02am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "OutputScope.h"
+
+//==============================================================================
+OutputScope::OutputScope(SynthParams& p)
+    : params(p)
+    , history(static_cast<size_t>(historySize), true)
+    , fft(fftOrder, false)
+    , window(static_cast<size_t>(fftSize))
+    , fftData(static_cast<size_t>(2 * fftSize), true)
+    , resultVersion(0)
+    , frameVersion(0)
+    , image(*this)
+{
+    // a sine of amplitude 1 ends up at 0 dB
+    for (int i = 0; i < fftSize; ++i) {
+        window[i] = 1.f - std::cos(2.f * float_Pi * static_cast<float>(i) / static_cast<float>(fftSize));
+    }
+    FloatVectorOperations::fill(smoothed, minDb, numSpectrumPoints);
+    FloatVectorOperations::clear(resultTrace, numScopePoints);
+    FloatVectorOperations::fill(resultSpectrum, minDb, numSpectrumPoints);
+    FloatVectorOperations::clear(trace, numScopePoints);
+    FloatVectorOperations::fill(spectrum, minDb, numSpectrumPoints);
+    setInterceptsMouseClicks(false, false);
+    setSize(800, 160);
+
+    jobs->add(this, BackgroundJobs::ePriority::eLow);
+    params.uiUpdates.addShowingListener(this);
+    editorShowingChanged(params.uiUpdates.isEditorShowing());
+}
+
+OutputScope::~OutputScope()
+{
+    params.uiUpdates.removeShowingListener(this);
+    stopTimer();
+    params.telemetry.output.setEnabled(false);
+    // waits until a running frame is done
+    jobs->remove(this);
+}
+
+void OutputScope::editorShowingChanged(bool showing)
+{
+    if (showing && !params.uiUpdates.isThrottled()) {
+        startTimerHz(30);
+    } else {
+        stopTimer();
+        params.telemetry.output.setEnabled(false);
+    }
+}
+
+void OutputScope::editorThrottledChanged(bool)
+{
+    editorShowingChanged(params.uiUpdates.isEditorShowing());
+}
+
+void OutputScope::timerCallback()
+{
+    // the audio thread only feeds the tap while the scope can be seen
+    const bool showing = isShowing();
+    params.telemetry.output.setEnabled(showing);
+    if (!showing) {
+        return;
+    }
+
+    bool newFrame = false;
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        if (resultVersion != frameVersion) {
+            FloatVectorOperations::copy(trace, resultTrace, numScopePoints);
+            FloatVectorOperations::copy(spectrum, resultSpectrum, numSpectrumPoints);
+            frameVersion = resultVersion;
+            newFrame = true;
+        }
+    }
+    if (newFrame) {
+        std::array<float, numScopePoints> t;
+        std::array<float, numSpectrumPoints> s;
+        std::copy(trace, trace + numScopePoints, t.begin());
+        std::copy(spectrum, spectrum + numSpectrumPoints, s.begin());
+        image.update([t, s](Graphics& g, int width, int height) {
+            paintFrame(g, width, height, t.data(), s.data());
+        });
+    }
+}
+
+int OutputScope::useTimeSlice()
+{
+    OutputTap& tap = params.telemetry.output;
+    if (!tap.isEnabled()) {
+        return 100;
+    }
+
+    // the newest samples go to the end of the history, the older ones move to the front
+    static const int chunkSize = 1024;
+    float chunk[chunkSize];
+    int numRead = 0;
+    for (int n; (n = tap.read(chunk, chunkSize)) > 0; numRead += n) {
+        memmove(history, history + n, static_cast<size_t>(historySize - n) * sizeof(float));
+        FloatVectorOperations::copy(history + historySize - n, chunk, n);
+    }
+    if (numRead == 0) {
+        return 30;
+    }
+
+    float t[numScopePoints];
+    float s[numSpectrumPoints];
+    computeTrace(t);
+    computeSpectrum(s, tap.getRate());
+
+    const SpinLock::ScopedLockType sl(lock);
+    FloatVectorOperations::copy(resultTrace, t, numScopePoints);
+    FloatVectorOperations::copy(resultSpectrum, s, numSpectrumPoints);
+    ++resultVersion;
+    return 30;
+}
+
+void OutputScope::computeTrace(float* dst) const
+{
+    // the latest rising zero crossing which leaves a whole trace after it
+    int start = historySize - scopeLength;
+    for (int i = historySize - scopeLength; i > historySize - 2 * scopeLength; --i) {
+        if (history[i - 1] < 0.f && history[i] >= 0.f) {
+            start = i;
+            break;
+        }
+    }
+
+    const int stride = scopeLength / numScopePoints;
+    for (int p = 0; p < numScopePoints; ++p) {
+        dst[p] = history[start + p * stride];
+    }
+}
+
+void OutputScope::computeSpectrum(float* dst, float rate)
+{
+    FloatVectorOperations::multiply(fftData, history + historySize - fftSize, window, fftSize);
+    FloatVectorOperations::clear(fftData + fftSize, fftSize);
+    fft.performFrequencyOnlyForwardTransform(fftData);
+
+    // the loudest bin of every display band, the bands below the bin spacing take their bin
+    const int numBins = fftSize / 2;
+    const float binsPerHz = static_cast<float>(fftSize) / rate;
+    const float scale = 2.f / static_cast<float>(fftSize);
+    for (int p = 0; p < numSpectrumPoints; ++p) {
+        const float from = minFreq * std::pow(maxFreq / minFreq, static_cast<float>(p) / numSpectrumPoints);
+        const float to = minFreq * std::pow(maxFreq / minFreq, static_cast<float>(p + 1) / numSpectrumPoints);
+        const int firstBin = jmin(numBins - 1, static_cast<int>(from * binsPerHz));
+        const int lastBin = jlimit(firstBin, numBins - 1, static_cast<int>(to * binsPerHz));
+
+        float magnitude = 0.f;
+        for (int b = firstBin; b <= lastBin; ++b) {
+            magnitude = jmax(magnitude, fftData[b]);
+        }
+        magnitude *= scale;
+        const float db = magnitude > 0.f ? jlimit(minDb, maxDb, 20.f * std::log10(magnitude)) : minDb;
+        smoothed[p] = jmax(db, smoothed[p] - spectrumFall);
+        dst[p] = smoothed[p];
+    }
+}
+
+void OutputScope::paint(Graphics& g)
+{
+    if (!image.draw(g)) {
+        paintFrame(g, getWidth(), getHeight(), nullptr, nullptr);
+    }
+}
+
+void OutputScope::paintFrame(Graphics& g, int width, int height, const float* trace, const float* spectrum)
+{
+    const float h = static_cast<float>(height);
+    const float half = static_cast<float>(width / 2);
+    const float margin = 8.f;
+    const float w = half - 2.f * margin;
+
+    g.setColour(Colours::black.withAlpha(.25f));
+    g.fillRect(margin, 0.f, w, h);
+    g.fillRect(half + margin, 0.f, w, h);
+
+    // grid: the zero line of the trace, decades of the spectrum
+    g.setColour(Colours::white.withAlpha(.12f));
+    g.drawHorizontalLine(static_cast<int>(h / 2.f), margin, margin + w);
+    for (float f = 100.f; f < maxFreq; f *= 10.f) {
+        const float x = half + margin + w * std::log(f / minFreq) / std::log(maxFreq / minFreq);
+        g.drawVerticalLine(static_cast<int>(x), 0.f, h);
+    }
+
+    if (trace == nullptr || spectrum == nullptr) {
+        return;
+    }
+
+    Path scopePath;
+    for (int p = 0; p < numScopePoints; ++p) {
+        const float x = margin + w * static_cast<float>(p) / static_cast<float>(numScopePoints - 1);
+        const float y = h * .5f * (1.f - jlimit(-1.f, 1.f, trace[p]));
+        if (p == 0) {
+            scopePath.startNewSubPath(x, y);
+        } else {
+            scopePath.lineTo(x, y);
+        }
+    }
+
+    Path spectrumPath;
+    for (int p = 0; p < numSpectrumPoints; ++p) {
+        const float x = half + margin + w * static_cast<float>(p) / static_cast<float>(numSpectrumPoints - 1);
+        const float y = h * (maxDb - spectrum[p]) / (maxDb - minDb);
+        if (p == 0) {
+            spectrumPath.startNewSubPath(x, y);
+        } else {
+            spectrumPath.lineTo(x, y);
+        }
+    }
+
+    g.setColour(SynthParams::waveformLine);
+    g.strokePath(scopePath, PathStrokeType(1.5f));
+    g.strokePath(spectrumPath, PathStrokeType(1.5f));
+}
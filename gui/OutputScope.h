@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    OutputScope.h
+    Created: 15 Oct 2026 6:48:02am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef OUTPUTSCOPE_H_INCLUDED
+#define OUTPUTSCOPE_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "BackgroundJobs.h"
+#include "SynthParams.h"
+#include "BackgroundImage.h"
+#include <array>
+
+//==============================================================================
+//! OutputScope: oscilloscope and spectrum of the master output
+/*! The samples come from the OutputTap of the telemetry, which the scope only enables while
+    it is showing, so a folded section or a closed editor costs the audio thread nothing. The
+    trace and the spectrum are computed on a background thread, with a windowed FFT whose
+    plan and window are made once. The message thread only copies the finished frame, the
+    paths are stroked into a BackgroundImage. The trace starts at a rising zero crossing to stand still on periodic sounds.
+    The timer stops while the editor is hidden.
+*/
+class OutputScope : public Component, private Timer, private TimeSliceClient, private ParamUpdateHub::ShowingListener
+{
+public:
+    explicit OutputScope(SynthParams& p);
+    ~OutputScope();
+
+    void paint(Graphics& g) override;
+
+    //! 2^fftOrder samples per transform
+    static const int fftOrder = 11;
+    static const int fftSize = 1 << fftOrder;
+    //! points of the trace and of the spectrum, log spaced between minFreq and maxFreq
+    static const int numScopePoints = 256;
+    static const int numSpectrumPoints = 128;
+    //! samples the trace shows
+    static const int scopeLength = 1024;
+    constexpr static float minFreq = 20.f;
+    constexpr static float maxFreq = 20000.f;
+    constexpr static float minDb = -90.f;
+    constexpr static float maxDb = 0.f;
+    //! dB the spectrum falls per frame at most, so it does not flicker
+    constexpr static float spectrumFall = 3.f;
+
+private:
+
+    //! switches the tap with the visibility and picks up a finished frame
+    void timerCallback() override;
+    void editorShowingChanged(bool showing) override;
+    //! a visualisation only, paused while the audio thread is under load
+    void editorThrottledChanged(bool throttled) override;
+    //! reads the tap and computes the next frame on the background thread
+    int useTimeSlice() override;
+
+    void computeTrace(float* trace) const;
+    void computeSpectrum(float* spectrum, float rate);
+    //! \brief background and grid, and the frame unless it is nullptr; on the render thread but before the first frame
+    static void paintFrame(Graphics& g, int width, int height, const float* trace, const float* spectrum);
+
+    SynthParams& params;
+    SharedResourcePointer<BackgroundJobs> jobs;
+
+    //! \name owned by the worker
+    ///@{
+    static const int historySize = 2 * fftSize;
+    HeapBlock<float> history;   //!< the newest samples of the tap, the last one at the end
+    FFT fft;
+    HeapBlock<float> window;    //!< Hann window of fftSize, scaled to a gain of 1 for a sine
+    HeapBlock<float> fftData;   //!< 2 * fftSize
+    float smoothed[numSpectrumPoints];
+    ///@}
+
+    SpinLock lock;          //!< guards the frame of the worker
+    float resultTrace[numScopePoints];
+    float resultSpectrum[numSpectrumPoints];
+    int resultVersion;
+
+    float trace[numScopePoints];        //!< the frame which is drawn
+    float spectrum[numSpectrumPoints];
+    int frameVersion;
+    BackgroundImage image;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OutputScope)
+};
+
+#endif  // OUTPUTSCOPE_H_INCLUDED
@@ -29,6 +29,7 @@
 #include "panels/ChorusPanel.h"
 #include "panels/ClippingPanel.h"
 #include "panels/InfoPanel.h"
+#include "OutputScope.h"
 //[/Headers]
 
 #include "PlugUI.h"
@@ -42,7 +43,10 @@ PlugUI::PlugUI (SynthParams &p)
     : PanelBase(p), params(p)
 {
     //[Constructor_pre] You can add your own custom stuff here..
-    startTimerHz (30);
+    // the audio thread publishes the modulation of the playing note while the timer runs
+    readingTelemetry = false;
+    suspended = false;
+    startPanelTimerHz (30);
     //[/Constructor_pre]
 
     addAndMakeVisible (freq = new MouseOverKnob ("frequency"));
@@ -75,7 +79,7 @@ PlugUI::PlugUI (SynthParams &p)
     loadPresetButton->setColour (TextButton::textColourOnId, Colour (0xff6c788c));
     loadPresetButton->setColour (TextButton::textColourOffId, Colour (0xff6c788c));
 
-    addAndMakeVisible (foldableComponent = new FoldablePanel ("foldablePanels"));
+    addAndMakeVisible (foldableComponent = new FoldablePanel ("foldablePanels", params.uiUpdates));
 
     addAndMakeVisible (masterAmp = new MouseOverKnob ("amp"));
     masterAmp->setRange (-96, 12, 0);
@@ -111,6 +115,13 @@ PlugUI::PlugUI (SynthParams &p)
     patchNameEditor->setPopupMenuEnabled (true);
     patchNameEditor->setText (String::empty);
 
+    addAndMakeVisible (presetBrowser = new PresetBrowserBox ("preset browser", params, presetEntries));
+    presetBrowser->setEditableText (false);
+    presetBrowser->setJustificationType (Justification::centredLeft);
+    presetBrowser->setTextWhenNothingSelected (TRANS("presets"));
+    presetBrowser->setTextWhenNoChoicesAvailable (TRANS("(no presets)"));
+    presetBrowser->addListener (this);
+
     addAndMakeVisible (logoInfoButton = new ImageButton ("logo info button"));
     logoInfoButton->setButtonText (String::empty);
     logoInfoButton->addListener (this);
@@ -130,49 +141,87 @@ PlugUI::PlugUI (SynthParams &p)
     freq->setDefaultValue(params.freq.getDefault());
 
     //patchNameEditor->addListener (this);
+    presetLibraryVersion = -1;
+    updatePresetBrowser();
     //[/UserPreSize]
 
     setSize (812, 693);
 
 
     //[Constructor] You can add your own custom stuff here..
-    foldableComponent->addSection (TRANS("oscillators"), new OscPanel (params, 0), SynthParams::oscColour, 250, &params.oscSection, 0);
-    foldableComponent->addPanel(0, new OscPanel(params, 1));
-    foldableComponent->addPanel(0, new OscPanel(params, 2));
-    foldableComponent->addSection (TRANS("envelopes"), new EnvPanel (params), SynthParams::envColour, 230, &params.envSection, 1);
-    foldableComponent->addPanel(1, new Env1Panel(params, 0));
-    foldableComponent->addPanel(1, new Env1Panel(params, 1));
-    foldableComponent->addSection (TRANS("LFOs"), new LfoPanel (params, 0), SynthParams::lfoColour, 175, &params.lfoSection, 2);
-    foldableComponent->addPanel(2, new LfoPanel(params, 1));
-    foldableComponent->addPanel(2, new LfoPanel(params, 2));
-    foldableComponent->addSection (TRANS("filters"), new FiltPanel (params, 0), SynthParams::filterColour, 158, &params.filterSection, 3);
-    foldableComponent->addPanel(3, new FiltPanel (params, 1));
-    foldableComponent->addSection (TRANS("FX"), new FxPanel (params), SynthParams::fxColour, 178, &params.fxSection, 4);
-    foldableComponent->addPanel(4, new ChorusPanel(params));
-    foldableComponent->addPanel(4, new LoFiPanel(params));
-    foldableComponent->addPanel(4, new ClippingPanel(params));
-    foldableComponent->addSection (TRANS("step sequencer"), new SeqPanel (params), SynthParams::stepSeqColour, 300, &params.seqSection, 5);
-
-    // set whole design from very parent GUI component
-    lnf = new CustomLookAndFeel();
-    LookAndFeel::setDefaultLookAndFeel(lnf);
+    // the panels of a section are built the first time it is expanded
+    foldableComponent->addSection (TRANS("oscillators"), [this] { return new OscPanel (params, 0); }, SynthParams::oscColour, 250, &params.oscSection, 0);
+    foldableComponent->addPanel(0, [this] { return new OscPanel(params, 1); });
+    foldableComponent->addPanel(0, [this] { return new OscPanel(params, 2); });
+    foldableComponent->addSection (TRANS("envelopes"), [this] { return new EnvPanel (params); }, SynthParams::envColour, 230, &params.envSection, 1);
+    foldableComponent->addPanel(1, [this] { return new Env1Panel(params, 0); });
+    foldableComponent->addPanel(1, [this] { return new Env1Panel(params, 1); });
+    foldableComponent->addSection (TRANS("LFOs"), [this] { return new LfoPanel (params, 0); }, SynthParams::lfoColour, 175, &params.lfoSection, 2);
+    foldableComponent->addPanel(2, [this] { return new LfoPanel(params, 1); });
+    foldableComponent->addPanel(2, [this] { return new LfoPanel(params, 2); });
+    foldableComponent->addSection (TRANS("filters"), [this] { return new FiltPanel (params, 0); }, SynthParams::filterColour, 158, &params.filterSection, 3);
+    foldableComponent->addPanel(3, [this] { return new FiltPanel (params, 1); });
+    foldableComponent->addSection (TRANS("FX"), [this] { return new FxPanel (params); }, SynthParams::fxColour, 178, &params.fxSection, 4);
+    foldableComponent->addPanel(4, [this] { return new ChorusPanel(params); });
+    foldableComponent->addPanel(4, [this] { return new LoFiPanel(params); });
+    foldableComponent->addPanel(4, [this] { return new ClippingPanel(params); });
+    foldableComponent->addSection (TRANS("step sequencer"), [this] { return new SeqPanel (params); }, SynthParams::stepSeqColour, 300, &params.seqSection, 5);
+    foldableComponent->addSection (TRANS("scope"), [this] { return new OutputScope (params); }, SynthParams::scopeColour, 160, &params.scopeSection, 6);
 
     // sub window as info panel screen
     addAndMakeVisible(infoScreen = new InfoWindow("Info Screen", Colours::black, InfoWindow::TitleBarButtons::closeButton));
     infoScreen->setAlwaysOnTop(true);
     //infoScreen->setDraggable(false);
 
-    // create infoscreen gui component and set as content of sub window
-    infoScreen->setContentOwned(new InfoPanel(params), true);
-    infoScreen->centreWithSize(infoScreen->getWidth(), infoScreen->getHeight());
+    // the infoscreen gui component is created when it is opened for the first time
     infoScreen->setVisible(false);
+
+    // corners of the patch morph, next to the master pan
+    for (int i = 0; i < PatchMorph::numCorners; ++i) {
+        TextButton* corner = morphCorners.add(new TextButton(PatchMorph::getCornerName(i)));
+        corner->setTooltip(TRANS("Click to store the current sound as morph corner ") + PatchMorph::getCornerName(i) + TRANS(", shift click to clear it"));
+        corner->setColour(TextButton::buttonColourId, Colours::white);
+        corner->setColour(TextButton::buttonOnColourId, SynthParams::fxColour);
+        corner->setColour(TextButton::textColourOnId, Colours::white);
+        corner->setColour(TextButton::textColourOffId, Colour(0xff6c788c));
+        corner->addListener(this);
+        addAndMakeVisible(corner);
+    }
+    addAndMakeVisible(morphX = new MouseOverKnob("morph x"));
+    addAndMakeVisible(morphY = new MouseOverKnob("morph y"));
+    for (MouseOverKnob* knob : { morphX.get(), morphY.get() }) {
+        knob->setRange(0, 1, 0);
+        knob->setSliderStyle(Slider::LinearBar);
+        knob->setTextBoxStyle(Slider::NoTextBox, false, 0, 0);
+        knob->setColour(Slider::thumbColourId, Colour(0xff292929));
+        knob->setColour(Slider::trackColourId, Colours::white);
+        knob->setColour(Slider::textBoxTextColourId, Colours::white);
+        knob->addListener(this);
+    }
+    registerSlider(morphX, &params.morphX);
+    registerSlider(morphY, &params.morphY);
+    updateMorphCorners();
+    resized();
+
+    // the undo keys reach the editor when no child takes them
+    setWantsKeyboardFocus(true);
+
+    numScannedPanels = -1;
     //[/Constructor]
 }
 
 PlugUI::~PlugUI()
 {
     //[Destructor_pre]. You can add your own custom destruction code here..
+    stopTimer();
+    if (readingTelemetry) {
+        params.telemetry.removeReader();
+    }
+    modulatedKnobs.clear();
     infoScreen = nullptr;
+    morphCorners.clear();
+    morphX = nullptr;
+    morphY = nullptr;
     //[/Destructor_pre]
 
     freq = nullptr;
@@ -184,6 +233,7 @@ PlugUI::~PlugUI()
     masterPan = nullptr;
     patchNameEditor = nullptr;
     logoInfoButton = nullptr;
+    presetBrowser = nullptr;
 
 
     //[Destructor]. You can add your own custom destruction code here..
@@ -216,7 +266,15 @@ void PlugUI::resized()
     masterPan->setBounds (502, 24, 80, 32);
     patchNameEditor->setBounds (9, 36, 102, 24);
     logoInfoButton->setBounds (326, 16, 153, 40);
+    presetBrowser->setBounds (116, 13, 80, 21);
     //[UserResized] Add your own custom resize handling here..
+    for (int i = 0; i < morphCorners.size(); ++i) {
+        morphCorners[i]->setBounds(590 + i * 29, 12, 27, 20);
+    }
+    if (morphX != nullptr) {
+        morphX->setBounds(590, 36, 116, 14);
+        morphY->setBounds(590, 52, 116, 14);
+    }
     //[/UserResized]
 }
 
@@ -249,6 +307,11 @@ void PlugUI::sliderValueChanged (Slider* sliderThatWasMoved)
 void PlugUI::buttonClicked (Button* buttonThatWasClicked)
 {
     //[UserbuttonClicked_Pre]
+    const int corner = morphCorners.indexOf(static_cast<TextButton*>(buttonThatWasClicked));
+    if (corner >= 0) {
+        morphCornerClicked(corner);
+        return;
+    }
     //[/UserbuttonClicked_Pre]
 
     if (buttonThatWasClicked == savePresetButton)
@@ -267,6 +330,9 @@ void PlugUI::buttonClicked (Button* buttonThatWasClicked)
     else if (buttonThatWasClicked == logoInfoButton)
     {
         //[UserButtonCode_logoInfoButton] -- add your button handler code here..
+        if (infoScreen->getContentComponent() == nullptr) {
+            infoScreen->setContentOwned(new InfoPanel(params), true);
+        }
         infoScreen->centreWithSize(infoScreen->getWidth(), infoScreen->getHeight());
         infoScreen->setVisible(true);
         infoScreen->grabKeyboardFocus();
@@ -277,14 +343,194 @@ void PlugUI::buttonClicked (Button* buttonThatWasClicked)
     //[/UserbuttonClicked_Post]
 }
 
+void PlugUI::comboBoxChanged (ComboBox* comboBoxThatHasChanged)
+{
+    //[UsercomboBoxChanged_Pre]
+    //[/UsercomboBoxChanged_Pre]
+
+    if (comboBoxThatHasChanged == presetBrowser)
+    {
+        //[UserComboBoxCode_presetBrowser] -- add your combo box handling code here..
+        const int index = presetBrowser->getSelectedId() - 1;
+        if (isPositiveAndBelow(index, presetEntries.size())) {
+            // a recently used patch is parsed already, the others are read by the patch loader
+            const PresetLibrary::Entry& e = presetEntries.getReference(index);
+            const File& file = e.file;
+            if (e.bank != nullptr) {
+                params.loadBankPreset(e.bank, e.preset);
+            } else if (XmlElement* patch = presetLibrary->createCachedPatch(file)) {
+                params.loadParsedPatch(patch);
+            } else {
+                params.loadPatchFile(file);
+            }
+        }
+        //[/UserComboBoxCode_presetBrowser]
+    }
+
+    //[UsercomboBoxChanged_Post]
+    //[/UsercomboBoxChanged_Post]
+}
+
 
 
 //[MiscUserCode] You can add your own definitions of your custom methods or any other code here...
 void PlugUI::timerCallback()
 {
+    // minimised, or hidden by the host; the editor notices when it is shown again
+    if (!isShowing()) {
+        params.uiUpdates.setEditorShowing(false);
+        return;
+    }
+
+    // values the audio thread changed, the panels get them from params.uiUpdates
+    params.dispatchAudioEvents();
+    // notes of the host and the sequencer on the keyboard
+    params.keyboardInput.updateKeyboard();
+
     if (params.patchNameDirty) {
         updateDirtyPatchname(params.patchName);
         params.patchNameDirty = 0;
+        // the edits were made to another patch
+        params.undoHistory.clear();
+    }
+
+    if (presetLibrary->getVersion() != presetLibraryVersion) {
+        updatePresetBrowser();
+    }
+
+    if (readingTelemetry && params.telemetry.modulation.update()) {
+        updateLiveModulation();
+    }
+
+    updateMorphCorners();
+}
+
+void PlugUI::updateTelemetryReader(bool running)
+{
+    const bool read = running && !params.uiUpdates.isThrottled();
+    if (read != readingTelemetry) {
+        readingTelemetry = read;
+        if (read) {
+            params.telemetry.addReader();
+        } else {
+            params.telemetry.removeReader();
+        }
+    }
+}
+
+void PlugUI::panelThrottledChanged(bool throttled)
+{
+    updateTelemetryReader(isTimerRunning());
+    // the rings would freeze at their last value
+    if (throttled) {
+        for (MouseOverKnob* knob : modulatedKnobs) {
+            knob->setLiveModValue(1, nullptr);
+            knob->setLiveModValue(2, nullptr);
+        }
+    }
+}
+
+void PlugUI::panelTimerStateChanged(bool running)
+{
+    updateTelemetryReader(running);
+    if (!running) {
+        suspended = true;
+    } else if (suspended) {
+        // the queue of the audio thread may have run full while hidden, every shown param picks up its value once
+        suspended = false;
+        for (Param* p : params.serializeParams) {
+            p->markUIDirty();
+        }
+    }
+}
+
+bool PlugUI::keyPressed(const KeyPress& key)
+{
+    const ModifierKeys mods = key.getModifiers();
+    if (!mods.isCommandDown()) {
+        return false;
+    }
+    const int code = key.getKeyCode();
+    if ((code == 'Z' && mods.isShiftDown()) || code == 'Y') {
+        params.undoHistory.redo();
+        return true;
+    }
+    if (code == 'Z') {
+        params.undoHistory.undo();
+        return true;
+    }
+    return false;
+}
+
+void PlugUI::morphCornerClicked(int corner)
+{
+    if (ModifierKeys::getCurrentModifiers().isShiftDown()) {
+        params.morph.clearCorner(corner);
+    } else {
+        params.morph.storeCorner(corner);
+    }
+    updateMorphCorners();
+}
+
+void PlugUI::updateMorphCorners()
+{
+    for (int i = 0; i < morphCorners.size(); ++i) {
+        morphCorners[i]->setToggleState(params.morph.hasCorner(i), dontSendNotification);
+    }
+}
+
+void PlugUI::collectModulatedKnobs(Component& parent)
+{
+    for (int i = 0; i < parent.getNumChildComponents(); ++i) {
+        Component* child = parent.getChildComponent(i);
+        if (MouseOverKnob* knob = dynamic_cast<MouseOverKnob*>(child)) {
+            const std::array<ParamStepped<eModSource>*, 2> sources = knob->getModSources();
+            if (sources[0] != nullptr || sources[1] != nullptr) {
+                modulatedKnobs.add(knob);
+            }
+        }
+        collectModulatedKnobs(*child);
+    }
+}
+
+void PlugUI::updateLiveModulation()
+{
+    // the knobs of sections expanded since the last frame
+    if (foldableComponent->getNumCreatedPanels() != numScannedPanels) {
+        numScannedPanels = foldableComponent->getNumCreatedPanels();
+        modulatedKnobs.clear();
+        collectModulatedKnobs(*foldableComponent);
+    }
+
+    const ModulationFrame& frame = params.telemetry.modulation.get();
+    for (MouseOverKnob* knob : modulatedKnobs) {
+        if (!knob->isShowing()) {
+            continue;
+        }
+        const std::array<ParamStepped<eModSource>*, 2> sources = knob->getModSources();
+        for (int n = 1; n <= 2; ++n) {
+            const ParamStepped<eModSource>* source = sources[n - 1];
+            const bool live = frame.note >= 0 && source != nullptr && source->getStep() != eModSource::eNone;
+            knob->setLiveModValue(n, live ? &frame.sources[source->getStep()] : nullptr);
+        }
+    }
+}
+
+void PlugUI::updatePresetBrowser()
+{
+    presetLibraryVersion = presetLibrary->getVersion();
+    const int selected = presetBrowser->getSelectedId() - 1;
+    const File selectedFile = isPositiveAndBelow(selected, presetEntries.size()) ? presetEntries.getReference(selected).file : File::nonexistent;
+    const int selectedPreset = isPositiveAndBelow(selected, presetEntries.size()) ? presetEntries.getReference(selected).preset : 0;
+
+    presetLibrary->getEntries(presetEntries);
+    presetBrowser->clear(dontSendNotification);
+    for (int i = 0; i < presetEntries.size(); ++i) {
+        const PresetLibrary::Entry& e = presetEntries.getReference(i);
+        presetBrowser->addItem(e.tags.size() == 0 ? e.name : e.name + " (" + e.tags.joinIntoString(", ") + ")", i + 1);
+        if (e.file == selectedFile && e.preset == selectedPreset) {
+            presetBrowser->setSelectedId(i + 1, dontSendNotification);
+        }
     }
 }
 
@@ -333,7 +579,7 @@ BEGIN_JUCER_METADATA
               needsCallback="1" radioGroupId="0"/>
   <GENERICCOMPONENT name="" id="8fab73fbef5d680a" memberName="foldableComponent"
                     virtualName="FoldablePanel" explicitFocusOrder="0" pos="0 72 812 576"
-                    class="FoldablePanel" params="&quot;foldablePanels&quot;"/>
+                    class="FoldablePanel" params="&quot;foldablePanels&quot;, params.uiUpdates"/>
   <SLIDER name="amp" id="3279e0342166e50f" memberName="masterAmp" virtualName="MouseOverKnob"
           explicitFocusOrder="0" pos="203 24 100 32" bkgcol="ffffff" thumbcol="ff808080"
           trackcol="ffffffff" rotarysliderfill="ff0000ff" textboxtext="ffffffff"
@@ -357,6 +603,9 @@ BEGIN_JUCER_METADATA
                colourNormal="ffffff" resourceOver="BinaryData::synisterLogoSmall_png"
                opacityOver="1" colourOver="ffffffff" resourceDown="BinaryData::synisterLogoSmall_png"
                opacityDown="1" colourDown="ffffffff"/>
+  <COMBOBOX name="preset browser" id="5e1c0a7d93b24f68" memberName="presetBrowser"
+            virtualName="" explicitFocusOrder="0" pos="116 13 80 21" editable="0"
+            layout="33" items="" textWhenNonSelected="presets" textWhenNoItems="(no presets)"/>
 </JUCER_COMPONENT>
 
 END_JUCER_METADATA
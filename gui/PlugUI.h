@@ -27,6 +27,9 @@
 #include "FoldablePanel.h"
 #include "IncDecDropDown.h"
 #include "panels/PanelBase.h"
+#include "PresetLibrary.h"
+#include "PresetPreview.h"
+#include "GuiResources.h"
 //[/Headers]
 
 
@@ -42,7 +45,8 @@
 class PlugUI  : public PanelBase,
                 public TextEditorListener,
                 public SliderListener,
-                public ButtonListener
+                public ButtonListener,
+                public ComboBoxListener
 {
 public:
     //==============================================================================
@@ -66,12 +70,16 @@ public:
         virtual void closeButtonPressed() { this->setVisible(false); }
     };
 
+    //! \brief cmd/ctrl + z undoes the last edit, with shift or cmd/ctrl + y it is redone
+    bool keyPressed(const KeyPress& key) override;
+
     //[/UserMethods]
 
     void paint (Graphics& g);
     void resized();
     void sliderValueChanged (Slider* sliderThatWasMoved);
     void buttonClicked (Button* buttonThatWasClicked);
+    void comboBoxChanged (ComboBox* comboBoxThatHasChanged);
 
 
 
@@ -80,10 +88,42 @@ private:
     SynthParams &params;
 
     void timerCallback() override;
+    //! \brief the editor was hidden or is shown again, see PanelBase::startPanelTimer()
+    void panelTimerStateChanged(bool running) override;
+    //! \brief the live modulation pauses while the audio thread is under load
+    void panelThrottledChanged(bool throttled) override;
+    //! \brief registers as reader of the telemetry while the timer runs and the editor is not throttled
+    void updateTelemetryReader(bool running);
+    bool readingTelemetry;  //!< registered as reader of the telemetry
+    bool suspended;         //!< the timer stopped since the editor was created
     void updateDirtyPatchname(const String patchName);
     void textEditorFocusLost(TextEditor &editor);
-
-    ScopedPointer<CustomLookAndFeel> lnf;
+    //! refills the preset browser from the library index
+    void updatePresetBrowser();
+    //! \brief adds the knobs below the component that have a mod source to modulatedKnobs
+    void collectModulatedKnobs(Component& parent);
+    //! \brief moves the live markers of the modulated knobs to the last published values
+    void updateLiveModulation();
+    //! \brief a click stores the current sound as the corner, a shift click clears it
+    void morphCornerClicked(int corner);
+    //! \brief the lit buttons are the stored corners, also after the host restored a state
+    void updateMorphCorners();
+
+    SharedResourcePointer<PresetLibrary> presetLibrary;
+    Array<PresetLibrary::Entry> presetEntries;  //!< of the items of the preset browser, item id = index + 1
+    int presetLibraryVersion;
+
+    Array<MouseOverKnob*> modulatedKnobs;   //!< owned by the panels, see updateLiveModulation()
+    int numScannedPanels;                   //!< created panels modulatedKnobs was collected from
+
+    SharedResourcePointer<GuiResources> resources;  //!< the look and feel of all editors, destroyed with the last one
+
+    //! \name patch morph
+    ///@{
+    OwnedArray<TextButton> morphCorners;    //!< A, B, C, D
+    ScopedPointer<MouseOverKnob> morphX;
+    ScopedPointer<MouseOverKnob> morphY;
+    ///@}
     ScopedPointer<DocumentWindow> infoScreen;
     //[/UserVariables]
 
@@ -97,6 +137,7 @@ private:
     ScopedPointer<MouseOverKnob> masterPan;
     ScopedPointer<TextEditor> patchNameEditor;
     ScopedPointer<ImageButton> logoInfoButton;
+    ScopedPointer<PresetBrowserBox> presetBrowser;
 
 
     //==============================================================================
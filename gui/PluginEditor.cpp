@@ -20,20 +20,69 @@ PluginAudioProcessorEditor::PluginAudioProcessorEditor (PluginAudioProcessor& p)
     // editor's size to whatever you need it to be.
     setSize (812, 693);
 
+    // a previous editor may have been closed while it was hidden
+    p.uiUpdates.setEditorShowing(true);
     addAndMakeVisible(ui = new PlugUI(p));
+
+    paramChanged(&p.openGLRendering);
+    p.uiUpdates.addListener(&p.openGLRendering, this);
 }
 
 PluginAudioProcessorEditor::~PluginAudioProcessorEditor()
 {
+    processor.uiUpdates.removeListener(this);
+#if JUCE_MODULE_AVAILABLE_juce_opengl
+    openGLContext.detach();
+#endif
     ui = nullptr;
 }
 
+void PluginAudioProcessorEditor::paramChanged(Param*)
+{
+#if JUCE_MODULE_AVAILABLE_juce_opengl
+    const bool useOpenGL = processor.openGLRendering.getStep() == eOnOffToggle::eOn;
+    if (useOpenGL && !openGLContext.isAttached()) {
+        openGLContext.attachTo(*this);
+    } else if (!useOpenGL && openGLContext.isAttached()) {
+        openGLContext.detach();
+    }
+#endif
+}
+
 //==============================================================================
 void PluginAudioProcessorEditor::paint (Graphics& g)
 {
     g.fillAll (Colours::white);
 }
 
+void PluginAudioProcessorEditor::paintOverChildren (Graphics&)
+{
+    // painted again after a restore, maybe on the OpenGL thread
+    if (!processor.uiUpdates.isEditorShowing()) {
+        triggerAsyncUpdate();
+    }
+}
+
+void PluginAudioProcessorEditor::visibilityChanged()
+{
+    triggerAsyncUpdate();
+}
+
+void PluginAudioProcessorEditor::parentHierarchyChanged()
+{
+    triggerAsyncUpdate();
+}
+
+void PluginAudioProcessorEditor::minimisationStateChanged (bool)
+{
+    triggerAsyncUpdate();
+}
+
+void PluginAudioProcessorEditor::handleAsyncUpdate()
+{
+    processor.uiUpdates.setEditorShowing(isShowing());
+}
+
 void PluginAudioProcessorEditor::resized()
 {
     // This is generally where you'll want to lay out the positions of any
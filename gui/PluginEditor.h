@@ -19,9 +19,11 @@
 
 
 //==============================================================================
-/**
+/** Tells the ParamUpdateHub whether the editor can be seen, the timers of the ui only run while
+    it is showing. A hidden editor is noticed by the timer of PlugUI or a change of the component
+    hierarchy, a minimised window that is restored by the first paint that follows.
 */
-class PluginAudioProcessorEditor  : public AudioProcessorEditor
+class PluginAudioProcessorEditor  : public AudioProcessorEditor, private ParamUpdateHub::Listener, private AsyncUpdater
 {
 public:
     PluginAudioProcessorEditor (PluginAudioProcessor&);
@@ -29,14 +31,27 @@ public:
 
     //==============================================================================
     void paint (Graphics&) override;
+    void paintOverChildren (Graphics&) override;
     void resized() override;
 
+    void visibilityChanged() override;
+    void parentHierarchyChanged() override;
+    void minimisationStateChanged (bool isNowMinimised) override;
+
 private:
     // This reference is provided as a quick way for your editor to
     // access the processor object that created it.
     PluginAudioProcessor& processor;
     ScopedPointer<PlugUI> ui;
 
+    //! attaches or detaches the OpenGL context, see SynthParams::openGLRendering
+    void paramChanged(Param*) override;
+    //! \brief passes isShowing() on to the hub
+    void handleAsyncUpdate() override;
+#if JUCE_MODULE_AVAILABLE_juce_opengl
+    OpenGLContext openGLContext;    //!< composites the whole editor while attached
+#endif
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PluginAudioProcessorEditor)
 };
 
@@ -0,0 +1,277 @@
+/*
+  ==============================================================================
+
+    PresetLibrary.cpp
+    Created: 15 Oct 2026 5:46:09am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "PresetLibrary.h"
+
+namespace {
+    const char* const indexFileName = ".synister-index.xml";
+
+    struct EntryNameComparator {
+        static int compareElements(const PresetLibrary::Entry& a, const PresetLibrary::Entry& b) {
+            return a.name.compareNatural(b.name);
+        }
+    };
+}
+
+PresetLibrary::PresetLibrary()
+    : version(0)
+    , indexRead(false)
+    , lastScan(0)
+{
+    jobs->add(this, BackgroundJobs::ePriority::eNormal);
+}
+
+PresetLibrary::~PresetLibrary()
+{
+    // waits until a running scan is done
+    jobs->remove(this);
+}
+
+File PresetLibrary::getDirectory()
+{
+    // the same place readXMLPatchStandalone() and writeXMLPatchStandalone() start in
+    return File::getSpecialLocation(File::commonDocumentsDirectory).getChildFile("Synister");
+}
+
+void PresetLibrary::getEntries(Array<Entry>& dst) const
+{
+    const ScopedLock sl(lock);
+    dst = entries;
+}
+
+XmlElement* PresetLibrary::createCachedPatch(const File& file)
+{
+    {
+        const ScopedLock sl(lock);
+        for (int i = 0; i < cache.size(); ++i) {
+            if (cache[i]->file == file) {
+                cache.move(i, 0);
+                return new XmlElement(*cache[0]->patch);
+            }
+        }
+        toCache.addIfNotAlreadyThere(file);
+    }
+    jobs->wake(this);
+    return nullptr;
+}
+
+int PresetLibrary::useTimeSlice()
+{
+    if (!indexRead) {
+        readIndex();
+        indexRead = true;
+    }
+
+    const uint32 now = Time::getMillisecondCounter();
+    if (lastScan == 0 || now - lastScan >= static_cast<uint32>(scanInterval)) {
+        scan();
+        lastScan = jmax(now, 1u);
+    }
+
+    Array<File> files;
+    {
+        const ScopedLock sl(lock);
+        files.swapWith(toCache);
+    }
+    for (const File& file : files) {
+        Entry e;
+        XmlElement* patch = nullptr;
+        if (readEntry(file, e, &patch)) {
+            addToCache(file, patch);
+        }
+    }
+    return 200;
+}
+
+void PresetLibrary::scan()
+{
+    const File dir = getDirectory();
+    Array<File> files;
+    if (dir.isDirectory()) {
+        dir.findChildFiles(files, File::findFiles, true, "*.xml;*" + String(PresetBank::fileExtension));
+    }
+
+    Array<Entry> old;
+    getEntries(old);
+    HashMap<String, int> oldIndex(jmax(101, old.size() * 2));
+    for (int i = 0; i < old.size(); ++i) {
+        oldIndex.set(old.getReference(i).file.getFullPathName(), i);
+    }
+
+    // unchanged files keep their entry, the others are read again
+    Array<Entry> scanned;
+    bool changed = false;
+    for (const File& file : files) {
+        if (file.getFileName() == indexFileName) {
+            continue;
+        }
+        const String path = file.getFullPathName();
+        const int64 size = file.getSize();
+        const Time modified = file.getLastModificationTime();
+        if (file.hasFileExtension(PresetBank::fileExtension)) {
+            // a bank that did not change keeps its mapping
+            PresetBank::Ptr bank;
+            if (oldIndex.contains(path)) {
+                const Entry& e = old.getReference(oldIndex[path]);
+                if (e.size == size && e.modified == modified) {
+                    bank = e.bank;
+                }
+            }
+            if (bank == nullptr) {
+                bank = PresetBank::open(file);
+                changed = true;
+            }
+            if (bank != nullptr) {
+                addBankEntries(bank, size, modified, scanned);
+            }
+            continue;
+        }
+        if (oldIndex.contains(path)) {
+            const Entry& e = old.getReference(oldIndex[path]);
+            if (e.size == size && e.modified == modified) {
+                scanned.add(e);
+                continue;
+            }
+        }
+        Entry e;
+        if (readEntry(file, e, nullptr)) {
+            scanned.add(e);
+        }
+        changed = true;
+    }
+    changed = changed || scanned.size() != old.size();
+    if (!changed) {
+        return;
+    }
+
+    EntryNameComparator comparator;
+    scanned.sort(comparator, true);
+    {
+        const ScopedLock sl(lock);
+        entries.swapWith(scanned);
+    }
+    ++version;
+    writeIndex();
+}
+
+bool PresetLibrary::readEntry(const File& file, Entry& e, XmlElement** parsed)
+{
+    MemoryBlock content;
+    if (!file.loadFileAsData(content)) {
+        return false;
+    }
+    ScopedPointer<XmlElement> patch = XmlDocument::parse(content.toString());
+    if (patch == nullptr || patch->getTagName() != "patch") {
+        return false;
+    }
+
+    e.file = file;
+    e.name = patch->getStringAttribute("patchname", file.getFileNameWithoutExtension());
+    if (e.name.isEmpty()) {
+        e.name = file.getFileNameWithoutExtension();
+    }
+    e.tags = StringArray::fromTokens(patch->getStringAttribute("tags"), ",", "");
+    e.tags.trim();
+    e.tags.removeEmptyStrings();
+    e.hash = content.toString().hashCode64();
+    e.size = file.getSize();
+    e.modified = file.getLastModificationTime();
+
+    if (parsed != nullptr) {
+        *parsed = patch.release();
+    }
+    return true;
+}
+
+void PresetLibrary::addBankEntries(PresetBank* bank, int64 size, Time modified, Array<Entry>& dst)
+{
+    for (int p = 0; p < bank->getNumPresets(); ++p) {
+        Entry e;
+        e.file = bank->getFile();
+        e.name = bank->getName(p);
+        e.tags = bank->getTags(p);
+        e.hash = 0;
+        e.size = size;
+        e.modified = modified;
+        e.bank = bank;
+        e.preset = p;
+        dst.add(e);
+    }
+}
+
+void PresetLibrary::addToCache(const File& file, XmlElement* patch)
+{
+    const ScopedLock sl(lock);
+    for (int i = cache.size(); --i >= 0;) {
+        if (cache[i]->file == file) {
+            cache.remove(i);
+        }
+    }
+    CachedPatch* c = new CachedPatch();
+    c->file = file;
+    c->patch = patch;
+    cache.insert(0, c);
+    while (cache.size() > maxCachedPatches) {
+        cache.removeLast();
+    }
+}
+
+void PresetLibrary::readIndex()
+{
+    const File dir = getDirectory();
+    ScopedPointer<XmlElement> index = XmlDocument::parse(dir.getChildFile(indexFileName));
+    if (index == nullptr || !index->hasTagName("presetindex")) {
+        return;
+    }
+
+    Array<Entry> read;
+    forEachXmlChildElementWithTagName(*index, preset, "preset") {
+        Entry e;
+        e.file = dir.getChildFile(preset->getStringAttribute("file"));
+        e.name = preset->getStringAttribute("name");
+        e.tags = StringArray::fromTokens(preset->getStringAttribute("tags"), ",", "");
+        e.hash = preset->getStringAttribute("hash").getLargeIntValue();
+        e.size = preset->getStringAttribute("size").getLargeIntValue();
+        e.modified = Time(preset->getStringAttribute("modified").getLargeIntValue());
+        read.add(e);
+    }
+    {
+        const ScopedLock sl(lock);
+        entries.swapWith(read);
+    }
+    ++version;
+}
+
+void PresetLibrary::writeIndex() const
+{
+    const File dir = getDirectory();
+    if (!dir.isDirectory()) {
+        return;
+    }
+
+    XmlElement index("presetindex");
+    index.setAttribute("version", 1);
+    {
+        const ScopedLock sl(lock);
+        for (const Entry& e : entries) {
+            if (e.bank != nullptr) {
+                continue;
+            }
+            XmlElement* preset = index.createNewChildElement("preset");
+            preset->setAttribute("file", e.file.getRelativePathFrom(dir));
+            preset->setAttribute("name", e.name);
+            preset->setAttribute("tags", e.tags.joinIntoString(","));
+            preset->setAttribute("hash", String(e.hash));
+            preset->setAttribute("size", String(e.size));
+            preset->setAttribute("modified", String(e.modified.toMilliseconds()));
+        }
+    }
+    index.writeToFile(dir.getChildFile(indexFileName), "");
+}
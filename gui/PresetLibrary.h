@@ -0,0 +1,92 @@
+/*
+  ==============================================================================
+
+    PresetLibrary.h
+    Created: 15 Oct 2026 5:46:09am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef PRESETLIBRARY_H_INCLUDED
+#define PRESETLIBRARY_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "PatchLoader.h"
+#include "PresetBank.h"
+#include "BackgroundJobs.h"
+#include <atomic>
+
+//==============================================================================
+//! PresetLibrary: index of the patch files in the preset directory, for the preset browser
+/*! The directory is scanned on the normal priority thread of BackgroundJobs. Only files whose
+    size or modification time changed since the last scan are read again, the others keep their
+    entry.
+    Name, tags and a content hash of every patch are kept in an index file in the directory, so
+    the next session starts with a complete index. The patches used last are kept parsed in
+    memory. The presets of a PresetBank in the directory, a file with the extension ".synbank",
+    are listed from its mapped index, they are not kept in the index file. All editors of the
+    process share one library.
+*/
+class PresetLibrary : private TimeSliceClient {
+public:
+    PresetLibrary();
+    ~PresetLibrary();
+
+    struct Entry {
+        File file;
+        String name;        //!< patchname of the patch, the file name without one
+        StringArray tags;   //!< comma separated tags attribute of the patch
+        int64 hash;         //!< of the file content
+        int64 size;
+        Time modified;
+        PresetBank::Ptr bank;   //!< the bank of the preset, nullptr for a patch file
+        int preset = 0;         //!< in the bank
+    };
+
+    //! \brief where the patches are saved and looked for
+    static File getDirectory();
+
+    //! \brief incremented whenever the entries change, any thread
+    int getVersion() const { return version.load(); }
+
+    //! \brief a copy of all entries sorted by name, any thread
+    void getEntries(Array<Entry>& dst) const;
+
+    //! \brief a copy of the parsed patch if it is cached, nullptr otherwise, in which case it is cached for the next time
+    XmlElement* createCachedPatch(const File& file);
+
+    static const int scanInterval = 3000;   //!< ms between two scans of the directory
+    static const int maxCachedPatches = 16;
+
+private:
+    //! scans the directory, then parses the files asked for
+    int useTimeSlice() override;
+    void scan();
+    void readIndex();
+    void writeIndex() const;
+    //! \brief fills name, tags and hash from the file, false if it is no patch
+    static bool readEntry(const File& file, Entry& e, XmlElement** parsed);
+    //! \brief an entry for every preset of the bank
+    static void addBankEntries(PresetBank* bank, int64 size, Time modified, Array<Entry>& dst);
+    void addToCache(const File& file, XmlElement* patch);
+
+    SharedResourcePointer<BackgroundJobs> jobs;
+
+    CriticalSection lock;   //!< guards entries and the cache
+    Array<Entry> entries;
+    std::atomic<int> version;
+    bool indexRead;
+    uint32 lastScan;
+
+    struct CachedPatch {
+        File file;
+        ScopedPointer<XmlElement> patch;
+    };
+    OwnedArray<CachedPatch> cache;   //!< most recently used first
+    Array<File> toCache;
+
+    JUCE_DECLARE_NON_COPYABLE(PresetLibrary)
+};
+
+#endif  // PRESETLIBRARY_H_INCLUDED
@@ -0,0 +1,397 @@
+/*
+  ==============================================================================
+
+    PresetPreview.cpp
+    Created: 17 Oct 2026 10:31:48pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "PresetPreview.h"
+#include "PluginProcessor.h"
+
+namespace {
+    //! part of every key, a change of the snippet renders all presets again
+    const int renderVersion = 1;
+}
+
+PresetPreview::PresetPreview()
+    : version(0)
+{
+    jobs->add(this, BackgroundJobs::ePriority::eLow);
+}
+
+PresetPreview::~PresetPreview()
+{
+    // waits until a running slice is done
+    jobs->remove(this);
+}
+
+File PresetPreview::getCacheDirectory()
+{
+    return PresetLibrary::getDirectory().getChildFile(".previews");
+}
+
+String PresetPreview::getKey(const PresetLibrary::Entry& e)
+{
+    // the presets of a bank have no hash of their own, a change of the bank file renders all of them again
+    const int64 hash = e.bank == nullptr ? e.hash
+        : (e.file.getFullPathName() + ":" + String(e.size) + ":" + String(e.modified.toMilliseconds()) + ":" + String(e.preset)).hashCode64();
+    return String::toHexString(hash) + "-" + String(renderVersion);
+}
+
+PresetPreview::Preview::Ptr PresetPreview::getPreview(const PresetLibrary::Entry& e)
+{
+    const String key = getKey(e);
+    bool wake = false;
+    {
+        const ScopedLock sl(lock);
+        if (previews.contains(key)) {
+            previewKeys.removeString(key);
+            previewKeys.add(key);
+            return previews[key];
+        }
+        // asked for again, it moves to the front
+        const int r = requestKeys.indexOf(key);
+        if (r >= 0) {
+            requestKeys.remove(r);
+            requests.remove(r);
+        }
+        requestKeys.add(key);
+        requests.add(e);
+        wake = true;
+    }
+    if (wake) {
+        jobs->wake(this);
+    }
+    return nullptr;
+}
+
+PresetPreview::Preview::Ptr PresetPreview::findPreview(const PresetLibrary::Entry& e)
+{
+    const String key = getKey(e);
+    const ScopedLock sl(lock);
+    return previews[key];
+}
+
+int PresetPreview::useTimeSlice()
+{
+    if (render == nullptr) {
+        startNext();
+    }
+    if (render != nullptr) {
+        continueRender();
+        return 0;
+    }
+    const ScopedLock sl(lock);
+    return requests.size() > 0 ? 0 : 500;
+}
+
+void PresetPreview::startNext()
+{
+    PresetLibrary::Entry e;
+    String key;
+    {
+        const ScopedLock sl(lock);
+        if (requests.size() == 0) {
+            return;
+        }
+        e = requests.getLast();
+        key = requestKeys[requestKeys.size() - 1];
+        requests.removeLast();
+        requestKeys.remove(requestKeys.size() - 1);
+    }
+
+    const File cached = getCacheDirectory().getChildFile(key + ".wav");
+    if (AuditionPlayer::Snippet* snippet = readSnippet(cached)) {
+        finish(key, snippet);
+        return;
+    }
+
+    PluginAudioProcessor* processor = createProcessor(e);
+    if (processor == nullptr) {
+        // an empty preview, the browser does not ask again
+        finish(key, nullptr);
+        return;
+    }
+
+    render = new Render();
+    render->entry = e;
+    render->key = key;
+    render->processor = processor;
+    render->snippet = new AuditionPlayer::Snippet();
+    render->snippet->sampleRate = sampleRate;
+    render->position = 0;
+    render->noteOnSample = roundToInt(preRollSeconds * sampleRate);
+    render->noteOffSample = render->noteOnSample + roundToInt(noteSeconds * sampleRate);
+    render->numSamples = render->noteOffSample + roundToInt(tailSeconds * sampleRate);
+    render->snippet->audio.setSize(2, render->numSamples - render->noteOnSample);
+    render->snippet->audio.clear();
+}
+
+PluginAudioProcessor* PresetPreview::createProcessor(const PresetLibrary::Entry& e)
+{
+    ScopedPointer<PluginAudioProcessor> p(new PluginAudioProcessor());
+    // quick and without a deadline, the realtime tier sounds like the preset does in the instance
+    p->offlineQuality.setStep(eOnOffToggle::eOff);
+    p->cpuVoiceLimit.setStep(eOnOffToggle::eOff);
+
+    // like the engine library, the params the preset leaves out get their default
+    p->applyPatch(p->getDefaultPatch());
+
+    PatchValues values;
+    values.values.resize(p->serializeParams.size());
+
+    if (e.bank != nullptr) {
+        if (!e.bank->readPreset(e.preset, *p, values)) {
+            return nullptr;
+        }
+    } else {
+        ScopedPointer<XmlElement> patch = XmlDocument::parse(e.file);
+        if (patch == nullptr || patch->getTagName() != "patch") {
+            return nullptr;
+        }
+        p->parsePatch(*patch, eSerializationParams::eAll, values);
+    }
+    p->applyPatch(values);
+
+    p->setPlayConfigDetails(0, 2, sampleRate, blockSize);
+    p->setNonRealtime(true);
+    p->prepareToPlay(sampleRate, blockSize);
+    return p.release();
+}
+
+void PresetPreview::continueRender()
+{
+    Render& r = *render;
+    AudioSampleBuffer block(2, blockSize);
+    MidiBuffer midi;
+    for (int b = 0; b < blocksPerSlice && r.position < r.numSamples; ++b) {
+        const int n = jmin(blockSize, r.numSamples - r.position);
+        block.setSize(2, n, false, false, true);
+        block.clear();
+        midi.clear();
+        if (r.noteOnSample >= r.position && r.noteOnSample < r.position + n) {
+            midi.addEvent(MidiMessage::noteOn(1, note, velocity), r.noteOnSample - r.position);
+        }
+        if (r.noteOffSample >= r.position && r.noteOffSample < r.position + n) {
+            midi.addEvent(MidiMessage::noteOff(1, note), r.noteOffSample - r.position);
+        }
+        r.processor->processBlock(block, midi);
+
+        // the pre-roll is not part of the snippet
+        const int from = jmax(r.position, r.noteOnSample);
+        if (from < r.position + n) {
+            for (int c = 0; c < 2; ++c) {
+                r.snippet->audio.copyFrom(c, from - r.noteOnSample, block, c, from - r.position, r.position + n - from);
+            }
+        }
+        r.position += n;
+    }
+
+    if (r.position >= r.numSamples) {
+        r.processor->releaseResources();
+        r.processor = nullptr;
+        const File cached = getCacheDirectory().getChildFile(r.key + ".wav");
+        if (getCacheDirectory().createDirectory().wasOk()) {
+            writeSnippet(cached, *r.snippet);
+        }
+        finish(r.key, r.snippet.get());
+        render = nullptr;
+    }
+}
+
+void PresetPreview::finish(const String& key, AuditionPlayer::Snippet* snippet)
+{
+    Preview::Ptr preview = new Preview();
+    preview->snippet = snippet;
+    preview->thumbnail = createThumbnail(snippet != nullptr ? snippet->audio : AudioSampleBuffer());
+    {
+        const ScopedLock sl(lock);
+        previews.set(key, preview);
+        previewKeys.removeString(key);
+        previewKeys.add(key);
+        while (previewKeys.size() > maxPreviews) {
+            previews.remove(previewKeys[0]);
+            previewKeys.remove(0);
+        }
+    }
+    ++version;
+}
+
+Image PresetPreview::createThumbnail(const AudioSampleBuffer& audio)
+{
+    // a software image, it is drawn on this thread
+    Image image(Image::ARGB, thumbnailWidth, thumbnailHeight, true, SoftwareImageType());
+    const int length = audio.getNumSamples();
+    if (length == 0) {
+        return image;
+    }
+
+    Graphics g(image);
+    g.setColour(Colours::white.withAlpha(.8f));
+    const float middle = thumbnailHeight * .5f;
+    for (int x = 0; x < thumbnailWidth; ++x) {
+        const int start = length * x / thumbnailWidth;
+        const int end = jmax(start + 1, length * (x + 1) / thumbnailWidth);
+        float peak = 0.f;
+        for (int c = 0; c < audio.getNumChannels(); ++c) {
+            peak = jmax(peak, audio.getMagnitude(c, start, end - start));
+        }
+        const float h = jmax(.5f, jmin(1.f, peak) * middle);
+        g.fillRect(static_cast<float>(x), middle - h, 1.f, 2.f * h);
+    }
+    return image;
+}
+
+AuditionPlayer::Snippet* PresetPreview::readSnippet(const File& file)
+{
+    if (!file.existsAsFile()) {
+        return nullptr;
+    }
+    WavAudioFormat wav;
+    ScopedPointer<AudioFormatReader> reader(wav.createReaderFor(file.createInputStream(), true));
+    if (reader == nullptr || reader->lengthInSamples <= 0 || reader->lengthInSamples > static_cast<int64>(4. * sampleRate * (noteSeconds + tailSeconds))) {
+        return nullptr;
+    }
+    ScopedPointer<AuditionPlayer::Snippet> snippet(new AuditionPlayer::Snippet());
+    snippet->sampleRate = reader->sampleRate;
+    snippet->audio.setSize(2, static_cast<int>(reader->lengthInSamples));
+    reader->read(&snippet->audio, 0, static_cast<int>(reader->lengthInSamples), 0, true, true);
+    return snippet.release();
+}
+
+bool PresetPreview::writeSnippet(const File& file, const AuditionPlayer::Snippet& snippet)
+{
+    // written next to the file and moved there, a second process never reads half of it
+    const TemporaryFile temp(file);
+    WavAudioFormat wav;
+    ScopedPointer<FileOutputStream> stream(temp.getFile().createOutputStream());
+    if (stream == nullptr) {
+        return false;
+    }
+    ScopedPointer<AudioFormatWriter> writer(wav.createWriterFor(stream, snippet.sampleRate, 2, 16, StringPairArray(), 0));
+    if (writer == nullptr) {
+        return false;
+    }
+    stream.release();
+    const bool written = writer->writeFromAudioSampleBuffer(snippet.audio, 0, snippet.audio.getNumSamples());
+    writer = nullptr;
+    return written && temp.overwriteTargetFileWithTemporary();
+}
+
+//==============================================================================
+//! an item of the menu, polls for its preview and whether it is highlighted
+class PresetBrowserBox::Item : public PopupMenu::CustomComponent, private Timer {
+public:
+    Item(const PresetBrowserBox& b, int i, const String& t, bool ticked)
+        : box(b)
+        , index(i)
+        , text(t)
+        , isTicked(ticked)
+        , previewVersion(-1)
+        , highlightedSince(0)
+        , auditioning(false)
+    {
+        startTimer(50);
+    }
+
+    ~Item()
+    {
+        // the menu closed, a chosen preset is loaded instead
+        if (auditioning) {
+            box.params.audition.play(nullptr);
+        }
+    }
+
+    void getIdealSize(int& idealWidth, int& idealHeight) override
+    {
+        idealWidth = 150 + PresetPreview::thumbnailWidth;
+        idealHeight = PresetPreview::thumbnailHeight + 4;
+    }
+
+    void paint(Graphics& g) override
+    {
+        const Colour textColour = findColour(isItemHighlighted() ? PopupMenu::highlightedTextColourId : PopupMenu::textColourId);
+        if (isItemHighlighted()) {
+            g.fillAll(findColour(PopupMenu::highlightedBackgroundColourId));
+        }
+
+        Rectangle<int> r(getLocalBounds().reduced(4, 0));
+        if (preview != nullptr) {
+            const Rectangle<int> thumb(r.removeFromRight(PresetPreview::thumbnailWidth).withSizeKeepingCentre(PresetPreview::thumbnailWidth, PresetPreview::thumbnailHeight));
+            g.setOpacity(isItemHighlighted() ? 1.f : .7f);
+            g.drawImageAt(preview->thumbnail, thumb.getX(), thumb.getY());
+        }
+        g.setColour(textColour);
+        g.setFont(Font(static_cast<float>(getHeight()) * .6f, isTicked ? Font::bold : Font::plain));
+        g.drawFittedText(text, r.withTrimmedRight(4), Justification::centredLeft, 1);
+    }
+
+private:
+    void timerCallback() override
+    {
+        // the library changed while the menu is open
+        if (!isPositiveAndBelow(index, box.entries.size())) {
+            return;
+        }
+        if (preview == nullptr && box.previews->getVersion() != previewVersion) {
+            previewVersion = box.previews->getVersion();
+            preview = box.previews->findPreview(box.entries.getReference(index));
+            if (preview != nullptr) {
+                repaint();
+            }
+        }
+
+        if (!isItemHighlighted()) {
+            highlightedSince = 0;
+            if (auditioning) {
+                auditioning = false;
+                box.params.audition.play(nullptr);
+            }
+            return;
+        }
+        const uint32 now = Time::getMillisecondCounter();
+        if (highlightedSince == 0) {
+            highlightedSince = now;
+        }
+        if (!auditioning && preview != nullptr && preview->snippet != nullptr && now - highlightedSince >= auditionDelay) {
+            auditioning = true;
+            box.params.audition.play(preview->snippet);
+        }
+    }
+
+    const PresetBrowserBox& box;
+    const int index;
+    const String text;
+    const bool isTicked;
+    PresetPreview::Preview::Ptr preview;
+    int previewVersion;
+    uint32 highlightedSince;    //!< ms counter, 0 while not highlighted
+    bool auditioning;
+};
+
+PresetBrowserBox::PresetBrowserBox(const String& name, SynthParams& p, const Array<PresetLibrary::Entry>& e)
+    : ComboBox(name)
+    , params(p)
+    , entries(e)
+{
+}
+
+void PresetBrowserBox::addItemsToMenu(PopupMenu& menu) const
+{
+    // the last request is rendered first
+    for (int i = entries.size(); --i >= 0;) {
+        previews->getPreview(entries.getReference(i));
+    }
+    const int selectedId = getSelectedId();
+    for (int i = 0; i < getNumItems(); ++i) {
+        const int id = getItemId(i);
+        if (isPositiveAndBelow(id - 1, entries.size())) {
+            menu.addCustomItem(id, new Item(*this, id - 1, getItemText(i), id == selectedId));
+        } else {
+            menu.addItem(id, getItemText(i), true, id == selectedId);
+        }
+    }
+}
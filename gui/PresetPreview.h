@@ -0,0 +1,138 @@
+/*
+  ==============================================================================
+
+    PresetPreview.h
+    Created: 17 Oct 2026 10:31:48pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef PRESETPREVIEW_H_INCLUDED
+#define PRESETPREVIEW_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "PresetLibrary.h"
+#include "SynthParams.h"
+
+class PluginAudioProcessor;
+
+//==============================================================================
+//! PresetPreview: a waveform thumbnail and an audition snippet of every preset of the browser
+/*! A preview is rendered on the low priority thread of BackgroundJobs by a processor of its own,
+    which plays a note of the preset and is deleted afterwards, so the instances and what they
+    play are never touched. The render is split over many slices, every slice renders a few
+    blocks, so the scopes on the same thread keep their rate. The snippets are kept as WAV files
+    in a directory below the preset directory, named by the content hash of the patch, so a
+    preset is rendered once and again only after it changed. The previews used last are kept in
+    memory. The previews are asked for in the order the browser shows them, the last request is
+    rendered first. All editors of the process share one PresetPreview.
+*/
+class PresetPreview : private TimeSliceClient {
+public:
+    PresetPreview();
+    ~PresetPreview();
+
+    //! a rendered preset
+    class Preview : public ReferenceCountedObject {
+    public:
+        typedef ReferenceCountedObjectPtr<Preview> Ptr;
+        Image thumbnail;                        //!< peaks of the snippet, thumbnailWidth x thumbnailHeight
+        AuditionPlayer::Snippet::Ptr snippet;
+    };
+
+    //! \brief message thread: the preview of the entry if it is ready, nullptr otherwise, in which case it is rendered next
+    Preview::Ptr getPreview(const PresetLibrary::Entry& e);
+    //! \brief message thread: like getPreview() without asking for the render
+    Preview::Ptr findPreview(const PresetLibrary::Entry& e);
+
+    //! \brief incremented whenever a preview is ready, any thread
+    int getVersion() const { return version.load(); }
+
+    //! \brief where the snippets are cached
+    static File getCacheDirectory();
+
+    static const int thumbnailWidth = 72;
+    static const int thumbnailHeight = 20;
+    static const int maxPreviews = 64;          //!< kept in memory
+
+    //! \name the snippet
+    ///@{
+    constexpr static double sampleRate = 44100.;
+    static const int blockSize = 512;
+    static const int note = 60;
+    constexpr static float velocity = .8f;
+    constexpr static double preRollSeconds = .1;   //!< silence before the note, the effects allocate their buffers
+    constexpr static double noteSeconds = 1.;
+    constexpr static double tailSeconds = .75;     //!< after the note off
+    static const int blocksPerSlice = 8;
+    ///@}
+
+private:
+    //! the render of one preset, across slices
+    struct Render {
+        PresetLibrary::Entry entry;
+        String key;
+        ScopedPointer<PluginAudioProcessor> processor;
+        AuditionPlayer::Snippet::Ptr snippet;
+        int position;           //!< samples rendered, the pre-roll included
+        int noteOnSample;
+        int noteOffSample;
+        int numSamples;         //!< of the whole render
+    };
+
+    int useTimeSlice() override;
+    //! \brief the next request, from the cache file if there is one, otherwise its render is started
+    void startNext();
+    //! \brief renders the next blocks of the current render, finishes it after the last one
+    void continueRender();
+    //! \brief a processor with the preset loaded, nullptr if the preset cannot be read
+    static PluginAudioProcessor* createProcessor(const PresetLibrary::Entry& e);
+    void finish(const String& key, AuditionPlayer::Snippet* snippet);
+    static Image createThumbnail(const AudioSampleBuffer& audio);
+    //! \brief the name of the cache file of the entry, from its content hash
+    static String getKey(const PresetLibrary::Entry& e);
+    static AuditionPlayer::Snippet* readSnippet(const File& file);
+    static bool writeSnippet(const File& file, const AuditionPlayer::Snippet& snippet);
+
+    SharedResourcePointer<BackgroundJobs> jobs;
+
+    CriticalSection lock;   //!< guards requests and previews
+    Array<PresetLibrary::Entry> requests;   //!< the last one first
+    StringArray requestKeys;
+    HashMap<String, Preview::Ptr> previews;
+    StringArray previewKeys;                //!< most recently used last
+    std::atomic<int> version;
+
+    ScopedPointer<Render> render;           //!< background thread only
+
+    JUCE_DECLARE_NON_COPYABLE(PresetPreview)
+};
+
+//==============================================================================
+//! PresetBrowserBox: the preset browser, every item of its menu shows the thumbnail of its preset
+/*! Opening the menu asks for the previews of all items, the first item is rendered first. An
+    item that stays highlighted for auditionDelay ms plays its snippet through the AuditionPlayer
+    of the instance, until another item is highlighted or the menu closes. Selecting an item
+    loads the preset as before.
+*/
+class PresetBrowserBox : public ComboBox {
+public:
+    //! \brief the items are the entries, item id = index + 1
+    PresetBrowserBox(const String& name, SynthParams& p, const Array<PresetLibrary::Entry>& e);
+
+    static const int auditionDelay = 400;   //!< ms an item is highlighted before it plays
+
+private:
+    class Item;
+
+    void addItemsToMenu(PopupMenu& menu) const override;
+
+    SynthParams& params;
+    const Array<PresetLibrary::Entry>& entries;
+    SharedResourcePointer<PresetPreview> previews;
+
+    JUCE_DECLARE_NON_COPYABLE(PresetBrowserBox)
+};
+
+#endif  // PRESETPREVIEW_H_INCLUDED
@@ -0,0 +1,82 @@
+/*
+  ==============================================================================
+
+    TextImageCache.cpp
+    Created: 16 Oct 2026 8:21:03pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "TextImageCache.h"
+#include <tuple>
+
+bool TextImageCache::Key::operator< (const Key& other) const
+{
+    return std::tie(height, width, areaHeight, scale, style, horizontalScale, justification, maxLines, minScale, text, typeface)
+        < std::tie(other.height, other.width, other.areaHeight, other.scale, other.style, other.horizontalScale,
+                   other.justification, other.maxLines, other.minScale, other.text, other.typeface);
+}
+
+void TextImageCache::drawText(Graphics& g, const String& text, const Font& font, const Rectangle<int>& area, Justification justification)
+{
+    draw(g, text, font, area, justification, 0, 1.f);
+}
+
+void TextImageCache::drawFittedText(Graphics& g, const String& text, const Font& font, const Rectangle<int>& area,
+                                    Justification justification, int maximumNumberOfLines, float minimumHorizontalScale)
+{
+    draw(g, text, font, area, justification, jmax(1, maximumNumberOfLines), minimumHorizontalScale);
+}
+
+void TextImageCache::draw(Graphics& g, const String& text, const Font& font, const Rectangle<int>& area,
+                          Justification justification, int maximumNumberOfLines, float minimumHorizontalScale)
+{
+    if (text.isEmpty() || area.isEmpty() || !g.clipRegionIntersects(area.expanded(margin))) {
+        return;
+    }
+
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const Key key = {
+        text, font.getTypefaceName(), font.getStyleFlags(), roundToInt(font.getHeight() * 100.f),
+        roundToInt(font.getHorizontalScale() * 1000.f), area.getWidth(), area.getHeight(), justification.getFlags(),
+        maximumNumberOfLines, roundToInt(minimumHorizontalScale * 1000.f), roundToInt(scale * 100.f)
+    };
+
+    auto it = images.find(key);
+    if (it == images.end()) {
+        const Image image = render(key, text, font, area, justification, scale);
+        const int64 imageBytes = static_cast<int64>(image.getWidth()) * image.getHeight();
+        if (bytes + imageBytes > maxBytes) {
+            images.clear();
+            bytes = 0;
+        }
+        bytes += imageBytes;
+        it = images.emplace(key, image).first;
+    }
+
+    // the mask has physical pixels, it is filled with the colour of g
+    const Image& image = it->second;
+    g.drawImageTransformed(image, AffineTransform::scale(1.f / scale).translated(static_cast<float>(area.getX() - margin),
+                                                                                  static_cast<float>(area.getY() - margin)), true);
+}
+
+Image TextImageCache::render(const Key& key, const String& text, const Font& font, const Rectangle<int>& area,
+                             Justification justification, float scale)
+{
+    const int width = jmax(1, static_cast<int>(std::ceil((area.getWidth() + 2 * margin) * scale)));
+    const int height = jmax(1, static_cast<int>(std::ceil((area.getHeight() + 2 * margin) * scale)));
+    Image image(Image::SingleChannel, width, height, true);
+
+    Graphics g(image);
+    g.addTransform(AffineTransform::scale(scale));
+    g.setColour(Colours::white);
+    g.setFont(font);
+    const Rectangle<int> local(margin, margin, area.getWidth(), area.getHeight());
+    if (key.maxLines == 0) {
+        g.drawText(text, local, justification, true);
+    } else {
+        g.drawFittedText(text, local, justification, key.maxLines, static_cast<float>(key.minScale) / 1000.f);
+    }
+    return image;
+}
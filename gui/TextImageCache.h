@@ -0,0 +1,69 @@
+/*
+  ==============================================================================
+
+    TextImageCache.h
+    Created: 16 Oct 2026 8:21:03pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef TEXTIMAGECACHE_H_INCLUDED
+#define TEXTIMAGECACHE_H_INCLUDED
+
+#include "JuceHeader.h"
+#include <map>
+
+//==============================================================================
+//! TextImageCache: laid out and rasterised strings of the editor text, shared by all editors of the process
+/*! Graphics::drawText() lays out the glyphs of a string and fills their outlines on every call,
+    also for a value label that repaints with every automation step. Here a string is laid out
+    and rendered once per font, size, area, justification and physical pixel scale into an
+    alpha mask, and a repaint is an image blit in the current colour. The cache starts over when
+    the masks would exceed maxBytes. Reached through CustomLookAndFeel::getTextCache().
+    Message thread only.
+*/
+class TextImageCache {
+public:
+    //! \brief like Graphics::drawText(), one line cut with an ellipsis, in the current colour of g
+    void drawText(Graphics& g, const String& text, const Font& font, const Rectangle<int>& area, Justification justification);
+    //! \brief like Graphics::drawFittedText(), in the current colour of g
+    void drawFittedText(Graphics& g, const String& text, const Font& font, const Rectangle<int>& area,
+                        Justification justification, int maximumNumberOfLines, float minimumHorizontalScale = .7f);
+
+    //! \brief pixel bytes of the masks rendered so far
+    int64 getMemoryBytes() const { return bytes; }
+
+    //! masks kept, the strings of a few editors with some history of values
+    static const int64 maxBytes = 4 << 20;
+    //! logical pixels around the area, for glyphs that reach over its edges
+    static const int margin = 2;
+
+private:
+    struct Key {
+        String text;
+        String typeface;
+        int style;          //!< Font::FontStyleFlags
+        int height;         //!< hundredths of a pixel
+        int horizontalScale;    //!< permille
+        int width;
+        int areaHeight;
+        int justification;
+        int maxLines;       //!< 0 for one line of drawText()
+        int minScale;       //!< permille
+        int scale;          //!< percent
+
+        bool operator< (const Key& other) const;
+    };
+
+    void draw(Graphics& g, const String& text, const Font& font, const Rectangle<int>& area,
+              Justification justification, int maximumNumberOfLines, float minimumHorizontalScale);
+    //! \brief renders the mask of the text, the area at the margin
+    static Image render(const Key& key, const String& text, const Font& font, const Rectangle<int>& area,
+                        Justification justification, float scale);
+
+    std::map<Key, Image> images;
+    int64 bytes = 0;
+};
+
+#endif  // TEXTIMAGECACHE_H_INCLUDED
@@ -2,74 +2,97 @@
 #include "Oscillator.h"
 
 void WaveformVisual::paint(Graphics &g)
+{
+    if (!pathsValid) {
+        updateImage();
+    }
+    if (!image.draw(g)) {
+        g.fillAll(SynthParams::waveformBackground.withAlpha(1.f));
+    }
+}
+
+void WaveformVisual::updateImage()
+{
+    // only calculate new noise if waveform changed otherwise it always recalculates a different noise which can lead to bad behaviour on GUI
+    if (m_iWaveformKey == eOscWaves::eOscNoise && needNewNoise) {
+        noise.resize(static_cast<size_t>(jmax(0, getWidth())));
+        for (float& n : noise) {
+            n = noiseGenerator.nextFloat();
+        }
+        needNewNoise = false;
+    }
+
+    const eOscWaves key = m_iWaveformKey;
+    const float pulseWidth = m_fPulseWidth;
+    const float trngAmount = m_fTrngAmount;
+    const std::vector<float> n = key == eOscWaves::eOscNoise ? noise : std::vector<float>();
+    // the copy of the pointer keeps the tables alive while the painter is queued
+    const SharedWavetables tables = wavetables;
+    image.update([=](Graphics& g, int width, int height) {
+        paintWave(g, width, height, key, pulseWidth, trngAmount, n, *tables);
+    });
+    pathsValid = true;
+}
+
+void WaveformVisual::paintWave(Graphics& g, int width, int height, eOscWaves key, float pulseWidth, float trngAmount,
+                               const std::vector<float>& noise, const Wavetables& tables)
 {
     FillType backgroundFill = FillType(SynthParams::waveformBackground);
     backgroundFill.setOpacity(1.0f);
     g.setFillType(backgroundFill);
     g.fillAll();
 
-	const int width = getWidth();
-
-	Path grid;
-	//grid.startNewSubPath(0.0f, static_cast<float>(getHeight()/2));
-	//grid.lineTo(width, static_cast<float>(getHeight() / 2));
-
-	grid.addLineSegment(Line< float >::Line(0.f, static_cast<float>(getHeight() / 2), width, static_cast<float>(getHeight() / 2)), 1.f);
-	grid.addLineSegment(Line< float >::Line(static_cast<float>(width / 2), 0, static_cast<float>(width / 2), static_cast<float>(getHeight())), 1.f);
-	grid.addLineSegment(Line< float >::Line(static_cast<float>(width / 4), 0, static_cast<float>(width / 4), static_cast<float>(getHeight())), 1.f);
-	grid.addLineSegment(Line< float >::Line(static_cast<float>(width * 3 / 4), 0, static_cast<float>(width * 3 / 4), static_cast<float>(getHeight())), 1.f);
-
-	g.setColour(SynthParams::oscColour);
-	g.setOpacity(.4f);
-	g.strokePath(grid, PathStrokeType(1.f));
+    Path grid;
+    grid.addLineSegment(Line< float >::Line(0.f, static_cast<float>(height / 2), width, static_cast<float>(height / 2)), 1.f);
+    grid.addLineSegment(Line< float >::Line(static_cast<float>(width / 2), 0, static_cast<float>(width / 2), static_cast<float>(height)), 1.f);
+    grid.addLineSegment(Line< float >::Line(static_cast<float>(width / 4), 0, static_cast<float>(width / 4), static_cast<float>(height)), 1.f);
+    grid.addLineSegment(Line< float >::Line(static_cast<float>(width * 3 / 4), 0, static_cast<float>(width * 3 / 4), static_cast<float>(height)), 1.f);
 
     Path wavePath;
-    const float centreY = getHeight() / 2.0f;
+    const float centreY = height / 2.0f;
     const float amplitude = 0.4f;
-    const float step = 4*float_Pi / width;
+    const float step = 2.f / width;
     wavePath.startNewSubPath(0, centreY);
 
-    for (int x = 0; x < width; ++x) {
-
-        float phs = static_cast<float>(x) * step;
-        if (phs > (2 * float_Pi))
-            phs = phs - (2 * float_Pi);
-
-        switch (m_iWaveformKey)
-        {
-            case eOscWaves::eOscSquare:
-                wavePath.lineTo(static_cast<float>(x), centreY - amplitude * static_cast<float>(getHeight()) * Waveforms::square(phs, m_fTrngAmount, m_fPulseWidth));
-                break;
-
-            case eOscWaves::eOscSaw:
-                wavePath.lineTo(static_cast<float>(x), centreY - amplitude * static_cast<float>(getHeight()) * Waveforms::saw(phs, m_fTrngAmount, m_fPulseWidth));
-                break;
-
-            case eOscWaves::eOscNoise:
-
-                // only calculate new noise if waveform changed otherwise it always recalculates a different noise which can lead to bad behaviour on GUI
-                if (!needNewNoise) {
-                    wavePath = Path(noise);
-
-                } else {
-                    if (x == 0) {
-                        noise.clear();
-                    }
-                    noise.lineTo(static_cast<float>(x), centreY - amplitude * static_cast<float>(getHeight()) * Waveforms::whiteNoise(0.0f, 0.0f, 0.0f));
-
-                    if (x == width - 1) {
-                        wavePath = Path(noise);
-                        needNewNoise = false;
-                    }
-                }
-                break;
-
+    if (key == eOscWaves::eOscNoise) {
+        for (size_t x = 0; x < noise.size(); ++x) {
+            wavePath.lineTo(static_cast<float>(x), centreY - amplitude * static_cast<float>(height) * noise[x]);
+        }
+    } else {
+        for (int x = 0; x < width; ++x) {
+
+            float phs = static_cast<float>(x) * step;
+            if (phs >= 1.f)
+                phs = phs - 1.f;
+
+            switch (key)
+            {
+                case eOscWaves::eOscSquare:
+                    wavePath.lineTo(static_cast<float>(x), centreY - amplitude * static_cast<float>(height) * Waveforms::square(phs, trngAmount, pulseWidth));
+                    break;
+
+                case eOscWaves::eOscSaw:
+                    wavePath.lineTo(static_cast<float>(x), centreY - amplitude * static_cast<float>(height) * Waveforms::saw(phs, trngAmount, pulseWidth));
+                    break;
+
+                case eOscWaves::eOscWavetable:
+                    wavePath.lineTo(static_cast<float>(x), centreY - amplitude * static_cast<float>(height) * tables.lookup(phs, trngAmount, 0.f));
+                    break;
+
+                default:
+                    break;
+            }
         }
     }
 
+	g.setColour(SynthParams::oscColour);
+	g.setOpacity(.4f);
+	g.strokePath(grid, PathStrokeType(1.f));
+
     g.setColour(SynthParams::waveformLine);
     g.strokePath(wavePath, PathStrokeType(2.5f));
-    g.drawRect(getLocalBounds(), 3);
+    const Rectangle<int> bounds(0, 0, width, height);
+    g.drawRect(bounds, 3);
     g.setColour(Colours::darkgrey);
-    g.drawRect(getLocalBounds(), 1);
+    g.drawRect(bounds, 1);
 }
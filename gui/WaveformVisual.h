@@ -4,6 +4,10 @@
 //[Headers]
 #include "JuceHeader.h"
 #include "SynthParams.h"
+#include "Wavetable.h"
+#include "FastRandom.h"
+#include "BackgroundImage.h"
+#include <vector>
 //[/Headers]
 
 class WaveformVisual : public Component
@@ -15,23 +19,40 @@ public:
         : m_iWaveformKey(waveformKey)
         , m_fPulseWidth(pulseWidth)
         , m_fTrngAmount(trngAmount)
+        , image(*this)
     {
     }
 
-    void setWaveformKey(eOscWaves waveformKey) { m_iWaveformKey = waveformKey; needNewNoise = true; repaint(); }
-    void setPulseWidth(float pulseWidth) { m_fPulseWidth = pulseWidth; repaint(); }
-    void setTrngAmount(float trngAmount) { m_fTrngAmount = trngAmount; repaint(); }
+    // the paths are only generated again if a value or the size changed
+    void setWaveformKey(eOscWaves waveformKey) { if (waveformKey != m_iWaveformKey) { m_iWaveformKey = waveformKey; needNewNoise = true; invalidatePaths(); } }
+    void setPulseWidth(float pulseWidth) { if (pulseWidth != m_fPulseWidth) { m_fPulseWidth = pulseWidth; invalidatePaths(); } }
+    void setTrngAmount(float trngAmount) { if (trngAmount != m_fTrngAmount) { m_fTrngAmount = trngAmount; invalidatePaths(); } }
 
 protected:
     void paint(Graphics &g);
+    void resized() override { needNewNoise = true; pathsValid = false; }
 
 private:
+    void invalidatePaths() { pathsValid = false; repaint(); }
+    //! hands a painter of the current values to the image
+    void updateImage();
+    //! \brief render thread: background, grid, wave and border for the given values and size
+    static void paintWave(Graphics& g, int width, int height, eOscWaves key, float pulseWidth, float trngAmount,
+                          const std::vector<float>& noise, const Wavetables& tables);
+
     eOscWaves m_iWaveformKey;
     float m_fPulseWidth;
     float m_fTrngAmount;
 
-    Path noise;
+    bool pathsValid = false;
+
+    //! one value per pixel, kept while the waveform stays noise
+    std::vector<float> noise;
     bool needNewNoise = true;
+    FastRandom noiseGenerator;
+
+    SharedWavetables wavetables;
+    BackgroundImage image;
 };
 
 
@@ -32,6 +32,7 @@ FiltPanel::FiltPanel (SynthParams &p, int filterNumber)
       filter(p.filter[filterNumber])
 {
     //[Constructor_pre] You can add your own custom stuff here..
+    addAndMakeVisible(response = new FilterResponse(p, filter));
     //[/Constructor_pre]
 
     addAndMakeVisible (cutoffSlider = new MouseOverKnob ("Cutoff"));
@@ -254,6 +255,7 @@ FiltPanel::FiltPanel (SynthParams &p, int filterNumber)
 FiltPanel::~FiltPanel()
 {
     //[Destructor_pre]. You can add your own custom destruction code here..
+    response = nullptr;
     //[/Destructor_pre]
 
     cutoffSlider = nullptr;
@@ -333,6 +335,7 @@ void FiltPanel::resized()
     resModAmount2->setBounds (311, 119, 18, 18);
     onOffSwitch->setBounds (33, 1, 40, 30);
     //[UserResized] Add your own custom resize handling here..
+    response->setBounds(120, 30, 265, 112);
     //[/UserResized]
 }
 
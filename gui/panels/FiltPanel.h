@@ -23,6 +23,7 @@
 //[Headers]     -- You can add your own extra header files here --
 #include "JuceHeader.h"
 #include "PanelBase.h"
+#include "FilterResponse.h"
 //[/Headers]
 
 
@@ -61,6 +62,7 @@ public:
 private:
     //[UserVariables]   -- You can add your own custom variables in this section.
     SynthParams::Filter& filter;
+    ScopedPointer<FilterResponse> response; //!< drawn behind the knobs
     //[/UserVariables]
 
     //==============================================================================
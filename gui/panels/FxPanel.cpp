@@ -142,6 +142,12 @@ FxPanel::FxPanel (SynthParams &p)
     registerToggle(tripTggl, &params.delayTriplet);
     registerToggle(dottedNotes, &params.delayDottedLength);
 
+    addAndMakeVisible(pingPongTggl = new ToggleButton("pingPongTggl"));
+    pingPongTggl->setButtonText("ping-pong");
+    pingPongTggl->addListener(this);
+    pingPongTggl->setColour(ToggleButton::textColourId, Colours::white);
+    registerToggle(pingPongTggl, &params.delayPingPong);
+
     registerNoteLength(divisor, &params.delayDivisor, &params.delayDividend);
 
     onOffSwitchChanged();
@@ -151,35 +157,27 @@ FxPanel::FxPanel (SynthParams &p)
 
 
     //[Constructor] You can add your own custom stuff here..
-    syncPic = ImageCache::getFromMemory(BinaryData::tempoSync_png, BinaryData::tempoSync_pngSize);
-    tripletPic = ImageCache::getFromMemory(BinaryData::triplets_png, BinaryData::triplets_pngSize);
-    dotPic = ImageCache::getFromMemory(BinaryData::dottedNote_png, BinaryData::dottedNote_pngSize);
-    reversePic = ImageCache::getFromMemory(BinaryData::delayReverse_png, BinaryData::delayReverse_pngSize);
-    recordPic = ImageCache::getFromMemory(BinaryData::recordCutoff_png, BinaryData::recordCutoff_pngSize);
-
-    syncPicOff = ImageCache::getFromMemory(BinaryData::tempoSync_png, BinaryData::tempoSync_pngSize);
-    tripletPicOff = ImageCache::getFromMemory(BinaryData::triplets_png, BinaryData::triplets_pngSize);
-    dotPicOff = ImageCache::getFromMemory(BinaryData::dottedNote_png, BinaryData::dottedNote_pngSize);
-    reversePicOff = ImageCache::getFromMemory(BinaryData::delayReverse_png, BinaryData::delayReverse_pngSize);
-    recordPicOff = ImageCache::getFromMemory(BinaryData::recordCutoff_png, BinaryData::recordCutoff_pngSize);
-
-    syncPicOff.duplicateIfShared();
-    tripletPicOff.duplicateIfShared();
-    dotPicOff.duplicateIfShared();
-    reversePicOff.duplicateIfShared();
-    recordPicOff.duplicateIfShared();
-
-    syncPicOff.multiplyAllAlphas(0.5f);
-    tripletPicOff.multiplyAllAlphas(0.5f);
-    dotPicOff.multiplyAllAlphas(0.5f);
-    reversePicOff.multiplyAllAlphas(0.5f);
-    recordPicOff.multiplyAllAlphas(0.5f);
+    syncPic = resources->getImage(BinaryData::tempoSync_png, BinaryData::tempoSync_pngSize);
+    tripletPic = resources->getImage(BinaryData::triplets_png, BinaryData::triplets_pngSize);
+    dotPic = resources->getImage(BinaryData::dottedNote_png, BinaryData::dottedNote_pngSize);
+    reversePic = resources->getImage(BinaryData::delayReverse_png, BinaryData::delayReverse_pngSize);
+    recordPic = resources->getImage(BinaryData::recordCutoff_png, BinaryData::recordCutoff_pngSize);
+
+    syncPicOff = resources->getImage(BinaryData::tempoSync_png, BinaryData::tempoSync_pngSize, 0.5f);
+    tripletPicOff = resources->getImage(BinaryData::triplets_png, BinaryData::triplets_pngSize, 0.5f);
+    dotPicOff = resources->getImage(BinaryData::dottedNote_png, BinaryData::dottedNote_pngSize, 0.5f);
+    reversePicOff = resources->getImage(BinaryData::delayReverse_png, BinaryData::delayReverse_pngSize, 0.5f);
+    recordPicOff = resources->getImage(BinaryData::recordCutoff_png, BinaryData::recordCutoff_pngSize, 0.5f);
+
+    // the synced time comes from the engine, it is no param
+    startPanelTimerHz(10);
     //[/Constructor]
 }
 
 FxPanel::~FxPanel()
 {
     //[Destructor_pre]. You can add your own custom destruction code here..
+    pingPongTggl = nullptr;
     //[/Destructor_pre]
 
     feedbackSlider = nullptr;
@@ -223,6 +221,7 @@ void FxPanel::resized()
     syncToggle->setToggleState(params.delaySync.getStep() == eOnOffToggle::eOn, dontSendNotification);
     tripTggl->setToggleState(params.delayTriplet.getStep() == eOnOffToggle::eOn, dontSendNotification);
     filtTggl->setToggleState(params.delayRecordFilter.getStep() == eOnOffToggle::eOn, dontSendNotification);
+    pingPongTggl->setToggleState(params.delayPingPong.getStep() == eOnOffToggle::eOn, dontSendNotification);
     //[/UserPreResize]
 
     feedbackSlider->setBounds (173, 35, 64, 64);
@@ -237,6 +236,7 @@ void FxPanel::resized()
     onOffSwitch->setBounds (30, 1, 40, 30);
     dottedNotes->setBounds (143, 136, 65, 30);
     //[UserResized] Add your own custom resize handling here..
+    pingPongTggl->setBounds(226, 162, 90, 14);
     //[/UserResized]
 }
 
@@ -347,6 +347,17 @@ void FxPanel::updateToggleState()
     tripTggl->setEnabled(params.delaySync.getStep() == eOnOffToggle::eOn && (static_cast<int>(onOffSwitch->getValue()) == 1));
     dottedNotes->setEnabled(params.delaySync.getStep() == eOnOffToggle::eOn && (static_cast<int>(onOffSwitch->getValue()) == 1));
     divisor->setEnabled(params.delaySync.getStep() == eOnOffToggle::eOn);
+    if (params.delaySync.getStep() == eOnOffToggle::eOff) {
+        timeSlider->setValue(params.delayTime.getUI(), dontSendNotification);
+    }
+}
+
+void FxPanel::timerCallback()
+{
+    const float syncedTime = params.telemetry.display.delayTime.load(std::memory_order_relaxed);
+    if (params.delaySync.getStep() == eOnOffToggle::eOn && syncedTime > 0.f && std::abs(syncedTime - static_cast<float>(timeSlider->getValue())) > .1f) {
+        timeSlider->setValue(syncedTime, dontSendNotification);
+    }
 }
 
 void FxPanel::onOffSwitchChanged()
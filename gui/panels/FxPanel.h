@@ -50,6 +50,8 @@ public:
     //[UserMethods]     -- You can add your own custom methods in this section.
     void onOffSwitchChanged();
     void updateToggleState();
+    //! shows the synced delay time of the engine on the disabled time knob
+    void timerCallback() override;
     void drawPics(Graphics& g, ScopedPointer<ToggleButton>& syncT, ScopedPointer<ToggleButton>& tripletT, ScopedPointer<ToggleButton>& dotT,
         ScopedPointer<ToggleButton>& reverseT, ScopedPointer<ToggleButton>& recordT);
     //[/UserMethods]
@@ -67,6 +69,7 @@ private:
     Image syncPic, syncPicOff, tripletPic, tripletPicOff, dotPic, dotPicOff, reversePic, reversePicOff, recordPic, recordPicOff;
 
     ScopedPointer<FxDelay> delay;
+    ScopedPointer<ToggleButton> pingPongTggl;
     //[/UserVariables]
 
     //==============================================================================
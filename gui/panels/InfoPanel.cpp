@@ -28,7 +28,9 @@
 
 //==============================================================================
 InfoPanel::InfoPanel (SynthParams &p)
-    : PanelBase(p)
+    : PanelBase(p),
+      readingCpu(false),
+      shownIncidents(0)
 {
     //[Constructor_pre] You can add your own custom stuff here..
     //[/Constructor_pre]
@@ -69,12 +71,19 @@ InfoPanel::InfoPanel (SynthParams &p)
 
 
     //[Constructor] You can add your own custom stuff here..
+    kernelCosts = KernelCosts::load();
+    updateCostEstimate();
+    startPanelTimer(500);
     //[/Constructor]
 }
 
 InfoPanel::~InfoPanel()
 {
     //[Destructor_pre]. You can add your own custom destruction code here..
+    stopTimer();
+    if (readingCpu) {
+        params.telemetry.cpu.removeReader();
+    }
     //[/Destructor_pre]
 
     hyperlinkButton = nullptr;
@@ -102,6 +111,9 @@ void InfoPanel::paint (Graphics& g)
                                RectanglePlacement::stretchToFit, 1.000f);
 
     //[UserPaint] Add your own custom painting code here..
+    drawCpuStats(g);
+    drawMemoryStats(g);
+    drawCostEstimate(g);
     //[/UserPaint]
 }
 
@@ -123,6 +135,174 @@ void InfoPanel::resized()
 
 
 //[MiscUserCode] You can add your own definitions of your custom methods or any other code here...
+void InfoPanel::timerCallback()
+{
+    CpuMeter& cpu = params.telemetry.cpu;
+    const bool showing = isShowing();
+    if (showing != readingCpu) {
+        readingCpu = showing;
+        if (showing) {
+            cpu.addReader();
+        } else {
+            cpu.removeReader();
+        }
+    }
+    const int64 numIncidents = params.telemetry.deadlines.getNumIncidents();
+    if (showing && (cpu.update() || numIncidents != shownIncidents)) {
+        shownIncidents = numIncidents;
+        repaint(cpuArea);
+    }
+    // the fx buffers are allocated when an effect is first switched on, the knob images when drawn
+    if (showing && updateMemory()) {
+        repaint(memoryArea);
+    }
+    if (showing && updateCostEstimate()) {
+        repaint(costArea);
+    }
+}
+
+void InfoPanel::panelTimerStateChanged(bool running)
+{
+    // a collapsed section or a hidden editor does not keep the meter measuring
+    if (!running && readingCpu) {
+        readingCpu = false;
+        params.telemetry.cpu.removeReader();
+    }
+}
+
+bool InfoPanel::updateCostEstimate()
+{
+    const PatchCostEstimate e = PatchCostEstimate::estimate(params, kernelCosts);
+    const bool changed = e.voiceNs != costEstimate.voiceNs || e.fxNs != costEstimate.fxNs || e.numVoices != costEstimate.numVoices;
+    costEstimate = e;
+    return changed;
+}
+
+void InfoPanel::drawCostEstimate(Graphics& g) const
+{
+    const int rowHeight = 11;
+    const auto toPercent = [](double ns) { return String(PatchCostEstimate::getLoad(ns, liveSampleRate) * 100., 1) + " %"; };
+
+    g.setColour(Colours::black.withAlpha(0.35f));
+    g.fillRoundedRectangle(costArea.toFloat(), 4.f);
+    Rectangle<int> area = costArea.reduced(4, 3);
+    g.setFont(Font(10.f));
+
+    const auto drawRow = [&](const String& name, const String& value, Colour colour) {
+        Rectangle<int> row = area.removeFromTop(rowHeight);
+        g.setColour(colour);
+        g.drawText(name, row.removeFromLeft(90), Justification::centredLeft, false);
+        g.drawText(value, row, Justification::centredRight, false);
+    };
+    const Colour grey(0xffcccccc);
+
+    drawRow("patch estimate", kernelCosts.measured ? "measured" : "default costs", Colours::white);
+    drawRow("oscillators", String(costEstimate.numOscillators), grey);
+    drawRow("filters", String(costEstimate.numFilters), grey);
+    drawRow("mod rows", String(costEstimate.numModRows), grey);
+    drawRow("per voice", String(costEstimate.voiceNs, 0) + " ns, " + toPercent(costEstimate.voiceNs), grey);
+    drawRow("fx", String(costEstimate.numFx) + ", " + toPercent(costEstimate.fxNs), grey);
+
+    // the whole polyphony at a block of 64, the per block overhead is in the calibration
+    const double load = PatchCostEstimate::getLoad(costEstimate.getInstanceNs(), liveSampleRate);
+    drawRow(String(costEstimate.numVoices) + " voices", toPercent(costEstimate.getInstanceNs()), Colours::white);
+    const float threshold = params.telemetry.deadlines.getThreshold();
+    drawRow(String(PatchCostEstimate::liveBlockSize) + " samples, " + String(liveSampleRate / 1000., 0) + " kHz",
+            load > 1. ? "too heavy" : load > threshold ? "close" : "fits",
+            load > threshold ? Colour(0xffff8080) : grey);
+}
+
+bool InfoPanel::updateMemory()
+{
+    MemoryFootprint m = params.telemetry.getMemoryFootprint();
+    m.shared[MemoryFootprint::eEditorCaches] = knobImages->getMemoryBytes() + textImages->getMemoryBytes();
+    const bool changed = m.instance != memory.instance || m.shared != memory.shared;
+    memory = m;
+    return changed;
+}
+
+void InfoPanel::drawMemoryStats(Graphics& g) const
+{
+    // 15 rows, a little tighter than the cpu stats
+    const int rowHeight = 11;
+    const auto toKb = [](int64 bytes) { return String(static_cast<double>(bytes) / 1024., 0) + " kB"; };
+
+    g.setColour(Colours::black.withAlpha(0.35f));
+    g.fillRoundedRectangle(memoryArea.toFloat(), 4.f);
+    Rectangle<int> area = memoryArea.reduced(4, 3);
+    g.setFont(Font(10.f));
+
+    const auto drawRow = [&](const String& name, int64 bytes, bool total) {
+        Rectangle<int> row = area.removeFromTop(rowHeight);
+        g.setColour(total ? Colours::white : Colour(0xffcccccc));
+        g.drawText(name, row.removeFromLeft(90), Justification::centredLeft, false);
+        g.drawText(toKb(bytes), row, Justification::centredRight, false);
+    };
+
+    drawRow("this instance", memory.getInstanceTotal(), true);
+    for (int i = 0; i < MemoryFootprint::nInstance; ++i) {
+        const MemoryFootprint::eInstance item = static_cast<MemoryFootprint::eInstance>(i);
+        drawRow(MemoryFootprint::getName(item), memory.instance[i], false);
+    }
+    // shared by all instances of the process, the samples are mapped files
+    int64 shared = 0;
+    for (int64 bytes : memory.shared) {
+        shared += bytes;
+    }
+    drawRow("shared", shared, true);
+    for (int s = 0; s < MemoryFootprint::nShared; ++s) {
+        const MemoryFootprint::eShared item = static_cast<MemoryFootprint::eShared>(s);
+        drawRow(MemoryFootprint::getName(item), memory.shared[s], false);
+    }
+}
+
+void InfoPanel::drawCpuStats(Graphics& g) const
+{
+    const CpuStats& stats = params.telemetry.cpu.getStats();
+    if (stats.numBlocks == 0) {
+        return;
+    }
+
+    g.setColour(Colours::black.withAlpha(0.35f));
+    g.fillRoundedRectangle(cpuArea.toFloat(), 4.f);
+
+    const int rowHeight = 12;
+    const int nameWidth = 58;
+    const int valueWidth = (cpuArea.getWidth() - nameWidth - 8) / 3;
+    Rectangle<int> area = cpuArea.reduced(4, 3);
+    g.setFont(Font(10.f));
+
+    // percent of the duration of a block
+    Rectangle<int> row = area.removeFromTop(rowHeight);
+    g.setColour(Colour(0xffcccccc));
+    g.drawText("cpu %", row.removeFromLeft(nameWidth), Justification::centredLeft, false);
+    g.drawText("mean", row.removeFromLeft(valueWidth), Justification::centredRight, false);
+    g.drawText("p99", row.removeFromLeft(valueWidth), Justification::centredRight, false);
+    g.drawText("max", row.removeFromLeft(valueWidth), Justification::centredRight, false);
+
+    for (int s = 0; s < CpuStats::numStages; ++s) {
+        const eCpuStage stage = static_cast<eCpuStage>(s);
+        row = area.removeFromTop(rowHeight);
+        g.setColour(stage == eCpuStage::eTotal ? Colours::white : Colour(0xffcccccc));
+        g.drawText(CpuMeter::getStageName(stage), row.removeFromLeft(nameWidth), Justification::centredLeft, false);
+        g.drawText(String(stats.mean[s], 1), row.removeFromLeft(valueWidth), Justification::centredRight, false);
+        g.drawText(String(stats.p99[s], 1), row.removeFromLeft(valueWidth), Justification::centredRight, false);
+        g.drawText(String(stats.max[s], 1), row.removeFromLeft(valueWidth), Justification::centredRight, false);
+    }
+
+    row = area.removeFromTop(rowHeight);
+    g.setColour(Colour(0xffcccccc));
+    g.drawText(String(stats.meanActiveVoices, 1) + " voices, " + String(stats.voicePercent, 2) + " % per voice",
+               row, Justification::centredLeft, false);
+
+    // see DeadlineMonitor::getLogFile() for the context of the blocks
+    const DeadlineMonitor& deadlines = params.telemetry.deadlines;
+    row = area.removeFromTop(rowHeight);
+    g.setColour(shownIncidents > 0 ? Colour(0xffff8080) : Colour(0xffcccccc));
+    g.drawText("> " + String(deadlines.getThreshold() * 100.f, 0) + " %: " + String(shownIncidents)
+               + " blocks, worst " + String(deadlines.getWorstLoad() * 100.f, 0) + " %",
+               row, Justification::centredLeft, false);
+}
 //[/MiscUserCode]
 
 
@@ -137,7 +317,7 @@ BEGIN_JUCER_METADATA
 
 <JUCER_COMPONENT documentType="Component" className="InfoPanel" componentName=""
                  parentClasses="public PanelBase" constructorParams="SynthParams &amp;p"
-                 variableInitialisers="PanelBase(p)" snapPixels="8" snapActive="1"
+                 variableInitialisers="PanelBase(p),&#10;readingCpu(false),&#10;shownIncidents(0)" snapPixels="8" snapActive="1"
                  snapShown="1" overlayOpacity="0.330" fixedSize="0" initialWidth="685"
                  initialHeight="555">
   <BACKGROUND backgroundColour="ff6c788c">
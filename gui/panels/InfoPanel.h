@@ -23,6 +23,9 @@
 //[Headers]     -- You can add your own extra header files here --
 #include "JuceHeader.h"
 #include "PanelBase.h"
+#include "KnobImageCache.h"
+#include "TextImageCache.h"
+#include "PatchCost.h"
 //[/Headers]
 
 
@@ -54,6 +57,31 @@ public:
 private:
     //[UserVariables]   -- You can add your own custom variables in this section.
     Time today;
+
+    //! the cpu meter only measures while the panel is showing
+    void timerCallback() override;
+    void panelTimerStateChanged(bool running) override;
+    //! mean, 99th percentile and maximum of the stages of processBlock, the blocks close to a dropout
+    void drawCpuStats(Graphics& g) const;
+    bool readingCpu;
+    int64 shownIncidents;
+    const Rectangle<int> cpuArea { 225, 374, 176, 174 };
+    //! bytes of this instance and the shared ones, see MemoryFootprint
+    void drawMemoryStats(Graphics& g) const;
+    //! \brief the footprint of the instance with the editor caches, true if it changed since the last call
+    bool updateMemory();
+    MemoryFootprint memory;
+    SharedResourcePointer<KnobImageCache> knobImages;
+    SharedResourcePointer<TextImageCache> textImages;
+    const Rectangle<int> memoryArea { 409, 374, 176, 174 };
+    //! the predicted cost of the current patch at the block size of a live rig, see PatchCostEstimate
+    void drawCostEstimate(Graphics& g) const;
+    //! \brief estimates the current patch, true if the estimate changed since the last call
+    bool updateCostEstimate();
+    KernelCosts kernelCosts;
+    PatchCostEstimate costEstimate;
+    const Rectangle<int> costArea { 225, 264, 176, 104 };
+    static constexpr double liveSampleRate = 48000.;
     //[/UserVariables]
 
     //==============================================================================
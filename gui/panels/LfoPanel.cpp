@@ -162,19 +162,15 @@ LfoPanel::LfoPanel (SynthParams &p, int lfoNumber)
 
 
     //[Constructor] You can add your own custom stuff here..
-    sineWave = ImageCache::getFromMemory(BinaryData::lfoSineWave_png, BinaryData::lfoSineWave_pngSize);
-    squareWave = ImageCache::getFromMemory(BinaryData::lfoSquareWave_png, BinaryData::lfoSquareWave_pngSize);
-    sampleHold = ImageCache::getFromMemory(BinaryData::lfoSampleHold_png, BinaryData::lfoSampleHold_pngSize);
-    gainSign = ImageCache::getFromMemory(BinaryData::lfoGain_png, BinaryData::lfoGain_pngSize);
-    syncPic = ImageCache::getFromMemory(BinaryData::tempoSync_png, BinaryData::tempoSync_pngSize);
-    tripletPic = ImageCache::getFromMemory(BinaryData::triplets_png, BinaryData::triplets_pngSize);
-    tripletPicOff = ImageCache::getFromMemory(BinaryData::triplets_png, BinaryData::triplets_pngSize);
-    tripletPicOff.duplicateIfShared();
-    tripletPicOff.multiplyAllAlphas(0.5f);
-    dotPic = ImageCache::getFromMemory(BinaryData::dottedNote_png, BinaryData::dottedNote_pngSize);
-    dotPicOff = ImageCache::getFromMemory(BinaryData::dottedNote_png, BinaryData::dottedNote_pngSize);
-    dotPicOff.duplicateIfShared();
-    dotPicOff.multiplyAllAlphas(0.5f);
+    sineWave = resources->getImage(BinaryData::lfoSineWave_png, BinaryData::lfoSineWave_pngSize);
+    squareWave = resources->getImage(BinaryData::lfoSquareWave_png, BinaryData::lfoSquareWave_pngSize);
+    sampleHold = resources->getImage(BinaryData::lfoSampleHold_png, BinaryData::lfoSampleHold_pngSize);
+    gainSign = resources->getImage(BinaryData::lfoGain_png, BinaryData::lfoGain_pngSize);
+    syncPic = resources->getImage(BinaryData::tempoSync_png, BinaryData::tempoSync_pngSize);
+    tripletPic = resources->getImage(BinaryData::triplets_png, BinaryData::triplets_pngSize);
+    tripletPicOff = resources->getImage(BinaryData::triplets_png, BinaryData::triplets_pngSize, 0.5f);
+    dotPic = resources->getImage(BinaryData::dottedNote_png, BinaryData::dottedNote_pngSize);
+    dotPicOff = resources->getImage(BinaryData::dottedNote_png, BinaryData::dottedNote_pngSize, 0.5f);
 
     freq->setSkewFactorFromMidPoint(lfo.freq.getDefault());
     lfoFadeIn->setSkewFactorFromMidPoint(1);
@@ -54,11 +54,23 @@ LoFiPanel::LoFiPanel (SynthParams &p)
     onOffSwitch->setColour (Slider::textBoxBackgroundColourId, Colour (0xfffff4f4));
     onOffSwitch->addListener (this);
 
+    addAndMakeVisible (lowFiDownsample = new MouseOverKnob ("Low Fi Downsample"));
+    lowFiDownsample->setRange (1, 32, 0);
+    lowFiDownsample->setSliderStyle (Slider::RotaryVerticalDrag);
+    lowFiDownsample->setTextBoxStyle (Slider::TextBoxBelow, true, 80, 20);
+    lowFiDownsample->setColour (Slider::rotarySliderFillColourId, Colour (0xff2b3240));
+    lowFiDownsample->setColour (Slider::textBoxTextColourId, Colours::white);
+    lowFiDownsample->setColour (Slider::textBoxBackgroundColourId, Colour (0x00ffffff));
+    lowFiDownsample->setColour (Slider::textBoxOutlineColourId, Colour (0x00ffffff));
+    lowFiDownsample->addListener (this);
+
 
     //[UserPreSize]
     nBitsLowFi->setEnabled((onOffSwitch->getValue() == 1));
+    lowFiDownsample->setEnabled((onOffSwitch->getValue() == 1));
     registerSlider(onOffSwitch, &params.lowFiActivation, std::bind(&LoFiPanel::onOffSwitchChanged, this));
     registerSlider(nBitsLowFi, &params.nBitsLowFi);
+    registerSlider(lowFiDownsample, &params.lowFiDownsample);
     //[/UserPreSize]
 
     setSize (133, 200);
@@ -75,6 +87,7 @@ LoFiPanel::~LoFiPanel()
 
     nBitsLowFi = nullptr;
     onOffSwitch = nullptr;
+    lowFiDownsample = nullptr;
 
 
     //[Destructor]. You can add your own custom destruction code here..
@@ -100,8 +113,9 @@ void LoFiPanel::resized()
     //[UserPreResize] Add your own custom resize code here..
     //[/UserPreResize]
 
-    nBitsLowFi->setBounds (35, 63, 64, 64);
+    nBitsLowFi->setBounds (2, 63, 64, 64);
     onOffSwitch->setBounds (25, 1, 40, 30);
+    lowFiDownsample->setBounds (67, 63, 64, 64);
     //[UserResized] Add your own custom resize handling here..
     //[/UserResized]
 }
@@ -122,6 +136,11 @@ void LoFiPanel::sliderValueChanged (Slider* sliderThatWasMoved)
         //[UserSliderCode_onOffSwitch] -- add your slider handling code here..
         //[/UserSliderCode_onOffSwitch]
     }
+    else if (sliderThatWasMoved == lowFiDownsample)
+    {
+        //[UserSliderCode_lowFiDownsample] -- add your slider handling code here..
+        //[/UserSliderCode_lowFiDownsample]
+    }
 
     //[UsersliderValueChanged_Post]
     //[/UsersliderValueChanged_Post]
@@ -133,6 +152,7 @@ void LoFiPanel::sliderValueChanged (Slider* sliderThatWasMoved)
 void LoFiPanel::onOffSwitchChanged()
 {
     nBitsLowFi->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1));
+    lowFiDownsample->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1));
     onOffSwitch->setColour(Slider::trackColourId, ((onOffSwitch->getValue() == 1) ? SynthParams::fxColour :  SynthParams::onOffSwitchDisabled));
 }
 //[/MiscUserCode]
@@ -154,7 +174,7 @@ BEGIN_JUCER_METADATA
                  initialHeight="200">
   <BACKGROUND backgroundColour="ff2b3240"/>
   <SLIDER name="nBits Low Fi" id="c7728074cb4655d8" memberName="nBitsLowFi"
-          virtualName="MouseOverKnob" explicitFocusOrder="0" pos="35 63 64 64"
+          virtualName="MouseOverKnob" explicitFocusOrder="0" pos="2 63 64 64"
           rotarysliderfill="ff2b3240" textboxtext="ffffffff" textboxbkgd="ffffff"
           textboxoutline="ffffff" min="1" max="16" int="0" style="RotaryVerticalDrag"
           textBoxPos="TextBoxBelow" textBoxEditable="0" textBoxWidth="80"
@@ -165,6 +185,12 @@ BEGIN_JUCER_METADATA
           textboxbkgd="fffff4f4" min="0" max="1" int="1" style="LinearHorizontal"
           textBoxPos="NoTextBox" textBoxEditable="0" textBoxWidth="80"
           textBoxHeight="20" skewFactor="1"/>
+  <SLIDER name="Low Fi Downsample" id="5e0b7d3a9c41f286" memberName="lowFiDownsample"
+          virtualName="MouseOverKnob" explicitFocusOrder="0" pos="67 63 64 64"
+          rotarysliderfill="ff2b3240" textboxtext="ffffffff" textboxbkgd="ffffff"
+          textboxoutline="ffffff" min="1" max="32" int="0" style="RotaryVerticalDrag"
+          textBoxPos="TextBoxBelow" textBoxEditable="0" textBoxWidth="80"
+          textBoxHeight="20" skewFactor="1"/>
 </JUCER_COMPONENT>
 
 END_JUCER_METADATA
@@ -61,6 +61,7 @@ private:
     //==============================================================================
     ScopedPointer<MouseOverKnob> nBitsLowFi;
     ScopedPointer<Slider> onOffSwitch;
+    ScopedPointer<MouseOverKnob> lowFiDownsample;
 
 
     //==============================================================================
@@ -125,7 +125,7 @@ OscPanel::OscPanel (SynthParams &p, int oscillatorNumber)
     waveformVisual->setName ("Waveform Visual");
 
     addAndMakeVisible (waveformSwitch = new Slider ("Waveform Switch"));
-    waveformSwitch->setRange (0, 2, 1);
+    waveformSwitch->setRange (0, 3, 1);
     waveformSwitch->setSliderStyle (Slider::LinearVertical);
     waveformSwitch->setTextBoxStyle (Slider::NoTextBox, false, 80, 20);
     waveformSwitch->setColour (Slider::thumbColourId, Colour (0xff6c788c));
@@ -322,13 +322,14 @@ OscPanel::OscPanel (SynthParams &p, int oscillatorNumber)
     registerSaturnSource(trngAmount, widthModAmount2, &osc.shapeModSrc2, &osc.shapeModAmount2, 2);
 
     onOffSwitchChanged();
+    waveformVisual->addMouseListener(this, false);
     //[/UserPreSize]
 
     setSize (267, 272);
 
 
     //[Constructor] You can add your own custom stuff here..
-    waveforms = ImageCache::getFromMemory(BinaryData::oscWaveForms_png, BinaryData::oscWaveForms_pngSize);
+    waveforms = resources->getImage(BinaryData::oscWaveForms_png, BinaryData::oscWaveForms_pngSize);
     gain->setSkewFactorFromMidPoint(-6.0);
 
     pitchModAmount1->setAlwaysOnTop(true);
@@ -606,7 +607,7 @@ void OscPanel::onOffSwitchChanged()
 {
 
     ftune1->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1));
-    trngAmount->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && osc.waveForm.getStep() == eOscWaves::eOscSaw);
+    trngAmount->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && (osc.waveForm.getStep() == eOscWaves::eOscSaw || osc.waveForm.getStep() == eOscWaves::eOscWavetable));
     pulsewidth->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && osc.waveForm.getStep() == eOscWaves::eOscSquare);
     ctune1->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1));
     waveformVisual->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1));
@@ -627,8 +628,8 @@ void OscPanel::onOffSwitchChanged()
     panModSrc2->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1));
     widthModSrc1->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && osc.waveForm.getStep() == eOscWaves::eOscSquare);
     widthModSrc2->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && osc.waveForm.getStep() == eOscWaves::eOscSquare);
-    trngModSrc1->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && osc.waveForm.getStep() == eOscWaves::eOscSaw);
-    trngModSrc2->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && osc.waveForm.getStep() == eOscWaves::eOscSaw);
+    trngModSrc1->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && (osc.waveForm.getStep() == eOscWaves::eOscSaw || osc.waveForm.getStep() == eOscWaves::eOscWavetable));
+    trngModSrc2->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && (osc.waveForm.getStep() == eOscWaves::eOscSaw || osc.waveForm.getStep() == eOscWaves::eOscWavetable));
     gainModSrc1->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1));
     gainModSrc2->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1));
     pitchModSrc1->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1));
@@ -650,12 +651,12 @@ void OscPanel::updateWFShapeControls()
     widthModSrc2->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && osc.waveForm.getStep() == eOscWaves::eOscSquare);
 
     trngAmount->setVisible(eWaveformKey != eOscWaves::eOscSquare);
-    trngAmount->setEnabled(eWaveformKey == eOscWaves::eOscSaw);
+    trngAmount->setEnabled((eWaveformKey == eOscWaves::eOscSaw || eWaveformKey == eOscWaves::eOscWavetable));
 
     trngModSrc1->setVisible(eWaveformKey != eOscWaves::eOscSquare);
-    trngModSrc1->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && eWaveformKey == eOscWaves::eOscSaw);
+    trngModSrc1->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && (eWaveformKey == eOscWaves::eOscSaw || eWaveformKey == eOscWaves::eOscWavetable));
     trngModSrc2->setVisible(eWaveformKey != eOscWaves::eOscSquare);
-    trngModSrc2->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && eWaveformKey == eOscWaves::eOscSaw);
+    trngModSrc2->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && (eWaveformKey == eOscWaves::eOscSaw || eWaveformKey == eOscWaves::eOscWavetable));
 
     widthModAmount1->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && osc.shapeModSrc1.getStep() != eModSource::eNone && eWaveformKey != eOscWaves::eOscNoise);
     widthModAmount2->setEnabled((static_cast<int>(onOffSwitch->getValue()) == 1) && osc.shapeModSrc2.getStep() != eModSource::eNone && eWaveformKey != eOscWaves::eOscNoise);
@@ -700,10 +701,28 @@ void OscPanel::drawWaves(Graphics& g, ScopedPointer<Slider>& _waveformSwitch)
     int centerX = _waveformSwitch->getX() + _waveformSwitch->getWidth() / 2;
     int centerY = _waveformSwitch->getY() + _waveformSwitch->getHeight() / 2;
 
-    g.drawImageWithin(waveforms.getClippedImage(noiseFrame), centerX - 15, _waveformSwitch->getY() - 22, 30, 20, RectanglePlacement::centred);
-    g.drawImageWithin(waveforms.getClippedImage(sawFrame), _waveformSwitch->getX() + _waveformSwitch->getWidth() / 2 + 12, centerY - 10, 30, 20, RectanglePlacement::centred);
+    g.setColour(Colours::white);
+    g.setFont(Font(11.f, Font::bold));
+    g.drawText("WT", centerX - 15, _waveformSwitch->getY() - 22, 30, 20, Justification::centred);
+    g.drawImageWithin(waveforms.getClippedImage(noiseFrame), centerX + 12, centerY - 17, 30, 20, RectanglePlacement::centred);
+    g.drawImageWithin(waveforms.getClippedImage(sawFrame), centerX + 12, centerY - 3, 30, 20, RectanglePlacement::centred);
     g.drawImageWithin(waveforms.getClippedImage(squareFrame), centerX - 15, _waveformSwitch->getY() + _waveformSwitch->getHeight() - 1, 30, 20, RectanglePlacement::centred);
 }
+
+void OscPanel::mouseUp(const MouseEvent& e)
+{
+    if (e.eventComponent != waveformVisual || osc.waveForm.getStep() != eOscWaves::eOscSample || !waveformVisual->isEnabled()) {
+        return;
+    }
+    const File current = osc.sample.getFile();
+    FileChooser chooser("Please select the sample you want to play!", current != File::nonexistent ? current : File::nonexistent, "*.wav;*.aif;*.aiff");
+    if (chooser.browseForFileToOpen()) {
+        const Result result = osc.sample.load(chooser.getResult());
+        if (result.failed()) {
+            AlertWindow::showMessageBoxAsync(AlertWindow::WarningIcon, "Sample not loaded!", result.getErrorMessage(), "OK");
+        }
+    }
+}
 //[/MiscUserCode]
 
 
@@ -779,7 +798,7 @@ BEGIN_JUCER_METADATA
                     class="Component" params="osc.waveForm.getStep(), osc.pulseWidth.get(), osc.trngAmount.get()"/>
   <SLIDER name="Waveform Switch" id="df460155fcb1ed38" memberName="waveformSwitch"
           virtualName="" explicitFocusOrder="0" pos="195 175 40 44" thumbcol="ff6c788c"
-          trackcol="ffffffff" min="0" max="2" int="1" style="LinearVertical"
+          trackcol="ffffffff" min="0" max="3" int="1" style="LinearVertical"
           textBoxPos="NoTextBox" textBoxEditable="1" textBoxWidth="80"
           textBoxHeight="20" skewFactor="1"/>
   <SLIDER name="WidthModAmount1" id="ea500ea6791045c2" memberName="widthModAmount1"
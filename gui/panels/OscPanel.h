@@ -51,6 +51,8 @@ public:
     void updateModAmountKnobs();
     void onOffSwitchChanged();
     void drawWaves(Graphics& g, ScopedPointer<Slider>& _waveformSwitch);
+    //! a click on the waveform of the sample waveform picks the file
+    void mouseUp(const MouseEvent& e) override;
     //[/UserMethods]
 
     void paint (Graphics& g);
@@ -1,42 +1,167 @@
 
 #pragma once
 
-#include <map>
+#include <algorithm>
+#include <array>
 #include <functional>
+#include <vector>
 
 #include "JuceHeader.h"
 #include "SynthParams.h"
 #include "MouseOverKnob.h"
 #include "IncDecDropDown.h"
 #include "ModSourceBox.h"
-
-class PanelBase : public Component, protected Timer
+#include "GuiResources.h"
+
+//! PanelBase: couples the components of a panel with their params
+/*! A param changed outside of the ui reaches the components registered for it through the
+    ParamUpdateHub of the params, the panel does not poll. The timer is left to panels that
+    animate something of their own, started with startPanelTimer() it only runs while the panel
+    is visible, e.g. not in a collapsed section, and the editor is showing. When it starts again
+    the panel gets one timerCallback() at once to catch up.
+*/
+class PanelBase : public Component, protected Timer, private ParamUpdateHub::Listener, private ParamUpdateHub::ShowingListener
 {
 public:
 
     PanelBase(SynthParams &p)
         : params(p)
+        , sliderGestures(*this)
+        , deferRepaints(false)
+        , panelTimerInterval(0)
     {
-        startTimerHz(60);
+        // the background and labels are drawn once, scrolling and folding the sections blit the image
+        // a control that repaints only renders its own area into it again
+        setBufferedToImage(true);
+        params.uiUpdates.addShowingListener(this);
     }
 
     ~PanelBase() {
         stopTimer();
+        params.uiUpdates.removeShowingListener(this);
+        params.uiUpdates.removeListener(this);
     }
 
+    //! \brief one tick of the panel timer at once, e.g. for a benchmark that runs without message loop
+    void runPanelTimer() { timerCallback(); }
+
     static const int COMBO_OFS = 2;
 protected:
     typedef std::function<void()> tHookFn;
 
+    //! what a binding couples its component with
+    enum class eBinding {
+        eSlider,        //!< params: value, or min and max of a two value slider
+        eToggle,        //!< params: the ParamStepped<eOnOffToggle>
+        eCombobox,      //!< params: the ParamStepped<eModSource> of a ModSourceBox
+        eDropDown,      //!< params: the value
+        eNoteLength     //!< params: dividend (may be nullptr) and divisor
+    };
+
+    //! a registered component, its index in bindings is its id in the other tables
+    struct Binding {
+        Component* component;
+        eBinding kind;
+        std::array<Param*, 3> params;
+        tHookFn hook;               //!< runs after the component or its params changed, may be empty
+        int modRow;                 //!< eCombobox: id of the row of the mod matrix, -1 for the other kinds
+    };
+
+    //! a param changed outside of the ui updates the binding, sorted by param
+    struct ParamUpdate {
+        Param* param;
+        int binding;                //!< index into bindings, -1 if the update belongs to none
+        tHookFn update;
+    };
+
+    //! changing source repaints dest, e.g. a mod amount slider or a source box the saturns of a knob
+    struct RepaintLink {
+        Component* source;
+        Component* dest;
+        int slot;                   //!< the saturn number of a mod amount, 0 for a source box
+    };
+
+    //! \brief the timer of the panel, it runs while the panel is visible and the editor is showing
+    void startPanelTimer(int intervalMs) {
+        panelTimerInterval = intervalMs;
+        updatePanelTimer(false);
+    }
+    void startPanelTimerHz(int hz) { startPanelTimer(1000 / hz); }
+
+    //! \brief the panel timer started or stopped, e.g. to release what the audio thread publishes for it
+    virtual void panelTimerStateChanged(bool running) { ignoreUnused(running); }
+    //! \brief the audio thread is under load or recovered, e.g. to pause a visualisation, see ParamUpdateHub::isThrottled()
+    virtual void panelThrottledChanged(bool throttled) { ignoreUnused(throttled); }
+
+    //! \brief runs update whenever the ui value of p is changed outside of the ui
+    void onParamChanged(Param* p, const tHookFn& update) {
+        addParamUpdate(p, -1, update);
+    }
+
+    //! \brief index of the binding of c with the kind, -1 if c is not registered as one
+    int findBinding(const Component* c, eBinding kind) const {
+        for (size_t i = 0; i < bindings.size(); ++i) {
+            if (bindings[i].component == c && bindings[i].kind == kind) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    void runPostUpdateHook(int binding) {
+        if (bindings[binding].hook) {
+            bindings[binding].hook();
+        }
+    }
+
+    //! \brief repaints every component a link from source points to
+    /*! While the hub dispatches the changes of the host, e.g. a full patch of automation, a
+        knob linked to several changed params is repainted once at the end of the tick.
+    */
+    void repaintLinked(const Component* source) {
+        for (const RepaintLink& link : repaintLinks) {
+            if (link.source != source) {
+                continue;
+            }
+            if (!deferRepaints) {
+                link.dest->repaint();
+            } else if (std::find(pendingRepaints.begin(), pendingRepaints.end(), link.dest) == pendingRepaints.end()) {
+                pendingRepaints.push_back(link.dest);
+            }
+        }
+    }
+
+    //! a drag of a registered slider is one change gesture of its params for the host
+    struct SliderGestures : public Slider::Listener {
+        explicit SliderGestures(PanelBase& p) : panel(p) {}
+        void sliderValueChanged(Slider*) override {}
+        void sliderDragStarted(Slider* s) override { panel.sliderGestureChanged(s, true); }
+        void sliderDragEnded(Slider* s) override { panel.sliderGestureChanged(s, false); }
+        PanelBase& panel;
+    };
+
+    void sliderGestureChanged(Slider* s, bool starting) {
+        const int b = findBinding(s, eBinding::eSlider);
+        if (b < 0) {
+            return;
+        }
+        for (Param* p : bindings[b].params) {
+            if (p != nullptr) {
+                if (starting) {
+                    p->beginGesture();
+                } else {
+                    p->endGesture();
+                }
+            }
+        }
+    }
+
     //=======================================================================================================================================
     void registerSlider(Slider *slider, Param *p, const tHookFn hook = tHookFn(), Param *min = nullptr, Param *max = nullptr) {
         slider->setScrollWheelEnabled(false);
+        slider->addListener(&sliderGestures);
 
-        sliderReg[slider] = {p, min, max};
-        if (hook) {
-            postUpdateHook[slider] = hook;
-            hook();
-        }
+        const int b = addBinding(slider, eBinding::eSlider, { p, min, max }, hook);
         if (p->hasLabels()) {
             slider->setName(p->getUIString());
         }
@@ -53,6 +178,21 @@ protected:
         }
         if (!min && !max) {
             slider->setValue(p->getUI(), dontSendNotification);
+            addParamUpdate(p, b, [this, slider, p, b]() {
+                slider->setValue(p->getUI(), dontSendNotification);
+                if (p->hasLabels()) {
+                    slider->setName(p->getUIString());
+                }
+                runPostUpdateHook(b);
+                repaintLinked(slider);
+            });
+        }
+        // if min and max params are set
+        if (min) {
+            addParamUpdate(min, b, [slider, min]() { slider->setMinValue(min->getUI()); });
+        }
+        if (max) {
+            addParamUpdate(max, b, [slider, max]() { slider->setMaxValue(max->getUI()); });
         }
     }
 
@@ -61,75 +201,45 @@ protected:
 
         registerSlider(static_cast<Slider*>(slider), p);
         if (hook) {
-            postUpdateHook[slider] = hook;
+            bindings[findBinding(slider, eBinding::eSlider)].hook = hook;
             hook();
         }
         slider->initTextBox();
     }
 
     bool handleSlider(Slider* sliderThatWasMoved) {
-        auto it = sliderReg.find(sliderThatWasMoved);
-        if (it != sliderReg.end()) {
-            if (it->second[1] == nullptr && it->second[2] == nullptr) {
-                it->second[0]->setUI(static_cast<float>(it->first->getValue()));
-                if (it->second[0]->hasLabels()) {
-                    it->first->setName(it->second[0]->getUIString());
-                }
-            }
-
-            if (it->second[1] && it->second[2]) {
-                it->second[1]->setUI(static_cast<float>(it->first->getMinValue()));
-                it->second[2]->setUI(static_cast<float>(it->first->getMaxValue()));
-            }
-
-            for (auto saturn : saturnReg) {
-                for (int i = 0; i < 2; ++i) {
-                    if (saturn.second[i] == sliderThatWasMoved) {
-                        saturn.first->repaint();
-                    }
-                }
-            }
-
-            auto itHook = postUpdateHook.find(it->first);
-            if (itHook != postUpdateHook.end()) {
-                itHook->second();
-            }
-
-            return true;
-        }
-        else {
+        const int b = findBinding(sliderThatWasMoved, eBinding::eSlider);
+        if (b < 0) {
             return false;
         }
-    }
-
-    void updateDirtySliders() {
-        for (auto s2p : sliderReg) {
-            if (s2p.second[0]->isUIDirty() && !s2p.second[1] && !s2p.second[2]) {
-                s2p.first->setValue(s2p.second[0]->getUI(), dontSendNotification);
-                if (s2p.second[0]->hasLabels()) {
-                    s2p.first->setName(s2p.second[0]->getUIString());
-                }
 
-                auto itHook = postUpdateHook.find(s2p.first);
-                if (itHook != postUpdateHook.end()) {
-                    itHook->second();
-                }
+        Param* const p = bindings[b].params[0];
+        Param* const min = bindings[b].params[1];
+        Param* const max = bindings[b].params[2];
+        if (min == nullptr && max == nullptr) {
+            const float before = p->getUI();
+            p->setUI(static_cast<float>(sliderThatWasMoved->getValue()));
+            params.undoHistory.record(*p, before);
+            if (p->hasLabels()) {
+                sliderThatWasMoved->setName(p->getUIString());
             }
+        }
 
-            // if min and max params are set
-            if (s2p.second[1]) {
-                if (s2p.second[1]->isUIDirty()) {
-                    s2p.first->setMinValue(s2p.second[1]->getUI());
-                }
-            }
-            if (s2p.second[2]) {
-                if (s2p.second[2]->isUIDirty()) {
-                    s2p.first->setMaxValue(s2p.second[2]->getUI());
-                }
-            }
+        if (min && max) {
+            const float minBefore = min->getUI();
+            const float maxBefore = max->getUI();
+            min->setUI(static_cast<float>(sliderThatWasMoved->getMinValue()));
+            max->setUI(static_cast<float>(sliderThatWasMoved->getMaxValue()));
+            params.undoHistory.record(*min, minBefore);
+            params.undoHistory.record(*max, maxBefore);
         }
+
+        repaintLinked(sliderThatWasMoved);
+        runPostUpdateHook(b);
+        return true;
     }
 
+
     //=======================================================================================================================================
 
     // NOTE: sourceNumber values 1 or 2
@@ -138,122 +248,72 @@ protected:
         , MouseOverKnob::modAmountConversion convType = MouseOverKnob::modAmountConversion::noConversion) {
         dest->setModSource(modSource, modAmount, sourceNumber, convType);
 
-        auto temp = saturnReg.find(dest);
-        if (temp == saturnReg.end()) {
-            std::array<Slider*, 2> newSource = {nullptr};
-            newSource[sourceNumber-1] = source;
-            saturnReg[dest] = newSource;
-        } else {
-            temp->second[sourceNumber-1] = source;
-        }
-    }
-
-    // Callback function in case there are any dirty saturn glows
-    void updateDirtySaturns() {
-        // iterate over all the registered saturn glows
-        for (auto dest2saturn : saturnReg) {
-            // find the mod source from the slider register
-            for (int i = 0; i < 2; ++i) {
-                auto modSource = sliderReg.find(dest2saturn.second[i]);
-
-                //if the mod source is Dirty repaint
-                if (modSource != sliderReg.end() && modSource->second[0]->isUIDirty()) {
-                    dest2saturn.first->repaint();
-                }
+        // a saturn has one mod amount slider, registering it again replaces it
+        for (RepaintLink& link : repaintLinks) {
+            if (link.dest == dest && link.slot == sourceNumber) {
+                link.source = source;
+                return;
             }
         }
+        repaintLinks.push_back({ source, dest, sourceNumber });
     }
 
     //=======================================================================================================================================
 
     void registerToggle(Button* toggle, ParamStepped<eOnOffToggle>* p, const tHookFn hook = tHookFn())
     {
-        toggleReg[toggle] = p;
-
-        if (hook) {
-            postUpdateHook[toggle] = hook;
-            hook();
-        }
+        const int b = addBinding(toggle, eBinding::eToggle, { p, nullptr, nullptr }, hook);
+        addParamUpdate(p, b, [this, toggle, p, b]() {
+            toggle->setToggleState((p->getStep() == eOnOffToggle::eOn), dontSendNotification);
+            runPostUpdateHook(b);
+        });
     }
 
 
     bool handleToggle(Button* buttonThatWasClicked)
     {
-        auto it = toggleReg.find(buttonThatWasClicked);
-
-        if (it != toggleReg.end()) {
-            it->second->setStep(it->second->getStep() == eOnOffToggle::eOn ? eOnOffToggle::eOff : eOnOffToggle::eOn);
-            it->first->setToggleState(it->second->getStep() == eOnOffToggle::eOn, dontSendNotification);
-
-            auto itHook = postUpdateHook.find(it->first);
-            if (itHook != postUpdateHook.end()) {
-                itHook->second();
-            }
-
-            return true;
+        const int b = findBinding(buttonThatWasClicked, eBinding::eToggle);
+        if (b < 0) {
+            return false;
         }
 
-        return false;
-    }
-
-    void updateDirtyToggles()
-    {
-        for (auto t2p : toggleReg) {
-            if (t2p.second->isUIDirty()) {
-                t2p.first->setToggleState((t2p.second->getStep() == eOnOffToggle::eOn), dontSendNotification);
+        // registerToggle() only binds toggle params
+        ParamStepped<eOnOffToggle>* const p = static_cast<ParamStepped<eOnOffToggle>*>(bindings[b].params[0]);
+        const float before = p->getUI();
+        p->setStep(p->getStep() == eOnOffToggle::eOn ? eOnOffToggle::eOff : eOnOffToggle::eOn);
+        params.undoHistory.record(*p, before);
+        buttonThatWasClicked->setToggleState(p->getStep() == eOnOffToggle::eOn, dontSendNotification);
 
-                auto itHook = postUpdateHook.find(t2p.first);
-                if (itHook != postUpdateHook.end()) {
-                    itHook->second();
-                }
-            }
-        }
+        runPostUpdateHook(b);
+        return true;
     }
 
     //=======================================================================================================================================
 
     void registerDropDowns(ComboBox* dropDown, Param* p, const tHookFn hook = tHookFn())
     {
-        dropDownReg[dropDown] = p;
-
         dropDown->setText(String(p->getUI()));
 
-        if (hook) {
-            postUpdateHook[dropDown] = hook;
-            hook();
-        }
+        const int b = addBinding(dropDown, eBinding::eDropDown, { p, nullptr, nullptr }, hook);
+        addParamUpdate(p, b, [this, dropDown, p, b]() {
+            dropDown->setText(String(p->getUI()));
+            runPostUpdateHook(b);
+        });
     }
 
     bool handleDropDowns(ComboBox* dropDownThatWasChanged)
     {
-        auto it = dropDownReg.find(dropDownThatWasChanged);
-
-        if (it != dropDownReg.end()) {
-            it->second->setUI(dropDownThatWasChanged->getText().getFloatValue());
-
-            auto itHook = postUpdateHook.find(it->first);
-            if (itHook != postUpdateHook.end()) {
-                itHook->second();
-            }
-
-            return true;
+        const int b = findBinding(dropDownThatWasChanged, eBinding::eDropDown);
+        if (b < 0) {
+            return false;
         }
 
-        return false;
-    }
-
-    void updateDirtyDropDowns()
-    {
-        for (auto d2p : dropDownReg) {
-            if (d2p.second->isUIDirty()) {
-                d2p.first->setText(String(d2p.second->getUI()));
-            }
-
-            auto itHook = postUpdateHook.find(d2p.first);
-            if (itHook != postUpdateHook.end()) {
-                itHook->second();
-            }
-        }
+        Param* const p = bindings[b].params[0];
+        const float before = p->getUI();
+        p->setUI(dropDownThatWasChanged->getText().getFloatValue());
+        params.undoHistory.record(*p, before);
+        runPostUpdateHook(b);
+        return true;
     }
 
     //=======================================================================================================================================
@@ -261,112 +321,100 @@ protected:
     // TODO: Change for ParamStepped? It might be just useful for the notelength, so maybe a general solution should be better.
     void registerNoteLength(ComboBox* noteLengthBox, Param* divisor, Param* dividend = nullptr, const tHookFn hook = tHookFn())
     {
-
-        noteLengthReg[noteLengthBox][0] = dividend;
-
-        noteLengthReg[noteLengthBox][1] = divisor;
-
-        if (hook) {
-            postUpdateHook[noteLengthBox] = hook;
-            hook();
+        const int b = addBinding(noteLengthBox, eBinding::eNoteLength, { dividend, divisor, nullptr }, hook);
+
+        const tHookFn update = [this, noteLengthBox, divisor, dividend, b]() {
+            // IDEA : New Param with the bar numbers and get that from there
+            String barNumber = dividend == nullptr ? "1" : String(dividend->getUI());
+
+            noteLengthBox->setText(barNumber + "/" + String(divisor->getUI()));
+            runPostUpdateHook(b);
+        };
+        addParamUpdate(divisor, b, update);
+        if (dividend != nullptr) {
+            addParamUpdate(dividend, b, update);
         }
     }
 
     // TODO: Change for ParamStepped?
     bool handleNoteLength(ComboBox* noteLengthThatWasChanged)
     {
-        auto it = noteLengthReg.find(noteLengthThatWasChanged);
-
-        if (it != noteLengthReg.end()) {
-            it->second[1]->setUI(noteLengthThatWasChanged->getText().substring(2).getFloatValue());
-
-            if (it->second[0] != nullptr) {
-                it->second[0]->setUI(noteLengthThatWasChanged->getText().substring(0, 1).getFloatValue());
-            }
-
-            auto itHook = postUpdateHook.find(it->first);
-            if (itHook != postUpdateHook.end()) {
-                itHook->second();
-            }
-            return true;
+        const int b = findBinding(noteLengthThatWasChanged, eBinding::eNoteLength);
+        if (b < 0) {
+            return false;
         }
 
-        return false;
-    }
-
-    // TODO: Change for ParamStepped? It might be just useful for the notelength, so maybe a general solution should be better.
-    void updateDirtyNoteLength()
-    {
-        for (auto d2p : noteLengthReg) {
-            if ((d2p.second[0] != nullptr && d2p.second[0]->isUIDirty()) || d2p.second[1]->isUIDirty()) {
-                // IDEA : New Param with the bar numbers and get that from there
-                String barNumber = d2p.second[0] == nullptr ? "1" : String(d2p.second[0]->getUI());
-
-                d2p.first->setText(barNumber + "/" + String(d2p.second[1]->getUI()));
-
-            }
-
-            auto itHook = postUpdateHook.find(d2p.first);
-            if (itHook != postUpdateHook.end()) {
-                itHook->second();
-            }
+        Param* const divisor = bindings[b].params[1];
+        const float divisorBefore = divisor->getUI();
+        divisor->setUI(noteLengthThatWasChanged->getText().substring(2).getFloatValue());
+        params.undoHistory.record(*divisor, divisorBefore);
+        if (Param* const dividend = bindings[b].params[0]) {
+            const float dividendBefore = dividend->getUI();
+            dividend->setUI(noteLengthThatWasChanged->getText().substring(0, 1).getFloatValue());
+            params.undoHistory.record(*dividend, dividendBefore);
         }
+
+        runPostUpdateHook(b);
+        return true;
     }
 
     //=======================================================================================================================================
 
     // use only with ModSourceBox class
     void registerCombobox(ComboBox* box, ParamStepped<eModSource> *p, std::array<MouseOverKnob*, 3> modDest = {nullptr}, const tHookFn hook = tHookFn()) {
-        comboboxReg[box] = p;
-
         // couple combobox with saturn knob
-        if (!modDest.empty()) {
-            saturnSourceReg[box] = modDest;
+        for (MouseOverKnob* dest : modDest) {
+            if (dest != nullptr) {
+                repaintLinks.push_back({ box, dest, 0 });
+            }
         }
 
         box->setSelectedId(static_cast<int>(p->getStep())+COMBO_OFS);
 
-        if (hook) {
-            postUpdateHook[box] = hook;
-            hook();
-        }
+        const int b = addBinding(box, eBinding::eCombobox, { p, nullptr, nullptr }, hook);
+        bindings[b].modRow = params.globalModMatrix.findRow(p);
+        jassert(bindings[b].modRow >= 0);
+        addParamUpdate(p, b, [this, box, p, b]() {
+            box->setSelectedId(static_cast<int>(p->getStep()) + COMBO_OFS);
+            repaintLinked(box);
+            runPostUpdateHook(b);
+        });
     }
 
     bool handleCombobox(ComboBox* comboboxThatWasChanged)
     {
-        auto it = comboboxReg.find(comboboxThatWasChanged);
-        if (it != comboboxReg.end()) {
-            // we gotta subtract 2 from the item id since the combobox ids start at 1 and the sources enum starts at -1
-            params.globalModMatrix.changeSource(it->second->prefix()+" "+comboboxThatWasChanged->getName(), static_cast<eModSource>(comboboxThatWasChanged->getSelectedId() - COMBO_OFS));
-            // we gotta subtract 1 from the item id since the combobox ids start at 1 and the eModSources enum starts at 0
-            it->second->setStep(static_cast<eModSource>(it->first->getSelectedId() - COMBO_OFS));
-
-            // set colour of textBox background with some transparency if no mod source is selected
-            if (it->second->getStep() == eModSource::eNone) {
-                it->first->setColour(ComboBox::ColourIds::backgroundColourId, it->first->findColour(ComboBox::ColourIds::backgroundColourId).withAlpha(0.5f));
-            }
-            else {
-                it->first->setColour(ComboBox::ColourIds::backgroundColourId, it->first->findColour(ComboBox::ColourIds::backgroundColourId).withAlpha(1.0f));
-            }
+        const int b = findBinding(comboboxThatWasChanged, eBinding::eCombobox);
+        if (b < 0) {
+            return false;
+        }
 
-            // update saturn
-            auto temp = saturnSourceReg.find(comboboxThatWasChanged);
-            if (temp != saturnSourceReg.end()) {
-                for (int i = 0; i < 3; ++i ) {
-                    if (temp->second[i]) {
-                        temp->second[i]->repaint();
-                    }
-                }
-            }
+        // registerCombobox() only binds mod source params
+        ParamStepped<eModSource>* const p = static_cast<ParamStepped<eModSource>*>(bindings[b].params[0]);
+        // the source converts its amount, an undo restores both
+        Param* const amount = params.globalModMatrix.getIntensity(bindings[b].modRow);
+        const float before = p->getUI();
+        const float amountBefore = amount != nullptr ? amount->getUI() : 0.f;
+        // we gotta subtract 2 from the item id since the combobox ids start at 1 and the sources enum starts at -1
+        params.globalModMatrix.changeSource(bindings[b].modRow, static_cast<eModSource>(comboboxThatWasChanged->getSelectedId() - COMBO_OFS));
+        // we gotta subtract 1 from the item id since the combobox ids start at 1 and the eModSources enum starts at 0
+        p->setStep(static_cast<eModSource>(comboboxThatWasChanged->getSelectedId() - COMBO_OFS));
+        params.undoHistory.record(*p, before);
+        if (amount != nullptr) {
+            params.undoHistory.record(*amount, amountBefore);
+        }
 
-            auto itHook = postUpdateHook.find(it->first);
-            if (itHook != postUpdateHook.end()) {
-                itHook->second();
-            }
-            return true;
+        // set colour of textBox background with some transparency if no mod source is selected
+        if (p->getStep() == eModSource::eNone) {
+            comboboxThatWasChanged->setColour(ComboBox::ColourIds::backgroundColourId, comboboxThatWasChanged->findColour(ComboBox::ColourIds::backgroundColourId).withAlpha(0.5f));
+        }
+        else {
+            comboboxThatWasChanged->setColour(ComboBox::ColourIds::backgroundColourId, comboboxThatWasChanged->findColour(ComboBox::ColourIds::backgroundColourId).withAlpha(1.0f));
         }
 
-        return false;
+        // update saturn
+        repaintLinked(comboboxThatWasChanged);
+        runPostUpdateHook(b);
+        return true;
     }
 
 
@@ -378,39 +426,71 @@ protected:
     }
 
 
-    void updateDirtyBoxes()
-    {
-        for (auto c2p : comboboxReg) {
-            if (c2p.second->isUIDirty()) {
-                c2p.first->setSelectedId(static_cast<int>(c2p.second->getStep()) + COMBO_OFS);
-
-                auto c2s = saturnSourceReg.find(c2p.first);
-                if (c2s != saturnSourceReg.end()) {
-                    for (int i = 0; i < 3; ++i) {
-                        if (c2s->second[i]) {
-                            c2s->second[i]->repaint();
-                        }
-                    }
-                }
+    //=======================================================================================================================================
 
-                auto itHook = postUpdateHook.find(c2p.first);
-                if (itHook != postUpdateHook.end()) {
-                    itHook->second();
-                }
-            }
+    void paramChanged(Param* p) override
+    {
+        // the linked repaints wait for paramsDispatched()
+        deferRepaints = true;
+        auto range = std::equal_range(paramUpdates.begin(), paramUpdates.end(), p, ParamUpdateOrder());
+        for (auto it = range.first; it != range.second; ++it) {
+            it->update();
         }
     }
 
-    //=======================================================================================================================================
+    void paramsDispatched() override
+    {
+        deferRepaints = false;
+        for (Component* c : pendingRepaints) {
+            c->repaint();
+        }
+        pendingRepaints.clear();
+    }
 
     virtual void timerCallback() override
     {
-        updateDirtySliders();
-        updateDirtySaturns();
-        updateDirtyBoxes();
-        updateDirtyNoteLength();
-        updateDirtyDropDowns();
-        updateDirtyToggles();
+    }
+
+    //! a section folded or unfolded the panel
+    void visibilityChanged() override
+    {
+        updatePanelTimer(true);
+    }
+
+    void editorShowingChanged(bool) override
+    {
+        updatePanelTimer(true);
+    }
+
+    //! under audio load the panel timer runs at most at the rate of the hub
+    void editorThrottledChanged(bool throttled) override
+    {
+        if (isTimerRunning()) {
+            startTimer(getPanelTimerInterval());
+        }
+        panelThrottledChanged(throttled);
+    }
+
+    int getPanelTimerInterval() const
+    {
+        return params.uiUpdates.isThrottled() ? jmax(panelTimerInterval, 1000 / ParamUpdateHub::throttledRate) : panelTimerInterval;
+    }
+
+    void updatePanelTimer(bool catchUp)
+    {
+        const bool run = panelTimerInterval > 0 && isVisible() && params.uiUpdates.isEditorShowing();
+        if (run == isTimerRunning()) {
+            return;
+        }
+        if (run) {
+            startTimer(getPanelTimerInterval());
+        } else {
+            stopTimer();
+        }
+        panelTimerStateChanged(run);
+        if (run && catchUp) {
+            timerCallback();
+        }
     }
 
     /**
@@ -434,18 +514,41 @@ protected:
 
         // draw group name text
         //int offset = 2 * static_cast<int>(cornerSize);
-        g.setFont(headHeight * 0.85f);
-        g.drawText(name, static_cast<int>(posX) + offset, static_cast<int>(posY),
-            width - 2 * offset, static_cast<int>(posY) + static_cast<int>(headHeight - (headHeight - headHeight * 0.85f) * 0.5f), Justification::centredRight);
-    }
-
-    std::map<Slider*, std::array<Param*, 3>> sliderReg;
-    std::map<Button*, ParamStepped<eOnOffToggle>*> toggleReg;
-    std::map<ComboBox*, ParamStepped<eModSource>*> comboboxReg;
-    std::map<Component*, tHookFn> postUpdateHook;
-    std::map<ComboBox*, std::array<Param*, 2>> noteLengthReg;
-    std::map<ComboBox*, Param*> dropDownReg;
-    std::map<MouseOverKnob*, std::array<Slider*, 2>> saturnReg; // 2 for each mod amount
-    std::map<ComboBox*, std::array<MouseOverKnob*, 3>> saturnSourceReg; // there are up to 3, because of the ADR
+        // the header is an image of the text cache, the panels repaint it with every saturn
+        resources->getLookAndFeel().getTextCache().drawText(g, name, Font(headHeight * 0.85f),
+            Rectangle<int>(static_cast<int>(posX) + offset, static_cast<int>(posY), width - 2 * offset,
+                           static_cast<int>(posY) + static_cast<int>(headHeight - (headHeight - headHeight * 0.85f) * 0.5f)),
+            Justification::centredRight);
+    }
+
+    //! \brief adds a binding and runs its hook once, returns its index
+    int addBinding(Component* c, eBinding kind, const std::array<Param*, 3>& boundParams, const tHookFn& hook) {
+        bindings.push_back({ c, kind, boundParams, hook, -1 });
+        if (hook) {
+            hook();
+        }
+        return static_cast<int>(bindings.size()) - 1;
+    }
+
+    //! \brief inserts the update behind the others of the param, they run in registration order
+    void addParamUpdate(Param* p, int binding, const tHookFn& update) {
+        auto at = std::upper_bound(paramUpdates.begin(), paramUpdates.end(), p, ParamUpdateOrder());
+        paramUpdates.insert(at, { p, binding, update });
+        params.uiUpdates.addListener(p, this);
+    }
+
+    struct ParamUpdateOrder {
+        bool operator() (const ParamUpdate& a, const Param* b) const { return a.param < b; }
+        bool operator() (const Param* a, const ParamUpdate& b) const { return a < b.param; }
+    };
+
+    std::vector<Binding> bindings;          // in registration order
+    std::vector<ParamUpdate> paramUpdates;  // what to update when a param changed outside of the ui, sorted by param
+    std::vector<RepaintLink> repaintLinks;  // saturns to repaint, 2 mod amounts per knob and up to 3 knobs per source box (ADR)
     SynthParams &params;
+    SharedResourcePointer<GuiResources> resources;  //!< images and look and feel shared by all editors
+    SliderGestures sliderGestures;
+    bool deferRepaints;                             //!< while the hub dispatches to the panel
+    std::vector<Component*> pendingRepaints;        //!< linked components to repaint at the end of the tick
+    int panelTimerInterval;                         //!< ms, 0 if the panel has no timer
 };
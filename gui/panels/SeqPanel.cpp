@@ -247,6 +247,9 @@ SeqPanel::SeqPanel (SynthParams &p)
     seqNumSteps->addItem (TRANS("6"), 6);
     seqNumSteps->addItem (TRANS("7"), 7);
     seqNumSteps->addItem (TRANS("8"), 8);
+    seqNumSteps->addItem (TRANS("16"), 9);
+    seqNumSteps->addItem (TRANS("32"), 10);
+    seqNumSteps->addItem (TRANS("64"), 11);
     seqNumSteps->addListener (this);
 
     addAndMakeVisible (labelSeqSpeed = new Label ("new seq speed",
@@ -367,14 +370,17 @@ SeqPanel::SeqPanel (SynthParams &p)
 
 
     //[Constructor] You can add your own custom stuff here..
-    syncPic = ImageCache::getFromMemory(BinaryData::tempoSync_png, BinaryData::tempoSync_pngSize);
-    tripletPic = ImageCache::getFromMemory(BinaryData::triplets_png, BinaryData::triplets_pngSize);
-    dotPic = ImageCache::getFromMemory(BinaryData::dottedNote_png, BinaryData::dottedNote_pngSize);
-    sequentialPic = ImageCache::getFromMemory(BinaryData::seqSequential_png, BinaryData::seqSequential_pngSize);
-    upDownPic = ImageCache::getFromMemory(BinaryData::seqUpDown_png, BinaryData::seqUpDown_pngSize);
-    randomPic = ImageCache::getFromMemory(BinaryData::seqRandom_png, BinaryData::seqRandom_pngSize);
+    syncPic = resources->getImage(BinaryData::tempoSync_png, BinaryData::tempoSync_pngSize);
+    tripletPic = resources->getImage(BinaryData::triplets_png, BinaryData::triplets_pngSize);
+    dotPic = resources->getImage(BinaryData::dottedNote_png, BinaryData::dottedNote_pngSize);
+    sequentialPic = resources->getImage(BinaryData::seqSequential_png, BinaryData::seqSequential_pngSize);
+    upDownPic = resources->getImage(BinaryData::seqUpDown_png, BinaryData::seqUpDown_pngSize);
+    randomPic = resources->getImage(BinaryData::seqRandom_png, BinaryData::seqRandom_pngSize);
 
     genRandom->setAlwaysOnTop(true);
+
+    // the playing step and the random notes are polled, the params reach the panel through the hub
+    startPanelTimerHz(60);
     //[/Constructor]
 }
 
@@ -641,6 +647,8 @@ void SeqPanel::buttonClicked (Button* buttonThatWasClicked)
         float max = params.seqRandomMax.get();
         Random r = Random();
 
+        // the sequencer takes the new steps together
+        const SeqPattern::ScopedEdit edit(params.seqPattern);
         for (int i = 0; i < 8; ++i)
         {
             r.setSeedRandomly();
@@ -760,11 +768,50 @@ void SeqPanel::drawPics(Graphics& g, ScopedPointer<Slider>& seqPlayMode, ScopedP
     g.drawImageWithin(dotPic, dotT->getX() + 22, dotT->getY() + dotT->getHeight() / 2 - 11, 18, 22, Justification::centred); // 18x22
 }
 
+void SeqPanel::updateRandomNotes()
+{
+    SeqNoteQueue::Note randomNotes[16];
+    int numRandomNotes;
+    while ((numRandomNotes = params.seqRandomNotes.pop(randomNotes, 16)) > 0)
+    {
+        for (int n = 0; n < numRandomNotes; ++n)
+        {
+            const int i = randomNotes[n].step;
+            if (i >= 0 && i < 8)
+            {
+                const int note = randomNotes[n].note;
+                seqStepArray[i]->setValue(note, dontSendNotification);
+                labelButtonArray[i]->setButtonText(MidiMessage::getMidiNoteName(note, true, true, 3));
+                showsRandomNotes = true;
+            }
+        }
+    }
+
+    // back to the notes of the steps
+    if (showsRandomNotes && (params.seqPlayMode.getStep() != eSeqPlayModes::eRandom))
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            seqStepArray[i]->setValue(currMidiStepSeq[i]->getUI(), dontSendNotification);
+        }
+        updateNoteNameLabels();
+        showsRandomNotes = false;
+    }
+}
+
 void SeqPanel::timerCallback()
 {
+    // a folded section catches up when it shows again
+    if (!isShowing()) {
+        return;
+    }
+
+    updateRandomNotes();
+
+    const int playedStep = jmax(0, params.telemetry.display.seqStep.load(std::memory_order_relaxed));
     if (isPlaying())
     {
-        if (lastSeqNotePos != static_cast<int>(params.seqLastPlayedStep.get()))
+        if (lastSeqNotePos != playedStep % 8)
         {
             seqPlay->setToggleState(isPlaying(), dontSendNotification);
             // colour current playing seqNote slider
@@ -773,7 +820,8 @@ void SeqPanel::timerCallback()
                 seqStepArray[i]->setColour(Slider::thumbColourId, Colours::grey);
             }
 
-            lastSeqNotePos = static_cast<int>(params.seqLastPlayedStep.get());
+            // the steps after the eighth are shown on the slider of their position in the bar
+            lastSeqNotePos = playedStep % 8;
             lastSeqNotePos = jmax(0, jmin(lastSeqNotePos, 7));
             seqStepArray[lastSeqNotePos]->setColour(Slider::thumbColourId, Colour(0xff60ff60));
         }
@@ -793,7 +841,7 @@ void SeqPanel::timerCallback()
 
 bool SeqPanel::isPlaying()
 {
-    AudioPlayHead::CurrentPositionInfo hostPlayHead = params.positionInfo[params.getAudioIndex()];
+    const AudioPlayHead::CurrentPositionInfo& hostPlayHead = params.transport.read();
 
     if ((params.seqPlayNoHost.getStep() == eOnOffToggle::eOn) || ((params.seqPlaySyncHost.getStep() == eOnOffToggle::eOn) && hostPlayHead.isPlaying))
     {
@@ -936,7 +984,7 @@ BEGIN_JUCER_METADATA
             textWhenNonSelected="Step Length" textWhenNoItems="(no choices)"/>
   <COMBOBOX name="seq num steps" id="cc5278e8668913e9" memberName="seqNumSteps"
             virtualName="IncDecDropDown" explicitFocusOrder="0" pos="142 59 98 28"
-            editable="0" layout="36" items="1&#10;2&#10;3&#10;4&#10;5&#10;6&#10;7&#10;8"
+            editable="0" layout="36" items="1&#10;2&#10;3&#10;4&#10;5&#10;6&#10;7&#10;8&#10;16&#10;32&#10;64"
             textWhenNonSelected="Num Steps" textWhenNoItems="(no choices)"/>
   <LABEL name="new seq speed" id="af187074393a392a" memberName="labelSeqSpeed"
          virtualName="" explicitFocusOrder="0" pos="33 106 103 20" textCol="ffffffff"
@@ -91,6 +91,10 @@ private:
     std::array<ParamStepped<eOnOffToggle>*, 8> currStepOnOff;
 
     int lastSeqNotePos = -1;
+    bool showsRandomNotes = false;  //!< the step sliders show the notes of the random play mode
+
+    //! \brief shows the notes the random play mode plays instead of the step notes
+    void updateRandomNotes();
     //[/UserVariables]
 
     //==============================================================================
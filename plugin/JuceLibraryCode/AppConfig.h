@@ -34,6 +34,7 @@
 #define JUCE_MODULE_AVAILABLE_juce_graphics                 1
 #define JUCE_MODULE_AVAILABLE_juce_gui_basics               1
 #define JUCE_MODULE_AVAILABLE_juce_gui_extra                1
+#define JUCE_MODULE_AVAILABLE_juce_opengl                   1
 
 //==============================================================================
 #ifndef    JUCE_STANDALONE_APPLICATION
@@ -229,10 +230,10 @@
  #define JucePlugin_MaxNumInputChannels    0
 #endif
 #ifndef  JucePlugin_MaxNumOutputChannels
- #define JucePlugin_MaxNumOutputChannels   2
+ #define JucePlugin_MaxNumOutputChannels   8
 #endif
 #ifndef  JucePlugin_PreferredChannelConfigurations
- #define JucePlugin_PreferredChannelConfigurations  {0, 1}, {0, 2}
+ #define JucePlugin_PreferredChannelConfigurations  {0, 1}, {0, 2}, {0, 8}
 #endif
 #ifndef  JucePlugin_IsSynth
  #define JucePlugin_IsSynth                1
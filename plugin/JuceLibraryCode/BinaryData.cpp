@@ -3065,6 +3065,4112 @@ static const unsigned char temp_binary_data_20[] =
 const char* triplets_png = (const char*) temp_binary_data_20;
 
 
+//================== init.xml ==================
+static const unsigned char temp_binary_data_21[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"init\">\n"
+"  <osc1fine value=\"0\"/>\n"
+"  <osc1coarse value=\"0\"/>\n"
+"  <osc1panDir value=\"0\"/>\n"
+"  <osc1vol value=\"-6\"/>\n"
+"  <osc1trngAmount value=\"0\"/>\n"
+"  <osc1pulseWidth value=\"0.5\"/>\n"
+"  <osc1oscWaveform value=\"0\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"12\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"100\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.66000002622604370117\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"7\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"39\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc1GainModSrc1 value=\"3\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"0\"/>\n"
+"  <osc2coarse value=\"0\"/>\n"
+"  <osc2panDir value=\"0\"/>\n"
+"  <osc2vol value=\"-5.9879913330078125\"/>\n"
+"  <osc2trngAmount value=\"0\"/>\n"
+"  <osc2pulseWidth value=\"0.5\"/>\n"
+"  <osc2oscWaveform value=\"0\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"12\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"100\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0.66000002622604370117\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"7\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"39\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc2GainModSrc1 value=\"3\"/>\n"
+"  <osc2GainModSrc2 value=\"0\"/>\n"
+"  <osc2Activation value=\"0\"/>\n"
+"  <osc3fine value=\"0\"/>\n"
+"  <osc3coarse value=\"0\"/>\n"
+"  <osc3panDir value=\"0\"/>\n"
+"  <osc3vol value=\"-6\"/>\n"
+"  <osc3trngAmount value=\"0\"/>\n"
+"  <osc3pulseWidth value=\"0.5\"/>\n"
+"  <osc3oscWaveform value=\"0\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"12\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"100\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.66000002622604370117\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"7\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"39\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc3GainModSrc1 value=\"3\"/>\n"
+"  <osc3GainModSrc2 value=\"0\"/>\n"
+"  <osc3Activation value=\"0\"/>\n"
+"  <env2envAttack value=\"0.0050000008195638656616\"/>\n"
+"  <env2envDecay value=\"0.049999989569187164307\"/>\n"
+"  <env2envSustain value=\"1\"/>\n"
+"  <env2envRelease value=\"0.5\"/>\n"
+"  <env2envAttackShape value=\"1\"/>\n"
+"  <env2envDecayShape value=\"1\"/>\n"
+"  <env2envReleaseShape value=\"1\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"0.0050000008195638656616\"/>\n"
+"  <env3envDecay value=\"0.049999989569187164307\"/>\n"
+"  <env3envSustain value=\"1\"/>\n"
+"  <env3envRelease value=\"0.5\"/>\n"
+"  <env3envAttackShape value=\"1\"/>\n"
+"  <env3envDecayShape value=\"1\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.0050000008195638656616\"/>\n"
+"  <envvolenvDecay value=\"0.049999989569187164307\"/>\n"
+"  <envvolenvSustain value=\"-6\"/>\n"
+"  <envvolenvRelease value=\"0.5\"/>\n"
+"  <envvolenvAttackShape value=\"1\"/>\n"
+"  <envvolenvDecayShape value=\"1\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"4\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"0\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0\"/>\n"
+"  <lfo1lfo1freq value=\"1\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"4\"/>\n"
+"  <lfo1LFOGainModSrc value=\"0\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"0\"/>\n"
+"  <lfo2lfo1freq value=\"1\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"0\"/>\n"
+"  <lfo2lfoTriplet value=\"0\"/>\n"
+"  <lfo2lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"0\"/>\n"
+"  <lfo3lfo1freq value=\"1\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"4\"/>\n"
+"  <lfo3LFOGainModSrc value=\"0\"/>\n"
+"  <lfo3lfoTriplet value=\"0\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"0\"/>\n"
+"  <filter1lpCutoff value=\"20000\"/>\n"
+"  <filter1hpCutoff value=\"10\"/>\n"
+"  <filter1FILTERResonance value=\"0\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter1filterActivation value=\"0\"/>\n"
+"  <filter2FILTERType value=\"0\"/>\n"
+"  <filter2lpCutoff value=\"20000\"/>\n"
+"  <filter2hpCutoff value=\"10\"/>\n"
+"  <filter2FILTERResonance value=\"0\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"0\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"0\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"4\"/>\n"
+"  <seqNoteLength value=\"4\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"60\"/>\n"
+"  <seqNote1 value=\"62\"/>\n"
+"  <seqNote2 value=\"64\"/>\n"
+"  <seqNote3 value=\"65\"/>\n"
+"  <seqNote4 value=\"67\"/>\n"
+"  <seqNote5 value=\"69\"/>\n"
+"  <seqNote6 value=\"71\"/>\n"
+"  <seqNote7 value=\"72\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"0\"/>\n"
+"  <seqRandomMax value=\"127\"/>\n"
+"  <delWet value=\"0\"/>\n"
+"  <delFeed value=\"0\"/>\n"
+"  <delTime value=\"1000.000244140625\"/>\n"
+"  <delSync value=\"0\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"4\"/>\n"
+"  <delCut value=\"20000\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"0\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"440\"/>\n"
+"  <masterAmp value=\"-6\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorWidth value=\"0.050000004470348358154\"/>\n"
+"  <ChorAmount value=\"0\"/>\n"
+"  <ChorDepth value=\"15\"/>\n"
+"  <chorRate value=\"0.5\"/>\n"
+"  <lowFiActivation value=\"0\"/>\n"
+"  <nBitsLowFi value=\"16\"/>\n"
+"  <clippingActivation value=\"0\"/>\n"
+"  <clippingFactor value=\"0\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"0\"/>\n"
+"  <lfoSection value=\"0\"/>\n"
+"  <filterSection value=\"0\"/>\n"
+"  <fxSection value=\"0\"/>\n"
+"  <seqSection value=\"0\"/>\n"
+"</patch>\n";
+
+const char* init_xml = (const char*) temp_binary_data_21;
+
+//================== cheap hihat.xml ==================
+static const unsigned char temp_binary_data_22[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"\">\n"
+"  <osc1fine value=\"0\"/>\n"
+"  <osc1coarse value=\"0\"/>\n"
+"  <osc1panDir value=\"0\"/>\n"
+"  <osc1vol value=\"-19.550262451171875\"/>\n"
+"  <osc1trngAmount value=\"0\"/>\n"
+"  <osc1pulseWidth value=\"0.5\"/>\n"
+"  <osc1oscWaveform value=\"2\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"56.512500762939453125\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc1GainModSrc1 value=\"4\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"0\"/>\n"
+"  <osc2coarse value=\"0\"/>\n"
+"  <osc2panDir value=\"0\"/>\n"
+"  <osc2vol value=\"-6\"/>\n"
+"  <osc2trngAmount value=\"0\"/>\n"
+"  <osc2pulseWidth value=\"0.5\"/>\n"
+"  <osc2oscWaveform value=\"0\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc2GainModSrc1 value=\"0\"/>\n"
+"  <osc2GainModSrc2 value=\"0\"/>\n"
+"  <osc2Activation value=\"0\"/>\n"
+"  <osc3fine value=\"0\"/>\n"
+"  <osc3coarse value=\"0\"/>\n"
+"  <osc3panDir value=\"0\"/>\n"
+"  <osc3vol value=\"-6\"/>\n"
+"  <osc3trngAmount value=\"0\"/>\n"
+"  <osc3pulseWidth value=\"0.5\"/>\n"
+"  <osc3oscWaveform value=\"0\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc3GainModSrc1 value=\"0\"/>\n"
+"  <osc3GainModSrc2 value=\"0\"/>\n"
+"  <osc3Activation value=\"0\"/>\n"
+"  <env2envAttack value=\"0.0049999998882412910461\"/>\n"
+"  <env2envDecay value=\"0.049999993294477462769\"/>\n"
+"  <env2envSustain value=\"1\"/>\n"
+"  <env2envRelease value=\"0.5\"/>\n"
+"  <env2envAttackShape value=\"1\"/>\n"
+"  <env2envDecayShape value=\"1\"/>\n"
+"  <env2envReleaseShape value=\"1\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"0.0049999998882412910461\"/>\n"
+"  <env3envDecay value=\"0.049999993294477462769\"/>\n"
+"  <env3envSustain value=\"1\"/>\n"
+"  <env3envRelease value=\"0.5\"/>\n"
+"  <env3envAttackShape value=\"1\"/>\n"
+"  <env3envDecayShape value=\"1\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.0010000000474974513054\"/>\n"
+"  <envvolenvDecay value=\"0.046150267124176025391\"/>\n"
+"  <envvolenvSustain value=\"-96\"/>\n"
+"  <envvolenvRelease value=\"0.28894978761672973633\"/>\n"
+"  <envvolenvAttackShape value=\"1.0335038900375366211\"/>\n"
+"  <envvolenvDecayShape value=\"1.4408063888549804688\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"4.5285000801086425781\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0\"/>\n"
+"  <lfo1lfo1freq value=\"1\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"4\"/>\n"
+"  <lfo1LFOGainModSrc value=\"0\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"0\"/>\n"
+"  <lfo2lfo1freq value=\"1\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"0\"/>\n"
+"  <lfo2lfoTriplet value=\"0\"/>\n"
+"  <lfo2lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"0\"/>\n"
+"  <lfo3lfo1freq value=\"1\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"4\"/>\n"
+"  <lfo3LFOGainModSrc value=\"0\"/>\n"
+"  <lfo3lfoTriplet value=\"0\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"3\"/>\n"
+"  <filter1lpCutoff value=\"20000\"/>\n"
+"  <filter1hpCutoff value=\"10\"/>\n"
+"  <filter1FILTERResonance value=\"4.3843750953674316406\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter1filterActivation value=\"0\"/>\n"
+"  <filter2FILTERType value=\"0\"/>\n"
+"  <filter2lpCutoff value=\"20000\"/>\n"
+"  <filter2hpCutoff value=\"10\"/>\n"
+"  <filter2FILTERResonance value=\"0\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"0\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"0\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"4\"/>\n"
+"  <seqNoteLength value=\"4\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"60\"/>\n"
+"  <seqNote1 value=\"62\"/>\n"
+"  <seqNote2 value=\"64\"/>\n"
+"  <seqNote3 value=\"65\"/>\n"
+"  <seqNote4 value=\"67\"/>\n"
+"  <seqNote5 value=\"69\"/>\n"
+"  <seqNote6 value=\"71\"/>\n"
+"  <seqNote7 value=\"72\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"0\"/>\n"
+"  <seqRandomMax value=\"127\"/>\n"
+"  <delWet value=\"0\"/>\n"
+"  <delFeed value=\"0\"/>\n"
+"  <delTime value=\"545.00006103515625\"/>\n"
+"  <delSync value=\"0\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"4\"/>\n"
+"  <delCut value=\"20000\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"1\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"440\"/>\n"
+"  <masterAmp value=\"-11.224649429321289062\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorWidth value=\"0.050000004470348358154\"/>\n"
+"  <ChorAmount value=\"0\"/>\n"
+"  <ChorDepth value=\"15\"/>\n"
+"  <chorRate value=\"0.5\"/>\n"
+"  <lowFiActivation value=\"1\"/>\n"
+"  <nBitsLowFi value=\"3.7829687595367431641\"/>\n"
+"  <clippingActivation value=\"1\"/>\n"
+"  <clippingFactor value=\"1.8449217081069946289\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"0\"/>\n"
+"  <lfoSection value=\"0\"/>\n"
+"  <filterSection value=\"1\"/>\n"
+"  <fxSection value=\"1\"/>\n"
+"  <seqSection value=\"1\"/>\n"
+"</patch>\n";
+
+const char* cheap_hihat_xml = (const char*) temp_binary_data_22;
+
+//================== cheap kick.xml ==================
+static const unsigned char temp_binary_data_23[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"cheap kick\">\n"
+"  <osc1fine value=\"0\"/>\n"
+"  <osc1coarse value=\"3\"/>\n"
+"  <osc1panDir value=\"0\"/>\n"
+"  <osc1vol value=\"-24\"/>\n"
+"  <osc1trngAmount value=\"0\"/>\n"
+"  <osc1pulseWidth value=\"0.5\"/>\n"
+"  <osc1oscWaveform value=\"0\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"6.5865001678466796875\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"13\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"100\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.66000002622604370117\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"7\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"57\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc1GainModSrc1 value=\"4\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"0\"/>\n"
+"  <osc2coarse value=\"0\"/>\n"
+"  <osc2panDir value=\"0\"/>\n"
+"  <osc2vol value=\"-6\"/>\n"
+"  <osc2trngAmount value=\"0\"/>\n"
+"  <osc2pulseWidth value=\"0.5\"/>\n"
+"  <osc2oscWaveform value=\"0\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"100\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc2GainModSrc1 value=\"0\"/>\n"
+"  <osc2GainModSrc2 value=\"0\"/>\n"
+"  <osc2Activation value=\"0\"/>\n"
+"  <osc3fine value=\"0\"/>\n"
+"  <osc3coarse value=\"0\"/>\n"
+"  <osc3panDir value=\"0\"/>\n"
+"  <osc3vol value=\"-6\"/>\n"
+"  <osc3trngAmount value=\"0\"/>\n"
+"  <osc3pulseWidth value=\"0.5\"/>\n"
+"  <osc3oscWaveform value=\"0\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"100\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc3GainModSrc1 value=\"0\"/>\n"
+"  <osc3GainModSrc2 value=\"0\"/>\n"
+"  <osc3Activation value=\"0\"/>\n"
+"  <env2envAttack value=\"0.048190228641033172607\"/>\n"
+"  <env2envDecay value=\"0.0010000000474974513054\"/>\n"
+"  <env2envSustain value=\"1\"/>\n"
+"  <env2envRelease value=\"0.66727697849273681641\"/>\n"
+"  <env2envAttackShape value=\"1\"/>\n"
+"  <env2envDecayShape value=\"1\"/>\n"
+"  <env2envReleaseShape value=\"1\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"0.0050000008195638656616\"/>\n"
+"  <env3envDecay value=\"0.049999989569187164307\"/>\n"
+"  <env3envSustain value=\"1\"/>\n"
+"  <env3envRelease value=\"0.5\"/>\n"
+"  <env3envAttackShape value=\"1\"/>\n"
+"  <env3envDecayShape value=\"1\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.0050000008195638656616\"/>\n"
+"  <envvolenvDecay value=\"0.1789884418249130249\"/>\n"
+"  <envvolenvSustain value=\"-45.2641448974609375\"/>\n"
+"  <envvolenvRelease value=\"0.0010000000474974513054\"/>\n"
+"  <envvolenvAttackShape value=\"1\"/>\n"
+"  <envvolenvDecayShape value=\"1\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"4\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"0\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0\"/>\n"
+"  <lfo1lfo1freq value=\"1\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"4\"/>\n"
+"  <lfo1LFOGainModSrc value=\"0\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"0\"/>\n"
+"  <lfo2lfo1freq value=\"1\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"0\"/>\n"
+"  <lfo2lfoTriplet value=\"0\"/>\n"
+"  <lfo2lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"0\"/>\n"
+"  <lfo3lfo1freq value=\"1\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"4\"/>\n"
+"  <lfo3LFOGainModSrc value=\"0\"/>\n"
+"  <lfo3lfoTriplet value=\"0\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"0\"/>\n"
+"  <filter1lpCutoff value=\"20000\"/>\n"
+"  <filter1hpCutoff value=\"10\"/>\n"
+"  <filter1FILTERResonance value=\"0\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter1filterActivation value=\"0\"/>\n"
+"  <filter2FILTERType value=\"0\"/>\n"
+"  <filter2lpCutoff value=\"20000\"/>\n"
+"  <filter2hpCutoff value=\"10\"/>\n"
+"  <filter2FILTERResonance value=\"0\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"0\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"0\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"4\"/>\n"
+"  <seqNoteLength value=\"4\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"60\"/>\n"
+"  <seqNote1 value=\"62\"/>\n"
+"  <seqNote2 value=\"64\"/>\n"
+"  <seqNote3 value=\"65\"/>\n"
+"  <seqNote4 value=\"67\"/>\n"
+"  <seqNote5 value=\"69\"/>\n"
+"  <seqNote6 value=\"71\"/>\n"
+"  <seqNote7 value=\"72\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"0\"/>\n"
+"  <seqRandomMax value=\"127\"/>\n"
+"  <delWet value=\"0\"/>\n"
+"  <delFeed value=\"0\"/>\n"
+"  <delTime value=\"1000.000244140625\"/>\n"
+"  <delSync value=\"0\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"4\"/>\n"
+"  <delCut value=\"20000\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"0\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"440\"/>\n"
+"  <masterAmp value=\"-6\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorWidth value=\"0.050000004470348358154\"/>\n"
+"  <ChorAmount value=\"0\"/>\n"
+"  <ChorDepth value=\"15\"/>\n"
+"  <chorRate value=\"0.5\"/>\n"
+"  <lowFiActivation value=\"0\"/>\n"
+"  <nBitsLowFi value=\"16\"/>\n"
+"  <clippingActivation value=\"0\"/>\n"
+"  <clippingFactor value=\"0\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"0\"/>\n"
+"  <lfoSection value=\"0\"/>\n"
+"  <filterSection value=\"0\"/>\n"
+"  <fxSection value=\"0\"/>\n"
+"  <seqSection value=\"0\"/>\n"
+"</patch>\n";
+
+const char* cheap_kick_xml = (const char*) temp_binary_data_23;
+
+//================== cheap kick2.xml ==================
+static const unsigned char temp_binary_data_24[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"kick\">\n"
+"  <osc1fine value=\"0\"/>\n"
+"  <osc1coarse value=\"-36\"/>\n"
+"  <osc1panDir value=\"0\"/>\n"
+"  <osc1vol value=\"-5.9261088371276855469\"/>\n"
+"  <osc1trngAmount value=\"0\"/>\n"
+"  <osc1pulseWidth value=\"0.5\"/>\n"
+"  <osc1oscWaveform value=\"0\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"41.36100006103515625\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"12\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc1GainModSrc1 value=\"0\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"0\"/>\n"
+"  <osc2coarse value=\"0\"/>\n"
+"  <osc2panDir value=\"0\"/>\n"
+"  <osc2vol value=\"-96\"/>\n"
+"  <osc2trngAmount value=\"0\"/>\n"
+"  <osc2pulseWidth value=\"0.5\"/>\n"
+"  <osc2oscWaveform value=\"0\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc2GainModSrc1 value=\"0\"/>\n"
+"  <osc2GainModSrc2 value=\"0\"/>\n"
+"  <osc2Activation value=\"1\"/>\n"
+"  <osc3fine value=\"0\"/>\n"
+"  <osc3coarse value=\"0\"/>\n"
+"  <osc3panDir value=\"0\"/>\n"
+"  <osc3vol value=\"-96\"/>\n"
+"  <osc3trngAmount value=\"0\"/>\n"
+"  <osc3pulseWidth value=\"0.5\"/>\n"
+"  <osc3oscWaveform value=\"0\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc3GainModSrc1 value=\"0\"/>\n"
+"  <osc3GainModSrc2 value=\"0\"/>\n"
+"  <osc3Activation value=\"1\"/>\n"
+"  <env2envAttack value=\"0.0049999998882412910461\"/>\n"
+"  <env2envDecay value=\"0.049999993294477462769\"/>\n"
+"  <env2envSustain value=\"1\"/>\n"
+"  <env2envRelease value=\"0.5\"/>\n"
+"  <env2envAttackShape value=\"1\"/>\n"
+"  <env2envDecayShape value=\"1\"/>\n"
+"  <env2envReleaseShape value=\"1\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"0.0049999998882412910461\"/>\n"
+"  <env3envDecay value=\"0.049999993294477462769\"/>\n"
+"  <env3envSustain value=\"1\"/>\n"
+"  <env3envRelease value=\"0.5\"/>\n"
+"  <env3envAttackShape value=\"1\"/>\n"
+"  <env3envDecayShape value=\"1\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.0010000000474974513054\"/>\n"
+"  <envvolenvDecay value=\"0.097937710583209991455\"/>\n"
+"  <envvolenvSustain value=\"-96\"/>\n"
+"  <envvolenvRelease value=\"0.0010000000474974513054\"/>\n"
+"  <envvolenvAttackShape value=\"1\"/>\n"
+"  <envvolenvDecayShape value=\"1\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"4\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"0\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0\"/>\n"
+"  <lfo1lfo1freq value=\"1\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"4\"/>\n"
+"  <lfo1LFOGainModSrc value=\"0\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"0\"/>\n"
+"  <lfo2lfo1freq value=\"1\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"0\"/>\n"
+"  <lfo2lfoTriplet value=\"0\"/>\n"
+"  <lfo2lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"0\"/>\n"
+"  <lfo3lfo1freq value=\"1\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"4\"/>\n"
+"  <lfo3LFOGainModSrc value=\"0\"/>\n"
+"  <lfo3lfoTriplet value=\"0\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"0\"/>\n"
+"  <filter1lpCutoff value=\"20000\"/>\n"
+"  <filter1hpCutoff value=\"10\"/>\n"
+"  <filter1FILTERResonance value=\"0\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter1filterActivation value=\"0\"/>\n"
+"  <filter2FILTERType value=\"0\"/>\n"
+"  <filter2lpCutoff value=\"20000\"/>\n"
+"  <filter2hpCutoff value=\"10\"/>\n"
+"  <filter2FILTERResonance value=\"0\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"0\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"0\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"4\"/>\n"
+"  <seqNoteLength value=\"4\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"60\"/>\n"
+"  <seqNote1 value=\"62\"/>\n"
+"  <seqNote2 value=\"64\"/>\n"
+"  <seqNote3 value=\"65\"/>\n"
+"  <seqNote4 value=\"67\"/>\n"
+"  <seqNote5 value=\"69\"/>\n"
+"  <seqNote6 value=\"71\"/>\n"
+"  <seqNote7 value=\"72\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"0\"/>\n"
+"  <seqRandomMax value=\"127\"/>\n"
+"  <delWet value=\"0\"/>\n"
+"  <delFeed value=\"0\"/>\n"
+"  <delTime value=\"1000.000244140625\"/>\n"
+"  <delSync value=\"0\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"4\"/>\n"
+"  <delCut value=\"20000\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"0\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"440\"/>\n"
+"  <masterAmp value=\"-6\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorWidth value=\"0.050000004470348358154\"/>\n"
+"  <ChorAmount value=\"0\"/>\n"
+"  <ChorDepth value=\"15\"/>\n"
+"  <chorRate value=\"0.5\"/>\n"
+"  <lowFiActivation value=\"0\"/>\n"
+"  <nBitsLowFi value=\"16\"/>\n"
+"  <clippingActivation value=\"0\"/>\n"
+"  <clippingFactor value=\"0\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"1\"/>\n"
+"  <lfoSection value=\"1\"/>\n"
+"  <filterSection value=\"1\"/>\n"
+"  <fxSection value=\"1\"/>\n"
+"  <seqSection value=\"1\"/>\n"
+"</patch>\n";
+
+const char* cheap_kick2_xml = (const char*) temp_binary_data_24;
+
+//================== cheap snare.xml ==================
+static const unsigned char temp_binary_data_25[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"\">\n"
+"  <osc1fine value=\"0\"/>\n"
+"  <osc1coarse value=\"0\"/>\n"
+"  <osc1panDir value=\"0\"/>\n"
+"  <osc1vol value=\"-0.55061346292495727539\"/>\n"
+"  <osc1trngAmount value=\"0\"/>\n"
+"  <osc1pulseWidth value=\"0.5\"/>\n"
+"  <osc1oscWaveform value=\"2\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc1GainModSrc1 value=\"0\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"0\"/>\n"
+"  <osc2coarse value=\"3\"/>\n"
+"  <osc2panDir value=\"0\"/>\n"
+"  <osc2vol value=\"6.114501953125\"/>\n"
+"  <osc2trngAmount value=\"0.89712500572204589844\"/>\n"
+"  <osc2pulseWidth value=\"0.86436092853546142578\"/>\n"
+"  <osc2oscWaveform value=\"1\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"19.218000411987304688\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"13\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc2GainModSrc1 value=\"0\"/>\n"
+"  <osc2GainModSrc2 value=\"0\"/>\n"
+"  <osc2Activation value=\"1\"/>\n"
+"  <osc3fine value=\"0\"/>\n"
+"  <osc3coarse value=\"0\"/>\n"
+"  <osc3panDir value=\"0\"/>\n"
+"  <osc3vol value=\"-96\"/>\n"
+"  <osc3trngAmount value=\"0\"/>\n"
+"  <osc3pulseWidth value=\"0.5\"/>\n"
+"  <osc3oscWaveform value=\"0\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc3GainModSrc1 value=\"0\"/>\n"
+"  <osc3GainModSrc2 value=\"0\"/>\n"
+"  <osc3Activation value=\"0\"/>\n"
+"  <env2envAttack value=\"0.047361798584461212158\"/>\n"
+"  <env2envDecay value=\"0.72013914585113525391\"/>\n"
+"  <env2envSustain value=\"0.60191804170608520508\"/>\n"
+"  <env2envRelease value=\"0.25813961029052734375\"/>\n"
+"  <env2envAttackShape value=\"1\"/>\n"
+"  <env2envDecayShape value=\"1\"/>\n"
+"  <env2envReleaseShape value=\"1\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"0.0049999998882412910461\"/>\n"
+"  <env3envDecay value=\"0.049999993294477462769\"/>\n"
+"  <env3envSustain value=\"1\"/>\n"
+"  <env3envRelease value=\"0.5\"/>\n"
+"  <env3envAttackShape value=\"1\"/>\n"
+"  <env3envDecayShape value=\"1\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.0049999998882412910461\"/>\n"
+"  <envvolenvDecay value=\"0.067567266523838043213\"/>\n"
+"  <envvolenvSustain value=\"-96\"/>\n"
+"  <envvolenvRelease value=\"0.0010000000474974513054\"/>\n"
+"  <envvolenvAttackShape value=\"1\"/>\n"
+"  <envvolenvDecayShape value=\"1\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"4\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"0\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0\"/>\n"
+"  <lfo1lfo1freq value=\"1\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"4\"/>\n"
+"  <lfo1LFOGainModSrc value=\"0\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"0\"/>\n"
+"  <lfo2lfo1freq value=\"1\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"0\"/>\n"
+"  <lfo2lfoTriplet value=\"0\"/>\n"
+"  <lfo2lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"0\"/>\n"
+"  <lfo3lfo1freq value=\"1\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"4\"/>\n"
+"  <lfo3LFOGainModSrc value=\"0\"/>\n"
+"  <lfo3lfoTriplet value=\"0\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"0\"/>\n"
+"  <filter1lpCutoff value=\"20000\"/>\n"
+"  <filter1hpCutoff value=\"10\"/>\n"
+"  <filter1FILTERResonance value=\"0\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter1filterActivation value=\"0\"/>\n"
+"  <filter2FILTERType value=\"0\"/>\n"
+"  <filter2lpCutoff value=\"10138.0009765625\"/>\n"
+"  <filter2hpCutoff value=\"1746.999755859375\"/>\n"
+"  <filter2FILTERResonance value=\"0\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"0\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"0\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"4\"/>\n"
+"  <seqNoteLength value=\"4\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"60\"/>\n"
+"  <seqNote1 value=\"62\"/>\n"
+"  <seqNote2 value=\"64\"/>\n"
+"  <seqNote3 value=\"65\"/>\n"
+"  <seqNote4 value=\"67\"/>\n"
+"  <seqNote5 value=\"69\"/>\n"
+"  <seqNote6 value=\"71\"/>\n"
+"  <seqNote7 value=\"72\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"0\"/>\n"
+"  <seqRandomMax value=\"127\"/>\n"
+"  <delWet value=\"0\"/>\n"
+"  <delFeed value=\"0\"/>\n"
+"  <delTime value=\"1000.000244140625\"/>\n"
+"  <delSync value=\"0\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"4\"/>\n"
+"  <delCut value=\"20000\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"0\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"440\"/>\n"
+"  <masterAmp value=\"-6\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorWidth value=\"0.050000004470348358154\"/>\n"
+"  <ChorAmount value=\"0\"/>\n"
+"  <ChorDepth value=\"15\"/>\n"
+"  <chorRate value=\"0.5\"/>\n"
+"  <lowFiActivation value=\"1\"/>\n"
+"  <nBitsLowFi value=\"5.017421722412109375\"/>\n"
+"  <clippingActivation value=\"1\"/>\n"
+"  <clippingFactor value=\"0\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"1\"/>\n"
+"  <lfoSection value=\"1\"/>\n"
+"  <filterSection value=\"1\"/>\n"
+"  <fxSection value=\"1\"/>\n"
+"  <seqSection value=\"1\"/>\n"
+"</patch>\n";
+
+const char* cheap_snare_xml = (const char*) temp_binary_data_25;
+
+//================== death by organs.xml ==================
+static const unsigned char temp_binary_data_26[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"\">\n"
+"  <osc1fine value=\"0\"/>\n"
+"  <osc1coarse value=\"-24\"/>\n"
+"  <osc1panDir value=\"0\"/>\n"
+"  <osc1vol value=\"-6\"/>\n"
+"  <osc1trngAmount value=\"0\"/>\n"
+"  <osc1pulseWidth value=\"0.33318564295768737793\"/>\n"
+"  <osc1oscWaveform value=\"1\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"48\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc1GainModSrc1 value=\"0\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"0\"/>\n"
+"  <osc2coarse value=\"24\"/>\n"
+"  <osc2panDir value=\"0\"/>\n"
+"  <osc2vol value=\"-9.96704864501953125\"/>\n"
+"  <osc2trngAmount value=\"0.084718771278858184814\"/>\n"
+"  <osc2pulseWidth value=\"0.16502378880977630615\"/>\n"
+"  <osc2oscWaveform value=\"0\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"48\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"8.8156251907348632812\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"10\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0.10175000131130218506\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"0.47304686903953552246\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc2GainModSrc1 value=\"0\"/>\n"
+"  <osc2GainModSrc2 value=\"0\"/>\n"
+"  <osc2Activation value=\"1\"/>\n"
+"  <osc3fine value=\"0\"/>\n"
+"  <osc3coarse value=\"-12\"/>\n"
+"  <osc3panDir value=\"0\"/>\n"
+"  <osc3vol value=\"-4.77978515625\"/>\n"
+"  <osc3trngAmount value=\"0.18107813596725463867\"/>\n"
+"  <osc3pulseWidth value=\"0.54598349332809448242\"/>\n"
+"  <osc3oscWaveform value=\"1\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"48\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.23649999499320983887\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"10\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc3GainModSrc1 value=\"0\"/>\n"
+"  <osc3GainModSrc2 value=\"0\"/>\n"
+"  <osc3Activation value=\"1\"/>\n"
+"  <env2envAttack value=\"0.030773900449275970459\"/>\n"
+"  <env2envDecay value=\"0.40181592106819152832\"/>\n"
+"  <env2envSustain value=\"0\"/>\n"
+"  <env2envRelease value=\"0.61969220638275146484\"/>\n"
+"  <env2envAttackShape value=\"0.60805630683898925781\"/>\n"
+"  <env2envDecayShape value=\"1\"/>\n"
+"  <env2envReleaseShape value=\"1\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"3.5796248912811279297\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"0.0010000000474974513054\"/>\n"
+"  <env3envDecay value=\"0.0010000000474974513054\"/>\n"
+"  <env3envSustain value=\"0\"/>\n"
+"  <env3envRelease value=\"0.0010000000474974513054\"/>\n"
+"  <env3envAttackShape value=\"2.9238026142120361328\"/>\n"
+"  <env3envDecayShape value=\"1.0948297977447509766\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"7.5819997787475585938\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"7\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.015528158284723758698\"/>\n"
+"  <envvolenvDecay value=\"0.8079363703727722168\"/>\n"
+"  <envvolenvSustain value=\"0\"/>\n"
+"  <envvolenvRelease value=\"0.023444229736924171448\"/>\n"
+"  <envvolenvAttackShape value=\"3.7817604541778564453\"/>\n"
+"  <envvolenvDecayShape value=\"0.59775274991989135742\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"4\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"0\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0.0030998461879789829254\"/>\n"
+"  <lfo1lfo1freq value=\"0.010098341852426528931\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"1\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"16\"/>\n"
+"  <lfo1LFOGainModSrc value=\"1\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"1.1698004007339477539\"/>\n"
+"  <lfo2lfo1freq value=\"1.6153315305709838867\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"1\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"0\"/>\n"
+"  <lfo2lfoTriplet value=\"0\"/>\n"
+"  <lfo2lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"9.612445831298828125\"/>\n"
+"  <lfo3lfo1freq value=\"39.080078125\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"4\"/>\n"
+"  <lfo3LFOGainModSrc value=\"0\"/>\n"
+"  <lfo3lfoTriplet value=\"0\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"1\"/>\n"
+"  <filter1lpCutoff value=\"43\"/>\n"
+"  <filter1hpCutoff value=\"65\"/>\n"
+"  <filter1FILTERResonance value=\"5.4014072418212890625\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"3.1763751506805419922\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"9\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"5.5940623283386230469\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"7\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"6.144374847412109375\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"7\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter1filterActivation value=\"1\"/>\n"
+"  <filter2FILTERType value=\"1\"/>\n"
+"  <filter2lpCutoff value=\"106.00000762939453125\"/>\n"
+"  <filter2hpCutoff value=\"59\"/>\n"
+"  <filter2FILTERResonance value=\"0\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"1.3303749561309814453\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"9\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"0.1875\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"9\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"1\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"0\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"4\"/>\n"
+"  <seqNoteLength value=\"4\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"60\"/>\n"
+"  <seqNote1 value=\"62\"/>\n"
+"  <seqNote2 value=\"64\"/>\n"
+"  <seqNote3 value=\"65\"/>\n"
+"  <seqNote4 value=\"67\"/>\n"
+"  <seqNote5 value=\"69\"/>\n"
+"  <seqNote6 value=\"71\"/>\n"
+"  <seqNote7 value=\"72\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"0\"/>\n"
+"  <seqRandomMax value=\"127\"/>\n"
+"  <delWet value=\"0.29670315980911254883\"/>\n"
+"  <delFeed value=\"0.22382812201976776123\"/>\n"
+"  <delTime value=\"1\"/>\n"
+"  <delSync value=\"0\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"2\"/>\n"
+"  <delCut value=\"20000\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"1\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"440\"/>\n"
+"  <masterAmp value=\"-6\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"1\"/>\n"
+"  <chorActivation value=\"1\"/>\n"
+"  <chorWidth value=\"0.079999998211860656738\"/>\n"
+"  <ChorAmount value=\"0.04543748125433921814\"/>\n"
+"  <ChorDepth value=\"5.7225780487060546875\"/>\n"
+"  <chorRate value=\"0.32640001177787780762\"/>\n"
+"  <lowFiActivation value=\"1\"/>\n"
+"  <nBitsLowFi value=\"1.538359522819519043\"/>\n"
+"  <clippingActivation value=\"1\"/>\n"
+"  <clippingFactor value=\"14.022266387939453125\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"0\"/>\n"
+"  <lfoSection value=\"0\"/>\n"
+"  <filterSection value=\"0\"/>\n"
+"  <fxSection value=\"0\"/>\n"
+"  <seqSection value=\"1\"/>\n"
+"</patch>\n";
+
+const char* death_by_organs_xml = (const char*) temp_binary_data_26;
+
+//================== double wobbler.xml ==================
+static const unsigned char temp_binary_data_27[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"double wobber\">\n"
+"  <osc1fine value=\"0\"/>\n"
+"  <osc1coarse value=\"-12\"/>\n"
+"  <osc1panDir value=\"0\"/>\n"
+"  <osc1vol value=\"6\"/>\n"
+"  <osc1trngAmount value=\"0.53159999847412109375\"/>\n"
+"  <osc1pulseWidth value=\"0.65530002117156982422\"/>\n"
+"  <osc1oscWaveform value=\"1\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"23\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"100\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.72420001029968261719\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"13\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"39\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc1GainModSrc1 value=\"0\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"-5\"/>\n"
+"  <osc2coarse value=\"12\"/>\n"
+"  <osc2panDir value=\"-10\"/>\n"
+"  <osc2vol value=\"-12.5\"/>\n"
+"  <osc2trngAmount value=\"0\"/>\n"
+"  <osc2pulseWidth value=\"0.19110000133514404297\"/>\n"
+"  <osc2oscWaveform value=\"0\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"17\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"9\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0.66000002622604370117\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"0.46840000152587890625\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"7\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"14\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"39\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"50.200000762939453125\"/>\n"
+"  <osc2GainModSrc1 value=\"0\"/>\n"
+"  <osc2GainModSrc2 value=\"14\"/>\n"
+"  <osc2Activation value=\"1\"/>\n"
+"  <osc3fine value=\"4.99999237060546875\"/>\n"
+"  <osc3coarse value=\"-12\"/>\n"
+"  <osc3panDir value=\"10\"/>\n"
+"  <osc3vol value=\"-7.5\"/>\n"
+"  <osc3trngAmount value=\"0\"/>\n"
+"  <osc3pulseWidth value=\"0.053599998354911804199\"/>\n"
+"  <osc3oscWaveform value=\"0\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"25\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"9\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.66000002622604370117\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.036100000143051147461\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"7\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"9\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"39\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"50\"/>\n"
+"  <osc3GainModSrc1 value=\"0\"/>\n"
+"  <osc3GainModSrc2 value=\"14\"/>\n"
+"  <osc3Activation value=\"1\"/>\n"
+"  <env2envAttack value=\"0.73799997568130493164\"/>\n"
+"  <env2envDecay value=\"0.14000000059604644775\"/>\n"
+"  <env2envSustain value=\"1\"/>\n"
+"  <env2envRelease value=\"0.065999999642372131348\"/>\n"
+"  <env2envAttackShape value=\"1\"/>\n"
+"  <env2envDecayShape value=\"1\"/>\n"
+"  <env2envReleaseShape value=\"1\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"2.5669996738433837891\"/>\n"
+"  <env3envDecay value=\"0.049999989569187164307\"/>\n"
+"  <env3envSustain value=\"1\"/>\n"
+"  <env3envRelease value=\"0.5\"/>\n"
+"  <env3envAttackShape value=\"1\"/>\n"
+"  <env3envDecayShape value=\"1\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.043999999761581420898\"/>\n"
+"  <envvolenvDecay value=\"0.049999989569187164307\"/>\n"
+"  <envvolenvSustain value=\"-6\"/>\n"
+"  <envvolenvRelease value=\"0.048999994993209838867\"/>\n"
+"  <envvolenvAttackShape value=\"1\"/>\n"
+"  <envvolenvDecayShape value=\"1\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"4\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"0\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0.6470000147819519043\"/>\n"
+"  <lfo1lfo1freq value=\"1\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"1\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"1\"/>\n"
+"  <lfo1LFOGainModSrc value=\"4\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"0\"/>\n"
+"  <lfo2lfo1freq value=\"1\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"1\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"1\"/>\n"
+"  <lfo2lfoTriplet value=\"1\"/>\n"
+"  <lfo2lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"0.045000009238719940186\"/>\n"
+"  <lfo3lfo1freq value=\"1\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"1\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"8\"/>\n"
+"  <lfo3LFOGainModSrc value=\"7\"/>\n"
+"  <lfo3lfoTriplet value=\"1\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"2\"/>\n"
+"  <filter1lpCutoff value=\"8702.9990234375\"/>\n"
+"  <filter1hpCutoff value=\"48\"/>\n"
+"  <filter1FILTERResonance value=\"5.9399995803833007812\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"4.2199997901916503906\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"10\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"2.7899999618530273438\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"10\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter1filterActivation value=\"1\"/>\n"
+"  <filter2FILTERType value=\"0\"/>\n"
+"  <filter2lpCutoff value=\"3523.999755859375\"/>\n"
+"  <filter2hpCutoff value=\"10\"/>\n"
+"  <filter2FILTERResonance value=\"5.090000152587890625\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"1.1900000572204589844\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"11\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5.2600002288818359375\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"1\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"0\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"4\"/>\n"
+"  <seqNoteLength value=\"4\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"60\"/>\n"
+"  <seqNote1 value=\"62\"/>\n"
+"  <seqNote2 value=\"64\"/>\n"
+"  <seqNote3 value=\"65\"/>\n"
+"  <seqNote4 value=\"67\"/>\n"
+"  <seqNote5 value=\"69\"/>\n"
+"  <seqNote6 value=\"71\"/>\n"
+"  <seqNote7 value=\"72\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"0\"/>\n"
+"  <seqRandomMax value=\"127\"/>\n"
+"  <delWet value=\"0.40999999642372131348\"/>\n"
+"  <delFeed value=\"0.88999998569488525391\"/>\n"
+"  <delTime value=\"1\"/>\n"
+"  <delSync value=\"0\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"4\"/>\n"
+"  <delCut value=\"8015.00048828125\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"1\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"440\"/>\n"
+"  <masterAmp value=\"-5.1332907676696777344\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"1\"/>\n"
+"  <chorActivation value=\"1\"/>\n"
+"  <chorWidth value=\"0.029300000518560409546\"/>\n"
+"  <ChorAmount value=\"0.050000000745058059692\"/>\n"
+"  <ChorDepth value=\"5.5999999046325683594\"/>\n"
+"  <chorRate value=\"0.18500000238418579102\"/>\n"
+"  <lowFiActivation value=\"1\"/>\n"
+"  <nBitsLowFi value=\"5.5999999046325683594\"/>\n"
+"  <clippingActivation value=\"1\"/>\n"
+"  <clippingFactor value=\"3\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"0\"/>\n"
+"  <lfoSection value=\"0\"/>\n"
+"  <filterSection value=\"0\"/>\n"
+"  <fxSection value=\"0\"/>\n"
+"  <seqSection value=\"1\"/>\n"
+"</patch>\n";
+
+const char* double_wobbler_xml = (const char*) temp_binary_data_27;
+
+//================== Filter Distortion.xml ==================
+static const unsigned char temp_binary_data_28[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"\">\n"
+"  <osc1fine value=\"0\"/>\n"
+"  <osc1coarse value=\"0\"/>\n"
+"  <osc1panDir value=\"0\"/>\n"
+"  <osc1vol value=\"-5.2476191520690917969\"/>\n"
+"  <osc1trngAmount value=\"0\"/>\n"
+"  <osc1pulseWidth value=\"0.49589625000953674316\"/>\n"
+"  <osc1oscWaveform value=\"0\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc1OSCGainModSrc1 value=\"0\"/>\n"
+"  <osc1OSCGainModSrc2 value=\"0\"/>\n"
+"  <osc2fine value=\"18.90625\"/>\n"
+"  <osc2coarse value=\"0\"/>\n"
+"  <osc2panDir value=\"0\"/>\n"
+"  <osc2vol value=\"-5.6981058120727539062\"/>\n"
+"  <osc2trngAmount value=\"0\"/>\n"
+"  <osc2pulseWidth value=\"0.5\"/>\n"
+"  <osc2oscWaveform value=\"0\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc2OSCGainModSrc1 value=\"0\"/>\n"
+"  <osc2OSCGainModSrc2 value=\"0\"/>\n"
+"  <osc3fine value=\"3.48438262939453125\"/>\n"
+"  <osc3coarse value=\"0\"/>\n"
+"  <osc3panDir value=\"0\"/>\n"
+"  <osc3vol value=\"-96\"/>\n"
+"  <osc3trngAmount value=\"0\"/>\n"
+"  <osc3pulseWidth value=\"0.5\"/>\n"
+"  <osc3oscWaveform value=\"0\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc3OSCGainModSrc1 value=\"0\"/>\n"
+"  <osc3OSCGainModSrc2 value=\"0\"/>\n"
+"  <env2envAttack value=\"0.0049999998882412910461\"/>\n"
+"  <env2envDecay value=\"0.21125307679176330566\"/>\n"
+"  <env2envSustain value=\"0\"/>\n"
+"  <env2envRelease value=\"0.5\"/>\n"
+"  <env2envAttackShape value=\"1\"/>\n"
+"  <env2envDecayShape value=\"1\"/>\n"
+"  <env2envReleaseShape value=\"1\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"0.0049999998882412910461\"/>\n"
+"  <env3envDecay value=\"0.050000000745058059692\"/>\n"
+"  <env3envSustain value=\"1\"/>\n"
+"  <env3envRelease value=\"0.5\"/>\n"
+"  <env3envAttackShape value=\"1\"/>\n"
+"  <env3envDecayShape value=\"1\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.0049999998882412910461\"/>\n"
+"  <envvolenvDecay value=\"0.95035773515701293945\"/>\n"
+"  <envvolenvSustain value=\"-96\"/>\n"
+"  <envvolenvRelease value=\"0.19665153324604034424\"/>\n"
+"  <envvolenvAttackShape value=\"1\"/>\n"
+"  <envvolenvDecayShape value=\"1\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"4\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"0\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0\"/>\n"
+"  <lfo1lfo1freq value=\"1\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"4\"/>\n"
+"  <lfo1LFOGainModSrc value=\"0\"/>\n"
+"  <lfoTriplet value=\"0\"/>\n"
+"  <lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"0\"/>\n"
+"  <lfo2lfo1freq value=\"1\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"0\"/>\n"
+"  <lfoTriplet value=\"0\"/>\n"
+"  <lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"0\"/>\n"
+"  <lfo3lfo1freq value=\"1\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"4\"/>\n"
+"  <lfo3LFOGainModSrc value=\"0\"/>\n"
+"  <lfoTriplet value=\"0\"/>\n"
+"  <lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"3\"/>\n"
+"  <filter1lpCutoff value=\"28\"/>\n"
+"  <filter1hpCutoff value=\"10\"/>\n"
+"  <filter1FILTERResonance value=\"5.305881500244140625\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"6.4875001907348632812\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"13\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filterActivation value=\"1\"/>\n"
+"  <filter2FILTERType value=\"0\"/>\n"
+"  <filter2lpCutoff value=\"20000\"/>\n"
+"  <filter2hpCutoff value=\"10\"/>\n"
+"  <filter2FILTERResonance value=\"0\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filterActivation value=\"1\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"2\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"8\"/>\n"
+"  <seqNoteLength value=\"4\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"92\"/>\n"
+"  <seqNote1 value=\"25\"/>\n"
+"  <seqNote2 value=\"101\"/>\n"
+"  <seqNote3 value=\"100\"/>\n"
+"  <seqNote4 value=\"112\"/>\n"
+"  <seqNote5 value=\"8\"/>\n"
+"  <seqNote6 value=\"95\"/>\n"
+"  <seqNote7 value=\"45\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"0\"/>\n"
+"  <seqRandomMax value=\"127\"/>\n"
+"  <delWet value=\"0.46282812952995300293\"/>\n"
+"  <delFeed value=\"0.41309374570846557617\"/>\n"
+"  <delTime value=\"340.909088134765625\"/>\n"
+"  <delSync value=\"1\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"8\"/>\n"
+"  <delCut value=\"6009\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"1\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"1\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"440\"/>\n"
+"  <masterAmp value=\"-9.5457592010498046875\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorWidth value=\"0.050000000745058059692\"/>\n"
+"  <ChorAmount value=\"0\"/>\n"
+"  <ChorDepth value=\"15\"/>\n"
+"  <chorRate value=\"0.5\"/>\n"
+"  <lowFiActivation value=\"0\"/>\n"
+"  <nBitsLowFi value=\"16\"/>\n"
+"  <clippingActivation value=\"0\"/>\n"
+"  <clippingFactor value=\"0\"/>\n"
+"</patch>\n";
+
+const char* Filter_Distortion_xml = (const char*) temp_binary_data_28;
+
+//================== flashizm.xml ==================
+static const unsigned char temp_binary_data_29[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"flashizn\">\n"
+"  <osc1fine value=\"0\"/>\n"
+"  <osc1coarse value=\"36\"/>\n"
+"  <osc1panDir value=\"36.600006103515625\"/>\n"
+"  <osc1vol value=\"-2.4501345157623291016\"/>\n"
+"  <osc1trngAmount value=\"0\"/>\n"
+"  <osc1pulseWidth value=\"0.36782249808311462402\"/>\n"
+"  <osc1oscWaveform value=\"0\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"11.993249893188476562\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"9\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"71.84375\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"13\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.29857811331748962402\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"9\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc1GainModSrc1 value=\"0\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"0\"/>\n"
+"  <osc2coarse value=\"36\"/>\n"
+"  <osc2panDir value=\"77.8125\"/>\n"
+"  <osc2vol value=\"-6.99554443359375\"/>\n"
+"  <osc2trngAmount value=\"0.53523439168930053711\"/>\n"
+"  <osc2pulseWidth value=\"0.66627842187881469727\"/>\n"
+"  <osc2oscWaveform value=\"1\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"11.934749603271484375\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"10\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"33.43906402587890625\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"13\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"6.3569998741149902344\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc2GainModSrc1 value=\"9\"/>\n"
+"  <osc2GainModSrc2 value=\"0\"/>\n"
+"  <osc2Activation value=\"1\"/>\n"
+"  <osc3fine value=\"0\"/>\n"
+"  <osc3coarse value=\"0\"/>\n"
+"  <osc3panDir value=\"-8.4656219482421875\"/>\n"
+"  <osc3vol value=\"-23.8235931396484375\"/>\n"
+"  <osc3trngAmount value=\"0.68768751621246337891\"/>\n"
+"  <osc3pulseWidth value=\"0.5\"/>\n"
+"  <osc3oscWaveform value=\"1\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"35.951999664306640625\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"11\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"23.621875762939453125\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"10\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"57.163501739501953125\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"14.432999610900878906\"/>\n"
+"  <osc3GainModSrc1 value=\"14\"/>\n"
+"  <osc3GainModSrc2 value=\"9\"/>\n"
+"  <osc3Activation value=\"1\"/>\n"
+"  <env2envAttack value=\"0.63657778501510620117\"/>\n"
+"  <env2envDecay value=\"0.049999993294477462769\"/>\n"
+"  <env2envSustain value=\"1\"/>\n"
+"  <env2envRelease value=\"2.4001791477203369141\"/>\n"
+"  <env2envAttackShape value=\"1\"/>\n"
+"  <env2envDecayShape value=\"1\"/>\n"
+"  <env2envReleaseShape value=\"1\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"5\"/>\n"
+"  <env3envDecay value=\"0.049999993294477462769\"/>\n"
+"  <env3envSustain value=\"1\"/>\n"
+"  <env3envRelease value=\"4.2122507095336914062\"/>\n"
+"  <env3envAttackShape value=\"1\"/>\n"
+"  <env3envDecayShape value=\"1\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"1.284420013427734375\"/>\n"
+"  <envvolenvDecay value=\"0.092599049210548400879\"/>\n"
+"  <envvolenvSustain value=\"-6.19097900390625\"/>\n"
+"  <envvolenvRelease value=\"2.5050885677337646484\"/>\n"
+"  <envvolenvAttackShape value=\"0.52534401416778564453\"/>\n"
+"  <envvolenvDecayShape value=\"1\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"4\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"0\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0.075328417122364044189\"/>\n"
+"  <lfo1lfo1freq value=\"0.010448964312672615051\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"4\"/>\n"
+"  <lfo1LFOGainModSrc value=\"0\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"3.9149498939514160156\"/>\n"
+"  <lfo2lfo1freq value=\"11.4253082275390625\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"1\"/>\n"
+"  <lfo2lfoTriplet value=\"0\"/>\n"
+"  <lfo2lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"7.9626922607421875\"/>\n"
+"  <lfo3lfo1freq value=\"0.20445798337459564209\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"1\"/>\n"
+"  <lfo3lfo1wave value=\"1\"/>\n"
+"  <lfo3notelength value=\"16\"/>\n"
+"  <lfo3LFOGainModSrc value=\"7\"/>\n"
+"  <lfo3lfoTriplet value=\"1\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"0\"/>\n"
+"  <filter1lpCutoff value=\"4840.99951171875\"/>\n"
+"  <filter1hpCutoff value=\"10\"/>\n"
+"  <filter1FILTERResonance value=\"3.1439061164855957031\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"1.3454999923706054688\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"10\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter1filterActivation value=\"1\"/>\n"
+"  <filter2FILTERType value=\"3\"/>\n"
+"  <filter2lpCutoff value=\"20000\"/>\n"
+"  <filter2hpCutoff value=\"1423.999755859375\"/>\n"
+"  <filter2FILTERResonance value=\"2.2715620994567871094\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"1.4263750314712524414\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"11\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"1\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"0\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"4\"/>\n"
+"  <seqNoteLength value=\"4\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"60\"/>\n"
+"  <seqNote1 value=\"62\"/>\n"
+"  <seqNote2 value=\"64\"/>\n"
+"  <seqNote3 value=\"65\"/>\n"
+"  <seqNote4 value=\"67\"/>\n"
+"  <seqNote5 value=\"69\"/>\n"
+"  <seqNote6 value=\"71\"/>\n"
+"  <seqNote7 value=\"72\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"0\"/>\n"
+"  <seqRandomMax value=\"127\"/>\n"
+"  <delWet value=\"0.70973438024520874023\"/>\n"
+"  <delFeed value=\"0.14770303666591644287\"/>\n"
+"  <delTime value=\"545.45452880859375\"/>\n"
+"  <delSync value=\"1\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"4\"/>\n"
+"  <delCut value=\"9372\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"1\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"440\"/>\n"
+"  <masterAmp value=\"-6\"/>\n"
+"  <masterPan value=\"0.45072114467620849609\"/>\n"
+"  <chorActivation value=\"1\"/>\n"
+"  <chorActivation value=\"1\"/>\n"
+"  <chorWidth value=\"0.065899297595024108887\"/>\n"
+"  <ChorAmount value=\"0.32556250691413879395\"/>\n"
+"  <ChorDepth value=\"11.073985099792480469\"/>\n"
+"  <chorRate value=\"0.33493125438690185547\"/>\n"
+"  <lowFiActivation value=\"1\"/>\n"
+"  <nBitsLowFi value=\"5.3778905868530273438\"/>\n"
+"  <clippingActivation value=\"0\"/>\n"
+"  <clippingFactor value=\"0\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"0\"/>\n"
+"  <lfoSection value=\"0\"/>\n"
+"  <filterSection value=\"0\"/>\n"
+"  <fxSection value=\"0\"/>\n"
+"  <seqSection value=\"1\"/>\n"
+"</patch>\n";
+
+const char* flashizm_xml = (const char*) temp_binary_data_29;
+
+//================== le wob.xml ==================
+static const unsigned char temp_binary_data_30[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"\">\n"
+"  <osc1fine value=\"-5\"/>\n"
+"  <osc1coarse value=\"-12\"/>\n"
+"  <osc1panDir value=\"-8.83437347412109375\"/>\n"
+"  <osc1vol value=\"-3\"/>\n"
+"  <osc1trngAmount value=\"0\"/>\n"
+"  <osc1pulseWidth value=\"0.29994222521781921387\"/>\n"
+"  <osc1oscWaveform value=\"0\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"35.93619537353515625\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"48\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"21.59375\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"11\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.13670311868190765381\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"11\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"38.948398590087890625\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc1GainModSrc1 value=\"3\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"4.99999237060546875\"/>\n"
+"  <osc2coarse value=\"-24\"/>\n"
+"  <osc2panDir value=\"8.18125152587890625\"/>\n"
+"  <osc2vol value=\"-3\"/>\n"
+"  <osc2trngAmount value=\"0\"/>\n"
+"  <osc2pulseWidth value=\"0.14530126750469207764\"/>\n"
+"  <osc2oscWaveform value=\"0\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"36.026432037353515625\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"48\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"21.396875381469726562\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"11\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0.67631173133850097656\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"13\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"38.985729217529296875\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc2GainModSrc1 value=\"3\"/>\n"
+"  <osc2GainModSrc2 value=\"0\"/>\n"
+"  <osc2Activation value=\"1\"/>\n"
+"  <osc3fine value=\"0\"/>\n"
+"  <osc3coarse value=\"-24\"/>\n"
+"  <osc3panDir value=\"0\"/>\n"
+"  <osc3vol value=\"3\"/>\n"
+"  <osc3trngAmount value=\"0.35890620946884155273\"/>\n"
+"  <osc3pulseWidth value=\"0.5\"/>\n"
+"  <osc3oscWaveform value=\"1\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"35.99613189697265625\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"100\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.3543796241283416748\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.26723438501358032227\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"7\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"1\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"38.997531890869140625\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc3GainModSrc1 value=\"3\"/>\n"
+"  <osc3GainModSrc2 value=\"0\"/>\n"
+"  <osc3Activation value=\"1\"/>\n"
+"  <env2envAttack value=\"2.1080036163330078125\"/>\n"
+"  <env2envDecay value=\"0.049999989569187164307\"/>\n"
+"  <env2envSustain value=\"1\"/>\n"
+"  <env2envRelease value=\"0.5\"/>\n"
+"  <env2envAttackShape value=\"1\"/>\n"
+"  <env2envDecayShape value=\"1\"/>\n"
+"  <env2envReleaseShape value=\"1\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"0.0050000008195638656616\"/>\n"
+"  <env3envDecay value=\"0.049999989569187164307\"/>\n"
+"  <env3envSustain value=\"1\"/>\n"
+"  <env3envRelease value=\"0.5\"/>\n"
+"  <env3envAttackShape value=\"1\"/>\n"
+"  <env3envDecayShape value=\"1\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.0050000008195638656616\"/>\n"
+"  <envvolenvDecay value=\"0.049999989569187164307\"/>\n"
+"  <envvolenvSustain value=\"0\"/>\n"
+"  <envvolenvRelease value=\"0.05953119322657585144\"/>\n"
+"  <envvolenvAttackShape value=\"1\"/>\n"
+"  <envvolenvDecayShape value=\"1\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"4\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"0\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0.079688936471939086914\"/>\n"
+"  <lfo1lfo1freq value=\"1\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"1\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"4\"/>\n"
+"  <lfo1LFOGainModSrc value=\"0\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"0\"/>\n"
+"  <lfo2lfo1freq value=\"50\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"1\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"2\"/>\n"
+"  <lfo2LFOGainModSrc value=\"7\"/>\n"
+"  <lfo2lfoTriplet value=\"0\"/>\n"
+"  <lfo2lfoDottedLength value=\"1\"/>\n"
+"  <lfo3lfoFadein value=\"0\"/>\n"
+"  <lfo3lfo1freq value=\"1\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"1\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"2\"/>\n"
+"  <lfo3LFOGainModSrc value=\"7\"/>\n"
+"  <lfo3lfoTriplet value=\"0\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"1\"/>\n"
+"  <filter1lpCutoff value=\"132.0000152587890625\"/>\n"
+"  <filter1hpCutoff value=\"24.999998092651367188\"/>\n"
+"  <filter1FILTERResonance value=\"0\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"6.7366247177124023438\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"1.1124999523162841797\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4.6391253471374511719\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"9\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"10\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter1filterActivation value=\"1\"/>\n"
+"  <filter2FILTERType value=\"2\"/>\n"
+"  <filter2lpCutoff value=\"211.0000152587890625\"/>\n"
+"  <filter2hpCutoff value=\"16\"/>\n"
+"  <filter2FILTERResonance value=\"1.4612498283386230469\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"3.7281250953674316406\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"2.5191256999969482422\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"9\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"10\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"5.0521249771118164062\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4.5978751182556152344\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"10\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"1\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"0\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"4\"/>\n"
+"  <seqNoteLength value=\"4\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"60\"/>\n"
+"  <seqNote1 value=\"62\"/>\n"
+"  <seqNote2 value=\"64\"/>\n"
+"  <seqNote3 value=\"65\"/>\n"
+"  <seqNote4 value=\"67\"/>\n"
+"  <seqNote5 value=\"69\"/>\n"
+"  <seqNote6 value=\"71\"/>\n"
+"  <seqNote7 value=\"72\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"0\"/>\n"
+"  <seqRandomMax value=\"127\"/>\n"
+"  <delWet value=\"0.53265625238418579102\"/>\n"
+"  <delFeed value=\"0.59551560878753662109\"/>\n"
+"  <delTime value=\"17.857143402099609375\"/>\n"
+"  <delSync value=\"1\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"64\"/>\n"
+"  <delCut value=\"252.000030517578125\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"1\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"1\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"440\"/>\n"
+"  <masterAmp value=\"-8.9732141494750976562\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorWidth value=\"0.065589919686317443848\"/>\n"
+"  <ChorAmount value=\"0.075078114867210388184\"/>\n"
+"  <ChorDepth value=\"7.1418743133544921875\"/>\n"
+"  <chorRate value=\"0.21267178654670715332\"/>\n"
+"  <lowFiActivation value=\"0\"/>\n"
+"  <nBitsLowFi value=\"7.7239842414855957031\"/>\n"
+"  <clippingActivation value=\"0\"/>\n"
+"  <clippingFactor value=\"0\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"0\"/>\n"
+"  <lfoSection value=\"0\"/>\n"
+"  <filterSection value=\"0\"/>\n"
+"  <fxSection value=\"0\"/>\n"
+"  <seqSection value=\"0\"/>\n"
+"</patch>\n";
+
+const char* le_wob_xml = (const char*) temp_binary_data_30;
+
+//================== organ failure.xml ==================
+static const unsigned char temp_binary_data_31[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"\">\n"
+"  <osc1fine value=\"0\"/>\n"
+"  <osc1coarse value=\"-24\"/>\n"
+"  <osc1panDir value=\"0\"/>\n"
+"  <osc1vol value=\"-6\"/>\n"
+"  <osc1trngAmount value=\"0\"/>\n"
+"  <osc1pulseWidth value=\"0.33318564295768737793\"/>\n"
+"  <osc1oscWaveform value=\"1\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"48\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc1GainModSrc1 value=\"0\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"0\"/>\n"
+"  <osc2coarse value=\"24\"/>\n"
+"  <osc2panDir value=\"0\"/>\n"
+"  <osc2vol value=\"-9.96704864501953125\"/>\n"
+"  <osc2trngAmount value=\"0.084718771278858184814\"/>\n"
+"  <osc2pulseWidth value=\"0.16502378880977630615\"/>\n"
+"  <osc2oscWaveform value=\"0\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"48\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"8.8156251907348632812\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"10\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0.10175000131130218506\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"0.47304686903953552246\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc2GainModSrc1 value=\"0\"/>\n"
+"  <osc2GainModSrc2 value=\"0\"/>\n"
+"  <osc2Activation value=\"1\"/>\n"
+"  <osc3fine value=\"0\"/>\n"
+"  <osc3coarse value=\"-12\"/>\n"
+"  <osc3panDir value=\"0\"/>\n"
+"  <osc3vol value=\"-4.77978515625\"/>\n"
+"  <osc3trngAmount value=\"0.18107813596725463867\"/>\n"
+"  <osc3pulseWidth value=\"0.54598349332809448242\"/>\n"
+"  <osc3oscWaveform value=\"1\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"48\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"50\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"50\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.23649999499320983887\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"10\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc3GainModSrc1 value=\"0\"/>\n"
+"  <osc3GainModSrc2 value=\"0\"/>\n"
+"  <osc3Activation value=\"1\"/>\n"
+"  <env2envAttack value=\"0.030773900449275970459\"/>\n"
+"  <env2envDecay value=\"0.40181592106819152832\"/>\n"
+"  <env2envSustain value=\"0\"/>\n"
+"  <env2envRelease value=\"0.61969220638275146484\"/>\n"
+"  <env2envAttackShape value=\"0.60805630683898925781\"/>\n"
+"  <env2envDecayShape value=\"1\"/>\n"
+"  <env2envReleaseShape value=\"1\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"3.5796248912811279297\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"0.0010000000474974513054\"/>\n"
+"  <env3envDecay value=\"0.0010000000474974513054\"/>\n"
+"  <env3envSustain value=\"0\"/>\n"
+"  <env3envRelease value=\"0.0010000000474974513054\"/>\n"
+"  <env3envAttackShape value=\"2.9238026142120361328\"/>\n"
+"  <env3envDecayShape value=\"1.0948297977447509766\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"7.5819997787475585938\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"7\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.015528158284723758698\"/>\n"
+"  <envvolenvDecay value=\"0.8079363703727722168\"/>\n"
+"  <envvolenvSustain value=\"0\"/>\n"
+"  <envvolenvRelease value=\"0.023444229736924171448\"/>\n"
+"  <envvolenvAttackShape value=\"3.7817604541778564453\"/>\n"
+"  <envvolenvDecayShape value=\"0.59775274991989135742\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"4\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"0\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0.0030998461879789829254\"/>\n"
+"  <lfo1lfo1freq value=\"0.010098341852426528931\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"1\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"16\"/>\n"
+"  <lfo1LFOGainModSrc value=\"1\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"1.1698004007339477539\"/>\n"
+"  <lfo2lfo1freq value=\"1.6153315305709838867\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"1\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"0\"/>\n"
+"  <lfo2lfoTriplet value=\"0\"/>\n"
+"  <lfo2lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"9.612445831298828125\"/>\n"
+"  <lfo3lfo1freq value=\"39.080078125\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"2\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"2\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"4\"/>\n"
+"  <lfo3LFOGainModSrc value=\"0\"/>\n"
+"  <lfo3lfoTriplet value=\"0\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"1\"/>\n"
+"  <filter1lpCutoff value=\"43\"/>\n"
+"  <filter1hpCutoff value=\"65\"/>\n"
+"  <filter1FILTERResonance value=\"5.4014072418212890625\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"3.1763751506805419922\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"9\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"5.5940623283386230469\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"7\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"6.144374847412109375\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"7\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter1filterActivation value=\"1\"/>\n"
+"  <filter2FILTERType value=\"1\"/>\n"
+"  <filter2lpCutoff value=\"106.00000762939453125\"/>\n"
+"  <filter2hpCutoff value=\"59\"/>\n"
+"  <filter2FILTERResonance value=\"0\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"1.3303749561309814453\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"9\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"0.1875\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"9\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"1\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"0\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"4\"/>\n"
+"  <seqNoteLength value=\"4\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"60\"/>\n"
+"  <seqNote1 value=\"62\"/>\n"
+"  <seqNote2 value=\"64\"/>\n"
+"  <seqNote3 value=\"65\"/>\n"
+"  <seqNote4 value=\"67\"/>\n"
+"  <seqNote5 value=\"69\"/>\n"
+"  <seqNote6 value=\"71\"/>\n"
+"  <seqNote7 value=\"72\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"0\"/>\n"
+"  <seqRandomMax value=\"127\"/>\n"
+"  <delWet value=\"0.29670315980911254883\"/>\n"
+"  <delFeed value=\"0.22382812201976776123\"/>\n"
+"  <delTime value=\"26.785715103149414062\"/>\n"
+"  <delSync value=\"1\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"64\"/>\n"
+"  <delCut value=\"20000\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"1\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"440\"/>\n"
+"  <masterAmp value=\"-6\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"1\"/>\n"
+"  <chorActivation value=\"1\"/>\n"
+"  <chorWidth value=\"0.079999998211860656738\"/>\n"
+"  <ChorAmount value=\"0.04543748125433921814\"/>\n"
+"  <ChorDepth value=\"5.7225780487060546875\"/>\n"
+"  <chorRate value=\"0.32640001177787780762\"/>\n"
+"  <lowFiActivation value=\"1\"/>\n"
+"  <nBitsLowFi value=\"1.538359522819519043\"/>\n"
+"  <clippingActivation value=\"1\"/>\n"
+"  <clippingFactor value=\"14.022266387939453125\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"0\"/>\n"
+"  <lfoSection value=\"0\"/>\n"
+"  <filterSection value=\"0\"/>\n"
+"  <fxSection value=\"0\"/>\n"
+"  <seqSection value=\"1\"/>\n"
+"</patch>\n";
+
+const char* organ_failure_xml = (const char*) temp_binary_data_31;
+
+//================== organ.xml ==================
+static const unsigned char temp_binary_data_32[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"organ\">\n"
+"  <osc1fine value=\"0\"/>\n"
+"  <osc1coarse value=\"-12\"/>\n"
+"  <osc1panDir value=\"0\"/>\n"
+"  <osc1vol value=\"-24\"/>\n"
+"  <osc1trngAmount value=\"0\"/>\n"
+"  <osc1pulseWidth value=\"0.60000002384185791016\"/>\n"
+"  <osc1oscWaveform value=\"1\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"40\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"2\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.75\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.75\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"7\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"60\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"60\"/>\n"
+"  <osc1GainModSrc1 value=\"4\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"1\"/>\n"
+"  <osc2coarse value=\"0\"/>\n"
+"  <osc2panDir value=\"0\"/>\n"
+"  <osc2vol value=\"-24\"/>\n"
+"  <osc2trngAmount value=\"0\"/>\n"
+"  <osc2pulseWidth value=\"0.34999999403953552246\"/>\n"
+"  <osc2oscWaveform value=\"1\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"40\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"2\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"1\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"7\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"7\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"60\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"60\"/>\n"
+"  <osc2GainModSrc1 value=\"4\"/>\n"
+"  <osc2GainModSrc2 value=\"0\"/>\n"
+"  <osc2Activation value=\"1\"/>\n"
+"  <osc3fine value=\"0\"/>\n"
+"  <osc3coarse value=\"12\"/>\n"
+"  <osc3panDir value=\"0\"/>\n"
+"  <osc3vol value=\"-24\"/>\n"
+"  <osc3trngAmount value=\"0\"/>\n"
+"  <osc3pulseWidth value=\"0.34999999403953552246\"/>\n"
+"  <osc3oscWaveform value=\"1\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"40\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"2\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"60\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc3GainModSrc1 value=\"4\"/>\n"
+"  <osc3GainModSrc2 value=\"0\"/>\n"
+"  <osc3Activation value=\"1\"/>\n"
+"  <env2envAttack value=\"0.0050000008195638656616\"/>\n"
+"  <env2envDecay value=\"1.5000001192092895508\"/>\n"
+"  <env2envSustain value=\"0\"/>\n"
+"  <env2envRelease value=\"1.0000005960464477539\"/>\n"
+"  <env2envAttackShape value=\"0.30000001192092895508\"/>\n"
+"  <env2envDecayShape value=\"4\"/>\n"
+"  <env2envReleaseShape value=\"8\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"3.5\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"3\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"0.0050000008195638656616\"/>\n"
+"  <env3envDecay value=\"0.049999989569187164307\"/>\n"
+"  <env3envSustain value=\"1\"/>\n"
+"  <env3envRelease value=\"0.5\"/>\n"
+"  <env3envAttackShape value=\"1\"/>\n"
+"  <env3envDecayShape value=\"1\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.40000006556510925293\"/>\n"
+"  <envvolenvDecay value=\"5\"/>\n"
+"  <envvolenvSustain value=\"-6\"/>\n"
+"  <envvolenvRelease value=\"0.5\"/>\n"
+"  <envvolenvAttackShape value=\"1\"/>\n"
+"  <envvolenvDecayShape value=\"2\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"3.5\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0\"/>\n"
+"  <lfo1lfo1freq value=\"1\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"4\"/>\n"
+"  <lfo1LFOGainModSrc value=\"0\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"0\"/>\n"
+"  <lfo2lfo1freq value=\"1\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"0\"/>\n"
+"  <lfo2lfoTriplet value=\"0\"/>\n"
+"  <lfo2lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"0\"/>\n"
+"  <lfo3lfo1freq value=\"1\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"4\"/>\n"
+"  <lfo3LFOGainModSrc value=\"0\"/>\n"
+"  <lfo3lfoTriplet value=\"0\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"2\"/>\n"
+"  <filter1lpCutoff value=\"499.99993896484375\"/>\n"
+"  <filter1hpCutoff value=\"100\"/>\n"
+"  <filter1FILTERResonance value=\"3\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"3\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"6\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"7\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"7\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter1filterActivation value=\"1\"/>\n"
+"  <filter2FILTERType value=\"0\"/>\n"
+"  <filter2lpCutoff value=\"20000\"/>\n"
+"  <filter2hpCutoff value=\"10\"/>\n"
+"  <filter2FILTERResonance value=\"0\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"0\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"0\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"1\"/>\n"
+"  <seqNoteLength value=\"1\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"100\"/>\n"
+"  <seqNote1 value=\"95\"/>\n"
+"  <seqNote2 value=\"86\"/>\n"
+"  <seqNote3 value=\"81\"/>\n"
+"  <seqNote4 value=\"89\"/>\n"
+"  <seqNote5 value=\"84\"/>\n"
+"  <seqNote6 value=\"96\"/>\n"
+"  <seqNote7 value=\"103\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"0\"/>\n"
+"  <seqRandomMax value=\"127\"/>\n"
+"  <delWet value=\"0\"/>\n"
+"  <delFeed value=\"0\"/>\n"
+"  <delTime value=\"1000.0003662109375\"/>\n"
+"  <delSync value=\"0\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"4\"/>\n"
+"  <delCut value=\"20000\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"0\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"880\"/>\n"
+"  <masterAmp value=\"-6\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"1\"/>\n"
+"  <chorActivation value=\"1\"/>\n"
+"  <chorWidth value=\"0.050000004470348358154\"/>\n"
+"  <ChorAmount value=\"0.80000001192092895508\"/>\n"
+"  <ChorDepth value=\"5\"/>\n"
+"  <chorRate value=\"0.10000000894069671631\"/>\n"
+"  <lowFiActivation value=\"0\"/>\n"
+"  <nBitsLowFi value=\"16\"/>\n"
+"  <clippingActivation value=\"0\"/>\n"
+"  <clippingFactor value=\"0\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"0\"/>\n"
+"  <lfoSection value=\"1\"/>\n"
+"  <filterSection value=\"0\"/>\n"
+"  <fxSection value=\"0\"/>\n"
+"  <seqSection value=\"0\"/>\n"
+"</patch>\n";
+
+const char* organ_xml = (const char*) temp_binary_data_32;
+
+//================== piano sth..xml ==================
+static const unsigned char temp_binary_data_33[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"piano sth.\">\n"
+"  <osc1fine value=\"1\"/>\n"
+"  <osc1coarse value=\"0\"/>\n"
+"  <osc1panDir value=\"0\"/>\n"
+"  <osc1vol value=\"-24\"/>\n"
+"  <osc1trngAmount value=\"0\"/>\n"
+"  <osc1pulseWidth value=\"0.5\"/>\n"
+"  <osc1oscWaveform value=\"0\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"40\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"2\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"2\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"60\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"60\"/>\n"
+"  <osc1GainModSrc1 value=\"4\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"-2\"/>\n"
+"  <osc2coarse value=\"0\"/>\n"
+"  <osc2panDir value=\"0\"/>\n"
+"  <osc2vol value=\"-24\"/>\n"
+"  <osc2trngAmount value=\"1\"/>\n"
+"  <osc2pulseWidth value=\"0.5\"/>\n"
+"  <osc2oscWaveform value=\"1\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"40\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"2\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"1\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"7\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"7\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"60\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"60\"/>\n"
+"  <osc2GainModSrc1 value=\"4\"/>\n"
+"  <osc2GainModSrc2 value=\"0\"/>\n"
+"  <osc2Activation value=\"1\"/>\n"
+"  <osc3fine value=\"2\"/>\n"
+"  <osc3coarse value=\"0\"/>\n"
+"  <osc3panDir value=\"0\"/>\n"
+"  <osc3vol value=\"-24\"/>\n"
+"  <osc3trngAmount value=\"1\"/>\n"
+"  <osc3pulseWidth value=\"0.75\"/>\n"
+"  <osc3oscWaveform value=\"1\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"40\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"2\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"60\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc3GainModSrc1 value=\"4\"/>\n"
+"  <osc3GainModSrc2 value=\"0\"/>\n"
+"  <osc3Activation value=\"1\"/>\n"
+"  <env2envAttack value=\"2.0000002384185791016\"/>\n"
+"  <env2envDecay value=\"2.0000002384185791016\"/>\n"
+"  <env2envSustain value=\"0.64999997615814208984\"/>\n"
+"  <env2envRelease value=\"3\"/>\n"
+"  <env2envAttackShape value=\"0.34999999403953552246\"/>\n"
+"  <env2envDecayShape value=\"3\"/>\n"
+"  <env2envReleaseShape value=\"2\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"3.5\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"0.0050000008195638656616\"/>\n"
+"  <env3envDecay value=\"0.049999989569187164307\"/>\n"
+"  <env3envSustain value=\"1\"/>\n"
+"  <env3envRelease value=\"0.5\"/>\n"
+"  <env3envAttackShape value=\"1\"/>\n"
+"  <env3envDecayShape value=\"1\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.0050000008195638656616\"/>\n"
+"  <envvolenvDecay value=\"1.5000001192092895508\"/>\n"
+"  <envvolenvSustain value=\"-96\"/>\n"
+"  <envvolenvRelease value=\"2.0000002384185791016\"/>\n"
+"  <envvolenvAttackShape value=\"0.30000001192092895508\"/>\n"
+"  <envvolenvDecayShape value=\"3\"/>\n"
+"  <envvolenvReleaseShape value=\"8\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"3.5\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0\"/>\n"
+"  <lfo1lfo1freq value=\"1\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"4\"/>\n"
+"  <lfo1LFOGainModSrc value=\"0\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"0\"/>\n"
+"  <lfo2lfo1freq value=\"1\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"0\"/>\n"
+"  <lfo2lfoTriplet value=\"0\"/>\n"
+"  <lfo2lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"0\"/>\n"
+"  <lfo3lfo1freq value=\"1\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"4\"/>\n"
+"  <lfo3LFOGainModSrc value=\"0\"/>\n"
+"  <lfo3lfoTriplet value=\"0\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"0\"/>\n"
+"  <filter1lpCutoff value=\"499.99993896484375\"/>\n"
+"  <filter1hpCutoff value=\"100\"/>\n"
+"  <filter1FILTERResonance value=\"0\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"3\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"6\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"7\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"7\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter1filterActivation value=\"1\"/>\n"
+"  <filter2FILTERType value=\"0\"/>\n"
+"  <filter2lpCutoff value=\"20000\"/>\n"
+"  <filter2hpCutoff value=\"10\"/>\n"
+"  <filter2FILTERResonance value=\"0\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"0\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"0\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"8\"/>\n"
+"  <seqNoteLength value=\"1\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"1\"/>\n"
+"  <seqNote0 value=\"48\"/>\n"
+"  <seqNote1 value=\"55\"/>\n"
+"  <seqNote2 value=\"60\"/>\n"
+"  <seqNote3 value=\"55\"/>\n"
+"  <seqNote4 value=\"62\"/>\n"
+"  <seqNote5 value=\"55\"/>\n"
+"  <seqNote6 value=\"60\"/>\n"
+"  <seqNote7 value=\"55\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"0\"/>\n"
+"  <seqRandomMax value=\"127\"/>\n"
+"  <delWet value=\"0\"/>\n"
+"  <delFeed value=\"0\"/>\n"
+"  <delTime value=\"1000.0003662109375\"/>\n"
+"  <delSync value=\"0\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"4\"/>\n"
+"  <delCut value=\"20000\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"0\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"440\"/>\n"
+"  <masterAmp value=\"0\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"1\"/>\n"
+"  <chorActivation value=\"1\"/>\n"
+"  <chorWidth value=\"0.070000000298023223877\"/>\n"
+"  <ChorAmount value=\"0.55000001192092895508\"/>\n"
+"  <ChorDepth value=\"5\"/>\n"
+"  <chorRate value=\"0.10000000894069671631\"/>\n"
+"  <lowFiActivation value=\"0\"/>\n"
+"  <nBitsLowFi value=\"16\"/>\n"
+"  <clippingActivation value=\"0\"/>\n"
+"  <clippingFactor value=\"0\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"0\"/>\n"
+"  <lfoSection value=\"1\"/>\n"
+"  <filterSection value=\"0\"/>\n"
+"  <fxSection value=\"0\"/>\n"
+"  <seqSection value=\"0\"/>\n"
+"</patch>\n";
+
+const char* piano_sth__xml = (const char*) temp_binary_data_33;
+
+//================== quinto.xml ==================
+static const unsigned char temp_binary_data_34[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"\">\n"
+"  <osc1fine value=\"0\"/>\n"
+"  <osc1coarse value=\"0\"/>\n"
+"  <osc1panDir value=\"-100\"/>\n"
+"  <osc1vol value=\"-6\"/>\n"
+"  <osc1trngAmount value=\"0\"/>\n"
+"  <osc1pulseWidth value=\"0.5\"/>\n"
+"  <osc1oscWaveform value=\"0\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"198.3718719482421875\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"13\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.1414531320333480835\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"10\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc1GainModSrc1 value=\"0\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"0\"/>\n"
+"  <osc2coarse value=\"0\"/>\n"
+"  <osc2panDir value=\"100\"/>\n"
+"  <osc2vol value=\"-6\"/>\n"
+"  <osc2trngAmount value=\"0\"/>\n"
+"  <osc2pulseWidth value=\"0.5\"/>\n"
+"  <osc2oscWaveform value=\"0\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"13\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0.14776562154293060303\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"11\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc2GainModSrc1 value=\"0\"/>\n"
+"  <osc2GainModSrc2 value=\"0\"/>\n"
+"  <osc2Activation value=\"1\"/>\n"
+"  <osc3fine value=\"0\"/>\n"
+"  <osc3coarse value=\"7\"/>\n"
+"  <osc3panDir value=\"0\"/>\n"
+"  <osc3vol value=\"-6\"/>\n"
+"  <osc3trngAmount value=\"0\"/>\n"
+"  <osc3pulseWidth value=\"0.5\"/>\n"
+"  <osc3oscWaveform value=\"1\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"81.05625152587890625\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"9\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"48\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc3GainModSrc1 value=\"0\"/>\n"
+"  <osc3GainModSrc2 value=\"0\"/>\n"
+"  <osc3Activation value=\"1\"/>\n"
+"  <env2envAttack value=\"0.0010000000474974513054\"/>\n"
+"  <env2envDecay value=\"0.47509598731994628906\"/>\n"
+"  <env2envSustain value=\"0\"/>\n"
+"  <env2envRelease value=\"0.5\"/>\n"
+"  <env2envAttackShape value=\"1\"/>\n"
+"  <env2envDecayShape value=\"1\"/>\n"
+"  <env2envReleaseShape value=\"1\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"0.0049999998882412910461\"/>\n"
+"  <env3envDecay value=\"0.049999993294477462769\"/>\n"
+"  <env3envSustain value=\"1\"/>\n"
+"  <env3envRelease value=\"0.5\"/>\n"
+"  <env3envAttackShape value=\"1\"/>\n"
+"  <env3envDecayShape value=\"1\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.0049999998882412910461\"/>\n"
+"  <envvolenvDecay value=\"0.049999993294477462769\"/>\n"
+"  <envvolenvSustain value=\"-6.43387603759765625\"/>\n"
+"  <envvolenvRelease value=\"0.31700929999351501465\"/>\n"
+"  <envvolenvAttackShape value=\"1\"/>\n"
+"  <envvolenvDecayShape value=\"1\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"4\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"0\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0\"/>\n"
+"  <lfo1lfo1freq value=\"4.6815319061279296875\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"1\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"8\"/>\n"
+"  <lfo1LFOGainModSrc value=\"0\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"0\"/>\n"
+"  <lfo2lfo1freq value=\"1\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"0\"/>\n"
+"  <lfo2lfoTriplet value=\"0\"/>\n"
+"  <lfo2lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"0\"/>\n"
+"  <lfo3lfo1freq value=\"0.68109935522079467773\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"4\"/>\n"
+"  <lfo3LFOGainModSrc value=\"0\"/>\n"
+"  <lfo3lfoTriplet value=\"0\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"0\"/>\n"
+"  <filter1lpCutoff value=\"1587.9996337890625\"/>\n"
+"  <filter1hpCutoff value=\"10\"/>\n"
+"  <filter1FILTERResonance value=\"1.6851562261581420898\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"1.7221250534057617188\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"2\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter1filterActivation value=\"1\"/>\n"
+"  <filter2FILTERType value=\"0\"/>\n"
+"  <filter2lpCutoff value=\"20000\"/>\n"
+"  <filter2hpCutoff value=\"10\"/>\n"
+"  <filter2FILTERResonance value=\"0\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"0\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"2\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"8\"/>\n"
+"  <seqNoteLength value=\"4\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"52\"/>\n"
+"  <seqNote1 value=\"54\"/>\n"
+"  <seqNote2 value=\"81\"/>\n"
+"  <seqNote3 value=\"66\"/>\n"
+"  <seqNote4 value=\"71\"/>\n"
+"  <seqNote5 value=\"54\"/>\n"
+"  <seqNote6 value=\"51\"/>\n"
+"  <seqNote7 value=\"69\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"48\"/>\n"
+"  <seqRandomMax value=\"98\"/>\n"
+"  <delWet value=\"0\"/>\n"
+"  <delFeed value=\"0\"/>\n"
+"  <delTime value=\"1000.000244140625\"/>\n"
+"  <delSync value=\"0\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"4\"/>\n"
+"  <delCut value=\"20000\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"0\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"440\"/>\n"
+"  <masterAmp value=\"-6\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorWidth value=\"0.050000004470348358154\"/>\n"
+"  <ChorAmount value=\"0\"/>\n"
+"  <ChorDepth value=\"15\"/>\n"
+"  <chorRate value=\"0.5\"/>\n"
+"  <lowFiActivation value=\"0\"/>\n"
+"  <nBitsLowFi value=\"16\"/>\n"
+"  <clippingActivation value=\"0\"/>\n"
+"  <clippingFactor value=\"0\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"0\"/>\n"
+"  <lfoSection value=\"0\"/>\n"
+"  <filterSection value=\"0\"/>\n"
+"  <fxSection value=\"1\"/>\n"
+"  <seqSection value=\"0\"/>\n"
+"</patch>\n";
+
+const char* quinto_xml = (const char*) temp_binary_data_34;
+
+//================== syn piano.xml ==================
+static const unsigned char temp_binary_data_35[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"syn piano\">\n"
+"  <osc1fine value=\"0\"/>\n"
+"  <osc1coarse value=\"0\"/>\n"
+"  <osc1panDir value=\"0\"/>\n"
+"  <osc1vol value=\"0\"/>\n"
+"  <osc1trngAmount value=\"0.58962500095367431641\"/>\n"
+"  <osc1pulseWidth value=\"0.5\"/>\n"
+"  <osc1oscWaveform value=\"1\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"30\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"100\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.21118752658367156982\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"9\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"36.366001129150390625\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc1GainModSrc1 value=\"3\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"0\"/>\n"
+"  <osc2coarse value=\"0\"/>\n"
+"  <osc2panDir value=\"0\"/>\n"
+"  <osc2vol value=\"-67.2588348388671875\"/>\n"
+"  <osc2trngAmount value=\"0\"/>\n"
+"  <osc2pulseWidth value=\"0.5\"/>\n"
+"  <osc2oscWaveform value=\"2\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"100\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"69.532501220703125\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"15.601499557495117188\"/>\n"
+"  <osc2GainModSrc1 value=\"13\"/>\n"
+"  <osc2GainModSrc2 value=\"3\"/>\n"
+"  <osc2Activation value=\"1\"/>\n"
+"  <osc3fine value=\"0\"/>\n"
+"  <osc3coarse value=\"0\"/>\n"
+"  <osc3panDir value=\"0\"/>\n"
+"  <osc3vol value=\"-65.378448486328125\"/>\n"
+"  <osc3trngAmount value=\"1\"/>\n"
+"  <osc3pulseWidth value=\"0.5\"/>\n"
+"  <osc3oscWaveform value=\"1\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"100\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"94.05300140380859375\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"26.95050048828125\"/>\n"
+"  <osc3GainModSrc1 value=\"14\"/>\n"
+"  <osc3GainModSrc2 value=\"3\"/>\n"
+"  <osc3Activation value=\"1\"/>\n"
+"  <env2envAttack value=\"0.0010000000474974513054\"/>\n"
+"  <env2envDecay value=\"0.14973288774490356445\"/>\n"
+"  <env2envSustain value=\"0\"/>\n"
+"  <env2envRelease value=\"0.0010000000474974513054\"/>\n"
+"  <env2envAttackShape value=\"1\"/>\n"
+"  <env2envDecayShape value=\"1\"/>\n"
+"  <env2envReleaseShape value=\"1\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"0.0010000000474974513054\"/>\n"
+"  <env3envDecay value=\"0.1683346182107925415\"/>\n"
+"  <env3envSustain value=\"0\"/>\n"
+"  <env3envRelease value=\"0.5\"/>\n"
+"  <env3envAttackShape value=\"1\"/>\n"
+"  <env3envDecayShape value=\"1\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.045232832431793212891\"/>\n"
+"  <envvolenvDecay value=\"0.88369709253311157227\"/>\n"
+"  <envvolenvSustain value=\"-8.77700042724609375\"/>\n"
+"  <envvolenvRelease value=\"0.5\"/>\n"
+"  <envvolenvAttackShape value=\"1\"/>\n"
+"  <envvolenvDecayShape value=\"1\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"3.1243751049041748047\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"0.86100000143051147461\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0\"/>\n"
+"  <lfo1lfo1freq value=\"0.068752847611904144287\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"4\"/>\n"
+"  <lfo1LFOGainModSrc value=\"0\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"0\"/>\n"
+"  <lfo2lfo1freq value=\"1\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"0\"/>\n"
+"  <lfo2lfoTriplet value=\"0\"/>\n"
+"  <lfo2lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"0\"/>\n"
+"  <lfo3lfo1freq value=\"1\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"4\"/>\n"
+"  <lfo3LFOGainModSrc value=\"0\"/>\n"
+"  <lfo3lfoTriplet value=\"0\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"0\"/>\n"
+"  <filter1lpCutoff value=\"3671.999755859375\"/>\n"
+"  <filter1hpCutoff value=\"10\"/>\n"
+"  <filter1FILTERResonance value=\"0.4459374845027923584\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"1.3221249580383300781\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"5.4441251754760742188\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"2\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"4\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"7.83984375\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5.7396874427795410156\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"4\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"12\"/>\n"
+"  <filter1filterActivation value=\"1\"/>\n"
+"  <filter2FILTERType value=\"0\"/>\n"
+"  <filter2lpCutoff value=\"20000\"/>\n"
+"  <filter2hpCutoff value=\"10\"/>\n"
+"  <filter2FILTERResonance value=\"0\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"0\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"0\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"4\"/>\n"
+"  <seqNoteLength value=\"4\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"60\"/>\n"
+"  <seqNote1 value=\"62\"/>\n"
+"  <seqNote2 value=\"64\"/>\n"
+"  <seqNote3 value=\"65\"/>\n"
+"  <seqNote4 value=\"67\"/>\n"
+"  <seqNote5 value=\"69\"/>\n"
+"  <seqNote6 value=\"71\"/>\n"
+"  <seqNote7 value=\"72\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"0\"/>\n"
+"  <seqRandomMax value=\"127\"/>\n"
+"  <delWet value=\"0\"/>\n"
+"  <delFeed value=\"0\"/>\n"
+"  <delTime value=\"1000.000244140625\"/>\n"
+"  <delSync value=\"0\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"4\"/>\n"
+"  <delCut value=\"20000\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"0\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"440\"/>\n"
+"  <masterAmp value=\"-6\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorWidth value=\"0.050000004470348358154\"/>\n"
+"  <ChorAmount value=\"0\"/>\n"
+"  <ChorDepth value=\"15\"/>\n"
+"  <chorRate value=\"0.5\"/>\n"
+"  <lowFiActivation value=\"0\"/>\n"
+"  <nBitsLowFi value=\"16\"/>\n"
+"  <clippingActivation value=\"0\"/>\n"
+"  <clippingFactor value=\"0\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"1\"/>\n"
+"  <lfoSection value=\"0\"/>\n"
+"  <filterSection value=\"0\"/>\n"
+"  <fxSection value=\"0\"/>\n"
+"  <seqSection value=\"0\"/>\n"
+"</patch>\n";
+
+const char* syn_piano_xml = (const char*) temp_binary_data_35;
+
+//================== violin1.xml ==================
+static const unsigned char temp_binary_data_36[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"violin1\">\n"
+"  <osc1fine value=\"0\"/>\n"
+"  <osc1coarse value=\"0\"/>\n"
+"  <osc1panDir value=\"0\"/>\n"
+"  <osc1vol value=\"-24\"/>\n"
+"  <osc1trngAmount value=\"0\"/>\n"
+"  <osc1pulseWidth value=\"0.60000002384185791016\"/>\n"
+"  <osc1oscWaveform value=\"0\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"40\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"2\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.75\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.75\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"7\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"60\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"60\"/>\n"
+"  <osc1GainModSrc1 value=\"4\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"0\"/>\n"
+"  <osc2coarse value=\"0\"/>\n"
+"  <osc2panDir value=\"0\"/>\n"
+"  <osc2vol value=\"-24\"/>\n"
+"  <osc2trngAmount value=\"0\"/>\n"
+"  <osc2pulseWidth value=\"0.34999999403953552246\"/>\n"
+"  <osc2oscWaveform value=\"0\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"40\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"2\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"1\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"7\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"7\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"60\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"60\"/>\n"
+"  <osc2GainModSrc1 value=\"4\"/>\n"
+"  <osc2GainModSrc2 value=\"0\"/>\n"
+"  <osc2Activation value=\"1\"/>\n"
+"  <osc3fine value=\"0\"/>\n"
+"  <osc3coarse value=\"0\"/>\n"
+"  <osc3panDir value=\"0\"/>\n"
+"  <osc3vol value=\"-35.999996185302734375\"/>\n"
+"  <osc3trngAmount value=\"1\"/>\n"
+"  <osc3pulseWidth value=\"0.34999999403953552246\"/>\n"
+"  <osc3oscWaveform value=\"1\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"40\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"2\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"55\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc3GainModSrc1 value=\"13\"/>\n"
+"  <osc3GainModSrc2 value=\"0\"/>\n"
+"  <osc3Activation value=\"1\"/>\n"
+"  <env2envAttack value=\"0.0050000008195638656616\"/>\n"
+"  <env2envDecay value=\"1.5000001192092895508\"/>\n"
+"  <env2envSustain value=\"0\"/>\n"
+"  <env2envRelease value=\"1.0000005960464477539\"/>\n"
+"  <env2envAttackShape value=\"0.30000001192092895508\"/>\n"
+"  <env2envDecayShape value=\"4\"/>\n"
+"  <env2envReleaseShape value=\"8\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"3.5\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"3\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"0.0050000008195638656616\"/>\n"
+"  <env3envDecay value=\"0.049999989569187164307\"/>\n"
+"  <env3envSustain value=\"1\"/>\n"
+"  <env3envRelease value=\"0.5\"/>\n"
+"  <env3envAttackShape value=\"1\"/>\n"
+"  <env3envDecayShape value=\"1\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.40000006556510925293\"/>\n"
+"  <envvolenvDecay value=\"5\"/>\n"
+"  <envvolenvSustain value=\"-6\"/>\n"
+"  <envvolenvRelease value=\"0.34999996423721313477\"/>\n"
+"  <envvolenvAttackShape value=\"1\"/>\n"
+"  <envvolenvDecayShape value=\"2\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"3.5\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0\"/>\n"
+"  <lfo1lfo1freq value=\"1\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"4\"/>\n"
+"  <lfo1LFOGainModSrc value=\"0\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"0\"/>\n"
+"  <lfo2lfo1freq value=\"1\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"0\"/>\n"
+"  <lfo2lfoTriplet value=\"0\"/>\n"
+"  <lfo2lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"0\"/>\n"
+"  <lfo3lfo1freq value=\"1\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"4\"/>\n"
+"  <lfo3LFOGainModSrc value=\"0\"/>\n"
+"  <lfo3lfoTriplet value=\"0\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"0\"/>\n"
+"  <filter1lpCutoff value=\"499.99993896484375\"/>\n"
+"  <filter1hpCutoff value=\"100\"/>\n"
+"  <filter1FILTERResonance value=\"3\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"3\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"6\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"7\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"7\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter1filterActivation value=\"1\"/>\n"
+"  <filter2FILTERType value=\"0\"/>\n"
+"  <filter2lpCutoff value=\"20000\"/>\n"
+"  <filter2hpCutoff value=\"10\"/>\n"
+"  <filter2FILTERResonance value=\"0\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"0\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"2\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"4\"/>\n"
+"  <seqNoteLength value=\"4\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"81\"/>\n"
+"  <seqNote1 value=\"111\"/>\n"
+"  <seqNote2 value=\"87\"/>\n"
+"  <seqNote3 value=\"81\"/>\n"
+"  <seqNote4 value=\"101\"/>\n"
+"  <seqNote5 value=\"97\"/>\n"
+"  <seqNote6 value=\"76\"/>\n"
+"  <seqNote7 value=\"92\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"67\"/>\n"
+"  <seqRandomMax value=\"117\"/>\n"
+"  <delWet value=\"0\"/>\n"
+"  <delFeed value=\"0\"/>\n"
+"  <delTime value=\"1000.0003662109375\"/>\n"
+"  <delSync value=\"0\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"4\"/>\n"
+"  <delCut value=\"20000\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"0\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"220\"/>\n"
+"  <masterAmp value=\"-6\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorActivation value=\"0\"/>\n"
+"  <chorWidth value=\"0.050000004470348358154\"/>\n"
+"  <ChorAmount value=\"0\"/>\n"
+"  <ChorDepth value=\"15\"/>\n"
+"  <chorRate value=\"0.5\"/>\n"
+"  <lowFiActivation value=\"0\"/>\n"
+"  <nBitsLowFi value=\"16\"/>\n"
+"  <clippingActivation value=\"0\"/>\n"
+"  <clippingFactor value=\"0\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"0\"/>\n"
+"  <lfoSection value=\"1\"/>\n"
+"  <filterSection value=\"0\"/>\n"
+"  <fxSection value=\"0\"/>\n"
+"  <seqSection value=\"0\"/>\n"
+"</patch>\n";
+
+const char* violin1_xml = (const char*) temp_binary_data_36;
+
+//================== violin2.xml ==================
+static const unsigned char temp_binary_data_37[] =
+"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+"\n"
+"<patch version=\"1.1000000238418579102\" patchname=\"violin2\">\n"
+"  <osc1fine value=\"0\"/>\n"
+"  <osc1coarse value=\"0\"/>\n"
+"  <osc1panDir value=\"0\"/>\n"
+"  <osc1vol value=\"-24\"/>\n"
+"  <osc1trngAmount value=\"0\"/>\n"
+"  <osc1pulseWidth value=\"0.60000002384185791016\"/>\n"
+"  <osc1oscWaveform value=\"0\"/>\n"
+"  <osc1OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc1OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc1OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc1OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc1OSCPanModAmount1 value=\"40\"/>\n"
+"  <osc1OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc1OSCPanModSrc1 value=\"2\"/>\n"
+"  <osc1OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc1OSCShapeModAmount1 value=\"0.75\"/>\n"
+"  <osc1OSCShapeModAmount2 value=\"0.75\"/>\n"
+"  <osc1OSCShapeModSrc1 value=\"7\"/>\n"
+"  <osc1OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc1OSCGainModAmount1 value=\"60\"/>\n"
+"  <osc1OSCGainModAmount2 value=\"60\"/>\n"
+"  <osc1GainModSrc1 value=\"4\"/>\n"
+"  <osc1GainModSrc2 value=\"0\"/>\n"
+"  <osc1Activation value=\"1\"/>\n"
+"  <osc2fine value=\"1\"/>\n"
+"  <osc2coarse value=\"0\"/>\n"
+"  <osc2panDir value=\"0\"/>\n"
+"  <osc2vol value=\"-24\"/>\n"
+"  <osc2trngAmount value=\"0\"/>\n"
+"  <osc2pulseWidth value=\"0.34999999403953552246\"/>\n"
+"  <osc2oscWaveform value=\"0\"/>\n"
+"  <osc2OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc2OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc2OSCPitchModSrc1 value=\"8\"/>\n"
+"  <osc2OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc2OSCPanModAmount1 value=\"40\"/>\n"
+"  <osc2OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc2OSCPanModSrc1 value=\"2\"/>\n"
+"  <osc2OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount1 value=\"0\"/>\n"
+"  <osc2OSCShapeModAmount2 value=\"1\"/>\n"
+"  <osc2OSCShapeModSrc1 value=\"7\"/>\n"
+"  <osc2OSCShapeModSrc2 value=\"7\"/>\n"
+"  <osc2OSCGainModAmount1 value=\"60\"/>\n"
+"  <osc2OSCGainModAmount2 value=\"60\"/>\n"
+"  <osc2GainModSrc1 value=\"4\"/>\n"
+"  <osc2GainModSrc2 value=\"0\"/>\n"
+"  <osc2Activation value=\"1\"/>\n"
+"  <osc3fine value=\"0\"/>\n"
+"  <osc3coarse value=\"0\"/>\n"
+"  <osc3panDir value=\"0\"/>\n"
+"  <osc3vol value=\"-24\"/>\n"
+"  <osc3trngAmount value=\"0\"/>\n"
+"  <osc3pulseWidth value=\"0.34999999403953552246\"/>\n"
+"  <osc3oscWaveform value=\"1\"/>\n"
+"  <osc3OSCPitchModAmount1 value=\"24\"/>\n"
+"  <osc3OSCPitchModAmount2 value=\"24\"/>\n"
+"  <osc3OSCPitchModSrc1 value=\"0\"/>\n"
+"  <osc3OSCPitchModSrc2 value=\"0\"/>\n"
+"  <osc3OSCPanModAmount1 value=\"40\"/>\n"
+"  <osc3OSCPanModAmount2 value=\"100\"/>\n"
+"  <osc3OSCPanModSrc1 value=\"2\"/>\n"
+"  <osc3OSCPanModSrc2 value=\"0\"/>\n"
+"  <osc3OSCShapeModAmount1 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModAmount2 value=\"0.5\"/>\n"
+"  <osc3OSCShapeModSrc1 value=\"0\"/>\n"
+"  <osc3OSCShapeModSrc2 value=\"0\"/>\n"
+"  <osc3OSCGainModAmount1 value=\"55\"/>\n"
+"  <osc3OSCGainModAmount2 value=\"48\"/>\n"
+"  <osc3GainModSrc1 value=\"13\"/>\n"
+"  <osc3GainModSrc2 value=\"0\"/>\n"
+"  <osc3Activation value=\"1\"/>\n"
+"  <env2envAttack value=\"0.0050000008195638656616\"/>\n"
+"  <env2envDecay value=\"1.5000001192092895508\"/>\n"
+"  <env2envSustain value=\"0\"/>\n"
+"  <env2envRelease value=\"1.0000005960464477539\"/>\n"
+"  <env2envAttackShape value=\"0.30000001192092895508\"/>\n"
+"  <env2envDecayShape value=\"4\"/>\n"
+"  <env2envReleaseShape value=\"8\"/>\n"
+"  <env2ENVSpeedModAmount1 value=\"3.5\"/>\n"
+"  <env2ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env2ENVSpeedModSrc1 value=\"3\"/>\n"
+"  <env2ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <env3envAttack value=\"0.0050000008195638656616\"/>\n"
+"  <env3envDecay value=\"0.049999989569187164307\"/>\n"
+"  <env3envSustain value=\"1\"/>\n"
+"  <env3envRelease value=\"0.5\"/>\n"
+"  <env3envAttackShape value=\"1\"/>\n"
+"  <env3envDecayShape value=\"1\"/>\n"
+"  <env3envReleaseShape value=\"1\"/>\n"
+"  <env3ENVSpeedModAmount1 value=\"4\"/>\n"
+"  <env3ENVSpeedModAmount2 value=\"4\"/>\n"
+"  <env3ENVSpeedModSrc1 value=\"0\"/>\n"
+"  <env3ENVSpeedModSrc2 value=\"0\"/>\n"
+"  <envvolenvAttack value=\"0.40000006556510925293\"/>\n"
+"  <envvolenvDecay value=\"5\"/>\n"
+"  <envvolenvSustain value=\"-6\"/>\n"
+"  <envvolenvRelease value=\"0.34999996423721313477\"/>\n"
+"  <envvolenvAttackShape value=\"1\"/>\n"
+"  <envvolenvDecayShape value=\"2\"/>\n"
+"  <envvolenvReleaseShape value=\"1\"/>\n"
+"  <envvolENVSpeedModAmount1 value=\"3.5\"/>\n"
+"  <envvolENVSpeedModAmount2 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc1 value=\"4\"/>\n"
+"  <envvolENVSpeedModSrc2 value=\"0\"/>\n"
+"  <lfo1lfoFadein value=\"0\"/>\n"
+"  <lfo1lfo1freq value=\"1\"/>\n"
+"  <lfo1LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo1LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo1LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo1LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo1tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo1lfo1wave value=\"0\"/>\n"
+"  <lfo1notelength value=\"4\"/>\n"
+"  <lfo1LFOGainModSrc value=\"0\"/>\n"
+"  <lfo1lfoTriplet value=\"0\"/>\n"
+"  <lfo1lfoDottedLength value=\"0\"/>\n"
+"  <lfo2lfoFadein value=\"0\"/>\n"
+"  <lfo2lfo1freq value=\"1\"/>\n"
+"  <lfo2LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo2LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo2LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo2LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo2tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo2lfo1wave value=\"0\"/>\n"
+"  <lfo2notelength value=\"4\"/>\n"
+"  <lfo2LFOGainModSrc value=\"0\"/>\n"
+"  <lfo2lfoTriplet value=\"0\"/>\n"
+"  <lfo2lfoDottedLength value=\"0\"/>\n"
+"  <lfo3lfoFadein value=\"0\"/>\n"
+"  <lfo3lfo1freq value=\"1\"/>\n"
+"  <lfo3LFOFreqModSrc1 value=\"0\"/>\n"
+"  <lfo3LFOFreqModSrc2 value=\"0\"/>\n"
+"  <lfo3LFOFreqModAmount1 value=\"5\"/>\n"
+"  <lfo3LFOFreqModAmount2 value=\"5\"/>\n"
+"  <lfo3tempoSyncSwitch value=\"0\"/>\n"
+"  <lfo3lfo1wave value=\"0\"/>\n"
+"  <lfo3notelength value=\"4\"/>\n"
+"  <lfo3LFOGainModSrc value=\"0\"/>\n"
+"  <lfo3lfoTriplet value=\"0\"/>\n"
+"  <lfo3lfoDottedLength value=\"0\"/>\n"
+"  <filter1FILTERType value=\"2\"/>\n"
+"  <filter1lpCutoff value=\"499.99993896484375\"/>\n"
+"  <filter1hpCutoff value=\"100\"/>\n"
+"  <filter1FILTERResonance value=\"3\"/>\n"
+"  <filter1FILTERLcModAmount1 value=\"3\"/>\n"
+"  <filter1FILTERLcModAmount2 value=\"6\"/>\n"
+"  <filter1FILTERLcModSrc1 value=\"7\"/>\n"
+"  <filter1FILTERLcModSrc2 value=\"7\"/>\n"
+"  <filter1FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter1FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter1FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter1FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter1FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter1FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter1FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter1filterActivation value=\"1\"/>\n"
+"  <filter2FILTERType value=\"0\"/>\n"
+"  <filter2lpCutoff value=\"20000\"/>\n"
+"  <filter2hpCutoff value=\"10\"/>\n"
+"  <filter2FILTERResonance value=\"0\"/>\n"
+"  <filter2FILTERLcModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERLcModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERLcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERLcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERHcModAmount1 value=\"4\"/>\n"
+"  <filter2FILTERHcModAmount2 value=\"4\"/>\n"
+"  <filter2FILTERHcModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERHcModSrc2 value=\"0\"/>\n"
+"  <filter2FILTERResModAmount1 value=\"5\"/>\n"
+"  <filter2FILTERResModAmount2 value=\"5\"/>\n"
+"  <filter2FILTERResModSrc1 value=\"0\"/>\n"
+"  <filter2FILTERResModSrc2 value=\"0\"/>\n"
+"  <filter2filterActivation value=\"0\"/>\n"
+"  <seqPlaySyncHost value=\"0\"/>\n"
+"  <seqPlayMode value=\"2\"/>\n"
+"  <seqNumSteps value=\"8\"/>\n"
+"  <seqStepSpeed value=\"8\"/>\n"
+"  <seqNoteLength value=\"1\"/>\n"
+"  <seqTriplets value=\"0\"/>\n"
+"  <seqDottedLength value=\"0\"/>\n"
+"  <seqNote0 value=\"82\"/>\n"
+"  <seqNote1 value=\"108\"/>\n"
+"  <seqNote2 value=\"87.94054412841796875\"/>\n"
+"  <seqNote3 value=\"68\"/>\n"
+"  <seqNote4 value=\"112\"/>\n"
+"  <seqNote5 value=\"107\"/>\n"
+"  <seqNote6 value=\"100\"/>\n"
+"  <seqNote7 value=\"97\"/>\n"
+"  <seqStepActive0 value=\"1\"/>\n"
+"  <seqStepActive1 value=\"1\"/>\n"
+"  <seqStepActive2 value=\"1\"/>\n"
+"  <seqStepActive3 value=\"1\"/>\n"
+"  <seqStepActive4 value=\"1\"/>\n"
+"  <seqStepActive5 value=\"1\"/>\n"
+"  <seqStepActive6 value=\"1\"/>\n"
+"  <seqStepActive7 value=\"1\"/>\n"
+"  <seqRandomMin value=\"67\"/>\n"
+"  <seqRandomMax value=\"117\"/>\n"
+"  <delWet value=\"0\"/>\n"
+"  <delFeed value=\"0\"/>\n"
+"  <delTime value=\"1000.0003662109375\"/>\n"
+"  <delSync value=\"0\"/>\n"
+"  <delDivd value=\"1\"/>\n"
+"  <delDivs value=\"4\"/>\n"
+"  <delCut value=\"20000\"/>\n"
+"  <delRes value=\"0\"/>\n"
+"  <delTrip value=\"0\"/>\n"
+"  <delDot value=\"0\"/>\n"
+"  <delRec value=\"0\"/>\n"
+"  <delRev value=\"0\"/>\n"
+"  <delayActivation value=\"0\"/>\n"
+"  <syncToggle value=\"0\"/>\n"
+"  <freq value=\"220\"/>\n"
+"  <masterAmp value=\"-6\"/>\n"
+"  <masterPan value=\"0\"/>\n"
+"  <chorActivation value=\"1\"/>\n"
+"  <chorActivation value=\"1\"/>\n"
+"  <chorWidth value=\"0.050000004470348358154\"/>\n"
+"  <ChorAmount value=\"0.80000001192092895508\"/>\n"
+"  <ChorDepth value=\"5\"/>\n"
+"  <chorRate value=\"0.10000000894069671631\"/>\n"
+"  <lowFiActivation value=\"0\"/>\n"
+"  <nBitsLowFi value=\"16\"/>\n"
+"  <clippingActivation value=\"0\"/>\n"
+"  <clippingFactor value=\"0\"/>\n"
+"  <oscSection value=\"0\"/>\n"
+"  <envSection value=\"0\"/>\n"
+"  <lfoSection value=\"1\"/>\n"
+"  <filterSection value=\"0\"/>\n"
+"  <fxSection value=\"0\"/>\n"
+"  <seqSection value=\"0\"/>\n"
+"</patch>\n";
+
+const char* violin2_xml = (const char*) temp_binary_data_37;
+
+
 const char* getNamedResource (const char*, int&) throw();
 const char* getNamedResource (const char* resourceNameUTF8, int& numBytes) throw()
 {
@@ -3096,6 +7202,23 @@ const char* getNamedResource (const char* resourceNameUTF8, int& numBytes) throw
         case 0x2a907565:  numBytes = 465; return toggleOff_png;
         case 0x3b9bc03d:  numBytes = 661; return toggleOn_png;
         case 0x58ae6647:  numBytes = 464; return triplets_png;
+        case 0x10055c68:  numBytes = 7905; return init_xml;
+        case 0x520ab4e2:  numBytes = 8017; return cheap_hihat_xml;
+        case 0x63d0ec0e:  numBytes = 7933; return cheap_kick_xml;
+        case 0x13c74094:  numBytes = 7890; return cheap_kick2_xml;
+        case 0x6244bd81:  numBytes = 8019; return cheap_snare_xml;
+        case 0xba5ea537:  numBytes = 8587; return death_by_organs_xml;
+        case 0x2af6656b:  numBytes = 8422; return double_wobbler_xml;
+        case 0x2118391c:  numBytes = 7758; return Filter_Distortion_xml;
+        case 0xc819ccc4:  numBytes = 8618; return flashizm_xml;
+        case 0x748ca21c:  numBytes = 8571; return le_wob_xml;
+        case 0xfba7bab4:  numBytes = 8608; return organ_failure_xml;
+        case 0x805520e9:  numBytes = 7963; return organ_xml;
+        case 0xd3f150a6:  numBytes = 7965; return piano_sth__xml;
+        case 0xba35dfdc:  numBytes = 8035; return quinto_xml;
+        case 0xafdf8f6a:  numBytes = 8198; return syn_piano_xml;
+        case 0x6137bb34:  numBytes = 7963; return violin1_xml;
+        case 0x6145d2b5:  numBytes = 8003; return violin2_xml;
         default: break;
     }
 
@@ -3125,7 +7248,24 @@ const char* namedResourceList[] =
     "tempoSync_png",
     "toggleOff_png",
     "toggleOn_png",
-    "triplets_png"
+    "triplets_png",
+    "init_xml",
+    "cheap_hihat_xml",
+    "cheap_kick_xml",
+    "cheap_kick2_xml",
+    "cheap_snare_xml",
+    "death_by_organs_xml",
+    "double_wobbler_xml",
+    "Filter_Distortion_xml",
+    "flashizm_xml",
+    "le_wob_xml",
+    "organ_failure_xml",
+    "organ_xml",
+    "piano_sth__xml",
+    "quinto_xml",
+    "syn_piano_xml",
+    "violin1_xml",
+    "violin2_xml"
 };
 
 }
@@ -72,11 +72,62 @@ namespace BinaryData
     extern const char*   triplets_png;
     const int            triplets_pngSize = 464;
 
+    extern const char*   init_xml;
+    const int            init_xmlSize = 7905;
+
+    extern const char*   cheap_hihat_xml;
+    const int            cheap_hihat_xmlSize = 8017;
+
+    extern const char*   cheap_kick_xml;
+    const int            cheap_kick_xmlSize = 7933;
+
+    extern const char*   cheap_kick2_xml;
+    const int            cheap_kick2_xmlSize = 7890;
+
+    extern const char*   cheap_snare_xml;
+    const int            cheap_snare_xmlSize = 8019;
+
+    extern const char*   death_by_organs_xml;
+    const int            death_by_organs_xmlSize = 8587;
+
+    extern const char*   double_wobbler_xml;
+    const int            double_wobbler_xmlSize = 8422;
+
+    extern const char*   Filter_Distortion_xml;
+    const int            Filter_Distortion_xmlSize = 7758;
+
+    extern const char*   flashizm_xml;
+    const int            flashizm_xmlSize = 8618;
+
+    extern const char*   le_wob_xml;
+    const int            le_wob_xmlSize = 8571;
+
+    extern const char*   organ_failure_xml;
+    const int            organ_failure_xmlSize = 8608;
+
+    extern const char*   organ_xml;
+    const int            organ_xmlSize = 7963;
+
+    extern const char*   piano_sth__xml;
+    const int            piano_sth__xmlSize = 7965;
+
+    extern const char*   quinto_xml;
+    const int            quinto_xmlSize = 8035;
+
+    extern const char*   syn_piano_xml;
+    const int            syn_piano_xmlSize = 8198;
+
+    extern const char*   violin1_xml;
+    const int            violin1_xmlSize = 7963;
+
+    extern const char*   violin2_xml;
+    const int            violin2_xmlSize = 8003;
+
     // Points to the start of a list of resource names.
     extern const char* namedResourceList[];
 
     // Number of elements in the namedResourceList array.
-    const int namedResourceListSize = 21;
+    const int namedResourceListSize = 38;
 
     // If you provide the name of one of the binary resource variables above, this function will
     // return the corresponding data and its size (or a null pointer if the name isn't found).
@@ -26,6 +26,7 @@
 #include "modules/juce_graphics/juce_graphics.h"
 #include "modules/juce_gui_basics/juce_gui_basics.h"
 #include "modules/juce_gui_extra/juce_gui_extra.h"
+#include "modules/juce_opengl/juce_opengl.h"
 #include "BinaryData.h"
 
 #if ! DONT_SET_USING_JUCE_NAMESPACE
@@ -0,0 +1,274 @@
+/*
+  ==============================================================================
+
+    AliasBenchmark.cpp
+    Created: 16 Oct 2026 9:04:37pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "AliasBenchmark.h"
+#include "Voice.h"
+#include "SimdKernels.h"
+#include <cmath>
+#include <iostream>
+
+AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+namespace {
+    const int blockSize = 256;
+    const double settleSeconds = 0.25;     //!< attack, decimators and filter, rendered before the window
+    const int mainLobeBins = 4;             //!< half width of the main lobe of the Blackman-Harris window
+
+    const char* const tierNames[] = { "realtime", "offline" };
+
+    double toDb(double energy, double reference)
+    {
+        return 10. * std::log10((energy + 1.e-30) / (reference + 1.e-30));
+    }
+}
+
+AliasBenchmark::AliasBenchmark(const Options& o)
+    : options(o)
+    , fft(fftOrder, false)
+{
+    if (options.notes.size() == 0) {
+        // two octaves below the middle up to the top of a piano
+        const int notes[] = { 36, 60, 84, 96, 108 };
+        options.notes.addArray(notes, 5);
+    }
+    if (options.drives.size() == 0) {
+        const float drives[] = { -6.f, 0.f, 6.f, 12.f };
+        options.drives.addArray(drives, 4);
+    }
+
+    processor = dynamic_cast<PluginAudioProcessor*>(createPluginFilter());
+    if (processor != nullptr) {
+        synth.addVoice(new Voice(*processor));
+        synth.addSound(new Sound());
+        arena.allocate(Voice::getArenaSize(blockSize) + Voice::arenaAlignment, true);
+    }
+}
+
+AliasBenchmark::~AliasBenchmark()
+{
+    // the voice refers to the params of the processor
+    synth.clearVoices();
+    processor = nullptr;
+}
+
+bool AliasBenchmark::runFromCommandLine(const StringArray& args, String& error)
+{
+    if (!args.contains("--benchmark-alias")) {
+        return false;
+    }
+    Options o;
+    const int json = args.indexOf("--json");
+    if (json >= 0 && json + 1 < args.size()) {
+        o.json = File::getCurrentWorkingDirectory().getChildFile(args[json + 1].unquoted());
+    }
+
+    AliasBenchmark benchmark(o);
+    error = benchmark.run();
+    return true;
+}
+
+void AliasBenchmark::resetParams()
+{
+    SynthParams& p = *processor;
+    for (Param* param : p.serializeParams) {
+        param->set(param->getDefault());
+    }
+    p.osc[0].oscActivation.setStep(eOnOffToggle::eOn);
+    p.osc[0].vol.setUI(-6.f, false);
+    for (size_t o = 1; o < p.osc.size(); ++o) {
+        p.osc[o].oscActivation.setStep(eOnOffToggle::eOff);
+    }
+    for (SynthParams::Filter& f : p.filter) {
+        f.filterActivation.setStep(eOnOffToggle::eOff);
+    }
+    p.oversampling.setStep(eOversampling::eOff);
+    // a sustained note at the level of its attack
+    p.envVol[0].sustain.setUI(0.f, false);
+}
+
+void AliasBenchmark::collectVariants(Array<Variant>& variants) const
+{
+    const auto oscillator = [](eOscWaves wave, bool bandLimited, eOversampling oversampling) {
+        return [=](SynthParams& p, float) {
+            p.osc[0].waveForm.setStep(wave);
+            p.osc[0].bandLimited.setStep(bandLimited ? eOnOffToggle::eOn : eOnOffToggle::eOff);
+            p.oversampling.setStep(oversampling);
+        };
+    };
+    variants.add({ "square naive", oscillator(eOscWaves::eOscSquare, false, eOversampling::eOff), false });
+    variants.add({ "square polyblep", oscillator(eOscWaves::eOscSquare, true, eOversampling::eOff), false });
+    variants.add({ "saw naive", oscillator(eOscWaves::eOscSaw, false, eOversampling::eOff), false });
+    variants.add({ "saw polyblep", oscillator(eOscWaves::eOscSaw, true, eOversampling::eOff), false });
+    variants.add({ "wavetable", oscillator(eOscWaves::eOscWavetable, false, eOversampling::eOff), false });
+    variants.add({ "saw naive 2x", oscillator(eOscWaves::eOscSaw, false, eOversampling::e2x), false });
+    variants.add({ "saw naive 4x", oscillator(eOscWaves::eOscSaw, false, eOversampling::e4x), false });
+    variants.add({ "saw polyblep 2x", oscillator(eOscWaves::eOscSaw, true, eOversampling::e2x), false });
+    variants.add({ "saw naive adapt", oscillator(eOscWaves::eOscSaw, false, eOversampling::eAdaptive), false });
+
+    // the band limited saw into a resonant ladder, the drive is the level of the oscillator
+    const auto ladder = [](bool ladderOversampling) {
+        return [=](SynthParams& p, float drive) {
+            p.osc[0].waveForm.setStep(eOscWaves::eOscSaw);
+            p.osc[0].bandLimited.setStep(eOnOffToggle::eOn);
+            p.osc[0].vol.setUI(drive, false);
+            SynthParams::Filter& f = p.filter[0];
+            f.filterActivation.setStep(eOnOffToggle::eOn);
+            f.passtype.setStep(eBiquadFilters::eLadder);
+            f.ladderOversampling.setStep(ladderOversampling ? eOnOffToggle::eOn : eOnOffToggle::eOff);
+            f.lpCutoff.set(5000.f);
+            f.resonance.set(f.resonance.getMax() * 0.75f);
+        };
+    };
+    variants.add({ "ladder", ladder(false), true });
+    variants.add({ "ladder 2x", ladder(true), true });
+}
+
+String AliasBenchmark::run()
+{
+    if (processor == nullptr) {
+        return "the processor could not be created";
+    }
+
+    Array<Variant> variants;
+    collectVariants(variants);
+
+    Array<var> results;
+    std::cout << "variant           tier      note  drive  f0 Hz    alias dB  below f0 dB  ns/sample" << std::endl;
+    for (const Variant& v : variants) {
+        for (eQualityTier tier : { eQualityTier::eRealtime, eQualityTier::eOffline }) {
+            for (int note : options.notes) {
+                for (int d = 0; d < (v.usesDrive ? options.drives.size() : 1); ++d) {
+                    const Result r = runCase(v, tier, note, v.usesDrive ? options.drives[d] : 0.f);
+                    std::cout << r.variant.paddedRight(' ', 17) << " " << String(tierNames[static_cast<int>(tier)]).paddedRight(' ', 9) << " "
+                              << String(note).paddedLeft(' ', 4) << " " << String(r.drive, 1).paddedLeft(' ', 6) << " "
+                              << String(r.fundamentalHz, 1).paddedLeft(' ', 7) << " " << String(r.aliasDb, 1).paddedLeft(' ', 9) << " "
+                              << String(r.belowFundamentalDb, 1).paddedLeft(' ', 12) << " " << String(r.nsPerSample, 2).paddedLeft(' ', 10)
+                              << std::endl;
+                    results.add(toJson(r));
+                }
+            }
+        }
+    }
+
+    if (options.json != File::nonexistent) {
+        DynamicObject::Ptr root = new DynamicObject();
+        root->setProperty("cpu", SystemStats::getCpuVendor());
+        root->setProperty("cpuMHz", SystemStats::getCpuSpeedInMegaherz());
+        root->setProperty("simd", SimdKernels::get().name);
+        root->setProperty("sampleRate", options.sampleRate);
+        root->setProperty("fftSize", 1 << fftOrder);
+        root->setProperty("metric", "nsPerSample");
+        root->setProperty("results", results);
+        if (!options.json.replaceWithText(JSON::toString(var(root.get())))) {
+            return "cannot write " + options.json.getFullPathName();
+        }
+    }
+    return String();
+}
+
+AliasBenchmark::Result AliasBenchmark::runCase(const Variant& v, eQualityTier tier, int note, float drive)
+{
+    const ScopedFlushToZero flushToZero;
+    SynthParams& p = *processor;
+    resetParams();
+    v.setup(p, drive);
+    p.offlineQuality.setStep(tier == eQualityTier::eOffline ? eOnOffToggle::eOn : eOnOffToggle::eOff);
+
+    const size_t cacheLine = sizeof(float) * Voice::arenaAlignment;
+    const size_t misalignment = reinterpret_cast<pointer_sized_uint>(arena.getData()) % cacheLine;
+    float* aligned = arena + (misalignment == 0 ? 0 : (cacheLine - misalignment) / sizeof(float));
+
+    synth.allNotesOff(0, false);
+    synth.setCurrentPlaybackSampleRate(options.sampleRate);
+    Voice* const voice = static_cast<Voice*>(synth.getVoice(0));
+    voice->prepare(options.sampleRate, blockSize, aligned);
+    voice->setRandomSeed(1);
+    p.updateSnapshot(tier);
+    p.globalModMatrix.compile();
+    p.compileRenderPlan();
+    synth.noteOn(1, note, 0.8f);
+
+    const int numAnalysed = 1 << fftOrder;
+    const int numSettle = roundToInt(settleSeconds * options.sampleRate / blockSize) * blockSize;
+    AudioSampleBuffer output(2, numSettle + numAnalysed);
+    output.clear();
+
+    int64 elapsed = 0;
+    for (int start = 0; start < output.getNumSamples(); start += blockSize) {
+        const int64 begin = Time::getHighResolutionTicks();
+        // per block like processBlock
+        p.updateSnapshot(tier);
+        p.globalModMatrix.compile();
+        p.compileRenderPlan();
+        voice->renderNextBlock(output, start, blockSize);
+        if (start >= numSettle) {
+            elapsed += Time::getHighResolutionTicks() - begin;
+        }
+    }
+
+    Result r;
+    r.variant = v.name;
+    r.tier = tier;
+    r.note = note;
+    r.drive = drive;
+    r.fundamentalHz = p.getSnapshot().osc[0].noteFreq[static_cast<size_t>(note)];
+    r.nsPerSample = Time::highResolutionTicksToSeconds(elapsed) * 1.e9 / numAnalysed;
+    analyse(output.getReadPointer(0, numSettle), r);
+    synth.allNotesOff(0, false);
+    return r;
+}
+
+void AliasBenchmark::analyse(const float* samples, Result& r) const
+{
+    const int n = fft.getSize();
+    HeapBlock<float> data(static_cast<size_t>(2 * n), true);
+    for (int i = 0; i < n; ++i) {
+        // 4 term Blackman-Harris, sidelobes below -92 dB
+        const double x = 2. * double_Pi * i / (n - 1);
+        const double w = 0.35875 - 0.48829 * std::cos(x) + 0.14128 * std::cos(2. * x) - 0.01168 * std::cos(3. * x);
+        data[i] = static_cast<float>(samples[i] * w);
+    }
+    fft.performFrequencyOnlyForwardTransform(data);
+
+    const double fundamentalBins = r.fundamentalHz * n / options.sampleRate;
+    double harmonic = 0.;
+    double alias = 0.;
+    double below = 0.;
+    for (int k = mainLobeBins + 1; k < n / 2; ++k) {
+        const double e = static_cast<double>(data[k]) * data[k];
+        const double h = std::floor(k / fundamentalBins + 0.5);
+        if (h >= 1. && std::abs(k - h * fundamentalBins) <= mainLobeBins) {
+            harmonic += e;
+        } else {
+            alias += e;
+            if (k < fundamentalBins - mainLobeBins) {
+                below += e;
+            }
+        }
+    }
+    r.aliasDb = toDb(alias, harmonic);
+    r.belowFundamentalDb = toDb(below, harmonic);
+}
+
+var AliasBenchmark::toJson(const Result& r)
+{
+    DynamicObject::Ptr o = new DynamicObject();
+    o->setProperty("case", r.variant + " / " + tierNames[static_cast<int>(r.tier)] + " / note " + String(r.note)
+                           + " / " + String(r.drive, 1) + " dB");
+    o->setProperty("variant", r.variant);
+    o->setProperty("tier", tierNames[static_cast<int>(r.tier)]);
+    o->setProperty("note", r.note);
+    o->setProperty("drive", r.drive);
+    o->setProperty("fundamentalHz", r.fundamentalHz);
+    o->setProperty("aliasDb", r.aliasDb);
+    o->setProperty("belowFundamentalDb", r.belowFundamentalDb);
+    o->setProperty("nsPerSample", r.nsPerSample);
+    return var(o.get());
+}
@@ -0,0 +1,85 @@
+/*
+  ==============================================================================
+
+    AliasBenchmark.h
+    Created: 16 Oct 2026 9:04:37pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef ALIASBENCHMARK_H_INCLUDED
+#define ALIASBENCHMARK_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "PluginProcessor.h"
+#include <functional>
+
+//! AliasBenchmark: the aliasing and the cost of the oscillator and ladder variants in both quality tiers
+/*! A variant sets up the first oscillator and filter of a processor that is never prepared,
+    like the VoiceBenchmark, and one voice holds a note. After the attack has settled a window of
+    the output goes through a Blackman-Harris window and an FFT. The bins at the harmonics of the
+    note are the signal, every other bin above DC is counted as alias, so a clean variant is
+    limited by the sidelobes of the window near -90 dB. The alias energy below the fundamental,
+    where no harmonic can hide it, is reported on its own. The time of the rendering gives the
+    cost, so every row of the table is quality against ns per sample.
+*/
+class AliasBenchmark {
+public:
+    struct Options {
+        Array<int> notes;               //!< the pitches of every variant
+        Array<float> drives;            //!< dB of the oscillator into the ladder
+        double sampleRate = 48000.;
+        File json;                      //!< the results as json, none if it does not exist
+    };
+
+    struct Result {
+        String variant;
+        eQualityTier tier;
+        int note;
+        float drive;                    //!< dB, 0 for the oscillators without filter
+        double fundamentalHz;
+        double aliasDb;                 //!< energy of the non-harmonic bins against the harmonic ones
+        double belowFundamentalDb;      //!< the same for the bins between DC and the fundamental
+        double nsPerSample;
+    };
+
+    explicit AliasBenchmark(const Options& o);
+    ~AliasBenchmark();
+
+    //! \brief runs all cases, prints a line per case and writes the json, returns an error message or an empty string
+    String run();
+
+    //! \brief parses "--benchmark-alias [--json <file>]" and runs, false if the arguments are no alias benchmark
+    static bool runFromCommandLine(const StringArray& args, String& error);
+
+    //! 2^fftOrder samples are analysed per case
+    static const int fftOrder = 14;
+
+private:
+    typedef std::function<void(SynthParams&, float)> tSetup;
+
+    struct Variant {
+        String name;
+        tSetup setup;       //!< with the drive in dB
+        bool usesDrive;     //!< the ladder variants run at every drive
+    };
+
+    void collectVariants(Array<Variant>& variants) const;
+    //! \brief every param at its default, one sustained oscillator without filter
+    void resetParams();
+    Result runCase(const Variant& v, eQualityTier tier, int note, float drive);
+    //! \brief fills the alias figures of the result from the rendered samples
+    void analyse(const float* samples, Result& r) const;
+    static var toJson(const Result& r);
+
+    Options options;
+    ScopedPointer<PluginAudioProcessor> processor;   //!< params and mod matrix of the voice
+    Synthesiser synth;
+    HeapBlock<float> arena;
+    FFT fft;
+
+    JUCE_DECLARE_NON_COPYABLE(AliasBenchmark)
+};
+
+#endif  // ALIASBENCHMARK_H_INCLUDED
@@ -0,0 +1,255 @@
+/*
+  ==============================================================================
+
+    AudioEnginePanel.cpp
+    Created: 15 Oct 2026 10:57:40am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "AudioEnginePanel.h"
+#include "PluginProcessor.h"
+
+AudioEnginePanel::AudioEnginePanel(AudioDeviceManager& dm, AudioEngineSettings& s, LiveMidiPlayer& p,
+                                   PluginAudioProcessor& processor, ThreadPlacement& tp)
+    : deviceManager(dm)
+    , settings(s)
+    , player(p)
+    , placement(tp)
+    , noteLatency(processor.telemetry.notes)
+    , selector(dm, 0, 0, processor.getNumOutputChannels(), processor.getNumOutputChannels(), true, false, true, false)
+    , latencyButton("measure latency")
+    , tuneButton("find smallest buffer")
+    , coresLabel(String::empty, "audio cores")
+    , realtimeButton("real-time scheduling")
+    , progress(0.)
+    , progressBar(progress)
+    , latencyTest(dm)
+    , autoTune(dm, processor, p.getMidiMessageCollector())
+    , latencyRunning(false)
+    , tuneRunning(false)
+{
+    addAndMakeVisible(selector);
+    addAndMakeVisible(latencyButton);
+    addAndMakeVisible(tuneButton);
+    addAndMakeVisible(profileLabel);
+    addAndMakeVisible(statusLabel);
+    addAndMakeVisible(midiLabel);
+    addChildComponent(progressBar);
+    addAndMakeVisible(coresLabel);
+    addAndMakeVisible(coresEditor);
+    addAndMakeVisible(realtimeButton);
+    latencyButton.addListener(this);
+    tuneButton.addListener(this);
+    latencyButton.setTooltip("plays a burst of noise, connect an output to the first input first");
+    tuneButton.setTooltip("plays full polyphony of the current patch at every buffer size of the device");
+
+    const ThreadPlacement::Settings placed = placement.getSettings();
+    coresEditor.setText(ThreadPlacement::formatCores(placed.audioCores), false);
+    coresEditor.setEnabled(ThreadPlacement::canPinThreads());
+    coresEditor.setTooltip("e.g. 2,3: the audio callback runs on the first core, the voice workers on the others, "
+                           "the editor on none of them; empty leaves the threads to the system");
+    coresEditor.addListener(this);
+    realtimeButton.setToggleState(placed.realtimeScheduling, dontSendNotification);
+    realtimeButton.addListener(this);
+
+    deviceManager.addChangeListener(this);
+    showProfile();
+    // the events until the panel was opened say nothing about the current device
+    player.getLiveMidi().resetStats();
+    noteLatency.resetReport();
+    showMidiTiming();
+    showScheduling();
+    startTimer(midiRefreshMs);
+    setSize(500, 590 + midiLabelHeight);
+}
+
+AudioEnginePanel::~AudioEnginePanel()
+{
+    deviceManager.removeChangeListener(this);
+    if (latencyRunning) {
+        latencyTest.finish();
+    }
+}
+
+void AudioEnginePanel::resized()
+{
+    Rectangle<int> r = getLocalBounds().reduced(8);
+    Rectangle<int> bottom = r.removeFromBottom(130 + midiLabelHeight);
+    selector.setBounds(r);
+
+    Rectangle<int> threads = bottom.removeFromBottom(24);
+    coresLabel.setBounds(threads.removeFromLeft(80));
+    coresEditor.setBounds(threads.removeFromLeft(120).reduced(0, 2));
+    realtimeButton.setBounds(threads.withTrimmedLeft(16));
+    bottom.removeFromBottom(6);
+
+    Rectangle<int> buttons = bottom.removeFromTop(24);
+    latencyButton.setBounds(buttons.removeFromLeft(buttons.getWidth() / 2).reduced(4, 0));
+    tuneButton.setBounds(buttons.reduced(4, 0));
+    bottom.removeFromTop(6);
+    profileLabel.setBounds(bottom.removeFromTop(40));
+    const Rectangle<int> status = bottom.removeFromTop(24);
+    statusLabel.setBounds(status);
+    progressBar.setBounds(status.withLeft(status.getRight() - 150).reduced(0, 3));
+    midiLabel.setBounds(bottom.removeFromTop(midiLabelHeight));
+}
+
+void AudioEnginePanel::buttonClicked(Button* b)
+{
+    if (b == &realtimeButton) {
+        applyPlacement();
+        return;
+    }
+    if (latencyRunning || tuneRunning) {
+        return;
+    }
+    String error;
+    if (b == &latencyButton) {
+        error = latencyTest.start(player);
+        latencyRunning = error.isEmpty();
+        if (latencyRunning) {
+            statusLabel.setText("measuring the round trip...", dontSendNotification);
+        }
+    } else if (b == &tuneButton) {
+        error = autoTune.start();
+        tuneRunning = error.isEmpty();
+        progressBar.setVisible(tuneRunning);
+    }
+    if (error.isNotEmpty()) {
+        statusLabel.setText(error, dontSendNotification);
+        return;
+    }
+    latencyButton.setEnabled(false);
+    tuneButton.setEnabled(false);
+    startTimer(100);
+}
+
+void AudioEnginePanel::textEditorReturnKeyPressed(TextEditor&)
+{
+    applyPlacement();
+}
+
+void AudioEnginePanel::textEditorFocusLost(TextEditor&)
+{
+    applyPlacement();
+}
+
+void AudioEnginePanel::applyPlacement()
+{
+    ThreadPlacement::Settings s;
+    s.audioCores = ThreadPlacement::parseCores(coresEditor.getText());
+    s.realtimeScheduling = realtimeButton.getToggleState();
+    placement.setSettings(s);
+    // the cores the machine has
+    coresEditor.setText(ThreadPlacement::formatCores(s.audioCores), false);
+}
+
+void AudioEnginePanel::changeListenerCallback(ChangeBroadcaster*)
+{
+    showProfile();
+}
+
+void AudioEnginePanel::timerCallback()
+{
+    showMidiTiming();
+    showScheduling();
+    if (!latencyRunning && !tuneRunning) {
+        return;
+    }
+
+    if (latencyRunning) {
+        if (latencyTest.isDone()) {
+            finishLatencyTest();
+        }
+    } else if (tuneRunning) {
+        progress = autoTune.getProgress();
+        statusLabel.setText(autoTune.getStatus(), dontSendNotification);
+        if (!autoTune.isRunning()) {
+            tuneRunning = false;
+            progressBar.setVisible(false);
+            if (autoTune.getResult() > 0) {
+                AudioEngineSettings::Profile p = settings.getCurrentProfile();
+                p.stableBufferSize = autoTune.getResult();
+                p.bufferSize = autoTune.getResult();
+                settings.setCurrentProfile(p);
+            }
+        }
+    }
+
+    if (!latencyRunning && !tuneRunning) {
+        startTimer(midiRefreshMs);
+        latencyButton.setEnabled(true);
+        tuneButton.setEnabled(true);
+        showProfile();
+    }
+}
+
+void AudioEnginePanel::finishLatencyTest()
+{
+    latencyRunning = false;
+    const int roundTrip = latencyTest.finish();
+    if (roundTrip < 0) {
+        statusLabel.setText("no loopback found, connect an output to the first input", dontSendNotification);
+        return;
+    }
+    AudioEngineSettings::Profile p = settings.getCurrentProfile();
+    p.roundTripSamples = roundTrip;
+    p.reportedLatencySamples = latencyTest.getReportedLatency();
+    settings.setCurrentProfile(p);
+    statusLabel.setText("round trip measured", dontSendNotification);
+}
+
+void AudioEnginePanel::showProfile()
+{
+    AudioIODevice* device = deviceManager.getCurrentAudioDevice();
+    if (device == nullptr) {
+        profileLabel.setText("no audio device", dontSendNotification);
+        return;
+    }
+
+    const double rate = device->getCurrentSampleRate();
+    const auto toMs = [rate](int samples) { return String(rate > 0. ? 1000. * samples / rate : 0., 1) + " ms"; };
+    const AudioEngineSettings::Profile p = settings.getCurrentProfile();
+    String text;
+    text << "round trip: ";
+    if (p.roundTripSamples >= 0) {
+        text << p.roundTripSamples << " samples (" << toMs(p.roundTripSamples) << "), driver reports "
+             << p.reportedLatencySamples << " samples";
+    } else {
+        text << "not measured";
+    }
+    text << "\nsmallest stable buffer: ";
+    if (p.stableBufferSize > 0) {
+        text << p.stableBufferSize << " samples (" << toMs(p.stableBufferSize) << ")";
+    } else {
+        text << "not tuned";
+    }
+    profileLabel.setText(text, dontSendNotification);
+}
+
+void AudioEnginePanel::showScheduling()
+{
+    // a refused request means the workers drop out first under load
+    realtimeButton.setTooltip("asks the system to schedule the audio callback like the threads of an audio driver, "
+                              "the voice workers ask anyway\n" + RealtimeScheduling::getReport());
+}
+
+void AudioEnginePanel::showMidiTiming()
+{
+    const LiveMidiCollector::Stats s = player.getLiveMidi().getStats();
+    String text;
+    text << "live midi: " << String(s.numEvents) << " events at their timestamps, one buffer ("
+         << String(s.blockMs, 1) << " ms) late";
+    if (s.numLate > 0) {
+        text << ", " << String(s.numLate) << " missed by up to " << String(s.maxLateMs, 1) << " ms";
+    }
+    text << "\ncallbacks off the device clock by " << String(s.meanCallbackJitterMs, 2) << " ms on average, "
+         << String(s.maxCallbackJitterMs, 2) << " ms at most";
+#if SYNISTER_NOTE_LATENCY
+    // from the events the collector placed into the blocks to the sound of their voices
+    text << "\n" << NoteLatency::formatReport(noteLatency.getReport());
+#endif
+    midiLabel.setText(text, dontSendNotification);
+}
@@ -0,0 +1,86 @@
+/*
+  ==============================================================================
+
+    AudioEnginePanel.h
+    Created: 15 Oct 2026 10:57:40am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef AUDIOENGINEPANEL_H_INCLUDED
+#define AUDIOENGINEPANEL_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "AudioEngineSettings.h"
+#include "LatencyTest.h"
+#include "BufferAutoTune.h"
+#include "LiveMidiInput.h"
+#include "ThreadPlacement.h"
+#include "NoteLatency.h"
+#include "RealtimeScheduling.h"
+
+class PluginAudioProcessor;
+
+//! AudioEnginePanel: the audio settings dialog of the standalone build
+/*! The device selector of JUCE, below it the latency measurement and the buffer auto tune. The
+    results of both are stored in the profile of the device and shown whenever the device changes.
+    The timing of the live midi is shown below them while the panel is open, at the bottom the
+    cores and the scheduling of the audio threads of this machine, see ThreadPlacement.
+*/
+class AudioEnginePanel : public Component, private ButtonListener, private ChangeListener, private Timer,
+                         private TextEditor::Listener {
+public:
+    AudioEnginePanel(AudioDeviceManager& dm, AudioEngineSettings& s, LiveMidiPlayer& p, PluginAudioProcessor& processor,
+                     ThreadPlacement& placement);
+    ~AudioEnginePanel();
+
+    void resized() override;
+
+private:
+    void buttonClicked(Button* b) override;
+    //! the device changed, shows its profile
+    void changeListenerCallback(ChangeBroadcaster*) override;
+    //! polls the running test and the midi timing
+    void timerCallback() override;
+    //! the list of audio cores was edited
+    void textEditorReturnKeyPressed(TextEditor&) override;
+    void textEditorFocusLost(TextEditor&) override;
+
+    void finishLatencyTest();
+    void showProfile();
+    void showMidiTiming();
+    //! \brief the requests for real-time scheduling so far, in the tooltip of the scheduling button
+    void showScheduling();
+    void applyPlacement();
+
+    AudioDeviceManager& deviceManager;
+    AudioEngineSettings& settings;
+    LiveMidiPlayer& player;
+    ThreadPlacement& placement;
+    NoteLatency& noteLatency;
+
+    AudioDeviceSelectorComponent selector;
+    TextButton latencyButton;
+    TextButton tuneButton;
+    Label profileLabel;
+    Label statusLabel;
+    Label midiLabel;
+    Label coresLabel;
+    TextEditor coresEditor;
+    ToggleButton realtimeButton;
+    double progress;
+    ProgressBar progressBar;
+
+    LatencyTest latencyTest;
+    BufferAutoTune autoTune;
+    bool latencyRunning;
+    bool tuneRunning;
+
+    static const int midiRefreshMs = 500;
+    static const int midiLabelHeight = SYNISTER_NOTE_LATENCY ? 72 : 40;     //!< two more lines for the note latency
+
+    JUCE_DECLARE_NON_COPYABLE(AudioEnginePanel)
+};
+
+#endif  // AUDIOENGINEPANEL_H_INCLUDED
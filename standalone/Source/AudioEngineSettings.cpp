@@ -0,0 +1,171 @@
+/*
+  ==============================================================================
+
+    AudioEngineSettings.cpp
+    Created: 15 Oct 2026 10:02:37am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "AudioEngineSettings.h"
+
+namespace {
+    const char* const profilesKey = "audioEngine";
+
+    //! lowest latency first, the ones the build or the platform lacks are skipped
+    const char* const lowLatencyTypes[] = { "ASIO", "Windows Audio (Exclusive Mode)", "JACK", "CoreAudio" };
+}
+
+AudioEngineSettings::AudioEngineSettings(AudioDeviceManager& dm, PropertySet& s)
+    : deviceManager(dm)
+    , settings(s)
+{
+    // the plugin holder stores the device setup on quit, without one this is the first start
+    if (!settings.containsKey("audioSetup")) {
+        selectLowLatencyType();
+    }
+    deviceManager.addChangeListener(this);
+    changeListenerCallback(&deviceManager);
+}
+
+AudioEngineSettings::~AudioEngineSettings()
+{
+    deviceManager.removeChangeListener(this);
+}
+
+String AudioEngineSettings::getDeviceKey(AudioIODevice& device)
+{
+    return device.getTypeName() + "/" + device.getName();
+}
+
+AudioEngineSettings::Profile AudioEngineSettings::getCurrentProfile() const
+{
+    AudioIODevice* device = deviceManager.getCurrentAudioDevice();
+    return device != nullptr ? readProfile(getDeviceKey(*device)) : Profile();
+}
+
+void AudioEngineSettings::setCurrentProfile(const Profile& p)
+{
+    AudioIODevice* device = deviceManager.getCurrentAudioDevice();
+    if (device == nullptr) {
+        return;
+    }
+    writeProfile(getDeviceKey(*device), p);
+    applyProfile(p);
+}
+
+void AudioEngineSettings::changeListenerCallback(ChangeBroadcaster*)
+{
+    AudioIODevice* device = deviceManager.getCurrentAudioDevice();
+    if (device == nullptr) {
+        return;
+    }
+
+    const String key = getDeviceKey(*device);
+    Profile p = readProfile(key);
+    if (key != currentKey) {
+        // another device was opened, it gets the rate and buffer size it had last time
+        currentKey = key;
+        if (p.sampleRate > 0.) {
+            applyProfile(p);
+            return;
+        }
+    }
+
+    // the user chose a rate or buffer size, or applyProfile() did
+    p.sampleRate = device->getCurrentSampleRate();
+    p.bufferSize = device->getCurrentBufferSizeSamples();
+    writeProfile(key, p);
+}
+
+void AudioEngineSettings::selectLowLatencyType()
+{
+    const OwnedArray<AudioIODeviceType>& types = deviceManager.getAvailableDeviceTypes();
+    for (const char* name : lowLatencyTypes) {
+        for (AudioIODeviceType* type : types) {
+            if (type->getTypeName() != name) {
+                continue;
+            }
+            type->scanForDevices();
+            if (type->getDeviceNames().size() > 0) {
+                if (deviceManager.getCurrentAudioDeviceType() != name) {
+                    deviceManager.setCurrentAudioDeviceType(name, true);
+                }
+                return;
+            }
+        }
+    }
+}
+
+void AudioEngineSettings::applyProfile(const Profile& p)
+{
+    AudioIODevice* device = deviceManager.getCurrentAudioDevice();
+    if (device == nullptr) {
+        return;
+    }
+
+    AudioDeviceManager::AudioDeviceSetup setup;
+    deviceManager.getAudioDeviceSetup(setup);
+    const AudioDeviceManager::AudioDeviceSetup old = setup;
+    if (p.sampleRate > 0. && device->getAvailableSampleRates().contains(p.sampleRate)) {
+        setup.sampleRate = p.sampleRate;
+    }
+    if (p.bufferSize > 0 && device->getAvailableBufferSizes().contains(p.bufferSize)) {
+        setup.bufferSize = p.bufferSize;
+    }
+    if (setup == old) {
+        return;
+    }
+
+    const String error = deviceManager.setAudioDeviceSetup(setup, true);
+    if (error.isNotEmpty()) {
+        DBG("audio engine profile not applied: " + error);
+    }
+}
+
+AudioEngineSettings::Profile AudioEngineSettings::readProfile(const String& key) const
+{
+    Profile p;
+    ScopedPointer<XmlElement> profiles = settings.getXmlValue(profilesKey);
+    if (profiles == nullptr) {
+        return p;
+    }
+    forEachXmlChildElementWithTagName(*profiles, device, "device") {
+        if (device->getStringAttribute("key") == key) {
+            p.sampleRate = device->getDoubleAttribute("sampleRate");
+            p.bufferSize = device->getIntAttribute("bufferSize");
+            p.roundTripSamples = device->getIntAttribute("roundTrip", -1);
+            p.reportedLatencySamples = device->getIntAttribute("reportedLatency");
+            p.stableBufferSize = device->getIntAttribute("stableBufferSize");
+            break;
+        }
+    }
+    return p;
+}
+
+void AudioEngineSettings::writeProfile(const String& key, const Profile& p)
+{
+    ScopedPointer<XmlElement> profiles = settings.getXmlValue(profilesKey);
+    if (profiles == nullptr) {
+        profiles = new XmlElement("audioengine");
+    }
+
+    XmlElement* device = nullptr;
+    forEachXmlChildElementWithTagName(*profiles, e, "device") {
+        if (e->getStringAttribute("key") == key) {
+            device = e;
+            break;
+        }
+    }
+    if (device == nullptr) {
+        device = profiles->createNewChildElement("device");
+        device->setAttribute("key", key);
+    }
+    device->setAttribute("sampleRate", p.sampleRate);
+    device->setAttribute("bufferSize", p.bufferSize);
+    device->setAttribute("roundTrip", p.roundTripSamples);
+    device->setAttribute("reportedLatency", p.reportedLatencySamples);
+    device->setAttribute("stableBufferSize", p.stableBufferSize);
+    settings.setValue(profilesKey, profiles);
+}
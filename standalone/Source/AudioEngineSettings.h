@@ -0,0 +1,63 @@
+/*
+  ==============================================================================
+
+    AudioEngineSettings.h
+    Created: 15 Oct 2026 10:02:37am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef AUDIOENGINESETTINGS_H_INCLUDED
+#define AUDIOENGINESETTINGS_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+//! AudioEngineSettings: sample rate, buffer size and measured latency of every audio device of the standalone build
+/*! A profile is keyed by the type and the name of the device and kept in the settings file of
+    the application. When a device is opened its stored rate and buffer size are applied, when the
+    user changes them the new ones are stored. The round trip measured by LatencyTest and the
+    buffer size BufferAutoTune found are kept in the same profile. On the first start the device
+    type with the lowest latency the build supports is chosen instead of the system default.
+*/
+class AudioEngineSettings : private ChangeListener {
+public:
+    struct Profile {
+        double sampleRate = 0.;         //!< 0 before the device was used
+        int bufferSize = 0;
+        int roundTripSamples = -1;      //!< measured through a loopback, -1 before a measurement
+        int reportedLatencySamples = 0; //!< input plus output latency the driver reported at the measurement
+        int stableBufferSize = 0;       //!< smallest buffer size without late blocks under full polyphony, 0 before a tune
+    };
+
+    //! \brief the device manager must be initialised already
+    AudioEngineSettings(AudioDeviceManager& dm, PropertySet& s);
+    ~AudioEngineSettings();
+
+    //! \brief "type/name" of a device
+    static String getDeviceKey(AudioIODevice& device);
+
+    //! \brief profile of the open device, an empty one without device
+    Profile getCurrentProfile() const;
+    //! \brief replaces the profile of the open device and applies its rate and buffer size
+    void setCurrentProfile(const Profile& p);
+
+private:
+    //! a device was opened or its setup changed
+    void changeListenerCallback(ChangeBroadcaster*) override;
+    //! \brief the first available type of asio, exclusive wasapi, jack and core audio, or the current one
+    void selectLowLatencyType();
+    //! \brief sets rate and buffer size of the open device to the profile, where the device supports them
+    void applyProfile(const Profile& p);
+
+    Profile readProfile(const String& key) const;
+    void writeProfile(const String& key, const Profile& p);
+
+    AudioDeviceManager& deviceManager;
+    PropertySet& settings;
+    String currentKey;      //!< of the device the profile was applied to last
+
+    JUCE_DECLARE_NON_COPYABLE(AudioEngineSettings)
+};
+
+#endif  // AUDIOENGINESETTINGS_H_INCLUDED
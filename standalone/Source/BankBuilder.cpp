@@ -0,0 +1,68 @@
+/*
+  ==============================================================================
+
+    BankBuilder.cpp
+    Created: 16 Oct 2026 4:05:31pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "BankBuilder.h"
+#include "PluginProcessor.h"
+#include "PresetBank.h"
+#include <iostream>
+
+AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+namespace {
+    struct FileNameComparator {
+        static int compareElements(const File& a, const File& b) {
+            return a.getFileName().compareNatural(b.getFileName());
+        }
+    };
+}
+
+bool BankBuilder::runFromCommandLine(const StringArray& args, String& error)
+{
+    const int i = args.indexOf("--build-bank");
+    if (i < 0) {
+        return false;
+    }
+    if (i + 2 >= args.size()) {
+        error = "usage: --build-bank <patch directory> <bank file>";
+        return true;
+    }
+    const File cwd = File::getCurrentWorkingDirectory();
+    File bank = cwd.getChildFile(args[i + 2].unquoted());
+    if (!bank.hasFileExtension(PresetBank::fileExtension)) {
+        bank = bank.withFileExtension(PresetBank::fileExtension);
+    }
+    error = run(cwd.getChildFile(args[i + 1].unquoted()), bank);
+    return true;
+}
+
+String BankBuilder::run(const File& patchDirectory, const File& bank)
+{
+    if (!patchDirectory.isDirectory()) {
+        return "no directory: " + patchDirectory.getFullPathName();
+    }
+    Array<File> patches;
+    patchDirectory.findChildFiles(patches, File::findFiles, false, "*.xml");
+    FileNameComparator comparator;
+    patches.sort(comparator);
+    if (patches.size() == 0) {
+        return "no patches in " + patchDirectory.getFullPathName();
+    }
+
+    // only for the registry of the params
+    ScopedPointer<PluginAudioProcessor> processor = dynamic_cast<PluginAudioProcessor*>(createPluginFilter());
+    if (processor == nullptr) {
+        return "the processor could not be created";
+    }
+    const String error = PresetBank::write(patches, bank, *processor);
+    if (error.isEmpty()) {
+        std::cout << patches.size() << " patches written to " << bank.getFullPathName() << std::endl;
+    }
+    return error;
+}
@@ -0,0 +1,30 @@
+/*
+  ==============================================================================
+
+    BankBuilder.h
+    Created: 16 Oct 2026 4:05:31pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef BANKBUILDER_H_INCLUDED
+#define BANKBUILDER_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+//! BankBuilder: writes the patch files of a directory to one PresetBank
+/*! The patches are taken in the natural order of their file names, the columns of the bank
+    are the serialized params of this version. A bank in the preset directory is listed by the
+    preset browser next to the patch files.
+*/
+class BankBuilder {
+public:
+    //! \brief parses "--build-bank <patch directory> <bank file>" and writes the bank, false if the arguments are no bank build
+    static bool runFromCommandLine(const StringArray& args, String& error);
+
+    //! \brief writes the bank, returns an error message or an empty string
+    static String run(const File& patchDirectory, const File& bank);
+};
+
+#endif  // BANKBUILDER_H_INCLUDED
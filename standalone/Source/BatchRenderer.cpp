@@ -0,0 +1,228 @@
+/*
+  ==============================================================================
+
+    BatchRenderer.cpp
+    Created: 15 Oct 2026 7:03:52am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "BatchRenderer.h"
+#include "PluginProcessor.h"
+
+namespace {
+    //! \brief "36,48,60" into numbers in the midi range
+    Array<int> parseNumberList(const String& list, int minValue, int maxValue)
+    {
+        Array<int> numbers;
+        StringArray tokens = StringArray::fromTokens(list, ",", "");
+        tokens.trim();
+        tokens.removeEmptyStrings();
+        for (const String& t : tokens) {
+            numbers.addIfNotAlreadyThere(jlimit(minValue, maxValue, t.getIntValue()));
+        }
+        return numbers;
+    }
+
+    struct FileNameComparator {
+        static int compareElements(const File& a, const File& b) {
+            return a.getFileName().compareNatural(b.getFileName());
+        }
+    };
+
+    String getArgument(const StringArray& args, const String& name)
+    {
+        const int index = args.indexOf(name);
+        return index >= 0 && index + 1 < args.size() ? args[index + 1].unquoted() : String();
+    }
+}
+
+BatchRenderer::BatchRenderer(const Options& o)
+    : options(o)
+    , nextJob(0)
+{
+    if (options.notes.size() == 0) {
+        for (int note = 36; note <= 96; note += 12) {
+            options.notes.add(note);
+        }
+    }
+    if (options.velocities.size() == 0) {
+        options.velocities.add(100);
+    }
+}
+
+bool BatchRenderer::runFromCommandLine(const StringArray& args, String& error)
+{
+    const int index = args.indexOf("--render-batch");
+    if (index < 0) {
+        return false;
+    }
+    if (index + 2 >= args.size()) {
+        error = "usage: --render-batch <patch dir> <output dir> [--notes 36,48,60] [--velocities 64,127] "
+                "[--length <seconds>] [--threads <n>] [--format wav|flac] [--lockstep] [--rate <hz>] [--tail <seconds>] [--bits <16|24>]";
+        return true;
+    }
+
+    const File cwd = File::getCurrentWorkingDirectory();
+    Options o;
+    o.patchDirectory = cwd.getChildFile(args[index + 1].unquoted());
+    o.outputDirectory = cwd.getChildFile(args[index + 2].unquoted());
+    o.notes = parseNumberList(getArgument(args, "--notes"), 0, 127);
+    o.velocities = parseNumberList(getArgument(args, "--velocities"), 1, 127);
+    const String length = getArgument(args, "--length");
+    if (length.isNotEmpty()) {
+        o.noteSeconds = jmax(0.001, length.getDoubleValue());
+    }
+    o.numThreads = jmax(0, getArgument(args, "--threads").getIntValue());
+    const String format = getArgument(args, "--format");
+    if (format.isNotEmpty()) {
+        o.format = format.trimCharactersAtStart(".");
+    }
+    o.lockstep = args.contains("--lockstep");
+    o.render = OfflineRenderer::parseOptions(args);
+
+    BatchRenderer batch(o);
+    error = batch.run();
+    return true;
+}
+
+String BatchRenderer::run()
+{
+    if (!options.patchDirectory.isDirectory()) {
+        return "no directory: " + options.patchDirectory.getFullPathName();
+    }
+    Array<File> patches;
+    options.patchDirectory.findChildFiles(patches, File::findFiles, false, "*.xml");
+    if (patches.size() == 0) {
+        return "no patches in " + options.patchDirectory.getFullPathName();
+    }
+    FileNameComparator comparator;
+    patches.sort(comparator);
+
+    // patch by patch, so a worker mostly keeps the patch it has loaded; in lock-step the velocities of a note in a row
+    jobs.clear();
+    groups.clear();
+    const int numOuter = options.lockstep ? options.notes.size() : options.velocities.size();
+    const int numInner = options.lockstep ? options.velocities.size() : options.notes.size();
+    for (const File& patch : patches) {
+        const String name = File::createLegalFileName(patch.getFileNameWithoutExtension());
+        const File dir = options.outputDirectory.getChildFile(name);
+        for (int outer = 0; outer < numOuter; ++outer) {
+            for (int inner = 0; inner < numInner; ++inner) {
+                Job job;
+                job.patch = patch;
+                job.note = options.notes[options.lockstep ? outer : inner];
+                job.velocity = options.velocities[options.lockstep ? inner : outer];
+                job.output = dir.getChildFile(name + "_" + String(job.note).paddedLeft('0', 3) + "_"
+                                              + MidiMessage::getMidiNoteName(job.note, true, true, 3)
+                                              + "_v" + String(job.velocity) + "." + options.format);
+                const bool newGroup = !options.lockstep || inner % PluginAudioProcessor::maxBatchSize == 0;
+                if (newGroup) {
+                    groups.push_back(std::make_pair(jobs.size(), static_cast<size_t>(0)));
+                }
+                ++groups.back().second;
+                jobs.push_back(job);
+            }
+        }
+        const Result created = dir.createDirectory();
+        if (created.failed()) {
+            return created.getErrorMessage();
+        }
+    }
+
+    const int numThreads = jlimit(1, static_cast<int>(groups.size()), options.numThreads > 0 ? options.numThreads : SystemStats::getNumCpus());
+    OwnedArray<Worker> workers;
+    nextJob = 0;
+    for (int i = 0; i < numThreads; ++i) {
+        workers.add(new Worker(*this))->startThread();
+    }
+    for (Worker* w : workers) {
+        w->waitForThreadToExit(-1);
+    }
+
+    writeManifest();
+
+    StringArray errors;
+    for (const Job& job : jobs) {
+        if (job.error.isNotEmpty()) {
+            errors.add(job.output.getFileName() + ": " + job.error);
+        }
+    }
+    return errors.joinIntoString("\n");
+}
+
+void BatchRenderer::Worker::run()
+{
+    OfflineRenderer renderer(batch.options.render);
+    for (;;) {
+        const int index = batch.nextJob++;
+        if (index >= static_cast<int>(batch.groups.size()) || threadShouldExit()) {
+            return;
+        }
+        const std::pair<size_t, size_t>& group = batch.groups[static_cast<size_t>(index)];
+        render(renderer, group.first, group.second);
+    }
+}
+
+void BatchRenderer::Worker::render(OfflineRenderer& renderer, size_t first, size_t count)
+{
+    // the layers are loaded with the patch, a change of their number loads it again
+    const int numLayers = static_cast<int>(count);
+    const File& patch = batch.jobs[first].patch;
+    if (renderer.getNumLayers() != numLayers) {
+        renderer.setNumLayers(numLayers);
+        loadedPatch = File::nonexistent;
+    }
+    if (patch != loadedPatch) {
+        patchError = renderer.loadPatch(patch);
+        loadedPatch = patch;
+    }
+
+    Array<File> outputs;
+    for (int l = 0; l < numLayers; ++l) {
+        Job& job = batch.jobs[first + static_cast<size_t>(l)];
+        if (patchError.isNotEmpty()) {
+            job.error = patchError;
+            continue;
+        }
+        MidiMessageSequence sequence;
+        sequence.addEvent(MidiMessage::noteOn(1, job.note, static_cast<uint8>(job.velocity)), 0.);
+        sequence.addEvent(MidiMessage::noteOff(1, job.note), batch.options.noteSeconds);
+        if (l == 0) {
+            renderer.setSequence(sequence);
+        } else {
+            renderer.setLayerSequence(l, sequence);
+        }
+        outputs.add(job.output);
+    }
+    if (patchError.isNotEmpty()) {
+        return;
+    }
+
+    const String error = renderer.render(outputs);
+    for (size_t j = first; j < first + count; ++j) {
+        batch.jobs[j].error = error;
+    }
+}
+
+void BatchRenderer::writeManifest() const
+{
+    XmlElement manifest("samplebatch");
+    manifest.setAttribute("version", 1);
+    manifest.setAttribute("samplerate", options.render.sampleRate);
+    manifest.setAttribute("bits", options.render.bitDepth);
+    manifest.setAttribute("length", options.noteSeconds);
+    manifest.setAttribute("tail", options.render.tailSeconds);
+    for (const Job& job : jobs) {
+        if (job.error.isNotEmpty()) {
+            continue;
+        }
+        XmlElement* sample = manifest.createNewChildElement("sample");
+        sample->setAttribute("patch", job.patch.getFileNameWithoutExtension());
+        sample->setAttribute("note", job.note);
+        sample->setAttribute("velocity", job.velocity);
+        sample->setAttribute("file", job.output.getRelativePathFrom(options.outputDirectory));
+    }
+    manifest.writeToFile(options.outputDirectory.getChildFile("manifest.xml"), "");
+}
@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+
+    BatchRenderer.h
+    Created: 15 Oct 2026 7:03:52am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef BATCHRENDERER_H_INCLUDED
+#define BATCHRENDERER_H_INCLUDED
+
+#include "OfflineRenderer.h"
+#include <atomic>
+#include <vector>
+
+//! BatchRenderer: renders every patch of a directory over a grid of notes and velocities
+/*! One sample per patch, note and velocity. Every worker thread owns an OfflineRenderer with
+    its own processor and takes the next sample of the list until all are done, so all cores
+    are busy however the lengths differ. In lock-step mode a job is all velocities of a patch and a
+    note, rendered by the layers of the OfflineRenderer, whose voices share the SIMD lanes; the
+    throughput is higher and every thread holds a processor per velocity. A manifest.xml in the output directory lists the files
+    with patch, note and velocity, for importing them into a sampler.
+*/
+class BatchRenderer {
+public:
+    struct Options {
+        File patchDirectory;
+        File outputDirectory;
+        Array<int> notes;
+        Array<int> velocities;
+        double noteSeconds = 2.;    //!< from note on to note off, the tail of the render options follows
+        int numThreads = 0;         //!< number of cpus if 0
+        String format = "wav";
+        bool lockstep = false;      //!< the velocities of a note in one job, see OfflineRenderer::setNumLayers()
+        OfflineRenderer::Options render;
+    };
+
+    explicit BatchRenderer(const Options& o);
+
+    //! \brief renders all samples and writes the manifest, returns the error messages or an empty string
+    String run();
+
+    //! \brief parses "--render-batch <patch dir> <output dir> [--notes ...]" and renders, false if the arguments are no batch call
+    static bool runFromCommandLine(const StringArray& args, String& error);
+
+private:
+    struct Job {
+        File patch;
+        int note;
+        int velocity;
+        File output;
+        String error;
+    };
+
+    class Worker : public Thread {
+    public:
+        explicit Worker(BatchRenderer& b) : Thread("Batch Render"), batch(b) {}
+        void run() override;
+    private:
+        //! \brief renders a group of jobs with the same patch and note, a layer per job
+        void render(OfflineRenderer& renderer, size_t first, size_t count);
+
+        BatchRenderer& batch;
+        File loadedPatch;
+        String patchError;
+    };
+
+    void writeManifest() const;
+
+    Options options;
+    std::vector<Job> jobs;
+    std::vector<std::pair<size_t, size_t>> groups;  //!< first job and number of jobs rendered together
+    std::atomic<int> nextJob;                       //!< index into groups
+
+    JUCE_DECLARE_NON_COPYABLE(BatchRenderer)
+};
+
+#endif  // BATCHRENDERER_H_INCLUDED
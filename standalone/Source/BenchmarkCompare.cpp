@@ -0,0 +1,89 @@
+/*
+  ==============================================================================
+
+    BenchmarkCompare.cpp
+    Created: 15 Oct 2026 8:02:44am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "BenchmarkCompare.h"
+#include <iostream>
+
+namespace {
+    //! \brief the metric of every case of a benchmark file
+    String readResults(const File& file, HashMap<String, double>& dst, StringArray& order)
+    {
+        const var root = JSON::parse(file);
+        const String metric = root.getProperty("metric", var()).toString();
+        const Array<var>* results = root.getProperty("results", var()).getArray();
+        if (metric.isEmpty() || results == nullptr) {
+            return "no benchmark results: " + file.getFullPathName();
+        }
+        for (const var& r : *results) {
+            const String name = r.getProperty("case", var()).toString();
+            dst.set(name, static_cast<double>(r.getProperty(Identifier(metric), var())));
+            order.add(name);
+        }
+        return String();
+    }
+}
+
+bool BenchmarkCompare::runFromCommandLine(const StringArray& args, String& error)
+{
+    const int index = args.indexOf("--compare-benchmark");
+    if (index < 0) {
+        return false;
+    }
+    if (index + 2 >= args.size()) {
+        error = "usage: --compare-benchmark <baseline.json> <results.json> [--threshold <percent>]";
+        return true;
+    }
+    double threshold = 10.;
+    const int t = args.indexOf("--threshold");
+    if (t >= 0 && t + 1 < args.size()) {
+        threshold = jmax(0., args[t + 1].getDoubleValue());
+    }
+    const File cwd = File::getCurrentWorkingDirectory();
+    error = compare(cwd.getChildFile(args[index + 1].unquoted()), cwd.getChildFile(args[index + 2].unquoted()), threshold);
+    return true;
+}
+
+String BenchmarkCompare::compare(const File& baseline, const File& results, double thresholdPercent)
+{
+    HashMap<String, double> before;
+    HashMap<String, double> after;
+    StringArray baselineOrder;
+    StringArray order;
+    String error = readResults(baseline, before, baselineOrder);
+    if (error.isEmpty()) {
+        error = readResults(results, after, order);
+    }
+    if (error.isNotEmpty()) {
+        return error;
+    }
+
+    StringArray regressions;
+    for (const String& name : order) {
+        if (!before.contains(name)) {
+            std::cout << name << ": new" << std::endl;
+            continue;
+        }
+        const double b = before[name];
+        const double a = after[name];
+        const double change = b > 0. ? (a - b) / b * 100. : 0.;
+        String line = name + ": " + String(b, 2) + " -> " + String(a, 2) + " (" + (change >= 0. ? "+" : "") + String(change, 1) + " %)";
+        if (change > thresholdPercent) {
+            line += " REGRESSION";
+            regressions.add(line);
+        }
+        std::cout << line << std::endl;
+    }
+    for (const String& name : baselineOrder) {
+        if (!after.contains(name)) {
+            std::cout << name << ": missing" << std::endl;
+        }
+    }
+    return regressions.joinIntoString("\n");
+}
@@ -0,0 +1,30 @@
+/*
+  ==============================================================================
+
+    BenchmarkCompare.h
+    Created: 15 Oct 2026 8:02:44am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef BENCHMARKCOMPARE_H_INCLUDED
+#define BENCHMARKCOMPARE_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+//! BenchmarkCompare: compares the json of a benchmark run with a saved baseline
+/*! The results are matched by their "case" string, the value compared is the property the
+    "metric" of the file names. A case that got slower by more than the threshold is a
+    regression, cases only one of the files has are listed but do not fail.
+*/
+class BenchmarkCompare {
+public:
+    //! \brief compares the files and prints a line per case, returns the regressions or an empty string
+    static String compare(const File& baseline, const File& results, double thresholdPercent);
+
+    //! \brief parses "--compare-benchmark <baseline.json> <results.json> [--threshold <percent>]", false if the arguments are no comparison
+    static bool runFromCommandLine(const StringArray& args, String& error);
+};
+
+#endif  // BENCHMARKCOMPARE_H_INCLUDED
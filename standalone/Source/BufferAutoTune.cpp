@@ -0,0 +1,160 @@
+/*
+  ==============================================================================
+
+    BufferAutoTune.cpp
+    Created: 15 Oct 2026 10:38:12am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "BufferAutoTune.h"
+#include "PluginProcessor.h"
+
+namespace {
+    const int lowestNote = 36;
+}
+
+BufferAutoTune::BufferAutoTune(AudioDeviceManager& dm, PluginAudioProcessor& p, MidiMessageCollector& midi)
+    : deviceManager(dm)
+    , processor(p)
+    , collector(midi)
+    , oldPolyphony(0.f)
+    , voiceLimitWasOn(false)
+    , sizeIndex(0)
+    , measuring(false)
+    , lateAtStart(0)
+    , numNotes(0)
+    , result(0)
+{
+}
+
+BufferAutoTune::~BufferAutoTune()
+{
+    cancel();
+}
+
+String BufferAutoTune::start()
+{
+    cancel();
+    AudioIODevice* device = deviceManager.getCurrentAudioDevice();
+    if (device == nullptr) {
+        return "no audio device is open";
+    }
+
+    sizes = device->getAvailableBufferSizes();
+    DefaultElementComparator<int> comparator;
+    sizes.sort(comparator);
+    deviceManager.getAudioDeviceSetup(oldSetup);
+    oldPolyphony = processor.polyphony.get();
+    voiceLimitWasOn = processor.cpuVoiceLimit.getStep() == eOnOffToggle::eOn;
+
+    // every voice plays, none is dropped to save a block
+    processor.polyphony.set(processor.polyphony.getMax());
+    processor.cpuVoiceLimit.setStep(eOnOffToggle::eOff);
+    numNotes = jmin(static_cast<int>(processor.polyphony.getMax()), 128 - lowestNote);
+
+    result = 0;
+    sizeIndex = -1;
+    if (!tryNextSize()) {
+        restore();
+        return "the device accepts none of its buffer sizes";
+    }
+    startTimer(warmUpMs);
+    return String();
+}
+
+void BufferAutoTune::cancel()
+{
+    if (isTimerRunning()) {
+        stopTimer();
+        sendNotes(false);
+        restore();
+        status = "cancelled";
+    }
+}
+
+double BufferAutoTune::getProgress() const
+{
+    return sizes.size() > 0 ? jlimit(0., 1., static_cast<double>(sizeIndex) / sizes.size()) : 0.;
+}
+
+void BufferAutoTune::timerCallback()
+{
+    if (!measuring) {
+        // the blocks of the warm-up and of the device start do not count
+        lateAtStart = countLateBlocks();
+        measuring = true;
+        startTimer(measureMs);
+        return;
+    }
+
+    const uint32 late = countLateBlocks() - lateAtStart;
+    sendNotes(false);
+    if (late == 0) {
+        stopTimer();
+        result = sizes[sizeIndex];
+        AudioIODevice* device = deviceManager.getCurrentAudioDevice();
+        const double rate = device != nullptr ? device->getCurrentSampleRate() : 0.;
+        status = "stable at " + String(result) + " samples"
+            + (rate > 0. ? " (" + String(1000. * result / rate, 1) + " ms)" : String());
+        restore();
+        return;
+    }
+    if (!tryNextSize()) {
+        stopTimer();
+        status = "no buffer size was stable";
+        restore();
+        return;
+    }
+    startTimer(warmUpMs);
+}
+
+bool BufferAutoTune::tryNextSize()
+{
+    for (++sizeIndex; sizeIndex < sizes.size(); ++sizeIndex) {
+        AudioDeviceManager::AudioDeviceSetup setup = oldSetup;
+        setup.bufferSize = sizes[sizeIndex];
+        const String error = deviceManager.setAudioDeviceSetup(setup, false);
+        AudioIODevice* device = deviceManager.getCurrentAudioDevice();
+        if (error.isEmpty() && device != nullptr && device->getCurrentBufferSizeSamples() == sizes[sizeIndex]) {
+            status = "trying " + String(sizes[sizeIndex]) + " samples";
+            measuring = false;
+            sendNotes(true);
+            return true;
+        }
+    }
+    return false;
+}
+
+void BufferAutoTune::sendNotes(bool on)
+{
+    const double now = Time::getMillisecondCounterHiRes() * .001;
+    for (int n = 0; n < numNotes; ++n) {
+        const int note = lowestNote + n;
+        MidiMessage m = on ? MidiMessage::noteOn(1, note, .8f) : MidiMessage::noteOff(1, note);
+        m.setTimeStamp(now);
+        collector.addMessageToQueue(m);
+    }
+}
+
+uint32 BufferAutoTune::countLateBlocks() const
+{
+    const DeadlineMonitor& deadlines = processor.telemetry.deadlines;
+    uint32 late = 0;
+    for (int b = static_cast<int>(maxLoad * 100.f) / DeadlineMonitor::binPercent; b < DeadlineMonitor::numBins; ++b) {
+        late += deadlines.getBinCount(b);
+    }
+    return late;
+}
+
+void BufferAutoTune::restore()
+{
+    AudioDeviceManager::AudioDeviceSetup setup = oldSetup;
+    if (result > 0) {
+        setup.bufferSize = result;
+    }
+    deviceManager.setAudioDeviceSetup(setup, true);
+    processor.polyphony.set(oldPolyphony);
+    processor.cpuVoiceLimit.setStep(voiceLimitWasOn ? eOnOffToggle::eOn : eOnOffToggle::eOff);
+}
@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    BufferAutoTune.h
+    Created: 15 Oct 2026 10:38:12am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef BUFFERAUTOTUNE_H_INCLUDED
+#define BUFFERAUTOTUNE_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+class PluginAudioProcessor;
+
+//! BufferAutoTune: finds the smallest buffer size at which the device plays full polyphony without late blocks
+/*! The buffer sizes of the device are tried from the smallest one up. For each the processor
+    plays as many held notes of the current patch as the polyphony allows, with the polyphony at
+    its maximum and the cpu voice limit off, so no voice is dropped to save the block. After a
+    warm-up the render time of every block is taken from the histogram of the deadline monitor,
+    a size is stable if no block used more than maxLoad of its duration. The first stable size is
+    kept, the polyphony, the voice limit and, without a result, the old buffer size are restored.
+*/
+class BufferAutoTune : private Timer {
+public:
+    BufferAutoTune(AudioDeviceManager& dm, PluginAudioProcessor& p, MidiMessageCollector& midi);
+    ~BufferAutoTune();
+
+    //! \brief starts with the smallest buffer size, returns an error message or an empty string
+    String start();
+    //! \brief notes off and back to the settings before start(), the result stays
+    void cancel();
+
+    bool isRunning() const { return isTimerRunning(); }
+    //! \brief fraction of the sizes tried
+    double getProgress() const;
+    //! \brief which size is tried, or the result
+    String getStatus() const { return status; }
+    //! \brief smallest stable buffer size, 0 while running or if no size was stable
+    int getResult() const { return result; }
+
+    constexpr static float maxLoad = .7f;       //!< of the block duration, leaves room for the driver and the ui
+    static const int warmUpMs = 500;
+    static const int measureMs = 3000;
+
+private:
+    //! next phase of the size being tried
+    void timerCallback() override;
+    //! \brief opens the device with the next size, false after the last one
+    bool tryNextSize();
+    void sendNotes(bool on);
+    //! \brief blocks in the histogram above maxLoad
+    uint32 countLateBlocks() const;
+    void restore();
+
+    AudioDeviceManager& deviceManager;
+    PluginAudioProcessor& processor;
+    MidiMessageCollector& collector;
+
+    AudioDeviceManager::AudioDeviceSetup oldSetup;
+    float oldPolyphony;
+    bool voiceLimitWasOn;
+    Array<int> sizes;
+    int sizeIndex;
+    bool measuring;             //!< false during the warm-up
+    uint32 lateAtStart;
+    int numNotes;
+    String status;
+    int result;
+
+    JUCE_DECLARE_NON_COPYABLE(BufferAutoTune)
+};
+
+#endif  // BUFFERAUTOTUNE_H_INCLUDED
@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    CostCalibration.cpp
+    Created: 15 Oct 2026 10:31:07pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "CostCalibration.h"
+#include "VoiceBenchmark.h"
+#include "FxBenchmark.h"
+#include <iostream>
+
+bool CostCalibration::runFromCommandLine(const StringArray& args, String& error)
+{
+    if (!args.contains("--calibrate-costs")) {
+        return false;
+    }
+    double secondsPerCase = 0.2;
+    const int seconds = args.indexOf("--seconds");
+    if (seconds >= 0 && seconds + 1 < args.size()) {
+        secondsPerCase = jmax(0.01, args[seconds + 1].getDoubleValue());
+    }
+    error = run(secondsPerCase);
+    return true;
+}
+
+String CostCalibration::run(double secondsPerCase)
+{
+    VoiceBenchmark::Options o;
+    o.secondsPerCase = secondsPerCase;
+    VoiceBenchmark voices(o);
+
+    // a voice with one saw and nothing else, every part is measured on top of it
+    VoiceBenchmark::Case base;
+    base.blockSize = PatchCostEstimate::liveBlockSize;
+    base.sampleRate = 48000.;
+    base.modRows = 0;
+    base.filterActive = false;
+    const VoiceBenchmark::Result baseResult = voices.runCase(base);
+    if (baseResult.activeVoices == 0) {
+        return "the voices of the calibration do not play";
+    }
+    const double saw = baseResult.nsPerSampleVoice;
+    const auto costOf = [&](const VoiceBenchmark::Case& c) { return jmax(0., voices.runCase(c).nsPerSampleVoice - saw); };
+
+    KernelCosts costs;
+    costs.voice = baseResult.modulationNsPerSampleVoice;
+    costs.wave[static_cast<size_t>(eOscWaves::eOscSaw)] = jmax(0., saw - costs.voice);
+    for (eOscWaves w : { eOscWaves::eOscSquare, eOscWaves::eOscNoise, eOscWaves::eOscWavetable }) {
+        VoiceBenchmark::Case c = base;
+        c.wave = w;
+        costs.wave[static_cast<size_t>(w)] = jmax(0., voices.runCase(c).nsPerSampleVoice - costs.voice);
+    }
+    {
+        VoiceBenchmark::Case c = base;
+        c.unisonVoices = 8;
+        costs.unisonCopy = costOf(c) / 7.;
+    }
+    for (eBiquadFilters f : { eBiquadFilters::eLowpass, eBiquadFilters::eHighpass, eBiquadFilters::eBandpass, eBiquadFilters::eLadder }) {
+        VoiceBenchmark::Case c = base;
+        c.filterActive = true;
+        c.filter = f;
+        costs.biquad[static_cast<size_t>(f)] = costOf(c);
+    }
+    {
+        VoiceBenchmark::Case c = base;
+        c.filterActive = true;
+        c.topology = eFilterTopology::eSvf;
+        costs.svf = costOf(c);
+    }
+    {
+        VoiceBenchmark::Case c = base;
+        c.modRows = VoiceBenchmark::maxModRows;
+        costs.modRow = costOf(c) / VoiceBenchmark::maxModRows;
+    }
+
+    FxBenchmark::Options fo;
+    fo.secondsPerCase = secondsPerCase;
+    FxBenchmark effects(fo);
+    for (int t = 0; t < static_cast<int>(eFxType::nSteps); ++t) {
+        costs.fx[static_cast<size_t>(t)] = effects.measureDefault(static_cast<eFxType>(t), 2, PatchCostEstimate::liveBlockSize);
+    }
+
+    costs.measuredOn = Time::getCurrentTime().toString(true, true, false);
+    const var json = costs.toJson();
+    std::cout << JSON::toString(json) << std::endl;
+    if (!costs.save()) {
+        return "cannot write " + KernelCosts::getFile().getFullPathName();
+    }
+    std::cout << "written to " << KernelCosts::getFile().getFullPathName() << std::endl;
+    return String();
+}
@@ -0,0 +1,33 @@
+/*
+  ==============================================================================
+
+    CostCalibration.h
+    Created: 15 Oct 2026 10:31:07pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef COSTCALIBRATION_H_INCLUDED
+#define COSTCALIBRATION_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "PatchCost.h"
+
+//! CostCalibration: measures the KernelCosts of this machine for the patch cost estimate of the editor
+/*! The parts of a voice are rendered one at a time with the cases of the VoiceBenchmark at 64
+    samples and 48 kHz: the cost of a part is the difference to the case without it, a voice
+    with one saw and no filter is the base. The effects are the first variant of each in the
+    FxBenchmark. The result goes to KernelCosts::getFile(), where every instance reads it.
+    The sample oscillator keeps its default, it needs a sample to be measured.
+*/
+class CostCalibration {
+public:
+    //! \brief parses "--calibrate-costs [--seconds <s>]", measures and writes the file, false if the arguments are no calibration
+    static bool runFromCommandLine(const StringArray& args, String& error);
+
+    //! \brief measures all kernels, prints them and writes the file, returns an error message or an empty string
+    static String run(double secondsPerCase);
+};
+
+#endif  // COSTCALIBRATION_H_INCLUDED
@@ -0,0 +1,279 @@
+/*
+  ==============================================================================
+
+    FxBenchmark.cpp
+    Created: 15 Oct 2026 8:02:44am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "FxBenchmark.h"
+#include "FxDelay.h"
+#include "FxChorus.h"
+#include "LowFidelity.h"
+#include "FxClipping.h"
+#include "FxReverb.h"
+#include "FxWaveshaper.h"
+#include "SimdKernels.h"
+#include <iostream>
+
+AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+namespace {
+    const int warmUpBlocks = 16;
+    const int maxChannels = 2;
+    const int maxBlockSize = 2048;
+}
+
+FxBenchmark::FxBenchmark(const Options& o)
+    : options(o)
+    , noise(maxChannels, maxBlockSize)
+{
+    if (options.channelCounts.size() == 0) {
+        options.channelCounts.add(1);
+        options.channelCounts.add(2);
+    }
+    if (options.blockSizes.size() == 0) {
+        const int blockSizes[] = { 32, 128, 512, 2048 };
+        options.blockSizes.addArray(blockSizes, 4);
+    }
+
+    processor = dynamic_cast<PluginAudioProcessor*>(createPluginFilter());
+    if (processor != nullptr) {
+        delay = new FxDelay(*processor);
+        chorus = new FxChorus(*processor);
+        lowFi = new LowFidelity(*processor);
+        clipping = new FxClipping(*processor);
+        reverb = new FxReverb(*processor);
+        shaper = new FxWaveshaper(*processor);
+    }
+
+    // the same noise for every run, at -6 dB
+    Random random(1);
+    for (int c = 0; c < maxChannels; ++c) {
+        float* samples = noise.getWritePointer(c);
+        for (int s = 0; s < maxBlockSize; ++s) {
+            samples[s] = (random.nextFloat() * 2.f - 1.f) * 0.5f;
+        }
+    }
+}
+
+FxBenchmark::~FxBenchmark()
+{
+    // the effects refer to the params of the processor
+    delay = nullptr;
+    chorus = nullptr;
+    lowFi = nullptr;
+    clipping = nullptr;
+    reverb = nullptr;
+    shaper = nullptr;
+    processor = nullptr;
+}
+
+bool FxBenchmark::runFromCommandLine(const StringArray& args, String& error)
+{
+    if (!args.contains("--benchmark-fx")) {
+        return false;
+    }
+    Options o;
+    const int json = args.indexOf("--json");
+    if (json >= 0 && json + 1 < args.size()) {
+        o.json = File::getCurrentWorkingDirectory().getChildFile(args[json + 1].unquoted());
+    }
+    const int seconds = args.indexOf("--seconds");
+    if (seconds >= 0 && seconds + 1 < args.size()) {
+        o.secondsPerCase = jmax(0.01, args[seconds + 1].getDoubleValue());
+    }
+
+    FxBenchmark benchmark(o);
+    error = benchmark.run();
+    return true;
+}
+
+void FxBenchmark::resetParams()
+{
+    SynthParams& p = *processor;
+    p.delayActivation.setStep(eOnOffToggle::eOff);
+    p.chorActivation.setStep(eOnOffToggle::eOff);
+    p.lowFiActivation.setStep(eOnOffToggle::eOff);
+    p.clippingActivation.setStep(eOnOffToggle::eOff);
+    p.reverbActivation.setStep(eOnOffToggle::eOff);
+    p.shaperActivation.setStep(eOnOffToggle::eOff);
+    p.shaperOversampling.setStep(eOnOffToggle::eOff);
+    Param* const defaults[] = {
+        &p.delayFeedback, &p.delayDryWet, &p.delayTime, &p.delayCutoff, &p.delayResonance,
+        &p.chorDelayLength, &p.chorDryWet, &p.chorModRate, &p.chorModDepth,
+        &p.nBitsLowFi, &p.lowFiDownsample, &p.clippingFactor,
+        &p.reverbSize, &p.reverbDecay, &p.reverbDamping, &p.reverbDryWet, &p.shaperDrive,
+    };
+    for (Param* param : defaults) {
+        param->set(param->getDefault());
+    }
+    p.delaySync.setStep(eOnOffToggle::eOff);
+    p.delayReverse.setStep(eOnOffToggle::eOff);
+    p.delayPingPong.setStep(eOnOffToggle::eOff);
+    p.delayRecordFilter.setStep(eOnOffToggle::eOff);
+    p.clippingMode.setStep(eClippingMode::eHard);
+}
+
+void FxBenchmark::collectVariants(Array<Variant>& variants)
+{
+    const auto delayWith = [](float ms, bool reverse, bool record) {
+        return [=](SynthParams& p) {
+            p.delayActivation.setStep(eOnOffToggle::eOn);
+            p.delayTime.set(ms);
+            p.delayFeedback.set(0.6f);
+            p.delayDryWet.set(0.5f);
+            p.delayReverse.setStep(reverse ? eOnOffToggle::eOn : eOnOffToggle::eOff);
+            p.delayRecordFilter.setStep(record ? eOnOffToggle::eOn : eOnOffToggle::eOff);
+        };
+    };
+    variants.add({ "delay 10 ms", delay, delayWith(10.f, false, false), nullptr });
+    variants.add({ "delay 250 ms", delay, delayWith(250.f, false, false), nullptr });
+    variants.add({ "delay 2000 ms", delay, delayWith(2000.f, false, false), nullptr });
+    variants.add({ "delay reverse", delay, delayWith(250.f, true, false), nullptr });
+    variants.add({ "delay record filter", delay, delayWith(250.f, false, true), nullptr });
+    variants.add({ "delay ping-pong", delay, [=](SynthParams& p) {
+        delayWith(250.f, false, false)(p);
+        p.delayPingPong.setStep(eOnOffToggle::eOn);
+    }, nullptr });
+    // a new time every block, every block crossfades
+    variants.add({ "delay time sweep", delay, delayWith(250.f, false, false), [](SynthParams& p, int64 block) {
+        p.delayTime.set(50.f + static_cast<float>(block % 64) * 15.f);
+    } });
+
+    variants.add({ "chorus", chorus, [](SynthParams& p) {
+        p.chorActivation.setStep(eOnOffToggle::eOn);
+        p.chorDryWet.set(0.5f);
+    }, nullptr });
+
+    variants.add({ "lofi 8 bit", lowFi, [](SynthParams& p) {
+        p.lowFiActivation.setStep(eOnOffToggle::eOn);
+        p.nBitsLowFi.set(8.f);
+    }, nullptr });
+    variants.add({ "lofi 8 bit downsample 4", lowFi, [](SynthParams& p) {
+        p.lowFiActivation.setStep(eOnOffToggle::eOn);
+        p.nBitsLowFi.set(8.f);
+        p.lowFiDownsample.set(4.f);
+    }, nullptr });
+
+    const char* const clipNames[] = { "clipping hard", "clipping tanh", "clipping cubic" };
+    for (int m = 0; m < static_cast<int>(eClippingMode::nSteps); ++m) {
+        variants.add({ clipNames[m], clipping, [m](SynthParams& p) {
+            p.clippingActivation.setStep(eOnOffToggle::eOn);
+            p.clippingMode.setStep(static_cast<eClippingMode>(m));
+            p.clippingFactor.setUI(12.f, false);
+        }, nullptr });
+    }
+
+    variants.add({ "reverb", reverb, [](SynthParams& p) {
+        p.reverbActivation.setStep(eOnOffToggle::eOn);
+        p.reverbDryWet.set(0.3f);
+    }, nullptr });
+
+    const char* const shaperNames[] = { "waveshaper tanh", "waveshaper asymmetric", "waveshaper foldback" };
+    for (int c = 0; c < static_cast<int>(eShaperCurve::nSteps); ++c) {
+        variants.add({ shaperNames[c], shaper, [c](SynthParams& p) {
+            p.shaperActivation.setStep(eOnOffToggle::eOn);
+            p.shaperCurve.setStep(static_cast<eShaperCurve>(c));
+        }, nullptr });
+    }
+    variants.add({ "waveshaper tanh 2x", shaper, [](SynthParams& p) {
+        p.shaperActivation.setStep(eOnOffToggle::eOn);
+        p.shaperOversampling.setStep(eOnOffToggle::eOn);
+    }, nullptr });
+}
+
+double FxBenchmark::measure(const Variant& v, int numChannels, int blockSize)
+{
+    const ScopedFlushToZero flushToZero;
+    SynthParams& p = *processor;
+    resetParams();
+    v.setup(p);
+    v.fx->prepare(numChannels, options.sampleRate);
+    v.fx->reset();
+
+    AudioSampleBuffer buffer(numChannels, blockSize);
+    const int64 budget = Time::secondsToHighResolutionTicks(options.secondsPerCase);
+    int64 elapsed = 0;
+    int64 blocks = 0;
+    for (int64 b = -warmUpBlocks; elapsed < budget; ++b) {
+        if (v.perBlock) {
+            v.perBlock(p, b);
+        }
+        p.updateSnapshot(eQualityTier::eRealtime);
+        p.compileRenderPlan();
+        for (int c = 0; c < numChannels; ++c) {
+            buffer.copyFrom(c, 0, noise, c, 0, blockSize);
+        }
+
+        const int64 start = Time::getHighResolutionTicks();
+        v.fx->process(buffer, 0, blockSize);
+        if (b >= 0) {
+            elapsed += Time::getHighResolutionTicks() - start;
+            ++blocks;
+        }
+    }
+    return Time::highResolutionTicksToSeconds(elapsed) * 1.e9 / (static_cast<double>(blocks) * blockSize * numChannels);
+}
+
+double FxBenchmark::measureDefault(eFxType type, int numChannels, int blockSize)
+{
+    if (processor == nullptr) {
+        return 0.;
+    }
+    const FxSlot* const slots[] = { lowFi, clipping, delay, chorus, reverb, shaper };
+    Array<Variant> variants;
+    collectVariants(variants);
+    for (const Variant& v : variants) {
+        if (v.fx == slots[static_cast<int>(type)]) {
+            return measure(v, numChannels, jmin(blockSize, maxBlockSize));
+        }
+    }
+    return 0.;
+}
+
+String FxBenchmark::run()
+{
+    if (processor == nullptr) {
+        return "the processor could not be created";
+    }
+
+    Array<Variant> variants;
+    collectVariants(variants);
+
+    Array<var> results;
+    std::cout << "case                           channels  block  ns/sample/channel" << std::endl;
+    for (const Variant& v : variants) {
+        for (int numChannels : options.channelCounts) {
+            for (int blockSize : options.blockSizes) {
+                const double ns = measure(v, numChannels, jmin(blockSize, maxBlockSize));
+                std::cout << v.name.paddedRight(' ', 30) << " " << String(numChannels).paddedLeft(' ', 8) << " "
+                          << String(blockSize).paddedLeft(' ', 6) << " " << String(ns, 2).paddedLeft(' ', 18) << std::endl;
+
+                DynamicObject::Ptr r = new DynamicObject();
+                r->setProperty("case", v.name + " / " + String(numChannels) + " ch / " + String(blockSize));
+                r->setProperty("fx", v.name);
+                r->setProperty("channels", numChannels);
+                r->setProperty("blockSize", blockSize);
+                r->setProperty("nsPerSampleChannel", ns);
+                results.add(var(r.get()));
+            }
+        }
+    }
+
+    if (options.json != File::nonexistent) {
+        DynamicObject::Ptr root = new DynamicObject();
+        root->setProperty("cpu", SystemStats::getCpuVendor());
+        root->setProperty("cpuMHz", SystemStats::getCpuSpeedInMegaherz());
+        root->setProperty("simd", SimdKernels::get().name);
+        root->setProperty("sampleRate", options.sampleRate);
+        root->setProperty("metric", "nsPerSampleChannel");
+        root->setProperty("results", results);
+        if (!options.json.replaceWithText(JSON::toString(var(root.get())))) {
+            return "cannot write " + options.json.getFullPathName();
+        }
+    }
+    return String();
+}
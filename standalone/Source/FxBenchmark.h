@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    FxBenchmark.h
+    Created: 15 Oct 2026 8:02:44am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef FXBENCHMARK_H_INCLUDED
+#define FXBENCHMARK_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "PluginProcessor.h"
+#include <functional>
+
+//! FxBenchmark: times FxSlot::process of every effect over its variants, channel counts and block sizes
+/*! Each effect is an instance of its own on the params of a processor that is never prepared.
+    A variant sets the params of the effect, the input is noise copied into the block before
+    every call, only the process() call is timed. The delay also runs with a delay time that
+    moves every block, the case of an automated or modulated time.
+*/
+class FxBenchmark {
+public:
+    struct Options {
+        Array<int> channelCounts;
+        Array<int> blockSizes;
+        double sampleRate = 48000.;
+        double secondsPerCase = 0.1;
+        File json;                      //!< the results as json, none if it does not exist
+    };
+
+    explicit FxBenchmark(const Options& o);
+    ~FxBenchmark();
+
+    //! \brief runs all cases, prints a line per case and writes the json, returns an error message or an empty string
+    String run();
+
+    //! \brief parses "--benchmark-fx [--json <file>] [--seconds <s>]" and runs, false if the arguments are no fx benchmark
+    static bool runFromCommandLine(const StringArray& args, String& error);
+
+    //! \brief ns per sample and channel of the first variant of the effect, see CostCalibration
+    double measureDefault(eFxType type, int numChannels, int blockSize);
+
+private:
+    typedef std::function<void(SynthParams&)> tSetup;
+    typedef std::function<void(SynthParams&, int64)> tPerBlock;
+
+    struct Variant {
+        String name;
+        FxSlot* fx;
+        tSetup setup;
+        tPerBlock perBlock;     //!< param changes before a block, may be empty
+    };
+
+    //! \brief ns per sample and channel of the variant
+    double measure(const Variant& v, int numChannels, int blockSize);
+    void collectVariants(Array<Variant>& variants);
+    //! \brief every effect off, every param at its default
+    void resetParams();
+
+    Options options;
+    ScopedPointer<PluginAudioProcessor> processor;   //!< params of the effects
+    ScopedPointer<FxSlot> delay;
+    ScopedPointer<FxSlot> chorus;
+    ScopedPointer<FxSlot> lowFi;
+    ScopedPointer<FxSlot> clipping;
+    ScopedPointer<FxSlot> reverb;
+    ScopedPointer<FxSlot> shaper;
+    AudioSampleBuffer noise;
+
+    JUCE_DECLARE_NON_COPYABLE(FxBenchmark)
+};
+
+#endif  // FXBENCHMARK_H_INCLUDED
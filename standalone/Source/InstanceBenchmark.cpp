@@ -0,0 +1,164 @@
+/*
+  ==============================================================================
+
+    InstanceBenchmark.cpp
+    Created: 17 Oct 2026 3:02:18pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "InstanceBenchmark.h"
+#include "RealtimeCheck.h"
+#include "SimdKernels.h"
+#include <iostream>
+#include <limits>
+
+AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+InstanceBenchmark::InstanceBenchmark(const Options& o)
+    : options(o)
+{
+    if (options.sampleRates.size() == 0) {
+        const double sampleRates[] = { 44100., 48000., 96000. };
+        options.sampleRates.addArray(sampleRates, 3);
+    }
+    if (options.blockSizes.size() == 0) {
+        const int blockSizes[] = { 64, 512, 2048 };
+        options.blockSizes.addArray(blockSizes, 3);
+    }
+}
+
+bool InstanceBenchmark::runFromCommandLine(const StringArray& args, String& error)
+{
+    if (!args.contains("--benchmark-instance")) {
+        return false;
+    }
+    Options o;
+    const int json = args.indexOf("--json");
+    if (json >= 0 && json + 1 < args.size()) {
+        o.json = File::getCurrentWorkingDirectory().getChildFile(args[json + 1].unquoted());
+    }
+    const int iterations = args.indexOf("--iterations");
+    if (iterations >= 0 && iterations + 1 < args.size()) {
+        o.iterations = jmax(1, args[iterations + 1].getIntValue());
+    }
+
+    InstanceBenchmark benchmark(o);
+    error = benchmark.run();
+    return true;
+}
+
+InstanceBenchmark::Result InstanceBenchmark::measure(const String& name, const tStep& prepare, const tStep& step) const
+{
+    double total = 0.;
+    double fastest = std::numeric_limits<double>::max();
+    int64 allocations = 0;
+    for (int i = 0; i < options.iterations; ++i) {
+        if (prepare) {
+            prepare();
+        }
+        const int64 allocationsBefore = RealtimeCheck::getAllocationCount();
+        const int64 begin = Time::getHighResolutionTicks();
+        step();
+        const double ms = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - begin) * 1.e3;
+        allocations += RealtimeCheck::getAllocationCount() - allocationsBefore;
+        total += ms;
+        fastest = jmin(fastest, ms);
+    }
+
+    Result r;
+    r.name = name;
+    r.meanMs = total / options.iterations;
+    r.minMs = fastest;
+    r.allocations = RealtimeCheck::getAllocationCount() < 0 ? -1. : static_cast<double>(allocations) / options.iterations;
+    return r;
+}
+
+String InstanceBenchmark::run()
+{
+    ScopedPointer<PluginAudioProcessor> processor(dynamic_cast<PluginAudioProcessor*>(createPluginFilter()));
+    if (processor == nullptr) {
+        return "the processor could not be created";
+    }
+
+    // the state of every factory program, a pending program is applied by getStateInformation()
+    Array<MemoryBlock> chunks;
+    for (int program = 0; program < processor->getNumPrograms(); ++program) {
+        processor->setCurrentProgram(program);
+        MemoryBlock chunk;
+        processor->getStateInformation(chunk);
+        chunks.add(chunk);
+    }
+    processor = nullptr;
+
+    Array<Result> results;
+    results.add(measure("construct", [&] { processor = nullptr; }, [&] {
+        processor = dynamic_cast<PluginAudioProcessor*>(createPluginFilter());
+    }));
+    results.add(measure("destroy", [&] {
+        processor = dynamic_cast<PluginAudioProcessor*>(createPluginFilter());
+    }, [&] { processor = nullptr; }));
+
+    processor = dynamic_cast<PluginAudioProcessor*>(createPluginFilter());
+    PluginAudioProcessor& p = *processor;
+    for (double sampleRate : options.sampleRates) {
+        for (int blockSize : options.blockSizes) {
+            // a host prepares again after a change of the device, the buffers of the last one are released first
+            results.add(measure("prepare " + String(roundToInt(sampleRate)) + " / " + String(blockSize), [&] {
+                p.releaseResources();
+                p.setPlayConfigDetails(0, 2, sampleRate, blockSize);
+            }, [&] { p.prepareToPlay(sampleRate, blockSize); }));
+        }
+    }
+    p.releaseResources();
+
+    for (int program = 0; program < chunks.size(); ++program) {
+        const MemoryBlock& chunk = chunks.getReference(program);
+        results.add(measure("state " + p.getProgramName(program), tStep(), [&] {
+            p.setStateInformation(chunk.getData(), static_cast<int>(chunk.getSize()));
+        }));
+    }
+
+    ScopedPointer<AudioProcessorEditor> editor;
+    results.add(measure("editor open", [&] { editor = nullptr; }, [&] { editor = p.createEditor(); }));
+    results.add(measure("editor close", [&] {
+        if (editor == nullptr) {
+            editor = p.createEditor();
+        }
+    }, [&] { editor = nullptr; }));
+    processor = nullptr;
+
+    Array<var> json;
+    std::cout << "case                          mean ms    min ms  allocations" << std::endl;
+    for (const Result& r : results) {
+        std::cout << r.name.paddedRight(' ', 28) << " " << String(r.meanMs, 3).paddedLeft(' ', 8) << " "
+                  << String(r.minMs, 3).paddedLeft(' ', 9) << " "
+                  << (r.allocations < 0. ? String("-") : String(r.allocations, 0)).paddedLeft(' ', 12) << std::endl;
+        json.add(toJson(r));
+    }
+
+    if (options.json != File::nonexistent) {
+        DynamicObject::Ptr root = new DynamicObject();
+        root->setProperty("cpu", SystemStats::getCpuVendor());
+        root->setProperty("cpuMHz", SystemStats::getCpuSpeedInMegaherz());
+        root->setProperty("simd", SimdKernels::get().name);
+        root->setProperty("iterations", options.iterations);
+        root->setProperty("metric", "meanMs");
+        root->setProperty("results", json);
+        if (!options.json.replaceWithText(JSON::toString(var(root.get())))) {
+            return "cannot write " + options.json.getFullPathName();
+        }
+    }
+    return String();
+}
+
+var InstanceBenchmark::toJson(const Result& r)
+{
+    DynamicObject::Ptr o = new DynamicObject();
+    o->setProperty("case", r.name);
+    o->setProperty("meanMs", r.meanMs);
+    o->setProperty("minMs", r.minMs);
+    o->setProperty("allocations", r.allocations);
+    return var(o.get());
+}
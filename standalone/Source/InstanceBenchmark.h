@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+
+    InstanceBenchmark.h
+    Created: 17 Oct 2026 3:02:18pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef INSTANCEBENCHMARK_H_INCLUDED
+#define INSTANCEBENCHMARK_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "PluginProcessor.h"
+#include <functional>
+
+//! InstanceBenchmark: what a host pays to load a session, per instance
+/*! Times the construction and destruction of the processor, prepareToPlay() at every rate and
+    block size, setStateInformation() with the chunk of every factory program and opening and
+    closing the editor, each over many iterations on the message thread. The chunks are written
+    beforehand by a processor of their own. A build with SYNISTER_REALTIME_CHECKS=1 also counts
+    the allocations of every thread during a case, see RealtimeCheck::getAllocationCount(); its
+    times are a little slower, the other builds report no allocations.
+*/
+class InstanceBenchmark {
+public:
+    struct Options {
+        Array<double> sampleRates;
+        Array<int> blockSizes;
+        int iterations = 20;            //!< of every case
+        File json;                      //!< the results as json, none if it does not exist
+    };
+
+    struct Result {
+        String name;
+        double meanMs;
+        double minMs;
+        double allocations;             //!< per iteration, -1 if the build does not count them
+    };
+
+    explicit InstanceBenchmark(const Options& o);
+
+    //! \brief runs all cases, prints a line per case and writes the json, returns an error message or an empty string
+    String run();
+
+    //! \brief parses "--benchmark-instance [--json <file>] [--iterations <n>]" and runs, false if the arguments are no instance benchmark
+    static bool runFromCommandLine(const StringArray& args, String& error);
+
+private:
+    typedef std::function<void()> tStep;
+
+    //! \brief times the step of every iteration, prepare runs before it untimed, may be empty
+    Result measure(const String& name, const tStep& prepare, const tStep& step) const;
+    static var toJson(const Result& r);
+
+    Options options;
+
+    JUCE_DECLARE_NON_COPYABLE(InstanceBenchmark)
+};
+
+#endif  // INSTANCEBENCHMARK_H_INCLUDED
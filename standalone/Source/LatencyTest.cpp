@@ -0,0 +1,154 @@
+/*
+  ==============================================================================
+
+    LatencyTest.cpp
+    Created: 15 Oct 2026 10:21:53am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "LatencyTest.h"
+
+LatencyTest::LatencyTest(AudioDeviceManager& dm)
+    : deviceManager(dm)
+    , callback(nullptr)
+    , burst(1, burstLength)
+    , recorded(0)
+    , played(0)
+    , burstStart(0)
+    , reportedLatency(0)
+{
+    // the same noise every time, the level leaves room for a hot loopback
+    Random random(0x51a7);
+    float* b = burst.getWritePointer(0);
+    for (int s = 0; s < burstLength; ++s) {
+        b[s] = .25f * (2.f * random.nextFloat() - 1.f);
+    }
+}
+
+LatencyTest::~LatencyTest()
+{
+    if (callback != nullptr) {
+        finish();
+    }
+}
+
+String LatencyTest::start(AudioIODeviceCallback& replaced)
+{
+    AudioIODevice* device = deviceManager.getCurrentAudioDevice();
+    if (device == nullptr) {
+        return "no audio device is open";
+    }
+    if (device->getInputChannelNames().size() == 0) {
+        return "the device has no input for the loopback";
+    }
+
+    deviceManager.getAudioDeviceSetup(oldSetup);
+    AudioDeviceManager::AudioDeviceSetup setup = oldSetup;
+    setup.useDefaultInputChannels = false;
+    setup.inputChannels.clear();
+    setup.inputChannels.setBit(0);
+
+    deviceManager.removeAudioCallback(&replaced);
+    callback = &replaced;
+    const String error = deviceManager.setAudioDeviceSetup(setup, true);
+    device = deviceManager.getCurrentAudioDevice();
+    if (error.isNotEmpty() || device == nullptr) {
+        finish();
+        return error.isNotEmpty() ? error : String("the device could not be opened with an input");
+    }
+
+    reportedLatency = device->getInputLatencyInSamples() + device->getOutputLatencyInSamples();
+    const double rate = device->getCurrentSampleRate();
+    recording.setSize(1, static_cast<int>(rate * recordSeconds));
+    recording.clear();
+    burstStart = static_cast<int>(rate * leadSeconds);
+    deviceManager.addAudioCallback(this);
+    return String();
+}
+
+int LatencyTest::finish()
+{
+    if (callback == nullptr) {
+        return -1;
+    }
+    deviceManager.removeAudioCallback(this);
+    deviceManager.setAudioDeviceSetup(oldSetup, true);
+    deviceManager.addAudioCallback(callback);
+    callback = nullptr;
+
+    const int lag = isDone() ? findBurst() : -1;
+    return lag >= burstStart ? lag - burstStart : -1;
+}
+
+void LatencyTest::audioDeviceAboutToStart(AudioIODevice*)
+{
+    recorded.store(0);
+    played = 0;
+}
+
+void LatencyTest::audioDeviceIOCallback(const float** inputChannelData, int numInputChannels,
+                                        float** outputChannelData, int numOutputChannels, int numSamples)
+{
+    // the burst where the block overlaps it, silence elsewhere
+    const int from = jlimit(0, numSamples, burstStart - played);
+    const int to = jlimit(0, numSamples, burstStart + burstLength - played);
+    for (int c = 0; c < numOutputChannels; ++c) {
+        if (outputChannelData[c] == nullptr) {
+            continue;
+        }
+        FloatVectorOperations::clear(outputChannelData[c], numSamples);
+        if (to > from) {
+            FloatVectorOperations::copy(outputChannelData[c] + from, burst.getReadPointer(0, played + from - burstStart), to - from);
+        }
+    }
+    played += numSamples;
+
+    const int done = recorded.load(std::memory_order_relaxed);
+    const int n = jmin(numSamples, recording.getNumSamples() - done);
+    if (n > 0) {
+        if (numInputChannels > 0 && inputChannelData[0] != nullptr) {
+            recording.copyFrom(0, done, inputChannelData[0], n);
+        }
+        recorded.store(done + n, std::memory_order_release);
+    }
+}
+
+int LatencyTest::findBurst() const
+{
+    const float* b = burst.getReadPointer(0);
+    const float* r = recording.getReadPointer(0);
+    const int numLags = recording.getNumSamples() - burstLength;
+    if (numLags <= burstStart) {
+        return -1;
+    }
+
+    double burstEnergy = 0.;
+    for (int s = 0; s < burstLength; ++s) {
+        burstEnergy += b[s] * b[s];
+    }
+    // the energy of the window at the lag, moved along sample by sample
+    double windowEnergy = 0.;
+    for (int s = 0; s < burstLength; ++s) {
+        windowEnergy += r[burstStart + s] * r[burstStart + s];
+    }
+
+    int bestLag = -1;
+    double best = 0.;
+    for (int lag = burstStart; lag < numLags; ++lag) {
+        double correlation = 0.;
+        for (int s = 0; s < burstLength; ++s) {
+            correlation += b[s] * r[lag + s];
+        }
+        // an inverting loopback counts as well
+        const double normalised = windowEnergy > 0. ? std::abs(correlation) / std::sqrt(burstEnergy * windowEnergy) : 0.;
+        if (normalised > best) {
+            best = normalised;
+            bestLag = lag;
+        }
+        windowEnergy += r[lag + burstLength] * r[lag + burstLength] - r[lag] * r[lag];
+        windowEnergy = jmax(0., windowEnergy);
+    }
+    return best >= minCorrelation ? bestLag : -1;
+}
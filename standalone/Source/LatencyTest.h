@@ -0,0 +1,68 @@
+/*
+  ==============================================================================
+
+    LatencyTest.h
+    Created: 15 Oct 2026 10:21:53am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef LATENCYTEST_H_INCLUDED
+#define LATENCYTEST_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include <atomic>
+
+//! LatencyTest: round trip of the audio device through a loopback from an output to an input
+/*! While the test runs it replaces the processor as the callback of the device and opens the
+    first input. A burst of noise is played on every output after a short silence and the first
+    input is recorded. The position of the highest correlation of the recording with the burst is
+    the round trip in samples, it is only accepted if the peak clearly stands out, so a missing
+    cable gives no result instead of a wrong one. The buffers are allocated in start(), the
+    callback only copies.
+*/
+class LatencyTest : private AudioIODeviceCallback {
+public:
+    explicit LatencyTest(AudioDeviceManager& dm);
+    ~LatencyTest();
+
+    //! \brief message thread: takes the device from the callback, returns an error message or an empty string
+    String start(AudioIODeviceCallback& replaced);
+    //! \brief whether the recording is complete, any thread
+    bool isDone() const { return recording.getNumSamples() > 0 && recorded.load() >= recording.getNumSamples(); }
+    //! \brief message thread: gives the device back to the callback and finds the round trip, -1 without a clear peak
+    int finish();
+
+    //! \brief input plus output latency the driver reports for the device of the test
+    int getReportedLatency() const { return reportedLatency; }
+
+    static const int burstLength = 2048;
+    constexpr static double leadSeconds = .2;          //!< silence before the burst
+    constexpr static double recordSeconds = 1.5;
+    constexpr static float minCorrelation = .3f;       //!< normalised peak below which there is no loopback
+
+private:
+    void audioDeviceIOCallback(const float** inputChannelData, int numInputChannels,
+                               float** outputChannelData, int numOutputChannels, int numSamples) override;
+    void audioDeviceAboutToStart(AudioIODevice* device) override;
+    void audioDeviceStopped() override {}
+
+    //! \brief lag of the best match of the burst in the recording, -1 if there is none
+    int findBurst() const;
+
+    AudioDeviceManager& deviceManager;
+    AudioIODeviceCallback* callback;                //!< the one the device is given back to
+    AudioDeviceManager::AudioDeviceSetup oldSetup;
+
+    AudioSampleBuffer burst;
+    AudioSampleBuffer recording;
+    std::atomic<int> recorded;      //!< samples of the recording written, audio thread
+    int played;                     //!< samples since the start, audio thread
+    int burstStart;
+    int reportedLatency;
+
+    JUCE_DECLARE_NON_COPYABLE(LatencyTest)
+};
+
+#endif  // LATENCYTEST_H_INCLUDED
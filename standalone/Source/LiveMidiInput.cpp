@@ -0,0 +1,223 @@
+/*
+  ==============================================================================
+
+    LiveMidiInput.cpp
+    Created: 15 Oct 2026 8:14:26pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "LiveMidiInput.h"
+#include "OutputRecorder.h"
+#include "SharedOutputRing.h"
+#include "ThreadPlacement.h"
+
+LiveMidiCollector::LiveMidiCollector()
+    : fifo(queueSize)
+    , sampleRate(44100.)
+    , running(false)
+    , clockBlockSize(0)
+    , blockStart(0.)
+    , nextBlockStart(0.)
+    , period(0.)
+    , numEvents(0)
+    , numLate(0)
+    , maxLateMs(0.)
+    , jitterSumMs(0.)
+    , numJitter(0)
+    , maxJitterMs(0.)
+    , blockMs(0.)
+    , statsResetRequested(false)
+{
+}
+
+void LiveMidiCollector::reset(double newSampleRate)
+{
+    jassert(newSampleRate > 0.);
+    sampleRate = newSampleRate;
+    running = false;
+    fifo.reset();
+}
+
+void LiveMidiCollector::addMessageToQueue(const MidiMessage& message)
+{
+    const int size = message.getRawDataSize();
+    if (size > 3) {
+        return;
+    }
+
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite(1, start1, size1, start2, size2);
+    if (size1 + size2 == 0) {
+        // the audio device is not running
+        return;
+    }
+    Event& e = queue[static_cast<size_t>(size1 > 0 ? start1 : start2)];
+    // a message without timestamp, e.g. of a virtual port, counts from its arrival
+    e.time = message.getTimeStamp() > 0. ? message.getTimeStamp() : Time::getMillisecondCounterHiRes() * .001;
+    e.size = static_cast<uint8>(size);
+    std::memcpy(e.data, message.getRawData(), static_cast<size_t>(size));
+    fifo.finishedWrite(1);
+}
+
+void LiveMidiCollector::startClock(double now, double nominal)
+{
+    running = true;
+    blockStart = now;
+    nextBlockStart = now + nominal;
+    period = nominal;
+}
+
+void LiveMidiCollector::removeNextBlockOfMessages(MidiBuffer& dest, int numSamples)
+{
+    jassert(numSamples > 0);
+    if (statsResetRequested.exchange(false)) {
+        numEvents = 0;
+        numLate = 0;
+        maxLateMs = 0.;
+        jitterSumMs = 0.;
+        numJitter = 0;
+        maxJitterMs = 0.;
+    }
+
+    const double now = Time::getMillisecondCounterHiRes() * .001;
+    const double nominal = numSamples / sampleRate;
+    const double error = now - nextBlockStart;
+    if (!running || numSamples != clockBlockSize || std::abs(error) > resyncPeriods * nominal) {
+        clockBlockSize = numSamples;
+        startClock(now, nominal);
+    } else {
+        // second order loop, see F. Adriaensen, Using a DLL to filter time
+        const double omega = 2. * double_Pi * clockBandwidth * nominal;
+        blockStart = nextBlockStart;
+        nextBlockStart += std::sqrt(2.) * omega * error + period;
+        period += omega * omega * error;
+
+        const double jitterMs = 1000. * std::abs(error);
+        jitterSumMs = jitterSumMs + jitterMs;
+        ++numJitter;
+        if (jitterMs > maxJitterMs) {
+            maxJitterMs = jitterMs;
+        }
+    }
+    blockMs = 1000. * period;
+
+    // the block plays the events of the period before its start
+    const double origin = blockStart - period;
+    const double samplesPerSecond = numSamples / period;
+
+    int start1, size1, start2, size2;
+    fifo.prepareToRead(fifo.getNumReady(), start1, size1, start2, size2);
+    int consumed = 0;
+    for (int i = 0; i < size1 + size2; ++i) {
+        const Event& e = queue[static_cast<size_t>(i < size1 ? start1 + i : start2 + i - size1)];
+        const int offset = static_cast<int>((e.time - origin) * samplesPerSecond);
+        if (offset >= numSamples) {
+            // due in a later block, the queue is in the order of arrival
+            break;
+        }
+        if (offset < 0) {
+            ++numLate;
+            const double lateMs = 1000. * (origin - e.time);
+            if (lateMs > maxLateMs) {
+                maxLateMs = lateMs;
+            }
+        }
+        dest.addEvent(e.data, e.size, jmax(0, offset));
+        ++numEvents;
+        ++consumed;
+    }
+    fifo.finishedRead(consumed);
+}
+
+LiveMidiCollector::Stats LiveMidiCollector::getStats() const
+{
+    Stats s;
+    s.numEvents = numEvents;
+    s.numLate = numLate;
+    s.maxLateMs = maxLateMs;
+    const int64 n = numJitter;
+    s.meanCallbackJitterMs = n > 0 ? jitterSumMs / static_cast<double>(n) : 0.;
+    s.maxCallbackJitterMs = maxJitterMs;
+    s.blockMs = blockMs;
+    return s;
+}
+
+LiveMidiPlayer::LiveMidiPlayer(AudioProcessorPlayer& p)
+    : player(p)
+    , processor(nullptr)
+    , recorder(nullptr)
+    , sharedOutput(nullptr)
+    , placement(nullptr)
+{
+}
+
+void LiveMidiPlayer::setProcessor(AudioProcessor* p)
+{
+    const ScopedLock sl(lock);
+    processor = p;
+}
+
+void LiveMidiPlayer::audioDeviceIOCallback(const float**, int, float** outputChannelData, int numOutputChannels, int numSamples)
+{
+    if (placement != nullptr) {
+        placement->placeAudioThread();
+    }
+    incomingMidi.clear();
+    player.getMidiMessageCollector().removeNextBlockOfMessages(incomingMidi, numSamples);
+    collector.removeNextBlockOfMessages(incomingMidi, numSamples);
+
+    for (int c = 0; c < numOutputChannels; ++c) {
+        FloatVectorOperations::clear(outputChannelData[c], numSamples);
+    }
+    AudioSampleBuffer buffer(outputChannelData, numOutputChannels, numSamples);
+
+    {
+        const ScopedLock sl(lock);
+        if (processor != nullptr) {
+            const ScopedLock sl2(processor->getCallbackLock());
+            if (!processor->isSuspended()) {
+                processor->processBlock(buffer, incomingMidi);
+            }
+        }
+    }
+    if (recorder != nullptr) {
+        recorder->push(outputChannelData, numOutputChannels, numSamples);
+    }
+    if (sharedOutput != nullptr) {
+        sharedOutput->push(outputChannelData, numOutputChannels, numSamples);
+    }
+}
+
+void LiveMidiPlayer::audioDeviceAboutToStart(AudioIODevice* device)
+{
+    // prepares the processor and resets the collector of the player
+    player.audioDeviceAboutToStart(device);
+    // the file keeps the rate it was started with, the device is opened on the message thread
+    if (recorder != nullptr && recorder->isRecording() && recorder->getSampleRate() != device->getCurrentSampleRate()) {
+        recorder->stop();
+    }
+    // a new rate or channel count is a new generation of the ring
+    if (sharedOutput != nullptr && sharedOutput->isOpen()) {
+        const Result result = sharedOutput->prepare(device->getCurrentSampleRate(), device->getActiveOutputChannels().countNumberOfSetBits());
+        if (result.failed()) {
+            DBG("shared output: " + result.getErrorMessage());
+        }
+    }
+    collector.reset(device->getCurrentSampleRate());
+    incomingMidi.ensureSize(4096);
+    if (placement != nullptr && device->getCurrentSampleRate() > 0.) {
+        placement->deviceStarted(device->getCurrentBufferSizeSamples() / device->getCurrentSampleRate());
+    }
+}
+
+void LiveMidiPlayer::audioDeviceStopped()
+{
+    player.audioDeviceStopped();
+}
+
+void LiveMidiPlayer::handleIncomingMidiMessage(MidiInput*, const MidiMessage& message)
+{
+    collector.addMessageToQueue(message);
+}
@@ -0,0 +1,148 @@
+/*
+  ==============================================================================
+
+    LiveMidiInput.h
+    Created: 15 Oct 2026 8:14:26pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef LIVEMIDIINPUT_H_INCLUDED
+#define LIVEMIDIINPUT_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include <array>
+#include <atomic>
+
+class OutputRecorder;
+class SharedOutputRing;
+class ThreadPlacement;
+
+//! LiveMidiCollector: the midi of the input devices at the sample offsets of their timestamps
+/*! The MidiMessageCollector of JUCE measures the time since the last audio callback, so every
+    late or early callback moves the events of its block. Here the start times of the blocks
+    are taken from a delay locked loop over the callback times instead, a clock that follows
+    the device but not the scheduling of its callbacks. An event plays one block period after
+    its timestamp: the events of the last period go to the current block at the offsets of
+    their timestamps, the ones of the current period wait for the next block. Events older than
+    that, after a dropout, play at the start of the block and are counted as late.
+
+    The queue between the midi thread and the audio thread is lock free. Only messages of up to
+    three bytes are queued, the synth reads no sysex.
+*/
+class LiveMidiCollector {
+public:
+    LiveMidiCollector();
+
+    //! \brief drops the queue and restarts the clock, before the audio device starts
+    void reset(double newSampleRate);
+
+    //! \brief midi thread: queues a message with the timestamp of its input, in s of Time::getMillisecondCounterHiRes()
+    void addMessageToQueue(const MidiMessage& message);
+
+    //! \brief audio thread: adds the events due in the next numSamples to dest
+    void removeNextBlockOfMessages(MidiBuffer& dest, int numSamples);
+
+    //! timing of the events since the last resetStats()
+    struct Stats {
+        int64 numEvents;
+        int64 numLate;              //!< older than a block period, played at the start of a block
+        double maxLateMs;           //!< by which the latest of them missed its offset
+        double meanCallbackJitterMs;    //!< distance of the callbacks from the clock
+        double maxCallbackJitterMs;
+        double blockMs;             //!< period of the last block, the jitter of events without timestamps
+    };
+    //! \brief any thread
+    Stats getStats() const;
+    //! \brief any thread, the counts start at zero with the next block
+    void resetStats() { statsResetRequested = true; }
+
+    constexpr static double clockBandwidth = 1.;    //!< Hz of the delay locked loop
+    constexpr static double resyncPeriods = 4.;     //!< a callback further from the clock restarts it, a dropout or a new device
+
+private:
+    //! a queued message
+    struct Event {
+        double time;    //!< s
+        uint8 data[3];
+        uint8 size;
+    };
+
+    //! \brief restarts the clock at the callback at now
+    void startClock(double now, double nominal);
+
+    static const int queueSize = 1024;
+    AbstractFifo fifo;
+    std::array<Event, queueSize> queue;
+
+    //! \name clock, audio thread
+    ///@{
+    double sampleRate;
+    bool running;
+    int clockBlockSize;     //!< the clock restarts with another block size
+    double blockStart;      //!< s of the current block
+    double nextBlockStart;  //!< predicted
+    double period;          //!< s of a block of the device in time of the timestamps
+    ///@}
+
+    //! \name stats, written by the audio thread
+    ///@{
+    std::atomic<int64> numEvents;
+    std::atomic<int64> numLate;
+    std::atomic<double> maxLateMs;
+    std::atomic<double> jitterSumMs;
+    std::atomic<int64> numJitter;
+    std::atomic<double> maxJitterMs;
+    std::atomic<double> blockMs;
+    std::atomic<bool> statsResetRequested;
+    ///@}
+
+    JUCE_DECLARE_NON_COPYABLE(LiveMidiCollector)
+};
+
+//! LiveMidiPlayer: plays the processor of the standalone with the midi of LiveMidiCollector
+/*! Replaces the AudioProcessorPlayer of the StandalonePluginHolder as the audio and midi
+    callback of the device. The player still prepares the processor when the device starts and
+    collects the notes that are added to its MidiMessageCollector, as the buffer auto tune does.
+    The processor has no inputs, the inputs of the device are not passed on. The output goes
+    to the OutputRecorder and the SharedOutputRing after every block. The ThreadPlacement places the thread of the
+    callback before its first block.
+*/
+class LiveMidiPlayer : public AudioIODeviceCallback, public MidiInputCallback {
+public:
+    explicit LiveMidiPlayer(AudioProcessorPlayer& p);
+
+    //! \brief the processor to play, the same as the one of the player; nullptr before it is deleted
+    void setProcessor(AudioProcessor* p);
+    //! \brief the recorder of the output, set once before the device starts
+    void setRecorder(OutputRecorder* r) { recorder = r; }
+    //! \brief the ring other processes read the output from, set once before the device starts
+    void setSharedOutput(SharedOutputRing* r) { sharedOutput = r; }
+    //! \brief the cores and the scheduling of the callback thread, set once before the device starts
+    void setThreadPlacement(ThreadPlacement* p) { placement = p; }
+
+    MidiMessageCollector& getMidiMessageCollector() { return player.getMidiMessageCollector(); }
+    LiveMidiCollector& getLiveMidi() { return collector; }
+
+    void audioDeviceIOCallback(const float** inputChannelData, int numInputChannels,
+                               float** outputChannelData, int numOutputChannels, int numSamples) override;
+    void audioDeviceAboutToStart(AudioIODevice* device) override;
+    void audioDeviceStopped() override;
+    void handleIncomingMidiMessage(MidiInput*, const MidiMessage& message) override;
+
+private:
+    AudioProcessorPlayer& player;
+    LiveMidiCollector collector;
+
+    CriticalSection lock;   //!< of the processor
+    AudioProcessor* processor;
+    MidiBuffer incomingMidi;
+    OutputRecorder* recorder;
+    SharedOutputRing* sharedOutput;
+    ThreadPlacement* placement;
+
+    JUCE_DECLARE_NON_COPYABLE(LiveMidiPlayer)
+};
+
+#endif  // LIVEMIDIINPUT_H_INCLUDED
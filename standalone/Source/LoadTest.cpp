@@ -0,0 +1,275 @@
+/*
+  ==============================================================================
+
+    LoadTest.cpp
+    Created: 15 Oct 2026 5:40:52pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "LoadTest.h"
+#include "FactoryBank.h"
+#include "RealtimeCheck.h"
+#include "SimdKernels.h"
+#include <algorithm>
+#include <iostream>
+
+AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+namespace {
+    const double bpm = 140.;
+    const int controllerInterval = 32;  //!< samples between the messages of a controller stream
+    const int arpeggio[] = { 48, 55, 60, 63, 67, 72, 67, 63 };
+
+    //! \brief calls add(k) for every event time offset + k * period in [start, start + numSamples)
+    template <typename tAdd>
+    void forEachEvent(int64 start, int numSamples, int64 offset, int64 period, tAdd add) {
+        const int64 end = start + numSamples;
+        int64 k = start > offset ? (start - offset + period - 1) / period : 0;
+        for (int64 t = offset + k * period; t < end; t = offset + ++k * period) {
+            add(k, static_cast<int>(t - start));
+        }
+    }
+}
+
+LoadTest::LoadTest(const Options& o)
+    : options(o)
+    , blockStart(0)
+{
+    processor = dynamic_cast<PluginAudioProcessor*>(createPluginFilter());
+}
+
+LoadTest::~LoadTest()
+{
+    if (processor != nullptr) {
+        processor->setPlayHead(nullptr);
+    }
+}
+
+bool LoadTest::runFromCommandLine(const StringArray& args, String& error)
+{
+    if (!args.contains("--load-test")) {
+        return false;
+    }
+    Options o;
+    const int json = args.indexOf("--json");
+    if (json >= 0 && json + 1 < args.size()) {
+        o.json = File::getCurrentWorkingDirectory().getChildFile(args[json + 1].unquoted());
+    }
+    const int seconds = args.indexOf("--seconds");
+    if (seconds >= 0 && seconds + 1 < args.size()) {
+        o.secondsPerCase = jmax(0.1, args[seconds + 1].getDoubleValue());
+    }
+    const int rate = args.indexOf("--rate");
+    if (rate >= 0 && rate + 1 < args.size()) {
+        o.sampleRate = jlimit(8000., 384000., args[rate + 1].getDoubleValue());
+    }
+    const int block = args.indexOf("--block");
+    if (block >= 0 && block + 1 < args.size()) {
+        o.blockSize = jlimit(1, 8192, args[block + 1].getIntValue());
+    }
+    const int patches = args.indexOf("--patches");
+    if (patches >= 0 && patches + 2 < args.size()) {
+        o.firstPatch = jmax(0, args[patches + 1].getIntValue());
+        o.numPatches = jmax(1, args[patches + 2].getIntValue());
+    }
+
+    LoadTest test(o);
+    error = test.run();
+    return true;
+}
+
+String LoadTest::getWorkloadName(eWorkload w)
+{
+    switch (w) {
+        case eWorkload::eChords: return "chords";
+        case eWorkload::eArpeggio: return "arpeggio";
+        case eWorkload::eSequencer: return "sequencer";
+        case eWorkload::eSequencerSync: return "sequencer sync";
+        case eWorkload::eControllers: return "controllers";
+        default: return String();
+    }
+}
+
+bool LoadTest::getCurrentPosition(CurrentPositionInfo& result)
+{
+    result.resetToDefault();
+    const double seconds = static_cast<double>(blockStart) / options.sampleRate;
+    result.bpm = bpm;
+    result.timeInSamples = blockStart;
+    result.timeInSeconds = seconds;
+    result.ppqPosition = seconds * bpm / 60.;
+    result.ppqPositionOfLastBarStart = std::floor(result.ppqPosition / 4.) * 4.;
+    result.isPlaying = true;
+    return true;
+}
+
+void LoadTest::fillMidi(eWorkload workload, MidiBuffer& midi, int64 start, int numSamples) const
+{
+    const int64 bar = static_cast<int64>(options.sampleRate * 240. / bpm);
+    switch (workload) {
+        case eWorkload::eChords: {
+            // a chord of the whole polyphony every bar, released before the next one
+            const int numNotes = static_cast<int>(processor->polyphony.get());
+            forEachEvent(start, numSamples, 0, bar, [&](int64 k, int pos) {
+                for (int n = 0; n < numNotes; ++n) {
+                    midi.addEvent(MidiMessage::noteOn(1, 36 + n + static_cast<int>(k % 2) * 2, 0.8f), pos);
+                }
+            });
+            forEachEvent(start, numSamples, bar * 3 / 4, bar, [&](int64 k, int pos) {
+                for (int n = 0; n < numNotes; ++n) {
+                    midi.addEvent(MidiMessage::noteOff(1, 36 + n + static_cast<int>(k % 2) * 2), pos);
+                }
+            });
+            break;
+        }
+        case eWorkload::eArpeggio: {
+            // 32nd notes that overlap their successor by half a step
+            const int64 step = bar / 32;
+            const int numSteps = static_cast<int>(sizeof(arpeggio) / sizeof(arpeggio[0]));
+            forEachEvent(start, numSamples, 0, step, [&](int64 k, int pos) {
+                midi.addEvent(MidiMessage::noteOn(1, arpeggio[k % numSteps], 0.7f + 0.3f * static_cast<float>(k % 3) / 2.f), pos);
+            });
+            forEachEvent(start, numSamples, step * 3 / 2, step, [&](int64 k, int pos) {
+                midi.addEvent(MidiMessage::noteOff(1, arpeggio[k % numSteps]), pos);
+            });
+            break;
+        }
+        case eWorkload::eSequencer:
+        case eWorkload::eSequencerSync:
+            // the sequencer plays its own notes
+            break;
+        case eWorkload::eControllers: {
+            const int chord[] = { 48, 55, 60, 64 };
+            if (start == 0) {
+                for (int note : chord) {
+                    midi.addEvent(MidiMessage::noteOn(1, note, 0.8f), 0);
+                }
+            }
+            // mod wheel, pitch bend and aftertouch sweep once per bar, each with its own phase
+            forEachEvent(start, numSamples, 0, controllerInterval, [&](int64 k, int pos) {
+                const double phase = static_cast<double>(k * controllerInterval) / static_cast<double>(bar);
+                const auto sweep = [phase](double offset) { return .5 + .5 * std::sin(2. * double_Pi * (phase + offset)); };
+                midi.addEvent(MidiMessage::controllerEvent(1, 1, roundToInt(sweep(0.) * 127.)), pos);
+                midi.addEvent(MidiMessage::pitchWheel(1, roundToInt(sweep(.33) * 16383.)), pos);
+                midi.addEvent(MidiMessage::channelPressureChange(1, roundToInt(sweep(.67) * 127.)), pos);
+            });
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+LoadTest::Result LoadTest::runCase(int patch, eWorkload workload)
+{
+    PluginAudioProcessor& p = *processor;
+    const int blockSize = options.blockSize;
+
+    // prepared for every case, so no voice, echo or lfo phase is left from the last one
+    p.setCurrentProgram(patch);
+    p.setPlayConfigDetails(0, 2, options.sampleRate, blockSize);
+    p.setNonRealtime(false);
+    p.setPlayHead(this);
+    p.prepareToPlay(options.sampleRate, blockSize);
+
+    AudioSampleBuffer buffer(2, blockSize);
+    MidiBuffer midi;
+    midi.ensureSize(4096);
+
+    // the first block applies the program, the workload sets the sequencer afterwards
+    blockStart = 0;
+    buffer.clear();
+    p.processBlock(buffer, midi);
+    p.seqPlayNoHost.setStep(workload == eWorkload::eSequencer ? eOnOffToggle::eOn : eOnOffToggle::eOff);
+    p.seqPlaySyncHost.setStep(workload == eWorkload::eSequencerSync ? eOnOffToggle::eOn : eOnOffToggle::eOff);
+
+    const int numBlocks = jmax(1, static_cast<int>(options.secondsPerCase * options.sampleRate / blockSize));
+    Array<double> blockSeconds;
+    blockSeconds.ensureStorageAllocated(numBlocks);
+    const int violationsBefore = RealtimeCheck::getViolationCount();
+    int64 total = 0;
+
+    for (int b = 0; b < numBlocks; ++b) {
+        blockStart = static_cast<int64>(b) * blockSize;
+        midi.clear();
+        fillMidi(workload, midi, blockStart, blockSize);
+        buffer.clear();
+
+        const int64 start = Time::getHighResolutionTicks();
+        p.processBlock(buffer, midi);
+        const int64 ticks = Time::getHighResolutionTicks() - start;
+        total += ticks;
+        blockSeconds.add(Time::highResolutionTicksToSeconds(ticks));
+    }
+
+    p.releaseResources();
+    p.setPlayHead(nullptr);
+
+    std::sort(blockSeconds.begin(), blockSeconds.end());
+    Result r;
+    r.patch = FactoryBank::getProgramName(patch);
+    r.workload = workload;
+    const double wallSeconds = Time::highResolutionTicksToSeconds(total);
+    r.realtimeFactor = wallSeconds > 0. ? numBlocks * blockSize / options.sampleRate / wallSeconds : 0.;
+    r.p99BlockMs = 1000. * blockSeconds[jmin(numBlocks - 1, numBlocks * 99 / 100)];
+    r.maxBlockMs = 1000. * blockSeconds.getLast();
+    r.violations = SYNISTER_REALTIME_CHECKS ? RealtimeCheck::getViolationCount() - violationsBefore : -1;
+    return r;
+}
+
+var LoadTest::toJson(const Result& r)
+{
+    DynamicObject::Ptr o = new DynamicObject();
+    o->setProperty("case", r.patch + " / " + getWorkloadName(r.workload));
+    o->setProperty("patch", r.patch);
+    o->setProperty("workload", getWorkloadName(r.workload));
+    o->setProperty("realtimeFactor", r.realtimeFactor);
+    o->setProperty("p99BlockMs", r.p99BlockMs);
+    o->setProperty("maxBlockMs", r.maxBlockMs);
+    o->setProperty("violations", r.violations);
+    return var(o.get());
+}
+
+String LoadTest::run()
+{
+    if (processor == nullptr) {
+        return "the processor could not be created";
+    }
+
+    const int numPrograms = FactoryBank::getNumPrograms();
+    const int first = jmin(options.firstPatch, numPrograms);
+    const int end = options.numPatches < 0 ? numPrograms : jmin(numPrograms, first + options.numPatches);
+    if (first >= end) {
+        return "no factory patch in the range";
+    }
+
+    Array<var> results;
+    std::cout << "patch                     workload          realtime  p99 ms  max ms  violations" << std::endl;
+    for (int patch = first; patch < end; ++patch) {
+        for (int w = 0; w < static_cast<int>(eWorkload::nSteps); ++w) {
+            const Result r = runCase(patch, static_cast<eWorkload>(w));
+            std::cout << r.patch.substring(0, 25).paddedRight(' ', 25) << " " << getWorkloadName(r.workload).paddedRight(' ', 16) << " "
+                      << String(r.realtimeFactor, 1).paddedLeft(' ', 9) << " " << String(r.p99BlockMs, 3).paddedLeft(' ', 7) << " "
+                      << String(r.maxBlockMs, 3).paddedLeft(' ', 7) << " "
+                      << (r.violations < 0 ? String("n/a") : String(r.violations)).paddedLeft(' ', 11) << std::endl;
+            results.add(toJson(r));
+        }
+    }
+
+    if (options.json != File::nonexistent) {
+        DynamicObject::Ptr root = new DynamicObject();
+        root->setProperty("cpu", SystemStats::getCpuVendor());
+        root->setProperty("cpuMHz", SystemStats::getCpuSpeedInMegaherz());
+        root->setProperty("simd", SimdKernels::get().name);
+        root->setProperty("sampleRate", options.sampleRate);
+        root->setProperty("blockSize", options.blockSize);
+        root->setProperty("metric", "p99BlockMs");
+        root->setProperty("results", results);
+        if (!options.json.replaceWithText(JSON::toString(var(root.get())))) {
+            return "cannot write " + options.json.getFullPathName();
+        }
+    }
+    return String();
+}
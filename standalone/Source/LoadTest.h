@@ -0,0 +1,82 @@
+/*
+  ==============================================================================
+
+    LoadTest.h
+    Created: 15 Oct 2026 5:40:52pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef LOADTEST_H_INCLUDED
+#define LOADTEST_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "PluginProcessor.h"
+
+//! LoadTest: drives the whole processBlock of a prepared processor like a host under load
+/*! Every factory patch plays every workload for a fixed stretch of simulated time: chords at
+    full polyphony, a fast arpeggio, the step sequencer free running and synced to a playing
+    transport, and a held chord under dense controller, pitch bend and aftertouch streams. Each
+    block is timed, a case reports the real-time factor, the 99th percentile of the block time
+    and, in a build with SYNISTER_REALTIME_CHECKS, the allocations and locks of the audio thread.
+    Unlike the voice and fx benchmarks it includes the sub-block splitting of the Synthesiser,
+    the effects and their tails, the automation ramps and the master output.
+*/
+class LoadTest : public AudioPlayHead {
+public:
+    enum class eWorkload : int {
+        eChords = 0,
+        eArpeggio,
+        eSequencer,
+        eSequencerSync,
+        eControllers,
+        nSteps
+    };
+
+    struct Options {
+        double sampleRate = 48000.;
+        int blockSize = 256;
+        double secondsPerCase = 4.;     //!< simulated time of a case
+        int firstPatch = 0;
+        int numPatches = -1;            //!< -1 for all factory patches
+        File json;                      //!< the results as json, none if it does not exist
+    };
+
+    struct Result {
+        String patch;
+        eWorkload workload;
+        double realtimeFactor;          //!< simulated time per wall clock time, above 1 is faster than real time
+        double p99BlockMs;
+        double maxBlockMs;
+        int violations;                 //!< allocations and locks of the audio thread, -1 without realtime checks
+    };
+
+    explicit LoadTest(const Options& o);
+    ~LoadTest();
+
+    //! \brief runs all cases, prints a line per case and writes the json, returns an error message or an empty string
+    String run();
+
+    //! \brief parses "--load-test [--json <file>] [--seconds <s>] [--rate <hz>] [--block <n>] [--patches <first> <count>]", false if the arguments are no load test
+    static bool runFromCommandLine(const StringArray& args, String& error);
+
+    //! \brief a playing transport at 140 bpm, for the synced sequencer
+    bool getCurrentPosition(CurrentPositionInfo& result) override;
+
+    static String getWorkloadName(eWorkload w);
+
+private:
+    Result runCase(int patch, eWorkload workload);
+    //! \brief the events of the workload for the block starting at blockStart
+    void fillMidi(eWorkload workload, MidiBuffer& midi, int64 start, int numSamples) const;
+    static var toJson(const Result& r);
+
+    Options options;
+    ScopedPointer<PluginAudioProcessor> processor;
+    int64 blockStart;
+
+    JUCE_DECLARE_NON_COPYABLE(LoadTest)
+};
+
+#endif  // LOADTEST_H_INCLUDED
@@ -13,9 +13,211 @@
 #define JucePlugin_MaxNumInputChannels 0
 #define JucePlugin_MaxNumOutputChannels 2
 #include "../../juce/modules/juce_audio_plugin_client/Standalone/juce_StandaloneFilterWindow.h"
+#include "PluginProcessor.h"
+#include "BatchRenderer.h"
+#include "NullTest.h"
+#include "VoiceBenchmark.h"
+#include "FxBenchmark.h"
+#include "AliasBenchmark.h"
+#include "PaintBenchmark.h"
+#include "InstanceBenchmark.h"
+#include "BenchmarkCompare.h"
+#include "LoadTest.h"
+#include "SessionReplay.h"
+#include "SoakTest.h"
+#include "CostCalibration.h"
+#include "BankBuilder.h"
+#include "RenderFarm.h"
+#include "AudioEngineSettings.h"
+#include "AudioEnginePanel.h"
+#include "LiveMidiInput.h"
+#include "OutputRecorder.h"
+#include "SharedOutputRing.h"
+#include "MetricsReporter.h"
+#include "ThreadPlacement.h"
 
 Component* createMainContentComponent();
 
+//==============================================================================
+//! the standalone window with the audio engine settings instead of the plain device selector
+/*! The LiveMidiPlayer takes the device from the player of JUCE, so the midi of the inputs plays
+    at the offsets of its timestamps instead of the start of a block. The record button next to
+    the options writes the output to a wav file, see OutputRecorder. With "--metrics host:port"
+    the MetricsReporter sends the cpu, deadline and memory statistics to a collector. With
+    "--shared-output [file]" other processes read the output from a SharedOutputRing. The cores
+    and the scheduling of the audio threads of the machine are set in the audio settings.
+*/
+class SynisterStandaloneWindow : public StandaloneFilterWindow, private Timer
+{
+public:
+    SynisterStandaloneWindow(const String& title, PropertySet& settings)
+        : StandaloneFilterWindow(title, Colours::black, &settings, false)
+        , engineSettings(getDeviceManager(), settings)
+        , placement(settings)
+        , livePlayer(pluginHolder->player)
+        , recordButton("rec")
+    {
+        Component::addAndMakeVisible(recordButton);
+        recordButton.addListener(this);
+        recordButton.setTooltip(TRANS("records the output into the music folder"));
+        livePlayer.setRecorder(&recorder);
+        livePlayer.setSharedOutput(&sharedOutput);
+        livePlayer.setThreadPlacement(&placement);
+
+        AudioDeviceManager& deviceManager = getDeviceManager();
+        deviceManager.removeMidiInputCallback(String::empty, &pluginHolder->player);
+        deviceManager.removeAudioCallback(&pluginHolder->player);
+        livePlayer.setProcessor(getAudioProcessor());
+        deviceManager.addAudioCallback(&livePlayer);
+        deviceManager.addMidiInputCallback(String::empty, &livePlayer);
+        metrics.setProcessor(dynamic_cast<PluginAudioProcessor*>(getAudioProcessor()));
+    }
+
+    ~SynisterStandaloneWindow()
+    {
+        AudioDeviceManager& deviceManager = getDeviceManager();
+        deviceManager.removeMidiInputCallback(String::empty, &livePlayer);
+        deviceManager.removeAudioCallback(&livePlayer);
+        livePlayer.setProcessor(nullptr);
+        recorder.stop();
+        sharedOutput.close();
+        metrics.stop();
+        metrics.setProcessor(nullptr);
+    }
+
+    void buttonClicked(Button* b) override
+    {
+        if (b == &recordButton) {
+            toggleRecording();
+            return;
+        }
+
+        PopupMenu m;
+        m.addItem(1, TRANS("Audio Settings..."));
+        m.addSeparator();
+        m.addItem(2, TRANS("Save current state..."));
+        m.addItem(3, TRANS("Load a saved state..."));
+        m.addSeparator();
+        m.addItem(4, TRANS("Reset to default state"));
+        m.showMenuAsync(PopupMenu::Options(), ModalCallbackFunction::forComponent(menuCallback, this));
+    }
+
+    void resized() override
+    {
+        StandaloneFilterWindow::resized();
+        recordButton.setBounds(72, 6, 80, getTitleBarHeight() - 8);
+    }
+
+    //! \brief reports to the collector of the options, see MetricsReporter::parseCommandLine()
+    void startMetrics(const MetricsReporter::Options& o) { metrics.start(o); }
+
+    //! \brief shares the output in the file, from the running device on
+    void startSharedOutput(const File& file)
+    {
+        sharedOutput.open(file);
+        if (AudioIODevice* device = getDeviceManager().getCurrentAudioDevice()) {
+            const Result result = sharedOutput.prepare(device->getCurrentSampleRate(), device->getActiveOutputChannels().countNumberOfSetBits());
+            if (result.failed()) {
+                std::cerr << "shared output: " << result.getErrorMessage() << std::endl;
+            }
+        }
+    }
+
+private:
+    void toggleRecording()
+    {
+        if (recorder.isRecording()) {
+            recorder.stop();
+        } else {
+            AudioIODevice* device = getDeviceManager().getCurrentAudioDevice();
+            const double rate = device != nullptr ? device->getCurrentSampleRate() : 0.;
+            const int numChannels = getAudioProcessor()->getNumOutputChannels();
+            const Result result = recorder.start(OutputRecorder::createRecordingFile(), rate, numChannels);
+            if (result.failed()) {
+                AlertWindow::showMessageBoxAsync(AlertWindow::WarningIcon, TRANS("Recording failed"), result.getErrorMessage());
+            }
+        }
+        updateRecordButton();
+        if (recorder.isRecording()) {
+            startTimer(500);
+        }
+    }
+
+    //! the time recorded, or the file of the last recording
+    void updateRecordButton()
+    {
+        const bool on = recorder.isRecording();
+        recordButton.setColour(TextButton::buttonColourId, on ? Colours::red : Colours::lightgrey);
+        if (on) {
+            const int seconds = static_cast<int>(recorder.getSecondsRecorded());
+            recordButton.setButtonText(String::formatted("rec %d:%02d", seconds / 60, seconds % 60));
+        } else {
+            recordButton.setButtonText("rec");
+        }
+        if (!on && recorder.getFile() != File::nonexistent) {
+            String tip = TRANS("last recording: ") + recorder.getFile().getFullPathName();
+            if (recorder.getDroppedSamples() > 0) {
+                tip << "\n" << String(recorder.getDroppedSamples()) << TRANS(" samples were dropped, the disk was too slow");
+            }
+            recordButton.setTooltip(tip);
+        }
+    }
+
+    //! the recording stops by itself when the device changes its rate
+    void timerCallback() override
+    {
+        updateRecordButton();
+        if (!recorder.isRecording()) {
+            stopTimer();
+        }
+    }
+
+    static void menuCallback(int result, SynisterStandaloneWindow* window)
+    {
+        if (window == nullptr || result == 0) {
+            return;
+        }
+        if (result == 1) {
+            window->showAudioEngineDialog();
+        } else if (result == 4) {
+            // the processor is deleted and created again
+            window->livePlayer.setProcessor(nullptr);
+            window->metrics.setProcessor(nullptr);
+            window->resetToDefaultState();
+            window->livePlayer.setProcessor(window->getAudioProcessor());
+            window->metrics.setProcessor(dynamic_cast<PluginAudioProcessor*>(window->getAudioProcessor()));
+        } else {
+            window->handleMenuResult(result);
+        }
+    }
+
+    void showAudioEngineDialog()
+    {
+        PluginAudioProcessor* processor = dynamic_cast<PluginAudioProcessor*>(getAudioProcessor());
+        if (processor == nullptr) {
+            pluginHolder->showAudioSettingsDialog();
+            return;
+        }
+
+        DialogWindow::LaunchOptions o;
+        o.content.setOwned(new AudioEnginePanel(getDeviceManager(), engineSettings, livePlayer, *processor, placement));
+        o.dialogTitle = TRANS("Audio Settings");
+        o.dialogBackgroundColour = Colour(0xfff0f0f0);
+        o.escapeKeyTriggersCloseButton = true;
+        o.useNativeTitleBar = true;
+        o.resizable = false;
+        o.launchAsync();
+    }
+
+    AudioEngineSettings engineSettings;
+    ThreadPlacement placement;
+    LiveMidiPlayer livePlayer;
+    OutputRecorder recorder;
+    SharedOutputRing sharedOutput;
+    MetricsReporter metrics;
+    TextButton recordButton;
+};
+
 //==============================================================================
 class StandaloneApplication  : public JUCEApplication
 {
@@ -30,13 +232,51 @@ public:
     //==============================================================================
     void initialise (const String& commandLine) override
     {
-        ignoreUnused(commandLine);
         // This method is where you should put your application's initialisation code..
-        
-        mainWindow = new StandaloneFilterWindow(getApplicationName(),Colours::black,nullptr,false);
+
+        // batch rendering without window and audio device
+        String renderError;
+        const StringArray args = StringArray::fromTokens(commandLine, true);
+        if (OfflineRenderer::runFromCommandLine(args, renderError) || BatchRenderer::runFromCommandLine(args, renderError)
+            || NullTest::runFromCommandLine(args, renderError) || VoiceBenchmark::runFromCommandLine(args, renderError)
+            || FxBenchmark::runFromCommandLine(args, renderError) || AliasBenchmark::runFromCommandLine(args, renderError)
+            || PaintBenchmark::runFromCommandLine(args, renderError)
+            || InstanceBenchmark::runFromCommandLine(args, renderError) || BenchmarkCompare::runFromCommandLine(args, renderError)
+            || LoadTest::runFromCommandLine(args, renderError) || SessionReplay::runFromCommandLine(args, renderError)
+            || SoakTest::runFromCommandLine(args, renderError)
+            || CostCalibration::runFromCommandLine(args, renderError) || BankBuilder::runFromCommandLine(args, renderError)
+            || RenderCoordinator::runFromCommandLine(args, renderError) || RenderWorker::runFromCommandLine(args, renderError)) {
+            if (renderError.isNotEmpty()) {
+                std::cerr << renderError << std::endl;
+                setApplicationReturnValue(1);
+            }
+            quit();
+            return;
+        }
+
+        // device setup, engine profiles and the plugin state persist in the settings file
+        PropertiesFile::Options options;
+        options.applicationName = getApplicationName();
+        options.filenameSuffix = "settings";
+        options.folderName = "Synister";
+        options.osxLibrarySubFolder = "Application Support";
+        appProperties.setStorageParameters(options);
+
+        mainWindow = new SynisterStandaloneWindow(getApplicationName(), *appProperties.getUserSettings());
         mainWindow->setSize(814, 693 + mainWindow->getTitleBarHeight());
 		mainWindow->setTopLeftPosition(200,20);
         mainWindow->setVisible(true);
+
+        applyEngineOptions(commandLine);
+        mainWindow->startMetrics(MetricsReporter::parseCommandLine(args));
+
+        // the output for recorders and analysers on the same machine, without a loopback device
+        const int shared = args.indexOf("--shared-output");
+        if (shared >= 0) {
+            const bool named = shared + 1 < args.size() && !args[shared + 1].startsWith("--");
+            mainWindow->startSharedOutput(named ? File::getCurrentWorkingDirectory().getChildFile(args[shared + 1].unquoted())
+                                                : SharedOutputRing::getDefaultFile());
+        }
     }
 
     void shutdown() override
@@ -44,6 +284,7 @@ public:
         // Add your application's shutdown code here..
 
         mainWindow = nullptr; // (deletes our window)
+        appProperties.saveIfNeeded();
     }
 
     //==============================================================================
@@ -64,7 +305,65 @@ public:
 
 
 private:
-    ScopedPointer<StandaloneFilterWindow> mainWindow;
+    //! engine options of the standalone build: --parallel-voices, --voice-bank, --note-cache, --fixed-engine-rate, --lock-memory, --pipelined-fx, --seq-freeze, --delay-storage fixed|half, --gui-throttle <percent>
+    void applyEngineOptions(const String& commandLine)
+    {
+        PluginAudioProcessor* processor = dynamic_cast<PluginAudioProcessor*>(mainWindow->getAudioProcessor());
+        if (processor == nullptr) {
+            return;
+        }
+
+        const StringArray args = StringArray::fromTokens(commandLine, true);
+        bool needsPrepare = false;
+
+        if (args.contains("--parallel-voices")) {
+            processor->parallelVoices.setStep(eOnOffToggle::eOn);
+            needsPrepare = true;
+        }
+        if (args.contains("--voice-bank")) {
+            processor->voiceBankMode.setStep(eOnOffToggle::eOn);
+        }
+        if (args.contains("--note-cache")) {
+            processor->noteCache.setStep(eOnOffToggle::eOn);
+            needsPrepare = true;
+        }
+        if (args.contains("--fixed-engine-rate")) {
+            processor->fixedEngineRate.setStep(eOnOffToggle::eOn);
+            needsPrepare = true;
+        }
+        if (args.contains("--lock-memory")) {
+            processor->lockMemory.setStep(eOnOffToggle::eOn);
+            needsPrepare = true;
+        }
+        if (args.contains("--pipelined-fx")) {
+            processor->pipelinedFx.setStep(eOnOffToggle::eOn);
+            needsPrepare = true;
+        }
+        if (args.contains("--seq-freeze")) {
+            processor->seqFreeze.setStep(eOnOffToggle::eOn);
+            needsPrepare = true;
+        }
+        const int storage = args.indexOf("--delay-storage");
+        if (storage >= 0 && storage + 1 < args.size()) {
+            processor->delayStorage.setStep(args[storage + 1] == "half" ? eDelayStorage::eHalf : eDelayStorage::eFixed16);
+            needsPrepare = true;
+        }
+        // the load above which the editor slows down, 100 keeps it at full rate
+        const int throttle = args.indexOf("--gui-throttle");
+        if (throttle >= 0 && throttle + 1 < args.size()) {
+            processor->guiThrottle.setUI(jlimit(processor->guiThrottle.getMin(), processor->guiThrottle.getMax(), args[throttle + 1].getFloatValue()));
+        }
+
+        if (needsPrepare) {
+            // the worker pool, the note cache, the engine rate, the locked memory, the fx pipeline, the sequencer freeze and the delay ring are only set up in prepareToPlay, so restart the device
+            AudioDeviceManager& deviceManager = mainWindow->getDeviceManager();
+            deviceManager.closeAudioDevice();
+            deviceManager.restartLastAudioDevice();
+        }
+    }
+
+    ApplicationProperties appProperties;
+    ScopedPointer<SynisterStandaloneWindow> mainWindow;
 };
 
 //==============================================================================
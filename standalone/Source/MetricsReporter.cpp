@@ -0,0 +1,261 @@
+/*
+  ==============================================================================
+
+    MetricsReporter.cpp
+    Created: 16 Oct 2026 2:41:18pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "MetricsReporter.h"
+#include "PluginProcessor.h"
+
+namespace {
+    //! a name that is one element of a graphite path
+    String toMetricName(const String& name)
+    {
+        return name.toLowerCase().replaceCharacters(" ./:", "____");
+    }
+
+    //! the unix time of the report, the same for all lines of it
+    int64 getUnixSeconds()
+    {
+        return Time::currentTimeMillis() / 1000;
+    }
+}
+
+MetricsReporter::MetricsReporter()
+    : Thread("synister metrics")
+    , processor(nullptr)
+    , readingCpu(false)
+    , machine(SystemStats::getComputerName())
+    , sequence(0)
+{
+}
+
+MetricsReporter::~MetricsReporter()
+{
+    stop();
+    setProcessor(nullptr);
+}
+
+MetricsReporter::Options MetricsReporter::parseCommandLine(const StringArray& args)
+{
+    Options o;
+    const int i = args.indexOf("--metrics");
+    if (i < 0 || i + 1 >= args.size()) {
+        return o;
+    }
+    const String target = args[i + 1];
+    const int port = target.fromLastOccurrenceOf(":", false, false).getIntValue();
+    if (!target.contains(":") || port <= 0 || port > 65535) {
+        return o;
+    }
+    o.host = target.upToLastOccurrenceOf(":", false, false);
+    o.port = port;
+    o.plainText = args.contains("--metrics-plain");
+    o.tcp = args.contains("--metrics-tcp");
+    const int interval = args.indexOf("--metrics-interval");
+    if (interval >= 0) {
+        o.intervalSeconds = jlimit(1, 3600, args[interval + 1].getIntValue());
+    }
+    return o;
+}
+
+void MetricsReporter::start(const Options& o)
+{
+    stop();
+    if (o.host.isEmpty()) {
+        return;
+    }
+    options = o;
+    startThread(3);
+    startTimer(options.intervalSeconds * 1000);
+    // the cpu meter only measures while someone reads it
+    setProcessor(processor);
+}
+
+void MetricsReporter::stop()
+{
+    stopTimer();
+    setProcessor(processor);
+    signalThreadShouldExit();
+    notify();
+    // a connect to a collector that is down may take its timeout
+    stopThread(4000);
+    udp = nullptr;
+    stream = nullptr;
+    pending = String::empty;
+}
+
+void MetricsReporter::setProcessor(PluginAudioProcessor* p)
+{
+    if (readingCpu && processor != nullptr) {
+        processor->telemetry.cpu.removeReader();
+    }
+    processor = p;
+    readingCpu = processor != nullptr && isTimerRunning();
+    if (readingCpu) {
+        processor->telemetry.cpu.addReader();
+    }
+}
+
+void MetricsReporter::timerCallback()
+{
+    if (processor == nullptr) {
+        return;
+    }
+    // the info panel may have picked up the last window already, getStats() has it either way
+    processor->telemetry.cpu.update();
+    const String report = options.plainText ? formatPlainText() : formatJson();
+    ++sequence;
+
+    const ScopedLock sl(pendingLock);
+    pending = report;
+    notify();
+}
+
+void MetricsReporter::run()
+{
+    while (!threadShouldExit()) {
+        wait(-1);
+        String report;
+        {
+            const ScopedLock sl(pendingLock);
+            report.swapWith(pending);
+        }
+        if (report.isNotEmpty() && !threadShouldExit()) {
+            send(report);
+        }
+    }
+}
+
+bool MetricsReporter::send(const String& report)
+{
+    const char* data = report.toRawUTF8();
+    const int numBytes = static_cast<int>(report.getNumBytesAsUTF8());
+
+    if (!options.tcp) {
+        if (udp == nullptr) {
+            udp = new DatagramSocket();
+        }
+        return udp->write(options.host, options.port, data, numBytes) == numBytes;
+    }
+
+    if (stream == nullptr || !stream->isConnected()) {
+        stream = new StreamingSocket();
+        if (!stream->connect(options.host, options.port, 2000)) {
+            stream = nullptr;
+            return false;
+        }
+    }
+    if (stream->write(data, numBytes) != numBytes) {
+        // the collector went away, the next report connects again
+        stream = nullptr;
+        return false;
+    }
+    return true;
+}
+
+String MetricsReporter::formatJson() const
+{
+    const CpuStats& stats = processor->telemetry.cpu.getStats();
+    const DeadlineMonitor& deadlines = processor->telemetry.deadlines;
+    const MemoryFootprint memory = processor->telemetry.getMemoryFootprint();
+
+    DynamicObject::Ptr o = new DynamicObject();
+    o->setProperty("machine", machine);
+    o->setProperty("time", getUnixSeconds());
+    o->setProperty("sequence", sequence);
+    o->setProperty("sampleRate", processor->getSampleRate());
+    o->setProperty("blockSize", processor->getBlockSize());
+
+    // percent of the real-time budget of a block, over the last window of the meter
+    DynamicObject::Ptr cpu = new DynamicObject();
+    cpu->setProperty("blocks", stats.numBlocks);
+    for (int s = 0; s < CpuStats::numStages; ++s) {
+        DynamicObject::Ptr stage = new DynamicObject();
+        stage->setProperty("mean", stats.mean[s]);
+        stage->setProperty("p99", stats.p99[s]);
+        stage->setProperty("max", stats.max[s]);
+        cpu->setProperty(CpuMeter::getStageName(static_cast<eCpuStage>(s)), var(stage.get()));
+    }
+    o->setProperty("cpu", var(cpu.get()));
+
+    DynamicObject::Ptr voices = new DynamicObject();
+    voices->setProperty("meanActive", stats.meanActiveVoices);
+    voices->setProperty("percentPerVoice", stats.voicePercent);
+    voices->setProperty("polyphony", roundToInt(processor->polyphony.get()));
+    o->setProperty("voices", var(voices.get()));
+
+    // the counts since the start, a collector takes the differences of two reports
+    DynamicObject::Ptr deadline = new DynamicObject();
+    deadline->setProperty("blocks", deadlines.getNumBlocks());
+    deadline->setProperty("incidents", deadlines.getNumIncidents());
+    deadline->setProperty("threshold", deadlines.getThreshold());
+    deadline->setProperty("worstLoad", deadlines.getWorstLoad());
+    deadline->setProperty("binPercent", DeadlineMonitor::binPercent);
+    Array<var> bins;
+    for (int b = 0; b < DeadlineMonitor::numBins; ++b) {
+        bins.add(static_cast<int64>(deadlines.getBinCount(b)));
+    }
+    deadline->setProperty("histogram", bins);
+    o->setProperty("deadlines", var(deadline.get()));
+
+    DynamicObject::Ptr mem = new DynamicObject();
+    mem->setProperty("instance", memory.getInstanceTotal());
+    for (int i = 0; i < MemoryFootprint::nInstance; ++i) {
+        const MemoryFootprint::eInstance item = static_cast<MemoryFootprint::eInstance>(i);
+        mem->setProperty(toMetricName(MemoryFootprint::getName(item)), memory.instance[i]);
+    }
+    for (int s = 0; s < MemoryFootprint::nShared; ++s) {
+        const MemoryFootprint::eShared item = static_cast<MemoryFootprint::eShared>(s);
+        mem->setProperty(toMetricName(MemoryFootprint::getName(item)), memory.shared[s]);
+    }
+    o->setProperty("memory", var(mem.get()));
+
+    return JSON::toString(var(o.get()), true) + "\n";
+}
+
+String MetricsReporter::formatPlainText() const
+{
+    const CpuStats& stats = processor->telemetry.cpu.getStats();
+    const DeadlineMonitor& deadlines = processor->telemetry.deadlines;
+    const MemoryFootprint memory = processor->telemetry.getMemoryFootprint();
+
+    const String prefix = "synister." + toMetricName(machine) + ".";
+    const String time = " " + String(getUnixSeconds()) + "\n";
+    String lines;
+    const auto add = [&](const String& name, const String& value) { lines << prefix << name << " " << value << time; };
+
+    add("cpu.blocks", String(stats.numBlocks));
+    for (int s = 0; s < CpuStats::numStages; ++s) {
+        const String stage = "cpu." + toMetricName(CpuMeter::getStageName(static_cast<eCpuStage>(s))) + ".";
+        add(stage + "mean", String(stats.mean[s], 2));
+        add(stage + "p99", String(stats.p99[s], 2));
+        add(stage + "max", String(stats.max[s], 2));
+    }
+
+    add("voices.mean_active", String(stats.meanActiveVoices, 2));
+    add("voices.percent_per_voice", String(stats.voicePercent, 3));
+    add("voices.polyphony", String(roundToInt(processor->polyphony.get())));
+
+    add("deadlines.blocks", String(deadlines.getNumBlocks()));
+    add("deadlines.incidents", String(deadlines.getNumIncidents()));
+    add("deadlines.worst_load", String(deadlines.getWorstLoad(), 3));
+    for (int b = 0; b < DeadlineMonitor::numBins; ++b) {
+        add("deadlines.bin_" + String(b * DeadlineMonitor::binPercent), String(deadlines.getBinCount(b)));
+    }
+
+    add("memory.instance", String(memory.getInstanceTotal()));
+    for (int i = 0; i < MemoryFootprint::nInstance; ++i) {
+        const MemoryFootprint::eInstance item = static_cast<MemoryFootprint::eInstance>(i);
+        add("memory." + toMetricName(MemoryFootprint::getName(item)), String(memory.instance[i]));
+    }
+    for (int s = 0; s < MemoryFootprint::nShared; ++s) {
+        const MemoryFootprint::eShared item = static_cast<MemoryFootprint::eShared>(s);
+        add("memory." + toMetricName(MemoryFootprint::getName(item)), String(memory.shared[s]));
+    }
+    return lines;
+}
@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    MetricsReporter.h
+    Created: 16 Oct 2026 2:41:18pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef METRICSREPORTER_H_INCLUDED
+#define METRICSREPORTER_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+class PluginAudioProcessor;
+
+//! MetricsReporter: sends the cpu statistics, the deadline histogram and the memory of the standalone to a collector
+/*! Switched on with "--metrics host:port", for installations that watch a number of machines
+    from one place. Every interval a timer of the message thread reads what the info panel
+    shows, the cpu meter of the last window, the mean of the active voices, the histogram of the
+    DeadlineMonitor and the memory footprint, and formats it as one JSON object, or as lines of
+    "synister.<machine>.<name> <value> <unix time>" with "--metrics-plain". A thread of the
+    reporter sends it, by default as a udp datagram, with "--metrics-tcp" over a tcp connection
+    that is opened again when it breaks. A report that is not sent yet is replaced by the next
+    one, so a slow collector never delays the ui or the audio.
+*/
+class MetricsReporter : private Timer, private Thread {
+public:
+    struct Options {
+        String host;            //!< empty if nothing is reported
+        int port = 0;
+        bool plainText = false; //!< graphite lines instead of JSON
+        bool tcp = false;
+        int intervalSeconds = 10;
+    };
+
+    MetricsReporter();
+    ~MetricsReporter();
+
+    //! \brief the options of the command line, no host if "--metrics" is not given or its port is missing
+    static Options parseCommandLine(const StringArray& args);
+
+    //! \brief starts reporting, stops first if it is running, message thread
+    void start(const Options& o);
+    void stop();
+    bool isReporting() const { return isTimerRunning(); }
+
+    //! \brief the processor to report, nullptr while it is replaced, message thread
+    void setProcessor(PluginAudioProcessor* p);
+
+private:
+    void timerCallback() override;
+    void run() override;
+
+    String formatJson() const;
+    String formatPlainText() const;
+    //! \brief false if the report could not be sent, the tcp connection is closed then
+    bool send(const String& report);
+
+    Options options;
+    PluginAudioProcessor* processor;
+    bool readingCpu;            //!< registered as reader of the cpu meter of the processor
+    String machine;
+    int64 sequence;
+
+    CriticalSection pendingLock;
+    String pending;             //!< the report the thread sends next, empty once it is sent
+
+    ScopedPointer<DatagramSocket> udp;      //!< sender thread
+    ScopedPointer<StreamingSocket> stream;  //!< sender thread
+
+    JUCE_DECLARE_NON_COPYABLE(MetricsReporter)
+};
+
+#endif  // METRICSREPORTER_H_INCLUDED
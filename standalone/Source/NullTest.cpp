@@ -0,0 +1,230 @@
+/*
+  ==============================================================================
+
+    NullTest.cpp
+    Created: 15 Oct 2026 7:21:36am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "NullTest.h"
+
+namespace {
+    const int compareBlockSize = 4096;
+
+    float toDb(double gain)
+    {
+        return gain > 0. ? static_cast<float>(20. * std::log10(gain)) : -200.f;
+    }
+
+    String getArgument(const StringArray& args, const String& name)
+    {
+        const int index = args.indexOf(name);
+        return index >= 0 && index + 1 < args.size() ? args[index + 1].unquoted() : String();
+    }
+}
+
+NullTest::NullTest(const Options& o)
+    : options(o)
+{
+}
+
+bool NullTest::runFromCommandLine(const StringArray& args, String& error)
+{
+    const int index = args.indexOf("--null-test");
+    if (index < 0) {
+        return false;
+    }
+    if (index + 2 >= args.size()) {
+        error = "usage: --null-test <patch dir> <reference dir> [--update] [--rms-tolerance <dB>] "
+                "[--peak-tolerance <dB>] [--diff <dir>] [--rate <hz>]";
+        return true;
+    }
+
+    const File cwd = File::getCurrentWorkingDirectory();
+    Options o;
+    o.patchDirectory = cwd.getChildFile(args[index + 1].unquoted());
+    o.referenceDirectory = cwd.getChildFile(args[index + 2].unquoted());
+    o.update = args.contains("--update");
+    const String rms = getArgument(args, "--rms-tolerance");
+    if (rms.isNotEmpty()) {
+        o.rmsToleranceDb = rms.getFloatValue();
+    }
+    const String peak = getArgument(args, "--peak-tolerance");
+    if (peak.isNotEmpty()) {
+        o.peakToleranceDb = peak.getFloatValue();
+    }
+    const String diff = getArgument(args, "--diff");
+    if (diff.isNotEmpty()) {
+        o.diffDirectory = cwd.getChildFile(diff);
+    }
+    o.render = OfflineRenderer::parseOptions(args);
+    // float references, so the tolerances are not hidden by the quantisation of the file
+    o.render.bitDepth = 32;
+
+    NullTest test(o);
+    error = test.run();
+    return true;
+}
+
+MidiMessageSequence NullTest::createSequence()
+{
+    MidiMessageSequence s;
+    double t = 0.;
+    // single notes over the keyboard at rising velocity
+    const int notes[] = { 24, 36, 48, 60, 72, 84, 96 };
+    for (int i = 0; i < 7; ++i) {
+        s.addEvent(MidiMessage::noteOn(1, notes[i], static_cast<uint8>(40 + i * 14)), t);
+        s.addEvent(MidiMessage::noteOff(1, notes[i]), t + 0.4);
+        t += 0.5;
+    }
+    // a chord, held over the release of the last note
+    const int chord[] = { 48, 55, 60, 64, 67 };
+    for (int n : chord) {
+        s.addEvent(MidiMessage::noteOn(1, n, static_cast<uint8>(100)), t);
+        s.addEvent(MidiMessage::noteOff(1, n), t + 1.5);
+    }
+    t += 2.;
+    // fast repeats of one note, retriggering its envelopes
+    for (int i = 0; i < 16; ++i) {
+        s.addEvent(MidiMessage::noteOn(1, 60, static_cast<uint8>(127)), t);
+        s.addEvent(MidiMessage::noteOff(1, 60), t + 0.05);
+        t += 0.0625;
+    }
+    s.updateMatchedPairs();
+    return s;
+}
+
+String NullTest::run()
+{
+    if (!options.patchDirectory.isDirectory()) {
+        return "no directory: " + options.patchDirectory.getFullPathName();
+    }
+    Array<File> patches;
+    options.patchDirectory.findChildFiles(patches, File::findFiles, false, "*.xml");
+    if (patches.size() == 0) {
+        return "no patches in " + options.patchDirectory.getFullPathName();
+    }
+    const Result created = options.referenceDirectory.createDirectory();
+    if (created.failed()) {
+        return created.getErrorMessage();
+    }
+    const bool writeDiffs = options.diffDirectory != File::nonexistent && options.diffDirectory.createDirectory().wasOk();
+
+    OfflineRenderer renderer(options.render);
+    renderer.setSequence(createSequence());
+
+    StringArray failures;
+    StringArray report;
+    for (const File& patch : patches) {
+        const String name = patch.getFileNameWithoutExtension();
+        const File reference = options.referenceDirectory.getChildFile(File::createLegalFileName(name) + ".wav");
+
+        String error = renderer.loadPatch(patch);
+        if (error.isNotEmpty()) {
+            failures.add(name + ": " + error);
+            continue;
+        }
+        if (options.update) {
+            error = renderer.render(reference);
+            if (error.isNotEmpty()) {
+                failures.add(name + ": " + error);
+            }
+            continue;
+        }
+        if (!reference.existsAsFile()) {
+            failures.add(name + ": no reference, render it with --update");
+            continue;
+        }
+
+        TemporaryFile rendered(reference);
+        error = renderer.render(rendered.getFile());
+        if (error.isNotEmpty()) {
+            failures.add(name + ": " + error);
+            continue;
+        }
+        const File diff = writeDiffs ? options.diffDirectory.getChildFile(reference.getFileName()) : File::nonexistent;
+        const Comparison c = compare(reference, rendered.getFile(), diff);
+
+        String line = name + ": rms " + String(c.rmsDb, 1) + " dB, peak " + String(c.peakDb, 1)
+                      + " dB at sample " + String(c.peakPosition);
+        if (c.error.isNotEmpty()) {
+            line = name + ": " + c.error;
+            failures.add(line);
+        } else if (c.rmsDb > options.rmsToleranceDb || c.peakDb > options.peakToleranceDb) {
+            failures.add(line);
+        }
+        report.add(line);
+    }
+
+    if (writeDiffs) {
+        report.insert(0, "tolerances: rms " + String(options.rmsToleranceDb, 1) + " dB, peak " + String(options.peakToleranceDb, 1) + " dB");
+        options.diffDirectory.getChildFile("report.txt").replaceWithText(report.joinIntoString("\n") + "\n");
+    }
+    return failures.joinIntoString("\n");
+}
+
+NullTest::Comparison NullTest::compare(const File& reference, const File& rendered, const File& diff)
+{
+    Comparison c;
+    AudioFormatManager formats;
+    formats.registerBasicFormats();
+    ScopedPointer<AudioFormatReader> a = formats.createReaderFor(reference);
+    ScopedPointer<AudioFormatReader> b = formats.createReaderFor(rendered);
+    if (a == nullptr || b == nullptr) {
+        c.error = "cannot read the files";
+        return c;
+    }
+    if (a->numChannels != b->numChannels || a->sampleRate != b->sampleRate) {
+        c.error = "channels or sample rate differ from the reference";
+        return c;
+    }
+    if (a->lengthInSamples != b->lengthInSamples) {
+        c.error = "length " + String(b->lengthInSamples) + " instead of " + String(a->lengthInSamples);
+        return c;
+    }
+
+    ScopedPointer<AudioFormatWriter> writer;
+    if (diff != File::nonexistent) {
+        diff.deleteFile();
+        ScopedPointer<FileOutputStream> stream = diff.createOutputStream();
+        WavAudioFormat wav;
+        if (stream != nullptr) {
+            writer = wav.createWriterFor(stream, a->sampleRate, a->numChannels, 32, StringPairArray(), 0);
+            if (writer != nullptr) {
+                stream.release();
+            }
+        }
+    }
+
+    const int numChannels = static_cast<int>(a->numChannels);
+    AudioSampleBuffer bufA(numChannels, compareBlockSize);
+    AudioSampleBuffer bufB(numChannels, compareBlockSize);
+    double sumSquares = 0.;
+    float peak = 0.f;
+    for (int64 pos = 0; pos < a->lengthInSamples; pos += compareBlockSize) {
+        const int n = static_cast<int>(jmin(static_cast<int64>(compareBlockSize), a->lengthInSamples - pos));
+        a->read(&bufA, 0, n, pos, true, true);
+        b->read(&bufB, 0, n, pos, true, true);
+        for (int ch = 0; ch < numChannels; ++ch) {
+            float* d = bufB.getWritePointer(ch);
+            FloatVectorOperations::subtract(d, bufA.getReadPointer(ch), n);
+            for (int i = 0; i < n; ++i) {
+                sumSquares += static_cast<double>(d[i]) * d[i];
+                if (std::abs(d[i]) > peak) {
+                    peak = std::abs(d[i]);
+                    c.peakPosition = pos + i;
+                }
+            }
+        }
+        if (writer != nullptr) {
+            writer->writeFromAudioSampleBuffer(bufB, 0, n);
+        }
+    }
+
+    c.length = a->lengthInSamples;
+    c.rmsDb = toDb(std::sqrt(sumSquares / jmax(static_cast<int64>(1), c.length * numChannels)));
+    c.peakDb = toDb(peak);
+    return c;
+}
@@ -0,0 +1,64 @@
+/*
+  ==============================================================================
+
+    NullTest.h
+    Created: 15 Oct 2026 7:21:36am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef NULLTEST_H_INCLUDED
+#define NULLTEST_H_INCLUDED
+
+#include "OfflineRenderer.h"
+
+//! NullTest: renders every patch of a directory with a fixed sequence and compares it to reference files
+/*! The offline render is deterministic: the voices, lfos and the sequencer start from fixed
+    seeds in prepareToPlay and the cpu voice limit is off for non-realtime rendering. So a change
+    of the engine that should not change the sound can be checked by subtracting the new render
+    from a reference render of the same patch. A patch fails if the rms or the peak of the
+    difference is above its tolerance, in dB full scale. With update, the references are
+    written instead.
+*/
+class NullTest {
+public:
+    struct Options {
+        File patchDirectory;
+        File referenceDirectory;
+        File diffDirectory;             //!< difference signals and report.txt, none if it does not exist
+        bool update = false;            //!< write the references instead of comparing
+        float rmsToleranceDb = -100.f;
+        float peakToleranceDb = -80.f;
+        OfflineRenderer::Options render;
+    };
+
+    explicit NullTest(const Options& o);
+
+    //! \brief renders and compares all patches, returns a message for every failed one or an empty string
+    String run();
+
+    //! \brief parses "--null-test <patch dir> <reference dir> [--update]" and runs, false if the arguments are no null test
+    static bool runFromCommandLine(const StringArray& args, String& error);
+
+    //! \brief the notes every patch plays: single notes over the keyboard, a chord and a fast repeat
+    static MidiMessageSequence createSequence();
+
+private:
+    struct Comparison {
+        String error;           //!< the files could not be compared
+        int64 length = 0;
+        float rmsDb = -200.f;
+        float peakDb = -200.f;
+        int64 peakPosition = 0;
+    };
+
+    //! \brief compares the files sample by sample, writes the difference if diff is not empty
+    static Comparison compare(const File& reference, const File& rendered, const File& diff);
+
+    Options options;
+
+    JUCE_DECLARE_NON_COPYABLE(NullTest)
+};
+
+#endif  // NULLTEST_H_INCLUDED
@@ -0,0 +1,329 @@
+/*
+  ==============================================================================
+
+    OfflineRenderer.cpp
+    Created: 15 Oct 2026 6:41:27am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "OfflineRenderer.h"
+#include "PluginProcessor.h"
+
+AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+namespace {
+    //! samples the ThreadedWriter keeps in flight before render() waits for it
+    const int writerBufferSamples = 1 << 17;
+}
+
+OfflineRenderer::OfflineRenderer(const Options& o)
+    : options(o)
+    , writerThread("Offline Render Writer")
+    , timeSigNumerator(4)
+    , timeSigDenominator(4)
+    , blockStart(0)
+{
+    processor = dynamic_cast<PluginAudioProcessor*>(createPluginFilter());
+    setSequence(MidiMessageSequence());
+    writerThread.startThread(3);
+}
+
+OfflineRenderer::~OfflineRenderer()
+{
+    writerThread.stopThread(5000);
+    processor = nullptr;
+}
+
+OfflineRenderer::Options OfflineRenderer::parseOptions(const StringArray& args)
+{
+    Options o;
+    const int rate = args.indexOf("--rate");
+    if (rate >= 0 && rate + 1 < args.size()) {
+        o.sampleRate = jlimit(22050., 192000., args[rate + 1].getDoubleValue());
+    }
+    const int tail = args.indexOf("--tail");
+    if (tail >= 0 && tail + 1 < args.size()) {
+        o.tailSeconds = jmax(0., args[tail + 1].getDoubleValue());
+    }
+    const int bits = args.indexOf("--bits");
+    if (bits >= 0 && bits + 1 < args.size()) {
+        o.bitDepth = args[bits + 1].getIntValue();
+    }
+    return o;
+}
+
+bool OfflineRenderer::runFromCommandLine(const StringArray& args, String& error)
+{
+    const int index = args.indexOf("--render");
+    if (index < 0) {
+        return false;
+    }
+    if (index + 3 >= args.size()) {
+        error = "usage: --render <patch.xml> <song.mid> <out.wav|out.flac> [--rate <hz>] [--tail <seconds>] [--bits <16|24>]";
+        return true;
+    }
+
+    const File cwd = File::getCurrentWorkingDirectory();
+    OfflineRenderer renderer(parseOptions(args));
+    error = renderer.loadMidi(cwd.getChildFile(args[index + 2].unquoted()));
+    if (error.isEmpty()) {
+        error = renderer.loadPatch(cwd.getChildFile(args[index + 1].unquoted()));
+    }
+    if (error.isEmpty()) {
+        error = renderer.render(cwd.getChildFile(args[index + 3].unquoted()));
+    }
+    return true;
+}
+
+String OfflineRenderer::render(const File& output)
+{
+    Array<File> outputs;
+    outputs.add(output);
+    return render(outputs);
+}
+
+String OfflineRenderer::render(const Array<File>& outputs)
+{
+    if (processor == nullptr) {
+        return "the processor could not be created";
+    }
+    jassert(outputs.size() == getNumLayers());
+
+    // the writers
+    AudioFormatManager formats;
+    formats.registerBasicFormats();
+    OwnedArray<AudioFormatWriter::ThreadedWriter> writers;
+    for (const File& output : outputs) {
+        AudioFormat* format = formats.findFormatForFileExtension(output.getFileExtension());
+        if (format == nullptr) {
+            return "unknown output format: " + output.getFileName();
+        }
+        output.deleteFile();
+        ScopedPointer<FileOutputStream> stream = output.createOutputStream();
+        if (stream == nullptr) {
+            return "cannot write " + output.getFullPathName();
+        }
+        AudioFormatWriter* writer = format->createWriterFor(stream, options.sampleRate, 2, options.bitDepth, StringPairArray(), 0);
+        if (writer == nullptr) {
+            return "the format does not support " + String(options.bitDepth) + " bit at " + String(options.sampleRate) + " Hz";
+        }
+        stream.release();   // owned by the writer now
+        writers.add(new AudioFormatWriter::ThreadedWriter(writer, writerThread, writerBufferSamples));
+    }
+
+    // prepared for every render, so no voice, echo or lfo phase is left from the last one
+    const int blockSize = options.blockSize;
+    const int numLayers = getNumLayers();
+    std::array<PluginAudioProcessor*, PluginAudioProcessor::maxBatchSize> processors;
+    OwnedArray<AudioSampleBuffer> buffers;
+    OwnedArray<MidiBuffer> midi;
+    double endSeconds = 0.;
+    for (int l = 0; l < numLayers; ++l) {
+        processors[l] = l == 0 ? processor.get() : layers[l - 1];
+        processors[l]->setPlayConfigDetails(0, 2, options.sampleRate, blockSize);
+        processors[l]->setNonRealtime(true);
+        processors[l]->setPlayHead(this);
+        processors[l]->prepareToPlay(options.sampleRate, blockSize);
+        buffers.add(new AudioSampleBuffer(2, blockSize));
+        midi.add(new MidiBuffer());
+        const MidiMessageSequence& sequence = getLayerEvents(l);
+        endSeconds = jmax(endSeconds, sequence.getNumEvents() > 0 ? sequence.getEndTime() : 0.);
+    }
+    endSeconds += options.tailSeconds;
+    const int64 endSample = static_cast<int64>(std::ceil(endSeconds * options.sampleRate));
+    std::vector<int> nextEvent(static_cast<size_t>(numLayers), 0);
+
+    for (blockStart = 0; blockStart < endSample; blockStart += blockSize) {
+        const int numSamples = static_cast<int>(jmin(static_cast<int64>(blockSize), endSample - blockStart));
+        const double blockEnd = static_cast<double>(blockStart + numSamples) / options.sampleRate;
+
+        for (int l = 0; l < numLayers; ++l) {
+            const MidiMessageSequence& sequence = getLayerEvents(l);
+            int& next = nextEvent[static_cast<size_t>(l)];
+            midi[l]->clear();
+            for (; next < sequence.getNumEvents(); ++next) {
+                const MidiMessage& m = sequence.getEventPointer(next)->message;
+                if (m.getTimeStamp() >= blockEnd) {
+                    break;
+                }
+                if (m.isMetaEvent()) {
+                    continue;
+                }
+                const int pos = static_cast<int>(m.getTimeStamp() * options.sampleRate - static_cast<double>(blockStart));
+                midi[l]->addEvent(m, jlimit(0, numSamples - 1, pos));
+            }
+            // the last block is rendered at full size, only its start is written
+            buffers[l]->clear();
+        }
+
+        if (numLayers == 1) {
+            processor->processBlock(*buffers[0], *midi[0]);
+        } else {
+            PluginAudioProcessor::processBlockBatch(processors.data(), buffers.getRawDataPointer(), midi.getRawDataPointer(), numLayers);
+        }
+
+        // the writer thread drains the fifo, wait for it instead of dropping samples
+        for (int l = 0; l < numLayers; ++l) {
+            while (!writers[l]->write(buffers[l]->getArrayOfReadPointers(), numSamples)) {
+                Thread::sleep(1);
+            }
+        }
+    }
+
+    for (int l = 0; l < numLayers; ++l) {
+        processors[l]->releaseResources();
+        processors[l]->setPlayHead(nullptr);
+    }
+    // flushes the remaining samples and deletes the writers
+    writers.clear();
+    return String();
+}
+
+void OfflineRenderer::setNumLayers(int numLayers)
+{
+    numLayers = jlimit(1, PluginAudioProcessor::maxBatchSize, numLayers);
+    while (layers.size() < numLayers - 1) {
+        layers.add(dynamic_cast<PluginAudioProcessor*>(createPluginFilter()));
+    }
+    layers.removeRange(numLayers - 1, layers.size());
+    layerEvents.resize(static_cast<size_t>(numLayers - 1));
+}
+
+void OfflineRenderer::setLayerSequence(int layer, const MidiMessageSequence& sequence)
+{
+    jassert(isPositiveAndBelow(layer, getNumLayers()));
+    if (layer == 0) {
+        events = sequence;
+        events.updateMatchedPairs();
+    } else {
+        layerEvents[static_cast<size_t>(layer - 1)] = sequence;
+        layerEvents[static_cast<size_t>(layer - 1)].updateMatchedPairs();
+    }
+}
+
+String OfflineRenderer::loadPatch(const File& file)
+{
+    if (processor == nullptr) {
+        return "the processor could not be created";
+    }
+    if (!file.existsAsFile()) {
+        return "patch not found: " + file.getFullPathName();
+    }
+    ScopedPointer<XmlElement> patch = XmlDocument::parse(file);
+    if (patch == nullptr || patch->getTagName() != "patch") {
+        return "no patch: " + file.getFullPathName();
+    }
+
+    applyPatch(*processor, *patch);
+    for (PluginAudioProcessor* layer : layers) {
+        applyPatch(*layer, *patch);
+    }
+    return String();
+}
+
+void OfflineRenderer::applyPatch(PluginAudioProcessor& processor, const XmlElement& patch)
+{
+    // defaults first like the factory bank does, so the last patch of a batch does not leak into this one
+    processor.applyPatch(processor.getDefaultPatch());
+
+    // applied directly, nothing is playing between two renders
+    PatchValues values;
+    values.values.resize(processor.serializeParams.size());
+    processor.parsePatch(patch, eSerializationParams::eAll, values);
+    processor.applyPatch(values);
+}
+
+String OfflineRenderer::loadMidi(const File& midi)
+{
+    FileInputStream in(midi);
+    MidiFile file;
+    if (!in.openedOk() || !file.readFrom(in)) {
+        return "cannot read midi file: " + midi.getFullPathName();
+    }
+    file.convertTimestampTicksToSeconds();
+
+    events.clear();
+    for (int t = 0; t < file.getNumTracks(); ++t) {
+        events.addSequence(*file.getTrack(t), 0., 0., 1.e9);
+    }
+    events.updateMatchedPairs();
+
+    // tempo map, 120 bpm until the first tempo event
+    MidiMessageSequence tempoEvents;
+    file.findAllTempoEvents(tempoEvents);
+    tempoMap.clear();
+    TempoSegment current = { 0., 0., 0.5 };
+    for (int i = 0; i < tempoEvents.getNumEvents(); ++i) {
+        const MidiMessage& m = tempoEvents.getEventPointer(i)->message;
+        const double at = m.getTimeStamp();
+        TempoSegment next = { at, current.startPpq + (at - current.startSeconds) / current.secondsPerQuarter, m.getTempoSecondsPerQuarterNote() };
+        if (next.secondsPerQuarter <= 0.) {
+            continue;
+        }
+        if (at <= current.startSeconds) {
+            next.startPpq = current.startPpq;
+        } else {
+            tempoMap.push_back(current);
+        }
+        current = next;
+    }
+    tempoMap.push_back(current);
+
+    timeSigNumerator = 4;
+    timeSigDenominator = 4;
+    MidiMessageSequence timeSigEvents;
+    file.findAllTimeSigEvents(timeSigEvents);
+    if (timeSigEvents.getNumEvents() > 0) {
+        timeSigEvents.getEventPointer(0)->message.getTimeSignatureInfo(timeSigNumerator, timeSigDenominator);
+    }
+    return String();
+}
+
+void OfflineRenderer::setSequence(const MidiMessageSequence& sequence, double bpm)
+{
+    events = sequence;
+    events.updateMatchedPairs();
+    tempoMap.clear();
+    const TempoSegment constant = { 0., 0., 60. / jmax(1., bpm) };
+    tempoMap.push_back(constant);
+    timeSigNumerator = 4;
+    timeSigDenominator = 4;
+}
+
+const OfflineRenderer::TempoSegment& OfflineRenderer::getSegment(double seconds) const
+{
+    size_t i = tempoMap.size() - 1;
+    while (i > 0 && tempoMap[i].startSeconds > seconds) {
+        --i;
+    }
+    return tempoMap[i];
+}
+
+double OfflineRenderer::getPpq(double seconds) const
+{
+    const TempoSegment& s = getSegment(seconds);
+    return s.startPpq + (seconds - s.startSeconds) / s.secondsPerQuarter;
+}
+
+double OfflineRenderer::getBpm(double seconds) const
+{
+    return 60. / getSegment(seconds).secondsPerQuarter;
+}
+
+bool OfflineRenderer::getCurrentPosition(CurrentPositionInfo& result)
+{
+    result.resetToDefault();
+    const double seconds = static_cast<double>(blockStart) / options.sampleRate;
+    result.bpm = getBpm(seconds);
+    result.timeSigNumerator = timeSigNumerator;
+    result.timeSigDenominator = timeSigDenominator;
+    result.timeInSamples = blockStart;
+    result.timeInSeconds = seconds;
+    result.ppqPosition = getPpq(seconds);
+    const double ppqPerBar = timeSigNumerator * 4. / jmax(1, timeSigDenominator);
+    result.ppqPositionOfLastBarStart = std::floor(result.ppqPosition / ppqPerBar) * ppqPerBar;
+    result.isPlaying = true;
+    return true;
+}
@@ -0,0 +1,103 @@
+/*
+  ==============================================================================
+
+    OfflineRenderer.h
+    Created: 15 Oct 2026 6:41:27am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef OFFLINERENDERER_H_INCLUDED
+#define OFFLINERENDERER_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include <vector>
+
+class PluginAudioProcessor;
+
+//! OfflineRenderer: renders a midi sequence with a patch into an audio file, without editor or audio device
+/*! The processor runs non-realtime and as fast as the cpu allows. The tempo map of the midi
+    file drives a simulated play head, so tempo synced lfos, delays and the sequencer follow the
+    song like in a host. The blocks are written by a ThreadedWriter on its own thread, the format
+    follows the extension of the output file (wav or flac). A renderer can render any number of
+    files one after the other, every render starts from a freshly prepared processor.
+*/
+class OfflineRenderer : public AudioPlayHead {
+public:
+    struct Options {
+        double sampleRate = 48000.;
+        int blockSize = 512;
+        double tailSeconds = 2.;    //!< rendered after the last event, for releases and echoes
+        int bitDepth = 24;
+    };
+
+    explicit OfflineRenderer(const Options& o);
+    ~OfflineRenderer();
+
+    //! \brief sets every param to the patch, the ones it leaves out to their default, returns an error message or an empty string
+    String loadPatch(const File& patch);
+    //! \brief reads all tracks and the tempo map of a midi file, returns an error message or an empty string
+    String loadMidi(const File& midi);
+    //! \brief events with timestamps in seconds at a constant tempo, instead of a midi file
+    void setSequence(const MidiMessageSequence& sequence, double bpm = 120.);
+
+    //! \brief renders the sequence into the file, returns an error message or an empty string
+    String render(const File& output);
+
+    //! \name layers
+    /*! Several sequences with the same patch, e.g. the velocities of a note, rendered into a file
+        each by processors of their own. Their blocks are rendered in lock-step with
+        PluginAudioProcessor::processBlockBatch(), so the voices of all layers share the SIMD lanes.
+        The first layer plays the sequence of setSequence() or loadMidi() and sets the tempo.
+    */
+    ///@{
+    //! \brief up to PluginAudioProcessor::maxBatchSize, before loadPatch()
+    void setNumLayers(int numLayers);
+    int getNumLayers() const { return layers.size() + 1; }
+    //! \brief events with timestamps in seconds, at the tempo of the first layer
+    void setLayerSequence(int layer, const MidiMessageSequence& sequence);
+    //! \brief renders every layer into its file, outputs[layer], returns an error message or an empty string
+    String render(const Array<File>& outputs);
+    ///@}
+
+    //! play head of the current block
+    bool getCurrentPosition(CurrentPositionInfo& result) override;
+
+    //! \brief parses "--render <patch.xml> <song.mid> <out.wav>" and renders, false if the arguments are no render call
+    static bool runFromCommandLine(const StringArray& args, String& error);
+    //! \brief rate, tail and bit depth options of the command line
+    static Options parseOptions(const StringArray& args);
+
+private:
+    struct TempoSegment {
+        double startSeconds;
+        double startPpq;
+        double secondsPerQuarter;
+    };
+
+    //! \brief quarter notes since the start of the song at a time
+    double getPpq(double seconds) const;
+    double getBpm(double seconds) const;
+    const TempoSegment& getSegment(double seconds) const;
+    const MidiMessageSequence& getLayerEvents(int layer) const { return layer == 0 ? events : layerEvents[static_cast<size_t>(layer - 1)]; }
+    //! \brief the patch, the params it leaves out get their default
+    static void applyPatch(PluginAudioProcessor& processor, const XmlElement& patch);
+
+    Options options;
+    ScopedPointer<PluginAudioProcessor> processor;
+    OwnedArray<PluginAudioProcessor> layers;        //!< of the layers after the first one
+    std::vector<MidiMessageSequence> layerEvents;   //!< of the layers after the first one
+    TimeSliceThread writerThread;
+
+    MidiMessageSequence events;     //!< all tracks, timestamps in seconds
+    std::vector<TempoSegment> tempoMap;
+    int timeSigNumerator;
+    int timeSigDenominator;
+
+    int64 blockStart;               //!< in samples, position of the block being rendered
+
+    JUCE_DECLARE_NON_COPYABLE(OfflineRenderer)
+};
+
+#endif  // OFFLINERENDERER_H_INCLUDED
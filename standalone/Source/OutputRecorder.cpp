@@ -0,0 +1,98 @@
+/*
+  ==============================================================================
+
+    OutputRecorder.cpp
+    Created: 15 Oct 2026 8:52:03pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "OutputRecorder.h"
+
+OutputRecorder::OutputRecorder()
+    : thread("synister recorder")
+    , recording(false)
+    , numChannels(0)
+    , sampleRate(0.)
+    , recordedSamples(0)
+    , droppedSamples(0)
+{
+}
+
+OutputRecorder::~OutputRecorder()
+{
+    stop();
+}
+
+Result OutputRecorder::start(const File& f, double rate, int channels)
+{
+    stop();
+    if (rate <= 0. || channels < 1) {
+        return Result::fail("no audio device is running");
+    }
+    if (!f.getParentDirectory().createDirectory()) {
+        return Result::fail("The folder could not be created: " + f.getParentDirectory().getFullPathName());
+    }
+    // a stream to an existing file appends
+    f.deleteFile();
+    ScopedPointer<FileOutputStream> stream(new FileOutputStream(f, fileBufferBytes));
+    if (stream->failedToOpen()) {
+        return Result::fail("The file could not be opened: " + f.getFullPathName());
+    }
+    WavAudioFormat wav;
+    AudioFormatWriter* w = wav.createWriterFor(stream, rate, static_cast<unsigned int>(channels), bitsPerSample, StringPairArray(), 0);
+    if (w == nullptr) {
+        return Result::fail("No wav writer for " + String(channels) + " channels at " + String(rate) + " Hz");
+    }
+    // the writer owns the stream now
+    stream.release();
+
+    thread.startThread(6);
+    ScopedPointer<AudioFormatWriter::ThreadedWriter> threaded(new AudioFormatWriter::ThreadedWriter(w, thread, bufferSeconds * roundToInt(rate)));
+    threaded->setFlushInterval(flushSeconds * roundToInt(rate));
+
+    file = f;
+    sampleRate = rate;
+    numChannels = channels;
+    recordedSamples = 0;
+    droppedSamples = 0;
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        writer = threaded.release();
+    }
+    recording = true;
+    return Result::ok();
+}
+
+void OutputRecorder::stop()
+{
+    ScopedPointer<AudioFormatWriter::ThreadedWriter> old;
+    {
+        const SpinLock::ScopedLockType sl(lock);
+        old = writer.release();
+    }
+    recording = false;
+    // writes the rest of the fifo and the header, outside the lock
+    old = nullptr;
+    thread.stopThread(2000);
+}
+
+void OutputRecorder::push(const float* const* data, int channels, int numSamples)
+{
+    const GenericScopedTryLock<SpinLock> sl(lock);
+    if (!sl.isLocked() || writer == nullptr) {
+        return;
+    }
+    if (channels < numChannels || !writer->write(data, numSamples)) {
+        droppedSamples += numSamples;
+        return;
+    }
+    recordedSamples += numSamples;
+}
+
+File OutputRecorder::createRecordingFile()
+{
+    const File folder = File::getSpecialLocation(File::userMusicDirectory).getChildFile("Synister Recordings");
+    return folder.getNonexistentChildFile("synister " + Time::getCurrentTime().formatted("%Y-%m-%d %H-%M-%S"), ".wav", false);
+}
@@ -0,0 +1,70 @@
+/*
+  ==============================================================================
+
+    OutputRecorder.h
+    Created: 15 Oct 2026 8:52:03pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef OUTPUTRECORDER_H_INCLUDED
+#define OUTPUTRECORDER_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include <atomic>
+
+//! OutputRecorder: writes the output of the standalone to a wav file in the background
+/*! The audio thread copies every block into the fifo of a ThreadedWriter and never touches the
+    file. A thread of the recorder empties the fifo into a file stream with a large buffer, so
+    the disk sees writes of fileBufferBytes in sequence. The header is rewritten every
+    flushSeconds, a crash leaves a file that plays up to the last flush. The audio thread only
+    tries the lock of the writer, which the message thread holds to swap it at the start and
+    the end of a recording, so a block can be missed there but the audio thread never waits.
+*/
+class OutputRecorder {
+public:
+    OutputRecorder();
+    ~OutputRecorder();
+
+    //! \brief message thread: records into a new file, stops a running recording first
+    Result start(const File& file, double sampleRate, int numChannels);
+    //! \brief message thread: writes what is left in the fifo and closes the file
+    void stop();
+
+    bool isRecording() const { return recording; }
+    //! \brief the file of the running or the last recording
+    const File& getFile() const { return file; }
+    double getSampleRate() const { return sampleRate; }
+    //! \brief s recorded since start()
+    double getSecondsRecorded() const { return sampleRate > 0. ? recordedSamples.load() / sampleRate : 0.; }
+    //! \brief samples the fifo had no room for, the disk was too slow
+    int64 getDroppedSamples() const { return droppedSamples; }
+
+    //! \brief audio thread: copies a block of the output into the fifo
+    void push(const float* const* data, int numChannels, int numSamples);
+
+    //! \brief a new file with the time of day in the music folder of the user
+    static File createRecordingFile();
+
+    static const int bitsPerSample = 24;
+    static const int bufferSeconds = 4;             //!< of the fifo, how long the disk may stall
+    static const int flushSeconds = 10;
+    static const int fileBufferBytes = 1 << 20;
+
+private:
+    TimeSliceThread thread;
+    SpinLock lock;      //!< of writer
+    ScopedPointer<AudioFormatWriter::ThreadedWriter> writer;
+    std::atomic<bool> recording;
+    int numChannels;
+    double sampleRate;
+    File file;
+
+    std::atomic<int64> recordedSamples;
+    std::atomic<int64> droppedSamples;
+
+    JUCE_DECLARE_NON_COPYABLE(OutputRecorder)
+};
+
+#endif  // OUTPUTRECORDER_H_INCLUDED
@@ -0,0 +1,294 @@
+/*
+  ==============================================================================
+
+    PaintBenchmark.cpp
+    Created: 17 Oct 2026 2:14:51pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "PaintBenchmark.h"
+#include "PlugUI.h"
+#include "panels/OscPanel.h"
+#include "panels/EnvPanel.h"
+#include "panels/Env1Panel.h"
+#include "panels/LfoPanel.h"
+#include "panels/FiltPanel.h"
+#include "panels/FxPanel.h"
+#include "panels/ChorusPanel.h"
+#include "panels/LoFiPanel.h"
+#include "panels/ClippingPanel.h"
+#include "panels/SeqPanel.h"
+#include "panels/InfoPanel.h"
+#include "SimdKernels.h"
+#include <cmath>
+#include <iostream>
+
+AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+namespace {
+    template <typename T>
+    bool isPanel(const PanelBase& panel) { return dynamic_cast<const T*>(&panel) != nullptr; }
+
+    double ticksToMs(int64 ticks, int frames)
+    {
+        return Time::highResolutionTicksToSeconds(ticks) * 1.e3 / jmax(1, frames);
+    }
+}
+
+PaintBenchmark::PaintBenchmark(const Options& o)
+    : options(o)
+    , nextAutomated(0)
+{
+    if (options.scales.size() == 0) {
+        options.scales.add(1.f);
+        options.scales.add(2.f);
+    }
+
+    processor = dynamic_cast<PluginAudioProcessor*>(createPluginFilter());
+    if (processor == nullptr) {
+        return;
+    }
+    SynthParams& p = *processor;
+    // every panel is created with its section
+    for (ParamStepped<eSectionState>* section : { &p.oscSection, &p.envSection, &p.lfoSection, &p.filterSection,
+                                                  &p.fxSection, &p.seqSection, &p.scopeSection }) {
+        section->setStep(eSectionState::eExpanded);
+    }
+    p.openGLRendering.setStep(eOnOffToggle::eOff);
+    for (Param* param : p.serializeParams) {
+        // knob automation, a stepped param switches the layout or other components on its own
+        if (param->getNumSteps() == 0) {
+            automated.add(param);
+        }
+    }
+
+    editor = processor->createEditor();
+    if (editor != nullptr) {
+        collectPanels(*editor, panels);
+    }
+}
+
+PaintBenchmark::~PaintBenchmark()
+{
+    // the panels refer to the params of the processor
+    panels.clear();
+    editor = nullptr;
+    processor = nullptr;
+}
+
+bool PaintBenchmark::runFromCommandLine(const StringArray& args, String& error)
+{
+    if (!args.contains("--benchmark-paint")) {
+        return false;
+    }
+    Options o;
+    const int json = args.indexOf("--json");
+    if (json >= 0 && json + 1 < args.size()) {
+        o.json = File::getCurrentWorkingDirectory().getChildFile(args[json + 1].unquoted());
+    }
+    const int frames = args.indexOf("--frames");
+    if (frames >= 0 && frames + 1 < args.size()) {
+        o.frames = jmax(1, args[frames + 1].getIntValue());
+    }
+
+    PaintBenchmark benchmark(o);
+    error = benchmark.run();
+    return true;
+}
+
+void PaintBenchmark::collectPanels(Component& parent, Array<PanelBase*>& panels)
+{
+    for (int i = 0; i < parent.getNumChildComponents(); ++i) {
+        Component* const child = parent.getChildComponent(i);
+        if (PanelBase* const panel = dynamic_cast<PanelBase*>(child)) {
+            panels.add(panel);
+        }
+        collectPanels(*child, panels);
+    }
+}
+
+String PaintBenchmark::getPanelName(const PanelBase& panel)
+{
+    if (isPanel<PlugUI>(panel)) return "PlugUI";
+    if (isPanel<OscPanel>(panel)) return "OscPanel";
+    if (isPanel<EnvPanel>(panel)) return "EnvPanel";
+    if (isPanel<Env1Panel>(panel)) return "Env1Panel";
+    if (isPanel<LfoPanel>(panel)) return "LfoPanel";
+    if (isPanel<FiltPanel>(panel)) return "FiltPanel";
+    if (isPanel<FxPanel>(panel)) return "FxPanel";
+    if (isPanel<ChorusPanel>(panel)) return "ChorusPanel";
+    if (isPanel<LoFiPanel>(panel)) return "LoFiPanel";
+    if (isPanel<ClippingPanel>(panel)) return "ClippingPanel";
+    if (isPanel<SeqPanel>(panel)) return "SeqPanel";
+    if (isPanel<InfoPanel>(panel)) return "InfoPanel";
+    return "panel";
+}
+
+Image PaintBenchmark::createTarget(const Component& c, float scale)
+{
+    return Image(Image::ARGB, jmax(1, roundToInt(c.getWidth() * scale)), jmax(1, roundToInt(c.getHeight() * scale)), true);
+}
+
+void PaintBenchmark::paintFrame(Component& c, Image& target, float scale, bool full)
+{
+    Graphics g(target);
+    g.addTransform(AffineTransform::scale(scale));
+    if (CachedComponentImage* const cache = c.getCachedComponentImage()) {
+        if (full) {
+            cache->invalidateAll();
+        }
+        cache->paint(g);
+    } else {
+        c.paintEntireComponent(g, false);
+    }
+}
+
+void PaintBenchmark::automate(int frame)
+{
+    SynthParams& p = *processor;
+    // a triangle over the range of every param, the params of a tick at different positions
+    for (int i = 0; i < options.paramsPerFrame && automated.size() > 0; ++i) {
+        Param* const param = automated[nextAutomated];
+        nextAutomated = (nextAutomated + 1) % automated.size();
+        const float phase = std::fmod(frame * .037f + nextAutomated * .13f, 2.f);
+        const float x = phase < 1.f ? phase : 2.f - phase;
+        // like setHost(), without the queue of the audio thread no processBlock drains here
+        param->setUI(param->getMin() + (param->getMax() - param->getMin()) * x, false);
+        param->markUIDirty();
+    }
+    p.telemetry.display.seqStep.store(frame % 16, std::memory_order_relaxed);
+    p.telemetry.display.delayTime.store(250.f + static_cast<float>(frame % 100), std::memory_order_relaxed);
+
+    // the tick of PlugUI without its check for a window, then the hub and the panel timers
+    p.dispatchAudioEvents();
+    p.uiUpdates.dispatchNow();
+    for (PanelBase* panel : panels) {
+        if (dynamic_cast<PlugUI*>(panel) == nullptr) {
+            panel->runPanelTimer();
+        }
+    }
+}
+
+PaintBenchmark::Result PaintBenchmark::measurePanel(const String& name, Component& c, float scale)
+{
+    // the cache at the scale of the case
+    Image target = createTarget(c, scale);
+    paintFrame(c, target, scale, true);
+
+    int64 full = 0;
+    for (int f = 0; f < options.frames; ++f) {
+        const int64 begin = Time::getHighResolutionTicks();
+        paintFrame(c, target, scale, true);
+        full += Time::getHighResolutionTicks() - begin;
+    }
+
+    int64 dirty = 0;
+    for (int f = 0; f < options.frames; ++f) {
+        automate(f);
+        const int64 begin = Time::getHighResolutionTicks();
+        paintFrame(c, target, scale, false);
+        dirty += Time::getHighResolutionTicks() - begin;
+    }
+
+    Result r;
+    r.panel = name;
+    r.scale = scale;
+    r.fullMs = ticksToMs(full, options.frames);
+    r.dirtyMs = ticksToMs(dirty, options.frames);
+    return r;
+}
+
+PaintBenchmark::Result PaintBenchmark::measureEditor(float scale)
+{
+    Image target = createTarget(*editor, scale);
+    paintFrame(*editor, target, scale, true);
+
+    int64 full = 0;
+    for (int f = 0; f < options.frames; ++f) {
+        for (PanelBase* panel : panels) {
+            if (CachedComponentImage* const cache = panel->getCachedComponentImage()) {
+                cache->invalidateAll();
+            }
+        }
+        const int64 begin = Time::getHighResolutionTicks();
+        paintFrame(*editor, target, scale, true);
+        full += Time::getHighResolutionTicks() - begin;
+    }
+
+    int64 dirty = 0;
+    for (int f = 0; f < options.frames; ++f) {
+        automate(f);
+        const int64 begin = Time::getHighResolutionTicks();
+        paintFrame(*editor, target, scale, false);
+        dirty += Time::getHighResolutionTicks() - begin;
+    }
+
+    Result r;
+    r.panel = "editor";
+    r.scale = scale;
+    r.fullMs = ticksToMs(full, options.frames);
+    r.dirtyMs = ticksToMs(dirty, options.frames);
+    return r;
+}
+
+String PaintBenchmark::run()
+{
+    if (processor == nullptr) {
+        return "the processor could not be created";
+    }
+    if (editor == nullptr) {
+        return "the editor could not be created";
+    }
+
+    // instances of a class are numbered in the order of the editor
+    StringArray names;
+    for (PanelBase* panel : panels) {
+        const String name = getPanelName(*panel);
+        int instances = 0;
+        for (const String& n : names) {
+            instances += n.upToFirstOccurrenceOf(" ", false, false) == name ? 1 : 0;
+        }
+        names.add(name + " " + String(instances + 1));
+    }
+
+    Array<var> results;
+    std::cout << "panel             scale  size       full ms  dirty ms" << std::endl;
+    for (float scale : options.scales) {
+        for (int i = 0; i <= panels.size(); ++i) {
+            Component& c = i < panels.size() ? *static_cast<Component*>(panels[i]) : *editor;
+            const Result r = i < panels.size() ? measurePanel(names[i], c, scale) : measureEditor(scale);
+            std::cout << r.panel.paddedRight(' ', 17) << " " << String(scale, 1).paddedLeft(' ', 5) << "  "
+                      << (String(c.getWidth()) + "x" + String(c.getHeight())).paddedRight(' ', 9) << " "
+                      << String(r.fullMs, 3).paddedLeft(' ', 8) << " " << String(r.dirtyMs, 3).paddedLeft(' ', 9) << std::endl;
+            results.add(toJson(r));
+        }
+    }
+
+    if (options.json != File::nonexistent) {
+        DynamicObject::Ptr root = new DynamicObject();
+        root->setProperty("cpu", SystemStats::getCpuVendor());
+        root->setProperty("cpuMHz", SystemStats::getCpuSpeedInMegaherz());
+        root->setProperty("simd", SimdKernels::get().name);
+        root->setProperty("frames", options.frames);
+        root->setProperty("paramsPerFrame", options.paramsPerFrame);
+        root->setProperty("metric", "dirtyMs");
+        root->setProperty("results", results);
+        if (!options.json.replaceWithText(JSON::toString(var(root.get())))) {
+            return "cannot write " + options.json.getFullPathName();
+        }
+    }
+    return String();
+}
+
+var PaintBenchmark::toJson(const Result& r)
+{
+    DynamicObject::Ptr o = new DynamicObject();
+    o->setProperty("case", r.panel + " / " + String(r.scale, 1) + "x");
+    o->setProperty("panel", r.panel);
+    o->setProperty("scale", r.scale);
+    o->setProperty("fullMs", r.fullMs);
+    o->setProperty("dirtyMs", r.dirtyMs);
+    return var(o.get());
+}
@@ -0,0 +1,78 @@
+/*
+  ==============================================================================
+
+    PaintBenchmark.h
+    Created: 17 Oct 2026 2:14:51pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef PAINTBENCHMARK_H_INCLUDED
+#define PAINTBENCHMARK_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "PluginProcessor.h"
+
+class PanelBase;
+
+//! PaintBenchmark: ms per frame of every panel of the editor, painted offscreen at 1x and 2x
+/*! The editor of a processor that is never prepared is created with every section expanded,
+    so every panel exists, and is never put on the desktop. A panel is painted through its
+    cached image into an image of its size times the scale, like the editor paints it:
+    a full frame invalidates the cache first, the cost of a scale change or of the first time
+    the section shows, a dirty frame is what automation leaves to repaint. Before every dirty
+    frame a few continuous params move like host automation, the ParamUpdateHub dispatches them
+    and the panel timers tick once. The parts of a timer that wait for isShowing() have no window
+    here and do nothing. The editor row paints the whole editor over its panels.
+*/
+class PaintBenchmark {
+public:
+    struct Options {
+        Array<float> scales;
+        int frames = 120;               //!< timed of every case
+        int paramsPerFrame = 8;         //!< automated before a dirty frame
+        File json;                      //!< the results as json, none if it does not exist
+    };
+
+    struct Result {
+        String panel;
+        float scale;
+        double fullMs;                  //!< per frame with the cache invalidated
+        double dirtyMs;                 //!< per frame after the automation of a tick
+    };
+
+    explicit PaintBenchmark(const Options& o);
+    ~PaintBenchmark();
+
+    //! \brief runs all cases, prints a line per case and writes the json, returns an error message or an empty string
+    String run();
+
+    //! \brief parses "--benchmark-paint [--json <file>] [--frames <n>]" and runs, false if the arguments are no paint benchmark
+    static bool runFromCommandLine(const StringArray& args, String& error);
+
+private:
+    //! \brief the image a frame of the component is painted into, of its size times the scale
+    static Image createTarget(const Component& c, float scale);
+    //! \brief a frame of the component at the scale, through its cached image if it has one
+    static void paintFrame(Component& c, Image& target, float scale, bool full);
+    //! \brief moves the next paramsPerFrame automated params, ticks the hub and the panel timers
+    void automate(int frame);
+    Result measurePanel(const String& name, Component& c, float scale);
+    Result measureEditor(float scale);
+    //! \brief appends the panels below the component, with their names
+    static void collectPanels(Component& parent, Array<PanelBase*>& panels);
+    static String getPanelName(const PanelBase& panel);
+    static var toJson(const Result& r);
+
+    Options options;
+    ScopedPointer<PluginAudioProcessor> processor;
+    ScopedPointer<AudioProcessorEditor> editor;
+    Array<PanelBase*> panels;           //!< owned by the editor
+    Array<Param*> automated;            //!< the continuous params of the patch
+    int nextAutomated;
+
+    JUCE_DECLARE_NON_COPYABLE(PaintBenchmark)
+};
+
+#endif  // PAINTBENCHMARK_H_INCLUDED
@@ -0,0 +1,662 @@
+/*
+  ==============================================================================
+
+    RenderFarm.cpp
+    Created: 16 Oct 2026 5:20:48pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "RenderFarm.h"
+#include <iostream>
+
+namespace {
+    //! \name the protocol between coordinator and worker
+    /*! A message is a header of three little endian ints, magic, type and the size of the
+        payload, followed by the payload. The worker greets with the version of the protocol
+        and its number of render threads.
+    */
+    ///@{
+    const uint32 protocolMagic = 0x46525953;    // "SYRF"
+    const int protocolVersion = 1;
+    const uint32 maxMessageBytes = 1u << 30;
+    enum eMessage : uint32 { eHello = 1, eJob, eResult };
+    ///@}
+
+    const int connectTimeout = 3000;        //!< ms
+    const int retryInterval = 2000;         //!< ms between two connects to a worker
+    const int maxConnectFailures = 30;      //!< a worker that cannot be reached for a minute is given up
+
+    bool sendMessage(StreamingSocket& socket, uint32 type, const MemoryBlock& payload)
+    {
+        uint32 header[3] = {
+            ByteOrder::swapIfBigEndian(protocolMagic), ByteOrder::swapIfBigEndian(type),
+            ByteOrder::swapIfBigEndian(static_cast<uint32>(payload.getSize()))
+        };
+        const int payloadBytes = static_cast<int>(payload.getSize());
+        return socket.write(header, static_cast<int>(sizeof(header))) == static_cast<int>(sizeof(header))
+            && (payloadBytes == 0 || socket.write(payload.getData(), payloadBytes) == payloadBytes);
+    }
+
+    bool readMessage(StreamingSocket& socket, uint32& type, MemoryBlock& payload)
+    {
+        uint32 header[3];
+        if (socket.read(header, static_cast<int>(sizeof(header)), true) != static_cast<int>(sizeof(header))
+            || ByteOrder::swapIfBigEndian(header[0]) != protocolMagic) {
+            return false;
+        }
+        type = ByteOrder::swapIfBigEndian(header[1]);
+        const uint32 size = ByteOrder::swapIfBigEndian(header[2]);
+        if (size > maxMessageBytes) {
+            return false;
+        }
+        payload.setSize(size);
+        return size == 0 || socket.read(payload.getData(), static_cast<int>(size), true) == static_cast<int>(size);
+    }
+
+    bool sameOptions(const OfflineRenderer::Options& a, const OfflineRenderer::Options& b)
+    {
+        return a.sampleRate == b.sampleRate && a.blockSize == b.blockSize && a.tailSeconds == b.tailSeconds && a.bitDepth == b.bitDepth;
+    }
+
+    OfflineRenderer::Options readRenderOptions(const XmlElement& e, const OfflineRenderer::Options& defaults)
+    {
+        OfflineRenderer::Options o;
+        o.sampleRate = jlimit(8000., 384000., e.getDoubleAttribute("rate", defaults.sampleRate));
+        o.blockSize = jlimit(16, 8192, e.getIntAttribute("block", defaults.blockSize));
+        o.tailSeconds = jmax(0., e.getDoubleAttribute("tail", defaults.tailSeconds));
+        o.bitDepth = e.getIntAttribute("bits", defaults.bitDepth);
+        return o;
+    }
+
+    struct FileNameComparator {
+        static int compareElements(const File& a, const File& b) {
+            return a.getFileName().compareNatural(b.getFileName());
+        }
+    };
+
+    Array<File> findFilesSorted(const File& dir, const String& pattern)
+    {
+        Array<File> files;
+        dir.findChildFiles(files, File::findFiles, false, pattern);
+        FileNameComparator comparator;
+        files.sort(comparator);
+        return files;
+    }
+
+    String getArgument(const StringArray& args, const String& name)
+    {
+        const int index = args.indexOf(name);
+        return index >= 0 && index + 1 < args.size() ? args[index + 1].unquoted() : String();
+    }
+
+    //! \brief the render of a worker into the output file, unpacked, an error message or an empty string
+    String writeResult(const File& output, const void* data, size_t size, bool compressed)
+    {
+        const Result created = output.getParentDirectory().createDirectory();
+        if (created.failed()) {
+            return created.getErrorMessage();
+        }
+        // a render that breaks off does not leave half a file
+        TemporaryFile temp(output);
+        {
+            ScopedPointer<FileOutputStream> out = temp.getFile().createOutputStream();
+            if (out == nullptr) {
+                return "cannot write " + output.getFullPathName();
+            }
+            MemoryInputStream in(data, size, false);
+            if (compressed) {
+                GZIPDecompressorInputStream unpacked(&in, false);
+                out->writeFromInputStream(unpacked, -1);
+            } else {
+                out->writeFromInputStream(in, -1);
+            }
+        }
+        return temp.overwriteTargetFileWithTemporary() ? String() : "cannot write " + output.getFullPathName();
+    }
+}
+
+//==============================================================================
+RenderCoordinator::RenderCoordinator(const Options& o)
+    : options(o)
+    , numDone(0)
+{
+}
+
+RenderCoordinator::~RenderCoordinator()
+{
+}
+
+bool RenderCoordinator::runFromCommandLine(const StringArray& args, String& error)
+{
+    const int index = args.indexOf("--render-farm");
+    if (index < 0) {
+        return false;
+    }
+    const String workers = getArgument(args, "--workers");
+    if (index + 1 >= args.size() || workers.isEmpty()) {
+        error = "usage: --render-farm <jobs.xml> --workers <host:port>,... [--attempts <n>] [--timeout <seconds>] "
+                "[--rate <hz>] [--tail <seconds>] [--bits <16|24>]";
+        return true;
+    }
+
+    Options o;
+    o.jobList = File::getCurrentWorkingDirectory().getChildFile(args[index + 1].unquoted());
+    o.workers = StringArray::fromTokens(workers, ",", "");
+    o.workers.trim();
+    o.workers.removeEmptyStrings();
+    const String attempts = getArgument(args, "--attempts");
+    if (attempts.isNotEmpty()) {
+        o.maxAttempts = jmax(1, attempts.getIntValue());
+    }
+    const String timeout = getArgument(args, "--timeout");
+    if (timeout.isNotEmpty()) {
+        o.resultTimeoutSeconds = jmax(1, timeout.getIntValue());
+    }
+    o.render = OfflineRenderer::parseOptions(args);
+
+    RenderCoordinator coordinator(o);
+    error = coordinator.run();
+    return true;
+}
+
+String RenderCoordinator::readJobs()
+{
+    ScopedPointer<XmlElement> list = XmlDocument::parse(options.jobList);
+    if (list == nullptr || !list->hasTagName("renderjobs")) {
+        return "no job list: " + options.jobList.getFullPathName();
+    }
+    const File dir = options.jobList.getParentDirectory();
+
+    jobs.clear();
+    forEachXmlChildElement(*list, e) {
+        Job job;
+        job.render = readRenderOptions(*e, options.render);
+        if (e->hasTagName("job")) {
+            job.patch = dir.getChildFile(e->getStringAttribute("patch"));
+            job.midi = dir.getChildFile(e->getStringAttribute("midi"));
+            job.output = dir.getChildFile(e->getStringAttribute("output"));
+            jobs.push_back(job);
+        } else if (e->hasTagName("grid")) {
+            // patch by patch, like the batch renderer
+            const File output = dir.getChildFile(e->getStringAttribute("output"));
+            const String format = e->getStringAttribute("format", "wav").trimCharactersAtStart(".");
+            const Array<File> midis = findFilesSorted(dir.getChildFile(e->getStringAttribute("midi")), "*.mid;*.midi");
+            for (const File& patch : findFilesSorted(dir.getChildFile(e->getStringAttribute("patches")), "*.xml")) {
+                for (const File& midi : midis) {
+                    job.patch = patch;
+                    job.midi = midi;
+                    job.output = output.getChildFile(File::createLegalFileName(patch.getFileNameWithoutExtension() + "_"
+                                                                               + midi.getFileNameWithoutExtension()) + "." + format);
+                    jobs.push_back(job);
+                }
+            }
+        }
+    }
+    return jobs.empty() ? "no jobs in " + options.jobList.getFullPathName() : String();
+}
+
+String RenderCoordinator::run()
+{
+    const String error = readJobs();
+    if (error.isNotEmpty()) {
+        return error;
+    }
+
+    OwnedArray<Connection> connections;
+    for (const String& worker : options.workers) {
+        const int port = worker.fromLastOccurrenceOf(":", false, false).getIntValue();
+        if (!worker.contains(":") || port <= 0 || port > 65535) {
+            return "no worker address: " + worker;
+        }
+        connections.add(new Connection(*this, worker.upToLastOccurrenceOf(":", false, false), port));
+    }
+
+    {
+        const ScopedLock sl(lock);
+        numDone = 0;
+        queue.clearQuick();
+        for (int j = 0; j < static_cast<int>(jobs.size()); ++j) {
+            queue.add(j);
+        }
+    }
+    for (Connection* c : connections) {
+        c->startThread();
+    }
+
+    // until all jobs are done or no worker is left
+    while (!isDone()) {
+        bool running = false;
+        for (Connection* c : connections) {
+            running = running || c->isThreadRunning();
+        }
+        if (!running) {
+            break;
+        }
+        progress.wait(500);
+    }
+    for (Connection* c : connections) {
+        c->signalThreadShouldExit();
+    }
+    for (Connection* c : connections) {
+        c->stopThread(connectTimeout + 5000);
+    }
+
+    StringArray errors;
+    const ScopedLock sl(lock);
+    for (const Job& job : jobs) {
+        if (!job.done) {
+            errors.add(job.output.getFileName() + ": no worker left");
+        } else if (job.error.isNotEmpty()) {
+            errors.add(job.output.getFileName() + ": " + job.error);
+        }
+    }
+    return errors.joinIntoString("\n");
+}
+
+bool RenderCoordinator::isDone() const
+{
+    const ScopedLock sl(lock);
+    return numDone == static_cast<int>(jobs.size());
+}
+
+int RenderCoordinator::takeJob()
+{
+    const ScopedLock sl(lock);
+    if (queue.size() == 0) {
+        return -1;
+    }
+    const int job = queue.getFirst();
+    queue.remove(0);
+    ++jobs[static_cast<size_t>(job)].attempts;
+    return job;
+}
+
+void RenderCoordinator::returnJob(int job, const String& worker)
+{
+    const ScopedLock sl(lock);
+    Job& j = jobs[static_cast<size_t>(job)];
+    if (j.done) {
+        return;
+    }
+    if (j.attempts >= options.maxAttempts) {
+        j.error = "given up after " + String(j.attempts) + " attempts, the last on " + worker;
+        markDone(j);
+        return;
+    }
+    // in front of the jobs not handed out yet, the list keeps its order
+    DefaultElementComparator<int> comparator;
+    queue.addSorted(comparator, job);
+    progress.signal();
+}
+
+void RenderCoordinator::failJob(int job, const String& error)
+{
+    const ScopedLock sl(lock);
+    Job& j = jobs[static_cast<size_t>(job)];
+    if (!j.done) {
+        j.error = error;
+        markDone(j);
+    }
+}
+
+void RenderCoordinator::markDone(Job& job)
+{
+    job.done = true;
+    ++numDone;
+    std::cout << numDone << "/" << jobs.size() << " " << job.output.getFileName()
+              << (job.error.isNotEmpty() ? " failed: " + job.error : String()) << std::endl;
+    progress.signal();
+}
+
+String RenderCoordinator::createJobMessage(int job, MemoryBlock& dst) const
+{
+    // the fields read here never change while the jobs are rendered
+    const Job& j = jobs[static_cast<size_t>(job)];
+    MemoryBlock patch, midi;
+    if (!j.patch.loadFileAsData(patch)) {
+        return "cannot read " + j.patch.getFullPathName();
+    }
+    if (!j.midi.loadFileAsData(midi)) {
+        return "cannot read " + j.midi.getFullPathName();
+    }
+    dst.reset();
+    MemoryOutputStream out(dst, false);
+    out.writeInt(job);
+    out.writeDouble(j.render.sampleRate);
+    out.writeInt(j.render.blockSize);
+    out.writeDouble(j.render.tailSeconds);
+    out.writeInt(j.render.bitDepth);
+    out.writeString(j.output.getFileExtension().trimCharactersAtStart("."));
+    out.writeInt64(static_cast<int64>(patch.getSize()));
+    out << patch;
+    out.writeInt64(static_cast<int64>(midi.getSize()));
+    out << midi;
+    return String();
+}
+
+int RenderCoordinator::finishJob(const MemoryBlock& result)
+{
+    MemoryInputStream in(result, false);
+    const int job = in.readInt();
+    if (!isPositiveAndBelow(job, static_cast<int>(jobs.size()))) {
+        return -1;
+    }
+    String error = in.readString();
+    const bool compressed = in.readBool();
+    const int64 size = in.readInt64();
+    if (size < 0 || size > in.getNumBytesRemaining()) {
+        return -1;
+    }
+    // a job is in flight on one worker only, its file is written outside of the lock
+    if (error.isEmpty()) {
+        error = writeResult(jobs[static_cast<size_t>(job)].output, static_cast<const char*>(result.getData()) + in.getPosition(),
+                            static_cast<size_t>(size), compressed);
+    }
+    const ScopedLock sl(lock);
+    Job& j = jobs[static_cast<size_t>(job)];
+    if (!j.done) {
+        j.error = error;
+        markDone(j);
+    }
+    return job;
+}
+
+//==============================================================================
+RenderCoordinator::Connection::Connection(RenderCoordinator& c, const String& h, int p)
+    : Thread("Render Farm " + h)
+    , coordinator(c)
+    , host(h)
+    , port(p)
+{
+}
+
+void RenderCoordinator::Connection::run()
+{
+    int failures = 0;
+    while (!threadShouldExit() && !coordinator.isDone()) {
+        StreamingSocket socket;
+        uint32 type = 0;
+        MemoryBlock hello;
+        if (socket.connect(host, port, connectTimeout) && socket.waitUntilReady(true, connectTimeout) == 1
+            && readMessage(socket, type, hello) && type == eHello) {
+            MemoryInputStream in(hello, false);
+            const int version = in.readInt();
+            const int numThreads = jlimit(1, 256, in.readInt());
+            if (version != protocolVersion) {
+                std::cerr << host << ":" << port << " speaks version " << version << " of the protocol, not " << protocolVersion << std::endl;
+                return;
+            }
+            failures = 0;
+            serve(socket, numThreads);
+        } else if (++failures >= maxConnectFailures) {
+            std::cerr << host << ":" << port << " given up, it cannot be reached" << std::endl;
+            return;
+        }
+        if (!coordinator.isDone()) {
+            wait(retryInterval);
+        }
+    }
+}
+
+bool RenderCoordinator::Connection::serve(StreamingSocket& socket, int numThreads)
+{
+    const String name = host + ":" + String(port);
+    const uint32 timeout = static_cast<uint32>(coordinator.options.resultTimeoutSeconds) * 1000u;
+    Array<int> inFlight;
+    uint32 lastResult = Time::getMillisecondCounter();
+    bool connected = true;
+
+    while (connected && !threadShouldExit()) {
+        // a job per render thread is rendered, one more each waits on the worker
+        while (connected && inFlight.size() < 2 * numThreads) {
+            const int job = coordinator.takeJob();
+            if (job < 0) {
+                break;
+            }
+            MemoryBlock message;
+            const String error = coordinator.createJobMessage(job, message);
+            if (error.isNotEmpty()) {
+                coordinator.failJob(job, error);
+                continue;
+            }
+            inFlight.add(job);
+            connected = sendMessage(socket, eJob, message);
+        }
+        if (!connected) {
+            break;
+        }
+        if (inFlight.size() == 0) {
+            if (coordinator.isDone()) {
+                break;
+            }
+            // the jobs in flight on other workers may come back
+            wait(200);
+            lastResult = Time::getMillisecondCounter();
+            continue;
+        }
+
+        const int ready = socket.waitUntilReady(true, 500);
+        if (ready == 0) {
+            connected = Time::getMillisecondCounter() - lastResult < timeout;
+            continue;
+        }
+        uint32 type = 0;
+        MemoryBlock result;
+        if (ready < 0 || !readMessage(socket, type, result) || type != eResult) {
+            connected = false;
+            break;
+        }
+        const int job = coordinator.finishJob(result);
+        if (job < 0) {
+            connected = false;
+            break;
+        }
+        inFlight.removeFirstMatchingValue(job);
+        lastResult = Time::getMillisecondCounter();
+    }
+
+    for (int job : inFlight) {
+        coordinator.returnJob(job, name);
+    }
+    socket.close();
+    return connected;
+}
+
+//==============================================================================
+RenderWorker::RenderWorker(const Options& o)
+    : options(o)
+    , connection(nullptr)
+    , generation(0)
+{
+}
+
+RenderWorker::~RenderWorker()
+{
+    for (RenderThread* t : threads) {
+        t->signalThreadShouldExit();
+    }
+    // a render is not interrupted
+    for (RenderThread* t : threads) {
+        t->stopThread(60000);
+    }
+}
+
+bool RenderWorker::runFromCommandLine(const StringArray& args, String& error)
+{
+    const int index = args.indexOf("--render-worker");
+    if (index < 0) {
+        return false;
+    }
+    Options o;
+    o.port = index + 1 < args.size() ? args[index + 1].getIntValue() : 0;
+    if (o.port <= 0 || o.port > 65535) {
+        error = "usage: --render-worker <port> [--threads <n>]";
+        return true;
+    }
+    o.numThreads = jmax(0, getArgument(args, "--threads").getIntValue());
+
+    RenderWorker worker(o);
+    error = worker.run();
+    return true;
+}
+
+String RenderWorker::run()
+{
+    StreamingSocket listener;
+    if (!listener.createListener(options.port)) {
+        return "cannot listen on port " + String(options.port);
+    }
+    const int numThreads = options.numThreads > 0 ? options.numThreads : SystemStats::getNumCpus();
+    for (int i = 0; i < numThreads; ++i) {
+        threads.add(new RenderThread(*this))->startThread();
+    }
+    std::cout << "render worker on port " << options.port << " with " << numThreads << " threads" << std::endl;
+
+    for (;;) {
+        ScopedPointer<StreamingSocket> socket = listener.waitForNextConnection();
+        if (socket == nullptr) {
+            return "the listener on port " + String(options.port) + " failed";
+        }
+        serve(*socket);
+    }
+}
+
+void RenderWorker::serve(StreamingSocket& socket)
+{
+    int current;
+    {
+        const ScopedLock sl(sendLock);
+        connection = &socket;
+        current = ++generation;
+
+        MemoryBlock hello;
+        MemoryOutputStream out(hello, false);
+        out.writeInt(protocolVersion);
+        out.writeInt(threads.size());
+        out.flush();
+        if (!sendMessage(socket, eHello, hello)) {
+            connection = nullptr;
+            return;
+        }
+    }
+    std::cout << "coordinator " << socket.getHostName() << " connected" << std::endl;
+
+    uint32 type = 0;
+    MemoryBlock payload;
+    while (readMessage(socket, type, payload) && type == eJob) {
+        MemoryInputStream in(payload, false);
+        ScopedPointer<Request> r = new Request();
+        r->generation = current;
+        r->job = in.readInt();
+        r->render.sampleRate = in.readDouble();
+        r->render.blockSize = in.readInt();
+        r->render.tailSeconds = in.readDouble();
+        r->render.bitDepth = in.readInt();
+        r->extension = in.readString();
+        const int64 patchSize = in.readInt64();
+        if (patchSize < 0 || patchSize > in.getNumBytesRemaining()) {
+            break;
+        }
+        in.readIntoMemoryBlock(r->patch, static_cast<ssize_t>(patchSize));
+        const int64 midiSize = in.readInt64();
+        if (midiSize < 0 || midiSize > in.getNumBytesRemaining()) {
+            break;
+        }
+        in.readIntoMemoryBlock(r->midi, static_cast<ssize_t>(midiSize));
+        {
+            const ScopedLock sl(queueLock);
+            queue.add(r.release());
+        }
+        requestAvailable.signal();
+    }
+
+    // the coordinator hands the jobs it sent to another worker
+    {
+        const ScopedLock sl(queueLock);
+        queue.clear();
+    }
+    const ScopedLock sl(sendLock);
+    connection = nullptr;
+    std::cout << "coordinator gone" << std::endl;
+}
+
+RenderWorker::Request* RenderWorker::takeRequest()
+{
+    const ScopedLock sl(queueLock);
+    return queue.removeAndReturn(0);
+}
+
+void RenderWorker::sendResult(int requestGeneration, const MemoryBlock& result)
+{
+    // results of a coordinator that went away are dropped
+    const ScopedLock sl(sendLock);
+    if (connection != nullptr && requestGeneration == generation) {
+        sendMessage(*connection, eResult, result);
+    }
+}
+
+void RenderWorker::RenderThread::run()
+{
+    while (!threadShouldExit()) {
+        ScopedPointer<Request> r = worker.takeRequest();
+        if (r == nullptr) {
+            worker.requestAvailable.wait(100);
+            continue;
+        }
+        MemoryBlock result;
+        render(*r, result);
+        worker.sendResult(r->generation, result);
+    }
+}
+
+void RenderWorker::RenderThread::render(const Request& r, MemoryBlock& result)
+{
+    // a new processor only when the options change, the renderer prepares it for every render anyway
+    if (renderer == nullptr || !sameOptions(renderOptions, r.render)) {
+        renderOptions = r.render;
+        renderer = new OfflineRenderer(renderOptions);
+    }
+
+    const String extension = r.extension.isNotEmpty() ? r.extension : "wav";
+    TemporaryFile patch(".xml"), midi(".mid"), output("." + extension);
+    String error;
+    MemoryBlock rendered;
+    if (!patch.getFile().replaceWithData(r.patch.getData(), r.patch.getSize())
+        || !midi.getFile().replaceWithData(r.midi.getData(), r.midi.getSize())) {
+        error = "cannot write the temporary files";
+    }
+    if (error.isEmpty()) {
+        error = renderer->loadMidi(midi.getFile());
+    }
+    if (error.isEmpty()) {
+        error = renderer->loadPatch(patch.getFile());
+    }
+    if (error.isEmpty()) {
+        error = renderer->render(output.getFile());
+    }
+    if (error.isEmpty() && !output.getFile().loadFileAsData(rendered)) {
+        error = "cannot read the render";
+    }
+
+    // flac is compressed already
+    const bool compress = error.isEmpty() && !extension.equalsIgnoreCase("flac");
+    if (compress) {
+        MemoryBlock packed;
+        {
+            MemoryOutputStream out(packed, false);
+            GZIPCompressorOutputStream gz(&out, 6);
+            gz.write(rendered.getData(), rendered.getSize());
+        }
+        rendered.swapWith(packed);
+    }
+
+    result.reset();
+    MemoryOutputStream out(result, false);
+    out.writeInt(r.job);
+    out.writeString(error);
+    out.writeBool(compress);
+    out.writeInt64(static_cast<int64>(rendered.getSize()));
+    out << rendered;
+}
@@ -0,0 +1,161 @@
+/*
+  ==============================================================================
+
+    RenderFarm.h
+    Created: 16 Oct 2026 5:20:48pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef RENDERFARM_H_INCLUDED
+#define RENDERFARM_H_INCLUDED
+
+#include "OfflineRenderer.h"
+#include <vector>
+
+//! RenderCoordinator: renders a job list of the OfflineRenderer on render workers of other machines
+/*! A job is a patch, a midi file, the output file and its render options. The job list is an xml
+    file with <job patch="" midi="" output="" rate="" tail="" bits=""/> elements, and <grid
+    patches="" midi="" output="" format=""/> elements for every patch of a directory with every
+    midi file of another. Paths are relative to the list.
+    The coordinator holds one tcp connection per worker and keeps twice as many jobs in flight
+    as the worker has render threads. The patch and the midi file travel with the job, so the
+    workers need no shared file system; the samples of the patches must exist under the same
+    path on the workers. Jobs are handed out in the order of the list, one that was in flight on
+    a worker that went away goes back to the front of the queue, until it was tried on as many
+    workers as "--attempts" allows. An error of the render itself is not retried.
+*/
+class RenderCoordinator {
+public:
+    struct Options {
+        File jobList;
+        StringArray workers;        //!< "host:port"
+        int maxAttempts = 3;
+        int resultTimeoutSeconds = 600; //!< a worker that sends nothing for so long with jobs in flight is given up
+        OfflineRenderer::Options render;    //!< of the jobs that do not set their own
+    };
+
+    explicit RenderCoordinator(const Options& o);
+    ~RenderCoordinator();
+
+    //! \brief renders all jobs, returns the errors in the order of the list or an empty string
+    String run();
+
+    //! \brief parses "--render-farm <jobs.xml> --workers host:port,..." and renders, false if the arguments are no farm call
+    static bool runFromCommandLine(const StringArray& args, String& error);
+
+private:
+    struct Job {
+        File patch;
+        File midi;
+        File output;
+        OfflineRenderer::Options render;
+        int attempts = 0;
+        bool done = false;
+        String error;
+    };
+
+    //! one worker, reconnects while jobs are left
+    class Connection : public Thread {
+    public:
+        Connection(RenderCoordinator& c, const String& h, int p);
+        void run() override;
+    private:
+        //! \brief false if the connection broke, the jobs in flight are returned then
+        bool serve(StreamingSocket& socket, int numThreads);
+        RenderCoordinator& coordinator;
+        const String host;
+        const int port;
+    };
+
+    String readJobs();
+    //! \brief the first job of the queue, -1 if the queue is empty
+    int takeJob();
+    //! \brief a job in flight on a worker that went away, queued again or failed
+    void returnJob(int job, const String& worker);
+    void failJob(int job, const String& error);
+    //! \brief the job with its patch and midi file for a worker, an error message if they cannot be read
+    String createJobMessage(int job, MemoryBlock& dst) const;
+    //! \brief writes the result of a worker, the job of it or -1 for a malformed result
+    int finishJob(const MemoryBlock& result);
+    void markDone(Job& job);
+    bool isDone() const;
+
+    Options options;
+    std::vector<Job> jobs;
+
+    CriticalSection lock;   //!< guards the jobs, the queue and the count
+    Array<int> queue;       //!< the jobs not handed out, ascending
+    int numDone;
+    WaitableEvent progress;
+
+    JUCE_DECLARE_NON_COPYABLE(RenderCoordinator)
+};
+
+//==============================================================================
+//! RenderWorker: renders the jobs of a RenderCoordinator on all cores of this machine
+/*! Listens on a tcp port for one coordinator at a time. Every render thread owns an
+    OfflineRenderer and renders the next job it is sent into a temporary file, which goes back
+    compressed, flac as it is. When the coordinator goes away the jobs it sent are dropped, it
+    hands them to another worker.
+*/
+class RenderWorker {
+public:
+    struct Options {
+        int port = 0;
+        int numThreads = 0;     //!< number of cpus if 0
+    };
+
+    explicit RenderWorker(const Options& o);
+    ~RenderWorker();
+
+    //! \brief serves coordinators until the process ends, returns an error message if it cannot listen
+    String run();
+
+    //! \brief parses "--render-worker <port> [--threads <n>]" and serves, false if the arguments are no worker call
+    static bool runFromCommandLine(const StringArray& args, String& error);
+
+private:
+    struct Request {
+        int generation;     //!< of the connection that sent it
+        int job;
+        OfflineRenderer::Options render;
+        String extension;
+        MemoryBlock patch;
+        MemoryBlock midi;
+    };
+
+    class RenderThread : public Thread {
+    public:
+        explicit RenderThread(RenderWorker& w) : Thread("Render Worker"), worker(w) {}
+        void run() override;
+    private:
+        //! \brief the result message of a request
+        void render(const Request& r, MemoryBlock& result);
+        RenderWorker& worker;
+        ScopedPointer<OfflineRenderer> renderer;
+        OfflineRenderer::Options renderOptions;     //!< of the renderer
+    };
+
+    //! \brief reads the jobs of one coordinator until it goes away
+    void serve(StreamingSocket& socket);
+    Request* takeRequest();
+    void sendResult(int generation, const MemoryBlock& result);
+
+    Options options;
+
+    CriticalSection queueLock;
+    OwnedArray<Request> queue;
+    WaitableEvent requestAvailable;
+
+    CriticalSection sendLock;       //!< guards the connection and the generation
+    StreamingSocket* connection;
+    int generation;
+
+    OwnedArray<RenderThread> threads;
+
+    JUCE_DECLARE_NON_COPYABLE(RenderWorker)
+};
+
+#endif  // RENDERFARM_H_INCLUDED
@@ -0,0 +1,224 @@
+/*
+  ==============================================================================
+
+    SessionReplay.cpp
+    Created: 16 Oct 2026 11:47:02pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "SessionReplay.h"
+#include "SimdKernels.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+SessionReplay::SessionReplay(const Options& o)
+    : options(o)
+    , currentBlock(nullptr)
+{
+    processor = dynamic_cast<PluginAudioProcessor*>(createPluginFilter());
+}
+
+SessionReplay::~SessionReplay()
+{
+    if (processor != nullptr) {
+        processor->setPlayHead(nullptr);
+    }
+}
+
+bool SessionReplay::runFromCommandLine(const StringArray& args, String& error)
+{
+    const int replay = args.indexOf("--replay");
+    if (replay < 0) {
+        return false;
+    }
+    if (replay + 1 >= args.size()) {
+        error = "--replay needs the file of a capture";
+        return true;
+    }
+    Options o;
+    o.capture = File::getCurrentWorkingDirectory().getChildFile(args[replay + 1].unquoted());
+    const int passes = args.indexOf("--passes");
+    if (passes >= 0 && passes + 1 < args.size()) {
+        o.passes = jlimit(1, 100, args[passes + 1].getIntValue());
+    }
+    const int json = args.indexOf("--json");
+    if (json >= 0 && json + 1 < args.size()) {
+        o.json = File::getCurrentWorkingDirectory().getChildFile(args[json + 1].unquoted());
+    }
+
+    SessionReplay r(o);
+    error = r.run();
+    return true;
+}
+
+bool SessionReplay::getCurrentPosition(CurrentPositionInfo& result)
+{
+    if (currentBlock == nullptr || !currentBlock->hasPosition) {
+        result.resetToDefault();
+        return false;
+    }
+    result = currentBlock->position;
+    return true;
+}
+
+SessionReplay::Result SessionReplay::runPass(int pass)
+{
+    PluginAudioProcessor& p = *processor;
+
+    // the state and the preparation of the start of the capture, for every pass
+    p.setStateInformation(session.state.getData(), static_cast<int>(session.state.getSize()));
+    p.setPlayConfigDetails(0, session.numChannels, session.sampleRate, session.maxBlockSize);
+    p.setNonRealtime(false);
+    p.setPlayHead(this);
+    p.prepareToPlay(session.sampleRate, session.maxBlockSize);
+
+    AudioSampleBuffer buffer(session.numChannels, session.maxBlockSize);
+    MidiBuffer midi;
+    midi.ensureSize(4096);
+    const std::vector<Param*>& params = p.serializeParams;
+
+    const int numBlocks = static_cast<int>(session.blocks.size());
+    Array<double> blockSeconds;
+    blockSeconds.ensureStorageAllocated(numBlocks);
+    int64 total = 0;
+    int64 samples = 0;
+    int64 slowestStart = 0;
+    double slowest = 0.;
+    uint64 hash = 14695981039346656037ull;
+
+    for (const SessionCapture::Block& b : session.blocks) {
+        currentBlock = &b;
+        if (b.nonRealtime != p.isNonRealtime()) {
+            p.setNonRealtime(b.nonRealtime);
+        }
+        // the host changes arrive before the block, on the thread of the block
+        for (const SessionCapture::ParamChange& c : b.params) {
+            if (c.index >= 0 && c.index < static_cast<int>(params.size())) {
+                params[static_cast<size_t>(c.index)]->replayHost(c.value);
+            }
+        }
+        midi = b.midi;
+        AudioSampleBuffer block(buffer.getArrayOfWritePointers(), session.numChannels, b.numSamples);
+        block.clear();
+
+        const int64 start = Time::getHighResolutionTicks();
+        p.processBlock(block, midi);
+        const int64 ticks = Time::getHighResolutionTicks() - start;
+        total += ticks;
+        const double seconds = Time::highResolutionTicksToSeconds(ticks);
+        blockSeconds.add(seconds);
+        if (seconds > slowest) {
+            slowest = seconds;
+            slowestStart = samples;
+        }
+        samples += b.numSamples;
+
+        // FNV-1a of the bits of the output
+        for (int c = 0; c < session.numChannels; ++c) {
+            const float* data = block.getReadPointer(c);
+            for (int s = 0; s < b.numSamples; ++s) {
+                uint32 bits;
+                std::memcpy(&bits, data + s, sizeof(bits));
+                hash = (hash ^ bits) * 1099511628211ull;
+            }
+        }
+    }
+    currentBlock = nullptr;
+
+    p.releaseResources();
+    p.setPlayHead(nullptr);
+
+    std::sort(blockSeconds.begin(), blockSeconds.end());
+    Result r;
+    r.pass = pass;
+    const double wallSeconds = Time::highResolutionTicksToSeconds(total);
+    r.realtimeFactor = wallSeconds > 0. ? samples / session.sampleRate / wallSeconds : 0.;
+    r.meanBlockMs = numBlocks > 0 ? 1000. * wallSeconds / numBlocks : 0.;
+    r.p99BlockMs = numBlocks > 0 ? 1000. * blockSeconds[jmin(numBlocks - 1, numBlocks * 99 / 100)] : 0.;
+    r.maxBlockMs = 1000. * slowest;
+    r.maxBlockSeconds = slowestStart / session.sampleRate;
+    r.outputHash = hash;
+    return r;
+}
+
+var SessionReplay::toJson(const Result& r)
+{
+    DynamicObject::Ptr o = new DynamicObject();
+    o->setProperty("case", "pass " + String(r.pass));
+    o->setProperty("pass", r.pass);
+    o->setProperty("realtimeFactor", r.realtimeFactor);
+    o->setProperty("meanBlockMs", r.meanBlockMs);
+    o->setProperty("p99BlockMs", r.p99BlockMs);
+    o->setProperty("maxBlockMs", r.maxBlockMs);
+    o->setProperty("maxBlockSeconds", r.maxBlockSeconds);
+    o->setProperty("outputHash", String::toHexString(static_cast<int64>(r.outputHash)));
+    return var(o.get());
+}
+
+String SessionReplay::run()
+{
+    if (processor == nullptr) {
+        return "the processor could not be created";
+    }
+    const juce::Result loaded = SessionCapture::read(options.capture, session);
+    if (loaded.failed()) {
+        return loaded.getErrorMessage();
+    }
+    if (session.blocks.empty()) {
+        return options.capture.getFileName() + " has no blocks";
+    }
+
+    int64 samples = 0;
+    for (const SessionCapture::Block& b : session.blocks) {
+        samples += b.numSamples;
+    }
+    std::cout << options.capture.getFileName() << ": " << session.blocks.size() << " blocks, "
+              << String(samples / session.sampleRate, 1) << " s at " << session.sampleRate << " Hz";
+    if (session.droppedBlocks != 0) {
+        std::cout << (session.droppedBlocks < 0 ? String(", the capture was not stopped")
+                                                : ", " + String(session.droppedBlocks) + " blocks dropped by the capture");
+    }
+    std::cout << std::endl;
+
+    Array<var> results;
+    uint64 firstHash = 0;
+    bool deterministic = true;
+    std::cout << "pass  realtime  mean ms  p99 ms  max ms  at s      output" << std::endl;
+    for (int pass = 0; pass < options.passes; ++pass) {
+        const Result r = runPass(pass);
+        std::cout << String(r.pass).paddedLeft(' ', 4) << " " << String(r.realtimeFactor, 1).paddedLeft(' ', 9) << " "
+                  << String(r.meanBlockMs, 3).paddedLeft(' ', 8) << " " << String(r.p99BlockMs, 3).paddedLeft(' ', 7) << " "
+                  << String(r.maxBlockMs, 3).paddedLeft(' ', 7) << " " << String(r.maxBlockSeconds, 2).paddedLeft(' ', 7) << "  "
+                  << String::toHexString(static_cast<int64>(r.outputHash)) << std::endl;
+        results.add(toJson(r));
+        if (pass == 0) {
+            firstHash = r.outputHash;
+        }
+        deterministic = deterministic && r.outputHash == firstHash;
+    }
+    if (!deterministic) {
+        std::cout << "the passes rendered different output, the replay is not deterministic" << std::endl;
+    }
+
+    if (options.json != File::nonexistent) {
+        DynamicObject::Ptr root = new DynamicObject();
+        root->setProperty("cpu", SystemStats::getCpuVendor());
+        root->setProperty("cpuMHz", SystemStats::getCpuSpeedInMegaherz());
+        root->setProperty("simd", SimdKernels::get().name);
+        root->setProperty("capture", options.capture.getFileName());
+        root->setProperty("sampleRate", session.sampleRate);
+        root->setProperty("blockSize", session.maxBlockSize);
+        root->setProperty("deterministic", deterministic);
+        root->setProperty("metric", "p99BlockMs");
+        root->setProperty("results", results);
+        if (!options.json.replaceWithText(JSON::toString(var(root.get())))) {
+            return "cannot write " + options.json.getFullPathName();
+        }
+    }
+    return String();
+}
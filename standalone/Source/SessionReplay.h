@@ -0,0 +1,68 @@
+/*
+  ==============================================================================
+
+    SessionReplay.h
+    Created: 16 Oct 2026 11:47:02pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef SESSIONREPLAY_H_INCLUDED
+#define SESSIONREPLAY_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "PluginProcessor.h"
+#include "SessionCapture.h"
+
+//! SessionReplay: plays a SessionCapture back into a processor, block by block, for the load test numbers
+/*! The processor gets the captured state and is prepared like in the session, then every block
+    gets its captured transport through the play head, its host changes through the event queue
+    of the params, as HostParam::setValue() would have queued them, and its midi, with the
+    captured block size. Every pass is timed like the LoadTest and hashes the output, the same
+    hash for every pass shows that the replay is deterministic. The slowest block is reported
+    with its time in the session, so a spike a user saw can be found and stepped through.
+*/
+class SessionReplay : public AudioPlayHead {
+public:
+    struct Options {
+        File capture;
+        int passes = 3;                 //!< the first one warms the caches up as well
+        File json;                      //!< the results as json, none if it does not exist
+    };
+
+    struct Result {
+        int pass;
+        double realtimeFactor;          //!< simulated time per wall clock time, above 1 is faster than real time
+        double meanBlockMs;
+        double p99BlockMs;
+        double maxBlockMs;
+        double maxBlockSeconds;         //!< time in the session of the slowest block
+        uint64 outputHash;
+    };
+
+    explicit SessionReplay(const Options& o);
+    ~SessionReplay();
+
+    //! \brief replays all passes, prints a line per pass and writes the json, returns an error message or an empty string
+    String run();
+
+    //! \brief parses "--replay <file> [--passes <n>] [--json <file>]", false if the arguments are no replay
+    static bool runFromCommandLine(const StringArray& args, String& error);
+
+    //! \brief the captured transport of the current block, false where the session had none
+    bool getCurrentPosition(CurrentPositionInfo& result) override;
+
+private:
+    Result runPass(int pass);
+    static var toJson(const Result& r);
+
+    Options options;
+    SessionCapture::Session session;
+    ScopedPointer<PluginAudioProcessor> processor;
+    const SessionCapture::Block* currentBlock;
+
+    JUCE_DECLARE_NON_COPYABLE(SessionReplay)
+};
+
+#endif  // SESSIONREPLAY_H_INCLUDED
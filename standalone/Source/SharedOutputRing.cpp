@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+
+    SharedOutputRing.cpp
+    Created: 15 Oct 2026 9:14:26pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "SharedOutputRing.h"
+
+SharedOutputRing::SharedOutputRing()
+    : generation(Time::getMillisecondCounter())
+    , channels(0)
+    , capacity(0)
+    , frames(nullptr)
+    , writePosition(nullptr)
+    , position(0)
+{
+}
+
+SharedOutputRing::~SharedOutputRing()
+{
+    close();
+}
+
+void SharedOutputRing::open(const File& f)
+{
+    const SpinLock::ScopedLockType sl(lock);
+    unmap();
+    file = f;
+}
+
+void SharedOutputRing::close()
+{
+    const SpinLock::ScopedLockType sl(lock);
+    unmap();
+    file = File::nonexistent;
+}
+
+void SharedOutputRing::unmap()
+{
+    frames = nullptr;
+    writePosition = nullptr;
+    mapped = nullptr;
+}
+
+Result SharedOutputRing::prepare(double sampleRate, int numChannels)
+{
+    const SpinLock::ScopedLockType sl(lock);
+    unmap();
+    if (!isOpen() || sampleRate <= 0. || numChannels <= 0) {
+        return Result::ok();
+    }
+
+    const uint32 numFrames = static_cast<uint32>(nextPowerOfTwo(roundToInt(ringSeconds * sampleRate)));
+    const int64 size = headerBytes + static_cast<int64>(numFrames) * numChannels * static_cast<int64>(sizeof(float));
+
+    // the file only grows, a reader that maps the old size is not cut off
+    const int64 existing = file.existsAsFile() ? file.getSize() : 0;
+    if (existing < size) {
+        FileOutputStream out(file);
+        if (out.failedToOpen() || !out.writeRepeatedByte(0, static_cast<size_t>(size - existing))) {
+            return Result::fail("cannot write " + file.getFullPathName());
+        }
+    }
+    mapped = new MemoryMappedFile(file, MemoryMappedFile::readWrite);
+    if (mapped->getData() == nullptr || static_cast<int64>(mapped->getSize()) < size) {
+        mapped = nullptr;
+        return Result::fail("cannot map " + file.getFullPathName());
+    }
+
+    char* const base = static_cast<char*>(mapped->getData());
+    channels = numChannels;
+    capacity = numFrames;
+    position = 0;
+    const uint32 header[] = { magic, formatVersion, static_cast<uint32>(numChannels), numFrames };
+    std::memcpy(base, header, sizeof(header));
+    std::memcpy(base + 16, &sampleRate, sizeof(sampleRate));
+    writePosition = reinterpret_cast<std::atomic<uint64>*>(base + positionOffset);
+    writePosition->store(0, std::memory_order_relaxed);
+    frames = reinterpret_cast<float*>(base + headerBytes);
+    FloatVectorOperations::clear(frames, static_cast<int>(numFrames) * numChannels);
+    // last, a reader that sees the new generation sees the fields above
+    reinterpret_cast<std::atomic<uint32>*>(base + 24)->store(++generation, std::memory_order_release);
+    return Result::ok();
+}
+
+void SharedOutputRing::push(const float* const* data, int numChannels, int numSamples)
+{
+    const GenericScopedTryLock<SpinLock> sl(lock);
+    if (!sl.isLocked() || frames == nullptr) {
+        return;
+    }
+
+    const int n = jmin(numChannels, channels);
+    const uint64 mask = capacity - 1;
+    for (int i = 0; i < numSamples; ++i) {
+        float* const frame = frames + static_cast<size_t>((position + static_cast<uint64>(i)) & mask) * static_cast<size_t>(channels);
+        for (int c = 0; c < n; ++c) {
+            frame[c] = data[c][i];
+        }
+        for (int c = n; c < channels; ++c) {
+            frame[c] = 0.f;
+        }
+    }
+    position += static_cast<uint64>(numSamples);
+    writePosition->store(position, std::memory_order_release);
+}
+
+File SharedOutputRing::getDefaultFile()
+{
+    return File::getSpecialLocation(File::tempDirectory).getChildFile("synister-output.ring");
+}
@@ -0,0 +1,86 @@
+/*
+  ==============================================================================
+
+    SharedOutputRing.h
+    Created: 15 Oct 2026 9:14:26pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef SHAREDOUTPUTRING_H_INCLUDED
+#define SHAREDOUTPUTRING_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include <atomic>
+
+//! SharedOutputRing: the output of the standalone in a memory mapped file for other processes
+/*! Recording, streaming or analysis tools on the same machine map the file and read the output
+    without a loopback device and its extra callback. The audio thread copies every block
+    interleaved into the ring and then advances the write position, nothing else is shared.
+    The layout, in the byte order of the machine:
+
+    | offset | field                                                        |
+    |--------|--------------------------------------------------------------|
+    | 0      | uint32 magic "SYNR"                                          |
+    | 4      | uint32 formatVersion                                         |
+    | 8      | uint32 channels                                              |
+    | 12     | uint32 capacity in frames, a power of two                    |
+    | 16     | double sample rate                                           |
+    | 24     | uint32 generation, changes whenever the fields above change  |
+    | 64     | uint64 frames written since the generation started, atomic   |
+    | 128    | float frames[capacity][channels]                             |
+
+    Frame n is at index n & (capacity - 1). A reader loads the write position, copies the frames
+    before it and loads the position again: frames more than capacity behind the second load were
+    overwritten meanwhile. The file is only resized while the audio thread does not write, a reader
+    compares the generation before and after a read. Like the OutputRecorder, the audio thread only
+    tries the lock the message thread holds to remap the file, a block can be missed there but
+    the audio thread never waits.
+*/
+class SharedOutputRing {
+public:
+    SharedOutputRing();
+    ~SharedOutputRing();
+
+    //! \brief message thread: shares the output in the file from the next prepare() on
+    void open(const File& file);
+    //! \brief message thread: the ring is no longer written, the file stays
+    void close();
+    /** \brief message thread: the device started, maps the file for its rate and channels
+        @return the error of the mapping, the ring is not written then
+    */
+    Result prepare(double sampleRate, int numChannels);
+
+    bool isOpen() const { return file != File::nonexistent; }
+    const File& getFile() const { return file; }
+
+    //! \brief audio thread: copies a block of the output into the ring
+    void push(const float* const* data, int numChannels, int numSamples);
+
+    //! \brief in the temp folder, what readers look for if the command line names no file
+    static File getDefaultFile();
+
+    static const uint32 magic = 0x524e5953;     //!< "SYNR"
+    static const uint32 formatVersion = 1;
+    static const int ringSeconds = 2;           //!< at least, how far a reader may fall behind
+    static const int headerBytes = 128;
+    static const int positionOffset = 64;       //!< of the write position, a cache line of its own
+
+private:
+    void unmap();
+
+    SpinLock lock;      //!< of the mapping
+    ScopedPointer<MemoryMappedFile> mapped;
+    File file;
+    uint32 generation;
+    int channels;
+    uint32 capacity;
+    float* frames;      //!< in the mapping, nullptr while unmapped
+    std::atomic<uint64>* writePosition;
+    uint64 position;    //!< audio thread, the value of writePosition
+
+    JUCE_DECLARE_NON_COPYABLE(SharedOutputRing)
+};
+
+#endif  // SHAREDOUTPUTRING_H_INCLUDED
@@ -0,0 +1,291 @@
+/*
+  ==============================================================================
+
+    SoakTest.cpp
+    Created: 15 Oct 2026 6:12:09pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "SoakTest.h"
+#include "FactoryBank.h"
+#include "RealtimeCheck.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#if JUCE_LINUX
+ #include <unistd.h>
+#elif JUCE_MAC
+ #include <mach/mach.h>
+#endif
+
+AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+namespace {
+    const double sampleRates[] = { 48000., 44100., 96000., 88200. };
+    const int blockSizes[] = { 256, 64, 1024, 511, 32 };
+    const int maxBlockSize = 1024;
+    const int numSampleRates = static_cast<int>(sizeof(sampleRates) / sizeof(sampleRates[0]));
+    const int numBlockSizes = static_cast<int>(sizeof(blockSizes) / sizeof(blockSizes[0]));
+    const double noteSeconds = .25;
+}
+
+SoakTest::SoakTest(const Options& o)
+    : options(o)
+    , random(static_cast<int64>(o.seed))
+    , config(-1)
+    , sampleRate(48000.)
+    , blockSize(256)
+    , seconds(0.)
+    , samplesToNextNote(0)
+    , glideSeconds(0.)
+{
+    noteOffIn.fill(-1);
+    processor = dynamic_cast<PluginAudioProcessor*>(createPluginFilter());
+}
+
+SoakTest::~SoakTest()
+{
+}
+
+bool SoakTest::runFromCommandLine(const StringArray& args, String& error)
+{
+    if (!args.contains("--soak-test")) {
+        return false;
+    }
+    Options o;
+    const int hours = args.indexOf("--hours");
+    if (hours >= 0 && hours + 1 < args.size()) {
+        o.hours = jmax(0.01, args[hours + 1].getDoubleValue());
+    }
+    const int report = args.indexOf("--report-minutes");
+    if (report >= 0 && report + 1 < args.size()) {
+        o.reportMinutes = jmax(0.1, args[report + 1].getDoubleValue());
+    }
+    const int seed = args.indexOf("--seed");
+    if (seed >= 0 && seed + 1 < args.size()) {
+        o.seed = static_cast<uint32>(args[seed + 1].getIntValue());
+    }
+    const int json = args.indexOf("--json");
+    if (json >= 0 && json + 1 < args.size()) {
+        o.json = File::getCurrentWorkingDirectory().getChildFile(args[json + 1].unquoted());
+    }
+
+    SoakTest test(o);
+    error = test.run();
+    return true;
+}
+
+int64 SoakTest::getResidentBytes()
+{
+#if JUCE_LINUX
+    // the second field of statm is the resident set in pages
+    const StringArray fields = StringArray::fromTokens(File("/proc/self/statm").loadFileAsString(), true);
+    return fields.size() > 1 ? fields[1].getLargeIntValue() * static_cast<int64>(sysconf(_SC_PAGESIZE)) : -1;
+#elif JUCE_MAC
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS) {
+        return -1;
+    }
+    return static_cast<int64>(info.resident_size);
+#else
+    return -1;
+#endif
+}
+
+void SoakTest::nextConfig()
+{
+    // the rates and the block sizes have coprime counts, so every pair comes up
+    config = config + 1;
+    sampleRate = sampleRates[config % numSampleRates];
+    blockSize = blockSizes[config % numBlockSizes];
+
+    processor->setPlayConfigDetails(0, 2, sampleRate, blockSize);
+    processor->prepareToPlay(sampleRate, blockSize);
+    // prepareToPlay() stopped all notes
+    noteOffIn.fill(-1);
+    samplesToNextNote = 0;
+}
+
+void SoakTest::fillMidi(MidiBuffer& midi, int numSamples)
+{
+    for (int note = 0; note < static_cast<int>(noteOffIn.size()); ++note) {
+        int& left = noteOffIn[static_cast<size_t>(note)];
+        if (left >= 0 && left < numSamples) {
+            midi.addEvent(MidiMessage::noteOff(1, note), left);
+            left = -1;
+        } else if (left >= numSamples) {
+            left -= numSamples;
+        }
+    }
+
+    // a chord or a single note, held for up to two seconds
+    while (samplesToNextNote < numSamples) {
+        const int pos = static_cast<int>(samplesToNextNote);
+        const int numNotes = random.nextInt(3) == 0 ? 1 + random.nextInt(6) : 1;
+        const int root = 36 + random.nextInt(48);
+        for (int n = 0; n < numNotes; ++n) {
+            const int note = jmin(127, root + n * (3 + random.nextInt(3)));
+            if (noteOffIn[static_cast<size_t>(note)] < 0) {
+                midi.addEvent(MidiMessage::noteOn(1, note, .2f + .8f * random.nextFloat()), pos);
+                noteOffIn[static_cast<size_t>(note)] = pos + 1 + random.nextInt(static_cast<int>(2. * sampleRate));
+            }
+        }
+        samplesToNextNote += 1 + random.nextInt(static_cast<int>(2. * noteSeconds * sampleRate));
+    }
+    samplesToNextNote -= numSamples;
+}
+
+void SoakTest::automate(int numSamples)
+{
+    const OwnedArray<AudioProcessorParameter>& params = processor->getParameters();
+    if (params.size() == 0) {
+        return;
+    }
+    if (glide.param == nullptr || glideSeconds >= automationSeconds) {
+        // the next param glides from where it is to a random value
+        glide.param = params[random.nextInt(params.size())];
+        glide.start = glide.param->getValue();
+        glide.target = random.nextFloat();
+        glideSeconds = 0.;
+    }
+    glideSeconds += numSamples / sampleRate;
+    const float t = static_cast<float>(jmin(1., glideSeconds / automationSeconds));
+    glide.param->setValue(glide.start + (glide.target - glide.start) * t);
+}
+
+String SoakTest::run()
+{
+    if (processor == nullptr) {
+        return "the processor could not be created";
+    }
+    PluginAudioProcessor& p = *processor;
+    ParamStepped<eOnOffToggle>* const fxActivation[] = {
+        &p.lowFiActivation, &p.clippingActivation, &p.delayActivation, &p.chorActivation, &p.reverbActivation, &p.shaperActivation
+    };
+    const int numPrograms = FactoryBank::getNumPrograms();
+
+    AudioSampleBuffer buffer(2, maxBlockSize);
+    MidiBuffer midi;
+    midi.ensureSize(4096);
+    Array<double> nsPerSample;
+    Array<var> reports;
+
+    const double endSeconds = options.hours * 3600.;
+    const double reportSeconds = options.reportMinutes * 60.;
+    double nextPatch = 0.;
+    double nextFx = fxSeconds;
+    double nextConfigAt = configSeconds;
+    double nextReport = reportSeconds;
+    int patch = 0;
+    int64 denormals = 0;
+    int64 nonFinite = 0;
+    int64 ticks = 0;
+    double renderedSeconds = 0.;
+    const int violationsBefore = RealtimeCheck::getViolationCount();
+
+    std::cout << "minutes   rss MB  violations  denormals  non-finite  p50 ns  p99 ns  max ns  realtime" << std::endl;
+    nextConfig();
+    while (seconds < endSeconds) {
+        if (seconds >= nextConfigAt) {
+            nextConfig();
+            nextConfigAt += configSeconds;
+        }
+        if (seconds >= nextPatch && numPrograms > 0) {
+            p.setCurrentProgram(patch++ % numPrograms);
+            nextPatch += patchSeconds;
+        }
+        if (seconds >= nextFx) {
+            ParamStepped<eOnOffToggle>* fx = fxActivation[random.nextInt(static_cast<int>(eFxType::nSteps))];
+            fx->setStep(fx->getStep() == eOnOffToggle::eOn ? eOnOffToggle::eOff : eOnOffToggle::eOn);
+            nextFx += fxSeconds;
+        }
+
+        buffer.setSize(2, blockSize, false, false, true);
+        midi.clear();
+        fillMidi(midi, blockSize);
+        automate(blockSize);
+
+        const int64 start = Time::getHighResolutionTicks();
+        p.processBlock(buffer, midi);
+        const int64 blockTicks = Time::getHighResolutionTicks() - start;
+        ticks += blockTicks;
+        nsPerSample.add(Time::highResolutionTicksToSeconds(blockTicks) * 1.e9 / blockSize);
+
+        denormals += p.getDenormalCount() > 0 ? 1 : 0;
+        for (int c = 0; c < buffer.getNumChannels(); ++c) {
+            const float* samples = buffer.getReadPointer(c);
+            for (int s = 0; s < blockSize; ++s) {
+                nonFinite += std::isfinite(samples[s]) ? 0 : 1;
+            }
+        }
+        seconds += blockSize / sampleRate;
+        renderedSeconds += blockSize / sampleRate;
+
+        if (seconds >= nextReport || seconds >= endSeconds) {
+            std::sort(nsPerSample.begin(), nsPerSample.end());
+            const int n = nsPerSample.size();
+            Report r;
+            r.minutes = seconds / 60.;
+            r.residentBytes = getResidentBytes();
+            r.violations = SYNISTER_REALTIME_CHECKS ? RealtimeCheck::getViolationCount() - violationsBefore : -1;
+            r.denormals = denormals;
+            r.nonFinite = nonFinite;
+            r.p50NsPerSample = nsPerSample[n / 2];
+            r.p99NsPerSample = nsPerSample[jmin(n - 1, n * 99 / 100)];
+            r.maxNsPerSample = nsPerSample.getLast();
+            const double wall = Time::highResolutionTicksToSeconds(ticks);
+            r.realtimeFactor = wall > 0. ? renderedSeconds / wall : 0.;
+            printReport(r);
+            reports.add(toJson(r));
+
+            nsPerSample.clearQuick();
+            denormals = 0;
+            nonFinite = 0;
+            ticks = 0;
+            renderedSeconds = 0.;
+            nextReport += reportSeconds;
+        }
+    }
+    p.releaseResources();
+
+    if (options.json != File::nonexistent) {
+        DynamicObject::Ptr root = new DynamicObject();
+        root->setProperty("cpu", SystemStats::getCpuVendor());
+        root->setProperty("hours", options.hours);
+        root->setProperty("seed", static_cast<int>(options.seed));
+        root->setProperty("reports", reports);
+        if (!options.json.replaceWithText(JSON::toString(var(root.get())))) {
+            return "cannot write " + options.json.getFullPathName();
+        }
+    }
+    return String();
+}
+
+void SoakTest::printReport(const Report& r) const
+{
+    const String rss = r.residentBytes < 0 ? String("n/a") : String(r.residentBytes / (1024. * 1024.), 1);
+    std::cout << String(r.minutes, 1).paddedLeft(' ', 7) << " " << rss.paddedLeft(' ', 8) << " "
+              << (r.violations < 0 ? String("n/a") : String(r.violations)).paddedLeft(' ', 11) << " "
+              << String(r.denormals).paddedLeft(' ', 10) << " " << String(r.nonFinite).paddedLeft(' ', 11) << " "
+              << String(r.p50NsPerSample, 1).paddedLeft(' ', 7) << " " << String(r.p99NsPerSample, 1).paddedLeft(' ', 7) << " "
+              << String(r.maxNsPerSample, 1).paddedLeft(' ', 7) << " " << String(r.realtimeFactor, 1).paddedLeft(' ', 9) << std::endl;
+}
+
+var SoakTest::toJson(const Report& r)
+{
+    DynamicObject::Ptr o = new DynamicObject();
+    o->setProperty("minutes", r.minutes);
+    o->setProperty("residentBytes", r.residentBytes);
+    o->setProperty("violations", r.violations);
+    o->setProperty("denormalBlocks", r.denormals);
+    o->setProperty("nonFinite", r.nonFinite);
+    o->setProperty("p50NsPerSample", r.p50NsPerSample);
+    o->setProperty("p99NsPerSample", r.p99NsPerSample);
+    o->setProperty("maxNsPerSample", r.maxNsPerSample);
+    o->setProperty("realtimeFactor", r.realtimeFactor);
+    return var(o.get());
+}
@@ -0,0 +1,97 @@
+/*
+  ==============================================================================
+
+    SoakTest.h
+    Created: 15 Oct 2026 6:12:09pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef SOAKTEST_H_INCLUDED
+#define SOAKTEST_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "PluginProcessor.h"
+
+//! SoakTest: hours of simulated time through processBlock, for leaks and slow drift
+/*! The processor plays a random but seeded stream of notes as fast as it can render. Every
+    patchSeconds the next factory patch is loaded, host automation glides a random param through
+    HostParam::setValue, an effect is switched every fxSeconds and every configSeconds the
+    processor is prepared again for the next pair of sample rate and block size. Every report
+    interval prints the resident memory, the audio thread violations of a SYNISTER_REALTIME_CHECKS
+    build, the denormals of a debug build, non-finite output samples and the percentiles of the
+    render time per sample, which grows with drifting state before it is audible.
+*/
+class SoakTest {
+public:
+    struct Options {
+        double hours = 1.;              //!< simulated time
+        double reportMinutes = 10.;     //!< simulated time between two report lines
+        uint32 seed = 1;
+        File json;                      //!< the report lines as json, none if it does not exist
+    };
+
+    //! one report interval
+    struct Report {
+        double minutes;                 //!< simulated time at the end of the interval
+        int64 residentBytes;            //!< -1 where the platform does not tell
+        int violations;                 //!< since the start, -1 without realtime checks
+        int64 denormals;                //!< blocks with denormals in the interval, 0 in release builds
+        int64 nonFinite;                //!< NaN or infinite output samples in the interval
+        double p50NsPerSample;
+        double p99NsPerSample;
+        double maxNsPerSample;
+        double realtimeFactor;
+    };
+
+    explicit SoakTest(const Options& o);
+    ~SoakTest();
+
+    //! \brief runs the whole simulated time, prints a line per interval and writes the json, returns an error message or an empty string
+    String run();
+
+    //! \brief parses "--soak-test [--hours <h>] [--report-minutes <m>] [--seed <n>] [--json <file>]", false if the arguments are no soak test
+    static bool runFromCommandLine(const StringArray& args, String& error);
+
+    //! \brief resident memory of the process, -1 where the platform does not tell
+    static int64 getResidentBytes();
+
+    static constexpr double patchSeconds = 30.;
+    static constexpr double fxSeconds = 10.;
+    static constexpr double automationSeconds = .5;
+    static constexpr double configSeconds = 300.;
+
+private:
+    //! automation of one host param, from its value at start to target
+    struct Glide {
+        AudioProcessorParameter* param = nullptr;
+        float start = 0.f;
+        float target = 0.f;
+    };
+
+    //! \brief prepares for the next sample rate and block size
+    void nextConfig();
+    //! \brief the notes of a block, a chord or a short run every quarter second
+    void fillMidi(MidiBuffer& midi, int numSamples);
+    void automate(int numSamples);
+    void printReport(const Report& r) const;
+    static var toJson(const Report& r);
+
+    Options options;
+    ScopedPointer<PluginAudioProcessor> processor;
+    Random random;
+
+    int config;                         //!< index into the rates and block sizes
+    double sampleRate;
+    int blockSize;
+    double seconds;                     //!< simulated time
+    int64 samplesToNextNote;
+    Glide glide;
+    double glideSeconds;
+    std::array<int, 128> noteOffIn;     //!< samples until the note off of every key, -1 if not playing
+
+    JUCE_DECLARE_NON_COPYABLE(SoakTest)
+};
+
+#endif  // SOAKTEST_H_INCLUDED
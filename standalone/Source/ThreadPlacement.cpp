@@ -0,0 +1,231 @@
+/*
+  ==============================================================================
+
+    ThreadPlacement.cpp
+    Created: 16 Oct 2026 3:12:45pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "ThreadPlacement.h"
+#include "RealtimeScheduling.h"
+
+namespace {
+    const char* const placementKey = "threadPlacement";
+
+    //! RealtimeThreadPool::WorkerSetup without context, the workers may run on all cores again
+    void unpinWorker(void*, int)
+    {
+        if (ThreadPlacement::canPinThreads()) {
+            Thread::setCurrentThreadAffinityMask(ThreadPlacement::getAllCores());
+        }
+    }
+
+    int countCores(uint32 cores)
+    {
+        int n = 0;
+        for (; cores != 0; cores &= cores - 1) {
+            ++n;
+        }
+        return n;
+    }
+}
+
+ThreadPlacement::ThreadPlacement(PropertySet& s)
+    : settings(s)
+    , machineKey(SystemStats::getComputerName())
+    , audioCores(0)
+    , realtime(false)
+    , period(0.)
+    , generation(0)
+    , placedThread(nullptr)
+    , placedGeneration(-1)
+{
+    current = readSettings();
+    apply();
+}
+
+ThreadPlacement::~ThreadPlacement()
+{
+    if (threadPool != nullptr) {
+        (*threadPool)->configureWorkers((*threadPool)->getNumWorkers(), &unpinWorker, nullptr);
+    }
+}
+
+void ThreadPlacement::setSettings(const Settings& s)
+{
+    current = s;
+    current.audioCores &= getAllCores();
+    writeSettings(current);
+    apply();
+}
+
+void ThreadPlacement::deviceStarted(double blockSeconds)
+{
+    period.store(blockSeconds);
+    generation.fetch_add(1);
+}
+
+void ThreadPlacement::apply()
+{
+    const uint32 cores = canPinThreads() ? current.audioCores : 0u;
+    audioCores.store(cores);
+    realtime.store(current.realtimeScheduling);
+    generation.fetch_add(1);
+
+    // the editor and the rest of the message thread keep off the audio cores
+    if (canPinThreads()) {
+        const uint32 others = getAllCores() & ~cores;
+        Thread::setCurrentThreadAffinityMask(others != 0 ? others : getAllCores());
+    }
+    if (current.realtimeScheduling) {
+        Process::setPriority(Process::HighPriority);
+    }
+
+    if (cores == 0 && !current.realtimeScheduling) {
+        if (threadPool != nullptr) {
+            (*threadPool)->configureWorkers((*threadPool)->getNumWorkers(), &unpinWorker, nullptr);
+        }
+        threadPool = nullptr;
+        return;
+    }
+    if (threadPool == nullptr) {
+        threadPool = new SharedResourcePointer<RealtimeThreadPool>();
+    }
+    // the audio thread takes the first core, a worker the others
+    RealtimeThreadPool& pool = **threadPool;
+    pool.configureWorkers(cores != 0 ? countCores(cores) - 1 : pool.getNumWorkers(), &setUpWorker, this);
+}
+
+void ThreadPlacement::placeCallbackThread()
+{
+    placedThread = Thread::getCurrentThreadId();
+    placedGeneration = generation.load();
+
+    const uint32 cores = audioCores.load();
+    pinCurrentThread(cores != 0 ? 1u << getNthCore(cores, 0) : 0u);
+    if (realtime.load()) {
+        requestRealtimeScheduling(period.load());
+    }
+}
+
+void ThreadPlacement::setUpWorker(void* context, int worker)
+{
+    const ThreadPlacement& p = *static_cast<const ThreadPlacement*>(context);
+    const uint32 cores = p.audioCores.load();
+    pinCurrentThread(cores != 0 ? 1u << getNthCore(cores, worker) : 0u);
+    if (p.realtime.load()) {
+        requestRealtimeScheduling(p.period.load());
+    }
+}
+
+int ThreadPlacement::getNthCore(uint32 cores, int n)
+{
+    const int numCores = countCores(cores);
+    if (numCores == 0) {
+        return -1;
+    }
+    n %= numCores;
+    for (int c = 0; c < 32; ++c) {
+        if ((cores & (1u << c)) != 0 && n-- == 0) {
+            return c;
+        }
+    }
+    return -1;
+}
+
+void ThreadPlacement::pinCurrentThread(uint32 cores)
+{
+    if (canPinThreads()) {
+        Thread::setCurrentThreadAffinityMask(cores != 0 ? cores : getAllCores());
+    }
+}
+
+void ThreadPlacement::requestRealtimeScheduling(double periodSeconds)
+{
+    RealtimeScheduling::promoteCurrentThread(periodSeconds);
+}
+
+bool ThreadPlacement::canPinThreads()
+{
+#if JUCE_MAC
+    return false;
+#else
+    return true;
+#endif
+}
+
+uint32 ThreadPlacement::getAllCores()
+{
+    const int numCpus = jlimit(1, 32, SystemStats::getNumCpus());
+    return numCpus == 32 ? 0xffffffffu : (1u << numCpus) - 1u;
+}
+
+String ThreadPlacement::formatCores(uint32 cores)
+{
+    StringArray list;
+    for (int c = 0; c < 32; ++c) {
+        if ((cores & (1u << c)) != 0) {
+            list.add(String(c));
+        }
+    }
+    return list.joinIntoString(",");
+}
+
+uint32 ThreadPlacement::parseCores(const String& text)
+{
+    uint32 cores = 0;
+    const StringArray items = StringArray::fromTokens(text, ", ", String::empty);
+    for (const String& item : items) {
+        if (item.isEmpty()) {
+            continue;
+        }
+        const int first = jlimit(0, 31, item.upToFirstOccurrenceOf("-", false, false).getIntValue());
+        const int last = item.contains("-") ? jlimit(first, 31, item.fromFirstOccurrenceOf("-", false, false).getIntValue()) : first;
+        for (int c = first; c <= last; ++c) {
+            cores |= 1u << c;
+        }
+    }
+    return cores & getAllCores();
+}
+
+ThreadPlacement::Settings ThreadPlacement::readSettings() const
+{
+    Settings s;
+    ScopedPointer<XmlElement> machines = settings.getXmlValue(placementKey);
+    if (machines == nullptr) {
+        return s;
+    }
+    forEachXmlChildElementWithTagName(*machines, machine, "machine") {
+        if (machine->getStringAttribute("name") == machineKey) {
+            s.audioCores = parseCores(machine->getStringAttribute("audioCores"));
+            s.realtimeScheduling = machine->getBoolAttribute("realtime");
+            break;
+        }
+    }
+    return s;
+}
+
+void ThreadPlacement::writeSettings(const Settings& s)
+{
+    ScopedPointer<XmlElement> machines = settings.getXmlValue(placementKey);
+    if (machines == nullptr) {
+        machines = new XmlElement("threadplacement");
+    }
+
+    XmlElement* machine = nullptr;
+    forEachXmlChildElementWithTagName(*machines, e, "machine") {
+        if (e->getStringAttribute("name") == machineKey) {
+            machine = e;
+            break;
+        }
+    }
+    if (machine == nullptr) {
+        machine = machines->createNewChildElement("machine");
+        machine->setAttribute("name", machineKey);
+    }
+    machine->setAttribute("audioCores", formatCores(s.audioCores));
+    machine->setAttribute("realtime", s.realtimeScheduling);
+    settings.setValue(placementKey, machines);
+}
@@ -0,0 +1,97 @@
+/*
+  ==============================================================================
+
+    ThreadPlacement.h
+    Created: 16 Oct 2026 3:12:45pm
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef THREADPLACEMENT_H_INCLUDED
+#define THREADPLACEMENT_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "RealtimeThreadPool.h"
+#include <atomic>
+
+//! ThreadPlacement: the cores and the scheduling of the audio callback and the engine workers of the standalone
+/*! The settings are stored per machine in the settings file of the application, under the name
+    of the computer, so a settings folder that roams with the user does not move them to a stage
+    PC with other cores. With audio cores chosen the audio callback runs on the first of them,
+    the workers of the RealtimeThreadPool on one each of the others, and the message thread with
+    the editor on all the other cores. Real-time scheduling asks the system for the class of
+    audio threads for the callback as well, see RealtimeScheduling, the workers have it anyway.
+    macOS cannot pin threads to cores, there only the scheduling applies.
+    A new callback thread, e.g. after the device was restarted, is placed in its first callback.
+*/
+class ThreadPlacement {
+public:
+    struct Settings {
+        uint32 audioCores = 0;          //!< bit per core, 0 leaves the threads to the system
+        bool realtimeScheduling = false;
+    };
+
+    explicit ThreadPlacement(PropertySet& s);
+    ~ThreadPlacement();
+
+    Settings getSettings() const { return current; }
+    //! \brief stores the settings for this machine and applies them, message thread
+    void setSettings(const Settings& s);
+
+    //! \brief the device starts with blocks of that duration, the next callback places its thread again
+    void deviceStarted(double blockSeconds);
+    //! \brief audio thread, at the start of every callback: places the thread if it is new or the settings changed
+    void placeAudioThread() {
+        if (generation.load(std::memory_order_relaxed) != placedGeneration || Thread::getCurrentThreadId() != placedThread) {
+            placeCallbackThread();
+        }
+    }
+
+    //! \brief false on macOS, where a thread cannot be pinned to a core
+    static bool canPinThreads();
+    //! \brief a bit for every core of the machine, up to 32
+    static uint32 getAllCores();
+    //! \brief "2,3" for cores 2 and 3, counted from 0
+    static String formatCores(uint32 cores);
+    //! \brief the cores of a list like "2,3" or "2-5", those the machine has not are left out
+    static uint32 parseCores(const String& text);
+
+private:
+    void apply();
+    void placeCallbackThread();
+    //! RealtimeThreadPool::WorkerSetup
+    static void setUpWorker(void* context, int worker);
+    //! \brief the core of the n-th bit set in the mask, cycling, -1 for no cores
+    static int getNthCore(uint32 cores, int n);
+    static void pinCurrentThread(uint32 cores);
+    static void requestRealtimeScheduling(double periodSeconds);
+
+    Settings readSettings() const;
+    void writeSettings(const Settings& s);
+
+    PropertySet& settings;
+    const String machineKey;
+    Settings current;
+
+    //! \name read by the audio thread and the workers
+    ///@{
+    std::atomic<uint32> audioCores;
+    std::atomic<bool> realtime;
+    std::atomic<double> period;     //!< s of a block of the device
+    std::atomic<int> generation;    //!< counts the changes of the above
+    ///@}
+
+    //! \name audio thread
+    ///@{
+    Thread::ThreadID placedThread;
+    int placedGeneration;
+    ///@}
+
+    //! created while threads are placed, the workers start with it
+    ScopedPointer<SharedResourcePointer<RealtimeThreadPool>> threadPool;
+
+    JUCE_DECLARE_NON_COPYABLE(ThreadPlacement)
+};
+
+#endif  // THREADPLACEMENT_H_INCLUDED
@@ -0,0 +1,322 @@
+/*
+  ==============================================================================
+
+    VoiceBenchmark.cpp
+    Created: 15 Oct 2026 7:40:15am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#include "VoiceBenchmark.h"
+#include "Voice.h"
+#include "SimdKernels.h"
+#include <iostream>
+
+AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+namespace {
+    const int maxVoices = 64;
+    const int warmUpBlocks = 16;
+
+    const char* const waveNames[] = { "square", "saw", "noise", "wavetable" };
+    const char* const filterNames[] = { "lowpass", "highpass", "bandpass", "ladder" };
+
+    //! \brief the source and the amount of mod row r of the benchmark
+    void getModRow(SynthParams& p, int r, ParamStepped<eModSource>*& src, Param*& amount)
+    {
+        SynthParams::Osc& o = p.osc[0];
+        SynthParams::Filter& f = p.filter[0];
+        ParamStepped<eModSource>* const sources[VoiceBenchmark::maxModRows] = {
+            &f.lpCutModSrc1, &o.pitchModSrc1, &o.gainModSrc1, &o.panModSrc1,
+            &f.resonanceModSrc1, &o.shapeModSrc1, &f.hpCutModSrc1, &p.lfo[0].freqModSrc1,
+            &f.lpCutModSrc2, &o.pitchModSrc2, &o.gainModSrc2, &o.panModSrc2,
+            &f.resonanceModSrc2, &o.shapeModSrc2, &f.hpCutModSrc2, &p.lfo[0].freqModSrc2,
+        };
+        Param* const amounts[VoiceBenchmark::maxModRows] = {
+            &f.lpModAmount1, &o.pitchModAmount1, &o.gainModAmount1, &o.panModAmount1,
+            &f.resModAmount1, &o.shapeModAmount1, &f.hpModAmount1, &p.lfo[0].freqModAmount1,
+            &f.lpModAmount2, &o.pitchModAmount2, &o.gainModAmount2, &o.panModAmount2,
+            &f.resModAmount2, &o.shapeModAmount2, &f.hpModAmount2, &p.lfo[0].freqModAmount2,
+        };
+        src = sources[r];
+        amount = amounts[r];
+    }
+
+    template <typename T>
+    void addIfEmpty(Array<T>& dst, const T* values, int num)
+    {
+        if (dst.size() == 0) {
+            dst.addArray(values, num);
+        }
+    }
+}
+
+VoiceBenchmark::VoiceBenchmark(const Options& o)
+    : options(o)
+    , arenaSize(0)
+{
+    const eOscWaves waves[] = { eOscWaves::eOscSquare, eOscWaves::eOscSaw, eOscWaves::eOscNoise, eOscWaves::eOscWavetable };
+    const eBiquadFilters filters[] = { eBiquadFilters::eLowpass, eBiquadFilters::eHighpass, eBiquadFilters::eBandpass, eBiquadFilters::eLadder };
+    const int modRows[] = { 0, 4, 8, 16 };
+    const int blockSizes[] = { 16, 32, 64, 128, 256, 512, 1024, 2048 };
+    const double sampleRates[] = { 44100., 48000., 88200., 96000., 192000. };
+    const int voiceCounts[] = { 1, 4, 8, 16, 32, 64 };
+    addIfEmpty(options.waves, waves, 4);
+    addIfEmpty(options.filters, filters, 4);
+    addIfEmpty(options.modRows, modRows, 4);
+    addIfEmpty(options.blockSizes, blockSizes, 8);
+    addIfEmpty(options.sampleRates, sampleRates, 5);
+    addIfEmpty(options.voiceCounts, voiceCounts, 6);
+
+    processor = dynamic_cast<PluginAudioProcessor*>(createPluginFilter());
+    if (processor != nullptr) {
+        for (int v = 0; v < maxVoices; ++v) {
+            synth.addVoice(new Voice(*processor));
+        }
+        synth.addSound(new Sound());
+    }
+}
+
+VoiceBenchmark::~VoiceBenchmark()
+{
+    // the voices refer to the params of the processor
+    synth.clearVoices();
+    processor = nullptr;
+}
+
+bool VoiceBenchmark::runFromCommandLine(const StringArray& args, String& error)
+{
+    if (!args.contains("--benchmark")) {
+        return false;
+    }
+    Options o;
+    o.full = args.contains("--full");
+    const int json = args.indexOf("--json");
+    if (json >= 0 && json + 1 < args.size()) {
+        o.json = File::getCurrentWorkingDirectory().getChildFile(args[json + 1].unquoted());
+    }
+    const int seconds = args.indexOf("--seconds");
+    if (seconds >= 0 && seconds + 1 < args.size()) {
+        o.secondsPerCase = jmax(0.01, args[seconds + 1].getDoubleValue());
+    }
+
+    VoiceBenchmark benchmark(o);
+    error = benchmark.run();
+    return true;
+}
+
+void VoiceBenchmark::collectCases(Array<Case>& cases) const
+{
+    if (options.full) {
+        for (eOscWaves w : options.waves)
+        for (eBiquadFilters f : options.filters)
+        for (int m : options.modRows)
+        for (int b : options.blockSizes)
+        for (double r : options.sampleRates)
+        for (int v : options.voiceCounts) {
+            Case c;
+            c.wave = w; c.filter = f; c.modRows = m; c.blockSize = b; c.sampleRate = r; c.numVoices = v;
+            cases.add(c);
+        }
+        return;
+    }
+
+    // one dimension at a time, the others at the base case
+    const Case base;
+    cases.add(base);
+    for (eOscWaves w : options.waves) {
+        if (w != base.wave) { Case c = base; c.wave = w; cases.add(c); }
+    }
+    for (eBiquadFilters f : options.filters) {
+        if (f != base.filter) { Case c = base; c.filter = f; cases.add(c); }
+    }
+    for (int m : options.modRows) {
+        if (m != base.modRows) { Case c = base; c.modRows = m; cases.add(c); }
+    }
+    for (int b : options.blockSizes) {
+        if (b != base.blockSize) { Case c = base; c.blockSize = b; cases.add(c); }
+    }
+    for (double r : options.sampleRates) {
+        if (r != base.sampleRate) { Case c = base; c.sampleRate = r; cases.add(c); }
+    }
+    for (int v : options.voiceCounts) {
+        if (v != base.numVoices) { Case c = base; c.numVoices = v; cases.add(c); }
+    }
+}
+
+String VoiceBenchmark::run()
+{
+    if (processor == nullptr) {
+        return "the processor could not be created";
+    }
+
+    Array<Case> cases;
+    collectCases(cases);
+
+    const double cpuMHz = SystemStats::getCpuSpeedInMegaherz();
+    Array<var> results;
+    std::cout << "wave       filter    rows  block    rate  voices  ns/sample/voice  mod ns  cycles" << std::endl;
+    for (const Case& c : cases) {
+        Result r = runCase(c);
+        r.cyclesPerSampleVoice = r.nsPerSampleVoice * cpuMHz * 1.e-3;
+        std::cout << String(waveNames[static_cast<int>(c.wave)]).paddedRight(' ', 10) << " "
+                  << String(filterNames[static_cast<int>(c.filter)]).paddedRight(' ', 9) << " "
+                  << String(c.modRows).paddedLeft(' ', 4) << " "
+                  << String(c.blockSize).paddedLeft(' ', 6) << " "
+                  << String(static_cast<int>(c.sampleRate)).paddedLeft(' ', 7) << " "
+                  << String(r.activeVoices).paddedLeft(' ', 3) << "/" << String(c.numVoices).paddedRight(' ', 3) << " "
+                  << String(r.nsPerSampleVoice, 2).paddedLeft(' ', 16) << " "
+                  << String(r.modulationNsPerSampleVoice, 2).paddedLeft(' ', 7) << " "
+                  << String(r.cyclesPerSampleVoice, 1).paddedLeft(' ', 7) << std::endl;
+        results.add(toJson(r));
+    }
+
+    if (options.json != File::nonexistent) {
+        DynamicObject::Ptr root = new DynamicObject();
+        root->setProperty("cpu", SystemStats::getCpuVendor());
+        root->setProperty("cpuMHz", cpuMHz);
+        root->setProperty("simd", SimdKernels::get().name);
+        root->setProperty("secondsPerCase", options.secondsPerCase);
+        root->setProperty("metric", "nsPerSampleVoice");
+        root->setProperty("results", results);
+        if (!options.json.replaceWithText(JSON::toString(var(root.get())))) {
+            return "cannot write " + options.json.getFullPathName();
+        }
+    }
+    return String();
+}
+
+void VoiceBenchmark::setupParams(const Case& c)
+{
+    SynthParams& p = *processor;
+    p.osc[0].oscActivation.setStep(eOnOffToggle::eOn);
+    p.osc[0].waveForm.setStep(c.wave);
+    p.osc[0].unisonVoices.set(static_cast<float>(c.unisonVoices));
+    for (size_t o = 1; o < p.osc.size(); ++o) {
+        p.osc[o].oscActivation.setStep(eOnOffToggle::eOff);
+    }
+    p.filter[0].filterActivation.setStep(c.filterActive ? eOnOffToggle::eOn : eOnOffToggle::eOff);
+    p.filter[0].passtype.setStep(c.filter);
+    p.filter[0].topology.setStep(c.topology);
+    p.filter[1].filterActivation.setStep(eOnOffToggle::eOff);
+    // sustained notes, no voice ends during a case
+    p.envVol[0].sustain.setUI(-6.f, false);
+
+    // the first rows from the lfos and envelopes at half their range
+    const eModSource rowSources[] = { eModSource::eLFO1, eModSource::eEnv2, eModSource::eLFO2, eModSource::eVelocity };
+    for (int r = 0; r < maxModRows; ++r) {
+        ParamStepped<eModSource>* src;
+        Param* amount;
+        getModRow(p, r, src, amount);
+        if (r < c.modRows) {
+            src->setStep(rowSources[r % 4]);
+            amount->set(amount->getMin() + (amount->getMax() - amount->getMin()) * 0.75f);
+        } else {
+            src->setStep(eModSource::eNone);
+            amount->set(amount->getDefault());
+        }
+    }
+}
+
+VoiceBenchmark::Result VoiceBenchmark::runCase(const Case& c)
+{
+    const ScopedFlushToZero flushToZero;
+    setupParams(c);
+    SynthParams& p = *processor;
+
+    // the voices on one arena like the synth of the processor
+    const size_t voiceSize = Voice::getArenaSize(c.blockSize);
+    const size_t size = voiceSize * maxVoices + Voice::arenaAlignment;
+    if (size > arenaSize) {
+        arena.allocate(size, true);
+        arenaSize = size;
+    }
+    const size_t cacheLine = sizeof(float) * Voice::arenaAlignment;
+    const size_t misalignment = reinterpret_cast<pointer_sized_uint>(arena.getData()) % cacheLine;
+    float* aligned = arena + (misalignment == 0 ? 0 : (cacheLine - misalignment) / sizeof(float));
+
+    synth.allNotesOff(0, false);
+    synth.setCurrentPlaybackSampleRate(c.sampleRate);
+    for (int v = 0; v < maxVoices; ++v) {
+        Voice* voice = static_cast<Voice*>(synth.getVoice(v));
+        voice->prepare(c.sampleRate, c.blockSize, aligned + voiceSize * static_cast<size_t>(v));
+        voice->setRandomSeed(static_cast<uint32>(v + 1));
+    }
+    p.updateSnapshot(eQualityTier::eRealtime);
+    p.globalModMatrix.compile();
+    p.compileRenderPlan();
+    for (int v = 0; v < c.numVoices; ++v) {
+        synth.noteOn(1, 36 + (v * 7) % 60, 0.8f);
+    }
+
+    AudioSampleBuffer buffer(2, c.blockSize);
+    Array<Voice*> playing;
+    for (int v = 0; v < maxVoices; ++v) {
+        if (synth.getVoice(v)->isVoiceActive()) {
+            playing.add(static_cast<Voice*>(synth.getVoice(v)));
+        }
+    }
+
+    // renders blocks until the time of the case is up, returns the ns per sample and voice
+    auto measure = [&](bool modulationOnly) {
+        const int64 budget = Time::secondsToHighResolutionTicks(options.secondsPerCase * 0.5);
+        int64 elapsed = 0;
+        int64 blocks = 0;
+        for (int b = -warmUpBlocks; elapsed < budget; ++b) {
+            const int64 start = Time::getHighResolutionTicks();
+            // per block like processBlock
+            p.updateSnapshot(eQualityTier::eRealtime);
+            p.globalModMatrix.compile();
+            p.compileRenderPlan();
+            buffer.clear();
+            for (Voice* voice : playing) {
+                if (modulationOnly) {
+                    // renderModulation() and the increments of the oscillators, without rendering them
+                    if (voice->beginBlock(c.blockSize)) {
+                        voice->endBlock(c.blockSize);
+                    }
+                } else {
+                    voice->renderNextBlock(buffer, 0, c.blockSize);
+                }
+            }
+            if (b >= 0) {
+                elapsed += Time::getHighResolutionTicks() - start;
+                ++blocks;
+            }
+        }
+        const double samples = static_cast<double>(blocks) * c.blockSize * jmax(1, playing.size());
+        return Time::highResolutionTicksToSeconds(elapsed) * 1.e9 / samples;
+    };
+
+    Result r;
+    r.c = c;
+    r.modulationNsPerSampleVoice = measure(true);
+    r.nsPerSampleVoice = measure(false);
+    r.cyclesPerSampleVoice = 0.;
+    r.activeVoices = 0;
+    for (Voice* voice : playing) {
+        r.activeVoices += voice->isVoiceActive() ? 1 : 0;
+    }
+    synth.allNotesOff(0, false);
+    return r;
+}
+
+var VoiceBenchmark::toJson(const Result& r)
+{
+    DynamicObject::Ptr o = new DynamicObject();
+    o->setProperty("case", String(waveNames[static_cast<int>(r.c.wave)]) + " / " + filterNames[static_cast<int>(r.c.filter)]
+                           + " / " + String(r.c.modRows) + " rows / " + String(r.c.blockSize) + " / "
+                           + String(static_cast<int>(r.c.sampleRate)) + " Hz / " + String(r.c.numVoices) + " voices");
+    o->setProperty("wave", waveNames[static_cast<int>(r.c.wave)]);
+    o->setProperty("filter", filterNames[static_cast<int>(r.c.filter)]);
+    o->setProperty("modRows", r.c.modRows);
+    o->setProperty("blockSize", r.c.blockSize);
+    o->setProperty("sampleRate", r.c.sampleRate);
+    o->setProperty("voices", r.c.numVoices);
+    o->setProperty("activeVoices", r.activeVoices);
+    o->setProperty("nsPerSampleVoice", r.nsPerSampleVoice);
+    o->setProperty("modulationNsPerSampleVoice", r.modulationNsPerSampleVoice);
+    o->setProperty("cyclesPerSampleVoice", r.cyclesPerSampleVoice);
+    return var(o.get());
+}
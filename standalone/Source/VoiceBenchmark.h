@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    VoiceBenchmark.h
+    Created: 15 Oct 2026 7:40:15am
+    Author:  Synister Team
+
+  ==============================================================================
+*/
+
+#ifndef VOICEBENCHMARK_H_INCLUDED
+#define VOICEBENCHMARK_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "PluginProcessor.h"
+
+//! VoiceBenchmark: times the modulation and the whole Voice::renderNextBlock without host, editor or fx
+/*! The voices play on a processor that is never prepared, so only its params and its mod matrix
+    are used. Every case sets waveform, filter type and the number of mod rows, prepares the voices
+    for its rate and block size, starts its number of sustained notes and renders blocks for a fixed
+    amount of wall clock time, like processBlock does with snapshot and compiled routes. By default
+    one dimension is swept at a time around a base case, --full sweeps all combinations.
+*/
+class VoiceBenchmark {
+public:
+    struct Options {
+        Array<eOscWaves> waves;
+        Array<eBiquadFilters> filters;
+        Array<int> modRows;
+        Array<int> blockSizes;
+        Array<double> sampleRates;
+        Array<int> voiceCounts;
+        bool full = false;              //!< all combinations instead of one dimension at a time
+        double secondsPerCase = 0.2;
+        File json;                      //!< the results as json, none if it does not exist
+    };
+
+    struct Case {
+        eOscWaves wave = eOscWaves::eOscSaw;
+        eBiquadFilters filter = eBiquadFilters::eLowpass;
+        int modRows = 4;
+        int blockSize = 512;
+        double sampleRate = 48000.;
+        int numVoices = 8;
+        bool filterActive = true;       //!< the filter of the case, the cost calibration also renders without
+        eFilterTopology topology = eFilterTopology::eBiquad;
+        int unisonVoices = 1;
+    };
+
+    struct Result {
+        Case c;
+        int activeVoices;               //!< still playing at the end, less than numVoices means the case is off
+        double nsPerSampleVoice;        //!< whole voice, modulation included
+        double modulationNsPerSampleVoice;  //!< beginBlock() and endBlock() only, the modulation and the increments
+        double cyclesPerSampleVoice;    //!< from the nominal clock of the cpu
+    };
+
+    explicit VoiceBenchmark(const Options& o);
+    ~VoiceBenchmark();
+
+    //! \brief runs all cases, prints a line per case and writes the json, returns an error message or an empty string
+    String run();
+
+    //! \brief parses "--benchmark [--full] [--json <file>] [--seconds <s>]" and runs, false if the arguments are no benchmark
+    static bool runFromCommandLine(const StringArray& args, String& error);
+
+    //! \brief renders one case, see CostCalibration
+    Result runCase(const Case& c);
+
+    //! the mod rows of the cases, in the order they are turned on
+    static const int maxModRows = 16;
+
+private:
+    void setupParams(const Case& c);
+    void collectCases(Array<Case>& cases) const;
+    static var toJson(const Result& r);
+
+    Options options;
+    ScopedPointer<PluginAudioProcessor> processor;   //!< params and mod matrix of the voices
+    Synthesiser synth;
+    HeapBlock<float> arena;
+    size_t arenaSize;
+
+    JUCE_DECLARE_NON_COPYABLE(VoiceBenchmark)
+};
+
+#endif  // VOICEBENCHMARK_H_INCLUDED